@@ -71,15 +71,31 @@ extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const int32_t sinTable_q32[FAST_MATH_TABLE_SIZE + 1];
 extern const int16_t sinTable_q16[FAST_MATH_TABLE_SIZE + 1];
 
+extern const uint32_t logRecipTable_q32[FAST_MATH_LOG_TABLE_SIZE];
+extern const uint32_t logTable_q32[FAST_MATH_LOG_TABLE_SIZE];
+extern const uint32_t expTable_q32[FAST_MATH_LOG_TABLE_SIZE];
+
+extern const Complex_type_f32 twiddleCoef_rfft_16[8];
 extern const Complex_type_f32 twiddleCoef_rfft_32[16];
+extern const Complex_type_f32 twiddleCoef_rfft_64[32];
 extern const Complex_type_f32 twiddleCoef_rfft_128[64];
+extern const Complex_type_f32 twiddleCoef_rfft_256[128];
 extern const Complex_type_f32 twiddleCoef_rfft_512[256];
+extern const Complex_type_f32 twiddleCoef_rfft_1024[512];
 extern const Complex_type_f32 twiddleCoef_rfft_2048[1024];
+extern const Complex_type_f32 twiddleCoef_rfft_4096[2048];
+extern const Complex_type_f32 twiddleCoef_rfft_8192[4096];
 
+extern short bit_rev_radix2_LUT_16[16];
 extern short bit_rev_radix2_LUT_32[32];
+extern short bit_rev_radix2_LUT_64[64];
 extern short bit_rev_radix2_LUT_128[128];
+extern short bit_rev_radix2_LUT_256[256];
 extern short bit_rev_radix2_LUT_512[512];
+extern short bit_rev_radix2_LUT_1024[1024];
 extern short bit_rev_radix2_LUT[2048];
+extern short bit_rev_radix2_LUT_4096[4096];
+extern short bit_rev_radix2_LUT_8192[8192];
 
 extern const float32_t melFbTable_f32_23[25];
 extern const float32_t melFbTable_f32_26[28];
@@ -48,10 +48,20 @@ extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len1024;
 extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len2048;
 extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len4096;
 
+/* Real FFT instances with bitReverseFlag = 1, they return the bins in natural order as needed by
+   plp_mfcc_f32. The earlier instances for the lengths 32, 128, 512 and 2048 had bitReverseFlag = 0
+   and returned the bins in bit-reversed order; copy an instance and clear the flag to keep that
+   order. */
+extern const plp_fft_instance_f32 plp_rfft_sR_f32_len16;
 extern const plp_fft_instance_f32 plp_rfft_sR_f32_len32;
+extern const plp_fft_instance_f32 plp_rfft_sR_f32_len64;
 extern const plp_fft_instance_f32 plp_rfft_sR_f32_len128;
+extern const plp_fft_instance_f32 plp_rfft_sR_f32_len256;
 extern const plp_fft_instance_f32 plp_rfft_sR_f32_len512;
+extern const plp_fft_instance_f32 plp_rfft_sR_f32_len1024;
 extern const plp_fft_instance_f32 plp_rfft_sR_f32_len2048;
+extern const plp_fft_instance_f32 plp_rfft_sR_f32_len4096;
+extern const plp_fft_instance_f32 plp_rfft_sR_f32_len8192;
 
 extern const plp_triangular_filter_f32 plp_triangular_filter_f32_32;
 #endif // PLP_CONST_STRUCTS_H
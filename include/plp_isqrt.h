@@ -0,0 +1,90 @@
+/** ==========================================================================
+ * @file     plp_isqrt.h
+ * @brief    Integer square root helpers shared by the fixed-point kernels
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Internal header of the library, included by the kernels only; the functions are not part of
+ * the API declared in plp_math.h.
+ */
+
+#ifndef __PLP_ISQRT_H__
+#define __PLP_ISQRT_H__
+
+#include <stdint.h>
+
+/*
+ * floor(sqrt(v)) for v > 0: v is normalized by an even shift to m in [2^30, 2^32), a linear guess
+ * of sqrt(m) (within 6%) is refined by three newton iterations and a final correction, and the
+ * result is shifted back by half the normalization.
+ */
+static inline uint32_t plp_isqrt32(uint32_t v) {
+
+    uint32_t shift = __builtin_clz(v) & ~1U;
+    uint32_t m = v << shift;
+    uint32_t y = 0x5555 + (m >> 17) + (m >> 19) + (m >> 21);
+
+    y = (y + m / y) >> 1;
+    y = (y + m / y) >> 1;
+    y = (y + m / y) >> 1;
+
+    if (y > 0xFFFF) {
+        y = 0xFFFF;
+    }
+    while (y * y > m) {
+        y--;
+    }
+    while (y < 0xFFFF && (y + 1) * (y + 1) <= m) {
+        y++;
+    }
+
+    return y >> (shift >> 1);
+}
+
+/*
+ * floor(sqrt(v)) for v > 0: after normalizing v to m in [2^62, 2^64), the square root of the upper
+ * word gives the upper 16 bits, and one newton step y + (m - y^2) / 2y, computed with a 32-bit
+ * division, the lower 16 bits.
+ */
+static inline uint32_t plp_isqrt64(uint64_t v) {
+
+    uint32_t hi = (uint32_t)(v >> 32);
+    uint32_t shift = (hi ? __builtin_clz(hi) : 32 + __builtin_clz((uint32_t)v)) & ~1U;
+    uint64_t m = v << shift;
+    uint32_t yh = plp_isqrt32((uint32_t)(m >> 32));
+    uint64_t r = m - (((uint64_t)yh * yh) << 32);
+    uint64_t y = ((uint64_t)yh << 16) + (uint32_t)(r >> 17) / yh;
+
+    if (y > 0xFFFFFFFFU) {
+        y = 0xFFFFFFFFU;
+    }
+    while (y * y > m) {
+        y--;
+    }
+    while (y < 0xFFFFFFFFU && (y + 1) * (y + 1) <= m) {
+        y++;
+    }
+
+    return (uint32_t)(y >> (shift >> 1));
+}
+
+#endif /* __PLP_ISQRT_H__ */
@@ -0,0 +1,79 @@
+/** ==========================================================================
+ * @file     plp_log_reduce.h
+ * @brief    Range reduction shared by the floating-point logarithm kernels
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* used by the vlog, vlog2 and vlog10 f32 kernels, not part of the public API */
+
+#ifndef __PLP_LOG_REDUCE_H__
+#define __PLP_LOG_REDUCE_H__
+
+#include "plp_math.h"
+
+/*
+ * Splits x > 0 into x = 2^e * (1 + m) with 1 + m in [sqrt(1/2), sqrt(2)) and returns
+ * ln(1 + m) - m, approximated by the minimax polynomial of the Cephes logf. Subnormal inputs are
+ * normalized first.
+ */
+static inline float32_t plp_log_reduce_f32(float32_t x, int32_t *pExp, float32_t *pM) {
+
+    union {
+        float32_t f;
+        int32_t i;
+    } conv;
+    int32_t e = 0;
+    float32_t m, z, y;
+
+    conv.f = x;
+    if (conv.i < 0x00800000) {
+        conv.f = x * 8388608.0f;
+        e = -23;
+    }
+    e += ((conv.i >> 23) & 0xFF) - 126;
+    conv.i = (conv.i & 0x007FFFFF) | 0x3F000000;
+    m = conv.f;
+
+    if (m < 0.70710678f) {
+        e -= 1;
+        m = m + m - 1.0f;
+    } else {
+        m = m - 1.0f;
+    }
+
+    z = m * m;
+    y = 7.0376836292E-2f;
+    y = y * m - 1.1514610310E-1f;
+    y = y * m + 1.1676998740E-1f;
+    y = y * m - 1.2420140846E-1f;
+    y = y * m + 1.4249322787E-1f;
+    y = y * m - 1.6668057665E-1f;
+    y = y * m + 2.0000714765E-1f;
+    y = y * m - 2.4999993993E-1f;
+    y = y * m + 3.3333331174E-1f;
+    y = y * m * z - 0.5f * z;
+
+    *pExp = e;
+    *pM = m;
+    return y;
+}
+
+#endif /* __PLP_LOG_REDUCE_H__ */
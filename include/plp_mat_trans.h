@@ -0,0 +1,62 @@
+/** ==========================================================================
+ * @file     plp_mat_trans.h
+ * @brief    Tile shuffles and row distribution shared by the matrix transpose kernels
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Internal header of the library, included by the kernels only; the macros are not part of
+ * the API declared in plp_math.h.
+ */
+
+#ifndef __PLP_MAT_TRANS_H__
+#define __PLP_MAT_TRANS_H__
+
+#include "plp_math.h"
+
+/* 2x2 tile of 16-bit values: rows {a0, a1}, {b0, b1} become {a0, b0}, {a1, b1} */
+#define TRANS_2X2(a, b, c0, c1)                                                                    \
+    do {                                                                                           \
+        c0 = __builtin_shuffle(a, b, (v2s){ 0, 2 });                                               \
+        c1 = __builtin_shuffle(a, b, (v2s){ 1, 3 });                                               \
+    } while (0)
+
+/* 4x4 tile of 8-bit values in four words r0..r3, transposed in two shuffle stages: the first one
+   interleaves the even and odd lanes of two rows, the second one the 16-bit halves */
+#define TRANS_4X4(r0, r1, r2, r3)                                                                  \
+    do {                                                                                           \
+        v4s _t0 = __builtin_shuffle(r0, r1, (v4s){ 0, 4, 2, 6 });                                  \
+        v4s _t1 = __builtin_shuffle(r0, r1, (v4s){ 1, 5, 3, 7 });                                  \
+        v4s _t2 = __builtin_shuffle(r2, r3, (v4s){ 0, 4, 2, 6 });                                  \
+        v4s _t3 = __builtin_shuffle(r2, r3, (v4s){ 1, 5, 3, 7 });                                  \
+        r0 = __builtin_shuffle(_t0, _t2, (v4s){ 0, 1, 4, 5 });                                     \
+        r1 = __builtin_shuffle(_t1, _t3, (v4s){ 0, 1, 4, 5 });                                     \
+        r2 = __builtin_shuffle(_t0, _t2, (v4s){ 2, 3, 6, 7 });                                     \
+        r3 = __builtin_shuffle(_t1, _t3, (v4s){ 2, 3, 6, 7 });                                     \
+    } while (0)
+
+/* rows (or tile rows) of the in-place transpose are dealt out back and forth, core k gets rows k
+   and 2 nPE - 1 - k of every 2 nPE, so that the long upper rows and the short lower rows of the
+   triangle are balanced */
+#define OWNS_ROW(row, core, nPE)                                                                   \
+    ((row) % (2 * (nPE)) == (core) || (row) % (2 * (nPE)) == 2 * (nPE) - 1 - (core))
+
+#endif /* __PLP_MAT_TRANS_H__ */
@@ -121,14 +121,14 @@ typedef float float32_t;
     @brief Instance structure for integer parallel dot product.
     @param[in]  pSrcA      points to the first input vector
     @param[in]  pSrcB      points to the second input vector
-    @param[in]  blkSizePE  number of samples in each vector
+    @param[in]  blockSize  number of samples in each vector
     @param[in]  nPE        number of parallel processing units
     @param[out] resBuffer  pointer to the result buffer
 */
 typedef struct {
     int32_t *pSrcA;     // pointer to the first vector
     int32_t *pSrcB;     // pointer to the second vector
-    uint32_t blkSizePE; // number of samples in each vector
+    uint32_t blockSize; // number of samples in each vector
     uint32_t nPE;       // number of processing units
     int32_t *resBuffer; // pointer to result vector
 } plp_dot_prod_instance_i32;
@@ -137,14 +137,14 @@ typedef struct {
     @brief Instance structure for fixed point parallel dot product.
     @param[in]  pSrcA      points to the first input vector
     @param[in]  pSrcB      points to the second input vector
-    @param[in]  blkSizePE  number of samples in each vector
+    @param[in]  blockSize  number of samples in each vector
     @param[in]  nPE        number of parallel processing units
     @param[out] resBuffer  pointer to the result buffer
 */
 typedef struct {
     int32_t *pSrcA;     // pointer to the first vector
     int32_t *pSrcB;     // pointer to the second vector
-    uint32_t blkSizePE; // number of samples in each vector
+    uint32_t blockSize; // number of samples in each vector
     uint32_t deciPoint; // decimal point for right shift
     uint32_t nPE;       // number of processing units
     int32_t *resBuffer; // pointer to result vector
@@ -155,14 +155,14 @@ typedef struct {
     @brief Instance structure for float parallel dot product.
     @param[in]  pSrcA      points to the first input vector
     @param[in]  pSrcB      points to the second input vector
-    @param[in]  blkSizePE  number of samples in each vector
+    @param[in]  blockSize  number of samples in each vector
     @param[in]  nPE        number of parallel processing units
     @param[out] resBuffer  pointer to the result buffer
 */
 typedef struct {
     const float32_t *pSrcA; // pointer to the first vector
     const float32_t *pSrcB; // pointer to the second vector
-    uint32_t blkSizePE;     // number of samples in each vector
+    uint32_t blockSize;     // number of samples in each vector
     uint32_t nPE;           // number of processing units
     float32_t *resBuffer;   // pointer to result vector
 } plp_dot_prod_instance_f32;
@@ -172,14 +172,14 @@ typedef struct {
     @brief Instance structure for float parallel multiplication.
     @param[in]  pSrcA      points to the first input vector
     @param[in]  pSrcB      points to the second input vector
-    @param[in]  blkSizePE  number of samples in each vector
+    @param[in]  blockSize  number of samples in each vector
     @param[in]  nPE        number of parallel processing units
     @param[out] resBuffer  pointer to the result buffer
 */
 typedef struct {
     const float32_t *pSrcA; // pointer to the first vector
     const float32_t *pSrcB; // pointer to the second vector
-    uint32_t blkSizePE;     // number of samples in each vector
+    uint32_t blockSize;     // number of samples in each vector
     uint32_t nPE;           // number of processing units
     float32_t *pDst;        // pointer to result vector
 } plp_mult_instance_f32;
@@ -188,757 +188,1382 @@ typedef struct {
     @struct plp_log_instance_f32
     @brief Instance structure for float parallel log.
     @param[in]  pSrc      points to the input vector
-    @param[in]  blkSizePE  number of samples in each vector
+    @param[in]  blockSize  number of samples in each vector
     @param[in]  nPE        number of parallel processing units
     @param[out] pDst       pointer to the output vector
 */
 typedef struct {
     const float32_t *pSrc; // pointer to the vector
-    uint32_t blkSizePE;     // number of samples in each vector
+    uint32_t blockSize;     // number of samples in each vector
     uint32_t nPE;           // number of processing units
     float32_t *pDst;        // pointer to result vector
 } plp_log_instance_f32;
 
 /** -------------------------------------------------------
-    @brief Instance structure for basic integer convolution.
+    @struct plp_abs_instance_i32
+    @brief Instance structure for 32-bit integer parallel absolute value.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+    int32_t *pDst;       // pointer to the output vector
+} plp_abs_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_abs_instance_i16
+    @brief Instance structure for 16-bit integer parallel absolute value.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+    int16_t *pDst;       // pointer to the output vector
+} plp_abs_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_abs_instance_i8
+    @brief Instance structure for 8-bit integer parallel absolute value.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+    int8_t *pDst;       // pointer to the output vector
+} plp_abs_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_add_instance_i32
+    @brief Instance structure for 32-bit integer parallel addition.
     @param[in]  pSrcA      points to the first input vector
-    @param[in]  srcALen    length of the first input vector
     @param[in]  pSrcB      points to the second input vector
-    @param[in]  srcBLen    length of the second input vector
+    @param[in]  blockSize  number of samples in each vector
     @param[in]  nPE        number of parallel processing units
-    @param[out] pRes       output result returned here
+    @param[out] pDst       points to the output vector
 */
 typedef struct {
     const int32_t *pSrcA; // pointer to the first vector
-    uint32_t srcALen;
     const int32_t *pSrcB; // pointer to the second vector
-    uint32_t srcBLen;     // number of samples in each vector
-    uint8_t nPE;          // number of processing units
-    int32_t *pRes;        // pointer to result vector
-} plp_conv_instance_i32;
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+    int32_t *pDst;        // pointer to the output vector
+} plp_add_instance_i32;
 
 /** -------------------------------------------------------
-    @brief Instance structure for basic integer convolution.
+    @struct plp_add_instance_i16
+    @brief Instance structure for 16-bit integer parallel addition.
     @param[in]  pSrcA      points to the first input vector
-    @param[in]  srcALen    length of the first input vector
     @param[in]  pSrcB      points to the second input vector
-    @param[in]  srcBLen    length of the second input vector
+    @param[in]  blockSize  number of samples in each vector
     @param[in]  nPE        number of parallel processing units
-    @param[out] pRes       output result returned here
+    @param[out] pDst       points to the output vector
 */
 typedef struct {
     const int16_t *pSrcA; // pointer to the first vector
-    uint32_t srcALen;
     const int16_t *pSrcB; // pointer to the second vector
-    uint32_t srcBLen;     // number of samples in each vector
-    uint8_t nPE;          // number of processing units
-    int32_t *pRes;        // pointer to result vector
-} plp_conv_instance_i16;
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+    int32_t *pDst;        // pointer to the output vector
+} plp_add_instance_i16;
 
 /** -------------------------------------------------------
-    @brief Instance structure for basic integer convolution.
+    @struct plp_add_instance_i8
+    @brief Instance structure for 8-bit integer parallel addition.
     @param[in]  pSrcA      points to the first input vector
-    @param[in]  srcALen    length of the first input vector
     @param[in]  pSrcB      points to the second input vector
-    @param[in]  srcBLen    length of the second input vector
+    @param[in]  blockSize  number of samples in each vector
     @param[in]  nPE        number of parallel processing units
-    @param[out] pRes       output result returned here
+    @param[out] pDst       points to the output vector
 */
 typedef struct {
     const int8_t *pSrcA; // pointer to the first vector
-    uint32_t srcALen;
     const int8_t *pSrcB; // pointer to the second vector
-    uint32_t srcBLen;    // number of samples in each vector
-    uint8_t nPE;         // number of processing units
-    int32_t *pRes;       // pointer to result vector
-} plp_conv_instance_i8;
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+    int32_t *pDst;       // pointer to the output vector
+} plp_add_instance_i8;
 
 /** -------------------------------------------------------
-    @brief Instance structure for basic integer convolution.
-    @param[in]  addOffset
-    @param[in]  addLengthfirst
-    @param[in]  addLengthsecond
-    @param[in]  numVectors
-    @param[in]  blockOffset
-    @param[out] pRes       output result returned here
-    @param[in]  coresPerVector
+    @struct plp_mult_instance_i32
+    @brief Instance structure for 32-bit integer parallel multiplication.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
 */
 typedef struct {
-    uint32_t addOffset;
-    uint32_t addLengthfirst;
-    uint32_t addLengthsecond;
-    uint32_t numVectors;
-    uint32_t blockOffset;
-    int32_t *pRes;
-    uint8_t coresPerVector;
-} plp_conv_tree_add_instance;
+    const int32_t *pSrcA; // pointer to the first vector
+    const int32_t *pSrcB; // pointer to the second vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+    int32_t *pDst;        // pointer to the output vector
+} plp_mult_instance_i32;
 
-/**
- * @brief Instance structure for the fixed-point CFFT/CIFFT function.
- * @param[in]   fftLen              length of the FFT
- * @param[in]   pTwiddle            points to the Twiddle factor table
- * @param[in]   pBitRevTable        points to the bit reversal table
- * @param[in]   bitRevTableLength   bit reversal table length
- */
+/** -------------------------------------------------------
+    @struct plp_mult_instance_i16
+    @brief Instance structure for 16-bit integer parallel multiplication.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    uint16_t fftLen;             /*< length of the FFT. */
-    const int16_t *pTwiddle;     /*< points to the Twiddle factor table. */
-    const int16_t *pBitRevTable; /*< points to the bit reversal table. */
-    uint16_t bitRevLength;       /*< bit reversal table length. */
-} plp_cfft_instance_q16;
+    const int16_t *pSrcA; // pointer to the first vector
+    const int16_t *pSrcB; // pointer to the second vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+    int32_t *pDst;        // pointer to the output vector
+} plp_mult_instance_i16;
 
-/**
- * @brief Instance structure for the parallel CFFT Q16
- * @param[in]       fft_struct          cfft_q16 struct
- * @param[in/out]   p1                  points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]       ifftFlag            flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]       bitReverseFlag      flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]       deciPoint           decimal point for right shift
- * @param[in]       nPE                 number of cores to use
- */
+/** -------------------------------------------------------
+    @struct plp_mult_instance_i8
+    @brief Instance structure for 8-bit integer parallel multiplication.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    plp_cfft_instance_q16 *S;
-    int16_t *p1;
-    uint8_t ifftFlag;
-    uint8_t bitReverseFlag;
-    uint32_t deciPoint;
-    uint32_t nPE;
-} plp_cfft_instance_q16_parallel;
+    const int8_t *pSrcA; // pointer to the first vector
+    const int8_t *pSrcB; // pointer to the second vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+    int32_t *pDst;       // pointer to the output vector
+} plp_mult_instance_i8;
 
-/**
- * @brief Instance structure for the fixed-point CFFT/CIFFT function.
- * @param[in]   fftLen              length of the FFT
- * @param[in]   pTwiddle            points to the Twiddle factor table
- * @param[in]   pBitRevTable        points to the bit reversal table
- * @param[in]   bitRevTableLength   bit reversal table length
- */
+/** -------------------------------------------------------
+    @struct plp_negate_instance_f32
+    @brief Instance structure for 32-bit float parallel negation.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    uint16_t fftLen;             /*< length of the FFT. */
-    const int32_t *pTwiddle;     /*< points to the Twiddle factor table. */
-    const int16_t *pBitRevTable; /*< points to the bit reversal table. */
-    uint16_t bitRevLength;       /*< bit reversal table length. */
-} plp_cfft_instance_q32;
+    const float32_t *pSrc; // pointer to the vector
+    uint32_t blockSize;    // number of samples in each vector
+    uint32_t nPE;          // number of processing units
+    float32_t *pDst;       // pointer to the output vector
+} plp_negate_instance_f32;
 
 /** -------------------------------------------------------
-    @struct plp_fft_instance_f32
-    @brief Instance structure for floating-point FFT
-    @param[in]  length data length of the FFT
-    @param[in]  bitReverseFlag  flag that enables (bitReverseFlagR=1) or disables
-    (bitReverseFlagR=0) bit reversal of output
-    @param[in]  pTwiddleFactors pointer to the twiddle factors.
-    These values must be computed using this formula:
-    \f$W_N^k =   e^{-j \frac{\pi}{N} k}\f$,
-    where \f$N\f$ is the data length and \f$k\f$ is the index.
-    The user must provide \f$\frac{N}{2}\f$ values (\f$k = 0 .. \frac{N}{2}-1\f$).
-    @param[in]  pBitReverseLUT  pointer to the lookup table used for the bit reversal of output.
-    This table must include \f$N\f$ elements in the range \f$0 .. N-1\f$,
-    where each location \f$k\f$ contains the value \f$bitreverse(k)\f$.
+    @struct plp_negate_instance_i32
+    @brief Instance structure for 32-bit integer parallel negation.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
 */
 typedef struct {
-    uint32_t FFTLength;
-    uint8_t bitReverseFlag;
-    const float32_t *pTwiddleFactors;
-    const uint16_t *pBitReverseLUT;
-} plp_fft_instance_f32;
+    const int32_t *pSrc; // pointer to the vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+    int32_t *pDst;       // pointer to the output vector
+} plp_negate_instance_i32;
 
 /** -------------------------------------------------------
-    @struct plp_fft_instance_f32_parallel
-    @brief Instance structure for floating-point FFT (parallel version)
-    @param[in]  S         pointer to a plp_fft_instance_f32 data structure (FFT parameters)
-    @param[in]  pSrc      pointer to the input data buffer
-    @param[in]  nPE       number of cores
-    @param[out] pDst      pointer to the output data buffer
+    @struct plp_negate_instance_i16
+    @brief Instance structure for 16-bit integer parallel negation.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
 */
 typedef struct {
-    plp_fft_instance_f32 *S;
-    const float32_t *pSrc;
-    const uint32_t nPE;
-    float32_t *pDst;
-} plp_fft_instance_f32_parallel;
+    const int16_t *pSrc; // pointer to the vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+    int16_t *pDst;       // pointer to the output vector
+} plp_negate_instance_i16;
 
 /** -------------------------------------------------------
-    @struct plp_triangular_filter_f32
-    @brief structure containing non-zero values of triangular filterbanks
-    @param  V               pointer to an array containing all non-zero filter
-    			    coefficients of the triangular filters
-    @param  firstValue      pointer to array containing indexes of the
-    			    first non-zero coefficients of the filters
-    @param  filterLength    pointer to array containing lengths of the
-    			    non-zero region of each filter
-    @param  nFilters        total amount of triangular filters (n_mels)
+    @struct plp_negate_instance_i8
+    @brief Instance structure for 8-bit integer parallel negation.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
 */
 typedef struct {
-    const float32_t *V;
-    const uint16_t *firstValue;
-    const uint16_t *filterLength;
-    const uint8_t nFilters;
-} plp_triangular_filter_f32;
+    const int8_t *pSrc; // pointer to the vector
+    uint32_t blockSize; // number of samples in each vector
+    uint32_t nPE;       // number of processing units
+    int8_t *pDst;       // pointer to the output vector
+} plp_negate_instance_i8;
 
 /** -------------------------------------------------------
-    @struct Complex_type_f32
-    @brief Helper type to represent complex values with float32 components.
-    @param  re  Real part
-    @param  im  Imaginary part
+    @struct plp_offset_instance_f32
+    @brief Instance structure for 32-bit float parallel offset.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  offset     value added to all elements
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
 */
 typedef struct {
-    float32_t re;
-    float32_t im;
-} Complex_type_f32;
+    const float32_t *pSrc; // pointer to the vector
+    uint32_t blockSize;    // number of samples in each vector
+    float32_t offset;      // value added to all elements
+    uint32_t nPE;          // number of processing units
+    float32_t *pDst;       // pointer to the output vector
+} plp_offset_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix multiplication.
- */
+    @struct plp_offset_instance_i32
+    @brief Instance structure for 32-bit integer parallel offset.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  offset     value added to all elements
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_i8;
+    const int32_t *pSrc; // pointer to the vector
+    uint32_t blockSize;  // number of samples in each vector
+    int32_t offset;      // value added to all elements
+    uint32_t nPE;        // number of processing units
+    int32_t *pDst;       // pointer to the output vector
+} plp_offset_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix multiplication.
- */
+    @struct plp_offset_instance_i16
+    @brief Instance structure for 16-bit integer parallel offset.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  offset     value added to all elements
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_i16;
+    const int16_t *pSrc; // pointer to the vector
+    uint32_t blockSize;  // number of samples in each vector
+    int16_t offset;      // value added to all elements
+    uint32_t nPE;        // number of processing units
+    int16_t *pDst;       // pointer to the output vector
+} plp_offset_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix multiplication.
- */
+    @struct plp_offset_instance_i8
+    @brief Instance structure for 8-bit integer parallel offset.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  offset     value added to all elements
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_i32;
+    const int8_t *pSrc; // pointer to the vector
+    uint32_t blockSize; // number of samples in each vector
+    int8_t offset;      // value added to all elements
+    uint32_t nPE;       // number of processing units
+    int8_t *pDst;       // pointer to the output vector
+} plp_offset_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix multiplication.
- */
+    @struct plp_sub_instance_f32
+    @brief Instance structure for 32-bit float parallel subtraction.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    float *__restrict__ pDstC;
-} plp_mat_mult_instance_f32;
+    const float32_t *pSrcA; // pointer to the first vector
+    const float32_t *pSrcB; // pointer to the second vector
+    uint32_t blockSize;     // number of samples in each vector
+    uint32_t nPE;           // number of processing units
+    float32_t *pDst;        // pointer to the output vector
+} plp_sub_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel matrix multiplication.
- */
+    @struct plp_sub_instance_i32
+    @brief Instance structure for 32-bit integer parallel subtraction.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
-    uint32_t nPE;
-    int8_t *__restrict__ pDstC;
-} plp_mat_mult_instance_q8;
+    const int32_t *pSrcA; // pointer to the first vector
+    const int32_t *pSrcB; // pointer to the second vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+    int32_t *pDst;        // pointer to the output vector
+} plp_sub_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel matrix multiplication.
- */
+    @struct plp_sub_instance_i16
+    @brief Instance structure for 16-bit integer parallel subtraction.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
-    uint32_t nPE;
-    int16_t *__restrict__ pDstC;
-} plp_mat_mult_instance_q16;
+    const int16_t *pSrcA; // pointer to the first vector
+    const int16_t *pSrcB; // pointer to the second vector
+    uint32_t blockSize;   // number of samples in each vector
+    uint32_t nPE;         // number of processing units
+    int32_t *pDst;        // pointer to the output vector
+} plp_sub_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel matrix multiplication.
- */
+    @struct plp_sub_instance_i8
+    @brief Instance structure for 8-bit integer parallel subtraction.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_q32;
+    const int8_t *pSrcA; // pointer to the first vector
+    const int8_t *pSrcB; // pointer to the second vector
+    uint32_t blockSize;  // number of samples in each vector
+    uint32_t nPE;        // number of processing units
+    int32_t *pDst;       // pointer to the output vector
+} plp_sub_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
- */
+    @struct plp_scale_instance_f32
+    @brief Instance structure for 32-bit float parallel scaling.
+    @param[in]  pSrc         points to the input vector
+    @param[in]  blockSize    number of samples in each vector
+    @param[in]  scaleFactor  factor to multiply all elements with
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output vector
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i8;
+    const float32_t *pSrc; // pointer to the vector
+    uint32_t blockSize;    // number of samples in each vector
+    float32_t scaleFactor; // factor to multiply all elements with
+    uint32_t nPE;          // number of processing units
+    float32_t *pDst;       // pointer to the output vector
+} plp_scale_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_scale_instance_i32
+    @brief Instance structure for 32-bit integer parallel scaling.
+    @param[in]  pSrc         points to the input vector
+    @param[in]  blockSize    number of samples in each vector
+    @param[in]  scaleFactor  factor to multiply all elements with
+    @param[in]  shift        number of bits to shift the result by
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output vector
+*/
+typedef struct {
+    const int32_t *pSrc; // pointer to the vector
+    uint32_t blockSize;  // number of samples in each vector
+    int32_t scaleFactor; // factor to multiply all elements with
+    int32_t shift;       // number of bits to shift the result by
+    uint32_t nPE;        // number of processing units
+    int32_t *pDst;       // pointer to the output vector
+} plp_scale_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_scale_instance_i16
+    @brief Instance structure for 16-bit integer parallel scaling.
+    @param[in]  pSrc         points to the input vector
+    @param[in]  blockSize    number of samples in each vector
+    @param[in]  scaleFactor  factor to multiply all elements with
+    @param[in]  shift        number of bits to shift the result by
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output vector
+*/
+typedef struct {
+    const int16_t *pSrc; // pointer to the vector
+    uint32_t blockSize;  // number of samples in each vector
+    int16_t scaleFactor; // factor to multiply all elements with
+    int32_t shift;       // number of bits to shift the result by
+    uint32_t nPE;        // number of processing units
+    int16_t *pDst;       // pointer to the output vector
+} plp_scale_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_scale_instance_i8
+    @brief Instance structure for 8-bit integer parallel scaling.
+    @param[in]  pSrc         points to the input vector
+    @param[in]  blockSize    number of samples in each vector
+    @param[in]  scaleFactor  factor to multiply all elements with
+    @param[in]  shift        number of bits to shift the result by
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output vector
+*/
+typedef struct {
+    const int8_t *pSrc; // pointer to the vector
+    uint32_t blockSize; // number of samples in each vector
+    int8_t scaleFactor; // factor to multiply all elements with
+    int32_t shift;      // number of bits to shift the result by
+    uint32_t nPE;       // number of processing units
+    int8_t *pDst;       // pointer to the output vector
+} plp_scale_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
- */
+    @struct plp_vfast_math_instance_q16
+    @brief Instance structure for the parallel 16-bit fixed point vector fast math functions
+    (plp_vsin, plp_vcos, plp_vsqrt, plp_vlog, plp_vexp).
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits (not used by sine and cosine)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
+    const int16_t *pSrc;
+    uint32_t blockSize;
+    uint32_t fracBits;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i16;
+    int16_t *pDst;
+} plp_vfast_math_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
- */
+    @struct plp_vfast_math_instance_q32
+    @brief Instance structure for the parallel 32-bit fixed point vector fast math functions
+    (plp_vsin, plp_vcos, plp_vsqrt, plp_vlog, plp_vexp).
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits (not used by sine and cosine)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
+    const int32_t *pSrc;
+    uint32_t blockSize;
+    uint32_t fracBits;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i32;
+    int32_t *pDst;
+} plp_vfast_math_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel complex matrix matrix multiplication.
- */
+    @struct plp_vfast_math_instance_f32
+    @brief Instance structure for the parallel 32-bit floating point vector fast math functions
+    (plp_vsin, plp_vcos, plp_vsqrt, plp_vlog, plp_vexp).
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
+    const float32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    float *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_f32;
+    float32_t *pDst;
+} plp_vfast_math_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel complex matrix matrix multiplication.
- */
+    @struct plp_cmplx_mag_instance_q8
+    @brief Instance structure for the parallel 8-bit fixed point complex magnitude.
+    @param[in]  pSrc        points to the interleaved complex input vector
+    @param[in]  fracBits    number of fractional bits of input and output
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pRes        points to the output vector
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
+    const int8_t *pSrc;
+    uint32_t fracBits;
+    uint32_t numSamples;
     uint32_t nPE;
-    int8_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_q8;
+    int8_t *pRes;
+} plp_cmplx_mag_instance_q8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel complex matrix matrix multiplication.
- */
+    @struct plp_cmplx_mag_instance_q16
+    @brief Instance structure for the parallel 16-bit fixed point complex magnitude.
+    @param[in]  pSrc        points to the interleaved complex input vector
+    @param[in]  fracBits    number of fractional bits of input and output
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pRes        points to the output vector
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
+    const int16_t *pSrc;
+    uint32_t fracBits;
+    uint32_t numSamples;
     uint32_t nPE;
-    int16_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_q16;
+    int16_t *pRes;
+} plp_cmplx_mag_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel complex matrix matrix multiplication.
- */
+    @struct plp_cmplx_mag_instance_q32
+    @brief Instance structure for the parallel 32-bit fixed point complex magnitude.
+    @param[in]  pSrc        points to the interleaved complex input vector
+    @param[in]  fracBits    number of fractional bits of input and output
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pRes        points to the output vector
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
+    const int32_t *pSrc;
+    uint32_t fracBits;
+    uint32_t numSamples;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_q32;
+    int32_t *pRes;
+} plp_cmplx_mag_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix addition.
- */
+    @struct plp_cmplx_mag_instance_f32
+    @brief Instance structure for the parallel 32-bit floating point complex magnitude.
+    @param[in]  pSrc        points to the interleaved complex input vector
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pRes        points to the output vector
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const float32_t *pSrc;
+    uint32_t numSamples;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_add_instance_i8;
+    float32_t *pRes;
+} plp_cmplx_mag_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_instance_i8
+    @brief Instance structure for the parallel complex math functions on 8-bit integer and
+    fixed-point vectors (plp_cmplx_conj, plp_cmplx_dot_prod, plp_cmplx_mult_real,
+    plp_cmplx_mult_cmplx, plp_cmplx_mag_squared).
+    @param[in]  pSrcA       points to the (first) complex input vector
+    @param[in]  pSrcB       points to the second input vector, complex or real, NULL if unused
+    @param[in]  numSamples  number of complex samples
+    @param[in]  deciPoint   decimal point for right shift, 0 for the integer variants
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pDst        points to the output vector, for the dot product to 2 * nPE partial
+                            results of which the first two hold the result
+*/
+typedef struct {
+    const int8_t *pSrcA;
+    const int8_t *pSrcB;
+    uint32_t numSamples;
+    uint32_t deciPoint;
+    uint32_t nPE;
+    int8_t *pDst;
+} plp_cmplx_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_instance_i16
+    @brief Instance structure for the parallel complex math functions on 16-bit integer and
+    fixed-point vectors (plp_cmplx_conj, plp_cmplx_dot_prod, plp_cmplx_mult_real,
+    plp_cmplx_mult_cmplx, plp_cmplx_mag_squared).
+    @param[in]  pSrcA       points to the (first) complex input vector
+    @param[in]  pSrcB       points to the second input vector, complex or real, NULL if unused
+    @param[in]  numSamples  number of complex samples
+    @param[in]  deciPoint   decimal point for right shift, 0 for the integer variants
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pDst        points to the output vector, for the dot product to 2 * nPE partial
+                            results of which the first two hold the result
+*/
+typedef struct {
+    const int16_t *pSrcA;
+    const int16_t *pSrcB;
+    uint32_t numSamples;
+    uint32_t deciPoint;
+    uint32_t nPE;
+    int16_t *pDst;
+} plp_cmplx_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_cmplx_instance_i32
+    @brief Instance structure for the parallel complex math functions on 32-bit integer and
+    fixed-point vectors (plp_cmplx_conj, plp_cmplx_dot_prod, plp_cmplx_mult_real,
+    plp_cmplx_mult_cmplx, plp_cmplx_mag_squared).
+    @param[in]  pSrcA       points to the (first) complex input vector
+    @param[in]  pSrcB       points to the second input vector, complex or real, NULL if unused
+    @param[in]  numSamples  number of complex samples
+    @param[in]  deciPoint   decimal point for right shift, 0 for the integer variants
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pDst        points to the output vector, for the dot product to 2 * nPE partial
+                            results of which the first two hold the result
+*/
+typedef struct {
+    const int32_t *pSrcA;
+    const int32_t *pSrcB;
+    uint32_t numSamples;
+    uint32_t deciPoint;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_cmplx_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix addition.
- */
+    @struct plp_cmplx_instance_f32
+    @brief Instance structure for the parallel complex math functions on 32-bit float vectors
+    (plp_cmplx_conj, plp_cmplx_dot_prod, plp_cmplx_mult_real, plp_cmplx_mult_cmplx,
+    plp_cmplx_mag_squared).
+    @param[in]  pSrcA       points to the (first) complex input vector
+    @param[in]  pSrcB       points to the second input vector, complex or real, NULL if unused
+    @param[in]  numSamples  number of complex samples
+    @param[in]  nPE         number of parallel processing units
+    @param[out] pDst        points to the output vector, for the dot product to 2 * nPE partial
+                            results of which the first two hold the result
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const float32_t *pSrcA;
+    const float32_t *pSrcB;
+    uint32_t numSamples;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_add_instance_i16;
+    float32_t *pDst;
+} plp_cmplx_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix addition.
- */
+    @struct plp_stats_result
+    @brief Result of the fused integer statistics (plp_stats_i8, plp_stats_i16, plp_stats_q16).
+    @param  mean  mean of the samples
+    @param  var   population variance of the samples
+    @param  std   standard deviation of the samples
+    @param  rms   root mean square of the samples
+    @param  min   minimum of the samples
+    @param  max   maximum of the samples
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_add_instance_i32;
+    int32_t mean;
+    int32_t var;
+    int32_t std;
+    int32_t rms;
+    int32_t min;
+    int32_t max;
+} plp_stats_result;
+
+/** -------------------------------------------------------
+    @struct plp_stats_result_f32
+    @brief Result of the fused floating point statistics (plp_stats_f32).
+    @param  mean  mean of the samples
+    @param  var   population variance of the samples
+    @param  std   standard deviation of the samples
+    @param  rms   root mean square of the samples
+    @param  min   minimum of the samples
+    @param  max   maximum of the samples
+*/
+typedef struct {
+    float32_t mean;
+    float32_t var;
+    float32_t std;
+    float32_t rms;
+    float32_t min;
+    float32_t max;
+} plp_stats_result_f32;
+
+/** flags selecting the quantities reduced by the parallel statistics kernels */
+#define PLP_STATS_SUM 0x1U   // sum (integer) or mean (float)
+#define PLP_STATS_POWER 0x2U // sum of squares
+#define PLP_STATS_MIN 0x4U   // minimum
+#define PLP_STATS_MAX 0x8U   // maximum
+#define PLP_STATS_M2 0x10U   // mean and sum of squared deviations (float only)
+
+/** -------------------------------------------------------
+    @struct plp_stats_partial_i32
+    @brief Partial result of the parallel integer statistics, one per core.
+    @param  count  number of samples reduced, 0 if the core got no samples
+    @param  sum    sum of the samples
+    @param  power  sum of the squared samples, shifted by fracBits
+    @param  min    minimum of the samples
+    @param  max    maximum of the samples
+*/
+typedef struct {
+    uint32_t count;
+    int32_t sum;
+    int32_t power;
+    int32_t min;
+    int32_t max;
+} plp_stats_partial_i32;
+
+/** -------------------------------------------------------
+    @struct plp_stats_partial_f32
+    @brief Partial result of the parallel floating point statistics, one per core.
+    @param  count  number of samples reduced, 0 if the core got no samples
+    @param  mean   mean of the samples
+    @param  m2     sum of the squared deviations from the mean
+    @param  power  sum of the squared samples
+    @param  min    minimum of the samples
+    @param  max    maximum of the samples
+*/
+typedef struct {
+    uint32_t count;
+    float32_t mean;
+    float32_t m2;
+    float32_t power;
+    float32_t min;
+    float32_t max;
+} plp_stats_partial_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix addition.
- */
+    @struct plp_stats_instance_i32_parallel
+    @brief Instance structure for the parallel statistics of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits the squares are shifted by
+    @param[in]  nPE        number of parallel processing units
+    @param[in]  flags      PLP_STATS_* flags of the quantities to reduce
+    @param[out] pPartial   per-core partial results (nPE entries), pPartial[0] holds the result
+*/
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const int32_t *pSrc;
+    uint32_t blockSize;
+    uint32_t fracBits;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_add_instance_f32;
+    uint32_t flags;
+    plp_stats_partial_i32 *pPartial;
+} plp_stats_instance_i32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix subtraction.
- */
+    @struct plp_stats_instance_i16_parallel
+    @brief Instance structure for the parallel statistics of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits the squares are shifted by
+    @param[in]  nPE        number of parallel processing units
+    @param[in]  flags      PLP_STATS_* flags of the quantities to reduce
+    @param[out] pPartial   per-core partial results (nPE entries), pPartial[0] holds the result
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const int16_t *pSrc;
+    uint32_t blockSize;
+    uint32_t fracBits;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_sub_instance_i8;
+    uint32_t flags;
+    plp_stats_partial_i32 *pPartial;
+} plp_stats_instance_i16_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix subtraction.
- */
+    @struct plp_stats_instance_i8_parallel
+    @brief Instance structure for the parallel statistics of an 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits the squares are shifted by
+    @param[in]  nPE        number of parallel processing units
+    @param[in]  flags      PLP_STATS_* flags of the quantities to reduce
+    @param[out] pPartial   per-core partial results (nPE entries), pPartial[0] holds the result
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const int8_t *pSrc;
+    uint32_t blockSize;
+    uint32_t fracBits;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_sub_instance_i16;
+    uint32_t flags;
+    plp_stats_partial_i32 *pPartial;
+} plp_stats_instance_i8_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix subtraction.
- */
+    @struct plp_stats_instance_f32_parallel
+    @brief Instance structure for the parallel statistics of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[in]  flags      PLP_STATS_* flags of the quantities to reduce
+    @param[out] pPartial   per-core partial results (nPE entries), pPartial[0] holds the result
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const float32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_sub_instance_i32;
+    uint32_t flags;
+    plp_stats_partial_f32 *pPartial;
+} plp_stats_instance_f32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix subtraction.
- */
+    @struct plp_arg_partial_i32
+    @brief Partial result of the parallel integer arg-max / arg-min, one per core.
+    @param  count  number of samples searched, 0 if the core got no samples
+    @param  value  extreme value
+    @param  index  index of its first occurrence in the whole vector
+*/
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_sub_instance_f32;
+    uint32_t count;
+    int32_t value;
+    uint32_t index;
+} plp_arg_partial_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix scale.
- */
+    @struct plp_arg_partial_f32
+    @brief Partial result of the parallel floating point arg-max / arg-min, one per core.
+    @param  count  number of samples searched, 0 if the core got no samples
+    @param  value  extreme value
+    @param  index  index of its first occurrence in the whole vector
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    int8_t scaleFactor;
-    int32_t shift;
-    uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_scale_instance_i8;
+    uint32_t count;
+    float32_t value;
+    uint32_t index;
+} plp_arg_partial_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix scale.
- */
+    @struct plp_arg_instance_i32_parallel
+    @brief Instance structure for the parallel arg-max / arg-min of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pPartial   per-core partial results (nPE entries), pPartial[0] holds the result
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    int16_t scaleFactor;
-    int32_t shift;
+    const int32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_scale_instance_i16;
+    plp_arg_partial_i32 *pPartial;
+} plp_arg_instance_i32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix scale.
- */
+    @struct plp_arg_instance_i16_parallel
+    @brief Instance structure for the parallel arg-max / arg-min of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pPartial   per-core partial results (nPE entries), pPartial[0] holds the result
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    int32_t scaleFactor;
-    int32_t shift;
+    const int16_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_scale_instance_i32;
+    plp_arg_partial_i32 *pPartial;
+} plp_arg_instance_i16_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix scale.
- */
+    @struct plp_arg_instance_i8_parallel
+    @brief Instance structure for the parallel arg-max / arg-min of an 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pPartial   per-core partial results (nPE entries), pPartial[0] holds the result
+*/
 typedef struct {
-    const float *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    float scaleFactor;
+    const int8_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_scale_instance_f32;
+    plp_arg_partial_i32 *pPartial;
+} plp_arg_instance_i8_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix transpose.
- */
+    @struct plp_arg_instance_f32_parallel
+    @brief Instance structure for the parallel arg-max / arg-min of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pPartial   per-core partial results (nPE entries), pPartial[0] holds the result
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
+    const float32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_trans_instance_i8;
+    plp_arg_partial_f32 *pPartial;
+} plp_arg_instance_f32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix transpose.
- */
+    @brief Instance structure for basic integer convolution.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_trans_instance_i16;
+    const int32_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int32_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;     // number of samples in each vector
+    uint8_t nPE;          // number of processing units
+    int32_t *pRes;        // pointer to result vector
+} plp_conv_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix transpose.
- */
+    @brief Instance structure for basic integer convolution.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_trans_instance_i32;
+    const int16_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int16_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;     // number of samples in each vector
+    uint8_t nPE;          // number of processing units
+    int32_t *pRes;        // pointer to result vector
+} plp_conv_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel identity matrix creation.
- */
+    @brief Instance structure for basic integer convolution.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
 typedef struct {
-    uint32_t N;
-    uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_i8;
+    const int8_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int8_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;    // number of samples in each vector
+    uint8_t nPE;         // number of processing units
+    int32_t *pRes;       // pointer to result vector
+} plp_conv_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel identity matrix creation.
- */
+    @brief Instance structure for basic integer convolution.
+    @param[in]  addOffset
+    @param[in]  addLengthfirst
+    @param[in]  addLengthsecond
+    @param[in]  numVectors
+    @param[in]  blockOffset
+    @param[out] pRes       output result returned here
+    @param[in]  coresPerVector
+*/
 typedef struct {
-    uint32_t N;
-    uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_i16;
+    uint32_t addOffset;
+    uint32_t addLengthfirst;
+    uint32_t addLengthsecond;
+    uint32_t numVectors;
+    uint32_t blockOffset;
+    int32_t *pRes;
+    uint8_t coresPerVector;
+} plp_conv_tree_add_instance;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel identity matrix creation.
- */
+    @struct plp_fir_instance_i8
+    @brief Instance structure for the 8-bit integer FIR filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize
+    @param[in]  blockSize  number of samples processed per call
+*/
 typedef struct {
-    uint32_t N;
-    uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_i32;
+    uint32_t numTaps;      // number of filter coefficients
+    const int8_t *pCoeffs; // coefficients in time reversed order
+    int8_t *pState;        // delay line followed by the current block
+    uint32_t blockSize;    // number of samples processed per call
+} plp_fir_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel identity matrix creation.
- */
+    @struct plp_fir_instance_i8_parallel
+    @brief Instance structure for the 8-bit integer parallel FIR filter.
+    @param[in]  S     points to the 8-bit integer FIR instance
+    @param[in]  pSrc  points to the input block
+    @param[in]  nPE   number of parallel processing units
+    @param[out] pDst  points to the output block
+*/
 typedef struct {
-    uint32_t N;
+    const plp_fir_instance_i8 *S;
+    const int8_t *pSrc;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_fill_I_instance_f32;
+    int32_t *pDst;
+} plp_fir_instance_i8_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for fix-point parallel identity matrix creation.
- */
+    @struct plp_fir_instance_i16
+    @brief Instance structure for the 16-bit integer FIR filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize
+    @param[in]  blockSize  number of samples processed per call
+*/
 typedef struct {
-    uint32_t N;
-    int32_t fracBits;
-    uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_q8;
+    uint32_t numTaps;       // number of filter coefficients
+    const int16_t *pCoeffs; // coefficients in time reversed order
+    int16_t *pState;        // delay line followed by the current block
+    uint32_t blockSize;     // number of samples processed per call
+} plp_fir_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for fix-point parallel identity matrix creation.
- */
+    @struct plp_fir_instance_i16_parallel
+    @brief Instance structure for the 16-bit integer parallel FIR filter.
+    @param[in]  S     points to the 16-bit integer FIR instance
+    @param[in]  pSrc  points to the input block
+    @param[in]  nPE   number of parallel processing units
+    @param[out] pDst  points to the output block
+*/
 typedef struct {
-    uint32_t N;
-    uint32_t fracBits;
+    const plp_fir_instance_i16 *S;
+    const int16_t *pSrc;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_q16;
+    int32_t *pDst;
+} plp_fir_instance_i16_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for fix-point parallel identity matrix creation.
- */
+    @struct plp_fir_instance_q16
+    @brief Instance structure for the 16-bit fixed point FIR filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize
+    @param[in]  blockSize  number of samples processed per call
+    @param[in]  deciPoint  decimal point for right shift of the result
+*/
 typedef struct {
-    uint32_t N;
-    uint32_t fracBits;
-    uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_q32;
+    uint32_t numTaps;       // number of filter coefficients
+    const int16_t *pCoeffs; // coefficients in time reversed order
+    int16_t *pState;        // delay line followed by the current block
+    uint32_t blockSize;     // number of samples processed per call
+    uint32_t deciPoint;     // decimal point for right shift
+} plp_fir_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix multiplication.
- */
+    @struct plp_fir_instance_q16_parallel
+    @brief Instance structure for the 16-bit fixed point parallel FIR filter.
+    @param[in]  S     points to the 16-bit fixed point FIR instance
+    @param[in]  pSrc  points to the input block
+    @param[in]  nPE   number of parallel processing units
+    @param[out] pDst  points to the output block
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
+    const plp_fir_instance_q16 *S;
+    const int16_t *pSrc;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_i8;
+    int16_t *pDst;
+} plp_fir_instance_q16_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix multiplication.
- */
+    @struct plp_fir_instance_q32
+    @brief Instance structure for the 32-bit fixed point FIR filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize
+    @param[in]  blockSize  number of samples processed per call
+    @param[in]  deciPoint  decimal point for right shift of the result
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_i16;
+    uint32_t numTaps;       // number of filter coefficients
+    const int32_t *pCoeffs; // coefficients in time reversed order
+    int32_t *pState;        // delay line followed by the current block
+    uint32_t blockSize;     // number of samples processed per call
+    uint32_t deciPoint;     // decimal point for right shift
+} plp_fir_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix multiplication.
- */
+    @struct plp_fir_instance_q32_parallel
+    @brief Instance structure for the 32-bit fixed point parallel FIR filter.
+    @param[in]  S     points to the 32-bit fixed point FIR instance
+    @param[in]  pSrc  points to the input block
+    @param[in]  nPE   number of parallel processing units
+    @param[out] pDst  points to the output block
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
+    const plp_fir_instance_q32 *S;
+    const int32_t *pSrc;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_i32;
+    int32_t *pDst;
+} plp_fir_instance_q32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix multiplication.
- */
+    @struct plp_fir_instance_f32
+    @brief Instance structure for the 32-bit float FIR filter.
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize
+    @param[in]  blockSize  number of samples processed per call
+*/
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
+    uint32_t numTaps;         // number of filter coefficients
+    const float32_t *pCoeffs; // coefficients in time reversed order
+    float32_t *pState;        // delay line followed by the current block
+    uint32_t blockSize;       // number of samples processed per call
+} plp_fir_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_fir_instance_f32_parallel
+    @brief Instance structure for the 32-bit float parallel FIR filter.
+    @param[in]  S     points to the 32-bit float FIR instance
+    @param[in]  pSrc  points to the input block
+    @param[in]  nPE   number of parallel processing units
+    @param[out] pDst  points to the output block
+*/
+typedef struct {
+    const plp_fir_instance_f32 *S;
+    const float32_t *pSrc;
     uint32_t nPE;
-    float *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_f32;
+    float32_t *pDst;
+} plp_fir_instance_f32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided 8-bit fix-point parallel matrix multiplication.
- */
+    @struct plp_biquad_df1_instance_q16
+    @brief Instance structure for the 16-bit fixed point Direct Form I biquad cascade.
+    @param[in]  numStages  number of second order stages
+    @param[in]  pCoeffs    points to the coefficients, 6 per stage: {b0, 0, b1, b2, a1, a2}
+    @param[in]  pState     points to the state, 4 values per stage: {x[n-1], x[n-2], y[n-1], y[n-2]}
+    @param[in]  deciPoint  number of fractional bits of the coefficients
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
-    uint32_t shift;
+    uint32_t numStages;
+    const int16_t *pCoeffs;
+    int16_t *pState;
+    uint32_t deciPoint;
+} plp_biquad_df1_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_biquad_df1_instance_q16_parallel
+    @brief Instance structure for the multi-channel biquad cascade (Direct Form I, 16-bit fixed point).
+    @param[in]  S          points to the array of per channel instances
+    @param[in]  nChannels  number of channels
+    @param[in]  pSrc       points to the input samples of all channels
+    @param[out] pDst       points to the output samples of all channels
+    @param[in]  blockSize  number of samples per channel
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const plp_biquad_df1_instance_q16 *S;
+    uint32_t nChannels;
+    const int16_t *pSrc;
+    int16_t *pDst;
+    uint32_t blockSize;
     uint32_t nPE;
-    int8_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_q8;
+} plp_biquad_df1_instance_q16_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided 16-bit fix-point parallel matrix multiplication.
- */
+    @struct plp_biquad_df1_instance_q32
+    @brief Instance structure for the 32-bit fixed point Direct Form I biquad cascade.
+    @param[in]  numStages  number of second order stages
+    @param[in]  pCoeffs    points to the coefficients, 5 per stage: {b0, b1, b2, a1, a2}
+    @param[in]  pState     points to the state, 4 values per stage: {x[n-1], x[n-2], y[n-1], y[n-2]}
+    @param[in]  deciPoint  number of fractional bits of the coefficients
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
-    uint32_t shift;
+    uint32_t numStages;
+    const int32_t *pCoeffs;
+    int32_t *pState;
+    uint32_t deciPoint;
+} plp_biquad_df1_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_biquad_df1_instance_q32_parallel
+    @brief Instance structure for the multi-channel biquad cascade (Direct Form I, 32-bit fixed point).
+    @param[in]  S          points to the array of per channel instances
+    @param[in]  nChannels  number of channels
+    @param[in]  pSrc       points to the input samples of all channels
+    @param[out] pDst       points to the output samples of all channels
+    @param[in]  blockSize  number of samples per channel
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const plp_biquad_df1_instance_q32 *S;
+    uint32_t nChannels;
+    const int32_t *pSrc;
+    int32_t *pDst;
+    uint32_t blockSize;
     uint32_t nPE;
-    int16_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_q16;
+} plp_biquad_df1_instance_q32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided 32-bit fix-point parallel matrix multiplication.
+    @struct plp_biquad_df2T_instance_f32
+    @brief Instance structure for the 32-bit float Transposed Direct Form II biquad cascade.
+    @param[in]  numStages  number of second order stages
+    @param[in]  pCoeffs    points to the coefficients, 5 per stage: {b0, b1, b2, a1, a2}
+    @param[in]  pState     points to the state, 2 values per stage: {d1, d2}
+*/
+typedef struct {
+    uint32_t numStages;
+    const float32_t *pCoeffs;
+    float32_t *pState;
+} plp_biquad_df2T_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_biquad_df2T_instance_f32_parallel
+    @brief Instance structure for the multi-channel biquad cascade (Transposed Direct Form II, 32-bit float).
+    @param[in]  S          points to the array of per channel instances
+    @param[in]  nChannels  number of channels
+    @param[in]  pSrc       points to the input samples of all channels
+    @param[out] pDst       points to the output samples of all channels
+    @param[in]  blockSize  number of samples per channel
+    @param[in]  nPE        number of parallel processing units
+*/
+typedef struct {
+    const plp_biquad_df2T_instance_f32 *S;
+    uint32_t nChannels;
+    const float32_t *pSrc;
+    float32_t *pDst;
+    uint32_t blockSize;
+    uint32_t nPE;
+} plp_biquad_df2T_instance_f32_parallel;
+
+/**
+ * @brief Instance structure for the fixed-point CFFT/CIFFT function.
+ * @param[in]   fftLen              length of the FFT
+ * @param[in]   pTwiddle            points to the Twiddle factor table
+ * @param[in]   pBitRevTable        points to the bit reversal table
+ * @param[in]   bitRevTableLength   bit reversal table length
  */
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
-    uint32_t shift;
+    uint16_t fftLen;             /*< length of the FFT. */
+    const int16_t *pTwiddle;     /*< points to the Twiddle factor table. */
+    const int16_t *pBitRevTable; /*< points to the bit reversal table. */
+    uint16_t bitRevLength;       /*< bit reversal table length. */
+} plp_cfft_instance_q16;
+
+/**
+ * @brief Instance structure for the parallel CFFT Q16
+ * @param[in]       fft_struct          cfft_q16 struct
+ * @param[in/out]   p1                  points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]       ifftFlag            flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]       bitReverseFlag      flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]       deciPoint           decimal point for right shift
+ * @param[in]       nPE                 number of cores to use
+ */
+typedef struct {
+    plp_cfft_instance_q16 *S;
+    int16_t *p1;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_q32;
+} plp_cfft_instance_q16_parallel;
+
+/**
+ * @brief Instance structure for the fixed-point CFFT/CIFFT function.
+ * @param[in]   fftLen              length of the FFT
+ * @param[in]   pTwiddle            points to the Twiddle factor table
+ * @param[in]   pBitRevTable        points to the bit reversal table
+ * @param[in]   bitRevTableLength   bit reversal table length
+ */
+typedef struct {
+    uint16_t fftLen;             /*< length of the FFT. */
+    const int32_t *pTwiddle;     /*< points to the Twiddle factor table. */
+    const int16_t *pBitRevTable; /*< points to the bit reversal table. */
+    uint16_t bitRevLength;       /*< bit reversal table length. */
+} plp_cfft_instance_q32;
+
+/** scaleMask of plp_cfft_q32_parallel which scales down every stage (output = DFT / N) */
+#define PLP_CFFT_Q32_SCALE_ALL 0xFFFFFFFFU
+
+/**
+ * @brief Instance structure for the parallel CFFT Q32
+ * @param[in]       S                   cfft_q32 struct
+ * @param[in/out]   p1                  points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]       ifftFlag            flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]       bitReverseFlag      flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]       scaleMask           bit s enables the down-scaling of stage s
+ * @param[in]       nPE                 number of cores to use
+ */
+typedef struct {
+    const plp_cfft_instance_q32 *S;
+    int32_t *p1;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t scaleMask;
+    uint32_t nPE;
+} plp_cfft_instance_q32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+    @struct plp_fft_instance_f32
+    @brief Instance structure for floating-point FFT
+    @param[in]  length data length of the FFT
+    @param[in]  bitReverseFlag  flag that enables (bitReverseFlagR=1) or disables
+    (bitReverseFlagR=0) bit reversal of output
+    @param[in]  pTwiddleFactors pointer to the twiddle factors.
+    These values must be computed using this formula:
+    \f$W_N^k =   e^{-j \frac{2\pi}{N} k}\f$,
+    where \f$N\f$ is the data length and \f$k\f$ is the index.
+    The radix-2 complex FFT and the real FFT read \f$\frac{N}{2}\f$ values
+    (\f$k = 0 .. \frac{N}{2}-1\f$), the radix-4/8 complex FFT reads \f$N\f$ values
+    (\f$k = 0 .. N-1\f$).
+    @param[in]  pBitReverseLUT  pointer to the lookup table used for the bit reversal of output.
+    This table must include \f$N\f$ elements in the range \f$0 .. N-1\f$, where each location
+    \f$k\f$ contains the value \f$bitreverse(k)\f$. The real FFT computes the values on the fly
+    if it is NULL.
+    With bitReverseFlag=0, the real FFT returns all \f$N\f$ bins (the upper half by conjugate
+    symmetry) in bit-reversed order, and the in-place real FFT leaves bin \f$k < \frac{N}{2}\f$
+    at position \f$bitreverse(2k)\f$ and bin \f$\frac{N}{2}\f$ at position \f$\frac{N}{2}\f$.
+    The inverse real FFT always works in natural order.
+    Precomputed real FFT instances for N = 16 .. 8192 are available in plp_const_structs.h. They
+    have bitReverseFlag=1 (natural order), unlike the earlier ones for N = 32, 128, 512 and 2048.
+*/
+typedef struct {
+    uint32_t FFTLength;
+    uint8_t bitReverseFlag;
+    const float32_t *pTwiddleFactors;
+    const uint16_t *pBitReverseLUT;
+} plp_fft_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_fft_instance_f32_parallel
+    @brief Instance structure for floating-point FFT (parallel version)
+    @param[in]  S         pointer to a plp_fft_instance_f32 data structure (FFT parameters)
+    @param[in]  pSrc      pointer to the input data buffer
+    @param[in]  nPE       number of cores
+    @param[out] pDst      pointer to the output data buffer
+*/
+typedef struct {
+    plp_fft_instance_f32 *S;
+    const float32_t *pSrc;
+    const uint32_t nPE;
+    float32_t *pDst;
+} plp_fft_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_triangular_filter_f32
+    @brief structure containing non-zero values of triangular filterbanks
+    @param  V               pointer to an array containing all non-zero filter
+    			    coefficients of the triangular filters
+    @param  firstValue      pointer to array containing indexes of the
+    			    first non-zero coefficients of the filters
+    @param  filterLength    pointer to array containing lengths of the
+    			    non-zero region of each filter
+    @param  nFilters        total amount of triangular filters (n_mels)
+*/
+typedef struct {
+    const float32_t *V;
+    const uint16_t *firstValue;
+    const uint16_t *filterLength;
+    const uint8_t nFilters;
+} plp_triangular_filter_f32;
+
+/** -------------------------------------------------------
+    @struct Complex_type_f32
+    @brief Helper type to represent complex values with float32 components.
+    @param  re  Real part
+    @param  im  Imaginary part
+*/
+typedef struct {
+    float32_t re;
+    float32_t im;
+} Complex_type_f32;
+
+/** -------------------------------------------------------
+    @struct plp_mfcc_instance_f32_parallel
+    @brief Instance structure for the fused floating-point MFCC (parallel version)
+    @param[in]  SFFT        pointer to the FFT instance (FFTLength = n_fft)
+    @param[in]  SDCT        pointer to the FFT instance of the DCT (FFTLength = n_mels)
+    @param[in]  pShift      pointer to the DCT shift coefficients
+    @param[in]  filterBank  pointer to the triangular filterbank
+    @param[in]  window      pointer to the window
+    @param[in]  orthoNorm   whether to use dct orthonormalisation or not
+    @param[in]  pSrc        pointer to the input data buffer
+    @param[in]  nPE         number of cores
+    @param[out] pDst        pointer to the output and scratch buffer
+*/
+typedef struct {
+    const plp_fft_instance_f32 *SFFT;
+    const plp_fft_instance_f32 *SDCT;
+    const Complex_type_f32 *pShift;
+    const plp_triangular_filter_f32 *filterBank;
+    const float32_t *window;
+    uint8_t orthoNorm;
+    const float32_t *pSrc;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_mfcc_instance_f32_parallel;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix multiplication.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
@@ -946,15 +1571,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_i8;
+} plp_mat_mult_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ * @brief Instance structure for integer parallel matrix multiplication.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
@@ -962,15 +1584,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_i16;
+} plp_mat_mult_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ * @brief Instance structure for integer parallel matrix multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
@@ -978,16 +1597,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_i32;
+} plp_mat_mult_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for floating-point parallel matrix multiplication.
  */
 typedef struct {
     const float *__restrict__ pSrcA;
@@ -995,34 +1610,35 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     float *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_f32;
+} plp_mat_mult_instance_f32;
+
+/** tile sizes of plp_mat_mult_tiled_*: a TILE_M x TILE_N tile of A and a TILE_N x TILE_O tile of B
+    are multiplied into a TILE_M x TILE_O tile of C */
+#define PLP_MAT_MULT_TILE_M 32U
+#define PLP_MAT_MULT_TILE_N 32U
+#define PLP_MAT_MULT_TILE_O 32U
 
 /** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for integer tiled matrix multiplication.
  */
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
-    uint32_t shift;
     uint32_t nPE;
-    int8_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_q8;
+    int32_t *__restrict__ pDstC;
+    int32_t *pBufA[2];
+    int32_t *pBufB[2];
+    int32_t *pBufC[2];
+    int32_t *pTmp; // partial products, only used if N > PLP_MAT_MULT_TILE_N
+} plp_mat_mult_tiled_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for integer tiled matrix multiplication.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
@@ -1030,3247 +1646,7827 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
-    uint32_t shift;
     uint32_t nPE;
-    int16_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_q16;
+    int32_t *__restrict__ pDstC;
+    int16_t *pBufA[2];
+    int16_t *pBufB[2];
+    int32_t *pBufC[2];
+    int32_t *pTmp; // partial products, only used if N > PLP_MAT_MULT_TILE_N
+} plp_mat_mult_tiled_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for integer tiled matrix multiplication.
  */
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
-    uint32_t shift;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_q32;
+    int8_t *pBufA[2];
+    int8_t *pBufB[2];
+    int32_t *pBufC[2];
+    int32_t *pTmp; // partial products, only used if N > PLP_MAT_MULT_TILE_N
+} plp_mat_mult_tiled_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix addition.
+ * @brief Instance structure for floating-point tiled matrix multiplication.
  */
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_add_stride_instance_i8;
+    float *__restrict__ pDstC;
+    float *pBufA[2];
+    float *pBufB[2];
+    float *pBufC[2];
+    float *pTmp; // partial products, only used if N > PLP_MAT_MULT_TILE_N
+} plp_mat_mult_tiled_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix addition.
+ * @brief Instance structure for 8-bit fix-point parallel matrix multiplication.
  */
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
+    uint32_t shift;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_add_stride_instance_i16;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_instance_q8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix addition.
+ * @brief Instance structure for parallel 8-bit matrix multiplication with per-channel
+ *        requantization.
  */
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
+    const int32_t *__restrict__ pBias;
+    const int32_t *__restrict__ pMult;
+    const uint32_t *__restrict__ pShift;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_add_stride_instance_i32;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_requant_instance_q8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix addition.
+ * @brief Instance structure for 16-bit fix-point parallel matrix multiplication.
  */
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
+    uint32_t shift;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_add_stride_instance_f32;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix subtraction.
+ * @brief Instance structure for 32-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
     const int8_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_sub_stride_instance_i8;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix subtraction.
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
     const int16_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_sub_stride_instance_i16;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix subtraction.
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
     const int32_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_sub_stride_instance_i32;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix subtraction.
+ * @brief Instance structure for floating-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const float *__restrict__ pSrcA;
     const float *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_sub_stride_instance_f32;
+    float *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix scale.
+ * @brief Instance structure for 8-bit fix-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
-    const int8_t *__restrict__ pSrc;
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
-    int8_t scaleFactor;
-    int32_t shift;
+    uint32_t O;
+    uint32_t shift;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_scale_stride_instance_i8;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_q8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix scale.
+ * @brief Instance structure for 16-bit fix-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
-    const int16_t *__restrict__ pSrc;
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
-    int16_t scaleFactor;
-    int32_t shift;
+    uint32_t O;
+    uint32_t shift;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_scale_stride_instance_i16;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix scale.
+ * @brief Instance structure for 32-bit fix-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
-    const int32_t *__restrict__ pSrc;
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
-    int32_t scaleFactor;
-    int32_t shift;
+    uint32_t O;
+    uint32_t shift;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_scale_stride_instance_i32;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix scale.
+ * @brief Instance structure for integer parallel matrix addition.
  */
 typedef struct {
-    const float *__restrict__ pSrc;
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
-    float scaleFactor;
-    uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_scale_stride_instance_f32;
-
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided identity matrix creation.
- */
-typedef struct {
-    uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
     int8_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_i8;
+} plp_mat_add_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided identity matrix creation.
+ * @brief Instance structure for integer parallel matrix addition.
  */
 typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
     int16_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_i16;
+} plp_mat_add_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided identity matrix creation.
+ * @brief Instance structure for integer parallel matrix addition.
  */
 typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
     int32_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_i32;
+} plp_mat_add_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel strided identity matrix creation.
+ * @brief Instance structure for floating-point parallel matrix addition.
  */
 typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
     float *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_f32;
+} plp_mat_add_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel strided identity matrix creation.
+ * @brief Instance structure for integer parallel matrix subtraction.
  */
 typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
-    int32_t fracBits;
     int8_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_q8;
+} plp_mat_sub_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel strided identity matrix creation.
+ * @brief Instance structure for integer parallel matrix subtraction.
  */
 typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
-    int32_t fracBits;
     int16_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_q16;
+} plp_mat_sub_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel strided identity matrix creation.
+ * @brief Instance structure for integer parallel matrix subtraction.
  */
 typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
-    int32_t fracBits;
     int32_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_q32;
+} plp_mat_sub_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling an integer matrix in parallel.
+ * @brief Instance structure for floating-point parallel matrix subtraction.
  */
 typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t stride;
-    int8_t value;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_fill_stride_instance_i8;
+    float *__restrict__ pDst;
+} plp_mat_sub_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling an integer matrix in parallel.
+ * @brief Instance structure for integer parallel matrix scale.
  */
 typedef struct {
+    const int8_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t stride;
-    int16_t value;
+    int8_t scaleFactor;
+    int32_t shift;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_fill_stride_instance_i16;
+    int8_t *__restrict__ pDst;
+} plp_mat_scale_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling an integer matrix in parallel.
+ * @brief Instance structure for integer parallel matrix scale.
  */
 typedef struct {
+    const int16_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t stride;
-    int32_t value;
+    int16_t scaleFactor;
+    int32_t shift;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_fill_stride_instance_i32;
+    int16_t *__restrict__ pDst;
+} plp_mat_scale_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling a floating-point matrix in parallel.
+ * @brief Instance structure for integer parallel matrix scale.
  */
 typedef struct {
+    const int32_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t stride;
-    float value;
+    int32_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_scale_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel matrix scale.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    float scaleFactor;
     uint32_t nPE;
     float *__restrict__ pDst;
-} plp_mat_fill_stride_instance_f32;
+} plp_mat_scale_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided matrix copy.
+ * @brief Instance structure for integer parallel matrix transpose.
  */
 typedef struct {
     const int8_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
     uint32_t nPE;
     int8_t *__restrict__ pDst;
-} plp_mat_copy_stride_instance_i8;
+} plp_mat_trans_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided matrix copy.
+ * @brief Instance structure for integer parallel matrix transpose.
  */
 typedef struct {
     const int16_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
     uint32_t nPE;
     int16_t *__restrict__ pDst;
-} plp_mat_copy_stride_instance_i16;
+} plp_mat_trans_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided matrix copy.
+ * @brief Instance structure for integer parallel matrix transpose.
  */
 typedef struct {
     const int32_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
     uint32_t nPE;
     int32_t *__restrict__ pDst;
-} plp_mat_copy_stride_instance_i32;
+} plp_mat_trans_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel strided matrix copy.
+ * @brief Instance structure for integer parallel in-place square matrix transpose.
  */
 typedef struct {
-    const float *__restrict__ pSrc;
-    uint32_t M;
+    int32_t *__restrict__ pSrcDst;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_copy_stride_instance_f32;
+} plp_mat_trans_in_place_instance_i32;
 
 /** -------------------------------------------------------
-    @brief Glue code for parallel dot product of 32-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  nPE        number of parallel processing units
-    @param[out] pRes     output result returned here
-    @return     none
-*/
-
-void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pRes);
+ * @brief Instance structure for integer parallel in-place square matrix transpose.
+ */
+typedef struct {
+    int16_t *__restrict__ pSrcDst;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_trans_in_place_instance_i16;
 
 /** -------------------------------------------------------
-    @brief Glue code for parallel dot product of 32-bit fixed point vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[in]  nPE        number of parallel processing units
-    @param[out] pRes     output result returned here
-    @return     none
-*/
-
-void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t deciPoint,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pRes);
+ * @brief Instance structure for integer parallel in-place square matrix transpose.
+ */
+typedef struct {
+    int8_t *__restrict__ pSrcDst;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_trans_in_place_instance_i8;
 
 /** -------------------------------------------------------
-    @brief Glue code for parallel dot product of 32-bit float vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  nPE        number of parallel processing units
-    @param[out] pRes     output result returned here
-    @return     none
-*/
-
-void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
-                               const float32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t nPE,
-                               float32_t *__restrict__ pRes);
+ * @brief Instance structure for floating-point parallel matrix inversion.
+ */
+typedef struct {
+    float *__restrict__ pSrc;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+    float *pPivotVal;    // per-core candidate pivot values, nPE elements
+    uint32_t *pPivotIdx; // per-core candidate pivot rows, nPE elements
+    int ret;             // 0: Success, 1: Matrix is singular
+} plp_mat_inv_instance_f32;
 
 /** -------------------------------------------------------
-    @brief Parallel dot product with interleaved access of 32-bit integer vectors kernel for XPULPV2
-    extension.
-    @param[in]  S     points to the instance structure for integer parallel dot product
-    @return     none
-*/
-
-void plp_dot_prod_i32p_xpulpv2(void *S);
+ * @brief Instance structure for floating-point parallel Cholesky decomposition.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDstL;
+    int ret; // 0: Success, 1: Matrix is not positive definite
+} plp_mat_cholesky_instance_f32;
 
 /** -------------------------------------------------------
-    @brief Parallel dot product with interleaved access of 32-bit fixed point vectors kernel for
-    XPULPV2 extension.
-    @param[in]  S     points to the instance structure for fixed point parallel dot product
-    @return     none
-*/
-
-void plp_dot_prod_q32p_xpulpv2(void *S);
+ * @brief Instance structure for floating-point parallel LU decomposition.
+ */
+typedef struct {
+    float *__restrict__ pSrcDst;
+    uint32_t N;
+    uint32_t nPE;
+    uint32_t *__restrict__ pPerm;
+    float *pPivotVal;    // per-core candidate pivot values, nPE elements
+    uint32_t *pPivotIdx; // per-core candidate pivot rows, nPE elements
+    int ret;             // 0: Success, 1: Matrix is singular
+} plp_mat_lu_instance_f32;
 
 /** -------------------------------------------------------
-    @brief Parallel dot product with interleaved access of 32-bit float vectors kernel for XPULPV2
-    extension.
-    @param[in]  S     points to the instance structure for float parallel dot product
-    @return     none
-*/
-
-void plp_dot_prod_f32p_xpulpv2(void *S);
+ * @brief Instance structure for floating-point parallel lower and upper triangular solves.
+ */
+typedef struct {
+    const float *__restrict__ pSrcT; // lower or upper triangular matrix
+    const float *__restrict__ pSrcB;
+    uint32_t N;
+    uint32_t K;
+    uint8_t unitDiag; // lower triangular only, 1: diagonal is taken as one
+    uint32_t nPE;
+    float *__restrict__ pDstX;
+    int ret; // 0: Success, 1: Matrix is singular
+} plp_mat_solve_triangular_instance_f32;
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-*/
-void plp_dot_prod_i32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t blockSize,
-                      int32_t *__restrict__ pRes);
+ * @brief Instance structure for floating-point parallel linear system solve.
+ */
+typedef struct {
+    float *__restrict__ pSrcA;
+    float *__restrict__ pSrcB;
+    uint32_t N;
+    uint32_t K;
+    uint32_t nPE;
+    float *__restrict__ pDstX;
+    float *pPivotVal;    // per-core candidate pivot values, nPE elements
+    uint32_t *pPivotIdx; // per-core candidate pivot rows, nPE elements
+    int ret;             // 0: Success, 1: Matrix is singular
+} plp_mat_solve_instance_f32;
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-*/
-void plp_dot_prod_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              int32_t *__restrict__ pRes);
+ * @brief Instance structure for integer parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_i8;
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-*/
-void plp_dot_prod_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               int32_t *__restrict__ pRes);
+ * @brief Instance structure for integer parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_i16;
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit fixed point vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here
-    @return     none
-*/
-
-void plp_dot_prod_q32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t blockSize,
-                      uint32_t deciPoint,
-                      int32_t *__restrict__ pRes);
+ * @brief Instance structure for integer parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_i32;
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit fixed point vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here
-    @return     none
-*/
+ * @brief Instance structure for floating-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_fill_I_instance_f32;
 
-void plp_dot_prod_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              uint32_t deciPoint,
-                              int32_t *__restrict__ pRes);
+/** -------------------------------------------------------
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    int32_t fracBits;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q8;
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit fixed point vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here
-    @return     none
-*/
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q16;
 
-void plp_dot_prod_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t deciPoint,
-                               int32_t *__restrict__ pRes);
+/** -------------------------------------------------------
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q32;
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit float vectors.
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 8-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 16-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 32-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix addition.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_add_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix subtraction.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_sub_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int8_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int16_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int32_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix scale.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    float scaleFactor;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_scale_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int8_t value;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int16_t value;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int32_t value;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling a floating-point matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    float value;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_fill_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel strided matrix copy.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_copy_stride_instance_f32;
+
+/** default size in bytes of one L1 buffer of the plp_stream_* functions */
+#define PLP_STREAM_TILE_BYTES 2048U
+
+/** -------------------------------------------------------
+    @struct plp_stream
+    @brief Double-buffered DMA stream of an array in L2 through two tiles in cluster L1, see
+           plp_stream_init.
+    @param  pExt      array in L2
+    @param  pBuf      ping-pong buffers in L1
+    @param  cmd       DMA command of each buffer
+    @param  busy      whether a transfer is in flight on each buffer
+    @param  elemSize  size of one element in bytes
+    @param  length    number of elements of the array
+    @param  tileLen   number of elements per tile
+    @param  dir       HAL_CL_DMA_DIR_EXT2LOC for inputs, HAL_CL_DMA_DIR_LOC2EXT for outputs
+    @param  offset    index of the first element of the current tile
+    @param  buf       buffer of the current tile
+    @param  pTile     current tile, NULL if no tile is acquired
+    @param  tileCnt   number of elements in the current tile
+*/
+typedef struct {
+    uint8_t *pExt;
+    uint8_t *pBuf[2];
+    hal_cl_dma_cmd_t cmd[2];
+    uint8_t busy[2];
+    uint32_t elemSize;
+    uint32_t length;
+    uint32_t tileLen;
+    hal_cl_dma_dir_e dir;
+    uint32_t offset;
+    uint32_t buf;
+    void *pTile;
+    uint32_t tileCnt;
+} plp_stream;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for the streamed vector functions.
+ */
+typedef struct {
+    plp_stream *pStreamA;
+    plp_stream *pStreamB;
+    plp_stream *pStreamDst; // NULL for reductions
+    uint32_t nPE;
+    void *pPartial; // one result per core for reductions
+} plp_stream_instance;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for the streamed matrix multiplication.
+ */
+typedef struct {
+    plp_stream *pStreamA;
+    const void *pSrcB; // in L1
+    plp_stream *pStreamDst;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+} plp_stream_mat_mult_instance;
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product of 32-bit integer vectors kernel for XPULPV2 extension, one
+    contiguous block per core.
+    @param[in]  S     points to the instance structure for integer parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_i32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product of 32-bit fixed point vectors kernel for XPULPV2 extension, one
+    contiguous block per core.
+    @param[in]  S     points to the instance structure for fixed point parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_q32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product of 32-bit float vectors kernel for XPULPV2 extension, one
+    contiguous block per core.
+    @param[in]  S     points to the instance structure for float parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_f32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      uint32_t deciPoint,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit fixed point vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32(const float32_t *__restrict__ pSrcA,
+                      const float32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32s_rv32im(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pRes);
+
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+void plp_dot_prod_i16(const int16_t *pSrcA,
+                      const int16_t *pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
+    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit integer vectors kernel singlecore for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors.
+*/
+
+void plp_dot_prod_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 16-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      uint32_t deciPoint,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 16-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
+    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit fixed point vectors singlecore kernel for XPULPV2
+   extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_i8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [8] bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 8-bit integer vectors singlecore kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 8-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     uint32_t deciPoint,
+                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 8-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             uint32_t deciPoint,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 8-bit fixed point vectors singlecore kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 32-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32(const int32_t * pSrc,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 32-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32s_rv32im(const int32_t * pSrc,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32s_xpulpv2(const int32_t * pSrc,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 16-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16(const int16_t * pSrc,
+                 int16_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16s_rv32im(const int16_t * pSrc,
+                         int16_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16s_xpulpv2(const int16_t * pSrc,
+                          int16_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 8-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8(const int8_t * pSrc,
+                 int8_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8s_rv32im(const int8_t * pSrc,
+                         int8_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8s_xpulpv2(const int8_t * pSrc,
+                          int8_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel absolute value of 32-bit integer vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_abs_i32_parallel(const int32_t *pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel absolute value of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 32-bit integer parallel absolute value
+    @return     none
+*/
+
+void plp_abs_i32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel absolute value of 16-bit integer vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_abs_i16_parallel(const int16_t *pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel absolute value of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 16-bit integer parallel absolute value
+    @return     none
+*/
+
+void plp_abs_i16p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel absolute value of 8-bit integer vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_abs_i8_parallel(const int8_t *pSrc,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         int8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel absolute value of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 8-bit integer parallel absolute value
+    @return     none
+*/
+
+void plp_abs_i8p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32(const int32_t * pSrcA,
+                 const int32_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32s_rv32im(const int32_t * pSrcA,
+                         const int32_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32s_xpulpv2(const int32_t * pSrcA,
+                          const int32_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16(const int16_t * pSrcA,
+                 const int16_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16s_rv32im(const int16_t * pSrcA,
+                         const int16_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16s_xpulpv2(const int16_t * pSrcA,
+                          const int16_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8(const int8_t * pSrcA,
+                 const int8_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8s_rv32im(const int8_t * pSrcA,
+                         const int8_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8s_xpulpv2(const int8_t * pSrcA,
+                          const int8_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel addition of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_add_i32_parallel(const int32_t *pSrcA,
+                          const int32_t *pSrcB,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel addition of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 32-bit integer parallel addition
+    @return     none
+*/
+
+void plp_add_i32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel addition of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_add_i16_parallel(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel addition of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 16-bit integer parallel addition
+    @return     none
+*/
+
+void plp_add_i16p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel addition of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_add_i8_parallel(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel addition of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 8-bit integer parallel addition
+    @return     none
+*/
+
+void plp_add_i8p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32(const int32_t * pSrcA,
+                 const int32_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32s_rv32im(const int32_t * pSrcA,
+                         const int32_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32s_xpulpv2(const int32_t * pSrcA,
+                          const int32_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16(const int16_t * pSrcA,
+                 const int16_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16s_rv32im(const int16_t * pSrcA,
+                         const int16_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16s_xpulpv2(const int16_t * pSrcA,
+                          const int16_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8(const int8_t * pSrcA,
+                 const int8_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8s_rv32im(const int8_t * pSrcA,
+                         const int8_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8s_xpulpv2(const int8_t * pSrcA,
+                          const int8_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 32-bit float vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_f32(const float32_t * pSrcA,
+                 const float32_t * pSrcB,
+                 float32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 32-bit float vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_f32s_xpulpv2(const float32_t * pSrcA,
+                          const float32_t * pSrcB,
+                          float32_t * pDst,
+                          uint32_t blockSize);
+
+/**
+  @brief Glue code for parallel dot product of 32-bit float vectors.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to output vector
+  @return        none
+ */
+
+void plp_mult_f32_parallel(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               float32_t *__restrict__ pDst);
+/**
+ *   @brief Parallel multiplication of 32-bit float vectors kernel for XPULPV2 extension, one
+ *     contiguous block per core.
+ *       @param[in]  S     points to the instance structure for float parallel multiplication
+ *         @return        none
+ *          */
+
+void plp_mult_f32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel multiplication of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_mult_i32_parallel(const int32_t *pSrcA,
+                           const int32_t *pSrcB,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel multiplication of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 32-bit integer parallel multiplication
+    @return     none
+*/
+
+void plp_mult_i32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel multiplication of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_mult_i16_parallel(const int16_t *pSrcA,
+                           const int16_t *pSrcB,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel multiplication of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 16-bit integer parallel multiplication
+    @return     none
+*/
+
+void plp_mult_i16p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel multiplication of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_mult_i8_parallel(const int8_t *pSrcA,
+                          const int8_t *pSrcB,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel multiplication of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 8-bit integer parallel multiplication
+    @return     none
+*/
+
+void plp_mult_i8p_xpulpv2(void *S);
+
+/**
+  @brief Glue code for parallel log of 32-bit float vectors.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to output vector
+  @return        none
+ */
+
+void plp_log_f32_parallel(const float32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               float32_t *__restrict__ pDst);
+
+/**
+  @brief Parallel log of 32-bit float vectors kernel for XPULPV2 extension, one contiguous
+  block per core.
+  @param[in]  S     points to the instance structure for float parallel log
+  @return        none
+ */
+
+void plp_log_f32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief      Glue code of negate the elements of a vector for 32-bit integers
+    @param[in]     pSrc       points to input vector.
+    @param[out]    pDst       points to output vector.
+    @param[in]     blockSize  number of samples in each vector.
+    @return     none
+*/
+
+void plp_negate_i32(const int32_t * pSrc, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      negate the elements of a vector for 32-bit integers on RV32IM
+    @param[in]     pSrc       points to input vector.
+    @param[out]    pDst       points to output vector.
+    @param[in]     blockSize  number of samples in each vector.
+    @return     none
+*/
+
+void plp_negate_i32s_rv32im(const int32_t * pSrc, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      negate the elements of a vector for 32-bit integers on XpulpV2
+    @param[in]     pSrc       points to input vector.
+    @param[out]    pDst       points to output vector.
+    @param[in]     blockSize  number of samples in each vector.
+    @return     none
+*/
+
+void plp_negate_i32s_xpulpv2(const int32_t * pSrc, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      Glue code of negate the elements of a vector for 16-bit integers
+  @param[in]     pSrc       points to input vector.
+  @param[out]    pDst       points to output vector.
+  @param[in]     blockSize  number of samples in each vector.
+  @return     none
+*/
+
+void plp_negate_i16(const int16_t * pSrc, int16_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      negate the elements of a vector for 16-bit integers on RV32IM
+  @param[in]     pSrc       points to input vector.
+  @param[out]    pDst       points to output vector.
+  @param[in]     blockSize  number of samples in each vector.
+  @return     none
+*/
+
+void plp_negate_i16s_rv32im(const int16_t * pSrc, int16_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      negate the elements of a vector for 16-bit integers on XpulpV2
+  @param[in]     pSrc       points to input vector.
+  @param[out]    pDst       points to output vector.
+  @param[in]     blockSize  number of samples in each vector.
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_negate_i16s_xpulpv2(const int16_t * pSrc, int16_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      Glue code of negate the elements of a vector for 8-bit integers
+  @param[in]     pSrc       points to input vector.
+  @param[out]    pDst       points to output vector.
+  @param[in]     blockSize  number of samples in each vector.
+  @return     none
+*/
+
+void plp_negate_i8(const int8_t * pSrc, int8_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      negate the elements of a vector for 8-bit integers on RV32IM
+  @param[in]     pSrc       points to input vector.
+  @param[out]    pDst       points to output vector.
+  @param[in]     blockSize  number of samples in each vector.
+  @return     none
+*/
+
+void plp_negate_i8s_rv32im(const int8_t * pSrc, int8_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      negate the elements of a vector for 8-bit integers on XpulpV2
+  @param[in]     pSrc       points to input vector.
+  @param[out]    pDst       points to output vector.
+  @param[in]     blockSize  number of samples in each vector.
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_negate_i8s_xpulpv2(const int8_t * pSrc, int8_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code of negate the elements of a vector for 32-bit floats
+    @param[in]     pSrc       points to input vector.
+    @param[out]    pDst       points to output vector.
+    @param[in]     blockSize  number of samples in each vector.
+    @return     none
+*/
+
+void plp_negate_f32(const float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      negate the elements of a vector for 32-bit floats on XpulpV2
+    @param[in]     pSrc       points to input vector.
+    @param[out]    pDst       points to output vector.
+    @param[in]     blockSize  number of samples in each vector.
+    @return     none
+*/
+
+void plp_negate_f32s_xpulpv2(const float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel negation of 32-bit float vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_negate_f32_parallel(const float32_t *pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel negation of 32-bit float vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 32-bit float parallel negation
+    @return     none
+*/
+
+void plp_negate_f32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel negation of 32-bit integer vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_negate_i32_parallel(const int32_t *pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel negation of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 32-bit integer parallel negation
+    @return     none
+*/
+
+void plp_negate_i32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel negation of 16-bit integer vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_negate_i16_parallel(const int16_t *pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel negation of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 16-bit integer parallel negation
+    @return     none
+*/
+
+void plp_negate_i16p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel negation of 8-bit integer vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_negate_i8_parallel(const int8_t *pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            int8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel negation of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 8-bit integer parallel negation
+    @return     none
+*/
+
+void plp_negate_i8p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+  @brief      Glue code of add a constant offset to a vector for 32-bit integers
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     is the offset to be added
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_offset_i32(const int32_t * pSrc, int32_t offset, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      add a constant offset to a vector for 32-bit integers on RV32IM
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     is the offset to be added
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_offset_i32s_rv32im(const int32_t * pSrc, int32_t offset, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      add a constant offset to a vector for 32-bit integers on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     is the offset to be added
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_offset_i32s_xpulpv2(const int32_t * pSrc, int32_t offset, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      Glue code of add a constant offset to a vector for 16-bit integers
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     is the offset to be added
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_offset_i16(const int16_t * pSrc, int16_t offset, int16_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      add a constant offset to a vector for 16-bit integers on RV32IM
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     is the offset to be added
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_offset_i16s_rv32im(const int16_t * pSrc, int16_t offset, int16_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      add a constant offset to a vector for 16-bit integers on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     is the offset to be added
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_offset_i16s_xpulpv2(const int16_t * pSrc, int16_t offset, int16_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      Glue code of add a constant offset to a vector for 8-bit integers
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     is the offset to be added
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_offset_i8(const int8_t * pSrc, int8_t offset, int8_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      add a constant offset to a vector for 8-bit integers on RV32IM
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     is the offset to be added
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_offset_i8s_rv32im(const int8_t * pSrc, int8_t offset, int8_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      add a constant offset to a vector for 8-bit integers on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     is the offset to be added
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_offset_i8s_xpulpv2(const int8_t * pSrc, int8_t offset, int8_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      Glue code of add a constant offset to a vector for 32-bit floats
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     is the offset to be added
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_offset_f32(const float32_t * pSrc, float32_t offset, float32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      add a constant offset to a vector for 32-bit floats on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     offset     is the offset to be added
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_offset_f32s_xpulpv2(const float32_t * pSrc, float32_t offset, float32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel offset of 32-bit float vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  offset     value added to all elements
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_offset_f32_parallel(const float32_t *pSrc,
+                             uint32_t blockSize,
+                             float32_t offset,
+                             uint32_t nPE,
+                             float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel offset of 32-bit float vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 32-bit float parallel offset
+    @return     none
+*/
+
+void plp_offset_f32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel offset of 32-bit integer vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  offset     value added to all elements
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_offset_i32_parallel(const int32_t *pSrc,
+                             uint32_t blockSize,
+                             int32_t offset,
+                             uint32_t nPE,
+                             int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel offset of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 32-bit integer parallel offset
+    @return     none
+*/
+
+void plp_offset_i32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel offset of 16-bit integer vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  offset     value added to all elements
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_offset_i16_parallel(const int16_t *pSrc,
+                             uint32_t blockSize,
+                             int16_t offset,
+                             uint32_t nPE,
+                             int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel offset of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 16-bit integer parallel offset
+    @return     none
+*/
+
+void plp_offset_i16p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel offset of 8-bit integer vectors.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  offset     value added to all elements
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_offset_i8_parallel(const int8_t *pSrc,
+                            uint32_t blockSize,
+                            int8_t offset,
+                            uint32_t nPE,
+                            int8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel offset of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 8-bit integer parallel offset
+    @return     none
+*/
+
+void plp_offset_i8p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+  @brief      Glue code of vector substraction for 32-bit integers
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_sub_i32(const int32_t * pSrcA, const int32_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      vector substraction for 32-bit integers on RV32IM
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_sub_i32s_rv32im(const int32_t * pSrcA, const int32_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      vector substraction for 32-bit integers on XpulpV2
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_sub_i32s_xpulpv2(const int32_t * pSrcA, const int32_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      Glue code of vector substraction for 16-bit integers
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_sub_i16(const int16_t * pSrcA, const int16_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      vector substraction for 16-bit integers on RV32IM
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_sub_i16s_rv32im(const int16_t * pSrcA, const int16_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      vector substraction for 16-bit integers on XpulpV2
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_sub_i16s_xpulpv2(const int16_t * pSrcA, const int16_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      Glue code of vector substraction for 8-bit integers
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_sub_i8(const int8_t * pSrcA, const int8_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      vector substraction for 8-bit integers on RV32IM
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_sub_i8s_rv32im(const int8_t * pSrcA, const int8_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      vector substraction for 8-bit integers on XpulpV2
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_sub_i8s_xpulpv2(const int8_t * pSrcA, const int8_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      Glue code of vector substraction for 32-bit floats
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_sub_f32(const float32_t * pSrcA, const float32_t * pSrcB, float32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      vector substraction for 32-bit floats on XpulpV2
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_sub_f32s_xpulpv2(const float32_t * pSrcA, const float32_t * pSrcB, float32_t * pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel subtraction of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_sub_f32_parallel(const float32_t *pSrcA,
+                          const float32_t *pSrcB,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel subtraction of 32-bit float vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 32-bit float parallel subtraction
+    @return     none
+*/
+
+void plp_sub_f32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel subtraction of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_sub_i32_parallel(const int32_t *pSrcA,
+                          const int32_t *pSrcB,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel subtraction of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 32-bit integer parallel subtraction
+    @return     none
+*/
+
+void plp_sub_i32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel subtraction of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_sub_i16_parallel(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel subtraction of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 16-bit integer parallel subtraction
+    @return     none
+*/
+
+void plp_sub_i16p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel subtraction of 8-bit integer vectors.
     @param[in]  pSrcA      points to the first input vector
     @param[in]  pSrcB      points to the second input vector
     @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_sub_i8_parallel(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel subtraction of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 8-bit integer parallel subtraction
+    @return     none
+*/
+
+void plp_sub_i8p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+  @brief      Glue code of multiply a vector by a scalar for 32-bit integers
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor Factor to multiply all elements before shifting
+  @param[in]     shift      number of bits to shift the result by
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_scale_i32(const int32_t *__restrict__ pSrc, int32_t scaleFactor, int32_t shift, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      multiply a vector by a scalar for 32-bit integers on RV32IM
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor Factor to multiply all elements before shifting
+  @param[in]     shift      number of bits to shift the result by
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_scale_i32s_rv32im(const int32_t *__restrict__ pSrc, int32_t scaleFactor, int32_t shift, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      multiply a vector by a scalar for 32-bit integers on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor Factor to multiply all elements before shifting
+  @param[in]     shift      number of bits to shift the result by
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_scale_i32s_xpulpv2(const int32_t *__restrict__ pSrc, int32_t scaleFactor, int32_t shift, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      Glue code of multiply a vector by a scalar for 16-bit integers
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor Factor to multiply all elements before shifting
+  @param[in]     shift      number of bits to shift the result by
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_scale_i16(const int16_t *__restrict__ pSrc, int16_t scaleFactor, int32_t shift, int16_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      multiply a vector by a scalar for 16-bit integers on RV32IM
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor Factor to multiply all elements before shifting
+  @param[in]     shift      number of bits to shift the result by
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_scale_i16s_rv32im(const int16_t *__restrict__ pSrc, int16_t scaleFactor, int32_t shift, int16_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      multiply a vector by a scalar for 16-bit integers on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor Factor to multiply all elements before shifting
+  @param[in]     shift      number of bits to shift the result by
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_scale_i16s_xpulpv2(const int16_t *__restrict__ pSrc, int16_t scaleFactor, int32_t shift, int16_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      Glue code of multiply a vector by a scalar for 8-bit integers
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor Factor to multiply all elements before shifting
+  @param[in]     shift      number of bits to shift the result by
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_scale_i8(const int8_t *__restrict__ pSrc, int8_t scaleFactor, int32_t shift, int8_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      multiply a vector by a scalar for 8-bit integers on RV32IM
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor Factor to multiply all elements before shifting
+  @param[in]     shift      number of bits to shift the result by
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_scale_i8s_rv32im(const int8_t *__restrict__ pSrc, int8_t scaleFactor, int32_t shift, int8_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      multiply a vector by a scalar for 8-bit integers on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor Factor to multiply all elements before shifting
+  @param[in]     shift      number of bits to shift the result by
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_scale_i8s_xpulpv2(const int8_t *__restrict__ pSrc, int8_t scaleFactor, int32_t shift, int8_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      Glue code of multiply a vector by a scalar for 32-bit floats
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor Factor to multiply all elements before shifting
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_scale_f32(const float32_t *__restrict__ pSrc, float32_t scaleFactor, float32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief      multiply a vector by a scalar for 32-bit floats on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     scaleFactor Factor to multiply all elements before shifting
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return     none
+*/
+
+void plp_scale_f32s_xpulpv2(const float32_t *__restrict__ pSrc, float32_t scaleFactor, float32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel scaling of 32-bit float vectors.
+    @param[in]  pSrc         points to the input vector
+    @param[in]  blockSize    number of samples in each vector
+    @param[in]  scaleFactor  factor to multiply all elements with
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output vector
+    @return     none
+*/
+
+void plp_scale_f32_parallel(const float32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            float32_t scaleFactor,
+                            uint32_t nPE,
+                            float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel scaling of 32-bit float vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 32-bit float parallel scaling
+    @return     none
+*/
+
+void plp_scale_f32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel scaling of 32-bit integer vectors.
+    @param[in]  pSrc         points to the input vector
+    @param[in]  blockSize    number of samples in each vector
+    @param[in]  scaleFactor  factor to multiply all elements with
+    @param[in]  shift        number of bits to shift the result by
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output vector
+    @return     none
+*/
+
+void plp_scale_i32_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t scaleFactor,
+                            int32_t shift,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel scaling of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 32-bit integer parallel scaling
+    @return     none
+*/
+
+void plp_scale_i32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel scaling of 16-bit integer vectors.
+    @param[in]  pSrc         points to the input vector
+    @param[in]  blockSize    number of samples in each vector
+    @param[in]  scaleFactor  factor to multiply all elements with
+    @param[in]  shift        number of bits to shift the result by
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output vector
+    @return     none
+*/
+
+void plp_scale_i16_parallel(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int16_t scaleFactor,
+                            int32_t shift,
+                            uint32_t nPE,
+                            int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel scaling of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 16-bit integer parallel scaling
+    @return     none
+*/
+
+void plp_scale_i16p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel scaling of 8-bit integer vectors.
+    @param[in]  pSrc         points to the input vector
+    @param[in]  blockSize    number of samples in each vector
+    @param[in]  scaleFactor  factor to multiply all elements with
+    @param[in]  shift        number of bits to shift the result by
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output vector
+    @return     none
+*/
+
+void plp_scale_i8_parallel(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int8_t scaleFactor,
+                           int32_t shift,
+                           uint32_t nPE,
+                           int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Parallel scaling of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  S     points to the instance structure for 8-bit integer parallel scaling
+    @return     none
+*/
+
+void plp_scale_i8p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief      Glue code for filling a constant value into a 32-bit integer vector.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Fills a constant value into a 32-bit integer vector for RV32IM extension.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32s_rv32im(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Fills a constant value into a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32s_xpulpv2(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Register a persistent buffer as library-wide scratch arena.
+    @param[in]  pBuf  points to the buffer (should be in cluster L1), NULL disables the arena
+    @param[in]  size  size of the buffer in bytes
+    @return     none
+*/
+
+void plp_scratch_init(void *pBuf, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief      Allocate a temporary buffer from the scratch arena, falling back to
+                hal_cl_l1_malloc if the arena is not set or too small.
+    @param[in]  size  size of the buffer in bytes
+    @return     pointer to the allocated buffer
+*/
+
+void *plp_scratch_alloc(uint32_t size);
+
+/** -------------------------------------------------------
+    @brief      Release a buffer obtained from plp_scratch_alloc. Arena space of buffers freed
+                out of LIFO order is given back once all arena buffers are freed.
+    @param[in]  pChunk  points to the buffer
+    @param[in]  size    size of the buffer in bytes
+    @return     none
+*/
+
+void plp_scratch_free(void *pChunk, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief      Release all buffers allocated from the scratch arena (frame reset).
+    @return     none
+*/
+
+void plp_scratch_reset(void);
+
+/** -------------------------------------------------------
+    @brief      Compute the contiguous block [start, end) of a vector processed by one core. All
+                blocks but the last start on a multiple of align elements, the last non-empty
+                block takes the remainder.
+    @param[in]  blockSize  number of elements in the vector
+    @param[in]  nPE        number of cores the vector is split across
+    @param[in]  coreId     index of the core
+    @param[in]  align      block alignment in elements, must be a power of two (1 for none)
+    @param[out] pStart     first element of the block
+    @param[out] pEnd       one past the last element of the block
+    @return     none
+*/
+
+void plp_partition(uint32_t blockSize,
+                   uint32_t nPE,
+                   uint32_t coreId,
+                   uint32_t align,
+                   uint32_t *pStart,
+                   uint32_t *pEnd);
+
+/** -------------------------------------------------------
+    @brief      Initialize a stream over an L2 array and start the transfer of its first tile.
+    @param[out] s         points to the stream
+    @param[in]  pExt      points to the array in L2
+    @param[in]  elemSize  size of one element in bytes
+    @param[in]  length    number of elements of the array
+    @param[in]  tileLen   number of elements per tile (multiple of 4 for SIMD kernels)
+    @param[in]  dir       HAL_CL_DMA_DIR_EXT2LOC for inputs, HAL_CL_DMA_DIR_LOC2EXT for outputs
+    @return     0 on success, -1 if the L1 buffers cannot be allocated
+*/
+
+int plp_stream_init(plp_stream *s,
+                    void *pExt,
+                    uint32_t elemSize,
+                    uint32_t length,
+                    uint32_t tileLen,
+                    hal_cl_dma_dir_e dir);
+
+/** -------------------------------------------------------
+    @brief      Acquire the next tile of a stream into s->pTile.
+    @param[in]  s  points to the stream
+    @return     number of elements in the tile, 0 at the end of the array
+*/
+
+uint32_t plp_stream_acquire(plp_stream *s);
+
+/** -------------------------------------------------------
+    @brief      Release the current tile of a stream, writing it back to L2 for output streams.
+    @param[in]  s  points to the stream
+    @return     none
+*/
+
+void plp_stream_release(plp_stream *s);
+
+/** -------------------------------------------------------
+    @brief      Wait for all transfers of a stream and release its L1 buffers.
+    @param[in]  s  points to the stream
+    @return     none
+*/
+
+void plp_stream_deinit(plp_stream *s);
+
+/** -------------------------------------------------------
+    @brief      Advance a group of streams to their next tiles, called by all cores of a team.
+    @param[in]  ppStreams  points to the streams of the group
+    @param[in]  nStreams   number of streams in the group
+    @return     number of elements in the tile of the first stream, 0 if it has ended
+*/
+
+uint32_t plp_stream_team_next(plp_stream *const *ppStreams, uint32_t nStreams);
+
+/** -------------------------------------------------------
+    @brief      Glue code for dot product of 32-bit integer vectors in L2, streamed through cluster
+                L1.
+    @param[in]  pSrcA      points to the first input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores to use for computation
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_stream_dot_prod_i32(const int32_t *pSrcA,
+                             const int32_t *pSrcB,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int32_t *pRes);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_dot_prod_i32 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_instance struct initialized by
+                      plp_stream_dot_prod_i32
+    @return     none
+*/
+
+void plp_stream_dot_prod_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for dot product of 16-bit integer vectors in L2, streamed through cluster
+                L1.
+    @param[in]  pSrcA      points to the first input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores to use for computation
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_stream_dot_prod_i16(const int16_t *pSrcA,
+                             const int16_t *pSrcB,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int32_t *pRes);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_dot_prod_i16 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_instance struct initialized by
+                      plp_stream_dot_prod_i16
+    @return     none
+*/
+
+void plp_stream_dot_prod_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for dot product of 8-bit integer vectors in L2, streamed through cluster
+                L1.
+    @param[in]  pSrcA      points to the first input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores to use for computation
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_stream_dot_prod_i8(const int8_t *pSrcA,
+                            const int8_t *pSrcB,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            int32_t *pRes);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_dot_prod_i8 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_instance struct initialized by
+                      plp_stream_dot_prod_i8
+    @return     none
+*/
+
+void plp_stream_dot_prod_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for dot product of 32-bit floating-point vectors in L2, streamed through
+                cluster L1.
+    @param[in]  pSrcA      points to the first input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores to use for computation
     @param[out] pRes       output result returned here
     @return     none
 */
 
-void plp_dot_prod_f32(const float32_t *__restrict__ pSrcA,
-                      const float32_t *__restrict__ pSrcB,
-                      uint32_t blockSize,
-                      float32_t *__restrict__ pRes);
+void plp_stream_dot_prod_f32(const float32_t *pSrcA,
+                             const float32_t *pSrcB,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             float32_t *pRes);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_dot_prod_f32 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_instance struct initialized by
+                      plp_stream_dot_prod_f32
+    @return     none
+*/
+
+void plp_stream_dot_prod_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for element-by-element addition of 32-bit integer vectors in L2, streamed
+                through cluster L1.
+    @param[in]  pSrcA      points to the first input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2
+    @param[out] pDst       points to the output vector in L2
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores to use for computation
+    @return     none
+*/
+
+void plp_stream_add_i32(const int32_t *pSrcA,
+                        const int32_t *pSrcB,
+                        int32_t *pDst,
+                        uint32_t blockSize,
+                        uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_add_i32 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_instance struct initialized by
+                      plp_stream_add_i32
+    @return     none
+*/
+
+void plp_stream_add_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for element-by-element addition of 16-bit integer vectors in L2, streamed
+                through cluster L1.
+    @param[in]  pSrcA      points to the first input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2
+    @param[out] pDst       points to the output vector in L2
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores to use for computation
+    @return     none
+*/
+
+void plp_stream_add_i16(const int16_t *pSrcA,
+                        const int16_t *pSrcB,
+                        int32_t *pDst,
+                        uint32_t blockSize,
+                        uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_add_i16 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_instance struct initialized by
+                      plp_stream_add_i16
+    @return     none
+*/
+
+void plp_stream_add_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for element-by-element addition of 8-bit integer vectors in L2, streamed
+                through cluster L1.
+    @param[in]  pSrcA      points to the first input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2
+    @param[out] pDst       points to the output vector in L2
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores to use for computation
+    @return     none
+*/
+
+void plp_stream_add_i8(const int8_t *pSrcA,
+                       const int8_t *pSrcB,
+                       int32_t *pDst,
+                       uint32_t blockSize,
+                       uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_add_i8 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_instance struct initialized by
+                      plp_stream_add_i8
+    @return     none
+*/
+
+void plp_stream_add_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for element-by-element multiplication of 32-bit integer vectors in L2,
+                streamed through cluster L1.
+    @param[in]  pSrcA      points to the first input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2
+    @param[out] pDst       points to the output vector in L2
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores to use for computation
+    @return     none
+*/
+
+void plp_stream_mult_i32(const int32_t *pSrcA,
+                         const int32_t *pSrcB,
+                         int32_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_mult_i32 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_instance struct initialized by
+                      plp_stream_mult_i32
+    @return     none
+*/
+
+void plp_stream_mult_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for element-by-element multiplication of 16-bit integer vectors in L2,
+                streamed through cluster L1.
+    @param[in]  pSrcA      points to the first input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2
+    @param[out] pDst       points to the output vector in L2
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores to use for computation
+    @return     none
+*/
+
+void plp_stream_mult_i16(const int16_t *pSrcA,
+                         const int16_t *pSrcB,
+                         int32_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_mult_i16 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_instance struct initialized by
+                      plp_stream_mult_i16
+    @return     none
+*/
+
+void plp_stream_mult_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for element-by-element multiplication of 8-bit integer vectors in L2,
+                streamed through cluster L1.
+    @param[in]  pSrcA      points to the first input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2
+    @param[out] pDst       points to the output vector in L2
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores to use for computation
+    @return     none
+*/
+
+void plp_stream_mult_i8(const int8_t *pSrcA,
+                        const int8_t *pSrcB,
+                        int32_t *pDst,
+                        uint32_t blockSize,
+                        uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_mult_i8 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_instance struct initialized by
+                      plp_stream_mult_i8
+    @return     none
+*/
+
+void plp_stream_mult_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for element-by-element multiplication of 32-bit floating-point vectors in
+                L2, streamed through cluster L1.
+    @param[in]  pSrcA      points to the first input vector in L2
+    @param[in]  pSrcB      points to the second input vector in L2
+    @param[out] pDst       points to the output vector in L2
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores to use for computation
+    @return     none
+*/
+
+void plp_stream_mult_f32(const float32_t *pSrcA,
+                         const float32_t *pSrcB,
+                         float32_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_mult_f32 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_instance struct initialized by
+                      plp_stream_mult_f32
+    @return     none
+*/
+
+void plp_stream_mult_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for matrix multiplication of 32-bit integer matrices in L2, streamed
+                through cluster L1.
+    @param[in]  pSrcA  points to the first input matrix of shape MxN in L2
+    @param[in]  pSrcB  points to the second input matrix of shape NxO in L2, it is copied to L1
+                       and must fit into it
+    @param[in]  M      height of the first matrix and of the output matrix
+    @param[in]  N      width of the first matrix and height of the second matrix
+    @param[in]  O      width of the second matrix and of the output matrix
+    @param[in]  nPE    number of cores to use for computation
+    @param[out] pDstC  points to the output matrix of shape MxO in L2
+    @return     none
+*/
+
+void plp_stream_mat_mult_i32(const int32_t *pSrcA,
+                             const int32_t *pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t nPE,
+                             int32_t *pDstC);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_mat_mult_i32 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_mat_mult_instance struct initialized by
+                      plp_stream_mat_mult_i32
+    @return     none
+*/
+
+void plp_stream_mat_mult_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for matrix multiplication of 16-bit integer matrices in L2, streamed
+                through cluster L1.
+    @param[in]  pSrcA  points to the first input matrix of shape MxN in L2
+    @param[in]  pSrcB  points to the second input matrix of shape NxO in L2, it is copied to L1
+                       and must fit into it
+    @param[in]  M      height of the first matrix and of the output matrix
+    @param[in]  N      width of the first matrix and height of the second matrix
+    @param[in]  O      width of the second matrix and of the output matrix
+    @param[in]  nPE    number of cores to use for computation
+    @param[out] pDstC  points to the output matrix of shape MxO in L2
+    @return     none
+*/
+
+void plp_stream_mat_mult_i16(const int16_t *pSrcA,
+                             const int16_t *pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t nPE,
+                             int32_t *pDstC);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_mat_mult_i16 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_mat_mult_instance struct initialized by
+                      plp_stream_mat_mult_i16
+    @return     none
+*/
+
+void plp_stream_mat_mult_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for matrix multiplication of 8-bit integer matrices in L2, streamed
+                through cluster L1.
+    @param[in]  pSrcA  points to the first input matrix of shape MxN in L2
+    @param[in]  pSrcB  points to the second input matrix of shape NxO in L2, it is copied to L1
+                       and must fit into it
+    @param[in]  M      height of the first matrix and of the output matrix
+    @param[in]  N      width of the first matrix and height of the second matrix
+    @param[in]  O      width of the second matrix and of the output matrix
+    @param[in]  nPE    number of cores to use for computation
+    @param[out] pDstC  points to the output matrix of shape MxO in L2
+    @return     none
+*/
+
+void plp_stream_mat_mult_i8(const int8_t *pSrcA,
+                            const int8_t *pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t nPE,
+                            int32_t *pDstC);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_mat_mult_i8 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_mat_mult_instance struct initialized by
+                      plp_stream_mat_mult_i8
+    @return     none
+*/
+
+void plp_stream_mat_mult_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for matrix multiplication of 32-bit floating-point matrices in L2,
+                streamed through cluster L1.
+    @param[in]  pSrcA  points to the first input matrix of shape MxN in L2
+    @param[in]  pSrcB  points to the second input matrix of shape NxO in L2, it is copied to L1
+                       and must fit into it
+    @param[in]  M      height of the first matrix and of the output matrix
+    @param[in]  N      width of the first matrix and height of the second matrix
+    @param[in]  O      width of the second matrix and of the output matrix
+    @param[in]  nPE    number of cores to use for computation
+    @param[out] pDstC  points to the output matrix of shape MxO in L2
+    @return     none
+*/
+
+void plp_stream_mat_mult_f32(const float32_t *pSrcA,
+                             const float32_t *pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t nPE,
+                             float32_t *pDstC);
+
+/** -------------------------------------------------------
+    @brief      Team kernel of plp_stream_mat_mult_f32 for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stream_mat_mult_instance struct initialized by
+                      plp_stream_mat_mult_f32
+    @return     none
+*/
+
+void plp_stream_mat_mult_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for copying the elements of a 32-bit integer vector
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32(int32_t *__restrict__ pSrc, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32s_rv32im(int32_t *__restrict__ pSrc,
+                          int32_t *__restrict__ pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32s_xpulpv2(int32_t *__restrict__ pSrc,
+                           int32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for copying the elements of a 32-bit float vector
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_f32(float32_t *__restrict__ pSrc, float32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_f32s_xpulpv2(float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_f32s_rv32im(float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32_parallel(const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32s_xpulpv2(const float *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32_parallel(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16_parallel(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of an 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8_parallel(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel max value of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for max value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel max value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_i32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel max value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_i16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel max value of an 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_i8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel min value of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for min value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel min value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_i32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel min value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_i16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel min value of an 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_i8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_f32_parallel(const float32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Sum of squares of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_f32s_xpulpv2(const float *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16_parallel(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of an 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8_parallel(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares value returned here
+    @return     none
+*/
+
+void plp_power_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q32_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares value returned here
+    @return     none
+*/
+
+void plp_power_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16_parallel(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q8(const int8_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  uint32_t fracBits,
+                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of an 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q8_parallel(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit float vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
+    @brief      Sum of squares of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares value returned here
     @return     none
 */
 
-void plp_dot_prod_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
-                               const float32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               float32_t *__restrict__ pRes);
+void plp_power_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit float vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
+    @brief      Glue code for Statisical variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
     @return     none
 */
 
-void plp_dot_prod_f32s_rv32im(const float32_t *__restrict__ pSrcA,
-                               const float32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               float32_t *__restrict__ pRes);
+void plp_var_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
 
+/** -------------------------------------------------------
+    @brief      Glue code for parallel variance of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
+    @return     none
+
+    @par Numerical stability
+   Every core computes the mean and the sum of squared deviations of its part of the input, the
+   partial results are merged pairwise with the update of Chan et al. This avoids the cancellation
+   of E[x^2] - E[x]^2 used by plp_var_f32.
+*/
+
+void plp_var_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 16-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Kernel for Statisical variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
-    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+void plp_var_f32s_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
 */
-void plp_dot_prod_i16(const int16_t *pSrcA,
-                      const int16_t *pSrcB,
-                      uint32_t blockSize,
-                      int32_t *__restrict__ pRes);
+
+void plp_var_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Vectorized dot product of 16-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Glue code for parallel variance of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
     @return     none
+*/
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
-    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
-    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+void plp_var_q32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance value returned here
+    @return     none
 */
 
-void plp_dot_prod_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              int32_t *__restrict__ pRes);
+void plp_var_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Vectorized dot product of 16-bit integer vectors kernel singlecore for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Statisical variance of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance returned here
     @return     none
+*/
 
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
-    performed simultaneously on 32 bit vectors.
+void plp_var_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
 */
 
-void plp_dot_prod_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               int32_t *__restrict__ pRes);
+void plp_var_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 16-bit fixed point vectors.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Glue code for parallel variance of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
     @return     none
+*/
 
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
-    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+void plp_var_q16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
 */
 
-void plp_dot_prod_q16(const int16_t *__restrict__ pSrcA,
-                      const int16_t *__restrict__ pSrcB,
-                      uint32_t blockSize,
-                      uint32_t deciPoint,
-                      int32_t *__restrict__ pRes);
+void plp_var_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 16-bit fixed point vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Statisical variance of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel variance of an 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
+    @return     none
+*/
+
+void plp_var_q8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance value returned here
+    @return     none
+*/
+
+void plp_var_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
     @return     none
-
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
-    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
-    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
 */
 
-void plp_dot_prod_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              uint32_t deciPoint,
-                              int32_t *__restrict__ pRes);
+void plp_std_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Vectorized dot product of 16-bit fixed point vectors singlecore kernel for XPULPV2
-   extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Glue code for parallel standard deviation of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
     @return     none
-
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
-    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_dot_prod_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t deciPoint,
-                               int32_t *__restrict__ pRes);
+void plp_std_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 8-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
     @return     none
-
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_dot_prod_i8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t blockSize,
-                     int32_t *__restrict__ pRes);
+void plp_std_f32s_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Vectorized dot product of 8-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [8] bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
     @return     none
-
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
-    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
 */
 
-void plp_dot_prod_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t blockSize,
-                             int32_t *__restrict__ pRes);
+void plp_std_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Vectorized dot product of 8-bit integer vectors singlecore kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Glue code for parallel standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
     @return     none
-
-    @par Exploiting SIMD instructions
-    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
-    performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_dot_prod_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              int32_t *__restrict__ pRes);
+void plp_std_q32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 8-bit fixed point vectors.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation value returned here
     @return     none
-
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_dot_prod_q8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t blockSize,
-                     uint32_t deciPoint,
-                     int32_t *__restrict__ pRes);
+void plp_std_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 8-bit fixed point vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
     @return     none
-
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
-    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
 */
 
-void plp_dot_prod_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t blockSize,
-                             uint32_t deciPoint,
-                             int32_t *__restrict__ pRes);
+void plp_std_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 8-bit fixed point vectors singlecore kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
+    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
     @return     none
-
-    @par Exploiting SIMD instructions
-    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
-    performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_dot_prod_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              uint32_t deciPoint,
-                              int32_t *__restrict__ pRes);
+void plp_std_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Glue code for absolute value of 32-bit integer vectors.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+    @brief      Glue code for parallel standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
+    @return     none
 */
 
-void plp_abs_i32(const int32_t * pSrc,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_std_q16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Element-by-element absolute value of 32-bit integer vectors kernel for RV32IM extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_abs_i32s_rv32im(const int32_t * pSrc,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_std_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Element-by-element absolute value of 32-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_abs_i32s_xpulpv2(const int32_t * pSrc,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_std_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Glue code for absolute value of 16-bit integer vectors.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_abs_i16(const int16_t * pSrc,
-                 int16_t * pDst,
-                 uint32_t blockSize);
+void plp_std_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Element-by-element absolute value of 16-bit integer vectors kernel for RV32IM extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+    @brief      Glue code for parallel standard deviation of an 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
+    @return     none
 */
 
-void plp_abs_i16s_rv32im(const int16_t * pSrc,
-                         int16_t * pDst,
-                         uint32_t blockSize);
+void plp_std_q8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Element-by-element absolute value of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_abs_i16s_xpulpv2(const int16_t * pSrc,
-                          int16_t * pDst,
-                          uint32_t blockSize);
+void plp_std_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Glue code for absolute value of 8-bit integer vectors.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation value returned here
+    @return     none
 */
 
-void plp_abs_i8(const int8_t * pSrc,
-                 int8_t * pDst,
-                 uint32_t blockSize);
-
+void plp_std_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
 /** -------------------------------------------------------
-   @brief Element-by-element absolute value of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_abs_i8s_rv32im(const int8_t * pSrc,
-                         int8_t * pDst,
-                         uint32_t blockSize);
+void plp_rms_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Element-by-element absolute value of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+    @brief      Glue code for parallel mean of squares of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean of squares returned here
+    @return     none
 */
 
-void plp_abs_i8s_xpulpv2(const int8_t * pSrc,
-                          int8_t * pDst,
-                          uint32_t blockSize);
+void plp_rms_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element addition of 32-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_add_i32(const int32_t * pSrcA,
-                 const int32_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_rms_f32s_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_add_i32s_rv32im(const int32_t * pSrcA,
-                         const int32_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_rms_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Glue code for parallel mean of squares of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean of squares returned here
+    @return     none
 */
 
-void plp_add_i32s_xpulpv2(const int32_t * pSrcA,
-                          const int32_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_rms_q32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element addition of 16-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation value returned here
+    @return     none
 */
 
-void plp_add_i16(const int16_t * pSrcA,
-                 const int16_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_rms_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 16-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_add_i16s_rv32im(const int16_t * pSrcA,
-                         const int16_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_rms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 16-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_add_i16s_xpulpv2(const int16_t * pSrcA,
-                          const int16_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_rms_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element addition of 8-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Glue code for parallel mean of squares of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean of squares returned here
+    @return     none
+
+    @par Rounding
+   The squares are shifted per SIMD word as in plp_power_q16, the result may differ from
+   plp_rms_q16 by one LSB.
 */
 
-void plp_add_i8(const int8_t * pSrcA,
-                 const int8_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_rms_q16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 8-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_add_i8s_rv32im(const int8_t * pSrcA,
-                         const int8_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_rms_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 8-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_add_i8s_xpulpv2(const int8_t * pSrcA,
-                          const int8_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_rms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element multiplication of 32-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_mult_i32(const int32_t * pSrcA,
-                 const int32_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_rms_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+    @brief      Glue code for parallel mean of squares of an 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean of squares returned here
+    @return     none
 
-void plp_mult_i32s_rv32im(const int32_t * pSrcA,
-                         const int32_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+    @par Rounding
+   The squares are shifted per SIMD word as in plp_power_q8, the result may differ from
+   plp_rms_q8 by one LSB.
+*/
+
+void plp_rms_q8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_mult_i32s_xpulpv2(const int32_t * pSrcA,
-                          const int32_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_rms_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element multiplication of 16-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation value returned here
+    @return     none
 */
 
-void plp_mult_i16(const int16_t * pSrcA,
-                 const int16_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_rms_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 16-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Statistics of an integer vector from its raw moments, shared by the fused
+                statistics kernels.
+    @param[in]  blockSize  number of samples the moments were accumulated over (> 0)
+    @param[in]  sum        sum of the samples
+    @param[in]  sumSq      sum of the squared samples
+    @param[in]  min        minimum of the samples
+    @param[in]  max        maximum of the samples
+    @param[out] pRes       statistics returned here
+    @return     none
 */
 
-void plp_mult_i16s_rv32im(const int16_t * pSrcA,
-                         const int16_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_stats_moments_i32(uint32_t blockSize,
+                           int64_t sum,
+                           uint64_t sumSq,
+                           int32_t min,
+                           int32_t max,
+                           plp_stats_result *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 16-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Glue code for the fused statistics (mean, var, std, rms, min, max) of an 8-bit
+                integer vector, computed in a single pass.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       statistics returned here
+    @return     none
 */
 
-void plp_mult_i16s_xpulpv2(const int16_t * pSrcA,
-                          const int16_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_stats_i8(const int8_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  plp_stats_result *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element multiplication of 8-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Fused statistics of an 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       statistics returned here
+    @return     none
 */
 
-void plp_mult_i8(const int8_t * pSrcA,
-                 const int8_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_stats_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          plp_stats_result *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 8-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Fused statistics of an 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       statistics returned here
+    @return     none
 */
 
-void plp_mult_i8s_rv32im(const int8_t * pSrcA,
-                         const int8_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_stats_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           plp_stats_result *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 8-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Glue code for the fused statistics (mean, var, std, rms, min, max) of a 16-bit
+                integer vector, computed in a single pass.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       statistics returned here
+    @return     none
 */
 
-void plp_mult_i8s_xpulpv2(const int8_t * pSrcA,
-                          const int8_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_stats_i16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   plp_stats_result *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element multiplication of 32-bit float vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Fused statistics of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       statistics returned here
+    @return     none
 */
 
-void plp_mult_f32(const float32_t * pSrcA,
-                 const float32_t * pSrcB,
-                 float32_t * pDst,
-                 uint32_t blockSize);
+void plp_stats_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           plp_stats_result *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 32-bit float vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief      Fused statistics of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       statistics returned here
+    @return     none
 */
 
-void plp_mult_f32s_xpulpv2(const float32_t * pSrcA,
-                          const float32_t * pSrcB,
-                          float32_t * pDst,
-                          uint32_t blockSize);
-
-/**
-  @brief Glue code for parallel dot product of 32-bit float vectors.
-  @param[in]  pSrcA      points to the first input vector
-  @param[in]  pSrcB      points to the second input vector
-  @param[in]  blockSize  number of samples in each vector
-  @param[in]  nPE        number of parallel processing units
-  @param[out] pDst       points to output vector
-  @return        none
- */
+void plp_stats_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            plp_stats_result *__restrict__ pRes);
 
-void plp_mult_f32_parallel(const float32_t *__restrict__ pSrcA,
-                               const float32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t nPE,
-                               float32_t *__restrict__ pDst);
-/**
- *   @brief Parallel multiplication with interleaved access of 32-bit float vectors kernel for XPULPV2
- *     extension.
- *       @param[in]  S     points to the instance structure for float parallel multiplication
- *         @return        none
- *          */
+/** -------------------------------------------------------
+    @brief      Glue code for the fused statistics (mean, var, std, rms, min, max) of a 16-bit
+                fixed point vector, computed in a single pass.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[in]  fracBits   number of fractional bits of the input
+    @param[out] pRes       statistics returned here, all in the input format
+    @return     none
+*/
 
-void plp_mult_f32p_xpulpv2(void *S);
+void plp_stats_q16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   plp_stats_result *__restrict__ pRes);
 
-/**
-  @brief Glue code for parallel log of 32-bit float vectors.
-  @param[in]  pSrc       points to the input vector
-  @param[in]  blockSize  number of samples in each vector
-  @param[in]  nPE        number of parallel processing units
-  @param[out] pDst       points to output vector
-  @return        none
- */
+/** -------------------------------------------------------
+    @brief      Glue code for the fused statistics (mean, var, std, rms, min, max) of a 32-bit
+                floating point vector, computed in a single pass.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       statistics returned here
+    @return     none
+*/
 
-void plp_log_f32_parallel(const float32_t *__restrict__ pSrc,
-                               uint32_t blockSize,
-                               uint32_t nPE,
-                               float32_t *__restrict__ pDst);
+void plp_stats_f32(const float32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   plp_stats_result_f32 *__restrict__ pRes);
 
-/**
-  @brief Parallel log with interleaved access of 32-bit float vectors kernel for XPULPV2
-  extension.
-  @param[in]  S     points to the instance structure for float parallel log
-  @return        none
- */
+/** -------------------------------------------------------
+    @brief      Fused statistics of a 32-bit floating point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       statistics returned here
+    @return     none
+*/
 
-void plp_log_f32p_xpulpv2(void *S);
+void plp_stats_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            plp_stats_result_f32 *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code of negate the elements of a vector for 32-bit integers
-    @param[in]     pSrc       points to input vector.
-    @param[out]    pDst       points to output vector.
-    @param[in]     blockSize  number of samples in each vector.
+    @brief      Parallel partial statistics of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  S  points to the instance structure (plp_stats_instance_i32_parallel)
     @return     none
 */
 
-void plp_negate_i32(const int32_t * pSrc, int32_t * pDst, uint32_t blockSize);
+void plp_stats_i32p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-    @brief      negate the elements of a vector for 32-bit integers on RV32IM
-    @param[in]     pSrc       points to input vector.
-    @param[out]    pDst       points to output vector.
-    @param[in]     blockSize  number of samples in each vector.
+    @brief      Parallel partial statistics of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  S  points to the instance structure (plp_stats_instance_i16_parallel)
     @return     none
 */
 
-void plp_negate_i32s_rv32im(const int32_t * pSrc, int32_t * pDst, uint32_t blockSize);
+void plp_stats_i16p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-    @brief      negate the elements of a vector for 32-bit integers on XpulpV2
-    @param[in]     pSrc       points to input vector.
-    @param[out]    pDst       points to output vector.
-    @param[in]     blockSize  number of samples in each vector.
+    @brief      Parallel partial statistics of an 8-bit integer vector for XPULPV2 extension.
+    @param[in]  S  points to the instance structure (plp_stats_instance_i8_parallel)
     @return     none
 */
 
-void plp_negate_i32s_xpulpv2(const int32_t * pSrc, int32_t * pDst, uint32_t blockSize);
+void plp_stats_i8p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-  @brief      Glue code of negate the elements of a vector for 16-bit integers
-  @param[in]     pSrc       points to input vector.
-  @param[out]    pDst       points to output vector.
-  @param[in]     blockSize  number of samples in each vector.
-  @return     none
+    @brief      Parallel partial statistics of a 32-bit float vector for XPULPV2 extension.
+    @param[in]  S  points to the instance structure (plp_stats_instance_f32_parallel)
+    @return     none
 */
 
-void plp_negate_i16(const int16_t * pSrc, int16_t * pDst, uint32_t blockSize);
+void plp_stats_f32p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-  @brief      negate the elements of a vector for 16-bit integers on RV32IM
-  @param[in]     pSrc       points to input vector.
-  @param[out]    pDst       points to output vector.
-  @param[in]     blockSize  number of samples in each vector.
-  @return     none
+    @brief      Tree combine of the per-core partial integer statistics, called by every core of
+                the team.
+    @param[in,out] pPartial  per-core partial results, nPE entries
+    @param[in]  nPE        number of parallel processing units
+    @param[in]  flags      PLP_STATS_* flags of the quantities to combine
+    @return     none
 */
 
-void plp_negate_i16s_rv32im(const int16_t * pSrc, int16_t * pDst, uint32_t blockSize);
+void plp_stats_combine_i32p_xpulpv2(plp_stats_partial_i32 *__restrict__ pPartial,
+                                    uint32_t nPE,
+                                    uint32_t flags);
 
 /** -------------------------------------------------------
-  @brief      negate the elements of a vector for 16-bit integers on XpulpV2
-  @param[in]     pSrc       points to input vector.
-  @param[out]    pDst       points to output vector.
-  @param[in]     blockSize  number of samples in each vector.
-  @return     none
-
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+    @brief      Glue code for maximum value and index of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_negate_i16s_xpulpv2(const int16_t * pSrc, int16_t * pDst, uint32_t blockSize);
+void plp_argmax_i32(const int32_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    int32_t *__restrict__ pRes,
+                    uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      Glue code of negate the elements of a vector for 8-bit integers
-  @param[in]     pSrc       points to input vector.
-  @param[out]    pDst       points to output vector.
-  @param[in]     blockSize  number of samples in each vector.
-  @return     none
+    @brief      ArgMax of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_negate_i8(const int8_t * pSrc, int8_t * pDst, uint32_t blockSize);
+void plp_argmax_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      negate the elements of a vector for 8-bit integers on RV32IM
-  @param[in]     pSrc       points to input vector.
-  @param[out]    pDst       points to output vector.
-  @param[in]     blockSize  number of samples in each vector.
-  @return     none
+    @brief      ArgMax of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_negate_i8s_rv32im(const int8_t * pSrc, int8_t * pDst, uint32_t blockSize);
+void plp_argmax_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      negate the elements of a vector for 8-bit integers on XpulpV2
-  @param[in]     pSrc       points to input vector.
-  @param[out]    pDst       points to output vector.
-  @param[in]     blockSize  number of samples in each vector.
-  @return     none
-
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+    @brief      Glue code for parallel maximum value and index of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_negate_i8s_xpulpv2(const int8_t * pSrc, int8_t * pDst, uint32_t blockSize);
+void plp_argmax_i32_parallel(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int32_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-    @brief      Glue code of negate the elements of a vector for 32-bit floats
-    @param[in]     pSrc       points to input vector.
-    @param[out]    pDst       points to output vector.
-    @param[in]     blockSize  number of samples in each vector.
+    @brief      Parallel maximum value and index of a 32-bit integer vector for XPULPV2
+                extension.
+    @param[in]  S  points to the instance structure (plp_arg_instance_i32_parallel)
     @return     none
 */
 
-void plp_negate_f32(const float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+void plp_argmax_i32p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-    @brief      negate the elements of a vector for 32-bit floats on XpulpV2
-    @param[in]     pSrc       points to input vector.
-    @param[out]    pDst       points to output vector.
-    @param[in]     blockSize  number of samples in each vector.
+    @brief      Glue code for maximum value and index of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
     @return     none
 */
 
-void plp_negate_f32s_xpulpv2(const float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+void plp_argmax_i16(const int16_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    int16_t *__restrict__ pRes,
+                    uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      Glue code of add a constant offset to a vector for 32-bit integers
-  @param[in]     pSrc       points to the input vector
-  @param[in]     offset     is the offset to be added
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      ArgMax of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_offset_i32(const int32_t * pSrc, int32_t offset, int32_t * pDst, uint32_t blockSize);
+void plp_argmax_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int16_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      add a constant offset to a vector for 32-bit integers on RV32IM
-  @param[in]     pSrc       points to the input vector
-  @param[in]     offset     is the offset to be added
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      ArgMax of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_offset_i32s_rv32im(const int32_t * pSrc, int32_t offset, int32_t * pDst, uint32_t blockSize);
+void plp_argmax_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      add a constant offset to a vector for 32-bit integers on XpulpV2
-  @param[in]     pSrc       points to the input vector
-  @param[in]     offset     is the offset to be added
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Glue code for parallel maximum value and index of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_offset_i32s_xpulpv2(const int32_t * pSrc, int32_t offset, int32_t * pDst, uint32_t blockSize);
+void plp_argmax_i16_parallel(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int16_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      Glue code of add a constant offset to a vector for 16-bit integers
-  @param[in]     pSrc       points to the input vector
-  @param[in]     offset     is the offset to be added
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Parallel maximum value and index of a 16-bit integer vector for XPULPV2
+                extension.
+    @param[in]  S  points to the instance structure (plp_arg_instance_i16_parallel)
+    @return     none
 */
 
-void plp_offset_i16(const int16_t * pSrc, int16_t offset, int16_t * pDst, uint32_t blockSize);
+void plp_argmax_i16p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-  @brief      add a constant offset to a vector for 16-bit integers on RV32IM
-  @param[in]     pSrc       points to the input vector
-  @param[in]     offset     is the offset to be added
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Glue code for maximum value and index of an 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_offset_i16s_rv32im(const int16_t * pSrc, int16_t offset, int16_t * pDst, uint32_t blockSize);
+void plp_argmax_i8(const int8_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int8_t *__restrict__ pRes,
+                   uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      add a constant offset to a vector for 16-bit integers on XpulpV2
-  @param[in]     pSrc       points to the input vector
-  @param[in]     offset     is the offset to be added
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
-
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+    @brief      ArgMax of an 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_offset_i16s_xpulpv2(const int16_t * pSrc, int16_t offset, int16_t * pDst, uint32_t blockSize);
+void plp_argmax_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int8_t *__restrict__ pRes,
+                           uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      Glue code of add a constant offset to a vector for 8-bit integers
-  @param[in]     pSrc       points to the input vector
-  @param[in]     offset     is the offset to be added
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      ArgMax of an 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_offset_i8(const int8_t * pSrc, int8_t offset, int8_t * pDst, uint32_t blockSize);
+void plp_argmax_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int8_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      add a constant offset to a vector for 8-bit integers on RV32IM
-  @param[in]     pSrc       points to the input vector
-  @param[in]     offset     is the offset to be added
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Glue code for parallel maximum value and index of an 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_offset_i8s_rv32im(const int8_t * pSrc, int8_t offset, int8_t * pDst, uint32_t blockSize);
+void plp_argmax_i8_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            int8_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      add a constant offset to a vector for 8-bit integers on XpulpV2
-  @param[in]     pSrc       points to the input vector
-  @param[in]     offset     is the offset to be added
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
-
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+    @brief      Parallel maximum value and index of an 8-bit integer vector for XPULPV2
+                extension.
+    @param[in]  S  points to the instance structure (plp_arg_instance_i8_parallel)
+    @return     none
 */
 
-void plp_offset_i8s_xpulpv2(const int8_t * pSrc, int8_t offset, int8_t * pDst, uint32_t blockSize);
+void plp_argmax_i8p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-  @brief      Glue code of add a constant offset to a vector for 32-bit floats
-  @param[in]     pSrc       points to the input vector
-  @param[in]     offset     is the offset to be added
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Glue code for maximum value and index of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_offset_f32(const float32_t * pSrc, float32_t offset, float32_t * pDst, uint32_t blockSize);
+void plp_argmax_f32(const float32_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    float32_t *__restrict__ pRes,
+                    uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      add a constant offset to a vector for 32-bit floats on XpulpV2
-  @param[in]     pSrc       points to the input vector
-  @param[in]     offset     is the offset to be added
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      ArgMax of a 32-bit floating point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_offset_f32s_xpulpv2(const float32_t * pSrc, float32_t offset, float32_t * pDst, uint32_t blockSize);
+void plp_argmax_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             float32_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      Glue code of vector substraction for 32-bit integers
-  @param[in]     pSrcA      points to the first input vector
-  @param[in]     pSrcB      points to the second input vector
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Glue code for parallel maximum value and index of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       maximum value returned here
+    @param[out] pIndex     index of the first occurrence of the maximum returned here
+    @return     none
 */
 
-void plp_sub_i32(const int32_t * pSrcA, const int32_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+void plp_argmax_f32_parallel(const float32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             float32_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      vector substraction for 32-bit integers on RV32IM
-  @param[in]     pSrcA      points to the first input vector
-  @param[in]     pSrcB      points to the second input vector
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Parallel maximum value and index of a 32-bit floating point vector for XPULPV2
+                extension.
+    @param[in]  S  points to the instance structure (plp_arg_instance_f32_parallel)
+    @return     none
 */
 
-void plp_sub_i32s_rv32im(const int32_t * pSrcA, const int32_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+void plp_argmax_f32p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-  @brief      vector substraction for 32-bit integers on XpulpV2
-  @param[in]     pSrcA      points to the first input vector
-  @param[in]     pSrcB      points to the second input vector
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Glue code for minimum value and index of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_sub_i32s_xpulpv2(const int32_t * pSrcA, const int32_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+void plp_argmin_i32(const int32_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    int32_t *__restrict__ pRes,
+                    uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      Glue code of vector substraction for 16-bit integers
-  @param[in]     pSrcA      points to the first input vector
-  @param[in]     pSrcB      points to the second input vector
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      ArgMin of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_sub_i16(const int16_t * pSrcA, const int16_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+void plp_argmin_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      vector substraction for 16-bit integers on RV32IM
-  @param[in]     pSrcA      points to the first input vector
-  @param[in]     pSrcB      points to the second input vector
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      ArgMin of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_sub_i16s_rv32im(const int16_t * pSrcA, const int16_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+void plp_argmin_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      vector substraction for 16-bit integers on XpulpV2
-  @param[in]     pSrcA      points to the first input vector
-  @param[in]     pSrcB      points to the second input vector
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
-
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+    @brief      Glue code for parallel minimum value and index of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_sub_i16s_xpulpv2(const int16_t * pSrcA, const int16_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+void plp_argmin_i32_parallel(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int32_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      Glue code of vector substraction for 8-bit integers
-  @param[in]     pSrcA      points to the first input vector
-  @param[in]     pSrcB      points to the second input vector
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Parallel minimum value and index of a 32-bit integer vector for XPULPV2
+                extension.
+    @param[in]  S  points to the instance structure (plp_arg_instance_i32_parallel)
+    @return     none
 */
 
-void plp_sub_i8(const int8_t * pSrcA, const int8_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+void plp_argmin_i32p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-  @brief      vector substraction for 8-bit integers on RV32IM
-  @param[in]     pSrcA      points to the first input vector
-  @param[in]     pSrcB      points to the second input vector
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Glue code for minimum value and index of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_sub_i8s_rv32im(const int8_t * pSrcA, const int8_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+void plp_argmin_i16(const int16_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    int16_t *__restrict__ pRes,
+                    uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      vector substraction for 8-bit integers on XpulpV2
-  @param[in]     pSrcA      points to the first input vector
-  @param[in]     pSrcB      points to the second input vector
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      ArgMin of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
+*/
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+void plp_argmin_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int16_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex);
+
+/** -------------------------------------------------------
+    @brief      ArgMin of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_sub_i8s_xpulpv2(const int8_t * pSrcA, const int8_t * pSrcB, int32_t * pDst, uint32_t blockSize);
+void plp_argmin_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      Glue code of vector substraction for 32-bit floats
-  @param[in]     pSrcA      points to the first input vector
-  @param[in]     pSrcB      points to the second input vector
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Glue code for parallel minimum value and index of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_sub_f32(const float32_t * pSrcA, const float32_t * pSrcB, float32_t * pDst, uint32_t blockSize);
+void plp_argmin_i16_parallel(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int16_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      vector substraction for 32-bit floats on XpulpV2
-  @param[in]     pSrcA      points to the first input vector
-  @param[in]     pSrcB      points to the second input vector
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Parallel minimum value and index of a 16-bit integer vector for XPULPV2
+                extension.
+    @param[in]  S  points to the instance structure (plp_arg_instance_i16_parallel)
+    @return     none
 */
 
-void plp_sub_f32s_xpulpv2(const float32_t * pSrcA, const float32_t * pSrcB, float32_t * pDst, uint32_t blockSize);
+void plp_argmin_i16p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-  @brief      Glue code of multiply a vector by a scalar for 32-bit integers
-  @param[in]     pSrc       points to the input vector
-  @param[in]     scaleFactor Factor to multiply all elements before shifting
-  @param[in]     shift      number of bits to shift the result by
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Glue code for minimum value and index of an 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_scale_i32(const int32_t *__restrict__ pSrc, int32_t scaleFactor, int32_t shift, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_argmin_i8(const int8_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int8_t *__restrict__ pRes,
+                   uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      multiply a vector by a scalar for 32-bit integers on RV32IM
-  @param[in]     pSrc       points to the input vector
-  @param[in]     scaleFactor Factor to multiply all elements before shifting
-  @param[in]     shift      number of bits to shift the result by
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      ArgMin of an 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_scale_i32s_rv32im(const int32_t *__restrict__ pSrc, int32_t scaleFactor, int32_t shift, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_argmin_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int8_t *__restrict__ pRes,
+                           uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      multiply a vector by a scalar for 32-bit integers on XpulpV2
-  @param[in]     pSrc       points to the input vector
-  @param[in]     scaleFactor Factor to multiply all elements before shifting
-  @param[in]     shift      number of bits to shift the result by
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      ArgMin of an 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_scale_i32s_xpulpv2(const int32_t *__restrict__ pSrc, int32_t scaleFactor, int32_t shift, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_argmin_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int8_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      Glue code of multiply a vector by a scalar for 16-bit integers
-  @param[in]     pSrc       points to the input vector
-  @param[in]     scaleFactor Factor to multiply all elements before shifting
-  @param[in]     shift      number of bits to shift the result by
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Glue code for parallel minimum value and index of an 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_scale_i16(const int16_t *__restrict__ pSrc, int16_t scaleFactor, int32_t shift, int16_t *__restrict__ pDst, uint32_t blockSize);
+void plp_argmin_i8_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            int8_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      multiply a vector by a scalar for 16-bit integers on RV32IM
-  @param[in]     pSrc       points to the input vector
-  @param[in]     scaleFactor Factor to multiply all elements before shifting
-  @param[in]     shift      number of bits to shift the result by
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Parallel minimum value and index of an 8-bit integer vector for XPULPV2
+                extension.
+    @param[in]  S  points to the instance structure (plp_arg_instance_i8_parallel)
+    @return     none
 */
 
-void plp_scale_i16s_rv32im(const int16_t *__restrict__ pSrc, int16_t scaleFactor, int32_t shift, int16_t *__restrict__ pDst, uint32_t blockSize);
+void plp_argmin_i8p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-  @brief      multiply a vector by a scalar for 16-bit integers on XpulpV2
-  @param[in]     pSrc       points to the input vector
-  @param[in]     scaleFactor Factor to multiply all elements before shifting
-  @param[in]     shift      number of bits to shift the result by
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
-
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+    @brief      Glue code for minimum value and index of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_scale_i16s_xpulpv2(const int16_t *__restrict__ pSrc, int16_t scaleFactor, int32_t shift, int16_t *__restrict__ pDst, uint32_t blockSize);
+void plp_argmin_f32(const float32_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    float32_t *__restrict__ pRes,
+                    uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      Glue code of multiply a vector by a scalar for 8-bit integers
-  @param[in]     pSrc       points to the input vector
-  @param[in]     scaleFactor Factor to multiply all elements before shifting
-  @param[in]     shift      number of bits to shift the result by
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      ArgMin of a 32-bit floating point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_scale_i8(const int8_t *__restrict__ pSrc, int8_t scaleFactor, int32_t shift, int8_t *__restrict__ pDst, uint32_t blockSize);
+void plp_argmin_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             float32_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      multiply a vector by a scalar for 8-bit integers on RV32IM
-  @param[in]     pSrc       points to the input vector
-  @param[in]     scaleFactor Factor to multiply all elements before shifting
-  @param[in]     shift      number of bits to shift the result by
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Glue code for parallel minimum value and index of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector (> 0)
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       minimum value returned here
+    @param[out] pIndex     index of the first occurrence of the minimum returned here
+    @return     none
 */
 
-void plp_scale_i8s_rv32im(const int8_t *__restrict__ pSrc, int8_t scaleFactor, int32_t shift, int8_t *__restrict__ pDst, uint32_t blockSize);
+void plp_argmin_f32_parallel(const float32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             float32_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex);
 
 /** -------------------------------------------------------
-  @brief      multiply a vector by a scalar for 8-bit integers on XpulpV2
-  @param[in]     pSrc       points to the input vector
-  @param[in]     scaleFactor Factor to multiply all elements before shifting
-  @param[in]     shift      number of bits to shift the result by
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
-
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+    @brief      Parallel minimum value and index of a 32-bit floating point vector for XPULPV2
+                extension.
+    @param[in]  S  points to the instance structure (plp_arg_instance_f32_parallel)
+    @return     none
 */
 
-void plp_scale_i8s_xpulpv2(const int8_t *__restrict__ pSrc, int8_t scaleFactor, int32_t shift, int8_t *__restrict__ pDst, uint32_t blockSize);
+void plp_argmin_f32p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-  @brief      Glue code of multiply a vector by a scalar for 32-bit floats
-  @param[in]     pSrc       points to the input vector
-  @param[in]     scaleFactor Factor to multiply all elements before shifting
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Tree combine of the per-core partial arg-max / arg-min results, called by every
+                core of the team.
+    @param[in,out] pPartial  per-core partial results, nPE entries
+    @param[in]  nPE        number of parallel processing units
+    @param[in]  isMax      1 to combine maxima, 0 to combine minima
+    @return     none
 */
 
-void plp_scale_f32(const float32_t *__restrict__ pSrc, float32_t scaleFactor, float32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_arg_combine_i32p_xpulpv2(plp_arg_partial_i32 *__restrict__ pPartial,
+                                  uint32_t nPE,
+                                  uint32_t isMax);
 
 /** -------------------------------------------------------
-  @brief      multiply a vector by a scalar for 32-bit floats on XpulpV2
-  @param[in]     pSrc       points to the input vector
-  @param[in]     scaleFactor Factor to multiply all elements before shifting
-  @param[out]    pDst       points to the output vector
-  @param[in]     blockSize  number of samples in each vector
-  @return     none
+    @brief      Tree combine of the per-core partial arg-max / arg-min results, called by every
+                core of the team.
+    @param[in,out] pPartial  per-core partial results, nPE entries
+    @param[in]  nPE        number of parallel processing units
+    @param[in]  isMax      1 to combine maxima, 0 to combine minima
+    @return     none
 */
 
-void plp_scale_f32s_xpulpv2(const float32_t *__restrict__ pSrc, float32_t scaleFactor, float32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_arg_combine_f32p_xpulpv2(plp_arg_partial_f32 *__restrict__ pPartial,
+                                  uint32_t nPE,
+                                  uint32_t isMax);
 
 /** -------------------------------------------------------
-    @brief      Glue code for filling a constant value into a 32-bit integer vector.
-    @param[in]  value      input value to be filled
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
+    @brief      Glue code for square root of a 32-bit fixed point number.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
     @return     none
 */
 
-void plp_fill_i32(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_sqrt_q32(const int32_t *__restrict__ pSrc,
+                  const uint32_t fracBits,
+                  int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Fills a constant value into a 32-bit integer vector for RV32IM extension.
-    @param[in]  value      input value to be filled
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
+    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
     @return     none
 */
 
-void plp_fill_i32s_rv32im(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_sqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                          const uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Fills a constant value into a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  value      input value to be filled
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
+    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
     @return     none
 */
 
-void plp_fill_i32s_xpulpv2(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_sqrt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for copying the elements of a 32-bit integer vector
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
+    @brief      Glue code for square root of a 16-bit fixed point number.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
     @return     none
 */
 
-void plp_copy_i32(int32_t *__restrict__ pSrc, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_sqrt_q16(const int16_t *__restrict__ pSrc,
+                  const uint32_t fracBits,
+                  int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Copies the elements of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
+    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
     @return     none
 */
 
-void plp_copy_i32s_rv32im(int32_t *__restrict__ pSrc,
-                          int32_t *__restrict__ pDst,
-                          uint32_t blockSize);
+void plp_sqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                          const uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
+    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
     @return     none
 */
 
-void plp_copy_i32s_xpulpv2(int32_t *__restrict__ pSrc,
-                           int32_t *__restrict__ pDst,
-                           uint32_t blockSize);
+void plp_sqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int16_t *__restrict__ pRes);
+
+
+/**
+   @brief         Glue code for square root of a 32-bit floating point number.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pRes    Square root returned here
+   @return        none
+ */
+
+void plp_sqrt_f32(const float *__restrict__ pSrc, 
+                  float *__restrict__ pRes);
+
+
+/**
+   @brief         Kernel for square root of a 32-bit floating point number.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pRes    Square root returned here
+   @return        none
+ */
+void plp_sqrt_f32s_xpulpv2(const float *__restrict__ pSrc,
+                           float *__restrict__ pRes);
+
+
+/**
+   @brief         Glue code for square root of a 32-bit floating point number.
+   @param[in]     pSrc       points to the input vectoro
+   @param[out]    pRes    Square root returned here
+   @return        none
+ */
+
+
+/**
+ * @brief Macros required for SINE and COSINE Fast math approximations
+ */
+
+#define FAST_MATH_TABLE_SIZE 512
+#define FAST_MATH_Q32_SHIFT (32 - 10)
+#define FAST_MATH_Q16_SHIFT (16 - 10)
+#define CONTROLLER_Q32_SHIFT (32 - 9)
+#define TABLE_SPACING_Q32 0x400000
+#define TABLE_SPACING_Q16 0x80
+
+/**
+ * @brief Size of the tables of the fixed point logarithm and exponential
+ */
+
+#define FAST_MATH_LOG_TABLE_SIZE 64
+
+/**
+ * @brief      Glue code for q32 cosine function
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int32_t plp_cos_q32(int32_t x);
+
+/**
+ * @brief      q32 cosine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int32_t plp_cos_q32s_rv32im(int32_t x);
 
-/** -------------------------------------------------------
-    @brief      Glue code for copying the elements of a 32-bit float vector
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+/**
+ * @brief      q32 cosine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
 
-void plp_copy_f32(float32_t *__restrict__ pSrc, float32_t *__restrict__ pDst, uint32_t blockSize);
+int32_t plp_cos_q32s_xpulpv2(int32_t x);
 
-/** -------------------------------------------------------
-    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+/**
+ * @brief      Glue code for q16 cosine function
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
 
-void plp_copy_f32s_xpulpv2(float32_t *__restrict__ pSrc,
-                           float32_t *__restrict__ pDst,
-                           uint32_t blockSize);
+int16_t plp_cos_q16(int16_t x);
 
-/** -------------------------------------------------------
-    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+/**
+ * @brief      q16 cosine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
 
-void plp_copy_f32s_rv32im(float32_t *__restrict__ pSrc,
-                           float32_t *__restrict__ pDst,
-                           uint32_t blockSize);
+int16_t plp_cos_q16s_rv32im(int16_t x);
 
-/** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+/**
+ * @brief      q16 cosine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
 
-void plp_mean_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+int16_t plp_cos_q16s_xpulpv2(int16_t x);
 
-/** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+/**
+ * @brief      Glue code for f32 cosine function
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     cos(x)
+ */
 
-void plp_mean_f32s_xpulpv2(const float *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           float *__restrict__ pRes);
+float32_t plp_cos_f32(float32_t x);
 
-/** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+/**
+ * @brief      F32 cosine function for XPULPV2
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     cos(x)
+ */
 
-void plp_mean_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+float32_t plp_cos_f32s_xpulpv2(float32_t x);
 
-/** -------------------------------------------------------
-    @brief      Mean value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+/**
+ * @brief      Glue code for q32 sine function
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
 
-void plp_mean_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+int32_t plp_sin_q32(int32_t x);
 
-/** -------------------------------------------------------
-    @brief      Mean value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
-    @return     none
-*/
+/**
+ * @brief      q32 sine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
 
-void plp_mean_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+int32_t plp_sin_q32s_rv32im(int32_t x);
 
-/** -------------------------------------------------------
-    @brief      Glue code for mean value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+/**
+ * @brief      q32 sine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
 
-void plp_mean_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+int32_t plp_sin_q32s_xpulpv2(int32_t x);
 
-/** -------------------------------------------------------
-    @brief      Mean value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+/**
+ * @brief      Glue code for q16 sine function
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
 
-void plp_mean_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+int16_t plp_sin_q16(int16_t x);
 
-/** -------------------------------------------------------
-    @brief      Mean value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
-    @return     none
-*/
+/**
+ * @brief      q16 sine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
 
-void plp_mean_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int16_t *__restrict__ pRes);
+int16_t plp_sin_q16s_rv32im(int16_t x);
 
-/** -------------------------------------------------------
-    @brief      Glue code for mean value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+/**
+ * @brief      q16 sine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
 
-void plp_mean_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+int16_t plp_sin_q16s_xpulpv2(int16_t x);
 
-/** -------------------------------------------------------
-    @brief      Mean value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+/**
+ * @brief      Glue code for f32 sine function
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     sin(x)
+ */
 
-void plp_mean_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+float32_t plp_sin_f32(float32_t x);
 
-/** -------------------------------------------------------
-    @brief      Mean value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
-    @return     none
-*/
+/**
+ * @brief      F32 sine function for XPULPV2
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     sin(x)
+ */
 
-void plp_mean_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int8_t *__restrict__ pRes);
+float32_t plp_sin_f32s_xpulpv2(float32_t x);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
+    @brief Glue code for element-wise sine of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, Q1.15 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_max_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_vsin_q16(const int16_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Kernel for max value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
+    @brief Glue code for parallel element-wise sine of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, Q1.15 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_max_f32s_xpulpv2(const float *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          float *__restrict__ pRes);
+void plp_vsin_q16_parallel(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
+    @brief Element-wise sine of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector, Q1.15 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_max_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_vsin_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
+    @brief Element-wise sine of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, Q1.15 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_max_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int32_t *__restrict__ pRes);
+void plp_vsin_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
+    @brief Parallel element-wise sine of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  points to the plp_vfast_math_instance_q16 structure
     @return     none
 */
 
-void plp_max_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_vsin_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
+    @brief Glue code for element-wise sine of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, Q1.31 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_max_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+void plp_vsin_q32(const int32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
+    @brief Glue code for parallel element-wise sine of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, Q1.31 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_max_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int16_t *__restrict__ pRes);
+void plp_vsin_q32_parallel(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
+    @brief Element-wise sine of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector, Q1.31 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_max_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+void plp_vsin_q32s_rv32im(const int32_t *__restrict__ pSrc,
                           uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+                          int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
+    @brief Element-wise sine of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, Q1.31 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_max_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+void plp_vsin_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
+    @brief Parallel element-wise sine of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  points to the plp_vfast_math_instance_q32 structure
     @return     none
 */
 
-void plp_max_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        int8_t *__restrict__ pRes);
+void plp_vsin_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
+    @brief Glue code for element-wise sine of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector, angles in radians
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_max_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+void plp_vsin_f32(const float32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
+    @brief Glue code for parallel element-wise sine of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector, angles in radians
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_min_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_vsin_f32_parallel(const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Kernel for min value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
+    @brief Element-wise sine of a 32-bit floating point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, angles in radians
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_min_f32s_xpulpv2(const float *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          float *__restrict__ pRes);
+void plp_vsin_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
+    @brief Parallel element-wise sine of a 32-bit floating point vector for XPULPV2 extension.
+    @param[in]  args  points to the plp_vfast_math_instance_f32 structure
     @return     none
 */
 
-void plp_min_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_vsin_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
+    @brief Glue code for element-wise cosine of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, Q1.15 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_min_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int32_t *__restrict__ pRes);
+void plp_vcos_q16(const int16_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
+    @brief Glue code for parallel element-wise cosine of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, Q1.15 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_min_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_vcos_q16_parallel(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
+    @brief Element-wise cosine of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector, Q1.15 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_min_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+void plp_vcos_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
+    @brief Element-wise cosine of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, Q1.15 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_min_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int16_t *__restrict__ pRes);
+void plp_vcos_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
+    @brief Parallel element-wise cosine of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  points to the plp_vfast_math_instance_q16 structure
     @return     none
 */
 
-void plp_min_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+void plp_vcos_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
+    @brief Glue code for element-wise cosine of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, Q1.31 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_min_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+void plp_vcos_q32(const int32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
+    @brief Glue code for parallel element-wise cosine of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, Q1.31 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_min_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        int8_t *__restrict__ pRes);
+void plp_vcos_q32_parallel(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
+    @brief Element-wise cosine of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector, Q1.31 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_min_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+void plp_vcos_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @brief Element-wise cosine of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, Q1.31 values in [-1, 1)
+                           mapped to [-2*PI, 2*PI)
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_vcos_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Sum of squares of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @brief Parallel element-wise cosine of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  points to the plp_vfast_math_instance_q32 structure
     @return     none
 */
 
-void plp_power_f32s_xpulpv2(const float *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           float *__restrict__ pRes);
+void plp_vcos_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @brief Glue code for element-wise cosine of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector, angles in radians
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_i32(const int32_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   int32_t *__restrict__ pRes);
+void plp_vcos_f32(const float32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @brief Glue code for parallel element-wise cosine of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector, angles in radians
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_i32s_rv32im(const int32_t *__restrict__ pSrc,
+void plp_vcos_f32_parallel(const float32_t *__restrict__ pSrc,
                            uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+                           uint32_t nPE,
+                           float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares returned here
+    @brief Element-wise cosine of a 32-bit floating point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, angles in radians
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            int32_t *__restrict__ pRes);
+void plp_vcos_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @brief Parallel element-wise cosine of a 32-bit floating point vector for XPULPV2 extension.
+    @param[in]  args  points to the plp_vfast_math_instance_f32 structure
     @return     none
 */
 
-void plp_power_i16(const int16_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   int32_t *__restrict__ pRes);
+void plp_vcos_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @brief Glue code for element-wise square root of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+void plp_vsqrt_q16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares returned here
+    @brief Glue code for parallel element-wise square root of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+void plp_vsqrt_q16_parallel(const int16_t *__restrict__ pSrc,
                             uint32_t blockSize,
-                            int32_t *__restrict__ pRes);
+                            uint32_t fracBits,
+                            uint32_t nPE,
+                            int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @brief Element-wise square root of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_vsqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @brief Element-wise square root of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_vsqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares value returned here
+    @brief Parallel element-wise square root of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  points to the plp_vfast_math_instance_q16 structure
     @return     none
 */
 
-void plp_power_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
-
+void plp_vsqrt_q16p_xpulpv2(void *args);
+
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @brief Glue code for element-wise square root of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_q32(const int32_t *__restrict__ pSrc,
+void plp_vsqrt_q32(const int32_t *__restrict__ pSrc,
                    uint32_t blockSize,
                    uint32_t fracBits,
-                   int32_t *__restrict__ pRes);
+                   int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares value returned here
+    @brief Glue code for parallel element-wise square root of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_q32s_rv32im(const int32_t *__restrict__ pSrc,
+void plp_vsqrt_q32_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief Element-wise square root of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector
+    @return     none
+*/
+
+void plp_vsqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
                            uint32_t blockSize,
                            uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+                           int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares returned here
+    @brief Element-wise square root of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+void plp_vsqrt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
                             uint32_t blockSize,
                             uint32_t fracBits,
-                            int32_t *__restrict__ pRes);
+                            int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 16-bit fixed point vector.
+    @brief Parallel element-wise square root of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  points to the plp_vfast_math_instance_q32 structure
+    @return     none
+*/
+
+void plp_vsqrt_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-wise square root of a 32-bit floating point vector.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_q16(const int16_t *__restrict__ pSrc,
+void plp_vsqrt_f32(const float32_t *__restrict__ pSrc,
                    uint32_t blockSize,
-                   uint32_t fracBits,
-                   int32_t *__restrict__ pRes);
+                   float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit fixed point vector for RV32IM extension.
+    @brief Glue code for parallel element-wise square root of a 32-bit floating point vector.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+void plp_vsqrt_f32_parallel(const float32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit fixed point vector for XPULPV2 extension.
+    @brief Element-wise square root of a 32-bit floating point vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector
     @return     none
 */
 
-void plp_power_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+void plp_vsqrt_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
                             uint32_t blockSize,
-                            uint32_t fracBits,
-                            int32_t *__restrict__ pRes);
+                            float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 8-bit fixed point vector.
+    @brief Parallel element-wise square root of a 32-bit floating point vector for XPULPV2 extension.
+    @param[in]  args  points to the plp_vfast_math_instance_f32 structure
+    @return     none
+*/
+
+void plp_vsqrt_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-wise natural logarithm of a 32-bit floating point vector.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_power_q8(const int8_t *__restrict__ pSrc,
+void plp_vlog_f32(const float32_t *pSrc,
                   uint32_t blockSize,
-                  uint32_t fracBits,
-                  int32_t *__restrict__ pRes);
+                  float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit fixed point vector for RV32IM extension.
+    @brief Glue code for parallel element-wise natural logarithm of a 32-bit floating point vector.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_power_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+void plp_vlog_f32_parallel(const float32_t *pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit fixed point vector for XPULPV2 extension.
+    @brief Element-wise natural logarithm of a 32-bit floating point vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares value returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_power_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+void plp_vlog_f32s_xpulpv2(const float32_t *pSrc,
                            uint32_t blockSize,
-                           uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+                           float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @brief Parallel element-wise natural logarithm of a 32-bit floating point vector for XPULPV2
+           extension.
+    @param[in]  args  points to the plp_vfast_math_instance_f32 structure
     @return     none
 */
 
-void plp_var_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_vlog_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Statisical variance of a 32-bit float vector.
+    @brief Glue code for element-wise base-2 logarithm of a 32-bit floating point vector.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_var_f32s_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_vlog2_f32(const float32_t *pSrc,
+                   uint32_t blockSize,
+                   float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 32-bit fixed point vector.
+    @brief Glue code for parallel element-wise base-2 logarithm of a 32-bit floating point vector.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_var_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+void plp_vlog2_f32_parallel(const float32_t *pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 32-bit fixed point vector for RV32IM extension.
+    @brief Element-wise base-2 logarithm of a 32-bit floating point vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance value returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_var_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int32_t *__restrict__ pRes);
+void plp_vlog2_f32s_xpulpv2(const float32_t *pSrc,
+                            uint32_t blockSize,
+                            float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 32-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance returned here
+    @brief Parallel element-wise base-2 logarithm of a 32-bit floating point vector for XPULPV2
+           extension.
+    @param[in]  args  points to the plp_vfast_math_instance_f32 structure
     @return     none
 */
 
-void plp_var_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+void plp_vlog2_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 16-bit fixed point vector.
+    @brief Glue code for element-wise base-10 logarithm of a 32-bit floating point vector.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_var_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_vlog10_f32(const float32_t *pSrc,
+                    uint32_t blockSize,
+                    float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 16-bit fixed point vector for RV32IM extension.
+    @brief Glue code for parallel element-wise base-10 logarithm of a 32-bit floating point vector.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_var_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int16_t *__restrict__ pRes);
+void plp_vlog10_f32_parallel(const float32_t *pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 16-bit fixed point vector for XPULPV2 extension.
+    @brief Element-wise base-10 logarithm of a 32-bit floating point vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_var_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+void plp_vlog10_f32s_xpulpv2(const float32_t *pSrc,
+                             uint32_t blockSize,
+                             float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 8-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @brief Parallel element-wise base-10 logarithm of a 32-bit floating point vector for XPULPV2
+           extension.
+    @param[in]  args  points to the plp_vfast_math_instance_f32 structure
     @return     none
 */
 
-void plp_var_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_vlog10_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 8-bit fixed point vector for RV32IM extension.
+    @brief Glue code for element-wise exponential of a 32-bit floating point vector.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_var_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        uint32_t fracBits,
-                        int8_t *__restrict__ pRes);
+void plp_vexp_f32(const float32_t *pSrc,
+                  uint32_t blockSize,
+                  float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 8-bit fixed point vector for XPULPV2 extension.
+    @brief Glue code for parallel element-wise exponential of a 32-bit floating point vector.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance value returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_var_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int8_t *__restrict__ pRes);
+void plp_vexp_f32_parallel(const float32_t *pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @brief Element-wise exponential of a 32-bit floating point vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_std_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_vexp_f32s_xpulpv2(const float32_t *pSrc,
+                           uint32_t blockSize,
+                           float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Parallel element-wise exponential of a 32-bit floating point vector for XPULPV2
+           extension.
+    @param[in]  args  points to the plp_vfast_math_instance_f32 structure
     @return     none
 */
 
-void plp_std_f32s_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_vexp_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Glue code for element-wise natural logarithm of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_std_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+void plp_vlog_q16(const int16_t *pSrc,
+                  uint32_t blockSize,
+                  uint32_t fracBits,
+                  int16_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation value returned here
+    @brief Glue code for parallel element-wise natural logarithm of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_std_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int32_t *__restrict__ pRes);
+void plp_vlog_q16_parallel(const int16_t *pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           uint32_t nPE,
+                           int16_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
+    @brief Element-wise natural logarithm of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_std_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+void plp_vlog_q16s_rv32im(const int16_t *pSrc,
                           uint32_t blockSize,
                           uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+                          int16_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Element-wise natural logarithm of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_std_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_vlog_q16s_xpulpv2(const int16_t *pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int16_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Parallel element-wise natural logarithm of a 16-bit fixed point vector for XPULPV2
+           extension.
+    @param[in]  args  points to the plp_vfast_math_instance_q16 structure
     @return     none
 */
 
-void plp_std_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int16_t *__restrict__ pRes);
+void plp_vlog_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
+    @brief Glue code for element-wise natural logarithm of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
+    @return     none
+*/
+
+void plp_vlog_q32(const int32_t *pSrc,
+                  uint32_t blockSize,
+                  uint32_t fracBits,
+                  int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel element-wise natural logarithm of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector, can be equal to pSrc
+    @return     none
+*/
+
+void plp_vlog_q32_parallel(const int32_t *pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           uint32_t nPE,
+                           int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief Element-wise natural logarithm of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_std_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+void plp_vlog_q32s_rv32im(const int32_t *pSrc,
                           uint32_t blockSize,
                           uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+                          int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Element-wise natural logarithm of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_std_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_vlog_q32s_xpulpv2(const int32_t *pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Parallel element-wise natural logarithm of a 32-bit fixed point vector for XPULPV2
+           extension.
+    @param[in]  args  points to the plp_vfast_math_instance_q32 structure
     @return     none
 */
 
-void plp_std_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        uint32_t fracBits,
-                        int8_t *__restrict__ pRes);
+void plp_vlog_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation value returned here
+    @brief Glue code for element-wise exponential of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_std_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int8_t *__restrict__ pRes);
+void plp_vexp_q16(const int16_t *pSrc,
+                  uint32_t blockSize,
+                  uint32_t fracBits,
+                  int16_t *pDst);
+
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Glue code for parallel element-wise exponential of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_rms_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_vexp_q16_parallel(const int16_t *pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           uint32_t nPE,
+                           int16_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Element-wise exponential of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_rms_f32s_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_vexp_q16s_rv32im(const int16_t *pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Element-wise exponential of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_rms_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+void plp_vexp_q16s_xpulpv2(const int16_t *pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int16_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation value returned here
+    @brief Parallel element-wise exponential of a 16-bit fixed point vector for XPULPV2
+           extension.
+    @param[in]  args  points to the plp_vfast_math_instance_q16 structure
     @return     none
 */
 
-void plp_rms_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int32_t *__restrict__ pRes);
+void plp_vexp_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
+    @brief Glue code for element-wise exponential of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_rms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+void plp_vexp_q32(const int32_t *pSrc,
+                  uint32_t blockSize,
+                  uint32_t fracBits,
+                  int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Glue code for parallel element-wise exponential of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_rms_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_vexp_q32_parallel(const int32_t *pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           uint32_t nPE,
+                           int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Element-wise exponential of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_rms_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int16_t *__restrict__ pRes);
+void plp_vexp_q32s_rv32im(const int32_t *pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
+    @brief Element-wise exponential of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  fracBits   number of fractional bits of input and output
+    @param[out] pDst       points to the output vector, can be equal to pSrc
     @return     none
 */
 
-void plp_rms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+void plp_vexp_q32s_xpulpv2(const int32_t *pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Parallel element-wise exponential of a 32-bit fixed point vector for XPULPV2
+           extension.
+    @param[in]  args  points to the plp_vfast_math_instance_q32 structure
     @return     none
 */
 
-void plp_rms_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_vexp_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @brief Glue code for correlation of 32-bit integer vectors.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
     @return     none
 */
 
-void plp_rms_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        uint32_t fracBits,
-                        int8_t *__restrict__ pRes);
+void plp_correlate_i32(const int32_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int32_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation value returned here
+    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
     @return     none
 */
 
-void plp_rms_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int8_t *__restrict__ pRes);
+void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int32_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for square root of a 32-bit fixed point number.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
+    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none */
+
+void plp_correlate_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *__restrict__ pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    result returned here
+  @return     none
+ */
+
+void plp_correlate_i16(const int16_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int16_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_sqrt_q32(const int32_t *__restrict__ pSrc,
-                  const uint32_t fracBits,
-                  int32_t *__restrict__ pRes);
+void plp_correlate_i16s_xpulpv2(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
+   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_sqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                          const uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+void plp_correlate_i16s_rv32im(const int16_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int16_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_correlate_i8(const int8_t *pSrcA,
+                      const uint32_t srcALen,
+                      const int8_t *pSrcB,
+                      const uint32_t srcBLen,
+                      int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation (valid) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_correlate_valid_i8(const int8_t *pSrcA,
+                            const uint32_t srcALen,
+                            const int8_t *pSrcB,
+                            const uint32_t srcBLen,
+                            int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
+   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_sqrt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                           const uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+void plp_correlate_i8s_xpulpv2(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for square root of a 16-bit fixed point number.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
+   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_sqrt_q16(const int16_t *__restrict__ pSrc,
-                  const uint32_t fracBits,
-                  int16_t *__restrict__ pRes);
+void plp_correlate_i8s_rv32im(const int8_t *pSrcA,
+                              const uint32_t srcALen,
+                              const int8_t *pSrcB,
+                              const uint32_t srcBLen,
+                              int32_t *pRes);
+
 
 /** -------------------------------------------------------
-    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
+    @brief Glue code for correlation of 32-bit integer vectors.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
     @return     none
 */
 
-void plp_sqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                          const uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+void plp_correlate_q32(const int32_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int32_t *pSrcB,
+                       const uint32_t srcBLen,
+		       const uint32_t fracBits,
+                       int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
+    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
     @return     none
 */
 
-void plp_sqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                           const uint32_t fracBits,
-                           int16_t *__restrict__ pRes);
-
-
-/**
-   @brief         Glue code for square root of a 32-bit floating point number.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pRes    Square root returned here
-   @return        none
- */
-
-void plp_sqrt_f32(const float *__restrict__ pSrc, 
-                  float *__restrict__ pRes);
-
+void plp_correlate_q32s_rv32im(const int32_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int32_t *pSrcB,
+                               const uint32_t srcBLen,
+			       const uint32_t fracBits,
+                               int32_t *pRes);
 
-/**
-   @brief         Kernel for square root of a 32-bit floating point number.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pRes    Square root returned here
-   @return        none
- */
-void plp_sqrt_f32s_xpulpv2(const float *__restrict__ pSrc,
-                           float *__restrict__ pRes);
+/** -------------------------------------------------------
+    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none */
 
+void plp_correlate_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *__restrict__ pSrcB,
+                                const uint32_t srcBLen,
+				const uint32_t fracBits,
+                                int32_t *__restrict__ pRes);
 
-/**
-   @brief         Glue code for square root of a 32-bit floating point number.
-   @param[in]     pSrc       points to the input vectoro
-   @param[out]    pRes    Square root returned here
-   @return        none
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    result returned here
+  @return     none
  */
 
+void plp_correlate_q16(const int16_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int16_t *pSrcB,
+                       const uint32_t srcBLen,
+		       const uint32_t fracBits,
+                       int32_t *pRes);
 
-/**
- * @brief Macros required for SINE and COSINE Fast math approximations
- */
+/** -------------------------------------------------------
+   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
 
-#define FAST_MATH_TABLE_SIZE 512
-#define FAST_MATH_Q32_SHIFT (32 - 10)
-#define FAST_MATH_Q16_SHIFT (16 - 10)
-#define CONTROLLER_Q32_SHIFT (32 - 9)
-#define TABLE_SPACING_Q32 0x400000
-#define TABLE_SPACING_Q16 0x80
+void plp_correlate_q16s_xpulpv2(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+				const uint32_t fracBits,
+                                int32_t *pRes);
 
-/**
- * @brief      Glue code for q32 cosine function
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
 
-int32_t plp_cos_q32(int32_t x);
+void plp_correlate_q16s_rv32im(const int16_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int16_t *pSrcB,
+                               const uint32_t srcBLen,
+			       const uint32_t fracBits,
+                               int32_t *pRes);
 
-/**
- * @brief      q32 cosine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
  */
 
-int32_t plp_cos_q32s_rv32im(int32_t x);
+void plp_correlate_q8(const int8_t *pSrcA,
+                      const uint32_t srcALen,
+                      const int8_t *pSrcB,
+                      const uint32_t srcBLen,
+		      const uint32_t fracBits,
+                      int32_t *pRes);
 
-/**
- * @brief      q32 cosine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief Glue code for correlation (valid) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
  */
 
-int32_t plp_cos_q32s_xpulpv2(int32_t x);
-
-/**
- * @brief      Glue code for q16 cosine function
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+void plp_correlate_valid_q8(const int8_t *pSrcA,
+                            const uint32_t srcALen,
+                            const int8_t *pSrcB,
+                            const uint32_t srcBLen,
+			    const uint32_t fracBits,
+                            int32_t *pRes);
 
-int16_t plp_cos_q16(int16_t x);
+/** -------------------------------------------------------
+   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
 
-/**
- * @brief      q16 cosine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+void plp_correlate_q8s_xpulpv2(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+			       const uint32_t fracBits,
+                               int32_t *pRes);
 
-int16_t plp_cos_q16s_rv32im(int16_t x);
+/** -------------------------------------------------------
+   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
 
-/**
- * @brief      q16 cosine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+void plp_correlate_q8s_rv32im(const int8_t *pSrcA,
+                              const uint32_t srcALen,
+                              const int8_t *pSrcB,
+                              const uint32_t srcBLen,
+			      const uint32_t fracBits,
+                              int32_t *pRes);
 
-int16_t plp_cos_q16s_xpulpv2(int16_t x);
 
-/**
- * @brief      Glue code for f32 cosine function
- *
- * @param[in]  x     input value in radians
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 32-bit integer vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[out] pRes     result returned here
+  @return     none
  */
 
-float32_t plp_cos_f32(float32_t x);
+void plp_conv_i32(const int32_t *pSrcA,
+                  const uint32_t srcALen,
+                  const int32_t *pSrcB,
+                  const uint32_t srcBLen,
+                  int32_t *pRes);
 
-/**
- * @brief      F32 cosine function for XPULPV2
- *
- * @param[in]  x     input value in radians
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid) of 32-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
  */
 
-float32_t plp_cos_f32s_xpulpv2(float32_t x);
+void plp_conv_valid_i32(const int32_t *pSrcA,
+                        const uint32_t srcALen,
+                        const int32_t *pSrcB,
+                        const uint32_t srcBLen,
+                        int32_t *pRes);
 
-/**
- * @brief      Glue code for q32 sine function
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+   @brief Convolution of 32-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
 
-int32_t plp_sin_q32(int32_t x);
+void plp_conv_i32s_rv32im(const int32_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int32_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
 
-/**
- * @brief      q32 sine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+   @brief Convolution of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
 
-int32_t plp_sin_q32s_rv32im(int32_t x);
+void plp_conv_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                           const uint32_t srcALen,
+                           const int32_t *__restrict__ pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *__restrict__ pRes);
 
-/**
- * @brief      q32 sine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none */
 
-int32_t plp_sin_q32s_xpulpv2(int32_t x);
+void plp_conv_valid_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                 const uint32_t srcALen,
+                                 const int32_t *__restrict__ pSrcB,
+                                 const uint32_t srcBLen,
+                                 int32_t *__restrict__ pRes);
 
-/**
- * @brief      Glue code for q16 sine function
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
  */
 
-int16_t plp_sin_q16(int16_t x);
+void plp_conv_i16(const int16_t *pSrcA,
+                  const uint32_t srcALen,
+                  const int16_t *pSrcB,
+                  const uint32_t srcBLen,
+                  int32_t *pRes);
 
-/**
- * @brief      q16 sine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid) of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
  */
 
-int16_t plp_sin_q16s_rv32im(int16_t x);
+void plp_conv_valid_i16(const int16_t *pSrcA,
+                        const uint32_t srcALen,
+                        const int16_t *pSrcB,
+                        const uint32_t srcBLen,
+                        int32_t *pRes);
 
-/**
- * @brief      q16 sine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid with replication) of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
  */
 
-int16_t plp_sin_q16s_xpulpv2(int16_t x);
+void plp_conv_valid_rep_i16(const int16_t *pSrcA,
+                            const uint32_t srcALen,
+                            const int16_t *pSrcB,
+                            const uint32_t srcBLen,
+                            int32_t *pRes);
 
-/**
- * @brief      Glue code for f32 sine function
- *
- * @param[in]  x     input value in radians
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+   @brief Convolution of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
 
-float32_t plp_sin_f32(float32_t x);
+void plp_conv_i16s_xpulpv2(const int16_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int16_t *pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *pRes);
 
-/**
- * @brief      F32 sine function for XPULPV2
- *
- * @param[in]  x     input value in radians
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
 
-float32_t plp_sin_f32s_xpulpv2(float32_t x);
+void plp_conv_valid_i16s_xpulpv2(const int16_t *pSrcA,
+                                 const uint32_t srcALen,
+                                 const int16_t *pSrcB,
+                                 const uint32_t srcBLen,
+                                 int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for correlation of 32-bit integer vectors.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none
+   @brief Convolution (valid with data replication) of 16-bit integer vectors kernel for XPULPV2
+   extension.
+   @param[in]  pSrcA   points to the first input vector of the replicated data
+   @param[in]  srcALen Number of elements in (unreplicated) vector a
+   @param[in]  srcAMem Number of elements between each replication
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_correlate_i32(const int32_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int32_t *pSrcB,
-                       const uint32_t srcBLen,
-                       int32_t *pRes);
+void plp_conv_valid_rep_i16s_xpulpv2(const int16_t *pSrcA,
+                                     const uint32_t srcALen,
+                                     const uint32_t srcAMem,
+                                     const int16_t *pSrcB,
+                                     const uint32_t srcBLen,
+                                     int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none
+   @brief Convolution of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int32_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
+void plp_conv_i16s_rv32im(const int16_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int16_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none */
+  @brief Glue code for convolution of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
 
-void plp_correlate_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                const uint32_t srcALen,
-                                const int32_t *__restrict__ pSrcB,
-                                const uint32_t srcBLen,
-                                int32_t *__restrict__ pRes);
+void plp_conv_i8(const int8_t *pSrcA,
+                 const uint32_t srcALen,
+                 const int8_t *pSrcB,
+                 const uint32_t srcBLen,
+                 int32_t *pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 16-bit integer vectors.
+  @brief Glue code for convolution (valid) of 8-bit integer vectors.
   @param[in]  pSrcA   points to the first input vector
   @param[in]  srcALen Length of the first input vector
   @param[in]  pSrcB   points to the second input vector
   @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    result returned here
+  @param[out] pRes    output result returned here
   @return     none
  */
 
-void plp_correlate_i16(const int16_t *pSrcA,
+void plp_conv_valid_i8(const int8_t *pSrcA,
                        const uint32_t srcALen,
-                       const int16_t *pSrcB,
+                       const int8_t *pSrcB,
                        const uint32_t srcBLen,
                        int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+  @brief Glue code for convolution (valid with data replication) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here (preferably in L1)
+  @return     none
+ */
+
+void plp_conv_valid_rep_i8(const int8_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int8_t *pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 8-bit integer vectors kernel for XPULPV2 extension.
    @param[in]  pSrcA   points to the first input vector
    @param[in]  srcALen Length of the first input vector
    @param[in]  pSrcB   points to the second input vector
@@ -4279,14 +9475,49 @@ void plp_correlate_i16(const int16_t *pSrcA,
    @return     none
 */
 
-void plp_correlate_i16s_xpulpv2(const int16_t *pSrcA,
+void plp_conv_i8s_xpulpv2(const int8_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int8_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_valid_i8s_xpulpv2(const int8_t *pSrcA,
                                 const uint32_t srcALen,
-                                const int16_t *pSrcB,
+                                const int8_t *pSrcB,
                                 const uint32_t srcBLen,
                                 int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
+   @brief Convolution (valid with data replication) of 8-bit integer vectors kernel for XPULPV2
+   extension.
+   @param[in]  pSrcA   points to the first input vector of the replicated data
+   @param[in]  srcALen Number of elements in (unreplicated) vector a
+   @param[in]  srcAMem Number of elements between each replication
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_valid_rep_i8s_xpulpv2(const int8_t *pSrcA,
+                                    const uint32_t srcALen,
+                                    const uint32_t srcAMem,
+                                    const int8_t *pSrcB,
+                                    const uint32_t srcBLen,
+                                    int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 8-bit integer vectors kernel for RV32IM extension.
    @param[in]  pSrcA   points to the first input vector
    @param[in]  srcALen Length of the first input vector
    @param[in]  pSrcB   points to the second input vector
@@ -4295,655 +9526,792 @@ void plp_correlate_i16s_xpulpv2(const int16_t *pSrcA,
    @return     none
 */
 
-void plp_correlate_i16s_rv32im(const int16_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int16_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
+void plp_conv_i8s_rv32im(const int8_t *pSrcA,
+                         const uint32_t srcALen,
+                         const int8_t *pSrcB,
+                         const uint32_t srcBLen,
+                         int32_t *pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 8-bit integer vectors.
+  @brief Glue code for parallel convolution of 32-bit integer vectors.
   @param[in]  pSrcA   points to the first input vector
   @param[in]  srcALen Length of the first input vector
   @param[in]  pSrcB   points to the second input vector
   @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
   @param[out] pRes    output result returned here
   @return     none
  */
 
-void plp_correlate_i8(const int8_t *pSrcA,
-                      const uint32_t srcALen,
-                      const int8_t *pSrcB,
-                      const uint32_t srcBLen,
-                      int32_t *pRes);
+void plp_conv_i32_parallel(const int32_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int32_t *pSrcB,
+                           const uint32_t srcBLen,
+                           const uint8_t nPE,
+                           int32_t *pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation (valid) of 8-bit integer vectors.
+  @brief Setup code for parallel convolution of 32-bit integer vectors.
+  @param[in]  task_args      pointer to plp_conv_instance_i32 struct initialized by
+                             plp_conv_i32_parallel
+  @return     none
+ */
+
+void plp_conv_i32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel convolution of 16-bit integer vectors.
   @param[in]  pSrcA   points to the first input vector
   @param[in]  srcALen Length of the first input vector
   @param[in]  pSrcB   points to the second input vector
   @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
   @param[out] pRes    output result returned here
   @return     none
  */
 
-void plp_correlate_valid_i8(const int8_t *pSrcA,
-                            const uint32_t srcALen,
-                            const int8_t *pSrcB,
-                            const uint32_t srcBLen,
-                            int32_t *pRes);
+void plp_conv_i16_parallel(const int16_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int16_t *pSrcB,
+                           const uint32_t srcBLen,
+                           const uint8_t nPE,
+                           int32_t *pRes);
+/** -------------------------------------------------------
+  @brief Setup code for parallel convolution of 16-bit integer vectors.
+  @param[in]  task_args  pointer to plp_conv_instance_i16 struct initialized by
+                         plp_conv_i16_parallel
+  @return     none
+ */
+
+void plp_conv_i16p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel convolution of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_i8_parallel(const int8_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int8_t *pSrcB,
+                          const uint32_t srcBLen,
+                          const uint8_t nPE,
+                          int32_t *pRes);
+/** -------------------------------------------------------
+  @brief Setup code for parallel convolution of 8-bit integer vectors.
+  @param[in]  task_args  pointer to plp_conv_instance_i8 struct initialized by
+                         plp_conv_i8_parallel
+  @return     none
+ */
+
+void plp_conv_i8p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief Helper function for parallelized overlap-adding of partial convolution results
+   @param[in] nPE Number of processing cores
+   @param[in] srcALen Length of the first original input vector
+   @param[in] srcBLen Length of the second original input vector
+   @param[in] resultsBuffer resultsBuffer array from plp_conv_i[XX]_parallel
+   @return none
+*/
+
+void plp_conv_parallel_OLA(uint32_t nPE,
+                           uint32_t srcALen,
+                           uint32_t srcBLen,
+                           int32_t *resultsBuffer);
+
+/** -------------------------------------------------------
+   @brief Helper function for parallelized overlap-adding of partial convolution results
+   @param[in] task_args  Holds the plp_conv_tree_add_instance that describes the vector parameters
+   @return none
+*/
+void plp_conv_parallel_OLA_kernel(void *task_args);
+
+/** -------------------------------------------------------
+    @brief      Initialization of the 8-bit integer FIR filter instance.
+    @param[out] S          points to the instance structure to initialize
+    @param[in]  numTaps    number of filter coefficients, at least 1
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize
+    @param[in]  blockSize  number of samples processed per call
+    @return     none
+*/
+
+void plp_fir_init_i8(plp_fir_instance_i8 *S,
+                     uint32_t numTaps,
+                     const int8_t *pCoeffs,
+                     int8_t *pState,
+                     uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for filtering a block of 8-bit integer samples with a FIR filter.
+    @param[in]  S     points to an initialized 8-bit integer FIR instance
+    @param[in]  pSrc  points to the input block of S->blockSize samples
+    @param[out] pDst  points to the output block of S->blockSize samples
+    @return     none
+*/
+
+void plp_fir_i8(const plp_fir_instance_i8 *S, const int8_t *pSrc, int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Glue code for filtering a block of 8-bit integer samples with a FIR filter on
+                multiple cores.
+    @param[in]  S     points to an initialized 8-bit integer FIR instance
+    @param[in]  pSrc  points to the input block of S->blockSize samples
+    @param[in]  nPE   number of cores to use
+    @param[out] pDst  points to the output block of S->blockSize samples
+    @return     none
+*/
+
+void plp_fir_i8_parallel(const plp_fir_instance_i8 *S,
+                         const int8_t *pSrc,
+                         uint32_t nPE,
+                         int32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      FIR filter of 8-bit integer samples kernel for RV32IM extension.
+    @param[in]  pState     points to the delay line, numTaps - 1 + blockSize samples
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  blockSize  number of output samples to compute
+    @param[out] pDst       points to the output samples
+    @return     none
+*/
+
+void plp_fir_i8s_rv32im(const int8_t *__restrict__ pState,
+                        const int8_t *__restrict__ pCoeffs,
+                        uint32_t numTaps,
+                        uint32_t blockSize,
+                        int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief      FIR filter of 8-bit integer samples kernel for XPULPV2 extension.
+    @param[in]  pState     points to the delay line, numTaps - 1 + blockSize samples (plus one
+                           sample of padding)
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  blockSize  number of output samples to compute
+    @param[out] pDst       points to the output samples
+    @return     none
+*/
+
+void plp_fir_i8s_xpulpv2(const int8_t *__restrict__ pState,
+                         const int8_t *__restrict__ pCoeffs,
+                         uint32_t numTaps,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Parallel FIR filter of 8-bit integer samples kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_fir_instance_i8_parallel structure
+    @return     none
 */
 
-void plp_correlate_i8s_xpulpv2(const int8_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int8_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
+void plp_fir_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Initialization of the 16-bit integer FIR filter instance.
+    @param[out] S          points to the instance structure to initialize
+    @param[in]  numTaps    number of filter coefficients, at least 1
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize
+    @param[in]  blockSize  number of samples processed per call
+    @return     none
 */
 
-void plp_correlate_i8s_rv32im(const int8_t *pSrcA,
-                              const uint32_t srcALen,
-                              const int8_t *pSrcB,
-                              const uint32_t srcBLen,
-                              int32_t *pRes);
-
+void plp_fir_init_i16(plp_fir_instance_i16 *S,
+                      uint32_t numTaps,
+                      const int16_t *pCoeffs,
+                      int16_t *pState,
+                      uint32_t blockSize);
 
 /** -------------------------------------------------------
-    @brief Glue code for correlation of 32-bit integer vectors.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
+    @brief      Glue code for filtering a block of 16-bit integer samples with a FIR filter.
+    @param[in]  S     points to an initialized 16-bit integer FIR instance
+    @param[in]  pSrc  points to the input block of S->blockSize samples
+    @param[out] pDst  points to the output block of S->blockSize samples
     @return     none
 */
 
-void plp_correlate_q32(const int32_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int32_t *pSrcB,
-                       const uint32_t srcBLen,
-		       const uint32_t fracBits,
-                       int32_t *pRes);
+void plp_fir_i16(const plp_fir_instance_i16 *S, const int16_t *pSrc, int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
+    @brief      Glue code for filtering a block of 16-bit integer samples with a FIR filter on
+                multiple cores.
+    @param[in]  S     points to an initialized 16-bit integer FIR instance
+    @param[in]  pSrc  points to the input block of S->blockSize samples
+    @param[in]  nPE   number of cores to use
+    @param[out] pDst  points to the output block of S->blockSize samples
     @return     none
 */
 
-void plp_correlate_q32s_rv32im(const int32_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int32_t *pSrcB,
-                               const uint32_t srcBLen,
-			       const uint32_t fracBits,
-                               int32_t *pRes);
+void plp_fir_i16_parallel(const plp_fir_instance_i16 *S,
+                          const int16_t *pSrc,
+                          uint32_t nPE,
+                          int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none */
+    @brief      FIR filter of 16-bit integer samples kernel for RV32IM extension.
+    @param[in]  pState     points to the delay line, numTaps - 1 + blockSize samples
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  blockSize  number of output samples to compute
+    @param[out] pDst       points to the output samples
+    @return     none
+*/
 
-void plp_correlate_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                const uint32_t srcALen,
-                                const int32_t *__restrict__ pSrcB,
-                                const uint32_t srcBLen,
-				const uint32_t fracBits,
-                                int32_t *__restrict__ pRes);
+void plp_fir_i16s_rv32im(const int16_t *__restrict__ pState,
+                         const int16_t *__restrict__ pCoeffs,
+                         uint32_t numTaps,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    result returned here
-  @return     none
- */
+    @brief      FIR filter of 16-bit integer samples kernel for XPULPV2 extension.
+    @param[in]  pState     points to the delay line, numTaps - 1 + blockSize samples (plus one
+                           sample of padding)
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  blockSize  number of output samples to compute
+    @param[out] pDst       points to the output samples
+    @return     none
+*/
 
-void plp_correlate_q16(const int16_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int16_t *pSrcB,
-                       const uint32_t srcBLen,
-		       const uint32_t fracBits,
-                       int32_t *pRes);
+void plp_fir_i16s_xpulpv2(const int16_t *__restrict__ pState,
+                          const int16_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Parallel FIR filter of 16-bit integer samples kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_fir_instance_i16_parallel structure
+    @return     none
 */
 
-void plp_correlate_q16s_xpulpv2(const int16_t *pSrcA,
-                                const uint32_t srcALen,
-                                const int16_t *pSrcB,
-                                const uint32_t srcBLen,
-				const uint32_t fracBits,
-                                int32_t *pRes);
+void plp_fir_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Initialization of the 16-bit fixed point FIR filter instance.
+    @param[out] S          points to the instance structure to initialize
+    @param[in]  numTaps    number of filter coefficients, at least 1
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize
+    @param[in]  blockSize  number of samples processed per call
+    @param[in]  deciPoint  decimal point for right shift of the result
+    @return     none
 */
 
-void plp_correlate_q16s_rv32im(const int16_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int16_t *pSrcB,
-                               const uint32_t srcBLen,
-			       const uint32_t fracBits,
-                               int32_t *pRes);
+void plp_fir_init_q16(plp_fir_instance_q16 *S,
+                      uint32_t numTaps,
+                      const int16_t *pCoeffs,
+                      int16_t *pState,
+                      uint32_t blockSize,
+                      uint32_t deciPoint);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Glue code for filtering a block of 16-bit fixed point samples with a FIR filter.
+    @param[in]  S     points to an initialized 16-bit fixed point FIR instance
+    @param[in]  pSrc  points to the input block of S->blockSize samples
+    @param[out] pDst  points to the output block of S->blockSize samples
+    @return     none
+*/
 
-void plp_correlate_q8(const int8_t *pSrcA,
-                      const uint32_t srcALen,
-                      const int8_t *pSrcB,
-                      const uint32_t srcBLen,
-		      const uint32_t fracBits,
-                      int32_t *pRes);
+void plp_fir_q16(const plp_fir_instance_q16 *S, const int16_t *pSrc, int16_t *pDst);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation (valid) of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Glue code for filtering a block of 16-bit fixed point samples with a FIR filter on
+                multiple cores.
+    @param[in]  S     points to an initialized 16-bit fixed point FIR instance
+    @param[in]  pSrc  points to the input block of S->blockSize samples
+    @param[in]  nPE   number of cores to use
+    @param[out] pDst  points to the output block of S->blockSize samples
+    @return     none
+*/
 
-void plp_correlate_valid_q8(const int8_t *pSrcA,
-                            const uint32_t srcALen,
-                            const int8_t *pSrcB,
-                            const uint32_t srcBLen,
-			    const uint32_t fracBits,
-                            int32_t *pRes);
+void plp_fir_q16_parallel(const plp_fir_instance_q16 *S,
+                          const int16_t *pSrc,
+                          uint32_t nPE,
+                          int16_t *pDst);
 
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      FIR filter of 16-bit fixed point samples kernel for RV32IM extension.
+    @param[in]  pState     points to the delay line, numTaps - 1 + blockSize samples
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  blockSize  number of output samples to compute
+    @param[in]  deciPoint  decimal point for right shift of the result
+    @param[out] pDst       points to the output samples
+    @return     none
 */
 
-void plp_correlate_q8s_xpulpv2(const int8_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int8_t *pSrcB,
-                               const uint32_t srcBLen,
-			       const uint32_t fracBits,
-                               int32_t *pRes);
+void plp_fir_q16s_rv32im(const int16_t *__restrict__ pState,
+                         const int16_t *__restrict__ pCoeffs,
+                         uint32_t numTaps,
+                         uint32_t blockSize,
+                         uint32_t deciPoint,
+                         int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief      FIR filter of 16-bit fixed point samples kernel for XPULPV2 extension.
+    @param[in]  pState     points to the delay line, numTaps - 1 + blockSize samples (plus one
+                           sample of padding)
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  blockSize  number of output samples to compute
+    @param[in]  deciPoint  decimal point for right shift of the result
+    @param[out] pDst       points to the output samples
+    @return     none
+*/
+
+void plp_fir_q16s_xpulpv2(const int16_t *__restrict__ pState,
+                          const int16_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          uint32_t blockSize,
+                          uint32_t deciPoint,
+                          int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Parallel FIR filter of 16-bit fixed point samples kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_fir_instance_q16_parallel structure
+    @return     none
 */
 
-void plp_correlate_q8s_rv32im(const int8_t *pSrcA,
-                              const uint32_t srcALen,
-                              const int8_t *pSrcB,
-                              const uint32_t srcBLen,
-			      const uint32_t fracBits,
-                              int32_t *pRes);
+void plp_fir_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Initialization of the 32-bit fixed point FIR filter instance.
+    @param[out] S          points to the instance structure to initialize
+    @param[in]  numTaps    number of filter coefficients, at least 1
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize
+    @param[in]  blockSize  number of samples processed per call
+    @param[in]  deciPoint  decimal point for right shift of the result
+    @return     none
+*/
 
+void plp_fir_init_q32(plp_fir_instance_q32 *S,
+                      uint32_t numTaps,
+                      const int32_t *pCoeffs,
+                      int32_t *pState,
+                      uint32_t blockSize,
+                      uint32_t deciPoint);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution of 32-bit integer vectors.
-  @param[in]  pSrcA    points to the first input vector
-  @param[in]  srcALen  Length of the first input vector
-  @param[in]  pSrcB    points to the second input vector
-  @param[in]  srcBLen  Length of the second input vector
-  @param[out] pRes     result returned here
-  @return     none
- */
+    @brief      Glue code for filtering a block of 32-bit fixed point samples with a FIR filter.
+    @param[in]  S     points to an initialized 32-bit fixed point FIR instance
+    @param[in]  pSrc  points to the input block of S->blockSize samples
+    @param[out] pDst  points to the output block of S->blockSize samples
+    @return     none
+*/
 
-void plp_conv_i32(const int32_t *pSrcA,
-                  const uint32_t srcALen,
-                  const int32_t *pSrcB,
-                  const uint32_t srcBLen,
-                  int32_t *pRes);
+void plp_fir_q32(const plp_fir_instance_q32 *S, const int32_t *pSrc, int32_t *pDst);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution (valid) of 32-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Glue code for filtering a block of 32-bit fixed point samples with a FIR filter on
+                multiple cores.
+    @param[in]  S     points to an initialized 32-bit fixed point FIR instance
+    @param[in]  pSrc  points to the input block of S->blockSize samples
+    @param[in]  nPE   number of cores to use
+    @param[out] pDst  points to the output block of S->blockSize samples
+    @return     none
+*/
 
-void plp_conv_valid_i32(const int32_t *pSrcA,
-                        const uint32_t srcALen,
-                        const int32_t *pSrcB,
-                        const uint32_t srcBLen,
-                        int32_t *pRes);
+void plp_fir_q32_parallel(const plp_fir_instance_q32 *S,
+                          const int32_t *pSrc,
+                          uint32_t nPE,
+                          int32_t *pDst);
 
 /** -------------------------------------------------------
-   @brief Convolution of 32-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      FIR filter of 32-bit fixed point samples kernel for RV32IM extension.
+    @param[in]  pState     points to the delay line, numTaps - 1 + blockSize samples
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  blockSize  number of output samples to compute
+    @param[in]  deciPoint  decimal point for right shift of the result
+    @param[out] pDst       points to the output samples
+    @return     none
 */
 
-void plp_conv_i32s_rv32im(const int32_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int32_t *pSrcB,
-                          const uint32_t srcBLen,
-                          int32_t *pRes);
+void plp_fir_q32s_rv32im(const int32_t *__restrict__ pState,
+                         const int32_t *__restrict__ pCoeffs,
+                         uint32_t numTaps,
+                         uint32_t blockSize,
+                         uint32_t deciPoint,
+                         int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+    @brief      FIR filter of 32-bit fixed point samples kernel for XPULPV2 extension.
+    @param[in]  pState     points to the delay line, numTaps - 1 + blockSize samples (plus one
+                           sample of padding)
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  blockSize  number of output samples to compute
+    @param[in]  deciPoint  decimal point for right shift of the result
+    @param[out] pDst       points to the output samples
+    @return     none
+*/
+
+void plp_fir_q32s_xpulpv2(const int32_t *__restrict__ pState,
+                          const int32_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          uint32_t blockSize,
+                          uint32_t deciPoint,
+                          int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief Convolution of 32-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Parallel FIR filter of 32-bit fixed point samples kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_fir_instance_q32_parallel structure
+    @return     none
 */
 
-void plp_conv_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                           const uint32_t srcALen,
-                           const int32_t *__restrict__ pSrcB,
-                           const uint32_t srcBLen,
-                           int32_t *__restrict__ pRes);
+void plp_fir_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief Convolution (valid) of 32-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none */
+    @brief      Initialization of the 32-bit float FIR filter instance.
+    @param[out] S          points to the instance structure to initialize
+    @param[in]  numTaps    number of filter coefficients, at least 1
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  pState     points to the state buffer of size numTaps + blockSize
+    @param[in]  blockSize  number of samples processed per call
+    @return     none
+*/
+
+void plp_fir_init_f32(plp_fir_instance_f32 *S,
+                      uint32_t numTaps,
+                      const float32_t *pCoeffs,
+                      float32_t *pState,
+                      uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for filtering a block of 32-bit float samples with a FIR filter.
+    @param[in]  S     points to an initialized 32-bit float FIR instance
+    @param[in]  pSrc  points to the input block of S->blockSize samples
+    @param[out] pDst  points to the output block of S->blockSize samples
+    @return     none
+*/
 
-void plp_conv_valid_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                 const uint32_t srcALen,
-                                 const int32_t *__restrict__ pSrcB,
-                                 const uint32_t srcBLen,
-                                 int32_t *__restrict__ pRes);
+void plp_fir_f32(const plp_fir_instance_f32 *S, const float32_t *pSrc, float32_t *pDst);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Glue code for filtering a block of 32-bit float samples with a FIR filter on
+                multiple cores.
+    @param[in]  S     points to an initialized 32-bit float FIR instance
+    @param[in]  pSrc  points to the input block of S->blockSize samples
+    @param[in]  nPE   number of cores to use
+    @param[out] pDst  points to the output block of S->blockSize samples
+    @return     none
+*/
 
-void plp_conv_i16(const int16_t *pSrcA,
-                  const uint32_t srcALen,
-                  const int16_t *pSrcB,
-                  const uint32_t srcBLen,
-                  int32_t *pRes);
+void plp_fir_f32_parallel(const plp_fir_instance_f32 *S,
+                          const float32_t *pSrc,
+                          uint32_t nPE,
+                          float32_t *pDst);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution (valid) of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      FIR filter of 32-bit float samples kernel for RV32IM extension.
+    @param[in]  pState     points to the delay line, numTaps - 1 + blockSize samples
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  blockSize  number of output samples to compute
+    @param[out] pDst       points to the output samples
+    @return     none
+*/
 
-void plp_conv_valid_i16(const int16_t *pSrcA,
-                        const uint32_t srcALen,
-                        const int16_t *pSrcB,
-                        const uint32_t srcBLen,
-                        int32_t *pRes);
+void plp_fir_f32s_rv32im(const float32_t *__restrict__ pState,
+                         const float32_t *__restrict__ pCoeffs,
+                         uint32_t numTaps,
+                         uint32_t blockSize,
+                         float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution (valid with replication) of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      FIR filter of 32-bit float samples kernel for XPULPV2 extension.
+    @param[in]  pState     points to the delay line, numTaps - 1 + blockSize samples (plus one
+                           sample of padding)
+    @param[in]  pCoeffs    points to the coefficients, in time reversed order
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  blockSize  number of output samples to compute
+    @param[out] pDst       points to the output samples
+    @return     none
+*/
 
-void plp_conv_valid_rep_i16(const int16_t *pSrcA,
-                            const uint32_t srcALen,
-                            const int16_t *pSrcB,
-                            const uint32_t srcBLen,
-                            int32_t *pRes);
+void plp_fir_f32s_xpulpv2(const float32_t *__restrict__ pState,
+                          const float32_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          uint32_t blockSize,
+                          float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief Convolution of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Parallel FIR filter of 32-bit float samples kernel for XPULPV2 extension.
+    @param[in]  args  points to the plp_fir_instance_f32_parallel structure
+    @return     none
 */
 
-void plp_conv_i16s_xpulpv2(const int16_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int16_t *pSrcB,
-                           const uint32_t srcBLen,
-                           int32_t *pRes);
+void plp_fir_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief Convolution (valid) of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Initialization of the 16-bit fixed point Direct Form I biquad cascade.
+    @param[out] S          points to the instance structure to initialize
+    @param[in]  numStages  number of second order stages
+    @param[in]  pCoeffs    points to the coefficients, 6 per stage: {b0, 0, b1, b2, a1, a2}
+    @param[in]  pState     points to the state buffer, 4 values per stage
+    @param[in]  deciPoint  number of fractional bits of the coefficients
+    @return     none
 */
 
-void plp_conv_valid_i16s_xpulpv2(const int16_t *pSrcA,
-                                 const uint32_t srcALen,
-                                 const int16_t *pSrcB,
-                                 const uint32_t srcBLen,
-                                 int32_t *pRes);
+void plp_biquad_cascade_df1_init_q16(plp_biquad_df1_instance_q16 *S,
+                                     uint32_t numStages,
+                                     const int16_t *pCoeffs,
+                                     int16_t *pState,
+                                     uint32_t deciPoint);
 
 /** -------------------------------------------------------
-   @brief Convolution (valid with data replication) of 16-bit integer vectors kernel for XPULPV2
-   extension.
-   @param[in]  pSrcA   points to the first input vector of the replicated data
-   @param[in]  srcALen Number of elements in (unreplicated) vector a
-   @param[in]  srcAMem Number of elements between each replication
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Glue code for the 16-bit fixed point Direct Form I biquad cascade.
+    @param[in]  S          points to an initialized instance
+    @param[in]  pSrc       points to the input samples
+    @param[out] pDst       points to the output samples, may be equal to pSrc
+    @param[in]  blockSize  number of samples to filter
+    @return     none
 */
 
-void plp_conv_valid_rep_i16s_xpulpv2(const int16_t *pSrcA,
-                                     const uint32_t srcALen,
-                                     const uint32_t srcAMem,
-                                     const int16_t *pSrcB,
-                                     const uint32_t srcBLen,
-                                     int32_t *pRes);
+void plp_biquad_cascade_df1_q16(const plp_biquad_df1_instance_q16 *S,
+                                const int16_t *pSrc,
+                                int16_t *pDst,
+                                uint32_t blockSize);
 
 /** -------------------------------------------------------
-   @brief Convolution of 16-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Glue code for filtering multiple channels with biquad cascades on multiple
+                cores (Direct Form I, 16-bit fixed point).
+    @param[in]  S          points to an array of nChannels initialized instances
+    @param[in]  nChannels  number of channels
+    @param[in]  pSrc       points to the input samples, the blocks of all channels one after the
+                           other
+    @param[out] pDst       points to the output samples, same layout as pSrc
+    @param[in]  blockSize  number of samples to filter per channel
+    @param[in]  nPE        number of cores to use
+    @return     none
 */
 
-void plp_conv_i16s_rv32im(const int16_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int16_t *pSrcB,
-                          const uint32_t srcBLen,
-                          int32_t *pRes);
+void plp_biquad_cascade_df1_q16_parallel(const plp_biquad_df1_instance_q16 *S,
+                                         uint32_t nChannels,
+                                         const int16_t *pSrc,
+                                         int16_t *pDst,
+                                         uint32_t blockSize,
+                                         uint32_t nPE);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Direct Form I biquad cascade kernel for RV32IM extension (16-bit fixed point).
+    @param[in]  S          points to an initialized instance
+    @param[in]  pSrc       points to the input samples
+    @param[out] pDst       points to the output samples, may be equal to pSrc
+    @param[in]  blockSize  number of samples to filter
+    @return     none
+*/
 
-void plp_conv_i8(const int8_t *pSrcA,
-                 const uint32_t srcALen,
-                 const int8_t *pSrcB,
-                 const uint32_t srcBLen,
-                 int32_t *pRes);
+void plp_biquad_cascade_df1_q16s_rv32im(const plp_biquad_df1_instance_q16 *S,
+                                        const int16_t *pSrc,
+                                        int16_t *pDst,
+                                        uint32_t blockSize);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution (valid) of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Direct Form I biquad cascade kernel for XPULPV2 extension (16-bit fixed point).
+    @param[in]  S          points to an initialized instance
+    @param[in]  pSrc       points to the input samples
+    @param[out] pDst       points to the output samples, may be equal to pSrc
+    @param[in]  blockSize  number of samples to filter
+    @return     none
+*/
 
-void plp_conv_valid_i8(const int8_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int8_t *pSrcB,
-                       const uint32_t srcBLen,
-                       int32_t *pRes);
+void plp_biquad_cascade_df1_q16s_xpulpv2(const plp_biquad_df1_instance_q16 *S,
+                                         const int16_t *pSrc,
+                                         int16_t *pDst,
+                                         uint32_t blockSize);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution (valid with data replication) of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector (in L2)
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector (in L2)
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here (preferably in L1)
-  @return     none
- */
+    @brief      Parallel multi-channel biquad cascade kernel for XPULPV2 extension
+                (Direct Form I, 16-bit fixed point).
+    @param[in]  args  points to the plp_biquad_df1_instance_q16_parallel structure
+    @return     none
+*/
 
-void plp_conv_valid_rep_i8(const int8_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int8_t *pSrcB,
-                           const uint32_t srcBLen,
-                           int32_t *pRes);
+void plp_biquad_cascade_df1_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief Convolution of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Initialization of the 32-bit fixed point Direct Form I biquad cascade.
+    @param[out] S          points to the instance structure to initialize
+    @param[in]  numStages  number of second order stages
+    @param[in]  pCoeffs    points to the coefficients, 5 per stage: {b0, b1, b2, a1, a2}
+    @param[in]  pState     points to the state buffer, 4 values per stage
+    @param[in]  deciPoint  number of fractional bits of the coefficients
+    @return     none
 */
 
-void plp_conv_i8s_xpulpv2(const int8_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int8_t *pSrcB,
-                          const uint32_t srcBLen,
-                          int32_t *pRes);
+void plp_biquad_cascade_df1_init_q32(plp_biquad_df1_instance_q32 *S,
+                                     uint32_t numStages,
+                                     const int32_t *pCoeffs,
+                                     int32_t *pState,
+                                     uint32_t deciPoint);
 
 /** -------------------------------------------------------
-   @brief Convolution (valid) of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Glue code for the 32-bit fixed point Direct Form I biquad cascade.
+    @param[in]  S          points to an initialized instance
+    @param[in]  pSrc       points to the input samples
+    @param[out] pDst       points to the output samples, may be equal to pSrc
+    @param[in]  blockSize  number of samples to filter
+    @return     none
 */
 
-void plp_conv_valid_i8s_xpulpv2(const int8_t *pSrcA,
-                                const uint32_t srcALen,
-                                const int8_t *pSrcB,
-                                const uint32_t srcBLen,
-                                int32_t *pRes);
+void plp_biquad_cascade_df1_q32(const plp_biquad_df1_instance_q32 *S,
+                                const int32_t *pSrc,
+                                int32_t *pDst,
+                                uint32_t blockSize);
 
 /** -------------------------------------------------------
-   @brief Convolution (valid with data replication) of 8-bit integer vectors kernel for XPULPV2
-   extension.
-   @param[in]  pSrcA   points to the first input vector of the replicated data
-   @param[in]  srcALen Number of elements in (unreplicated) vector a
-   @param[in]  srcAMem Number of elements between each replication
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Glue code for filtering multiple channels with biquad cascades on multiple
+                cores (Direct Form I, 32-bit fixed point).
+    @param[in]  S          points to an array of nChannels initialized instances
+    @param[in]  nChannels  number of channels
+    @param[in]  pSrc       points to the input samples, the blocks of all channels one after the
+                           other
+    @param[out] pDst       points to the output samples, same layout as pSrc
+    @param[in]  blockSize  number of samples to filter per channel
+    @param[in]  nPE        number of cores to use
+    @return     none
 */
 
-void plp_conv_valid_rep_i8s_xpulpv2(const int8_t *pSrcA,
-                                    const uint32_t srcALen,
-                                    const uint32_t srcAMem,
-                                    const int8_t *pSrcB,
-                                    const uint32_t srcBLen,
-                                    int32_t *pRes);
+void plp_biquad_cascade_df1_q32_parallel(const plp_biquad_df1_instance_q32 *S,
+                                         uint32_t nChannels,
+                                         const int32_t *pSrc,
+                                         int32_t *pDst,
+                                         uint32_t blockSize,
+                                         uint32_t nPE);
 
 /** -------------------------------------------------------
-   @brief Convolution of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Direct Form I biquad cascade kernel for RV32IM extension (32-bit fixed point).
+    @param[in]  S          points to an initialized instance
+    @param[in]  pSrc       points to the input samples
+    @param[out] pDst       points to the output samples, may be equal to pSrc
+    @param[in]  blockSize  number of samples to filter
+    @return     none
 */
 
-void plp_conv_i8s_rv32im(const int8_t *pSrcA,
-                         const uint32_t srcALen,
-                         const int8_t *pSrcB,
-                         const uint32_t srcBLen,
-                         int32_t *pRes);
+void plp_biquad_cascade_df1_q32s_rv32im(const plp_biquad_df1_instance_q32 *S,
+                                        const int32_t *pSrc,
+                                        int32_t *pDst,
+                                        uint32_t blockSize);
 
 /** -------------------------------------------------------
-  @brief Glue code for parallel convolution of 32-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[in]  nPE     Number of cores to compute on
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Direct Form I biquad cascade kernel for XPULPV2 extension (32-bit fixed point).
+    @param[in]  S          points to an initialized instance
+    @param[in]  pSrc       points to the input samples
+    @param[out] pDst       points to the output samples, may be equal to pSrc
+    @param[in]  blockSize  number of samples to filter
+    @return     none
+*/
 
-void plp_conv_i32_parallel(const int32_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int32_t *pSrcB,
-                           const uint32_t srcBLen,
-                           const uint8_t nPE,
-                           int32_t *pRes);
+void plp_biquad_cascade_df1_q32s_xpulpv2(const plp_biquad_df1_instance_q32 *S,
+                                         const int32_t *pSrc,
+                                         int32_t *pDst,
+                                         uint32_t blockSize);
 
 /** -------------------------------------------------------
-  @brief Setup code for parallel convolution of 32-bit integer vectors.
-  @param[in]  task_args      pointer to plp_conv_instance_i32 struct initialized by
-                             plp_conv_i32_parallel
-  @return     none
- */
+    @brief      Parallel multi-channel biquad cascade kernel for XPULPV2 extension
+                (Direct Form I, 32-bit fixed point).
+    @param[in]  args  points to the plp_biquad_df1_instance_q32_parallel structure
+    @return     none
+*/
 
-void plp_conv_i32p_xpulpv2(void *task_args);
+void plp_biquad_cascade_df1_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief Glue code for parallel convolution of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[in]  nPE     Number of cores to compute on
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Initialization of the 32-bit float Transposed Direct Form II biquad cascade.
+    @param[out] S          points to the instance structure to initialize
+    @param[in]  numStages  number of second order stages
+    @param[in]  pCoeffs    points to the coefficients, 5 per stage: {b0, b1, b2, a1, a2}
+    @param[in]  pState     points to the state buffer, 2 values per stage
+    @return     none
+*/
+
+void plp_biquad_cascade_df2T_init_f32(plp_biquad_df2T_instance_f32 *S,
+                                      uint32_t numStages,
+                                      const float32_t *pCoeffs,
+                                      float32_t *pState);
 
-void plp_conv_i16_parallel(const int16_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int16_t *pSrcB,
-                           const uint32_t srcBLen,
-                           const uint8_t nPE,
-                           int32_t *pRes);
 /** -------------------------------------------------------
-  @brief Setup code for parallel convolution of 16-bit integer vectors.
-  @param[in]  task_args  pointer to plp_conv_instance_i16 struct initialized by
-                         plp_conv_i16_parallel
-  @return     none
- */
+    @brief      Glue code for the 32-bit float Transposed Direct Form II biquad cascade.
+    @param[in]  S          points to an initialized instance
+    @param[in]  pSrc       points to the input samples
+    @param[out] pDst       points to the output samples, may be equal to pSrc
+    @param[in]  blockSize  number of samples to filter
+    @return     none
+*/
 
-void plp_conv_i16p_xpulpv2(void *task_args);
+void plp_biquad_cascade_df2T_f32(const plp_biquad_df2T_instance_f32 *S,
+                                 const float32_t *pSrc,
+                                 float32_t *pDst,
+                                 uint32_t blockSize);
 
 /** -------------------------------------------------------
-  @brief Glue code for parallel convolution of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[in]  nPE     Number of cores to compute on
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Glue code for filtering multiple channels with biquad cascades on multiple
+                cores (Transposed Direct Form II, 32-bit float).
+    @param[in]  S          points to an array of nChannels initialized instances
+    @param[in]  nChannels  number of channels
+    @param[in]  pSrc       points to the input samples, the blocks of all channels one after the
+                           other
+    @param[out] pDst       points to the output samples, same layout as pSrc
+    @param[in]  blockSize  number of samples to filter per channel
+    @param[in]  nPE        number of cores to use
+    @return     none
+*/
+
+void plp_biquad_cascade_df2T_f32_parallel(const plp_biquad_df2T_instance_f32 *S,
+                                          uint32_t nChannels,
+                                          const float32_t *pSrc,
+                                          float32_t *pDst,
+                                          uint32_t blockSize,
+                                          uint32_t nPE);
 
-void plp_conv_i8_parallel(const int8_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int8_t *pSrcB,
-                          const uint32_t srcBLen,
-                          const uint8_t nPE,
-                          int32_t *pRes);
 /** -------------------------------------------------------
-  @brief Setup code for parallel convolution of 8-bit integer vectors.
-  @param[in]  task_args  pointer to plp_conv_instance_i8 struct initialized by
-                         plp_conv_i8_parallel
-  @return     none
- */
+    @brief      Transposed Direct Form II biquad cascade kernel for RV32IM extension (32-bit float).
+    @param[in]  S          points to an initialized instance
+    @param[in]  pSrc       points to the input samples
+    @param[out] pDst       points to the output samples, may be equal to pSrc
+    @param[in]  blockSize  number of samples to filter
+    @return     none
+*/
 
-void plp_conv_i8p_xpulpv2(void *task_args);
+void plp_biquad_cascade_df2T_f32s_rv32im(const plp_biquad_df2T_instance_f32 *S,
+                                         const float32_t *pSrc,
+                                         float32_t *pDst,
+                                         uint32_t blockSize);
 
 /** -------------------------------------------------------
-   @brief Helper function for parallelized overlap-adding of partial convolution results
-   @param[in] nPE Number of processing cores
-   @param[in] srcALen Length of the first original input vector
-   @param[in] srcBLen Length of the second original input vector
-   @param[in] resultsBuffer resultsBuffer array from plp_conv_i[XX]_parallel
-   @return none
+    @brief      Transposed Direct Form II biquad cascade kernel for XPULPV2 extension (32-bit float).
+    @param[in]  S          points to an initialized instance
+    @param[in]  pSrc       points to the input samples
+    @param[out] pDst       points to the output samples, may be equal to pSrc
+    @param[in]  blockSize  number of samples to filter
+    @return     none
 */
 
-void plp_conv_parallel_OLA(uint32_t nPE,
-                           uint32_t srcALen,
-                           uint32_t srcBLen,
-                           int32_t *resultsBuffer);
+void plp_biquad_cascade_df2T_f32s_xpulpv2(const plp_biquad_df2T_instance_f32 *S,
+                                          const float32_t *pSrc,
+                                          float32_t *pDst,
+                                          uint32_t blockSize);
 
 /** -------------------------------------------------------
-   @brief Helper function for parallelized overlap-adding of partial convolution results
-   @param[in] task_args  Holds the plp_conv_tree_add_instance that describes the vector parameters
-   @return none
+    @brief      Parallel multi-channel biquad cascade kernel for XPULPV2 extension
+                (Transposed Direct Form II, 32-bit float).
+    @param[in]  args  points to the plp_biquad_df2T_instance_f32_parallel structure
+    @return     none
 */
-void plp_conv_parallel_OLA_kernel(void *task_args);
+
+void plp_biquad_cascade_df2T_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
    @brief      Glue code for matrix matrix multiplication of a 32-bit integer matrices.
@@ -5256,6 +10624,130 @@ void plp_mat_mult_f32_parallel(const float *__restrict__ pSrcA,
                                uint32_t nPE,
                                float *__restrict__ pDstC);
 
+/** -------------------------------------------------------
+    @brief Glue code for tiled matrix multiplication of 32-bit integer matrices in L2, staged
+           through cluster L1 with double-buffered DMA transfers.
+    @param[in]  pSrcA     points to the first input matrix in L2
+    @param[in]  pSrcB     points to the second input matrix in L2
+    @param[in]  M         height of the first input matrix
+    @param[in]  N         width of the first input matrix and hight of the second
+    @param[in]  O         width of the second input matrix
+    @param[in]  nPE       Number of cores to use
+    @param[out] pDstC     points to the output matrix in L2
+    @return     none
+*/
+
+void plp_mat_mult_tiled_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel tiled matrix multiplication of 32-bit integer matrices kernel for XPULPV2
+           extension.
+    @param[in]  args  pointer to plp_mat_mult_tiled_instance_i32 struct initialized by
+                      plp_mat_mult_tiled_i32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_tiled_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for tiled matrix multiplication of 16-bit integer matrices in L2, staged
+           through cluster L1 with double-buffered DMA transfers.
+    @param[in]  pSrcA     points to the first input matrix in L2
+    @param[in]  pSrcB     points to the second input matrix in L2
+    @param[in]  M         height of the first input matrix
+    @param[in]  N         width of the first input matrix and hight of the second
+    @param[in]  O         width of the second input matrix
+    @param[in]  nPE       Number of cores to use
+    @param[out] pDstC     points to the output matrix in L2
+    @return     none
+*/
+
+void plp_mat_mult_tiled_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel tiled matrix multiplication of 16-bit integer matrices kernel for XPULPV2
+           extension.
+    @param[in]  args  pointer to plp_mat_mult_tiled_instance_i16 struct initialized by
+                      plp_mat_mult_tiled_i16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_tiled_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for tiled matrix multiplication of 8-bit integer matrices in L2, staged
+           through cluster L1 with double-buffered DMA transfers.
+    @param[in]  pSrcA     points to the first input matrix in L2
+    @param[in]  pSrcB     points to the second input matrix in L2
+    @param[in]  M         height of the first input matrix
+    @param[in]  N         width of the first input matrix and hight of the second
+    @param[in]  O         width of the second input matrix
+    @param[in]  nPE       Number of cores to use
+    @param[out] pDstC     points to the output matrix in L2
+    @return     none
+*/
+
+void plp_mat_mult_tiled_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel tiled matrix multiplication of 8-bit integer matrices kernel for XPULPV2
+           extension.
+    @param[in]  args  pointer to plp_mat_mult_tiled_instance_i8 struct initialized by
+                      plp_mat_mult_tiled_i8_parallel
+    @return     none
+*/
+
+void plp_mat_mult_tiled_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief Glue code for tiled matrix multiplication of 32-bit floating-point matrices in L2, staged
+           through cluster L1 with double-buffered DMA transfers.
+    @param[in]  pSrcA     points to the first input matrix in L2
+    @param[in]  pSrcB     points to the second input matrix in L2
+    @param[in]  M         height of the first input matrix
+    @param[in]  N         width of the first input matrix and hight of the second
+    @param[in]  O         width of the second input matrix
+    @param[in]  nPE       Number of cores to use
+    @param[out] pDstC     points to the output matrix in L2
+    @return     none
+*/
+
+void plp_mat_mult_tiled_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel tiled matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
+           extension.
+    @param[in]  args  pointer to plp_mat_mult_tiled_instance_f32 struct initialized by
+                      plp_mat_mult_tiled_f32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_tiled_f32p_xpulpv2(void *args);
+
 /** -------------------------------------------------------
     @brief      Parallel matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
                 extension.
@@ -5651,6 +11143,118 @@ void plp_mat_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
 
 void plp_mat_mult_q8p_xpulpv2(void *args);
 
+/** -------------------------------------------------------
+    @brief      Glue code for matrix multiplication of 8-bit matrices with per-channel
+                requantization of the output to 8 bits.
+    @param[in]  pSrcA     points to the first input matrix of shape MxN (activations)
+    @param[in]  pSrcB     points to the second input matrix of shape NxO (weights)
+    @param[in]  M         height of the first input matrix
+    @param[in]  N         width of the first input matrix and hight of the second
+    @param[in]  O         width of the second input matrix, i.e. number of output channels
+    @param[in]  pBias     points to the O biases in accumulator scale, may be NULL
+    @param[in]  pMult     points to the O multipliers
+    @param[in]  pShift    points to the O right shifts
+    @param[out] pDstC     points to the output matrix
+    @return     none
+*/
+
+void plp_mat_mult_q8_requant(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             const int32_t *__restrict__ pBias,
+                             const int32_t *__restrict__ pMult,
+                             const uint32_t *__restrict__ pShift,
+                             int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel matrix multiplication of 8-bit matrices with per-channel
+                requantization of the output to 8 bits.
+    @param[in]  pSrcA     points to the first input matrix of shape MxN (activations)
+    @param[in]  pSrcB     points to the second input matrix of shape NxO (weights)
+    @param[in]  M         height of the first input matrix
+    @param[in]  N         width of the first input matrix and hight of the second
+    @param[in]  O         width of the second input matrix, i.e. number of output channels
+    @param[in]  pBias     points to the O biases in accumulator scale, may be NULL
+    @param[in]  pMult     points to the O multipliers
+    @param[in]  pShift    points to the O right shifts
+    @param[in]  nPE       Number of cores to use
+    @param[out] pDstC     points to the output matrix
+    @return     none
+*/
+
+void plp_mat_mult_q8_requant_parallel(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const int32_t *__restrict__ pBias,
+                                      const int32_t *__restrict__ pMult,
+                                      const uint32_t *__restrict__ pShift,
+                                      uint32_t nPE,
+                                      int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Matrix multiplication of 8-bit matrices with per-channel requantization kernel
+                for RV32IM extension.
+    @param[in]  pSrcA     points to the first input matrix of shape MxN (activations)
+    @param[in]  pSrcB     points to the second input matrix of shape NxO (weights)
+    @param[in]  M         height of the first input matrix
+    @param[in]  N         width of the first input matrix and hight of the second
+    @param[in]  O         width of the second input matrix, i.e. number of output channels
+    @param[in]  pBias     points to the O biases in accumulator scale, may be NULL
+    @param[in]  pMult     points to the O multipliers
+    @param[in]  pShift    points to the O right shifts
+    @param[out] pDstC     points to the output matrix
+    @return     none
+*/
+
+void plp_mat_mult_requant_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     const int32_t *__restrict__ pBias,
+                                     const int32_t *__restrict__ pMult,
+                                     const uint32_t *__restrict__ pShift,
+                                     int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Matrix multiplication of 8-bit matrices with per-channel requantization kernel
+                for XPULPV2 extension.
+    @param[in]  pSrcA     points to the first input matrix of shape MxN (activations)
+    @param[in]  pSrcB     points to the second input matrix of shape NxO (weights)
+    @param[in]  M         height of the first input matrix
+    @param[in]  N         width of the first input matrix and hight of the second
+    @param[in]  O         width of the second input matrix, i.e. number of output channels
+    @param[in]  pBias     points to the O biases in accumulator scale, may be NULL
+    @param[in]  pMult     points to the O multipliers
+    @param[in]  pShift    points to the O right shifts
+    @param[out] pDstC     points to the output matrix
+    @return     none
+*/
+
+void plp_mat_mult_requant_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const int32_t *__restrict__ pBias,
+                                      const int32_t *__restrict__ pMult,
+                                      const uint32_t *__restrict__ pShift,
+                                      int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix multiplication of 8-bit matrices with per-channel requantization
+                kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_requant_instance_q8 struct initialized by
+                      plp_mat_mult_q8_requant_parallel
+    @return     none
+*/
+
+void plp_mat_mult_requant_q8p_xpulpv2(void *args);
+
 /** -------------------------------------------------------
   @brief      Glue code of matrix matrix multiplication for complex 32-bit integers
   @param[in]  pSrcA Points to the first input matrix of shape MxN
@@ -8143,18 +13747,158 @@ void plp_cmplx_mag_q16s_rv32im(const int16_t *pSrc,
                                uint32_t numSamples);
 
 /**
- * @brief      complex magnitude for q16 on XPULPV2
+ * @brief      complex magnitude for q16 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ */
+
+void plp_cmplx_mag_q16s_xpulpv2(const int16_t *pSrc,
+                                const uint32_t fracBits,
+                                int16_t *pRes,
+                                uint32_t numSamples);
+
+/**
+ * @brief      Glue code for parallel complex magnitude calculation in 8-bit integer
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ * @param[in]  nPE         number of parallel processing units
+ */
+
+void plp_cmplx_mag_i8_parallel(const int8_t *pSrc,
+                               int8_t *pRes,
+                               uint32_t numSamples,
+                               uint32_t nPE);
+
+/**
+ * @brief      Glue code for parallel complex magnitude calculation in 16-bit integer
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ * @param[in]  nPE         number of parallel processing units
+ */
+
+void plp_cmplx_mag_i16_parallel(const int16_t *pSrc,
+                                int16_t *pRes,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+ * @brief      Glue code for parallel complex magnitude calculation in 32-bit integer
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ * @param[in]  nPE         number of parallel processing units
+ */
+
+void plp_cmplx_mag_i32_parallel(const int32_t *pSrc,
+                                int32_t *pRes,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+ * @brief      Glue code for parallel complex magnitude calculation in 8-bit fixed point
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ * @param[in]  nPE         number of parallel processing units
+ */
+
+void plp_cmplx_mag_q8_parallel(const int8_t *pSrc,
+                               const uint32_t fracBits,
+                               int8_t *pRes,
+                               uint32_t numSamples,
+                               uint32_t nPE);
+
+/**
+ * @brief      Glue code for parallel complex magnitude calculation in 16-bit fixed point
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(16-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ * @param[in]  nPE         number of parallel processing units
+ */
+
+void plp_cmplx_mag_q16_parallel(const int16_t *pSrc,
+                                const uint32_t fracBits,
+                                int16_t *pRes,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+ * @brief      Glue code for parallel complex magnitude calculation in 32-bit fixed point
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ * @param[in]  nPE         number of parallel processing units
+ */
+
+void plp_cmplx_mag_q32_parallel(const int32_t *pSrc,
+                                const uint32_t fracBits,
+                                int32_t *pRes,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+ * @brief      Glue code for parallel complex magnitude calculation in 32-bit floating point
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ * @param[in]  nPE         number of parallel processing units
+ */
+
+void plp_cmplx_mag_f32_parallel(const float32_t *pSrc,
+                                float32_t *pRes,
+                                uint32_t numSamples,
+                                uint32_t nPE);
+
+/**
+ * @brief      parallel complex magnitude for q8 on XPULPV2
+ *
+ * @param[in]  args  pointer to plp_cmplx_mag_instance_q8 struct initialized by
+ *                   plp_cmplx_mag_q8_parallel
+ */
+
+void plp_cmplx_mag_q8p_xpulpv2(void *args);
+
+/**
+ * @brief      parallel complex magnitude for q16 on XPULPV2
+ *
+ * @param[in]  args  pointer to plp_cmplx_mag_instance_q16 struct initialized by
+ *                   plp_cmplx_mag_q16_parallel
+ */
+
+void plp_cmplx_mag_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      parallel complex magnitude for q32 on XPULPV2
+ *
+ * @param[in]  args  pointer to plp_cmplx_mag_instance_q32 struct initialized by
+ *                   plp_cmplx_mag_q32_parallel
+ */
+
+void plp_cmplx_mag_q32p_xpulpv2(void *args);
+
+/**
+ * @brief      parallel complex magnitude for float32 on XPULPV2
  *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number of samples
+ * @param[in]  args  pointer to plp_cmplx_mag_instance_f32 struct initialized by
+ *                   plp_cmplx_mag_f32_parallel
  */
 
-void plp_cmplx_mag_q16s_xpulpv2(const int16_t *pSrc,
-                                const uint32_t fracBits,
-                                int16_t *pRes,
-                                uint32_t numSamples);
+void plp_cmplx_mag_f32p_xpulpv2(void *args);
 
 /**
   @brief      In-place 16 bit reversal function for RV32IM
@@ -8321,6 +14065,20 @@ plp_bitreversal_32s_rv32im(uint32_t *pSrc, const uint16_t bitRevLen, const uint1
 void
 plp_bitreversal_32s_xpulpv2(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab);
 
+/**
+  @brief         In-place 32 bit reversal function (parallel version).
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]     bitRevLen   bit reversal table length
+  @param[in]     pBitRevTab  points to bit reversal table
+  @param[in]     nPE         number of cores
+  @return        none
+*/
+
+void plp_bitreversal_32p_xpulpv2(uint32_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab,
+                                 uint32_t nPE);
+
 /**
  * @brief      Glue code for quantized 32-bit complex fast fourier transform
  * 
@@ -8349,6 +14107,37 @@ void plp_cfft_q32(const plp_cfft_instance_q32 *S,
                       uint8_t bitReverseFlag,
                       uint32_t fracBits);
 
+/**
+ * @brief      Glue code for parallel quantized 32-bit complex fast fourier transform
+ *
+ * Stage s (radix-2 stage first for the lengths 2*4^k, then the radix-4 stages) divides its
+ * outputs by its radix if bit s of scaleMask is set. With PLP_CFFT_Q32_SCALE_ALL, the forward
+ * transform returns DFT / N, the inverse transform returns the IDFT, and no stage overflows as
+ * long as the input values have a magnitude below 1 (Q1.31).
+ *
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  scaleMask       bit s enables the down-scaling of stage s
+ * @param[in]  nPE             number of cores to use
+ */
+
+void plp_cfft_q32_parallel(const plp_cfft_instance_q32 *S,
+                           int32_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t scaleMask,
+                           uint32_t nPE);
+
+/**
+ * @brief      Parallel quantized 32 bit complex fast fourier transform for XPULPV2
+ * @param[in]   args    points to the plp_cfft_instance_q32_parallel
+ */
+
+void plp_cfft_q32p_xpulpv2(void *args);
+
 /**
  * @brief      Quantized 32-bit complex fast fourier transform for RV32IM
  *
@@ -8420,10 +14209,52 @@ void plp_rfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
 
 /**
    @brief  Floating-point FFT on real input data for XPULPV2 extension (parallel version).
-   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @param[in]   args      points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_rfft_f32_xpulpv2_parallel(void *args);
+
+/**
+   @brief In-place floating-point FFT on real input data.
+   @param[in]   S           points to an instance of the floating-point FFT structure
+   @param[in,out] pSrcDst   points to the buffer of (FFTLength + 2) values, holding the real input
+                            in the first FFTLength values and, afterwards, the (FFTLength / 2 + 1)
+                            complex output values. No further scratch memory is needed
+   @return      none
+*/
+void plp_rfft_in_place_f32(const plp_fft_instance_f32 *S, float32_t *pSrcDst);
+
+/**
+   @brief In-place floating-point FFT on real input data (parallel version).
+   @param[in]   S           points to an instance of the floating-point FFT structure
+   @param[in,out] pSrcDst   points to the buffer of (FFTLength + 2) values, holding the real input
+                            in the first FFTLength values and, afterwards, the (FFTLength / 2 + 1)
+                            complex output values. No further scratch memory is needed
+   @param[in]   nPE         number of parallel processing units
+   @return      none
+*/
+void plp_rfft_in_place_f32_parallel(const plp_fft_instance_f32 *S,
+                                    float32_t *pSrcDst,
+                                    const uint32_t nPE);
+
+/**
+   @brief In-place floating-point FFT on real input data for XPULPV2 extension.
+   @param[in]   S           points to an instance of the floating-point FFT structure
+   @param[in,out] pSrcDst   points to the buffer of (FFTLength + 2) values, holding the real input
+                            in the first FFTLength values and, afterwards, the (FFTLength / 2 + 1)
+                            complex output values. No further scratch memory is needed
+   @return      none
+*/
+void plp_rfft_in_place_f32_xpulpv2(const plp_fft_instance_f32 *S, float32_t *pSrcDst);
+
+/**
+   @brief In-place floating-point FFT on real input data for XPULPV2 extension (parallel
+          version).
+   @param[in]   args    points to an instance of the floating-point FFT structure, pSrc and pDst
+                        both point to the buffer of (FFTLength + 2) values
    @return      none
 */
-void plp_rfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
+void plp_rfft_in_place_f32_xpulpv2_parallel(void *args);
 
 /**
    @brief Floating-point FFT on complex input data.
@@ -8462,10 +14293,190 @@ void plp_cfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
 
 /**
    @brief  Floating-point FFT on complex input data for XPULPV2 extension (parallel version).
-   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @param[in]   args      points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_cfft_f32_xpulpv2_parallel(void *args);
+
+/**
+   @brief In-place floating-point FFT on complex input data.
+   @param[in]   S           points to an instance of the floating-point FFT structure
+   @param[in,out] pSrcDst   points to the buffer of 2*FFTLength values, holding the complex input
+                            and, afterwards, the complex output. No further scratch memory is
+                            needed
+   @return      none
+*/
+void plp_cfft_in_place_f32(const plp_fft_instance_f32 *S, float32_t *pSrcDst);
+
+/**
+   @brief In-place floating-point FFT on complex input data (parallel version).
+   @param[in]   S           points to an instance of the floating-point FFT structure
+   @param[in,out] pSrcDst   points to the buffer of 2*FFTLength values, holding the complex input
+                            and, afterwards, the complex output. No further scratch memory is
+                            needed
+   @param[in]   nPE         number of parallel processing units
+   @return      none
+*/
+void plp_cfft_in_place_f32_parallel(const plp_fft_instance_f32 *S,
+                                    float32_t *pSrcDst,
+                                    const uint32_t nPE);
+
+/**
+   @brief Floating-point inverse FFT on complex input data, scaled by 1/FFTLength.
+   @param[in]   S       points to an instance of the floating-point FFT structure, the same as
+                        for the forward transform
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data), can be equal to pSrc
+   @return      none
+*/
+void plp_cifft_f32(const plp_fft_instance_f32 *S, const float32_t *pSrc, float32_t *pDst);
+
+/**
+   @brief Floating-point inverse FFT on complex input data, scaled by 1/FFTLength (parallel
+          version).
+   @param[in]   S       points to an instance of the floating-point FFT structure, the same as
+                        for the forward transform
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer (complex data), can be equal to pSrc
+   @return      none
+*/
+void plp_cifft_f32_parallel(const plp_fft_instance_f32 *S,
+                            const float32_t *pSrc,
+                            const uint32_t nPE,
+                            float32_t *pDst);
+
+/**
+   @brief  Floating-point inverse FFT on complex input data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data), can be equal to pSrc
+   @return      none
+*/
+void plp_cifft_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pDst);
+
+/**
+   @brief  Floating-point inverse FFT on complex input data for XPULPV2 extension (parallel
+           version).
+   @param[in]   args      points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_cifft_f32_xpulpv2_parallel(void *args);
+
+/**
+   @brief Floating-point inverse FFT with real output data, scaled by 1/FFTLength.
+   @param[in]   S       points to an instance of the floating-point FFT structure, the same as
+                        for plp_rfft_f32
+   @param[in]   pSrc    points to the input buffer of (FFTLength / 2 + 1) complex values, the
+                        first half of a spectrum with conjugate symmetry
+   @param[out]  pDst    points to the output buffer of FFTLength real values. It can be equal to
+                        pSrc, the buffer then needs (FFTLength + 2) values
+   @return      none
+*/
+void plp_rifft_f32(const plp_fft_instance_f32 *S, const float32_t *pSrc, float32_t *pDst);
+
+/**
+   @brief Floating-point inverse FFT with real output data, scaled by 1/FFTLength (parallel
+          version).
+   @param[in]   S       points to an instance of the floating-point FFT structure, the same as
+                        for plp_rfft_f32
+   @param[in]   pSrc    points to the input buffer of (FFTLength / 2 + 1) complex values, the
+                        first half of a spectrum with conjugate symmetry
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer of FFTLength real values. It can be equal to
+                        pSrc, the buffer then needs (FFTLength + 2) values
+   @return      none
+*/
+void plp_rifft_f32_parallel(const plp_fft_instance_f32 *S,
+                            const float32_t *pSrc,
+                            const uint32_t nPE,
+                            float32_t *pDst);
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer of (FFTLength / 2 + 1) complex values
+   @param[out]  pDst    points to the output buffer of FFTLength real values, can be equal to pSrc
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pDst);
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension (parallel
+           version).
+   @param[in]   args     points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2_parallel(void *args);
+
+/**
+   @brief  Mixed radix-8/4 floating-point FFT on complex input data for XPULPV2 extension.
+           The output is left in bit-reversed order (see plp_cfft_mixed_rev_index_f32).
+   @param[in]   pSrc            points to the input buffer (complex data)
+   @param[out]  pDst            points to the output buffer (complex data)
+   @param[in]   FFTLength       length of the FFT (power of two)
+   @param[in]   pTwiddleFactors points to the twiddle factors of half a period
+                                (FFTLength * twiddleStride / 2 values)
+   @param[in]   twiddleStride   stride between the twiddle factors read by the FFT
+   @return      none
+*/
+void plp_cfft_mixed_f32_xpulpv2(const float32_t *pSrc,
+                                float32_t *pDst,
+                                uint32_t FFTLength,
+                                const float32_t *pTwiddleFactors,
+                                uint32_t twiddleStride);
+
+/**
+   @brief  Mixed radix-8/4 floating-point FFT on complex input data for XPULPV2 extension
+           (parallel version, called by all the cores of a team).
+   @param[in]   pSrc            points to the input buffer (complex data)
+   @param[out]  pDst            points to the output buffer (complex data)
+   @param[in]   FFTLength       length of the FFT (power of two)
+   @param[in]   pTwiddleFactors points to the twiddle factors of half a period
+   @param[in]   twiddleStride   stride between the twiddle factors read by the FFT
+   @param[in]   nPE             number of cores of the team
+   @return      none
+*/
+void plp_cfft_mixed_f32_xpulpv2_parallel(const float32_t *pSrc,
+                                         float32_t *pDst,
+                                         uint32_t FFTLength,
+                                         const float32_t *pTwiddleFactors,
+                                         uint32_t twiddleStride,
+                                         uint32_t nPE);
+
+/**
+   @brief  Mixed radix-8/4 floating-point FFT on windowed complex input data for XPULPV2
+           extension (parallel version, called by all the cores of a team). The window is applied
+           while the first stage loads the input.
+   @param[in]   pSrc            points to the input buffer (complex data)
+   @param[in]   pWindow         points to the window (2*FFTLength values), NULL for no window
+   @param[out]  pDst            points to the output buffer (complex data)
+   @param[in]   FFTLength       length of the FFT (power of two)
+   @param[in]   pTwiddleFactors points to the twiddle factors of half a period
+   @param[in]   twiddleStride   stride between the twiddle factors read by the FFT
+   @param[in]   nPE             number of cores of the team
    @return      none
 */
-void plp_cfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
+void plp_cfft_mixed_windowed_f32_xpulpv2_parallel(const float32_t *pSrc,
+                                                  const float32_t *pWindow,
+                                                  float32_t *pDst,
+                                                  uint32_t FFTLength,
+                                                  const float32_t *pTwiddleFactors,
+                                                  uint32_t twiddleStride,
+                                                  uint32_t nPE);
+
+/**
+   @brief  Position of a frequency bin in the output of the mixed-radix FFT.
+   @param[in]   index       frequency bin
+   @param[in]   FFTLength   length of the FFT (power of two)
+   @return      position of bin index in the output of plp_cfft_mixed_f32_xpulpv2, i.e. index
+                bit-reversed over log2(FFTLength) bits
+*/
+uint32_t plp_cfft_mixed_rev_index_f32(uint32_t index, uint32_t FFTLength);
 
 /**
    @brief Floating-point DCT on real input data. Implementation of
@@ -8544,7 +14555,7 @@ void plp_mfcc_f32(const plp_fft_instance_f32 *SFFT,
                   const Complex_type_f32 *pShift,
                   const plp_triangular_filter_f32 *filterBank,
 		  const float32_t *window,
-		  const uint8_t *orthoNorm,
+		  const uint8_t orthoNorm,
                   const float32_t *__restrict__ pSrc,
                   float32_t *__restrict__ pDst);
 
@@ -8569,6 +14580,7 @@ void plp_mfcc_f32(const plp_fft_instance_f32 *SFFT,
                             pSrc and pDst must not overlap, the calculation can
                             not be done in place. 
                             MFCCs are returned in the first n_mels spots.
+                            n_mels must be a power of two, at least 16 and at most n_fft/2.
    @return      none
 */
 
@@ -8578,11 +14590,18 @@ void plp_mfcc_f32_parallel(const plp_fft_instance_f32 *SFFT,
                 	   const Complex_type_f32 *pShift,
                 	   const plp_triangular_filter_f32 *filterBank,
 			   const float32_t *window,
-			   const uint8_t *orthoNorm,
+			   const uint8_t orthoNorm,
                 	   const float32_t *__restrict__ pSrc,
 			   const uint32_t nPE,
                 	   float32_t *__restrict__ pDst);
 
+/**
+   @brief  Fused MFCC on real input data for XPULPV2 extension (parallel version).
+   @param[in]   args  points to the instance structure plp_mfcc_instance_f32_parallel
+   @return      none
+*/
+void plp_mfcc_f32p_xpulpv2(void *args);
+
 /** -------------------------------------------------------
   @brief      Glue code for matrix addition of a 32-bit integer matrices.
   @param[in]  pSrcA   Points to the first input matrix
@@ -9672,88 +15691,249 @@ void plp_mat_trans_i8(const int8_t *__restrict__ pSrc,
   @return     none
 */
 
-void plp_mat_trans_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                              uint32_t M,
-                              uint32_t N,
-                              int8_t *__restrict__ pDst);
+void plp_mat_trans_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose of a 8-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix transpose of a 8-bit integer matrices.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_i8_parallel(const int8_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t nPE,
+                               int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel matrix transpose of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  args      pointer to plp_mat_trans_instance_i8 struct initialized by
+  plp_mat_trans_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_trans_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix transpose of a 32-bit float*ing-point matrices.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_i32s_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_f32(const float *__restrict__ pSrc,
+                       uint32_t M,
+                       uint32_t N,
+                       float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix transpose of a 32-bit float*ing-point matrices.
+  @param[in]  pSrc Points to the input matrix of shape MxN
+  @param[in]  M    Height of the input matrix and width of the output matrix
+  @param[in]  N    Width of the input matrix and height of the output matrix
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_i32p_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_f32_parallel(
+    const float *__restrict__ pSrc, uint32_t M, uint32_t N, uint32_t nPE, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place transpose of a square 32-bit integer matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i32(int32_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place transpose of a square 32-bit integer matrix kernel for RV32IM extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i32s_rv32im(int32_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place transpose of a square 32-bit integer matrix kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i32s_xpulpv2(int32_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place transpose of a square 32-bit integer matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @param[in]     nPE     Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i32_parallel(int32_t *__restrict__ pSrcDst, uint32_t N, uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief      Parallel in-place transpose of a square 32-bit integer matrix kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_trans_in_place_instance_i32 struct initialized by
+                    plp_mat_trans_in_place_i32_parallel
+  @return     none
+*/
+
+void plp_mat_trans_in_place_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place transpose of a square 16-bit integer matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i16(int16_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place transpose of a square 16-bit integer matrix kernel for RV32IM extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i16s_rv32im(int16_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      In-place transpose of a square 16-bit integer matrix kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i16s_xpulpv2(int16_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place transpose of a square 16-bit integer matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @param[in]     nPE     Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i16_parallel(int16_t *__restrict__ pSrcDst, uint32_t N, uint32_t nPE);
 
 /** -------------------------------------------------------
-  @brief      matrix transpose of a 8-bit integer matrices for XPULPV2 extension.
-  @param[in]  pSrc Points to the input matrix of shape MxN
-  @param[in]  M    Height of the input matrix and width of the output matrix
-  @param[in]  N    Width of the input matrix and height of the output matrix
-  @param[out] pDst Points to the output matrix of shape NxM
+  @brief      Parallel in-place transpose of a square 16-bit integer matrix kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_trans_in_place_instance_i16 struct initialized by
+                    plp_mat_trans_in_place_i16_parallel
   @return     none
+*/
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+void plp_mat_trans_in_place_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place transpose of a square 8-bit integer matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @return        none
 */
 
-void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                               uint32_t M,
-                               uint32_t N,
-                               int8_t *__restrict__ pDst);
+void plp_mat_trans_in_place_i8(int8_t *__restrict__ pSrcDst, uint32_t N);
 
 /** -------------------------------------------------------
-  @brief      Glue code for parallel matrix transpose of a 8-bit integer matrices.
-  @param[in]  pSrc Points to the input matrix of shape MxN
-  @param[in]  M    Height of the input matrix and width of the output matrix
-  @param[in]  N    Width of the input matrix and height of the output matrix
-  @param[in]  nPE  Number of cores to use for computation
-  @param[out] pDst Points to the output matrix of shape NxM
-  @return     none
+  @brief      In-place transpose of a square 8-bit integer matrix kernel for RV32IM extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @return        none
 */
 
-void plp_mat_trans_i8_parallel(const int8_t *__restrict__ pSrc,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t nPE,
-                               int8_t *__restrict__ pDst);
+void plp_mat_trans_in_place_i8s_rv32im(int8_t *__restrict__ pSrcDst, uint32_t N);
 
 /** -------------------------------------------------------
-  @brief Parallel matrix transpose of 8-bit integer matrices kernel for XPULPV2 extension.
-  @param[in]  args      pointer to plp_mat_trans_instance_i8 struct initialized by
-  plp_mat_trans_i8_parallel
-  @return     none
+  @brief      In-place transpose of a square 8-bit integer matrix kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @return        none
+*/
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+void plp_mat_trans_in_place_i8s_xpulpv2(int8_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel in-place transpose of a square 8-bit integer matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @param[in]     nPE     Number of cores to use for computation
+  @return        none
 */
 
-void plp_mat_trans_i8p_xpulpv2(void *args);
+void plp_mat_trans_in_place_i8_parallel(int8_t *__restrict__ pSrcDst, uint32_t N, uint32_t nPE);
 
 /** -------------------------------------------------------
-  @brief      Glue code for matrix transpose of a 32-bit float*ing-point matrices.
-  @param[in]  pSrc Points to the input matrix of shape MxN
-  @param[in]  M    Height of the input matrix and width of the output matrix
-  @param[in]  N    Width of the input matrix and height of the output matrix
-  @param[out] pDst Points to the output matrix of shape NxM
+  @brief      Parallel in-place transpose of a square 8-bit integer matrix kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_trans_in_place_instance_i8 struct initialized by
+                    plp_mat_trans_in_place_i8_parallel
   @return     none
+*/
 
-  @par This function will use plp_mat_trans_i32s_xpulpv2 for its computation.
+void plp_mat_trans_in_place_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place transpose of a square 32-bit floating-point matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @return        none
+
+  @par This function will use plp_mat_trans_in_place_i32s_xpulpv2 for its computation.
 */
 
-void plp_mat_trans_f32(const float *__restrict__ pSrc,
-                       uint32_t M,
-                       uint32_t N,
-                       float *__restrict__ pDst);
+void plp_mat_trans_in_place_f32(float *__restrict__ pSrcDst, uint32_t N);
 
 /** -------------------------------------------------------
-  @brief      Glue code for parallel matrix transpose of a 32-bit float*ing-point matrices.
-  @param[in]  pSrc Points to the input matrix of shape MxN
-  @param[in]  M    Height of the input matrix and width of the output matrix
-  @param[in]  N    Width of the input matrix and height of the output matrix
-  @param[in]  nPE  Number of cores to use for computation
-  @param[out] pDst Points to the output matrix of shape NxM
-  @return     none
+  @brief      Glue code for parallel in-place transpose of a square 32-bit floating-point matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, overwritten by its transpose
+  @param[in]     N       Height and width of the matrix
+  @param[in]     nPE     Number of cores to use for computation
+  @return        none
 
-  @par This function will use plp_mat_trans_i32p_xpulpv2 for its computation.
+  @par This function will use plp_mat_trans_in_place_i32p_xpulpv2 for its computation.
 */
 
-void plp_mat_trans_f32_parallel(
-    const float *__restrict__ pSrc, uint32_t M, uint32_t N, uint32_t nPE, float *__restrict__ pDst);
+void plp_mat_trans_in_place_f32_parallel(float *__restrict__ pSrcDst, uint32_t N, uint32_t nPE);
 
 /** -------------------------------------------------------
   @brief      Glue code for matrix inverse of a 32-bit floating-point matrices.
@@ -9792,11 +15972,330 @@ int plp_mat_inv_f32_parallel(float *__restrict__ pSrc,
 /** -------------------------------------------------------
   @brief Parallel matrix inverse of 32-bit floating-point matrices kernel for XPULPV2 extension.
   @param[in]  args  pointer to plp_mat_inv_instance_f32 struct initialized by
-                    plp_mat_inv_f32_parallel
-  @return     0: Success, 1: Matrix is singular
+                    plp_mat_inv_f32_parallel. The result (0: Success, 1: Matrix is singular) is
+                    returned in its ret field.
+  @return     none
+*/
+
+void plp_mat_inv_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the Cholesky decomposition of a 32-bit floating-point matrix.
+    @param[in]  pSrc  Points to the symmetric positive definite input matrix of shape NxN, only its
+                      lower triangle is read
+    @param[in]  N     Width and height of both matrices
+    @param[out] pDstL Points to the lower triangular output matrix L of shape NxN, its upper
+                      triangle is set to zero
+    @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_f32(const float *__restrict__ pSrc,
+                         uint32_t N,
+                         float *__restrict__ pDstL);
+
+/** -------------------------------------------------------
+    @brief      Cholesky decomposition of a 32-bit floating-point matrix kernel for XPULPV2
+                extension.
+    @param[in]  pSrc  Points to the symmetric positive definite input matrix of shape NxN, only its
+                      lower triangle is read
+    @param[in]  N     Width and height of both matrices
+    @param[out] pDstL Points to the lower triangular output matrix L of shape NxN, its upper
+                      triangle is set to zero
+    @return     0: Success, 1: Matrix is not positive definite
+*/
+
+int plp_mat_cholesky_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                  uint32_t N,
+                                  float *__restrict__ pDstL);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel Cholesky decomposition of a 32-bit floating-point
+                matrix.
+    @param[in]  pSrc  Points to the symmetric positive definite input matrix of shape NxN, only its
+                      lower triangle is read
+    @param[in]  N     Width and height of both matrices
+    @param[in]  nPE   Number of cores to use for computation
+    @param[out] pDstL Points to the lower triangular output matrix L of shape NxN, its upper
+                      triangle is set to zero
+    @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_f32_parallel(const float *__restrict__ pSrc,
+                                  uint32_t N,
+                                  uint32_t nPE,
+                                  float *__restrict__ pDstL);
+
+/** -------------------------------------------------------
+    @brief      Parallel Cholesky decomposition of a 32-bit floating-point matrix kernel for
+                XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_cholesky_instance_f32 struct initialized by
+                      plp_mat_cholesky_f32_parallel. The result (0: Success, 1: Matrix is not
+                      positive definite) is returned in its ret field.
+    @return     none
+*/
+
+void plp_mat_cholesky_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the LU decomposition of a 32-bit floating-point matrix.
+    @param[in,out] pSrcDst Points to the input matrix of shape NxN, which is
+                          overwritten with L below the diagonal (without its unit diagonal) and U
+                          on and above the diagonal
+    @param[in]     N       Width and height of the matrix
+    @param[out]    pPerm   Points to the N row indices of the input matrix, row i of L * U is row
+                           pPerm[i] of the input matrix
+    @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_lu_f32(float *__restrict__ pSrcDst,
+                   uint32_t N,
+                   uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+    @brief      LU decomposition of a 32-bit floating-point matrix kernel for XPULPV2 extension.
+    @param[in,out] pSrcDst Points to the input matrix of shape NxN, which is
+                          overwritten with L below the diagonal (without its unit diagonal) and U
+                          on and above the diagonal
+    @param[in]     N       Width and height of the matrix
+    @param[out]    pPerm   Points to the N row indices of the input matrix, row i of L * U is row
+                           pPerm[i] of the input matrix
+    @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_lu_f32s_xpulpv2(float *__restrict__ pSrcDst,
+                            uint32_t N,
+                            uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the parallel LU decomposition of a 32-bit floating-point matrix.
+    @param[in,out] pSrcDst Points to the input matrix of shape NxN, which is
+                          overwritten with L below the diagonal (without its unit diagonal) and U
+                          on and above the diagonal
+    @param[in]     N       Width and height of the matrix
+    @param[in]     nPE     Number of cores to use for computation
+    @param[out]    pPerm   Points to the N row indices of the input matrix, row i of L * U is row
+                           pPerm[i] of the input matrix
+    @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_lu_f32_parallel(float *__restrict__ pSrcDst,
+                            uint32_t N,
+                            uint32_t nPE,
+                            uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+    @brief      Parallel LU decomposition of a 32-bit floating-point matrix kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_lu_instance_f32 struct initialized by
+                      plp_mat_lu_f32_parallel. The result (0: Success, 1: Matrix is singular) is
+                      returned in its ret field.
+    @return     none
+*/
+
+void plp_mat_lu_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for solving a lower triangular system of 32-bit floating-point
+                equations.
+    @param[in]  pSrcL Points to the lower triangular matrix of shape NxN
+    @param[in]  pSrcB Points to the right-hand side matrix of shape NxK
+    @param[in]  N     Width and height of the triangular matrix
+    @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+    @param[in]  unitDiag 1: The diagonal of pSrcL is not read and taken as one, 0: pSrcL has a
+                         general diagonal
+    @param[out] pDstX Points to the solution matrix of shape NxK
+    @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_lower_triangular_f32(const float *__restrict__ pSrcL,
+                                       const float *__restrict__ pSrcB,
+                                       uint32_t N,
+                                       uint32_t K,
+                                       uint8_t unitDiag,
+                                       float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+    @brief      Solve a lower triangular system of 32-bit floating-point equations by
+                forward substitution, kernel for XPULPV2 extension.
+    @param[in]  pSrcL Points to the lower triangular matrix of shape NxN
+    @param[in]  pSrcB Points to the right-hand side matrix of shape NxK
+    @param[in]  N     Width and height of the triangular matrix
+    @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+    @param[in]  unitDiag 1: The diagonal of pSrcL is not read and taken as one, 0: pSrcL has a
+                         general diagonal
+    @param[out] pDstX Points to the solution matrix of shape NxK
+    @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_solve_lower_triangular_f32s_xpulpv2(const float *__restrict__ pSrcL,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t K,
+                                                uint8_t unitDiag,
+                                                float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+    @brief      Glue code for solving a lower triangular system of 32-bit floating-point
+                equations in parallel.
+    @param[in]  pSrcL Points to the lower triangular matrix of shape NxN
+    @param[in]  pSrcB Points to the right-hand side matrix of shape NxK
+    @param[in]  N     Width and height of the triangular matrix
+    @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+    @param[in]  unitDiag 1: The diagonal of pSrcL is not read and taken as one, 0: pSrcL has a
+                         general diagonal
+    @param[in]  nPE   Number of cores to use for computation
+    @param[out] pDstX Points to the solution matrix of shape NxK
+    @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_lower_triangular_f32_parallel(const float *__restrict__ pSrcL,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t K,
+                                                uint8_t unitDiag,
+                                                uint32_t nPE,
+                                                float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+    @brief      Parallel solve of a lower triangular system of 32-bit floating-point
+                equations, kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_solve_triangular_instance_f32 struct initialized by
+                      plp_mat_solve_lower_triangular_f32_parallel. The result (0: Success, 1:
+                      Matrix is singular) is returned in its ret field.
+    @return     none
+*/
+
+void plp_mat_solve_lower_triangular_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for solving an upper triangular system of 32-bit floating-point
+                equations.
+    @param[in]  pSrcU Points to the upper triangular matrix of shape NxN
+    @param[in]  pSrcB Points to the right-hand side matrix of shape NxK
+    @param[in]  N     Width and height of the triangular matrix
+    @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+    @param[out] pDstX Points to the solution matrix of shape NxK
+    @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_upper_triangular_f32(const float *__restrict__ pSrcU,
+                                       const float *__restrict__ pSrcB,
+                                       uint32_t N,
+                                       uint32_t K,
+                                       float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+    @brief      Solve an upper triangular system of 32-bit floating-point equations by
+                back substitution, kernel for XPULPV2 extension.
+    @param[in]  pSrcU Points to the upper triangular matrix of shape NxN
+    @param[in]  pSrcB Points to the right-hand side matrix of shape NxK
+    @param[in]  N     Width and height of the triangular matrix
+    @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+    @param[out] pDstX Points to the solution matrix of shape NxK
+    @return     0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_solve_upper_triangular_f32s_xpulpv2(const float *__restrict__ pSrcU,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t K,
+                                                float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+    @brief      Glue code for solving an upper triangular system of 32-bit floating-point
+                equations in parallel.
+    @param[in]  pSrcU Points to the upper triangular matrix of shape NxN
+    @param[in]  pSrcB Points to the right-hand side matrix of shape NxK
+    @param[in]  N     Width and height of the triangular matrix
+    @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+    @param[in]  nPE   Number of cores to use for computation
+    @param[out] pDstX Points to the solution matrix of shape NxK
+    @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_upper_triangular_f32_parallel(const float *__restrict__ pSrcU,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t K,
+                                                uint32_t nPE,
+                                                float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+    @brief      Parallel solve of an upper triangular system of 32-bit floating-point
+                equations, kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_solve_triangular_instance_f32 struct initialized by
+                      plp_mat_solve_upper_triangular_f32_parallel. The result (0: Success, 1:
+                      Matrix is singular) is returned in its ret field.
+    @return     none
+*/
+
+void plp_mat_solve_upper_triangular_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for solving a system of 32-bit floating-point linear equations.
+    @param[in]  pSrcA Points to the matrix of shape NxN. pSrcA is modified by this function
+    @param[in]  pSrcB Points to the right-hand side matrix of shape NxK. pSrcB is modified by this
+                      function
+    @param[in]  N     Width and height of pSrcA
+    @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+    @param[out] pDstX Points to the solution matrix of shape NxK
+    @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_f32(float *__restrict__ pSrcA,
+                      float *__restrict__ pSrcB,
+                      uint32_t N,
+                      uint32_t K,
+                      float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+    @brief      Solve a system of 32-bit floating-point linear equations, kernel for XPULPV2
+                extension.
+    @param[in]  pSrcA Points to the matrix of shape NxN. pSrcA is modified by this function
+    @param[in]  pSrcB Points to the right-hand side matrix of shape NxK. pSrcB is modified by this
+                      function
+    @param[in]  N     Width and height of pSrcA
+    @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+    @param[out] pDstX Points to the solution matrix of shape NxK
+    @return     0: Success, 1: Matrix is singular
 */
 
-int plp_mat_inv_f32p_xpulpv2(void *args);
+int plp_mat_solve_f32s_xpulpv2(float *__restrict__ pSrcA,
+                               float *__restrict__ pSrcB,
+                               uint32_t N,
+                               uint32_t K,
+                               float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+    @brief      Glue code for solving a system of 32-bit floating-point linear equations in
+                parallel.
+    @param[in]  pSrcA Points to the matrix of shape NxN. pSrcA is modified by this function
+    @param[in]  pSrcB Points to the right-hand side matrix of shape NxK. pSrcB is modified by this
+                      function
+    @param[in]  N     Width and height of pSrcA
+    @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+    @param[in]  nPE   Number of cores to use for computation
+    @param[out] pDstX Points to the solution matrix of shape NxK
+    @return     0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_solve_f32_parallel(float *__restrict__ pSrcA,
+                               float *__restrict__ pSrcB,
+                               uint32_t N,
+                               uint32_t K,
+                               uint32_t nPE,
+                               float *__restrict__ pDstX);
+
+/** -------------------------------------------------------
+    @brief      Parallel solve of a system of 32-bit floating-point linear equations, kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_solve_instance_f32 struct initialized by
+                      plp_mat_solve_f32_parallel. The result (0: Success, 1: Matrix is singular) is
+                      returned in its ret field.
+    @return     none
+*/
+
+void plp_mat_solve_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
   @brief      Glue code for creating a 32-bit integer identity matrix
@@ -16067,74 +22566,162 @@ void plp_cmplx_conj_i32_rv32im(const int32_t *__restrict__ pSrc,
                                uint32_t numSamples);
 
 /**
-  @brief Glue code for complex conjugate of 16-bit integer vectors.
+  @brief Glue code for complex conjugate of 16-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_conj_i16(const int16_t *__restrict__ pSrc,
+                        int16_t *__restrict__ pDst,
+                        uint32_t numSamples);
+
+/**
+  @brief         16-bit integer complex conjugate.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_conj_i16_xpulpv2(const int16_t *__restrict__ pSrc,
+                                int16_t *__restrict__ pDst,
+                                uint32_t numSamples);
+
+/**
+  @brief         16-bit integer complex conjugate.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_conj_i16_rv32im(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief Glue code for complex conjugate of 8-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_conj_i8(const int8_t *__restrict__ pSrc,
+                       int8_t *__restrict__ pDst,
+                       uint32_t numSamples);
+
+/**
+  @brief         8-bit integer complex conjugate.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_conj_i8_xpulpv2(const int8_t *__restrict__ pSrc,
+                               int8_t *__restrict__ pDst,
+                               uint32_t numSamples);
+
+/**
+  @brief         8-bit integer complex conjugate.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_conj_i8_rv32im(const int8_t *__restrict__ pSrc,
+                              int8_t *__restrict__ pDst,
+                              uint32_t numSamples);
+
+/**
+  @brief         Glue code for parallel complex conjugate of 32-bit float vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_conj_f32_parallel(const float32_t *__restrict__ pSrc,
+                                 float32_t *__restrict__ pDst,
+                                 uint32_t numSamples,
+                                 uint32_t nPE);
+
+/**
+  @brief         Parallel complex conjugate of 32-bit float vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_f32 structure
+  @return        none
+ */
+
+void plp_cmplx_conj_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex conjugate of 32-bit integer vectors.
   @param[in]     pSrc        points to the input vector
   @param[out]    pDst        points to the output vector
   @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
   @return        none
  */
-void plp_cmplx_conj_i16(const int16_t *__restrict__ pSrc,
-                        int16_t *__restrict__ pDst,
-                        uint32_t numSamples);
+
+void plp_cmplx_conj_i32_parallel(const int32_t *__restrict__ pSrc,
+                                 int32_t *__restrict__ pDst,
+                                 uint32_t numSamples,
+                                 uint32_t nPE);
 
 /**
-  @brief         16-bit integer complex conjugate.
-  @param[in]     pSrc        points to the input vector
-  @param[out]    pDst        points to the output vector
-  @param[in]     numSamples  number of samples in each vector
+  @brief         Parallel complex conjugate of 32-bit integer vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i32 structure
   @return        none
  */
 
-void plp_cmplx_conj_i16_xpulpv2(const int16_t *__restrict__ pSrc,
-                                int16_t *__restrict__ pDst,
-                                uint32_t numSamples);
+void plp_cmplx_conj_i32p_xpulpv2(void *args);
 
 /**
-  @brief         16-bit integer complex conjugate.
+  @brief         Glue code for parallel complex conjugate of 16-bit integer vectors.
   @param[in]     pSrc        points to the input vector
   @param[out]    pDst        points to the output vector
   @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
   @return        none
  */
 
-void plp_cmplx_conj_i16_rv32im(const int16_t *__restrict__ pSrc,
-                               int16_t *__restrict__ pDst,
-                               uint32_t numSamples);
+void plp_cmplx_conj_i16_parallel(const int16_t *__restrict__ pSrc,
+                                 int16_t *__restrict__ pDst,
+                                 uint32_t numSamples,
+                                 uint32_t nPE);
 
 /**
-  @brief Glue code for complex conjugate of 8-bit integer vectors.
-  @param[in]     pSrc        points to the input vector
-  @param[out]    pDst        points to the output vector
-  @param[in]     numSamples  number of samples in each vector
+  @brief         Parallel complex conjugate of 16-bit integer vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i16 structure
   @return        none
  */
-void plp_cmplx_conj_i8(const int8_t *__restrict__ pSrc,
-                       int8_t *__restrict__ pDst,
-                       uint32_t numSamples);
+
+void plp_cmplx_conj_i16p_xpulpv2(void *args);
 
 /**
-  @brief         8-bit integer complex conjugate.
+  @brief         Glue code for parallel complex conjugate of 8-bit integer vectors.
   @param[in]     pSrc        points to the input vector
   @param[out]    pDst        points to the output vector
   @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
   @return        none
  */
 
-void plp_cmplx_conj_i8_xpulpv2(const int8_t *__restrict__ pSrc,
-                               int8_t *__restrict__ pDst,
-                               uint32_t numSamples);
+void plp_cmplx_conj_i8_parallel(const int8_t *__restrict__ pSrc,
+                                int8_t *__restrict__ pDst,
+                                uint32_t numSamples,
+                                uint32_t nPE);
 
 /**
-  @brief         8-bit integer complex conjugate.
-  @param[in]     pSrc        points to the input vector
-  @param[out]    pDst        points to the output vector
-  @param[in]     numSamples  number of samples in each vector
+  @brief         Parallel complex conjugate of 8-bit integer vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i8 structure
   @return        none
  */
 
-void plp_cmplx_conj_i8_rv32im(const int8_t *__restrict__ pSrc,
-                              int8_t *__restrict__ pDst,
-                              uint32_t numSamples);
+void plp_cmplx_conj_i8p_xpulpv2(void *args);
 
 /**
   @brief Glue code for complex dot product of 32-bit float vectors.
@@ -16374,6 +22961,166 @@ void plp_cmplx_dot_prod_q16_rv32im(const int16_t *pSrcA,
                                    int16_t *realResult,
                                    int16_t *imagResult);
 
+/**
+  @brief         Glue code for parallel complex dot product of 32-bit float vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
+                                     const float32_t *__restrict__ pSrcB,
+                                     uint32_t numSamples,
+                                     float32_t *__restrict__ realResult,
+                                     float32_t *__restrict__ imagResult,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel complex dot product of 32-bit float vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_f32 structure
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex dot product of 32-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t numSamples,
+                                     int32_t *__restrict__ realResult,
+                                     int32_t *__restrict__ imagResult,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel complex dot product of 32-bit integer vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i32 structure
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex dot product of 16-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t numSamples,
+                                     int16_t *__restrict__ realResult,
+                                     int16_t *__restrict__ imagResult,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel complex dot product of 16-bit integer vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i16 structure
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex dot product of 8-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t numSamples,
+                                    int8_t *__restrict__ realResult,
+                                    int8_t *__restrict__ imagResult,
+                                    uint32_t nPE);
+
+/**
+  @brief         Parallel complex dot product of 8-bit integer vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i8 structure
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex dot product of 32-bit fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t numSamples,
+                                     uint32_t deciPoint,
+                                     int32_t *__restrict__ realResult,
+                                     int32_t *__restrict__ imagResult,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel complex dot product of 32-bit fixed-point vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i32 structure
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex dot product of 16-bit fixed-point vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t numSamples,
+                                     uint32_t deciPoint,
+                                     int16_t *__restrict__ realResult,
+                                     int16_t *__restrict__ imagResult,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel complex dot product of 16-bit fixed-point vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i16 structure
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q16p_xpulpv2(void *args);
+
 /**
   @brief Glue code for complex multiplied with real of 32-bit float vectors.
   @param[in]     pSrc        points to the input vector
@@ -16560,88 +23307,271 @@ void plp_cmplx_mult_real_q32_rv32im(const int32_t *__restrict__ pSrcCmplx,
                                     uint32_t numSamples);
 
 /**
-  @brief Glue code for complex multiplied with real of 16-bit fixed-point vectors.
-  @param[in]     pSrc        points to the input vector
+  @brief Glue code for complex multiplied with real of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q16(const int16_t *__restrict__ pSrcCmplx,
+                             const int16_t *__restrict__ pSrcReal,
+                             int16_t *__restrict__ pDst,
+                             uint32_t deciPoint,
+                             uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q16_xpulpv2(const int16_t *__restrict__ pSrcCmplx,
+                                     const int16_t *__restrict__ pSrcReal,
+                                     int16_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples);
+
+/**
+  @brief         16-bit fixed-point complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q16_rv32im(const int16_t *__restrict__ pSrcCmplx,
+                                    const int16_t *__restrict__ pSrcReal,
+                                    int16_t *__restrict__ pDst,
+                                    uint32_t deciPoint,
+                                    uint32_t numSamples);
+
+/**
+  @brief Glue code for complex multiplied with real of 8-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q8(const int8_t *__restrict__ pSrcCmplx,
+                            const int8_t *__restrict__ pSrcReal,
+                            int8_t *__restrict__ pDst,
+                            uint32_t deciPoint,
+                            uint32_t numSamples);
+
+/**
+  @brief         8-bit fixed-point complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q8_xpulpv2(const int8_t *__restrict__ pSrcCmplx,
+                                    const int8_t *__restrict__ pSrcReal,
+                                    int8_t *__restrict__ pDst,
+                                    uint32_t deciPoint,
+                                    uint32_t numSamples);
+
+/**
+  @brief         8-bit fixed-point complex multiplied with real.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_real_q8_rv32im(const int8_t *__restrict__ pSrcCmplx,
+                                   const int8_t *__restrict__ pSrcReal,
+                                   int8_t *__restrict__ pDst,
+                                   uint32_t deciPoint,
+                                   uint32_t numSamples);
+
+/**
+  @brief         Glue code for parallel complex-by-real multiplication of 32-bit float vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_f32_parallel(const float32_t *__restrict__ pSrcCmplx,
+                                      const float32_t *__restrict__ pSrcReal,
+                                      float32_t *__restrict__ pDst,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel complex-by-real multiplication of 32-bit float vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_f32 structure
+  @return        none
+ */
+
+void plp_cmplx_mult_real_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex-by-real multiplication of 32-bit integer vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i32_parallel(const int32_t *__restrict__ pSrcCmplx,
+                                      const int32_t *__restrict__ pSrcReal,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel complex-by-real multiplication of 32-bit integer vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i32 structure
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex-by-real multiplication of 16-bit integer vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i16_parallel(const int16_t *__restrict__ pSrcCmplx,
+                                      const int16_t *__restrict__ pSrcReal,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel complex-by-real multiplication of 16-bit integer vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i16 structure
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex-by-real multiplication of 8-bit integer vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i8_parallel(const int8_t *__restrict__ pSrcCmplx,
+                                     const int8_t *__restrict__ pSrcReal,
+                                     int8_t *__restrict__ pDst,
+                                     uint32_t numSamples,
+                                     uint32_t nPE);
+
+/**
+  @brief         Parallel complex-by-real multiplication of 8-bit integer vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i8 structure
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex-by-real multiplication of 32-bit fixed-point
+                 vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
   @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
   @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
   @return        none
  */
 
-void plp_cmplx_mult_real_q16(const int16_t *__restrict__ pSrcCmplx,
-                             const int16_t *__restrict__ pSrcReal,
-                             int16_t *__restrict__ pDst,
-                             uint32_t deciPoint,
-                             uint32_t numSamples);
+void plp_cmplx_mult_real_q32_parallel(const int32_t *__restrict__ pSrcCmplx,
+                                      const int32_t *__restrict__ pSrcReal,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
 
 /**
-  @brief         16-bit fixed-point complex multiplied with real.
-  @param[in]     pSrc        points to the input vector
-  @param[out]    pDst        points to the output vector
-  @param[in]     numSamples  number of samples in each vector
+  @brief         Parallel complex-by-real multiplication of 32-bit fixed-point vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i32 structure
   @return        none
  */
 
-void plp_cmplx_mult_real_q16_xpulpv2(const int16_t *__restrict__ pSrcCmplx,
-                                     const int16_t *__restrict__ pSrcReal,
-                                     int16_t *__restrict__ pDst,
-                                     uint32_t deciPoint,
-                                     uint32_t numSamples);
+void plp_cmplx_mult_real_q32p_xpulpv2(void *args);
 
 /**
-  @brief         16-bit fixed-point complex multiplied with real.
-  @param[in]     pSrc        points to the input vector
+  @brief         Glue code for parallel complex-by-real multiplication of 16-bit fixed-point
+                 vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
   @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
   @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
   @return        none
  */
 
-void plp_cmplx_mult_real_q16_rv32im(const int16_t *__restrict__ pSrcCmplx,
-                                    const int16_t *__restrict__ pSrcReal,
-                                    int16_t *__restrict__ pDst,
-                                    uint32_t deciPoint,
-                                    uint32_t numSamples);
+void plp_cmplx_mult_real_q16_parallel(const int16_t *__restrict__ pSrcCmplx,
+                                      const int16_t *__restrict__ pSrcReal,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
 
 /**
-  @brief Glue code for complex multiplied with real of 8-bit fixed-point vectors.
-  @param[in]     pSrc        points to the input vector
-  @param[out]    pDst        points to the output vector
-  @param[in]     numSamples  number of samples in each vector
+  @brief         Parallel complex-by-real multiplication of 16-bit fixed-point vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i16 structure
   @return        none
  */
 
-void plp_cmplx_mult_real_q8(const int8_t *__restrict__ pSrcCmplx,
-                            const int8_t *__restrict__ pSrcReal,
-                            int8_t *__restrict__ pDst,
-                            uint32_t deciPoint,
-                            uint32_t numSamples);
+void plp_cmplx_mult_real_q16p_xpulpv2(void *args);
 
 /**
-  @brief         8-bit fixed-point complex multiplied with real.
-  @param[in]     pSrc        points to the input vector
+  @brief         Glue code for parallel complex-by-real multiplication of 8-bit fixed-point vectors.
+  @param[in]     pSrcCmplx   points to the complex input vector
+  @param[in]     pSrcReal    points to the real input vector
   @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
   @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
   @return        none
  */
 
-void plp_cmplx_mult_real_q8_xpulpv2(const int8_t *__restrict__ pSrcCmplx,
-                                    const int8_t *__restrict__ pSrcReal,
-                                    int8_t *__restrict__ pDst,
-                                    uint32_t deciPoint,
-                                    uint32_t numSamples);
+void plp_cmplx_mult_real_q8_parallel(const int8_t *__restrict__ pSrcCmplx,
+                                     const int8_t *__restrict__ pSrcReal,
+                                     int8_t *__restrict__ pDst,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples,
+                                     uint32_t nPE);
 
 /**
-  @brief         8-bit fixed-point complex multiplied with real.
-  @param[in]     pSrc        points to the input vector
-  @param[out]    pDst        points to the output vector
-  @param[in]     numSamples  number of samples in each vector
+  @brief         Parallel complex-by-real multiplication of 8-bit fixed-point vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i8 structure
   @return        none
  */
 
-void plp_cmplx_mult_real_q8_rv32im(const int8_t *__restrict__ pSrcCmplx,
-                                   const int8_t *__restrict__ pSrcReal,
-                                   int8_t *__restrict__ pDst,
-                                   uint32_t deciPoint,
-                                   uint32_t numSamples);
+void plp_cmplx_mult_real_q8p_xpulpv2(void *args);
 
 /**
   @brief Glue code for complex squared magnitude of 32-bit float vectors.
@@ -16904,6 +23834,169 @@ void plp_cmplx_mag_squared_q8_xpulpv2(const int8_t *__restrict__ pSrc,
                                       uint32_t deciPoint,
                                       uint32_t numSamples);
 
+/**
+  @brief         Glue code for parallel complex magnitude squared of 32-bit float vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_f32_parallel(const float32_t *__restrict__ pSrc,
+                                        float32_t *__restrict__ pDst,
+                                        uint32_t numSamples,
+                                        uint32_t nPE);
+
+/**
+  @brief         Parallel complex magnitude squared of 32-bit float vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_f32 structure
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex magnitude squared of 32-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i32_parallel(const int32_t *__restrict__ pSrc,
+                                        int32_t *__restrict__ pDst,
+                                        uint32_t numSamples,
+                                        uint32_t nPE);
+
+/**
+  @brief         Parallel complex magnitude squared of 32-bit integer vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i32 structure
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex magnitude squared of 16-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i16_parallel(const int16_t *__restrict__ pSrc,
+                                        int16_t *__restrict__ pDst,
+                                        uint32_t numSamples,
+                                        uint32_t nPE);
+
+/**
+  @brief         Parallel complex magnitude squared of 16-bit integer vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i16 structure
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex magnitude squared of 8-bit integer vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i8_parallel(const int8_t *__restrict__ pSrc,
+                                       int8_t *__restrict__ pDst,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel complex magnitude squared of 8-bit integer vectors for XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i8 structure
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_i8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex magnitude squared of 32-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q32_parallel(const int32_t *__restrict__ pSrc,
+                                        int32_t *__restrict__ pDst,
+                                        uint32_t deciPoint,
+                                        uint32_t numSamples,
+                                        uint32_t nPE);
+
+/**
+  @brief         Parallel complex magnitude squared of 32-bit fixed-point vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i32 structure
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex magnitude squared of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q16_parallel(const int16_t *__restrict__ pSrc,
+                                        int16_t *__restrict__ pDst,
+                                        uint32_t deciPoint,
+                                        uint32_t numSamples,
+                                        uint32_t nPE);
+
+/**
+  @brief         Parallel complex magnitude squared of 16-bit fixed-point vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i16 structure
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex magnitude squared of 8-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q8_parallel(const int8_t *__restrict__ pSrc,
+                                       int8_t *__restrict__ pDst,
+                                       uint32_t deciPoint,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel complex magnitude squared of 8-bit fixed-point vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i8 structure
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_q8p_xpulpv2(void *args);
+
 /**
   @brief Glue code for complex multiplied by complex of 32-bit float vectors.
   @param[in]     pSrcA       points to the first input vector
@@ -17202,4 +24295,188 @@ void plp_cmplx_mult_cmplx_q8_rv32im(const int8_t *__restrict__ pSrcA,
                                     uint32_t deciPoint,
                                     uint32_t numSamples);
 
+/**
+  @brief         Glue code for parallel complex-by-complex multiplication of 32-bit float vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_f32_parallel(const float32_t *__restrict__ pSrcA,
+                                       const float32_t *__restrict__ pSrcB,
+                                       float32_t *__restrict__ pDst,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel complex-by-complex multiplication of 32-bit float vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_f32 structure
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_f32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex-by-complex multiplication of 32-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       int32_t *__restrict__ pDst,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel complex-by-complex multiplication of 32-bit integer vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i32 structure
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex-by-complex multiplication of 16-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       int16_t *__restrict__ pDst,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel complex-by-complex multiplication of 16-bit integer vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i16 structure
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex-by-complex multiplication of 8-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      int8_t *__restrict__ pDst,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel complex-by-complex multiplication of 8-bit integer vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i8 structure
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i8p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex-by-complex multiplication of 32-bit fixed-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       int32_t *__restrict__ pDst,
+                                       uint32_t deciPoint,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel complex-by-complex multiplication of 32-bit fixed-point vectors for
+                 XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i32 structure
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q32p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex-by-complex multiplication of 16-bit fixed-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       int16_t *__restrict__ pDst,
+                                       uint32_t deciPoint,
+                                       uint32_t numSamples,
+                                       uint32_t nPE);
+
+/**
+  @brief         Parallel complex-by-complex multiplication of 16-bit fixed-point vectors for
+                 XPULPV2 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i16 structure
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q16p_xpulpv2(void *args);
+
+/**
+  @brief         Glue code for parallel complex-by-complex multiplication of 8-bit fixed-point
+                 vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      int8_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples,
+                                      uint32_t nPE);
+
+/**
+  @brief         Parallel complex-by-complex multiplication of 8-bit fixed-point vectors for XPULPV2
+                 extension.
+  @param[in]     args  points to the plp_cmplx_instance_i8 structure
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_q8p_xpulpv2(void *args);
+
 #endif // __PLP_MATH_H__
@@ -61,6 +61,12 @@ static inline void hal_cl_dma_cmd(uint32_t ext, uint32_t loc, uint32_t size, hal
   pi_cl_dma_cmd(ext, loc, size, dir, cmd);
 }
 
+/* 2D transfer of size bytes, as rows of length bytes which are stride bytes apart in ext */
+static inline void hal_cl_dma_cmd_2d(uint32_t ext, uint32_t loc, uint32_t size, uint32_t stride, uint32_t length, hal_cl_dma_dir_e dir, int merge __attribute__((unused)), hal_cl_dma_cmd_t * cmd)
+{
+  pi_cl_dma_cmd_2d(ext, loc, size, stride, length, dir, cmd);
+}
+
 static inline void hal_cl_dma_cmd_wait(hal_cl_dma_cmd_t * cmd)
 {
   pi_cl_dma_cmd_wait(cmd);
@@ -123,6 +129,240 @@ static inline unsigned int hal_perf_read(int id)
 
 
 
+#elif defined(RTOS_HOST)
+
+/* Host (x86/ARM Linux) backend: the cluster is emulated with pthreads, L1 with malloc and the
+   DMA with memcpy, so that the library can be built and tested natively. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HAL_L1
+#define HAL_CL_L1
+#define HAL_L2
+
+#define ARCHI_FC_CID 32
+#define HAL_HOST_NB_PE_CORES 8
+
+/* Implemented in src/HostHal/rtos_hal_host.c */
+int hal_host_core_id(void);
+int hal_host_cluster_id(void);
+void hal_host_set_cluster_id(int cid);
+void hal_host_team_fork(int nb_cores, void (*entry)(void *), void *arg);
+void hal_host_team_barrier(void);
+void hal_host_perf_conf(unsigned events);
+void hal_host_perf_reset(void);
+void hal_host_perf_start(void);
+void hal_host_perf_stop(void);
+unsigned int hal_host_perf_read(int id);
+
+static inline int hal_core_id(){
+  return hal_host_core_id();
+}
+
+static inline int hal_cluster_id(){
+  return hal_host_cluster_id();
+}
+
+static inline uint32_t hal_cl_nb_pe_cores(){
+  return HAL_HOST_NB_PE_CORES;
+}
+
+static inline void hal_team_barrier()
+{
+  hal_host_team_barrier();
+}
+
+static inline void hal_cl_team_fork(int nb_cores, void (*entry)(void *), void *arg)
+{
+  hal_host_team_fork(nb_cores, entry, arg);
+}
+
+
+/* MEMORY ALLOCATION */
+
+static inline void * hal_fc_l1_malloc(int size)
+{
+  return malloc(size);
+}
+
+static inline void hal_fc_l1_free(void *chunk, int size __attribute__((unused)))
+{
+  free(chunk);
+}
+
+static inline void * hal_cl_l1_malloc(int size)
+{
+  return malloc(size);
+}
+
+static inline void hal_cl_l1_free(void *chunk, int size __attribute__((unused)))
+{
+  free(chunk);
+}
+
+
+/* DMA */
+
+typedef enum { HAL_CL_DMA_DIR_LOC2EXT = 0, HAL_CL_DMA_DIR_EXT2LOC = 1 } hal_cl_dma_dir_e;
+
+typedef int hal_cl_dma_cmd_t;
+
+static inline void hal_cl_dma_cmd(uintptr_t ext, uintptr_t loc, uint32_t size, hal_cl_dma_dir_e dir, int merge __attribute__((unused)), hal_cl_dma_cmd_t * cmd __attribute__((unused)))
+{
+  if (dir == HAL_CL_DMA_DIR_EXT2LOC)
+    memcpy((void *)loc, (const void *)ext, size);
+  else
+    memcpy((void *)ext, (const void *)loc, size);
+}
+
+static inline void hal_cl_dma_cmd_2d(uintptr_t ext, uintptr_t loc, uint32_t size, uint32_t stride, uint32_t length, hal_cl_dma_dir_e dir, int merge __attribute__((unused)), hal_cl_dma_cmd_t * cmd __attribute__((unused)))
+{
+  uint32_t row;
+
+  for (row = 0; row * length < size; row++) {
+    if (dir == HAL_CL_DMA_DIR_EXT2LOC)
+      memcpy((void *)(loc + row * length), (const void *)(ext + row * stride), length);
+    else
+      memcpy((void *)(ext + row * stride), (const void *)(loc + row * length), length);
+  }
+}
+
+static inline void hal_cl_dma_cmd_wait(hal_cl_dma_cmd_t * cmd __attribute__((unused)))
+{
+}
+
+
+/* PERFORMANCE COUNTERS */
+
+/* Only HAL_PERF_CYCLES is backed by a real counter (nanoseconds of CLOCK_MONOTONIC). */
+#define HAL_PERF_CYCLES 0
+#define HAL_PERF_ACTIVE_CYCLES 1
+#define HAL_PERF_INSTR 2
+#define HAL_PERF_LD_STALL 3
+#define HAL_PERF_JR_STALL 4
+#define HAL_PERF_IMISS 5
+#define HAL_PERF_WBRANCH 6
+#define HAL_PERF_WBRANCH_CYC 7
+#define HAL_PERF_LD 8
+#define HAL_PERF_ST 9
+#define HAL_PERF_JUMP 10
+#define HAL_PERF_BRANCH 11
+#define HAL_PERF_DELAY_NOP 12
+#define HAL_PERF_LD_EXT_CYC 13
+#define HAL_PERF_ST_EXT_CYC 14
+#define HAL_PERF_TCDM_CONT 15
+
+typedef int hal_perf_t;
+
+static inline void hal_perf_init(hal_perf_t * perf __attribute__((unused)))
+{
+}
+
+static inline void hal_perf_conf(hal_perf_t * perf __attribute__((unused)), unsigned events)
+{
+  hal_host_perf_conf(events);
+}
+
+static inline void hal_perf_reset(hal_perf_t * perf __attribute__((unused)))
+{
+  hal_host_perf_reset();
+}
+
+static inline void hal_perf_start(hal_perf_t * perf __attribute__((unused)))
+{
+  hal_host_perf_start();
+}
+
+
+static inline void hal_perf_stop(hal_perf_t * perf __attribute__((unused)))
+{
+  hal_host_perf_stop();
+}
+
+static inline unsigned int hal_perf_read(int id)
+{
+  return hal_host_perf_read(id);
+}
+
+
+/* XPULPV2 BUILTINS (portable C emulation) */
+
+typedef signed short v2s __attribute__((vector_size(4)));
+typedef unsigned short v2u __attribute__((vector_size(4)));
+typedef signed char v4s __attribute__((vector_size(4)));
+typedef unsigned char v4u __attribute__((vector_size(4)));
+
+static inline int32_t __builtin_pulp_dotsp2(v2s x, v2s y)
+{
+  return x[0] * y[0] + x[1] * y[1];
+}
+
+static inline int32_t __builtin_pulp_dotsp4(v4s x, v4s y)
+{
+  return x[0] * y[0] + x[1] * y[1] + x[2] * y[2] + x[3] * y[3];
+}
+
+static inline int32_t __builtin_pulp_sdotsp2(v2s x, v2s y, int32_t z)
+{
+  return z + __builtin_pulp_dotsp2(x, y);
+}
+
+static inline int32_t __builtin_pulp_sdotsp4(v4s x, v4s y, int32_t z)
+{
+  return z + __builtin_pulp_dotsp4(x, y);
+}
+
+static inline int32_t __builtin_pulp_clip(int32_t x, int32_t lo, int32_t hi)
+{
+  return x < lo ? lo : (x > hi ? hi : x);
+}
+
+#define __ADD2(x, y) ((v2s)(x) + (v2s)(y))
+#define __SUB2(x, y) ((v2s)(x) - (v2s)(y))
+#define __ADD4(x, y) ((v4s)(x) + (v4s)(y))
+#define __SUB4(x, y) ((v4s)(x) - (v4s)(y))
+#define __DOTP2(x, y) __builtin_pulp_dotsp2((x), (y))
+#define __DOTP4(x, y) __builtin_pulp_dotsp4((x), (y))
+#define __SUMDOTP2(x, y, z) __builtin_pulp_sdotsp2((x), (y), (z))
+#define __SUMDOTP4(x, y, z) __builtin_pulp_sdotsp4((x), (y), (z))
+#define __PACK2(x, y) ((v2s){ (signed short)(x), (signed short)(y) })
+#define __PACK4(x, y, z, t)                                                                        \
+  ((v4s){ (signed char)(x), (signed char)(y), (signed char)(z), (signed char)(t) })
+#define __CLIP(x, precision) __builtin_pulp_clip((x), -(1 << (precision)), (1 << (precision)) - 1)
+#define __ADDROUNDNORM_REG(x, y, scale)                                                            \
+  ((scale) ? (((int32_t)(x) + (int32_t)(y) + (1 << ((scale) - 1))) >> (scale))                     \
+           : ((int32_t)(x) + (int32_t)(y)))
+#define __ADDNORMU_REG(x, y, scale) ((int32_t)((uint32_t)((x) + (y)) >> (scale)))
+#define __ROUNDNORM_REG(x, scale) __ADDROUNDNORM_REG((x), 0, (scale))
+#define __MAC(acc, x, y) ((acc) + (x) * (y))
+#define __MACSN(acc, x, y, n) (((acc) + (x) * (y)) >> (n))
+#define __AND2(x, y) ((v2s)(x) & (v2s)(y))
+#define __AND4(x, y) ((v4s)(x) & (v4s)(y))
+#define __OR2(x, y) ((v2s)(x) | (v2s)(y))
+#define __OR4(x, y) ((v4s)(x) | (v4s)(y))
+#define __SRA2(x, y) ((v2s)(x) >> (v2s)(y))
+#define __SRA4(x, y) ((v4s)(x) >> (v4s)(y))
+#define __SLL2(x, y) ((v2s)(x) << (v2s)(y))
+#define __SLL4(x, y) ((v4s)(x) << (v4s)(y))
+#define __MAX(x, y) ((x) > (y) ? (x) : (y))
+#define __MIN(x, y) ((x) < (y) ? (x) : (y))
+/* GCC has no vector conditional operator in C, the comparison masks select the lanes instead */
+#define __SEL2(m, x, y) ((v2s)(((m) & (v2s)(x)) | (~(m) & (v2s)(y))))
+#define __SEL4(m, x, y) ((v4s)(((m) & (v4s)(x)) | (~(m) & (v4s)(y))))
+#define __MAX2(x, y) __SEL2((v2s)(x) > (v2s)(y), (x), (y))
+#define __MIN2(x, y) __SEL2((v2s)(x) < (v2s)(y), (x), (y))
+#define __MAX4(x, y) __SEL4((v4s)(x) > (v4s)(y), (x), (y))
+#define __MIN4(x, y) __SEL4((v4s)(x) < (v4s)(y), (x), (y))
+#define __ABS2(x) __SEL2((v2s)(x) < (v2s){ 0, 0 }, -(v2s)(x), (x))
+#define __ABS4(x) __SEL4((v4s)(x) < (v4s){ 0, 0, 0, 0 }, -(v4s)(x), (x))
+#define __NEG2(x) (-(v2s)(x))
+#define __NEG4(x) (-(v4s)(x))
+
+
+
 #else /* PULP-RT */
 
 #include "rt/rt_api.h"
@@ -184,6 +424,11 @@ static inline void hal_cl_dma_cmd(uint32_t ext, uint32_t loc, uint32_t size, hal
   rt_dma_memcpy(ext, loc, size, dir, merge, cmd);
 }
 
+static inline void hal_cl_dma_cmd_2d(uint32_t ext, uint32_t loc, uint32_t size, uint32_t stride, uint32_t length, hal_cl_dma_dir_e dir, int merge, hal_cl_dma_cmd_t * cmd)
+{
+  rt_dma_memcpy_2d(ext, loc, size, stride, length, dir, merge, cmd);
+}
+
 static inline void hal_cl_dma_cmd_wait(hal_cl_dma_cmd_t * cmd)
 {
   rt_dma_wait(cmd);
@@ -0,0 +1,62 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_i16p_xpulpv2.c
+ * Description:  16-bit integer parallel addition kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicAdd
+ */
+
+/**
+  @addtogroup BasicAddKernels
+  @{
+ */
+
+/**
+  @brief Parallel addition of 16-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  S     points to the instance structure for 16-bit integer parallel addition
+  @return        none
+
+  @par
+  Each core processes one contiguous block of the vectors (see plp_partition) with
+  plp_add_i16s_xpulpv2. The blocks start on a multiple of 2 elements, i.e. on a word boundary.
+ */
+
+void plp_add_i16p_xpulpv2(void *S) {
+
+    plp_add_instance_i16 *args = (plp_add_instance_i16 *)S;
+
+    uint32_t start, end;
+
+    plp_partition(args->blockSize, args->nPE, hal_core_id(), 2, &start, &end);
+    plp_add_i16s_xpulpv2(args->pSrcA + start, args->pSrcB + start, args->pDst + start, end - start);
+}
+
+/**
+   @} end of BasicAddKernels group
+*/
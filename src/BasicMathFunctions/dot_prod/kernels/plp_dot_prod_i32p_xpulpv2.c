@@ -1,7 +1,7 @@
 /* =====================================================================
  * Project:      PULP DSP Library
  * Title:        plp_dot_prod_i32p_xpulpv2.c
- * Description:  32-bit integer scalar dot product for XPULPV2 with interleaved access
+ * Description:  32-bit integer parallel dot product kernel for XPULPV2
  *
  * $Date:        03. Jun 2019
  * $Revision:    V0
@@ -45,47 +45,25 @@
  */
 
 /**
-  @brief Parallel dot product with interleaved access of 32-bit integer vectors kernel for XPULPV2
-  extension.
+  @brief Parallel dot product of 32-bit integer vectors kernel for XPULPV2 extension.
   @param[in]  S     points to the instance structure for integer parallel dot product
   @return        none
+
+  @par
+  Each core computes the dot product of one contiguous block of the vectors (see plp_partition)
+  with plp_dot_prod_i32s_xpulpv2 and writes it to its entry of resBuffer.
  */
 
 void plp_dot_prod_i32p_xpulpv2(void *S) {
 
-    int32_t *pSrcA = (int32_t *)(((plp_dot_prod_instance_i32 *)S)->pSrcA) + hal_core_id();
-    int32_t *pSrcB = (int32_t *)(((plp_dot_prod_instance_i32 *)S)->pSrcB) + hal_core_id();
-    uint32_t blkSizePE = ((plp_dot_prod_instance_i32 *)S)->blkSizePE;
-    uint32_t nPE = ((plp_dot_prod_instance_i32 *)S)->nPE;
-    int32_t *resBufferPE = &(((plp_dot_prod_instance_i32 *)S)->resBuffer[hal_core_id()]);
-
-    uint32_t blkCnt, tmpBS;     /* Loop counter, temporal BlockSize */
-    int32_t sum1 = 0, sum2 = 0; /* Temporary return variable */
-
-    // hal_team_barrier();
-
-#if defined(PLP_MATH_LOOPUNROLL)
-
-    tmpBS = (blkSizePE >> 1);
-    uint32_t tmpIdx = 2 * nPE;
-
-    for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
-        // printf("blkCnt %d, tmpIdx*blkCnt %d\n", blkCnt, tmpIdx*blkCnt);
-        sum1 = __MAC(sum1, pSrcA[tmpIdx * blkCnt], pSrcB[tmpIdx * blkCnt]);
-        sum2 = __MAC(sum2, pSrcA[tmpIdx * blkCnt + nPE], pSrcB[tmpIdx * blkCnt + nPE]);
-    }
-
-#else // PLP_MATH_LOOPUNROLL
-
-    for (blkCnt = 0; blkCnt < blockSize; blkCnt = blkCnt + nPE) {
-        sum1 = __MAC(sum1, pSrcA[blkCnt], pSrcB[blkCnt]);
-    }
-
-#endif // PLP_MATH_LOOPUNROLL
+    plp_dot_prod_instance_i32 *args = (plp_dot_prod_instance_i32 *)S;
 
-    *resBufferPE = sum1 + sum2;
+    uint32_t core_id = hal_core_id();
+    uint32_t start, end;
 
-    // printf("resBufferPE %d, core id %d\n", *resBufferPE, hal_core_id());
+    plp_partition(args->blockSize, args->nPE, core_id, 1, &start, &end);
+    plp_dot_prod_i32s_xpulpv2(args->pSrcA + start, args->pSrcB + start, end - start,
+                              &args->resBuffer[core_id]);
 }
 
 /**
@@ -1,7 +1,7 @@
 /* =====================================================================
  * Project:      PULP DSP Library
  * Title:        plp_dot_prod_q32p_xpulpv2.c
- * Description:  32-bit fixed point scalar dot product for XPULPV2 with interleaved access
+ * Description:  32-bit fixed point parallel dot product kernel for XPULPV2
  *
  * $Date:        04. Jun 2019
  * $Revision:    V0
@@ -45,72 +45,27 @@
  */
 
 /**
-  @brief Parallel dot product with interleaved access of 32-bit fixed point vectors kernel for
-  XPULPV2 extension.
+  @brief Parallel dot product of 32-bit fixed point vectors kernel for XPULPV2 extension.
   @param[in]  S     points to the instance structure for fixed point parallel dot product
   @return        none
+
+  @par
+  Each core computes the dot product of one contiguous block of the vectors (see plp_partition)
+  with plp_dot_prod_q32s_xpulpv2 and writes it to its entry of resBuffer.
+  The blocks start on even elements, such that the products are rounded in the same pairs as in
+  the single core implementation and the result is identical to it.
  */
 
 void plp_dot_prod_q32p_xpulpv2(void *S) {
 
-    int core_id = hal_core_id();
-
     plp_dot_prod_instance_q32 *args = (plp_dot_prod_instance_q32 *)S;
 
-    int32_t *pSrcA = (int32_t *)(args->pSrcA);
-    int32_t *pSrcB = (int32_t *)(args->pSrcB);
-    uint32_t blkSizePE = args->blkSizePE;
-    uint32_t deciPoint = args->deciPoint;
-    uint32_t nPE = args->nPE;
-    int32_t *resBufferPE = &(args->resBuffer[core_id]);
-
-    // *NOTICE* here, we can do something better for performance, by splitting it more evenly.
-    // If (blkSizePe / nPE) is odd, then each core will process (blkSizePe / nPE) - 1 elements.
-    // This is due to verification reasons: FOr the non-parallel case, we always sum up two
-    // temporary values, and then execute __ROUNDNORM_REG. To mimik this behavior, every core
-    // (except the last one) will process an even number of elements. This way, the last core will
-    // have to do more work, but the result of this function will identical to the result of the
-    // singlecore implementation.
-    // set the default block size
-    uint32_t blkSize = (blkSizePE / nPE) & 0xFFFFFFFE; // the and makes sure the block size is even
-
-    // set pSrcA and pSrcB to the correct location
-    pSrcA += core_id * blkSize;
-    pSrcB += core_id * blkSize;
-
-    // set the block size for the last core
-    if (core_id == nPE - 1) {
-        blkSize = blkSizePE - (nPE - 1) * blkSize;
-    }
-
-    if (blkSize == 0) {
-        *resBufferPE = 0;
-        return;
-    }
-
-    int32_t i, sum = 0;
-
-#if defined(PLP_MATH_LOOPUNROLL)
-
-    for (i = 0; i < blkSize - 1; i += 2) {
-        int32_t x0 = pSrcA[i] * pSrcB[i];
-        int32_t x1 = pSrcA[i + 1] * pSrcB[i + 1];
-        sum += __ADDROUNDNORM_REG(x0, x1, deciPoint);
-    }
-
-    if (i != blkSize) {
-        sum += __ROUNDNORM_REG(pSrcA[i] * pSrcB[i], deciPoint);
-    }
-
-#else // PLP_MATH_LOOPUNROLL
-
-    for (i = 0; i < blkSize; i++) {
-        sum += __ROUNDNORM_REG(pSrcA[i] * pSrcB[i], deciPoint);
-    }
-
-#endif // PLP_MATH_LOOPUNROLL
+    uint32_t core_id = hal_core_id();
+    uint32_t start, end;
 
-    *resBufferPE = sum;
+    plp_partition(args->blockSize, args->nPE, core_id, 2, &start, &end);
+    plp_dot_prod_q32s_xpulpv2(args->pSrcA + start, args->pSrcB + start, end - start,
+                              args->deciPoint, &args->resBuffer[core_id]);
 }
 
 /**
@@ -65,16 +65,15 @@ void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
         return;
     } else {
 
-        uint32_t i, tmpblkSizePE = blockSize / nPE;
+        uint32_t i;
         float32_t resBuffer[hal_cl_nb_pe_cores()];
 
         plp_dot_prod_instance_f32 S;
 
         // Initialize the plp_dot_prod_instance
         S.pSrcA = pSrcA;
-        // printf("pSrcA[0] %d\n", pSrcA[0]);
         S.pSrcB = pSrcB;
-        S.blkSizePE = tmpblkSizePE;
+        S.blockSize = blockSize;
         S.nPE = nPE;
         S.resBuffer = resBuffer;
 
@@ -82,29 +81,11 @@ void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
         hal_cl_team_fork(nPE, plp_dot_prod_f32p_xpulpv2, (void *)&S);
 
         float32_t sum = 0;
-        for (i = 0; i < nPE; i++) { // not necessary hal_cl_nb_pe_cores()
+        for (i = 0; i < nPE; i++) {
             sum += resBuffer[i];
         }
 
-        /* #if defined(PLP_MATH_LOOPUNROLL) */
-        /* #undef PLP_MATH_LOOPUNROLL */
-        /* #endif */
-
-        /* #if defined(PLP_MATH_LOOPUNROLL) */
-        /*     //uint32_t blkCnt = blockSize/nPE/2 * 2 * nPE; */
-        /*     //printf("blkCnt %d\n", blkCnt); */
-        /*     for (i= ((tmpblkSizePE>>1) <<1) * nPE; i<blockSize; i++){ */
-        /*       sum += pSrcA[i] * pSrcB[i]; */
-        /*     } */
-        /* #else // PLP_MATH_LOOPUNROLL */
-        for (i = (tmpblkSizePE)*nPE; i < blockSize; i++) {
-            sum += pSrcA[i] * pSrcB[i];
-        }
-        /* #endif */
-
         *pRes = sum;
-
-        /* #define PLP_MATH_LOOPUNROLL */
     }
 }
 
@@ -65,45 +65,25 @@ void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
         return;
     } else {
 
-        uint32_t i, tmpblkSizePE = blockSize / nPE;
+        uint32_t i;
         int32_t resBuffer[hal_cl_nb_pe_cores()];
-        // initialize results buffer
-        /* not necessary
-        for (i=0; i<hal_cl_nb_pe_cores(); i++){
-          resBuffer[i]=0;
-          //printf("i %d, buffer %d, hal_cl_nb_pe_cores %d, hal_core_id %d\n", i, resBuffer[i], hal_cl_nb_pe_cores(),
-        hal_core_id());
-        }
-        */
 
         plp_dot_prod_instance_i32 S;
 
         // Initialize the plp_dot_prod_instance
         S.pSrcA = pSrcA;
-        // printf("pSrcA[0] %d\n", pSrcA[0]);
         S.pSrcB = pSrcB;
-        S.blkSizePE = tmpblkSizePE;
+        S.blockSize = blockSize;
         S.nPE = nPE;
         S.resBuffer = resBuffer;
 
         // Fork the dot product to nPE cores (i.e. processing units)
         hal_cl_team_fork(nPE, plp_dot_prod_i32p_xpulpv2, (void *)&S);
 
-        int sum = 0;
-        for (i = 0; i < nPE; i++) { // not necessary hal_cl_nb_pe_cores()
+        int32_t sum = 0;
+        for (i = 0; i < nPE; i++) {
             sum += resBuffer[i];
         }
-#if defined(PLP_MATH_LOOPUNROLL)
-        // uint32_t blkCnt = blockSize/nPE/2 * 2 * nPE;
-        // printf("blkCnt %d\n", blkCnt);
-        for (i = ((tmpblkSizePE >> 1) << 1) * nPE; i < blockSize; i++) {
-            sum = __MAC(sum, pSrcA[i], pSrcB[i]);
-        }
-#else // PLP_MATH_LOOPUNROLL
-        for (i = (tmpblkSizePE)*nPE; i < blockSize; i++) {
-            sum += pSrcA[i] * pSrcB[i];
-        }
-#endif
 
         *pRes = sum;
     }
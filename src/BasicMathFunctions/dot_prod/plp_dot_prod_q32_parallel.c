@@ -75,7 +75,7 @@ void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
         // Initialize the plp_dot_prod_instance
         S.pSrcA = pSrcA;
         S.pSrcB = pSrcB;
-        S.blkSizePE = blockSize;
+        S.blockSize = blockSize;
         S.deciPoint = deciPoint;
         S.nPE = nPE;
         S.resBuffer = resBuffer;
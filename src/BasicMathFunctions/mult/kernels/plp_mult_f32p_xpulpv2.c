@@ -1,7 +1,7 @@
 /* =====================================================================
  * Project:      PULP DSP Library
  * Title:        plp_mult_f32p_xpulpv2.c
- * Description:  32-bit floating-point multiplication for XPULPV2 with interleaved access
+ * Description:  32-bit floating-point parallel multiplication kernel for XPULPV2
  *
  * $Date:        10. July 2021
  * $Revision:    V0
@@ -45,55 +45,26 @@
  */
 
 /**
-  @brief Parallel multiplication with interleaved access of 32-bit float vectors kernel for XPULPV2
-  extension.
+  @brief Parallel multiplication of 32-bit float vectors kernel for XPULPV2 extension.
   @param[in]  S     points to the instance structure for float parallel multiplication
   @return        none
+
+  @par
+  Each core multiplies one contiguous block of the vectors (see plp_partition) with
+  plp_mult_f32s_xpulpv2.
  */
 
 void plp_mult_f32p_xpulpv2(void *S) {
 
-    float32_t *pSrcA = (float32_t *)(((plp_mult_instance_f32 *)S)->pSrcA) + rt_core_id();
-    float32_t *pSrcB = (float32_t *)(((plp_mult_instance_f32 *)S)->pSrcB) + rt_core_id();
-    uint32_t blkSizePE = ((plp_mult_instance_f32 *)S)->blkSizePE;
-    uint32_t nPE = ((plp_mult_instance_f32 *)S)->nPE;
-    float32_t *pDst = (float32_t *)(((plp_mult_instance_f32 *)S)->pDst) + rt_core_id();
-
-    uint32_t blkCnt, tmpBS; /* Loop counter, temporal BlockSize */
-    // float32_t sum1 = 0, sum2=0;                          /* Temporary return variable */
-
-    // rt_team_barrier();
-
-    /* #if defined(PLP_MATH_LOOPUNROLL) */
-    /* #undef PLP_MATH_LOOPUNROLL */
-    /* #endif */
-
-    /* #if defined(PLP_MATH_LOOPUNROLL) */
-
-    /*         tmpBS = (blkSizePE>>1); */
-    /*         uint32_t tmpIdx = 2*nPE; */
+    plp_mult_instance_f32 *args = (plp_mult_instance_f32 *)S;
 
-    /*         for (blkCnt=0; blkCnt<tmpBS; blkCnt++){ */
-    /*           //printf("blkCnt %d, tmpIdx*blkCnt %d\n", blkCnt, tmpIdx*blkCnt); */
-    /*           sum1 += pSrcA[tmpIdx*blkCnt] * pSrcB[tmpIdx*blkCnt]; */
-    /*           sum2 += pSrcA[tmpIdx*blkCnt + nPE] * pSrcB[tmpIdx*blkCnt + nPE]; */
-    /*         } */
+    uint32_t start, end;
 
-    /* #else // PLP_MATH_LOOPUNROLL */
-
-    for (blkCnt = 0; blkCnt < blkSizePE; blkCnt++) {
-        pDst[nPE * blkCnt] = pSrcA[nPE * blkCnt] * pSrcB[nPE * blkCnt];
-    }
-
-    /* #endif // PLP_MATH_LOOPUNROLL */
-
-    //* resBufferPE = sum1 + sum2;
-
-    // printf("resBufferPE %d, core id %d\n", *resBufferPE, rt_core_id());
+    plp_partition(args->blockSize, args->nPE, hal_core_id(), 1, &start, &end);
+    plp_mult_f32s_xpulpv2(args->pSrcA + start, args->pSrcB + start, args->pDst + start,
+                          end - start);
 }
 
-/* #define PLP_MATH_LOOPUNROLL */
-
 /**
    @} end of BasicMultKernels group
 */
@@ -91,7 +91,7 @@ void plp_mult_f32(const float32_t * pSrcA,
                  float32_t * pDst,
                  uint32_t blockSize) {
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
       printf("floating point multiplication is not supported on FC.\n");
     } else {
       plp_mult_f32s_xpulpv2(pSrcA, pSrcB, pDst, blockSize);
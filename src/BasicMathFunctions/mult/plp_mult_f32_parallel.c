@@ -60,43 +60,22 @@ void plp_mult_f32_parallel(const float32_t *__restrict__ pSrcA,
                                uint32_t nPE,
                                float32_t *__restrict__ pDst) {
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
 
-        uint32_t i, tmpblkSizePE = blockSize / nPE;
-
         plp_mult_instance_f32 S;
 
-        // Initialize the plp_dot_prod_instance
+        // Initialize the plp_mult_instance
         S.pSrcA = pSrcA;
-        // printf("pSrcA[0] %d\n", pSrcA[0]);
         S.pSrcB = pSrcB;
-        S.blkSizePE = tmpblkSizePE;
+        S.blockSize = blockSize;
         S.nPE = nPE;
         S.pDst = pDst;
 
-        // Fork the dot product to nPE cores (i.e. processing units)
-        rt_team_fork(nPE, plp_mult_f32p_xpulpv2, (void *)&S);
-
-        /* #if defined(PLP_MATH_LOOPUNROLL) */
-        /* #undef PLP_MATH_LOOPUNROLL */
-        /* #endif */
-
-        /* #if defined(PLP_MATH_LOOPUNROLL) */
-        /*     //uint32_t blkCnt = blockSize/nPE/2 * 2 * nPE; */
-        /*     //printf("blkCnt %d\n", blkCnt); */
-        /*     for (i= ((tmpblkSizePE>>1) <<1) * nPE; i<blockSize; i++){ */
-        /*       sum += pSrcA[i] * pSrcB[i]; */
-        /*     } */
-        /* #else // PLP_MATH_LOOPUNROLL */
-        for (i = (tmpblkSizePE)*nPE; i < blockSize; i++) {
-            pDst[i] = pSrcA[i] * pSrcB[i];
-        }
-        /* #endif */
-
-        /* #define PLP_MATH_LOOPUNROLL */
+        // Fork the multiplication to nPE cores (i.e. processing units)
+        hal_cl_team_fork(nPE, plp_mult_f32p_xpulpv2, (void *)&S);
     }
 }
 
@@ -60,7 +60,7 @@
 
 void plp_offset_i16(const int16_t * pSrc, int16_t offset, int16_t * pDst, uint32_t blockSize) {
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_offset_i16s_rv32im(pSrc, offset, pDst, blockSize);
     } else {
         plp_offset_i16s_xpulpv2(pSrc, offset, pDst, blockSize);
@@ -50,7 +50,7 @@
 
 void plp_offset_i32(const int32_t * pSrc, int32_t offset, int32_t * pDst, uint32_t blockSize) {
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_offset_i32s_rv32im(pSrc, offset, pDst, blockSize);
     } else {
         plp_offset_i32s_xpulpv2(pSrc, offset, pDst, blockSize);
@@ -61,7 +61,7 @@
 
 void plp_scale_i16(const int16_t *__restrict__ pSrc, int16_t scaleFactor, int32_t shift, int16_t *__restrict__ pDst, uint32_t blockSize) {
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_scale_i16s_rv32im(pSrc, scaleFactor, shift, pDst, blockSize);
     } else {
         plp_scale_i16s_xpulpv2(pSrc, scaleFactor, shift, pDst, blockSize);
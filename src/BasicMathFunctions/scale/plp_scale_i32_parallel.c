@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_scale_i32_parallel.c
+ * Description:  32-bit integer parallel scaling glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicScale
+  @{
+ */
+
+/**
+  @brief Glue code for parallel scaling of 32-bit integer vectors.
+  @param[in]  pSrc         points to the input vector
+  @param[in]  blockSize    number of samples in each vector
+  @param[in]  scaleFactor  factor to multiply all elements with
+  @param[in]  shift        number of bits to shift the result by
+  @param[in]  nPE          number of parallel processing units
+  @param[out] pDst         points to the output vector
+  @return     none
+ */
+
+void plp_scale_i32_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t scaleFactor,
+                            int32_t shift,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        plp_scale_instance_i32 S;
+
+        // Initialize the plp_scale_instance
+        S.pSrc = pSrc;
+        S.blockSize = blockSize;
+        S.scaleFactor = scaleFactor;
+        S.shift = shift;
+        S.nPE = nPE;
+        S.pDst = pDst;
+
+        // Fork the scaling to nPE cores (i.e. processing units)
+        hal_cl_team_fork(nPE, plp_scale_i32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of BasicScale group
+ */
@@ -50,7 +50,7 @@
 
 void plp_sub_i32(const int32_t * pSrcA, const int32_t * pSrcB, int32_t * pDst, uint32_t blockSize) {
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_sub_i32s_rv32im(pSrcA, pSrcB, pDst, blockSize);
     } else {
         plp_sub_i32s_xpulpv2(pSrcA, pSrcB, pDst, blockSize);
@@ -7548,8 +7548,12 @@ const uint16_t plpBitRevIndexTable_fixed_4096[PLPBITREVINDEXTABLE_FIXED_4096_TAB
     32248, 32504
 };
 
-/* 
-# python code to generate twiddles
+/*
+  The twiddle factors and bit reversal LUTs of the real FFT are defined next to the constant
+  instances in plp_rfft_sR_f32_len<FFTLength>.c, one file per length, such that only the tables of
+  the lengths in use are linked. They are generated by:
+
+# python code to generate the twiddles (FFTLength/2 values)
 import cmath as C
 def rfft_twiddles(FFTLength: int):
     N = FFTLength//2
@@ -7561,664 +7565,15 @@ def rfft_twiddles(FFTLength: int):
         print("{: .8f}f".format(twiddles[i].imag)+" },", end='')
         print("  ", end='')
     print("")
-*/
 
-const Complex_type_f32 twiddleCoef_rfft_32[16] = {
-    {  1.00000000f, -0.00000000f },  {  0.98078528f, -0.19509032f },  {  0.92387953f, -0.38268343f },  
-    {  0.83146961f, -0.55557023f },  {  0.70710678f, -0.70710678f },  {  0.55557023f, -0.83146961f },  
-    {  0.38268343f, -0.92387953f },  {  0.19509032f, -0.98078528f },  {  0.00000000f, -1.00000000f },  
-    { -0.19509032f, -0.98078528f },  { -0.38268343f, -0.92387953f },  { -0.55557023f, -0.83146961f },  
-    { -0.70710678f, -0.70710678f },  { -0.83146961f, -0.55557023f },  { -0.92387953f, -0.38268343f },  
-    { -0.98078528f, -0.19509032f }
-};
-
-const Complex_type_f32 twiddleCoef_rfft_128[64] = {
-    {  1.00000000f, -0.00000000f },  {  0.99879546f, -0.04906767f },  {  0.99518473f, -0.09801714f },  
-    {  0.98917651f, -0.14673047f },  {  0.98078528f, -0.19509032f },  {  0.97003125f, -0.24298018f },  
-    {  0.95694034f, -0.29028468f },  {  0.94154407f, -0.33688985f },  {  0.92387953f, -0.38268343f },  
-    {  0.90398929f, -0.42755509f },  {  0.88192126f, -0.47139674f },  {  0.85772861f, -0.51410274f },  
-    {  0.83146961f, -0.55557023f },  {  0.80320753f, -0.59569930f },  {  0.77301045f, -0.63439328f },  
-    {  0.74095113f, -0.67155895f },  {  0.70710678f, -0.70710678f },  {  0.67155895f, -0.74095113f },  
-    {  0.63439328f, -0.77301045f },  {  0.59569930f, -0.80320753f },  {  0.55557023f, -0.83146961f },  
-    {  0.51410274f, -0.85772861f },  {  0.47139674f, -0.88192126f },  {  0.42755509f, -0.90398929f },  
-    {  0.38268343f, -0.92387953f },  {  0.33688985f, -0.94154407f },  {  0.29028468f, -0.95694034f },  
-    {  0.24298018f, -0.97003125f },  {  0.19509032f, -0.98078528f },  {  0.14673047f, -0.98917651f },  
-    {  0.09801714f, -0.99518473f },  {  0.04906767f, -0.99879546f },  {  0.00000000f, -1.00000000f },  
-    { -0.04906767f, -0.99879546f },  { -0.09801714f, -0.99518473f },  { -0.14673047f, -0.98917651f },  
-    { -0.19509032f, -0.98078528f },  { -0.24298018f, -0.97003125f },  { -0.29028468f, -0.95694034f },  
-    { -0.33688985f, -0.94154407f },  { -0.38268343f, -0.92387953f },  { -0.42755509f, -0.90398929f },  
-    { -0.47139674f, -0.88192126f },  { -0.51410274f, -0.85772861f },  { -0.55557023f, -0.83146961f },  
-    { -0.59569930f, -0.80320753f },  { -0.63439328f, -0.77301045f },  { -0.67155895f, -0.74095113f },  
-    { -0.70710678f, -0.70710678f },  { -0.74095113f, -0.67155895f },  { -0.77301045f, -0.63439328f },  
-    { -0.80320753f, -0.59569930f },  { -0.83146961f, -0.55557023f },  { -0.85772861f, -0.51410274f },  
-    { -0.88192126f, -0.47139674f },  { -0.90398929f, -0.42755509f },  { -0.92387953f, -0.38268343f },  
-    { -0.94154407f, -0.33688985f },  { -0.95694034f, -0.29028468f },  { -0.97003125f, -0.24298018f },  
-    { -0.98078528f, -0.19509032f },  { -0.98917651f, -0.14673047f },  { -0.99518473f, -0.09801714f },  
-    { -0.99879546f, -0.04906767f }
-};
-const Complex_type_f32 twiddleCoef_rfft_512[256] = {
-    {  1.00000000f, -0.00000000f },  {  0.99992470f, -0.01227154f },  {  0.99969882f, -0.02454123f },  
-    {  0.99932238f, -0.03680722f },  {  0.99879546f, -0.04906767f },  {  0.99811811f, -0.06132074f },  
-    {  0.99729046f, -0.07356456f },  {  0.99631261f, -0.08579731f },  {  0.99518473f, -0.09801714f },  
-    {  0.99390697f, -0.11022221f },  {  0.99247953f, -0.12241068f },  {  0.99090264f, -0.13458071f },  
-    {  0.98917651f, -0.14673047f },  {  0.98730142f, -0.15885814f },  {  0.98527764f, -0.17096189f },  
-    {  0.98310549f, -0.18303989f },  {  0.98078528f, -0.19509032f },  {  0.97831737f, -0.20711138f },  
-    {  0.97570213f, -0.21910124f },  {  0.97293995f, -0.23105811f },  {  0.97003125f, -0.24298018f },  
-    {  0.96697647f, -0.25486566f },  {  0.96377607f, -0.26671276f },  {  0.96043052f, -0.27851969f },  
-    {  0.95694034f, -0.29028468f },  {  0.95330604f, -0.30200595f },  {  0.94952818f, -0.31368174f },  
-    {  0.94560733f, -0.32531029f },  {  0.94154407f, -0.33688985f },  {  0.93733901f, -0.34841868f },  
-    {  0.93299280f, -0.35989504f },  {  0.92850608f, -0.37131719f },  {  0.92387953f, -0.38268343f },  
-    {  0.91911385f, -0.39399204f },  {  0.91420976f, -0.40524131f },  {  0.90916798f, -0.41642956f },  
-    {  0.90398929f, -0.42755509f },  {  0.89867447f, -0.43861624f },  {  0.89322430f, -0.44961133f },  
-    {  0.88763962f, -0.46053871f },  {  0.88192126f, -0.47139674f },  {  0.87607009f, -0.48218377f },  
-    {  0.87008699f, -0.49289819f },  {  0.86397286f, -0.50353838f },  {  0.85772861f, -0.51410274f },  
-    {  0.85135519f, -0.52458968f },  {  0.84485357f, -0.53499762f },  {  0.83822471f, -0.54532499f },  
-    {  0.83146961f, -0.55557023f },  {  0.82458930f, -0.56573181f },  {  0.81758481f, -0.57580819f },  
-    {  0.81045720f, -0.58579786f },  {  0.80320753f, -0.59569930f },  {  0.79583690f, -0.60551104f },  
-    {  0.78834643f, -0.61523159f },  {  0.78073723f, -0.62485949f },  {  0.77301045f, -0.63439328f },  
-    {  0.76516727f, -0.64383154f },  {  0.75720885f, -0.65317284f },  {  0.74913639f, -0.66241578f },  
-    {  0.74095113f, -0.67155895f },  {  0.73265427f, -0.68060100f },  {  0.72424708f, -0.68954054f },  
-    {  0.71573083f, -0.69837625f },  {  0.70710678f, -0.70710678f },  {  0.69837625f, -0.71573083f },  
-    {  0.68954054f, -0.72424708f },  {  0.68060100f, -0.73265427f },  {  0.67155895f, -0.74095113f },  
-    {  0.66241578f, -0.74913639f },  {  0.65317284f, -0.75720885f },  {  0.64383154f, -0.76516727f },  
-    {  0.63439328f, -0.77301045f },  {  0.62485949f, -0.78073723f },  {  0.61523159f, -0.78834643f },  
-    {  0.60551104f, -0.79583690f },  {  0.59569930f, -0.80320753f },  {  0.58579786f, -0.81045720f },  
-    {  0.57580819f, -0.81758481f },  {  0.56573181f, -0.82458930f },  {  0.55557023f, -0.83146961f },  
-    {  0.54532499f, -0.83822471f },  {  0.53499762f, -0.84485357f },  {  0.52458968f, -0.85135519f },  
-    {  0.51410274f, -0.85772861f },  {  0.50353838f, -0.86397286f },  {  0.49289819f, -0.87008699f },  
-    {  0.48218377f, -0.87607009f },  {  0.47139674f, -0.88192126f },  {  0.46053871f, -0.88763962f },  
-    {  0.44961133f, -0.89322430f },  {  0.43861624f, -0.89867447f },  {  0.42755509f, -0.90398929f },  
-    {  0.41642956f, -0.90916798f },  {  0.40524131f, -0.91420976f },  {  0.39399204f, -0.91911385f },  
-    {  0.38268343f, -0.92387953f },  {  0.37131719f, -0.92850608f },  {  0.35989504f, -0.93299280f },  
-    {  0.34841868f, -0.93733901f },  {  0.33688985f, -0.94154407f },  {  0.32531029f, -0.94560733f },  
-    {  0.31368174f, -0.94952818f },  {  0.30200595f, -0.95330604f },  {  0.29028468f, -0.95694034f },  
-    {  0.27851969f, -0.96043052f },  {  0.26671276f, -0.96377607f },  {  0.25486566f, -0.96697647f },  
-    {  0.24298018f, -0.97003125f },  {  0.23105811f, -0.97293995f },  {  0.21910124f, -0.97570213f },  
-    {  0.20711138f, -0.97831737f },  {  0.19509032f, -0.98078528f },  {  0.18303989f, -0.98310549f },  
-    {  0.17096189f, -0.98527764f },  {  0.15885814f, -0.98730142f },  {  0.14673047f, -0.98917651f },  
-    {  0.13458071f, -0.99090264f },  {  0.12241068f, -0.99247953f },  {  0.11022221f, -0.99390697f },  
-    {  0.09801714f, -0.99518473f },  {  0.08579731f, -0.99631261f },  {  0.07356456f, -0.99729046f },  
-    {  0.06132074f, -0.99811811f },  {  0.04906767f, -0.99879546f },  {  0.03680722f, -0.99932238f },  
-    {  0.02454123f, -0.99969882f },  {  0.01227154f, -0.99992470f },  {  0.00000000f, -1.00000000f },  
-    { -0.01227154f, -0.99992470f },  { -0.02454123f, -0.99969882f },  { -0.03680722f, -0.99932238f },  
-    { -0.04906767f, -0.99879546f },  { -0.06132074f, -0.99811811f },  { -0.07356456f, -0.99729046f },  
-    { -0.08579731f, -0.99631261f },  { -0.09801714f, -0.99518473f },  { -0.11022221f, -0.99390697f },  
-    { -0.12241068f, -0.99247953f },  { -0.13458071f, -0.99090264f },  { -0.14673047f, -0.98917651f },  
-    { -0.15885814f, -0.98730142f },  { -0.17096189f, -0.98527764f },  { -0.18303989f, -0.98310549f },  
-    { -0.19509032f, -0.98078528f },  { -0.20711138f, -0.97831737f },  { -0.21910124f, -0.97570213f },  
-    { -0.23105811f, -0.97293995f },  { -0.24298018f, -0.97003125f },  { -0.25486566f, -0.96697647f },  
-    { -0.26671276f, -0.96377607f },  { -0.27851969f, -0.96043052f },  { -0.29028468f, -0.95694034f },  
-    { -0.30200595f, -0.95330604f },  { -0.31368174f, -0.94952818f },  { -0.32531029f, -0.94560733f },  
-    { -0.33688985f, -0.94154407f },  { -0.34841868f, -0.93733901f },  { -0.35989504f, -0.93299280f },  
-    { -0.37131719f, -0.92850608f },  { -0.38268343f, -0.92387953f },  { -0.39399204f, -0.91911385f },  
-    { -0.40524131f, -0.91420976f },  { -0.41642956f, -0.90916798f },  { -0.42755509f, -0.90398929f },  
-    { -0.43861624f, -0.89867447f },  { -0.44961133f, -0.89322430f },  { -0.46053871f, -0.88763962f },  
-    { -0.47139674f, -0.88192126f },  { -0.48218377f, -0.87607009f },  { -0.49289819f, -0.87008699f },  
-    { -0.50353838f, -0.86397286f },  { -0.51410274f, -0.85772861f },  { -0.52458968f, -0.85135519f },  
-    { -0.53499762f, -0.84485357f },  { -0.54532499f, -0.83822471f },  { -0.55557023f, -0.83146961f },  
-    { -0.56573181f, -0.82458930f },  { -0.57580819f, -0.81758481f },  { -0.58579786f, -0.81045720f },  
-    { -0.59569930f, -0.80320753f },  { -0.60551104f, -0.79583690f },  { -0.61523159f, -0.78834643f },  
-    { -0.62485949f, -0.78073723f },  { -0.63439328f, -0.77301045f },  { -0.64383154f, -0.76516727f },  
-    { -0.65317284f, -0.75720885f },  { -0.66241578f, -0.74913639f },  { -0.67155895f, -0.74095113f },  
-    { -0.68060100f, -0.73265427f },  { -0.68954054f, -0.72424708f },  { -0.69837625f, -0.71573083f },  
-    { -0.70710678f, -0.70710678f },  { -0.71573083f, -0.69837625f },  { -0.72424708f, -0.68954054f },  
-    { -0.73265427f, -0.68060100f },  { -0.74095113f, -0.67155895f },  { -0.74913639f, -0.66241578f },  
-    { -0.75720885f, -0.65317284f },  { -0.76516727f, -0.64383154f },  { -0.77301045f, -0.63439328f },  
-    { -0.78073723f, -0.62485949f },  { -0.78834643f, -0.61523159f },  { -0.79583690f, -0.60551104f },  
-    { -0.80320753f, -0.59569930f },  { -0.81045720f, -0.58579786f },  { -0.81758481f, -0.57580819f },  
-    { -0.82458930f, -0.56573181f },  { -0.83146961f, -0.55557023f },  { -0.83822471f, -0.54532499f },  
-    { -0.84485357f, -0.53499762f },  { -0.85135519f, -0.52458968f },  { -0.85772861f, -0.51410274f },  
-    { -0.86397286f, -0.50353838f },  { -0.87008699f, -0.49289819f },  { -0.87607009f, -0.48218377f },  
-    { -0.88192126f, -0.47139674f },  { -0.88763962f, -0.46053871f },  { -0.89322430f, -0.44961133f },  
-    { -0.89867447f, -0.43861624f },  { -0.90398929f, -0.42755509f },  { -0.90916798f, -0.41642956f },  
-    { -0.91420976f, -0.40524131f },  { -0.91911385f, -0.39399204f },  { -0.92387953f, -0.38268343f },  
-    { -0.92850608f, -0.37131719f },  { -0.93299280f, -0.35989504f },  { -0.93733901f, -0.34841868f },  
-    { -0.94154407f, -0.33688985f },  { -0.94560733f, -0.32531029f },  { -0.94952818f, -0.31368174f },  
-    { -0.95330604f, -0.30200595f },  { -0.95694034f, -0.29028468f },  { -0.96043052f, -0.27851969f },  
-    { -0.96377607f, -0.26671276f },  { -0.96697647f, -0.25486566f },  { -0.97003125f, -0.24298018f },  
-    { -0.97293995f, -0.23105811f },  { -0.97570213f, -0.21910124f },  { -0.97831737f, -0.20711138f },  
-    { -0.98078528f, -0.19509032f },  { -0.98310549f, -0.18303989f },  { -0.98527764f, -0.17096189f },  
-    { -0.98730142f, -0.15885814f },  { -0.98917651f, -0.14673047f },  { -0.99090264f, -0.13458071f },  
-    { -0.99247953f, -0.12241068f },  { -0.99390697f, -0.11022221f },  { -0.99518473f, -0.09801714f },  
-    { -0.99631261f, -0.08579731f },  { -0.99729046f, -0.07356456f },  { -0.99811811f, -0.06132074f },  
-    { -0.99879546f, -0.04906767f },  { -0.99932238f, -0.03680722f },  { -0.99969882f, -0.02454123f },  
-    { -0.99992470f, -0.01227154f }
-};
-
-const Complex_type_f32 twiddleCoef_rfft_2048[1024] = {
-    { 1.000000f, 0.000000f },   { 0.999995f, -0.003068f },  { 0.999981f, -0.006136f },
-    { 0.999958f, -0.009204f },  { 0.999925f, -0.012272f },  { 0.999882f, -0.015339f },
-    { 0.999831f, -0.018407f },  { 0.999769f, -0.021474f },  { 0.999699f, -0.024541f },
-    { 0.999619f, -0.027608f },  { 0.999529f, -0.030675f },  { 0.999431f, -0.033741f },
-    { 0.999322f, -0.036807f },  { 0.999205f, -0.039873f },  { 0.999078f, -0.042938f },
-    { 0.998941f, -0.046003f },  { 0.998795f, -0.049068f },  { 0.998640f, -0.052132f },
-    { 0.998476f, -0.055195f },  { 0.998302f, -0.058258f },  { 0.998118f, -0.061321f },
-    { 0.997925f, -0.064383f },  { 0.997723f, -0.067444f },  { 0.997511f, -0.070505f },
-    { 0.997290f, -0.073565f },  { 0.997060f, -0.076624f },  { 0.996820f, -0.079682f },
-    { 0.996571f, -0.082740f },  { 0.996313f, -0.085797f },  { 0.996045f, -0.088854f },
-    { 0.995767f, -0.091909f },  { 0.995481f, -0.094963f },  { 0.995185f, -0.098017f },
-    { 0.994879f, -0.101070f },  { 0.994565f, -0.104122f },  { 0.994240f, -0.107172f },
-    { 0.993907f, -0.110222f },  { 0.993564f, -0.113271f },  { 0.993212f, -0.116319f },
-    { 0.992850f, -0.119365f },  { 0.992480f, -0.122411f },  { 0.992099f, -0.125455f },
-    { 0.991710f, -0.128498f },  { 0.991311f, -0.131540f },  { 0.990903f, -0.134581f },
-    { 0.990485f, -0.137620f },  { 0.990058f, -0.140658f },  { 0.989622f, -0.143695f },
-    { 0.989177f, -0.146730f },  { 0.988722f, -0.149765f },  { 0.988258f, -0.152797f },
-    { 0.987784f, -0.155828f },  { 0.987301f, -0.158858f },  { 0.986809f, -0.161886f },
-    { 0.986308f, -0.164913f },  { 0.985798f, -0.167938f },  { 0.985278f, -0.170962f },
-    { 0.984749f, -0.173984f },  { 0.984210f, -0.177004f },  { 0.983662f, -0.180023f },
-    { 0.983105f, -0.183040f },  { 0.982539f, -0.186055f },  { 0.981964f, -0.189069f },
-    { 0.981379f, -0.192080f },  { 0.980785f, -0.195090f },  { 0.980182f, -0.198098f },
-    { 0.979570f, -0.201105f },  { 0.978948f, -0.204109f },  { 0.978317f, -0.207111f },
-    { 0.977677f, -0.210112f },  { 0.977028f, -0.213110f },  { 0.976370f, -0.216107f },
-    { 0.975702f, -0.219101f },  { 0.975025f, -0.222094f },  { 0.974339f, -0.225084f },
-    { 0.973644f, -0.228072f },  { 0.972940f, -0.231058f },  { 0.972226f, -0.234042f },
-    { 0.971504f, -0.237024f },  { 0.970772f, -0.240003f },  { 0.970031f, -0.242980f },
-    { 0.969281f, -0.245955f },  { 0.968522f, -0.248928f },  { 0.967754f, -0.251898f },
-    { 0.966976f, -0.254866f },  { 0.966190f, -0.257831f },  { 0.965394f, -0.260794f },
-    { 0.964590f, -0.263755f },  { 0.963776f, -0.266713f },  { 0.962953f, -0.269668f },
-    { 0.962121f, -0.272621f },  { 0.961280f, -0.275572f },  { 0.960431f, -0.278520f },
-    { 0.959572f, -0.281465f },  { 0.958703f, -0.284408f },  { 0.957826f, -0.287347f },
-    { 0.956940f, -0.290285f },  { 0.956045f, -0.293219f },  { 0.955141f, -0.296151f },
-    { 0.954228f, -0.299080f },  { 0.953306f, -0.302006f },  { 0.952375f, -0.304929f },
-    { 0.951435f, -0.307850f },  { 0.950486f, -0.310767f },  { 0.949528f, -0.313682f },
-    { 0.948561f, -0.316593f },  { 0.947586f, -0.319502f },  { 0.946601f, -0.322408f },
-    { 0.945607f, -0.325310f },  { 0.944605f, -0.328210f },  { 0.943593f, -0.331106f },
-    { 0.942573f, -0.334000f },  { 0.941544f, -0.336890f },  { 0.940506f, -0.339777f },
-    { 0.939459f, -0.342661f },  { 0.938404f, -0.345541f },  { 0.937339f, -0.348419f },
-    { 0.936266f, -0.351293f },  { 0.935184f, -0.354164f },  { 0.934093f, -0.357031f },
-    { 0.932993f, -0.359895f },  { 0.931884f, -0.362756f },  { 0.930767f, -0.365613f },
-    { 0.929641f, -0.368467f },  { 0.928506f, -0.371317f },  { 0.927363f, -0.374164f },
-    { 0.926210f, -0.377007f },  { 0.925049f, -0.379847f },  { 0.923880f, -0.382683f },
-    { 0.922701f, -0.385516f },  { 0.921514f, -0.388345f },  { 0.920318f, -0.391170f },
-    { 0.919114f, -0.393992f },  { 0.917901f, -0.396810f },  { 0.916679f, -0.399624f },
-    { 0.915449f, -0.402435f },  { 0.914210f, -0.405241f },  { 0.912962f, -0.408044f },
-    { 0.911706f, -0.410843f },  { 0.910441f, -0.413638f },  { 0.909168f, -0.416430f },
-    { 0.907886f, -0.419217f },  { 0.906596f, -0.422000f },  { 0.905297f, -0.424780f },
-    { 0.903989f, -0.427555f },  { 0.902673f, -0.430326f },  { 0.901349f, -0.433094f },
-    { 0.900016f, -0.435857f },  { 0.898674f, -0.438616f },  { 0.897325f, -0.441371f },
-    { 0.895966f, -0.444122f },  { 0.894599f, -0.446869f },  { 0.893224f, -0.449611f },
-    { 0.891841f, -0.452350f },  { 0.890449f, -0.455084f },  { 0.889048f, -0.457813f },
-    { 0.887640f, -0.460539f },  { 0.886223f, -0.463260f },  { 0.884797f, -0.465976f },
-    { 0.883363f, -0.468689f },  { 0.881921f, -0.471397f },  { 0.880471f, -0.474100f },
-    { 0.879012f, -0.476799f },  { 0.877545f, -0.479494f },  { 0.876070f, -0.482184f },
-    { 0.874587f, -0.484869f },  { 0.873095f, -0.487550f },  { 0.871595f, -0.490226f },
-    { 0.870087f, -0.492898f },  { 0.868571f, -0.495565f },  { 0.867046f, -0.498228f },
-    { 0.865514f, -0.500885f },  { 0.863973f, -0.503538f },  { 0.862424f, -0.506187f },
-    { 0.860867f, -0.508830f },  { 0.859302f, -0.511469f },  { 0.857729f, -0.514103f },
-    { 0.856147f, -0.516732f },  { 0.854558f, -0.519356f },  { 0.852961f, -0.521975f },
-    { 0.851355f, -0.524590f },  { 0.849742f, -0.527199f },  { 0.848120f, -0.529804f },
-    { 0.846491f, -0.532403f },  { 0.844854f, -0.534998f },  { 0.843208f, -0.537587f },
-    { 0.841555f, -0.540171f },  { 0.839894f, -0.542751f },  { 0.838225f, -0.545325f },
-    { 0.836548f, -0.547894f },  { 0.834863f, -0.550458f },  { 0.833170f, -0.553017f },
-    { 0.831470f, -0.555570f },  { 0.829761f, -0.558119f },  { 0.828045f, -0.560662f },
-    { 0.826321f, -0.563199f },  { 0.824589f, -0.565732f },  { 0.822850f, -0.568259f },
-    { 0.821103f, -0.570781f },  { 0.819348f, -0.573297f },  { 0.817585f, -0.575808f },
-    { 0.815814f, -0.578314f },  { 0.814036f, -0.580814f },  { 0.812251f, -0.583309f },
-    { 0.810457f, -0.585798f },  { 0.808656f, -0.588282f },  { 0.806848f, -0.590760f },
-    { 0.805031f, -0.593232f },  { 0.803208f, -0.595699f },  { 0.801376f, -0.598161f },
-    { 0.799537f, -0.600616f },  { 0.797691f, -0.603067f },  { 0.795837f, -0.605511f },
-    { 0.793975f, -0.607950f },  { 0.792107f, -0.610383f },  { 0.790230f, -0.612810f },
-    { 0.788346f, -0.615232f },  { 0.786455f, -0.617647f },  { 0.784557f, -0.620057f },
-    { 0.782651f, -0.622461f },  { 0.780737f, -0.624859f },  { 0.778817f, -0.627252f },
-    { 0.776888f, -0.629638f },  { 0.774953f, -0.632019f },  { 0.773010f, -0.634393f },
-    { 0.771061f, -0.636762f },  { 0.769103f, -0.639124f },  { 0.767139f, -0.641481f },
-    { 0.765167f, -0.643832f },  { 0.763188f, -0.646176f },  { 0.761202f, -0.648514f },
-    { 0.759209f, -0.650847f },  { 0.757209f, -0.653173f },  { 0.755201f, -0.655493f },
-    { 0.753187f, -0.657807f },  { 0.751165f, -0.660114f },  { 0.749136f, -0.662416f },
-    { 0.747101f, -0.664711f },  { 0.745058f, -0.667000f },  { 0.743008f, -0.669283f },
-    { 0.740951f, -0.671559f },  { 0.738887f, -0.673829f },  { 0.736817f, -0.676093f },
-    { 0.734739f, -0.678350f },  { 0.732654f, -0.680601f },  { 0.730563f, -0.682846f },
-    { 0.728464f, -0.685084f },  { 0.726359f, -0.687315f },  { 0.724247f, -0.689541f },
-    { 0.722128f, -0.691759f },  { 0.720003f, -0.693971f },  { 0.717870f, -0.696177f },
-    { 0.715731f, -0.698376f },  { 0.713585f, -0.700569f },  { 0.711432f, -0.702755f },
-    { 0.709273f, -0.704934f },  { 0.707107f, -0.707107f },  { 0.704934f, -0.709273f },
-    { 0.702755f, -0.711432f },  { 0.700569f, -0.713585f },  { 0.698376f, -0.715731f },
-    { 0.696177f, -0.717870f },  { 0.693971f, -0.720003f },  { 0.691759f, -0.722128f },
-    { 0.689541f, -0.724247f },  { 0.687315f, -0.726359f },  { 0.685084f, -0.728464f },
-    { 0.682846f, -0.730563f },  { 0.680601f, -0.732654f },  { 0.678350f, -0.734739f },
-    { 0.676093f, -0.736817f },  { 0.673829f, -0.738887f },  { 0.671559f, -0.740951f },
-    { 0.669283f, -0.743008f },  { 0.667000f, -0.745058f },  { 0.664711f, -0.747101f },
-    { 0.662416f, -0.749136f },  { 0.660114f, -0.751165f },  { 0.657807f, -0.753187f },
-    { 0.655493f, -0.755201f },  { 0.653173f, -0.757209f },  { 0.650847f, -0.759209f },
-    { 0.648514f, -0.761202f },  { 0.646176f, -0.763188f },  { 0.643832f, -0.765167f },
-    { 0.641481f, -0.767139f },  { 0.639124f, -0.769103f },  { 0.636762f, -0.771061f },
-    { 0.634393f, -0.773010f },  { 0.632019f, -0.774953f },  { 0.629638f, -0.776888f },
-    { 0.627252f, -0.778817f },  { 0.624859f, -0.780737f },  { 0.622461f, -0.782651f },
-    { 0.620057f, -0.784557f },  { 0.617647f, -0.786455f },  { 0.615232f, -0.788346f },
-    { 0.612810f, -0.790230f },  { 0.610383f, -0.792107f },  { 0.607950f, -0.793975f },
-    { 0.605511f, -0.795837f },  { 0.603067f, -0.797691f },  { 0.600616f, -0.799537f },
-    { 0.598161f, -0.801376f },  { 0.595699f, -0.803208f },  { 0.593232f, -0.805031f },
-    { 0.590760f, -0.806848f },  { 0.588282f, -0.808656f },  { 0.585798f, -0.810457f },
-    { 0.583309f, -0.812251f },  { 0.580814f, -0.814036f },  { 0.578314f, -0.815814f },
-    { 0.575808f, -0.817585f },  { 0.573297f, -0.819348f },  { 0.570781f, -0.821103f },
-    { 0.568259f, -0.822850f },  { 0.565732f, -0.824589f },  { 0.563199f, -0.826321f },
-    { 0.560662f, -0.828045f },  { 0.558119f, -0.829761f },  { 0.555570f, -0.831470f },
-    { 0.553017f, -0.833170f },  { 0.550458f, -0.834863f },  { 0.547894f, -0.836548f },
-    { 0.545325f, -0.838225f },  { 0.542751f, -0.839894f },  { 0.540171f, -0.841555f },
-    { 0.537587f, -0.843208f },  { 0.534998f, -0.844854f },  { 0.532403f, -0.846491f },
-    { 0.529804f, -0.848120f },  { 0.527199f, -0.849742f },  { 0.524590f, -0.851355f },
-    { 0.521975f, -0.852961f },  { 0.519356f, -0.854558f },  { 0.516732f, -0.856147f },
-    { 0.514103f, -0.857729f },  { 0.511469f, -0.859302f },  { 0.508830f, -0.860867f },
-    { 0.506187f, -0.862424f },  { 0.503538f, -0.863973f },  { 0.500885f, -0.865514f },
-    { 0.498228f, -0.867046f },  { 0.495565f, -0.868571f },  { 0.492898f, -0.870087f },
-    { 0.490226f, -0.871595f },  { 0.487550f, -0.873095f },  { 0.484869f, -0.874587f },
-    { 0.482184f, -0.876070f },  { 0.479494f, -0.877545f },  { 0.476799f, -0.879012f },
-    { 0.474100f, -0.880471f },  { 0.471397f, -0.881921f },  { 0.468689f, -0.883363f },
-    { 0.465976f, -0.884797f },  { 0.463260f, -0.886223f },  { 0.460539f, -0.887640f },
-    { 0.457813f, -0.889048f },  { 0.455084f, -0.890449f },  { 0.452350f, -0.891841f },
-    { 0.449611f, -0.893224f },  { 0.446869f, -0.894599f },  { 0.444122f, -0.895966f },
-    { 0.441371f, -0.897325f },  { 0.438616f, -0.898674f },  { 0.435857f, -0.900016f },
-    { 0.433094f, -0.901349f },  { 0.430326f, -0.902673f },  { 0.427555f, -0.903989f },
-    { 0.424780f, -0.905297f },  { 0.422000f, -0.906596f },  { 0.419217f, -0.907886f },
-    { 0.416430f, -0.909168f },  { 0.413638f, -0.910441f },  { 0.410843f, -0.911706f },
-    { 0.408044f, -0.912962f },  { 0.405241f, -0.914210f },  { 0.402435f, -0.915449f },
-    { 0.399624f, -0.916679f },  { 0.396810f, -0.917901f },  { 0.393992f, -0.919114f },
-    { 0.391170f, -0.920318f },  { 0.388345f, -0.921514f },  { 0.385516f, -0.922701f },
-    { 0.382683f, -0.923880f },  { 0.379847f, -0.925049f },  { 0.377007f, -0.926210f },
-    { 0.374164f, -0.927363f },  { 0.371317f, -0.928506f },  { 0.368467f, -0.929641f },
-    { 0.365613f, -0.930767f },  { 0.362756f, -0.931884f },  { 0.359895f, -0.932993f },
-    { 0.357031f, -0.934093f },  { 0.354164f, -0.935184f },  { 0.351293f, -0.936266f },
-    { 0.348419f, -0.937339f },  { 0.345541f, -0.938404f },  { 0.342661f, -0.939459f },
-    { 0.339777f, -0.940506f },  { 0.336890f, -0.941544f },  { 0.334000f, -0.942573f },
-    { 0.331106f, -0.943593f },  { 0.328210f, -0.944605f },  { 0.325310f, -0.945607f },
-    { 0.322408f, -0.946601f },  { 0.319502f, -0.947586f },  { 0.316593f, -0.948561f },
-    { 0.313682f, -0.949528f },  { 0.310767f, -0.950486f },  { 0.307850f, -0.951435f },
-    { 0.304929f, -0.952375f },  { 0.302006f, -0.953306f },  { 0.299080f, -0.954228f },
-    { 0.296151f, -0.955141f },  { 0.293219f, -0.956045f },  { 0.290285f, -0.956940f },
-    { 0.287347f, -0.957826f },  { 0.284408f, -0.958703f },  { 0.281465f, -0.959572f },
-    { 0.278520f, -0.960431f },  { 0.275572f, -0.961280f },  { 0.272621f, -0.962121f },
-    { 0.269668f, -0.962953f },  { 0.266713f, -0.963776f },  { 0.263755f, -0.964590f },
-    { 0.260794f, -0.965394f },  { 0.257831f, -0.966190f },  { 0.254866f, -0.966976f },
-    { 0.251898f, -0.967754f },  { 0.248928f, -0.968522f },  { 0.245955f, -0.969281f },
-    { 0.242980f, -0.970031f },  { 0.240003f, -0.970772f },  { 0.237024f, -0.971504f },
-    { 0.234042f, -0.972226f },  { 0.231058f, -0.972940f },  { 0.228072f, -0.973644f },
-    { 0.225084f, -0.974339f },  { 0.222094f, -0.975025f },  { 0.219101f, -0.975702f },
-    { 0.216107f, -0.976370f },  { 0.213110f, -0.977028f },  { 0.210112f, -0.977677f },
-    { 0.207111f, -0.978317f },  { 0.204109f, -0.978948f },  { 0.201105f, -0.979570f },
-    { 0.198098f, -0.980182f },  { 0.195090f, -0.980785f },  { 0.192080f, -0.981379f },
-    { 0.189069f, -0.981964f },  { 0.186055f, -0.982539f },  { 0.183040f, -0.983105f },
-    { 0.180023f, -0.983662f },  { 0.177004f, -0.984210f },  { 0.173984f, -0.984749f },
-    { 0.170962f, -0.985278f },  { 0.167938f, -0.985798f },  { 0.164913f, -0.986308f },
-    { 0.161886f, -0.986809f },  { 0.158858f, -0.987301f },  { 0.155828f, -0.987784f },
-    { 0.152797f, -0.988258f },  { 0.149765f, -0.988722f },  { 0.146730f, -0.989177f },
-    { 0.143695f, -0.989622f },  { 0.140658f, -0.990058f },  { 0.137620f, -0.990485f },
-    { 0.134581f, -0.990903f },  { 0.131540f, -0.991311f },  { 0.128498f, -0.991710f },
-    { 0.125455f, -0.992099f },  { 0.122411f, -0.992480f },  { 0.119365f, -0.992850f },
-    { 0.116319f, -0.993212f },  { 0.113271f, -0.993564f },  { 0.110222f, -0.993907f },
-    { 0.107172f, -0.994240f },  { 0.104122f, -0.994565f },  { 0.101070f, -0.994879f },
-    { 0.098017f, -0.995185f },  { 0.094963f, -0.995481f },  { 0.091909f, -0.995767f },
-    { 0.088854f, -0.996045f },  { 0.085797f, -0.996313f },  { 0.082740f, -0.996571f },
-    { 0.079682f, -0.996820f },  { 0.076624f, -0.997060f },  { 0.073565f, -0.997290f },
-    { 0.070505f, -0.997511f },  { 0.067444f, -0.997723f },  { 0.064383f, -0.997925f },
-    { 0.061321f, -0.998118f },  { 0.058258f, -0.998302f },  { 0.055195f, -0.998476f },
-    { 0.052132f, -0.998640f },  { 0.049068f, -0.998795f },  { 0.046003f, -0.998941f },
-    { 0.042938f, -0.999078f },  { 0.039873f, -0.999205f },  { 0.036807f, -0.999322f },
-    { 0.033741f, -0.999431f },  { 0.030675f, -0.999529f },  { 0.027608f, -0.999619f },
-    { 0.024541f, -0.999699f },  { 0.021474f, -0.999769f },  { 0.018407f, -0.999831f },
-    { 0.015339f, -0.999882f },  { 0.012272f, -0.999925f },  { 0.009204f, -0.999958f },
-    { 0.006136f, -0.999981f },  { 0.003068f, -0.999995f },  { 0.000000f, -1.000000f },
-    { -0.003068f, -0.999995f }, { -0.006136f, -0.999981f }, { -0.009204f, -0.999958f },
-    { -0.012272f, -0.999925f }, { -0.015339f, -0.999882f }, { -0.018407f, -0.999831f },
-    { -0.021474f, -0.999769f }, { -0.024541f, -0.999699f }, { -0.027608f, -0.999619f },
-    { -0.030675f, -0.999529f }, { -0.033741f, -0.999431f }, { -0.036807f, -0.999322f },
-    { -0.039873f, -0.999205f }, { -0.042938f, -0.999078f }, { -0.046003f, -0.998941f },
-    { -0.049068f, -0.998795f }, { -0.052132f, -0.998640f }, { -0.055195f, -0.998476f },
-    { -0.058258f, -0.998302f }, { -0.061321f, -0.998118f }, { -0.064383f, -0.997925f },
-    { -0.067444f, -0.997723f }, { -0.070505f, -0.997511f }, { -0.073565f, -0.997290f },
-    { -0.076624f, -0.997060f }, { -0.079682f, -0.996820f }, { -0.082740f, -0.996571f },
-    { -0.085797f, -0.996313f }, { -0.088854f, -0.996045f }, { -0.091909f, -0.995767f },
-    { -0.094963f, -0.995481f }, { -0.098017f, -0.995185f }, { -0.101070f, -0.994879f },
-    { -0.104122f, -0.994565f }, { -0.107172f, -0.994240f }, { -0.110222f, -0.993907f },
-    { -0.113271f, -0.993564f }, { -0.116319f, -0.993212f }, { -0.119365f, -0.992850f },
-    { -0.122411f, -0.992480f }, { -0.125455f, -0.992099f }, { -0.128498f, -0.991710f },
-    { -0.131540f, -0.991311f }, { -0.134581f, -0.990903f }, { -0.137620f, -0.990485f },
-    { -0.140658f, -0.990058f }, { -0.143695f, -0.989622f }, { -0.146730f, -0.989177f },
-    { -0.149765f, -0.988722f }, { -0.152797f, -0.988258f }, { -0.155828f, -0.987784f },
-    { -0.158858f, -0.987301f }, { -0.161886f, -0.986809f }, { -0.164913f, -0.986308f },
-    { -0.167938f, -0.985798f }, { -0.170962f, -0.985278f }, { -0.173984f, -0.984749f },
-    { -0.177004f, -0.984210f }, { -0.180023f, -0.983662f }, { -0.183040f, -0.983105f },
-    { -0.186055f, -0.982539f }, { -0.189069f, -0.981964f }, { -0.192080f, -0.981379f },
-    { -0.195090f, -0.980785f }, { -0.198098f, -0.980182f }, { -0.201105f, -0.979570f },
-    { -0.204109f, -0.978948f }, { -0.207111f, -0.978317f }, { -0.210112f, -0.977677f },
-    { -0.213110f, -0.977028f }, { -0.216107f, -0.976370f }, { -0.219101f, -0.975702f },
-    { -0.222094f, -0.975025f }, { -0.225084f, -0.974339f }, { -0.228072f, -0.973644f },
-    { -0.231058f, -0.972940f }, { -0.234042f, -0.972226f }, { -0.237024f, -0.971504f },
-    { -0.240003f, -0.970772f }, { -0.242980f, -0.970031f }, { -0.245955f, -0.969281f },
-    { -0.248928f, -0.968522f }, { -0.251898f, -0.967754f }, { -0.254866f, -0.966976f },
-    { -0.257831f, -0.966190f }, { -0.260794f, -0.965394f }, { -0.263755f, -0.964590f },
-    { -0.266713f, -0.963776f }, { -0.269668f, -0.962953f }, { -0.272621f, -0.962121f },
-    { -0.275572f, -0.961280f }, { -0.278520f, -0.960431f }, { -0.281465f, -0.959572f },
-    { -0.284408f, -0.958703f }, { -0.287347f, -0.957826f }, { -0.290285f, -0.956940f },
-    { -0.293219f, -0.956045f }, { -0.296151f, -0.955141f }, { -0.299080f, -0.954228f },
-    { -0.302006f, -0.953306f }, { -0.304929f, -0.952375f }, { -0.307850f, -0.951435f },
-    { -0.310767f, -0.950486f }, { -0.313682f, -0.949528f }, { -0.316593f, -0.948561f },
-    { -0.319502f, -0.947586f }, { -0.322408f, -0.946601f }, { -0.325310f, -0.945607f },
-    { -0.328210f, -0.944605f }, { -0.331106f, -0.943593f }, { -0.334000f, -0.942573f },
-    { -0.336890f, -0.941544f }, { -0.339777f, -0.940506f }, { -0.342661f, -0.939459f },
-    { -0.345541f, -0.938404f }, { -0.348419f, -0.937339f }, { -0.351293f, -0.936266f },
-    { -0.354164f, -0.935184f }, { -0.357031f, -0.934093f }, { -0.359895f, -0.932993f },
-    { -0.362756f, -0.931884f }, { -0.365613f, -0.930767f }, { -0.368467f, -0.929641f },
-    { -0.371317f, -0.928506f }, { -0.374164f, -0.927363f }, { -0.377007f, -0.926210f },
-    { -0.379847f, -0.925049f }, { -0.382683f, -0.923880f }, { -0.385516f, -0.922701f },
-    { -0.388345f, -0.921514f }, { -0.391170f, -0.920318f }, { -0.393992f, -0.919114f },
-    { -0.396810f, -0.917901f }, { -0.399624f, -0.916679f }, { -0.402435f, -0.915449f },
-    { -0.405241f, -0.914210f }, { -0.408044f, -0.912962f }, { -0.410843f, -0.911706f },
-    { -0.413638f, -0.910441f }, { -0.416430f, -0.909168f }, { -0.419217f, -0.907886f },
-    { -0.422000f, -0.906596f }, { -0.424780f, -0.905297f }, { -0.427555f, -0.903989f },
-    { -0.430326f, -0.902673f }, { -0.433094f, -0.901349f }, { -0.435857f, -0.900016f },
-    { -0.438616f, -0.898674f }, { -0.441371f, -0.897325f }, { -0.444122f, -0.895966f },
-    { -0.446869f, -0.894599f }, { -0.449611f, -0.893224f }, { -0.452350f, -0.891841f },
-    { -0.455084f, -0.890449f }, { -0.457813f, -0.889048f }, { -0.460539f, -0.887640f },
-    { -0.463260f, -0.886223f }, { -0.465976f, -0.884797f }, { -0.468689f, -0.883363f },
-    { -0.471397f, -0.881921f }, { -0.474100f, -0.880471f }, { -0.476799f, -0.879012f },
-    { -0.479494f, -0.877545f }, { -0.482184f, -0.876070f }, { -0.484869f, -0.874587f },
-    { -0.487550f, -0.873095f }, { -0.490226f, -0.871595f }, { -0.492898f, -0.870087f },
-    { -0.495565f, -0.868571f }, { -0.498228f, -0.867046f }, { -0.500885f, -0.865514f },
-    { -0.503538f, -0.863973f }, { -0.506187f, -0.862424f }, { -0.508830f, -0.860867f },
-    { -0.511469f, -0.859302f }, { -0.514103f, -0.857729f }, { -0.516732f, -0.856147f },
-    { -0.519356f, -0.854558f }, { -0.521975f, -0.852961f }, { -0.524590f, -0.851355f },
-    { -0.527199f, -0.849742f }, { -0.529804f, -0.848120f }, { -0.532403f, -0.846491f },
-    { -0.534998f, -0.844854f }, { -0.537587f, -0.843208f }, { -0.540171f, -0.841555f },
-    { -0.542751f, -0.839894f }, { -0.545325f, -0.838225f }, { -0.547894f, -0.836548f },
-    { -0.550458f, -0.834863f }, { -0.553017f, -0.833170f }, { -0.555570f, -0.831470f },
-    { -0.558119f, -0.829761f }, { -0.560662f, -0.828045f }, { -0.563199f, -0.826321f },
-    { -0.565732f, -0.824589f }, { -0.568259f, -0.822850f }, { -0.570781f, -0.821103f },
-    { -0.573297f, -0.819348f }, { -0.575808f, -0.817585f }, { -0.578314f, -0.815814f },
-    { -0.580814f, -0.814036f }, { -0.583309f, -0.812251f }, { -0.585798f, -0.810457f },
-    { -0.588282f, -0.808656f }, { -0.590760f, -0.806848f }, { -0.593232f, -0.805031f },
-    { -0.595699f, -0.803208f }, { -0.598161f, -0.801376f }, { -0.600616f, -0.799537f },
-    { -0.603067f, -0.797691f }, { -0.605511f, -0.795837f }, { -0.607950f, -0.793975f },
-    { -0.610383f, -0.792107f }, { -0.612810f, -0.790230f }, { -0.615232f, -0.788346f },
-    { -0.617647f, -0.786455f }, { -0.620057f, -0.784557f }, { -0.622461f, -0.782651f },
-    { -0.624859f, -0.780737f }, { -0.627252f, -0.778817f }, { -0.629638f, -0.776888f },
-    { -0.632019f, -0.774953f }, { -0.634393f, -0.773010f }, { -0.636762f, -0.771061f },
-    { -0.639124f, -0.769103f }, { -0.641481f, -0.767139f }, { -0.643832f, -0.765167f },
-    { -0.646176f, -0.763188f }, { -0.648514f, -0.761202f }, { -0.650847f, -0.759209f },
-    { -0.653173f, -0.757209f }, { -0.655493f, -0.755201f }, { -0.657807f, -0.753187f },
-    { -0.660114f, -0.751165f }, { -0.662416f, -0.749136f }, { -0.664711f, -0.747101f },
-    { -0.667000f, -0.745058f }, { -0.669283f, -0.743008f }, { -0.671559f, -0.740951f },
-    { -0.673829f, -0.738887f }, { -0.676093f, -0.736817f }, { -0.678350f, -0.734739f },
-    { -0.680601f, -0.732654f }, { -0.682846f, -0.730563f }, { -0.685084f, -0.728464f },
-    { -0.687315f, -0.726359f }, { -0.689541f, -0.724247f }, { -0.691759f, -0.722128f },
-    { -0.693971f, -0.720003f }, { -0.696177f, -0.717870f }, { -0.698376f, -0.715731f },
-    { -0.700569f, -0.713585f }, { -0.702755f, -0.711432f }, { -0.704934f, -0.709273f },
-    { -0.707107f, -0.707107f }, { -0.709273f, -0.704934f }, { -0.711432f, -0.702755f },
-    { -0.713585f, -0.700569f }, { -0.715731f, -0.698376f }, { -0.717870f, -0.696177f },
-    { -0.720003f, -0.693971f }, { -0.722128f, -0.691759f }, { -0.724247f, -0.689541f },
-    { -0.726359f, -0.687315f }, { -0.728464f, -0.685084f }, { -0.730563f, -0.682846f },
-    { -0.732654f, -0.680601f }, { -0.734739f, -0.678350f }, { -0.736817f, -0.676093f },
-    { -0.738887f, -0.673829f }, { -0.740951f, -0.671559f }, { -0.743008f, -0.669283f },
-    { -0.745058f, -0.667000f }, { -0.747101f, -0.664711f }, { -0.749136f, -0.662416f },
-    { -0.751165f, -0.660114f }, { -0.753187f, -0.657807f }, { -0.755201f, -0.655493f },
-    { -0.757209f, -0.653173f }, { -0.759209f, -0.650847f }, { -0.761202f, -0.648514f },
-    { -0.763188f, -0.646176f }, { -0.765167f, -0.643832f }, { -0.767139f, -0.641481f },
-    { -0.769103f, -0.639124f }, { -0.771061f, -0.636762f }, { -0.773010f, -0.634393f },
-    { -0.774953f, -0.632019f }, { -0.776888f, -0.629638f }, { -0.778817f, -0.627252f },
-    { -0.780737f, -0.624859f }, { -0.782651f, -0.622461f }, { -0.784557f, -0.620057f },
-    { -0.786455f, -0.617647f }, { -0.788346f, -0.615232f }, { -0.790230f, -0.612810f },
-    { -0.792107f, -0.610383f }, { -0.793975f, -0.607950f }, { -0.795837f, -0.605511f },
-    { -0.797691f, -0.603067f }, { -0.799537f, -0.600616f }, { -0.801376f, -0.598161f },
-    { -0.803208f, -0.595699f }, { -0.805031f, -0.593232f }, { -0.806848f, -0.590760f },
-    { -0.808656f, -0.588282f }, { -0.810457f, -0.585798f }, { -0.812251f, -0.583309f },
-    { -0.814036f, -0.580814f }, { -0.815814f, -0.578314f }, { -0.817585f, -0.575808f },
-    { -0.819348f, -0.573297f }, { -0.821103f, -0.570781f }, { -0.822850f, -0.568259f },
-    { -0.824589f, -0.565732f }, { -0.826321f, -0.563199f }, { -0.828045f, -0.560662f },
-    { -0.829761f, -0.558119f }, { -0.831470f, -0.555570f }, { -0.833170f, -0.553017f },
-    { -0.834863f, -0.550458f }, { -0.836548f, -0.547894f }, { -0.838225f, -0.545325f },
-    { -0.839894f, -0.542751f }, { -0.841555f, -0.540171f }, { -0.843208f, -0.537587f },
-    { -0.844854f, -0.534998f }, { -0.846491f, -0.532403f }, { -0.848120f, -0.529804f },
-    { -0.849742f, -0.527199f }, { -0.851355f, -0.524590f }, { -0.852961f, -0.521975f },
-    { -0.854558f, -0.519356f }, { -0.856147f, -0.516732f }, { -0.857729f, -0.514103f },
-    { -0.859302f, -0.511469f }, { -0.860867f, -0.508830f }, { -0.862424f, -0.506187f },
-    { -0.863973f, -0.503538f }, { -0.865514f, -0.500885f }, { -0.867046f, -0.498228f },
-    { -0.868571f, -0.495565f }, { -0.870087f, -0.492898f }, { -0.871595f, -0.490226f },
-    { -0.873095f, -0.487550f }, { -0.874587f, -0.484869f }, { -0.876070f, -0.482184f },
-    { -0.877545f, -0.479494f }, { -0.879012f, -0.476799f }, { -0.880471f, -0.474100f },
-    { -0.881921f, -0.471397f }, { -0.883363f, -0.468689f }, { -0.884797f, -0.465976f },
-    { -0.886223f, -0.463260f }, { -0.887640f, -0.460539f }, { -0.889048f, -0.457813f },
-    { -0.890449f, -0.455084f }, { -0.891841f, -0.452350f }, { -0.893224f, -0.449611f },
-    { -0.894599f, -0.446869f }, { -0.895966f, -0.444122f }, { -0.897325f, -0.441371f },
-    { -0.898674f, -0.438616f }, { -0.900016f, -0.435857f }, { -0.901349f, -0.433094f },
-    { -0.902673f, -0.430326f }, { -0.903989f, -0.427555f }, { -0.905297f, -0.424780f },
-    { -0.906596f, -0.422000f }, { -0.907886f, -0.419217f }, { -0.909168f, -0.416430f },
-    { -0.910441f, -0.413638f }, { -0.911706f, -0.410843f }, { -0.912962f, -0.408044f },
-    { -0.914210f, -0.405241f }, { -0.915449f, -0.402435f }, { -0.916679f, -0.399624f },
-    { -0.917901f, -0.396810f }, { -0.919114f, -0.393992f }, { -0.920318f, -0.391170f },
-    { -0.921514f, -0.388345f }, { -0.922701f, -0.385516f }, { -0.923880f, -0.382683f },
-    { -0.925049f, -0.379847f }, { -0.926210f, -0.377007f }, { -0.927363f, -0.374164f },
-    { -0.928506f, -0.371317f }, { -0.929641f, -0.368467f }, { -0.930767f, -0.365613f },
-    { -0.931884f, -0.362756f }, { -0.932993f, -0.359895f }, { -0.934093f, -0.357031f },
-    { -0.935184f, -0.354164f }, { -0.936266f, -0.351293f }, { -0.937339f, -0.348419f },
-    { -0.938404f, -0.345541f }, { -0.939459f, -0.342661f }, { -0.940506f, -0.339777f },
-    { -0.941544f, -0.336890f }, { -0.942573f, -0.334000f }, { -0.943593f, -0.331106f },
-    { -0.944605f, -0.328210f }, { -0.945607f, -0.325310f }, { -0.946601f, -0.322408f },
-    { -0.947586f, -0.319502f }, { -0.948561f, -0.316593f }, { -0.949528f, -0.313682f },
-    { -0.950486f, -0.310767f }, { -0.951435f, -0.307850f }, { -0.952375f, -0.304929f },
-    { -0.953306f, -0.302006f }, { -0.954228f, -0.299080f }, { -0.955141f, -0.296151f },
-    { -0.956045f, -0.293219f }, { -0.956940f, -0.290285f }, { -0.957826f, -0.287347f },
-    { -0.958703f, -0.284408f }, { -0.959572f, -0.281465f }, { -0.960431f, -0.278520f },
-    { -0.961280f, -0.275572f }, { -0.962121f, -0.272621f }, { -0.962953f, -0.269668f },
-    { -0.963776f, -0.266713f }, { -0.964590f, -0.263755f }, { -0.965394f, -0.260794f },
-    { -0.966190f, -0.257831f }, { -0.966976f, -0.254866f }, { -0.967754f, -0.251898f },
-    { -0.968522f, -0.248928f }, { -0.969281f, -0.245955f }, { -0.970031f, -0.242980f },
-    { -0.970772f, -0.240003f }, { -0.971504f, -0.237024f }, { -0.972226f, -0.234042f },
-    { -0.972940f, -0.231058f }, { -0.973644f, -0.228072f }, { -0.974339f, -0.225084f },
-    { -0.975025f, -0.222094f }, { -0.975702f, -0.219101f }, { -0.976370f, -0.216107f },
-    { -0.977028f, -0.213110f }, { -0.977677f, -0.210112f }, { -0.978317f, -0.207111f },
-    { -0.978948f, -0.204109f }, { -0.979570f, -0.201105f }, { -0.980182f, -0.198098f },
-    { -0.980785f, -0.195090f }, { -0.981379f, -0.192080f }, { -0.981964f, -0.189069f },
-    { -0.982539f, -0.186055f }, { -0.983105f, -0.183040f }, { -0.983662f, -0.180023f },
-    { -0.984210f, -0.177004f }, { -0.984749f, -0.173984f }, { -0.985278f, -0.170962f },
-    { -0.985798f, -0.167938f }, { -0.986308f, -0.164913f }, { -0.986809f, -0.161886f },
-    { -0.987301f, -0.158858f }, { -0.987784f, -0.155828f }, { -0.988258f, -0.152797f },
-    { -0.988722f, -0.149765f }, { -0.989177f, -0.146730f }, { -0.989622f, -0.143695f },
-    { -0.990058f, -0.140658f }, { -0.990485f, -0.137620f }, { -0.990903f, -0.134581f },
-    { -0.991311f, -0.131540f }, { -0.991710f, -0.128498f }, { -0.992099f, -0.125455f },
-    { -0.992480f, -0.122411f }, { -0.992850f, -0.119365f }, { -0.993212f, -0.116319f },
-    { -0.993564f, -0.113271f }, { -0.993907f, -0.110222f }, { -0.994240f, -0.107172f },
-    { -0.994565f, -0.104122f }, { -0.994879f, -0.101070f }, { -0.995185f, -0.098017f },
-    { -0.995481f, -0.094963f }, { -0.995767f, -0.091909f }, { -0.996045f, -0.088854f },
-    { -0.996313f, -0.085797f }, { -0.996571f, -0.082740f }, { -0.996820f, -0.079682f },
-    { -0.997060f, -0.076624f }, { -0.997290f, -0.073565f }, { -0.997511f, -0.070505f },
-    { -0.997723f, -0.067444f }, { -0.997925f, -0.064383f }, { -0.998118f, -0.061321f },
-    { -0.998302f, -0.058258f }, { -0.998476f, -0.055195f }, { -0.998640f, -0.052132f },
-    { -0.998795f, -0.049068f }, { -0.998941f, -0.046003f }, { -0.999078f, -0.042938f },
-    { -0.999205f, -0.039873f }, { -0.999322f, -0.036807f }, { -0.999431f, -0.033741f },
-    { -0.999529f, -0.030675f }, { -0.999619f, -0.027608f }, { -0.999699f, -0.024541f },
-    { -0.999769f, -0.021474f }, { -0.999831f, -0.018407f }, { -0.999882f, -0.015339f },
-    { -0.999925f, -0.012272f }, { -0.999958f, -0.009204f }, { -0.999981f, -0.006136f },
-    { -0.999995f, -0.003068f },
-};
-
-/*
-# python script for generating these LUTs
-# replace 9 with log(FFTLength) (both occurrances!)
-# after pasting, use gqq in vim to separate onto different lines
-for i in range(2**9):
-    print(int("{:0>9}".format(bin(i)[2:])[::-1],2), end=', ')
+# python code to generate the bit reversal LUTs (FFTLength values)
+import textwrap
+def rfft_bit_rev(FFTLength: int):
+    log2N = FFTLength.bit_length() - 1
+    lut = [int("{:0>{}}".format(bin(i)[2:], log2N)[::-1], 2) for i in range(FFTLength)]
+    print(textwrap.fill(", ".join(str(v) for v in lut), 80))
 */
 
-short bit_rev_radix2_LUT_32[32] = {
-0, 16, 8, 24, 4, 20, 12, 28, 2, 18, 10, 26, 6, 22, 14, 30, 1, 17, 9, 25, 5,
-21, 13, 29, 3, 19, 11, 27, 7, 23, 15, 31
-};
-
-short bit_rev_radix2_LUT_128[128] = {
-0, 64, 32, 96, 16, 80, 48, 112, 8, 72, 40, 104, 24, 88, 56, 120, 4, 68, 36,
-100, 20, 84, 52, 116, 12, 76, 44, 108, 28, 92, 60, 124, 2, 66, 34, 98, 18, 82,
-50, 114, 10, 74, 42, 106, 26, 90, 58, 122, 6, 70, 38, 102, 22, 86, 54, 118,
-14, 78, 46, 110, 30, 94, 62, 126, 1, 65, 33, 97, 17, 81, 49, 113, 9, 73, 41,
-105, 25, 89, 57, 121, 5, 69, 37, 101, 21, 85, 53, 117, 13, 77, 45, 109, 29,
-93, 61, 125, 3, 67, 35, 99, 19, 83, 51, 115, 11, 75, 43, 107, 27, 91, 59, 123,
-7, 71, 39, 103, 23, 87, 55, 119, 15, 79, 47, 111, 31, 95, 63, 127
-};
-
-short bit_rev_radix2_LUT_512[512] = {
-0, 256, 128, 384, 64, 320, 192, 448, 32, 288, 160, 416, 96, 352, 224, 480, 16,
-272, 144, 400, 80, 336, 208, 464, 48, 304, 176, 432, 112, 368, 240, 496, 8,
-264, 136, 392, 72, 328, 200, 456, 40, 296, 168, 424, 104, 360, 232, 488, 24,
-280, 152, 408, 88, 344, 216, 472, 56, 312, 184, 440, 120, 376, 248, 504, 4,
-260, 132, 388, 68, 324, 196, 452, 36, 292, 164, 420, 100, 356, 228, 484, 20,
-276, 148, 404, 84, 340, 212, 468, 52, 308, 180, 436, 116, 372, 244, 500, 12,
-268, 140, 396, 76, 332, 204, 460, 44, 300, 172, 428, 108, 364, 236, 492, 28,
-284, 156, 412, 92, 348, 220, 476, 60, 316, 188, 444, 124, 380, 252, 508, 2,
-258, 130, 386, 66, 322, 194, 450, 34, 290, 162, 418, 98, 354, 226, 482, 18,
-274, 146, 402, 82, 338, 210, 466, 50, 306, 178, 434, 114, 370, 242, 498, 10,
-266, 138, 394, 74, 330, 202, 458, 42, 298, 170, 426, 106, 362, 234, 490, 26,
-282, 154, 410, 90, 346, 218, 474, 58, 314, 186, 442, 122, 378, 250, 506, 6,
-262, 134, 390, 70, 326, 198, 454, 38, 294, 166, 422, 102, 358, 230, 486, 22,
-278, 150, 406, 86, 342, 214, 470, 54, 310, 182, 438, 118, 374, 246, 502, 14,
-270, 142, 398, 78, 334, 206, 462, 46, 302, 174, 430, 110, 366, 238, 494, 30,
-286, 158, 414, 94, 350, 222, 478, 62, 318, 190, 446, 126, 382, 254, 510, 1,
-257, 129, 385, 65, 321, 193, 449, 33, 289, 161, 417, 97, 353, 225, 481, 17,
-273, 145, 401, 81, 337, 209, 465, 49, 305, 177, 433, 113, 369, 241, 497, 9,
-265, 137, 393, 73, 329, 201, 457, 41, 297, 169, 425, 105, 361, 233, 489, 25,
-281, 153, 409, 89, 345, 217, 473, 57, 313, 185, 441, 121, 377, 249, 505, 5,
-261, 133, 389, 69, 325, 197, 453, 37, 293, 165, 421, 101, 357, 229, 485, 21,
-277, 149, 405, 85, 341, 213, 469, 53, 309, 181, 437, 117, 373, 245, 501, 13,
-269, 141, 397, 77, 333, 205, 461, 45, 301, 173, 429, 109, 365, 237, 493, 29,
-285, 157, 413, 93, 349, 221, 477, 61, 317, 189, 445, 125, 381, 253, 509, 3,
-259, 131, 387, 67, 323, 195, 451, 35, 291, 163, 419, 99, 355, 227, 483, 19,
-275, 147, 403, 83, 339, 211, 467, 51, 307, 179, 435, 115, 371, 243, 499, 11,
-267, 139, 395, 75, 331, 203, 459, 43, 299, 171, 427, 107, 363, 235, 491, 27,
-283, 155, 411, 91, 347, 219, 475, 59, 315, 187, 443, 123, 379, 251, 507, 7,
-263, 135, 391, 71, 327, 199, 455, 39, 295, 167, 423, 103, 359, 231, 487, 23,
-279, 151, 407, 87, 343, 215, 471, 55, 311, 183, 439, 119, 375, 247, 503, 15,
-271, 143, 399, 79, 335, 207, 463, 47, 303, 175, 431, 111, 367, 239, 495, 31,
-287, 159, 415, 95, 351, 223, 479, 63, 319, 191, 447, 127, 383, 255, 511,
-};
-
-short bit_rev_radix2_LUT[2048] = {
-    0,   1024, 512, 1536, 256, 1280, 768, 1792, 128, 1152, 640, 1664, 384, 1408, 896,  1920,
-    64,  1088, 576, 1600, 320, 1344, 832, 1856, 192, 1216, 704, 1728, 448, 1472, 960,  1984,
-    32,  1056, 544, 1568, 288, 1312, 800, 1824, 160, 1184, 672, 1696, 416, 1440, 928,  1952,
-    96,  1120, 608, 1632, 352, 1376, 864, 1888, 224, 1248, 736, 1760, 480, 1504, 992,  2016,
-    16,  1040, 528, 1552, 272, 1296, 784, 1808, 144, 1168, 656, 1680, 400, 1424, 912,  1936,
-    80,  1104, 592, 1616, 336, 1360, 848, 1872, 208, 1232, 720, 1744, 464, 1488, 976,  2000,
-    48,  1072, 560, 1584, 304, 1328, 816, 1840, 176, 1200, 688, 1712, 432, 1456, 944,  1968,
-    112, 1136, 624, 1648, 368, 1392, 880, 1904, 240, 1264, 752, 1776, 496, 1520, 1008, 2032,
-    8,   1032, 520, 1544, 264, 1288, 776, 1800, 136, 1160, 648, 1672, 392, 1416, 904,  1928,
-    72,  1096, 584, 1608, 328, 1352, 840, 1864, 200, 1224, 712, 1736, 456, 1480, 968,  1992,
-    40,  1064, 552, 1576, 296, 1320, 808, 1832, 168, 1192, 680, 1704, 424, 1448, 936,  1960,
-    104, 1128, 616, 1640, 360, 1384, 872, 1896, 232, 1256, 744, 1768, 488, 1512, 1000, 2024,
-    24,  1048, 536, 1560, 280, 1304, 792, 1816, 152, 1176, 664, 1688, 408, 1432, 920,  1944,
-    88,  1112, 600, 1624, 344, 1368, 856, 1880, 216, 1240, 728, 1752, 472, 1496, 984,  2008,
-    56,  1080, 568, 1592, 312, 1336, 824, 1848, 184, 1208, 696, 1720, 440, 1464, 952,  1976,
-    120, 1144, 632, 1656, 376, 1400, 888, 1912, 248, 1272, 760, 1784, 504, 1528, 1016, 2040,
-    4,   1028, 516, 1540, 260, 1284, 772, 1796, 132, 1156, 644, 1668, 388, 1412, 900,  1924,
-    68,  1092, 580, 1604, 324, 1348, 836, 1860, 196, 1220, 708, 1732, 452, 1476, 964,  1988,
-    36,  1060, 548, 1572, 292, 1316, 804, 1828, 164, 1188, 676, 1700, 420, 1444, 932,  1956,
-    100, 1124, 612, 1636, 356, 1380, 868, 1892, 228, 1252, 740, 1764, 484, 1508, 996,  2020,
-    20,  1044, 532, 1556, 276, 1300, 788, 1812, 148, 1172, 660, 1684, 404, 1428, 916,  1940,
-    84,  1108, 596, 1620, 340, 1364, 852, 1876, 212, 1236, 724, 1748, 468, 1492, 980,  2004,
-    52,  1076, 564, 1588, 308, 1332, 820, 1844, 180, 1204, 692, 1716, 436, 1460, 948,  1972,
-    116, 1140, 628, 1652, 372, 1396, 884, 1908, 244, 1268, 756, 1780, 500, 1524, 1012, 2036,
-    12,  1036, 524, 1548, 268, 1292, 780, 1804, 140, 1164, 652, 1676, 396, 1420, 908,  1932,
-    76,  1100, 588, 1612, 332, 1356, 844, 1868, 204, 1228, 716, 1740, 460, 1484, 972,  1996,
-    44,  1068, 556, 1580, 300, 1324, 812, 1836, 172, 1196, 684, 1708, 428, 1452, 940,  1964,
-    108, 1132, 620, 1644, 364, 1388, 876, 1900, 236, 1260, 748, 1772, 492, 1516, 1004, 2028,
-    28,  1052, 540, 1564, 284, 1308, 796, 1820, 156, 1180, 668, 1692, 412, 1436, 924,  1948,
-    92,  1116, 604, 1628, 348, 1372, 860, 1884, 220, 1244, 732, 1756, 476, 1500, 988,  2012,
-    60,  1084, 572, 1596, 316, 1340, 828, 1852, 188, 1212, 700, 1724, 444, 1468, 956,  1980,
-    124, 1148, 636, 1660, 380, 1404, 892, 1916, 252, 1276, 764, 1788, 508, 1532, 1020, 2044,
-    2,   1026, 514, 1538, 258, 1282, 770, 1794, 130, 1154, 642, 1666, 386, 1410, 898,  1922,
-    66,  1090, 578, 1602, 322, 1346, 834, 1858, 194, 1218, 706, 1730, 450, 1474, 962,  1986,
-    34,  1058, 546, 1570, 290, 1314, 802, 1826, 162, 1186, 674, 1698, 418, 1442, 930,  1954,
-    98,  1122, 610, 1634, 354, 1378, 866, 1890, 226, 1250, 738, 1762, 482, 1506, 994,  2018,
-    18,  1042, 530, 1554, 274, 1298, 786, 1810, 146, 1170, 658, 1682, 402, 1426, 914,  1938,
-    82,  1106, 594, 1618, 338, 1362, 850, 1874, 210, 1234, 722, 1746, 466, 1490, 978,  2002,
-    50,  1074, 562, 1586, 306, 1330, 818, 1842, 178, 1202, 690, 1714, 434, 1458, 946,  1970,
-    114, 1138, 626, 1650, 370, 1394, 882, 1906, 242, 1266, 754, 1778, 498, 1522, 1010, 2034,
-    10,  1034, 522, 1546, 266, 1290, 778, 1802, 138, 1162, 650, 1674, 394, 1418, 906,  1930,
-    74,  1098, 586, 1610, 330, 1354, 842, 1866, 202, 1226, 714, 1738, 458, 1482, 970,  1994,
-    42,  1066, 554, 1578, 298, 1322, 810, 1834, 170, 1194, 682, 1706, 426, 1450, 938,  1962,
-    106, 1130, 618, 1642, 362, 1386, 874, 1898, 234, 1258, 746, 1770, 490, 1514, 1002, 2026,
-    26,  1050, 538, 1562, 282, 1306, 794, 1818, 154, 1178, 666, 1690, 410, 1434, 922,  1946,
-    90,  1114, 602, 1626, 346, 1370, 858, 1882, 218, 1242, 730, 1754, 474, 1498, 986,  2010,
-    58,  1082, 570, 1594, 314, 1338, 826, 1850, 186, 1210, 698, 1722, 442, 1466, 954,  1978,
-    122, 1146, 634, 1658, 378, 1402, 890, 1914, 250, 1274, 762, 1786, 506, 1530, 1018, 2042,
-    6,   1030, 518, 1542, 262, 1286, 774, 1798, 134, 1158, 646, 1670, 390, 1414, 902,  1926,
-    70,  1094, 582, 1606, 326, 1350, 838, 1862, 198, 1222, 710, 1734, 454, 1478, 966,  1990,
-    38,  1062, 550, 1574, 294, 1318, 806, 1830, 166, 1190, 678, 1702, 422, 1446, 934,  1958,
-    102, 1126, 614, 1638, 358, 1382, 870, 1894, 230, 1254, 742, 1766, 486, 1510, 998,  2022,
-    22,  1046, 534, 1558, 278, 1302, 790, 1814, 150, 1174, 662, 1686, 406, 1430, 918,  1942,
-    86,  1110, 598, 1622, 342, 1366, 854, 1878, 214, 1238, 726, 1750, 470, 1494, 982,  2006,
-    54,  1078, 566, 1590, 310, 1334, 822, 1846, 182, 1206, 694, 1718, 438, 1462, 950,  1974,
-    118, 1142, 630, 1654, 374, 1398, 886, 1910, 246, 1270, 758, 1782, 502, 1526, 1014, 2038,
-    14,  1038, 526, 1550, 270, 1294, 782, 1806, 142, 1166, 654, 1678, 398, 1422, 910,  1934,
-    78,  1102, 590, 1614, 334, 1358, 846, 1870, 206, 1230, 718, 1742, 462, 1486, 974,  1998,
-    46,  1070, 558, 1582, 302, 1326, 814, 1838, 174, 1198, 686, 1710, 430, 1454, 942,  1966,
-    110, 1134, 622, 1646, 366, 1390, 878, 1902, 238, 1262, 750, 1774, 494, 1518, 1006, 2030,
-    30,  1054, 542, 1566, 286, 1310, 798, 1822, 158, 1182, 670, 1694, 414, 1438, 926,  1950,
-    94,  1118, 606, 1630, 350, 1374, 862, 1886, 222, 1246, 734, 1758, 478, 1502, 990,  2014,
-    62,  1086, 574, 1598, 318, 1342, 830, 1854, 190, 1214, 702, 1726, 446, 1470, 958,  1982,
-    126, 1150, 638, 1662, 382, 1406, 894, 1918, 254, 1278, 766, 1790, 510, 1534, 1022, 2046,
-    1,   1025, 513, 1537, 257, 1281, 769, 1793, 129, 1153, 641, 1665, 385, 1409, 897,  1921,
-    65,  1089, 577, 1601, 321, 1345, 833, 1857, 193, 1217, 705, 1729, 449, 1473, 961,  1985,
-    33,  1057, 545, 1569, 289, 1313, 801, 1825, 161, 1185, 673, 1697, 417, 1441, 929,  1953,
-    97,  1121, 609, 1633, 353, 1377, 865, 1889, 225, 1249, 737, 1761, 481, 1505, 993,  2017,
-    17,  1041, 529, 1553, 273, 1297, 785, 1809, 145, 1169, 657, 1681, 401, 1425, 913,  1937,
-    81,  1105, 593, 1617, 337, 1361, 849, 1873, 209, 1233, 721, 1745, 465, 1489, 977,  2001,
-    49,  1073, 561, 1585, 305, 1329, 817, 1841, 177, 1201, 689, 1713, 433, 1457, 945,  1969,
-    113, 1137, 625, 1649, 369, 1393, 881, 1905, 241, 1265, 753, 1777, 497, 1521, 1009, 2033,
-    9,   1033, 521, 1545, 265, 1289, 777, 1801, 137, 1161, 649, 1673, 393, 1417, 905,  1929,
-    73,  1097, 585, 1609, 329, 1353, 841, 1865, 201, 1225, 713, 1737, 457, 1481, 969,  1993,
-    41,  1065, 553, 1577, 297, 1321, 809, 1833, 169, 1193, 681, 1705, 425, 1449, 937,  1961,
-    105, 1129, 617, 1641, 361, 1385, 873, 1897, 233, 1257, 745, 1769, 489, 1513, 1001, 2025,
-    25,  1049, 537, 1561, 281, 1305, 793, 1817, 153, 1177, 665, 1689, 409, 1433, 921,  1945,
-    89,  1113, 601, 1625, 345, 1369, 857, 1881, 217, 1241, 729, 1753, 473, 1497, 985,  2009,
-    57,  1081, 569, 1593, 313, 1337, 825, 1849, 185, 1209, 697, 1721, 441, 1465, 953,  1977,
-    121, 1145, 633, 1657, 377, 1401, 889, 1913, 249, 1273, 761, 1785, 505, 1529, 1017, 2041,
-    5,   1029, 517, 1541, 261, 1285, 773, 1797, 133, 1157, 645, 1669, 389, 1413, 901,  1925,
-    69,  1093, 581, 1605, 325, 1349, 837, 1861, 197, 1221, 709, 1733, 453, 1477, 965,  1989,
-    37,  1061, 549, 1573, 293, 1317, 805, 1829, 165, 1189, 677, 1701, 421, 1445, 933,  1957,
-    101, 1125, 613, 1637, 357, 1381, 869, 1893, 229, 1253, 741, 1765, 485, 1509, 997,  2021,
-    21,  1045, 533, 1557, 277, 1301, 789, 1813, 149, 1173, 661, 1685, 405, 1429, 917,  1941,
-    85,  1109, 597, 1621, 341, 1365, 853, 1877, 213, 1237, 725, 1749, 469, 1493, 981,  2005,
-    53,  1077, 565, 1589, 309, 1333, 821, 1845, 181, 1205, 693, 1717, 437, 1461, 949,  1973,
-    117, 1141, 629, 1653, 373, 1397, 885, 1909, 245, 1269, 757, 1781, 501, 1525, 1013, 2037,
-    13,  1037, 525, 1549, 269, 1293, 781, 1805, 141, 1165, 653, 1677, 397, 1421, 909,  1933,
-    77,  1101, 589, 1613, 333, 1357, 845, 1869, 205, 1229, 717, 1741, 461, 1485, 973,  1997,
-    45,  1069, 557, 1581, 301, 1325, 813, 1837, 173, 1197, 685, 1709, 429, 1453, 941,  1965,
-    109, 1133, 621, 1645, 365, 1389, 877, 1901, 237, 1261, 749, 1773, 493, 1517, 1005, 2029,
-    29,  1053, 541, 1565, 285, 1309, 797, 1821, 157, 1181, 669, 1693, 413, 1437, 925,  1949,
-    93,  1117, 605, 1629, 349, 1373, 861, 1885, 221, 1245, 733, 1757, 477, 1501, 989,  2013,
-    61,  1085, 573, 1597, 317, 1341, 829, 1853, 189, 1213, 701, 1725, 445, 1469, 957,  1981,
-    125, 1149, 637, 1661, 381, 1405, 893, 1917, 253, 1277, 765, 1789, 509, 1533, 1021, 2045,
-    3,   1027, 515, 1539, 259, 1283, 771, 1795, 131, 1155, 643, 1667, 387, 1411, 899,  1923,
-    67,  1091, 579, 1603, 323, 1347, 835, 1859, 195, 1219, 707, 1731, 451, 1475, 963,  1987,
-    35,  1059, 547, 1571, 291, 1315, 803, 1827, 163, 1187, 675, 1699, 419, 1443, 931,  1955,
-    99,  1123, 611, 1635, 355, 1379, 867, 1891, 227, 1251, 739, 1763, 483, 1507, 995,  2019,
-    19,  1043, 531, 1555, 275, 1299, 787, 1811, 147, 1171, 659, 1683, 403, 1427, 915,  1939,
-    83,  1107, 595, 1619, 339, 1363, 851, 1875, 211, 1235, 723, 1747, 467, 1491, 979,  2003,
-    51,  1075, 563, 1587, 307, 1331, 819, 1843, 179, 1203, 691, 1715, 435, 1459, 947,  1971,
-    115, 1139, 627, 1651, 371, 1395, 883, 1907, 243, 1267, 755, 1779, 499, 1523, 1011, 2035,
-    11,  1035, 523, 1547, 267, 1291, 779, 1803, 139, 1163, 651, 1675, 395, 1419, 907,  1931,
-    75,  1099, 587, 1611, 331, 1355, 843, 1867, 203, 1227, 715, 1739, 459, 1483, 971,  1995,
-    43,  1067, 555, 1579, 299, 1323, 811, 1835, 171, 1195, 683, 1707, 427, 1451, 939,  1963,
-    107, 1131, 619, 1643, 363, 1387, 875, 1899, 235, 1259, 747, 1771, 491, 1515, 1003, 2027,
-    27,  1051, 539, 1563, 283, 1307, 795, 1819, 155, 1179, 667, 1691, 411, 1435, 923,  1947,
-    91,  1115, 603, 1627, 347, 1371, 859, 1883, 219, 1243, 731, 1755, 475, 1499, 987,  2011,
-    59,  1083, 571, 1595, 315, 1339, 827, 1851, 187, 1211, 699, 1723, 443, 1467, 955,  1979,
-    123, 1147, 635, 1659, 379, 1403, 891, 1915, 251, 1275, 763, 1787, 507, 1531, 1019, 2043,
-    7,   1031, 519, 1543, 263, 1287, 775, 1799, 135, 1159, 647, 1671, 391, 1415, 903,  1927,
-    71,  1095, 583, 1607, 327, 1351, 839, 1863, 199, 1223, 711, 1735, 455, 1479, 967,  1991,
-    39,  1063, 551, 1575, 295, 1319, 807, 1831, 167, 1191, 679, 1703, 423, 1447, 935,  1959,
-    103, 1127, 615, 1639, 359, 1383, 871, 1895, 231, 1255, 743, 1767, 487, 1511, 999,  2023,
-    23,  1047, 535, 1559, 279, 1303, 791, 1815, 151, 1175, 663, 1687, 407, 1431, 919,  1943,
-    87,  1111, 599, 1623, 343, 1367, 855, 1879, 215, 1239, 727, 1751, 471, 1495, 983,  2007,
-    55,  1079, 567, 1591, 311, 1335, 823, 1847, 183, 1207, 695, 1719, 439, 1463, 951,  1975,
-    119, 1143, 631, 1655, 375, 1399, 887, 1911, 247, 1271, 759, 1783, 503, 1527, 1015, 2039,
-    15,  1039, 527, 1551, 271, 1295, 783, 1807, 143, 1167, 655, 1679, 399, 1423, 911,  1935,
-    79,  1103, 591, 1615, 335, 1359, 847, 1871, 207, 1231, 719, 1743, 463, 1487, 975,  1999,
-    47,  1071, 559, 1583, 303, 1327, 815, 1839, 175, 1199, 687, 1711, 431, 1455, 943,  1967,
-    111, 1135, 623, 1647, 367, 1391, 879, 1903, 239, 1263, 751, 1775, 495, 1519, 1007, 2031,
-    31,  1055, 543, 1567, 287, 1311, 799, 1823, 159, 1183, 671, 1695, 415, 1439, 927,  1951,
-    95,  1119, 607, 1631, 351, 1375, 863, 1887, 223, 1247, 735, 1759, 479, 1503, 991,  2015,
-    63,  1087, 575, 1599, 319, 1343, 831, 1855, 191, 1215, 703, 1727, 447, 1471, 959,  1983,
-    127, 1151, 639, 1663, 383, 1407, 895, 1919, 255, 1279, 767, 1791, 511, 1535, 1023, 2047,
-};
-
 /**
   @par
   Example code for the generation of the floating-point sine table:
@@ -8916,6 +8271,75 @@ const int16_t sinTable_q16[FAST_MATH_TABLE_SIZE + 1] = {
     -3212,  -2811,  -2411,  -2009,  -1608,  -1206,  -804,   -402,   0
 };
 
+/**
+  @par
+  Reciprocals of the fixed point logarithm, in Q1.31 (unsigned) and rounded up:
+  <pre>
+  for (i = 0; i < 64; i++)
+  {
+  logRecipTable[i] = ceil(pow(2, 31) / (1 + i / 64.0));
+  }</pre>
+ */
+const uint32_t logRecipTable_q32[FAST_MATH_LOG_TABLE_SIZE] = {
+    0x80000000U, 0x7E07E07FU, 0x7C1F07C2U, 0x7A44C6B0U, 0x78787879U, 0x76B981DBU,
+    0x75075076U, 0x73615A25U, 0x71C71C72U, 0x70381C0FU, 0x6EB3E454U, 0x6D3A06D4U,
+    0x6BCA1AF3U, 0x6A63BD82U, 0x6906906AU, 0x67B23A55U, 0x66666667U, 0x6522C3F4U,
+    0x63E7063FU, 0x62B2E43EU, 0x61861862U, 0x60606061U, 0x5F417D06U, 0x5E293206U,
+    0x5D1745D2U, 0x5C0B8171U, 0x5B05B05CU, 0x5A05A05BU, 0x590B2165U, 0x58160582U,
+    0x572620AFU, 0x563B48C3U, 0x55555556U, 0x54741FACU, 0x5397829DU, 0x52BF5A82U,
+    0x51EB851FU, 0x511BE196U, 0x50505051U, 0x4F88B2F4U, 0x4EC4EC4FU, 0x4E04E04FU,
+    0x4D4873EDU, 0x4C8F8D29U, 0x4BDA12F7U, 0x4B27ED37U, 0x4A7904A8U, 0x49CD42E3U,
+    0x4924924AU, 0x487EDE05U, 0x47DC11F8U, 0x473C1AB7U, 0x469EE585U, 0x46046047U,
+    0x456C797EU, 0x44D72045U, 0x44444445U, 0x43B3D5B0U, 0x4325C53FU, 0x429A042AU,
+    0x42108422U, 0x4189374CU, 0x41041042U, 0x40810205U
+};
+
+/**
+  @par
+  Logarithms of the inverse reciprocals of logRecipTable_q32, in Q0.32 (unsigned):
+  <pre>
+  for (i = 0; i < 64; i++)
+  {
+  logTable[i] = round(log(pow(2, 31) / logRecipTable[i]) * pow(2, 32));
+  }</pre>
+ */
+const uint32_t logTable_q32[FAST_MATH_LOG_TABLE_SIZE] = {
+    0x00000000U, 0x03F81514U, 0x07E0A6C3U, 0x0BBA2C7BU, 0x0F85185FU, 0x1341D796U,
+    0x16F0D289U, 0x1A926D38U, 0x1E27076EU, 0x21AEFCF7U, 0x252AA5EEU, 0x289A56D9U,
+    0x2BFE60E0U, 0x2F571203U, 0x32A4B538U, 0x35E7929BU, 0x391FEF8EU, 0x3C4E0EDBU,
+    0x3F7230D9U, 0x428C9389U, 0x459D72ADU, 0x48A507EEU, 0x4BA38AEBU, 0x4E993155U,
+    0x51862F07U, 0x546AB61AU, 0x5746F6FBU, 0x5A1B2078U, 0x5CE75FD9U, 0x5FABE0ECU,
+    0x6268CE19U, 0x651E506EU, 0x67CC8FB1U, 0x6A73B269U, 0x6D13DDEEU, 0x6FAD3674U,
+    0x723FDF1EU, 0x74CBF9F7U, 0x7751A811U, 0x79D10986U, 0x7C4A3D7EU, 0x7EBD623BU,
+    0x812A952CU, 0x8391F2E0U, 0x85F39720U, 0x884F9CEEU, 0x8AA61E96U, 0x8CF735A0U,
+    0x8F42FAF1U, 0x918986BCU, 0x93CAF091U, 0x96074F68U, 0x983EB998U, 0x9A7144E9U,
+    0x9C9F069AU, 0x9EC81353U, 0xA0EC7F3FU, 0xA30C5E0FU, 0xA527C2EDU, 0xA73EC08CU,
+    0xA951692FU, 0xAB5FCEADU, 0xAD6A025EU, 0xAF701545U
+};
+
+/**
+  @par
+  Fractional powers of two minus one of the fixed point exponential, in Q0.32 (unsigned):
+  <pre>
+  for (i = 0; i < 64; i++)
+  {
+  expTable[i] = round((pow(2, i / 64.0) - 1) * pow(2, 32));
+  }</pre>
+ */
+const uint32_t expTable_q32[FAST_MATH_LOG_TABLE_SIZE] = {
+    0x00000000U, 0x02C9A3E7U, 0x059B0D31U, 0x08745187U, 0x0B5586D0U, 0x0E3EC32DU,
+    0x11301D01U, 0x1429AAEBU, 0x172B83C8U, 0x1A35BEB7U, 0x1D487317U, 0x2063B886U,
+    0x2387A6E7U, 0x26B4565EU, 0x29E9DF52U, 0x2D285A6EU, 0x306FE0A3U, 0x33C08B26U,
+    0x371A7374U, 0x3A7DB34EU, 0x3DEA64C1U, 0x4160A21FU, 0x44E08606U, 0x486A2B5CU,
+    0x4BFDAD53U, 0x4F9B276AU, 0x5342B56AU, 0x56F4736BU, 0x5AB07DD5U, 0x5E76F15BU,
+    0x6247EB04U, 0x66238825U, 0x6A09E668U, 0x6DFB23C6U, 0x71F75E8FU, 0x75FEB564U,
+    0x7A11473FU, 0x7E2F336DU, 0x82589995U, 0x868D99B4U, 0x8ACE5423U, 0x8F1AE991U,
+    0x93737B0DU, 0x97D829FEU, 0x9C49182AU, 0xA0C667B6U, 0xA5503B24U, 0xA9E6B558U,
+    0xAE89F996U, 0xB33A2B85U, 0xB7F76F30U, 0xBCC1E905U, 0xC199BDD8U, 0xC67F12E5U,
+    0xCB720DCFU, 0xD072D4A0U, 0xD5818DD0U, 0xDA9E603EU, 0xDFC97338U, 0xE502EE79U,
+    0xEA4AFA2AU, 0xEFA1BEE6U, 0xF50765B7U, 0xFA7C181AU
+};
+
 //in vim, use 'gqq' to split a very long line.
 //these values are used to form the triangular mel filterbanks for MFCC.
 //they can be generated by the following python code:
@@ -0,0 +1,272 @@
+/** ==========================================================================
+ * @file     plp_rfft_sR_f32_len1024.c
+ * @brief    Tables and constant instance of the floating-point real FFT of length 1024
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_const_structs.h"
+#include "plp_common_tables.h"
+
+/* generated by rfft_twiddles(1024), see plp_common_tables.c */
+const Complex_type_f32 twiddleCoef_rfft_1024[512] = {
+    {  1.00000000f, -0.00000000f },  {  0.99998118f, -0.00613588f },  {  0.99992470f, -0.01227154f },
+    {  0.99983058f, -0.01840673f },  {  0.99969882f, -0.02454123f },  {  0.99952942f, -0.03067480f },
+    {  0.99932238f, -0.03680722f },  {  0.99907773f, -0.04293826f },  {  0.99879546f, -0.04906767f },
+    {  0.99847558f, -0.05519524f },  {  0.99811811f, -0.06132074f },  {  0.99772307f, -0.06744392f },
+    {  0.99729046f, -0.07356456f },  {  0.99682030f, -0.07968244f },  {  0.99631261f, -0.08579731f },
+    {  0.99576741f, -0.09190896f },  {  0.99518473f, -0.09801714f },  {  0.99456457f, -0.10412163f },
+    {  0.99390697f, -0.11022221f },  {  0.99321195f, -0.11631863f },  {  0.99247953f, -0.12241068f },
+    {  0.99170975f, -0.12849811f },  {  0.99090264f, -0.13458071f },  {  0.99005821f, -0.14065824f },
+    {  0.98917651f, -0.14673047f },  {  0.98825757f, -0.15279719f },  {  0.98730142f, -0.15885814f },
+    {  0.98630810f, -0.16491312f },  {  0.98527764f, -0.17096189f },  {  0.98421009f, -0.17700422f },
+    {  0.98310549f, -0.18303989f },  {  0.98196387f, -0.18906866f },  {  0.98078528f, -0.19509032f },
+    {  0.97956977f, -0.20110463f },  {  0.97831737f, -0.20711138f },  {  0.97702814f, -0.21311032f },
+    {  0.97570213f, -0.21910124f },  {  0.97433938f, -0.22508391f },  {  0.97293995f, -0.23105811f },
+    {  0.97150389f, -0.23702361f },  {  0.97003125f, -0.24298018f },  {  0.96852209f, -0.24892761f },
+    {  0.96697647f, -0.25486566f },  {  0.96539444f, -0.26079412f },  {  0.96377607f, -0.26671276f },
+    {  0.96212140f, -0.27262136f },  {  0.96043052f, -0.27851969f },  {  0.95870347f, -0.28440754f },
+    {  0.95694034f, -0.29028468f },  {  0.95514117f, -0.29615089f },  {  0.95330604f, -0.30200595f },
+    {  0.95143502f, -0.30784964f },  {  0.94952818f, -0.31368174f },  {  0.94758559f, -0.31950203f },
+    {  0.94560733f, -0.32531029f },  {  0.94359346f, -0.33110631f },  {  0.94154407f, -0.33688985f },
+    {  0.93945922f, -0.34266072f },  {  0.93733901f, -0.34841868f },  {  0.93518351f, -0.35416353f },
+    {  0.93299280f, -0.35989504f },  {  0.93076696f, -0.36561300f },  {  0.92850608f, -0.37131719f },
+    {  0.92621024f, -0.37700741f },  {  0.92387953f, -0.38268343f },  {  0.92151404f, -0.38834505f },
+    {  0.91911385f, -0.39399204f },  {  0.91667906f, -0.39962420f },  {  0.91420976f, -0.40524131f },
+    {  0.91170603f, -0.41084317f },  {  0.90916798f, -0.41642956f },  {  0.90659570f, -0.42200027f },
+    {  0.90398929f, -0.42755509f },  {  0.90134885f, -0.43309382f },  {  0.89867447f, -0.43861624f },
+    {  0.89596625f, -0.44412214f },  {  0.89322430f, -0.44961133f },  {  0.89044872f, -0.45508359f },
+    {  0.88763962f, -0.46053871f },  {  0.88479710f, -0.46597650f },  {  0.88192126f, -0.47139674f },
+    {  0.87901223f, -0.47679923f },  {  0.87607009f, -0.48218377f },  {  0.87309498f, -0.48755016f },
+    {  0.87008699f, -0.49289819f },  {  0.86704625f, -0.49822767f },  {  0.86397286f, -0.50353838f },
+    {  0.86086694f, -0.50883014f },  {  0.85772861f, -0.51410274f },  {  0.85455799f, -0.51935599f },
+    {  0.85135519f, -0.52458968f },  {  0.84812034f, -0.52980362f },  {  0.84485357f, -0.53499762f },
+    {  0.84155498f, -0.54017147f },  {  0.83822471f, -0.54532499f },  {  0.83486287f, -0.55045797f },
+    {  0.83146961f, -0.55557023f },  {  0.82804505f, -0.56066158f },  {  0.82458930f, -0.56573181f },
+    {  0.82110251f, -0.57078075f },  {  0.81758481f, -0.57580819f },  {  0.81403633f, -0.58081396f },
+    {  0.81045720f, -0.58579786f },  {  0.80684755f, -0.59075970f },  {  0.80320753f, -0.59569930f },
+    {  0.79953727f, -0.60061648f },  {  0.79583690f, -0.60551104f },  {  0.79210658f, -0.61038281f },
+    {  0.78834643f, -0.61523159f },  {  0.78455660f, -0.62005721f },  {  0.78073723f, -0.62485949f },
+    {  0.77688847f, -0.62963824f },  {  0.77301045f, -0.63439328f },  {  0.76910334f, -0.63912444f },
+    {  0.76516727f, -0.64383154f },  {  0.76120239f, -0.64851440f },  {  0.75720885f, -0.65317284f },
+    {  0.75318680f, -0.65780669f },  {  0.74913639f, -0.66241578f },  {  0.74505779f, -0.66699992f },
+    {  0.74095113f, -0.67155895f },  {  0.73681657f, -0.67609270f },  {  0.73265427f, -0.68060100f },
+    {  0.72846439f, -0.68508367f },  {  0.72424708f, -0.68954054f },  {  0.72000251f, -0.69397146f },
+    {  0.71573083f, -0.69837625f },  {  0.71143220f, -0.70275474f },  {  0.70710678f, -0.70710678f },
+    {  0.70275474f, -0.71143220f },  {  0.69837625f, -0.71573083f },  {  0.69397146f, -0.72000251f },
+    {  0.68954054f, -0.72424708f },  {  0.68508367f, -0.72846439f },  {  0.68060100f, -0.73265427f },
+    {  0.67609270f, -0.73681657f },  {  0.67155895f, -0.74095113f },  {  0.66699992f, -0.74505779f },
+    {  0.66241578f, -0.74913639f },  {  0.65780669f, -0.75318680f },  {  0.65317284f, -0.75720885f },
+    {  0.64851440f, -0.76120239f },  {  0.64383154f, -0.76516727f },  {  0.63912444f, -0.76910334f },
+    {  0.63439328f, -0.77301045f },  {  0.62963824f, -0.77688847f },  {  0.62485949f, -0.78073723f },
+    {  0.62005721f, -0.78455660f },  {  0.61523159f, -0.78834643f },  {  0.61038281f, -0.79210658f },
+    {  0.60551104f, -0.79583690f },  {  0.60061648f, -0.79953727f },  {  0.59569930f, -0.80320753f },
+    {  0.59075970f, -0.80684755f },  {  0.58579786f, -0.81045720f },  {  0.58081396f, -0.81403633f },
+    {  0.57580819f, -0.81758481f },  {  0.57078075f, -0.82110251f },  {  0.56573181f, -0.82458930f },
+    {  0.56066158f, -0.82804505f },  {  0.55557023f, -0.83146961f },  {  0.55045797f, -0.83486287f },
+    {  0.54532499f, -0.83822471f },  {  0.54017147f, -0.84155498f },  {  0.53499762f, -0.84485357f },
+    {  0.52980362f, -0.84812034f },  {  0.52458968f, -0.85135519f },  {  0.51935599f, -0.85455799f },
+    {  0.51410274f, -0.85772861f },  {  0.50883014f, -0.86086694f },  {  0.50353838f, -0.86397286f },
+    {  0.49822767f, -0.86704625f },  {  0.49289819f, -0.87008699f },  {  0.48755016f, -0.87309498f },
+    {  0.48218377f, -0.87607009f },  {  0.47679923f, -0.87901223f },  {  0.47139674f, -0.88192126f },
+    {  0.46597650f, -0.88479710f },  {  0.46053871f, -0.88763962f },  {  0.45508359f, -0.89044872f },
+    {  0.44961133f, -0.89322430f },  {  0.44412214f, -0.89596625f },  {  0.43861624f, -0.89867447f },
+    {  0.43309382f, -0.90134885f },  {  0.42755509f, -0.90398929f },  {  0.42200027f, -0.90659570f },
+    {  0.41642956f, -0.90916798f },  {  0.41084317f, -0.91170603f },  {  0.40524131f, -0.91420976f },
+    {  0.39962420f, -0.91667906f },  {  0.39399204f, -0.91911385f },  {  0.38834505f, -0.92151404f },
+    {  0.38268343f, -0.92387953f },  {  0.37700741f, -0.92621024f },  {  0.37131719f, -0.92850608f },
+    {  0.36561300f, -0.93076696f },  {  0.35989504f, -0.93299280f },  {  0.35416353f, -0.93518351f },
+    {  0.34841868f, -0.93733901f },  {  0.34266072f, -0.93945922f },  {  0.33688985f, -0.94154407f },
+    {  0.33110631f, -0.94359346f },  {  0.32531029f, -0.94560733f },  {  0.31950203f, -0.94758559f },
+    {  0.31368174f, -0.94952818f },  {  0.30784964f, -0.95143502f },  {  0.30200595f, -0.95330604f },
+    {  0.29615089f, -0.95514117f },  {  0.29028468f, -0.95694034f },  {  0.28440754f, -0.95870347f },
+    {  0.27851969f, -0.96043052f },  {  0.27262136f, -0.96212140f },  {  0.26671276f, -0.96377607f },
+    {  0.26079412f, -0.96539444f },  {  0.25486566f, -0.96697647f },  {  0.24892761f, -0.96852209f },
+    {  0.24298018f, -0.97003125f },  {  0.23702361f, -0.97150389f },  {  0.23105811f, -0.97293995f },
+    {  0.22508391f, -0.97433938f },  {  0.21910124f, -0.97570213f },  {  0.21311032f, -0.97702814f },
+    {  0.20711138f, -0.97831737f },  {  0.20110463f, -0.97956977f },  {  0.19509032f, -0.98078528f },
+    {  0.18906866f, -0.98196387f },  {  0.18303989f, -0.98310549f },  {  0.17700422f, -0.98421009f },
+    {  0.17096189f, -0.98527764f },  {  0.16491312f, -0.98630810f },  {  0.15885814f, -0.98730142f },
+    {  0.15279719f, -0.98825757f },  {  0.14673047f, -0.98917651f },  {  0.14065824f, -0.99005821f },
+    {  0.13458071f, -0.99090264f },  {  0.12849811f, -0.99170975f },  {  0.12241068f, -0.99247953f },
+    {  0.11631863f, -0.99321195f },  {  0.11022221f, -0.99390697f },  {  0.10412163f, -0.99456457f },
+    {  0.09801714f, -0.99518473f },  {  0.09190896f, -0.99576741f },  {  0.08579731f, -0.99631261f },
+    {  0.07968244f, -0.99682030f },  {  0.07356456f, -0.99729046f },  {  0.06744392f, -0.99772307f },
+    {  0.06132074f, -0.99811811f },  {  0.05519524f, -0.99847558f },  {  0.04906767f, -0.99879546f },
+    {  0.04293826f, -0.99907773f },  {  0.03680722f, -0.99932238f },  {  0.03067480f, -0.99952942f },
+    {  0.02454123f, -0.99969882f },  {  0.01840673f, -0.99983058f },  {  0.01227154f, -0.99992470f },
+    {  0.00613588f, -0.99998118f },  {  0.00000000f, -1.00000000f },  { -0.00613588f, -0.99998118f },
+    { -0.01227154f, -0.99992470f },  { -0.01840673f, -0.99983058f },  { -0.02454123f, -0.99969882f },
+    { -0.03067480f, -0.99952942f },  { -0.03680722f, -0.99932238f },  { -0.04293826f, -0.99907773f },
+    { -0.04906767f, -0.99879546f },  { -0.05519524f, -0.99847558f },  { -0.06132074f, -0.99811811f },
+    { -0.06744392f, -0.99772307f },  { -0.07356456f, -0.99729046f },  { -0.07968244f, -0.99682030f },
+    { -0.08579731f, -0.99631261f },  { -0.09190896f, -0.99576741f },  { -0.09801714f, -0.99518473f },
+    { -0.10412163f, -0.99456457f },  { -0.11022221f, -0.99390697f },  { -0.11631863f, -0.99321195f },
+    { -0.12241068f, -0.99247953f },  { -0.12849811f, -0.99170975f },  { -0.13458071f, -0.99090264f },
+    { -0.14065824f, -0.99005821f },  { -0.14673047f, -0.98917651f },  { -0.15279719f, -0.98825757f },
+    { -0.15885814f, -0.98730142f },  { -0.16491312f, -0.98630810f },  { -0.17096189f, -0.98527764f },
+    { -0.17700422f, -0.98421009f },  { -0.18303989f, -0.98310549f },  { -0.18906866f, -0.98196387f },
+    { -0.19509032f, -0.98078528f },  { -0.20110463f, -0.97956977f },  { -0.20711138f, -0.97831737f },
+    { -0.21311032f, -0.97702814f },  { -0.21910124f, -0.97570213f },  { -0.22508391f, -0.97433938f },
+    { -0.23105811f, -0.97293995f },  { -0.23702361f, -0.97150389f },  { -0.24298018f, -0.97003125f },
+    { -0.24892761f, -0.96852209f },  { -0.25486566f, -0.96697647f },  { -0.26079412f, -0.96539444f },
+    { -0.26671276f, -0.96377607f },  { -0.27262136f, -0.96212140f },  { -0.27851969f, -0.96043052f },
+    { -0.28440754f, -0.95870347f },  { -0.29028468f, -0.95694034f },  { -0.29615089f, -0.95514117f },
+    { -0.30200595f, -0.95330604f },  { -0.30784964f, -0.95143502f },  { -0.31368174f, -0.94952818f },
+    { -0.31950203f, -0.94758559f },  { -0.32531029f, -0.94560733f },  { -0.33110631f, -0.94359346f },
+    { -0.33688985f, -0.94154407f },  { -0.34266072f, -0.93945922f },  { -0.34841868f, -0.93733901f },
+    { -0.35416353f, -0.93518351f },  { -0.35989504f, -0.93299280f },  { -0.36561300f, -0.93076696f },
+    { -0.37131719f, -0.92850608f },  { -0.37700741f, -0.92621024f },  { -0.38268343f, -0.92387953f },
+    { -0.38834505f, -0.92151404f },  { -0.39399204f, -0.91911385f },  { -0.39962420f, -0.91667906f },
+    { -0.40524131f, -0.91420976f },  { -0.41084317f, -0.91170603f },  { -0.41642956f, -0.90916798f },
+    { -0.42200027f, -0.90659570f },  { -0.42755509f, -0.90398929f },  { -0.43309382f, -0.90134885f },
+    { -0.43861624f, -0.89867447f },  { -0.44412214f, -0.89596625f },  { -0.44961133f, -0.89322430f },
+    { -0.45508359f, -0.89044872f },  { -0.46053871f, -0.88763962f },  { -0.46597650f, -0.88479710f },
+    { -0.47139674f, -0.88192126f },  { -0.47679923f, -0.87901223f },  { -0.48218377f, -0.87607009f },
+    { -0.48755016f, -0.87309498f },  { -0.49289819f, -0.87008699f },  { -0.49822767f, -0.86704625f },
+    { -0.50353838f, -0.86397286f },  { -0.50883014f, -0.86086694f },  { -0.51410274f, -0.85772861f },
+    { -0.51935599f, -0.85455799f },  { -0.52458968f, -0.85135519f },  { -0.52980362f, -0.84812034f },
+    { -0.53499762f, -0.84485357f },  { -0.54017147f, -0.84155498f },  { -0.54532499f, -0.83822471f },
+    { -0.55045797f, -0.83486287f },  { -0.55557023f, -0.83146961f },  { -0.56066158f, -0.82804505f },
+    { -0.56573181f, -0.82458930f },  { -0.57078075f, -0.82110251f },  { -0.57580819f, -0.81758481f },
+    { -0.58081396f, -0.81403633f },  { -0.58579786f, -0.81045720f },  { -0.59075970f, -0.80684755f },
+    { -0.59569930f, -0.80320753f },  { -0.60061648f, -0.79953727f },  { -0.60551104f, -0.79583690f },
+    { -0.61038281f, -0.79210658f },  { -0.61523159f, -0.78834643f },  { -0.62005721f, -0.78455660f },
+    { -0.62485949f, -0.78073723f },  { -0.62963824f, -0.77688847f },  { -0.63439328f, -0.77301045f },
+    { -0.63912444f, -0.76910334f },  { -0.64383154f, -0.76516727f },  { -0.64851440f, -0.76120239f },
+    { -0.65317284f, -0.75720885f },  { -0.65780669f, -0.75318680f },  { -0.66241578f, -0.74913639f },
+    { -0.66699992f, -0.74505779f },  { -0.67155895f, -0.74095113f },  { -0.67609270f, -0.73681657f },
+    { -0.68060100f, -0.73265427f },  { -0.68508367f, -0.72846439f },  { -0.68954054f, -0.72424708f },
+    { -0.69397146f, -0.72000251f },  { -0.69837625f, -0.71573083f },  { -0.70275474f, -0.71143220f },
+    { -0.70710678f, -0.70710678f },  { -0.71143220f, -0.70275474f },  { -0.71573083f, -0.69837625f },
+    { -0.72000251f, -0.69397146f },  { -0.72424708f, -0.68954054f },  { -0.72846439f, -0.68508367f },
+    { -0.73265427f, -0.68060100f },  { -0.73681657f, -0.67609270f },  { -0.74095113f, -0.67155895f },
+    { -0.74505779f, -0.66699992f },  { -0.74913639f, -0.66241578f },  { -0.75318680f, -0.65780669f },
+    { -0.75720885f, -0.65317284f },  { -0.76120239f, -0.64851440f },  { -0.76516727f, -0.64383154f },
+    { -0.76910334f, -0.63912444f },  { -0.77301045f, -0.63439328f },  { -0.77688847f, -0.62963824f },
+    { -0.78073723f, -0.62485949f },  { -0.78455660f, -0.62005721f },  { -0.78834643f, -0.61523159f },
+    { -0.79210658f, -0.61038281f },  { -0.79583690f, -0.60551104f },  { -0.79953727f, -0.60061648f },
+    { -0.80320753f, -0.59569930f },  { -0.80684755f, -0.59075970f },  { -0.81045720f, -0.58579786f },
+    { -0.81403633f, -0.58081396f },  { -0.81758481f, -0.57580819f },  { -0.82110251f, -0.57078075f },
+    { -0.82458930f, -0.56573181f },  { -0.82804505f, -0.56066158f },  { -0.83146961f, -0.55557023f },
+    { -0.83486287f, -0.55045797f },  { -0.83822471f, -0.54532499f },  { -0.84155498f, -0.54017147f },
+    { -0.84485357f, -0.53499762f },  { -0.84812034f, -0.52980362f },  { -0.85135519f, -0.52458968f },
+    { -0.85455799f, -0.51935599f },  { -0.85772861f, -0.51410274f },  { -0.86086694f, -0.50883014f },
+    { -0.86397286f, -0.50353838f },  { -0.86704625f, -0.49822767f },  { -0.87008699f, -0.49289819f },
+    { -0.87309498f, -0.48755016f },  { -0.87607009f, -0.48218377f },  { -0.87901223f, -0.47679923f },
+    { -0.88192126f, -0.47139674f },  { -0.88479710f, -0.46597650f },  { -0.88763962f, -0.46053871f },
+    { -0.89044872f, -0.45508359f },  { -0.89322430f, -0.44961133f },  { -0.89596625f, -0.44412214f },
+    { -0.89867447f, -0.43861624f },  { -0.90134885f, -0.43309382f },  { -0.90398929f, -0.42755509f },
+    { -0.90659570f, -0.42200027f },  { -0.90916798f, -0.41642956f },  { -0.91170603f, -0.41084317f },
+    { -0.91420976f, -0.40524131f },  { -0.91667906f, -0.39962420f },  { -0.91911385f, -0.39399204f },
+    { -0.92151404f, -0.38834505f },  { -0.92387953f, -0.38268343f },  { -0.92621024f, -0.37700741f },
+    { -0.92850608f, -0.37131719f },  { -0.93076696f, -0.36561300f },  { -0.93299280f, -0.35989504f },
+    { -0.93518351f, -0.35416353f },  { -0.93733901f, -0.34841868f },  { -0.93945922f, -0.34266072f },
+    { -0.94154407f, -0.33688985f },  { -0.94359346f, -0.33110631f },  { -0.94560733f, -0.32531029f },
+    { -0.94758559f, -0.31950203f },  { -0.94952818f, -0.31368174f },  { -0.95143502f, -0.30784964f },
+    { -0.95330604f, -0.30200595f },  { -0.95514117f, -0.29615089f },  { -0.95694034f, -0.29028468f },
+    { -0.95870347f, -0.28440754f },  { -0.96043052f, -0.27851969f },  { -0.96212140f, -0.27262136f },
+    { -0.96377607f, -0.26671276f },  { -0.96539444f, -0.26079412f },  { -0.96697647f, -0.25486566f },
+    { -0.96852209f, -0.24892761f },  { -0.97003125f, -0.24298018f },  { -0.97150389f, -0.23702361f },
+    { -0.97293995f, -0.23105811f },  { -0.97433938f, -0.22508391f },  { -0.97570213f, -0.21910124f },
+    { -0.97702814f, -0.21311032f },  { -0.97831737f, -0.20711138f },  { -0.97956977f, -0.20110463f },
+    { -0.98078528f, -0.19509032f },  { -0.98196387f, -0.18906866f },  { -0.98310549f, -0.18303989f },
+    { -0.98421009f, -0.17700422f },  { -0.98527764f, -0.17096189f },  { -0.98630810f, -0.16491312f },
+    { -0.98730142f, -0.15885814f },  { -0.98825757f, -0.15279719f },  { -0.98917651f, -0.14673047f },
+    { -0.99005821f, -0.14065824f },  { -0.99090264f, -0.13458071f },  { -0.99170975f, -0.12849811f },
+    { -0.99247953f, -0.12241068f },  { -0.99321195f, -0.11631863f },  { -0.99390697f, -0.11022221f },
+    { -0.99456457f, -0.10412163f },  { -0.99518473f, -0.09801714f },  { -0.99576741f, -0.09190896f },
+    { -0.99631261f, -0.08579731f },  { -0.99682030f, -0.07968244f },  { -0.99729046f, -0.07356456f },
+    { -0.99772307f, -0.06744392f },  { -0.99811811f, -0.06132074f },  { -0.99847558f, -0.05519524f },
+    { -0.99879546f, -0.04906767f },  { -0.99907773f, -0.04293826f },  { -0.99932238f, -0.03680722f },
+    { -0.99952942f, -0.03067480f },  { -0.99969882f, -0.02454123f },  { -0.99983058f, -0.01840673f },
+    { -0.99992470f, -0.01227154f },  { -0.99998118f, -0.00613588f }
+};
+
+/* generated by rfft_bit_rev(1024), see plp_common_tables.c */
+short bit_rev_radix2_LUT_1024[1024] = {
+0, 512, 256, 768, 128, 640, 384, 896, 64, 576, 320, 832, 192, 704, 448, 960, 32,
+544, 288, 800, 160, 672, 416, 928, 96, 608, 352, 864, 224, 736, 480, 992, 16,
+528, 272, 784, 144, 656, 400, 912, 80, 592, 336, 848, 208, 720, 464, 976, 48,
+560, 304, 816, 176, 688, 432, 944, 112, 624, 368, 880, 240, 752, 496, 1008, 8,
+520, 264, 776, 136, 648, 392, 904, 72, 584, 328, 840, 200, 712, 456, 968, 40,
+552, 296, 808, 168, 680, 424, 936, 104, 616, 360, 872, 232, 744, 488, 1000, 24,
+536, 280, 792, 152, 664, 408, 920, 88, 600, 344, 856, 216, 728, 472, 984, 56,
+568, 312, 824, 184, 696, 440, 952, 120, 632, 376, 888, 248, 760, 504, 1016, 4,
+516, 260, 772, 132, 644, 388, 900, 68, 580, 324, 836, 196, 708, 452, 964, 36,
+548, 292, 804, 164, 676, 420, 932, 100, 612, 356, 868, 228, 740, 484, 996, 20,
+532, 276, 788, 148, 660, 404, 916, 84, 596, 340, 852, 212, 724, 468, 980, 52,
+564, 308, 820, 180, 692, 436, 948, 116, 628, 372, 884, 244, 756, 500, 1012, 12,
+524, 268, 780, 140, 652, 396, 908, 76, 588, 332, 844, 204, 716, 460, 972, 44,
+556, 300, 812, 172, 684, 428, 940, 108, 620, 364, 876, 236, 748, 492, 1004, 28,
+540, 284, 796, 156, 668, 412, 924, 92, 604, 348, 860, 220, 732, 476, 988, 60,
+572, 316, 828, 188, 700, 444, 956, 124, 636, 380, 892, 252, 764, 508, 1020, 2,
+514, 258, 770, 130, 642, 386, 898, 66, 578, 322, 834, 194, 706, 450, 962, 34,
+546, 290, 802, 162, 674, 418, 930, 98, 610, 354, 866, 226, 738, 482, 994, 18,
+530, 274, 786, 146, 658, 402, 914, 82, 594, 338, 850, 210, 722, 466, 978, 50,
+562, 306, 818, 178, 690, 434, 946, 114, 626, 370, 882, 242, 754, 498, 1010, 10,
+522, 266, 778, 138, 650, 394, 906, 74, 586, 330, 842, 202, 714, 458, 970, 42,
+554, 298, 810, 170, 682, 426, 938, 106, 618, 362, 874, 234, 746, 490, 1002, 26,
+538, 282, 794, 154, 666, 410, 922, 90, 602, 346, 858, 218, 730, 474, 986, 58,
+570, 314, 826, 186, 698, 442, 954, 122, 634, 378, 890, 250, 762, 506, 1018, 6,
+518, 262, 774, 134, 646, 390, 902, 70, 582, 326, 838, 198, 710, 454, 966, 38,
+550, 294, 806, 166, 678, 422, 934, 102, 614, 358, 870, 230, 742, 486, 998, 22,
+534, 278, 790, 150, 662, 406, 918, 86, 598, 342, 854, 214, 726, 470, 982, 54,
+566, 310, 822, 182, 694, 438, 950, 118, 630, 374, 886, 246, 758, 502, 1014, 14,
+526, 270, 782, 142, 654, 398, 910, 78, 590, 334, 846, 206, 718, 462, 974, 46,
+558, 302, 814, 174, 686, 430, 942, 110, 622, 366, 878, 238, 750, 494, 1006, 30,
+542, 286, 798, 158, 670, 414, 926, 94, 606, 350, 862, 222, 734, 478, 990, 62,
+574, 318, 830, 190, 702, 446, 958, 126, 638, 382, 894, 254, 766, 510, 1022, 1,
+513, 257, 769, 129, 641, 385, 897, 65, 577, 321, 833, 193, 705, 449, 961, 33,
+545, 289, 801, 161, 673, 417, 929, 97, 609, 353, 865, 225, 737, 481, 993, 17,
+529, 273, 785, 145, 657, 401, 913, 81, 593, 337, 849, 209, 721, 465, 977, 49,
+561, 305, 817, 177, 689, 433, 945, 113, 625, 369, 881, 241, 753, 497, 1009, 9,
+521, 265, 777, 137, 649, 393, 905, 73, 585, 329, 841, 201, 713, 457, 969, 41,
+553, 297, 809, 169, 681, 425, 937, 105, 617, 361, 873, 233, 745, 489, 1001, 25,
+537, 281, 793, 153, 665, 409, 921, 89, 601, 345, 857, 217, 729, 473, 985, 57,
+569, 313, 825, 185, 697, 441, 953, 121, 633, 377, 889, 249, 761, 505, 1017, 5,
+517, 261, 773, 133, 645, 389, 901, 69, 581, 325, 837, 197, 709, 453, 965, 37,
+549, 293, 805, 165, 677, 421, 933, 101, 613, 357, 869, 229, 741, 485, 997, 21,
+533, 277, 789, 149, 661, 405, 917, 85, 597, 341, 853, 213, 725, 469, 981, 53,
+565, 309, 821, 181, 693, 437, 949, 117, 629, 373, 885, 245, 757, 501, 1013, 13,
+525, 269, 781, 141, 653, 397, 909, 77, 589, 333, 845, 205, 717, 461, 973, 45,
+557, 301, 813, 173, 685, 429, 941, 109, 621, 365, 877, 237, 749, 493, 1005, 29,
+541, 285, 797, 157, 669, 413, 925, 93, 605, 349, 861, 221, 733, 477, 989, 61,
+573, 317, 829, 189, 701, 445, 957, 125, 637, 381, 893, 253, 765, 509, 1021, 3,
+515, 259, 771, 131, 643, 387, 899, 67, 579, 323, 835, 195, 707, 451, 963, 35,
+547, 291, 803, 163, 675, 419, 931, 99, 611, 355, 867, 227, 739, 483, 995, 19,
+531, 275, 787, 147, 659, 403, 915, 83, 595, 339, 851, 211, 723, 467, 979, 51,
+563, 307, 819, 179, 691, 435, 947, 115, 627, 371, 883, 243, 755, 499, 1011, 11,
+523, 267, 779, 139, 651, 395, 907, 75, 587, 331, 843, 203, 715, 459, 971, 43,
+555, 299, 811, 171, 683, 427, 939, 107, 619, 363, 875, 235, 747, 491, 1003, 27,
+539, 283, 795, 155, 667, 411, 923, 91, 603, 347, 859, 219, 731, 475, 987, 59,
+571, 315, 827, 187, 699, 443, 955, 123, 635, 379, 891, 251, 763, 507, 1019, 7,
+519, 263, 775, 135, 647, 391, 903, 71, 583, 327, 839, 199, 711, 455, 967, 39,
+551, 295, 807, 167, 679, 423, 935, 103, 615, 359, 871, 231, 743, 487, 999, 23,
+535, 279, 791, 151, 663, 407, 919, 87, 599, 343, 855, 215, 727, 471, 983, 55,
+567, 311, 823, 183, 695, 439, 951, 119, 631, 375, 887, 247, 759, 503, 1015, 15,
+527, 271, 783, 143, 655, 399, 911, 79, 591, 335, 847, 207, 719, 463, 975, 47,
+559, 303, 815, 175, 687, 431, 943, 111, 623, 367, 879, 239, 751, 495, 1007, 31,
+543, 287, 799, 159, 671, 415, 927, 95, 607, 351, 863, 223, 735, 479, 991, 63,
+575, 319, 831, 191, 703, 447, 959, 127, 639, 383, 895, 255, 767, 511, 1023
+};
+
+const plp_fft_instance_f32 plp_rfft_sR_f32_len1024 = { 1024, 1, (float32_t *)twiddleCoef_rfft_1024,
+                                                       (uint16_t *)bit_rev_radix2_LUT_1024 };
@@ -0,0 +1,66 @@
+/** ==========================================================================
+ * @file     plp_rfft_sR_f32_len128.c
+ * @brief    Tables and constant instance of the floating-point real FFT of length 128
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_const_structs.h"
+#include "plp_common_tables.h"
+
+/* generated by rfft_twiddles(128), see plp_common_tables.c */
+const Complex_type_f32 twiddleCoef_rfft_128[64] = {
+    {  1.00000000f, -0.00000000f },  {  0.99879546f, -0.04906767f },  {  0.99518473f, -0.09801714f },
+    {  0.98917651f, -0.14673047f },  {  0.98078528f, -0.19509032f },  {  0.97003125f, -0.24298018f },
+    {  0.95694034f, -0.29028468f },  {  0.94154407f, -0.33688985f },  {  0.92387953f, -0.38268343f },
+    {  0.90398929f, -0.42755509f },  {  0.88192126f, -0.47139674f },  {  0.85772861f, -0.51410274f },
+    {  0.83146961f, -0.55557023f },  {  0.80320753f, -0.59569930f },  {  0.77301045f, -0.63439328f },
+    {  0.74095113f, -0.67155895f },  {  0.70710678f, -0.70710678f },  {  0.67155895f, -0.74095113f },
+    {  0.63439328f, -0.77301045f },  {  0.59569930f, -0.80320753f },  {  0.55557023f, -0.83146961f },
+    {  0.51410274f, -0.85772861f },  {  0.47139674f, -0.88192126f },  {  0.42755509f, -0.90398929f },
+    {  0.38268343f, -0.92387953f },  {  0.33688985f, -0.94154407f },  {  0.29028468f, -0.95694034f },
+    {  0.24298018f, -0.97003125f },  {  0.19509032f, -0.98078528f },  {  0.14673047f, -0.98917651f },
+    {  0.09801714f, -0.99518473f },  {  0.04906767f, -0.99879546f },  {  0.00000000f, -1.00000000f },
+    { -0.04906767f, -0.99879546f },  { -0.09801714f, -0.99518473f },  { -0.14673047f, -0.98917651f },
+    { -0.19509032f, -0.98078528f },  { -0.24298018f, -0.97003125f },  { -0.29028468f, -0.95694034f },
+    { -0.33688985f, -0.94154407f },  { -0.38268343f, -0.92387953f },  { -0.42755509f, -0.90398929f },
+    { -0.47139674f, -0.88192126f },  { -0.51410274f, -0.85772861f },  { -0.55557023f, -0.83146961f },
+    { -0.59569930f, -0.80320753f },  { -0.63439328f, -0.77301045f },  { -0.67155895f, -0.74095113f },
+    { -0.70710678f, -0.70710678f },  { -0.74095113f, -0.67155895f },  { -0.77301045f, -0.63439328f },
+    { -0.80320753f, -0.59569930f },  { -0.83146961f, -0.55557023f },  { -0.85772861f, -0.51410274f },
+    { -0.88192126f, -0.47139674f },  { -0.90398929f, -0.42755509f },  { -0.92387953f, -0.38268343f },
+    { -0.94154407f, -0.33688985f },  { -0.95694034f, -0.29028468f },  { -0.97003125f, -0.24298018f },
+    { -0.98078528f, -0.19509032f },  { -0.98917651f, -0.14673047f },  { -0.99518473f, -0.09801714f },
+    { -0.99879546f, -0.04906767f }
+};
+
+/* generated by rfft_bit_rev(128), see plp_common_tables.c */
+short bit_rev_radix2_LUT_128[128] = {
+0, 64, 32, 96, 16, 80, 48, 112, 8, 72, 40, 104, 24, 88, 56, 120, 4, 68, 36, 100,
+20, 84, 52, 116, 12, 76, 44, 108, 28, 92, 60, 124, 2, 66, 34, 98, 18, 82, 50,
+114, 10, 74, 42, 106, 26, 90, 58, 122, 6, 70, 38, 102, 22, 86, 54, 118, 14, 78,
+46, 110, 30, 94, 62, 126, 1, 65, 33, 97, 17, 81, 49, 113, 9, 73, 41, 105, 25,
+89, 57, 121, 5, 69, 37, 101, 21, 85, 53, 117, 13, 77, 45, 109, 29, 93, 61, 125,
+3, 67, 35, 99, 19, 83, 51, 115, 11, 75, 43, 107, 27, 91, 59, 123, 7, 71, 39,
+103, 23, 87, 55, 119, 15, 79, 47, 111, 31, 95, 63, 127
+};
+
+const plp_fft_instance_f32 plp_rfft_sR_f32_len128 = { 128, 1, (float32_t *)twiddleCoef_rfft_128,
+                                                      (uint16_t *)bit_rev_radix2_LUT_128 };
@@ -0,0 +1,41 @@
+/** ==========================================================================
+ * @file     plp_rfft_sR_f32_len16.c
+ * @brief    Tables and constant instance of the floating-point real FFT of length 16
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_const_structs.h"
+#include "plp_common_tables.h"
+
+/* generated by rfft_twiddles(16), see plp_common_tables.c */
+const Complex_type_f32 twiddleCoef_rfft_16[8] = {
+    {  1.00000000f, -0.00000000f },  {  0.92387953f, -0.38268343f },  {  0.70710678f, -0.70710678f },
+    {  0.38268343f, -0.92387953f },  {  0.00000000f, -1.00000000f },  { -0.38268343f, -0.92387953f },
+    { -0.70710678f, -0.70710678f },  { -0.92387953f, -0.38268343f }
+};
+
+/* generated by rfft_bit_rev(16), see plp_common_tables.c */
+short bit_rev_radix2_LUT_16[16] = {
+0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15
+};
+
+const plp_fft_instance_f32 plp_rfft_sR_f32_len16 = { 16, 1, (float32_t *)twiddleCoef_rfft_16,
+                                                     (uint16_t *)bit_rev_radix2_LUT_16 };
@@ -0,0 +1,525 @@
+/** ==========================================================================
+ * @file     plp_rfft_sR_f32_len2048.c
+ * @brief    Tables and constant instance of the floating-point real FFT of length 2048
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_const_structs.h"
+#include "plp_common_tables.h"
+
+/* generated by rfft_twiddles(2048), see plp_common_tables.c */
+const Complex_type_f32 twiddleCoef_rfft_2048[1024] = {
+    {  1.00000000f, -0.00000000f },  {  0.99999529f, -0.00306796f },  {  0.99998118f, -0.00613588f },
+    {  0.99995764f, -0.00920375f },  {  0.99992470f, -0.01227154f },  {  0.99988235f, -0.01533921f },
+    {  0.99983058f, -0.01840673f },  {  0.99976941f, -0.02147408f },  {  0.99969882f, -0.02454123f },
+    {  0.99961882f, -0.02760815f },  {  0.99952942f, -0.03067480f },  {  0.99943060f, -0.03374117f },
+    {  0.99932238f, -0.03680722f },  {  0.99920476f, -0.03987293f },  {  0.99907773f, -0.04293826f },
+    {  0.99894129f, -0.04600318f },  {  0.99879546f, -0.04906767f },  {  0.99864022f, -0.05213170f },
+    {  0.99847558f, -0.05519524f },  {  0.99830154f, -0.05825826f },  {  0.99811811f, -0.06132074f },
+    {  0.99792529f, -0.06438263f },  {  0.99772307f, -0.06744392f },  {  0.99751146f, -0.07050457f },
+    {  0.99729046f, -0.07356456f },  {  0.99706007f, -0.07662386f },  {  0.99682030f, -0.07968244f },
+    {  0.99657115f, -0.08274026f },  {  0.99631261f, -0.08579731f },  {  0.99604470f, -0.08885355f },
+    {  0.99576741f, -0.09190896f },  {  0.99548076f, -0.09496350f },  {  0.99518473f, -0.09801714f },
+    {  0.99487933f, -0.10106986f },  {  0.99456457f, -0.10412163f },  {  0.99424045f, -0.10717242f },
+    {  0.99390697f, -0.11022221f },  {  0.99356414f, -0.11327095f },  {  0.99321195f, -0.11631863f },
+    {  0.99285041f, -0.11936521f },  {  0.99247953f, -0.12241068f },  {  0.99209931f, -0.12545498f },
+    {  0.99170975f, -0.12849811f },  {  0.99131086f, -0.13154003f },  {  0.99090264f, -0.13458071f },
+    {  0.99048508f, -0.13762012f },  {  0.99005821f, -0.14065824f },  {  0.98962202f, -0.14369503f },
+    {  0.98917651f, -0.14673047f },  {  0.98872169f, -0.14976453f },  {  0.98825757f, -0.15279719f },
+    {  0.98778414f, -0.15582840f },  {  0.98730142f, -0.15885814f },  {  0.98680940f, -0.16188639f },
+    {  0.98630810f, -0.16491312f },  {  0.98579751f, -0.16793829f },  {  0.98527764f, -0.17096189f },
+    {  0.98474850f, -0.17398387f },  {  0.98421009f, -0.17700422f },  {  0.98366242f, -0.18002290f },
+    {  0.98310549f, -0.18303989f },  {  0.98253930f, -0.18605515f },  {  0.98196387f, -0.18906866f },
+    {  0.98137919f, -0.19208040f },  {  0.98078528f, -0.19509032f },  {  0.98018214f, -0.19809841f },
+    {  0.97956977f, -0.20110463f },  {  0.97894818f, -0.20410897f },  {  0.97831737f, -0.20711138f },
+    {  0.97767736f, -0.21011184f },  {  0.97702814f, -0.21311032f },  {  0.97636973f, -0.21610680f },
+    {  0.97570213f, -0.21910124f },  {  0.97502535f, -0.22209362f },  {  0.97433938f, -0.22508391f },
+    {  0.97364425f, -0.22807208f },  {  0.97293995f, -0.23105811f },  {  0.97222650f, -0.23404196f },
+    {  0.97150389f, -0.23702361f },  {  0.97077214f, -0.24000302f },  {  0.97003125f, -0.24298018f },
+    {  0.96928124f, -0.24595505f },  {  0.96852209f, -0.24892761f },  {  0.96775384f, -0.25189782f },
+    {  0.96697647f, -0.25486566f },  {  0.96619000f, -0.25783110f },  {  0.96539444f, -0.26079412f },
+    {  0.96458979f, -0.26375468f },  {  0.96377607f, -0.26671276f },  {  0.96295327f, -0.26966833f },
+    {  0.96212140f, -0.27262136f },  {  0.96128049f, -0.27557182f },  {  0.96043052f, -0.27851969f },
+    {  0.95957151f, -0.28146494f },  {  0.95870347f, -0.28440754f },  {  0.95782641f, -0.28734746f },
+    {  0.95694034f, -0.29028468f },  {  0.95604525f, -0.29321916f },  {  0.95514117f, -0.29615089f },
+    {  0.95422810f, -0.29907983f },  {  0.95330604f, -0.30200595f },  {  0.95237501f, -0.30492923f },
+    {  0.95143502f, -0.30784964f },  {  0.95048607f, -0.31076715f },  {  0.94952818f, -0.31368174f },
+    {  0.94856135f, -0.31659338f },  {  0.94758559f, -0.31950203f },  {  0.94660091f, -0.32240768f },
+    {  0.94560733f, -0.32531029f },  {  0.94460484f, -0.32820984f },  {  0.94359346f, -0.33110631f },
+    {  0.94257320f, -0.33399965f },  {  0.94154407f, -0.33688985f },  {  0.94050607f, -0.33977688f },
+    {  0.93945922f, -0.34266072f },  {  0.93840353f, -0.34554132f },  {  0.93733901f, -0.34841868f },
+    {  0.93626567f, -0.35129276f },  {  0.93518351f, -0.35416353f },  {  0.93409255f, -0.35703096f },
+    {  0.93299280f, -0.35989504f },  {  0.93188427f, -0.36275572f },  {  0.93076696f, -0.36561300f },
+    {  0.92964090f, -0.36846683f },  {  0.92850608f, -0.37131719f },  {  0.92736253f, -0.37416406f },
+    {  0.92621024f, -0.37700741f },  {  0.92504924f, -0.37984721f },  {  0.92387953f, -0.38268343f },
+    {  0.92270113f, -0.38551605f },  {  0.92151404f, -0.38834505f },  {  0.92031828f, -0.39117038f },
+    {  0.91911385f, -0.39399204f },  {  0.91790078f, -0.39680999f },  {  0.91667906f, -0.39962420f },
+    {  0.91544872f, -0.40243465f },  {  0.91420976f, -0.40524131f },  {  0.91296219f, -0.40804416f },
+    {  0.91170603f, -0.41084317f },  {  0.91044129f, -0.41363831f },  {  0.90916798f, -0.41642956f },
+    {  0.90788612f, -0.41921689f },  {  0.90659570f, -0.42200027f },  {  0.90529676f, -0.42477968f },
+    {  0.90398929f, -0.42755509f },  {  0.90267332f, -0.43032648f },  {  0.90134885f, -0.43309382f },
+    {  0.90001589f, -0.43585708f },  {  0.89867447f, -0.43861624f },  {  0.89732458f, -0.44137127f },
+    {  0.89596625f, -0.44412214f },  {  0.89459949f, -0.44686884f },  {  0.89322430f, -0.44961133f },
+    {  0.89184071f, -0.45234959f },  {  0.89044872f, -0.45508359f },  {  0.88904836f, -0.45781330f },
+    {  0.88763962f, -0.46053871f },  {  0.88622253f, -0.46325978f },  {  0.88479710f, -0.46597650f },
+    {  0.88336334f, -0.46868882f },  {  0.88192126f, -0.47139674f },  {  0.88047089f, -0.47410021f },
+    {  0.87901223f, -0.47679923f },  {  0.87754529f, -0.47949376f },  {  0.87607009f, -0.48218377f },
+    {  0.87458665f, -0.48486925f },  {  0.87309498f, -0.48755016f },  {  0.87159509f, -0.49022648f },
+    {  0.87008699f, -0.49289819f },  {  0.86857071f, -0.49556526f },  {  0.86704625f, -0.49822767f },
+    {  0.86551362f, -0.50088538f },  {  0.86397286f, -0.50353838f },  {  0.86242396f, -0.50618665f },
+    {  0.86086694f, -0.50883014f },  {  0.85930182f, -0.51146885f },  {  0.85772861f, -0.51410274f },
+    {  0.85614733f, -0.51673180f },  {  0.85455799f, -0.51935599f },  {  0.85296060f, -0.52197529f },
+    {  0.85135519f, -0.52458968f },  {  0.84974177f, -0.52719913f },  {  0.84812034f, -0.52980362f },
+    {  0.84649094f, -0.53240313f },  {  0.84485357f, -0.53499762f },  {  0.84320824f, -0.53758708f },
+    {  0.84155498f, -0.54017147f },  {  0.83989379f, -0.54275078f },  {  0.83822471f, -0.54532499f },
+    {  0.83654773f, -0.54789406f },  {  0.83486287f, -0.55045797f },  {  0.83317016f, -0.55301671f },
+    {  0.83146961f, -0.55557023f },  {  0.82976123f, -0.55811853f },  {  0.82804505f, -0.56066158f },
+    {  0.82632106f, -0.56319934f },  {  0.82458930f, -0.56573181f },  {  0.82284978f, -0.56825895f },
+    {  0.82110251f, -0.57078075f },  {  0.81934752f, -0.57329717f },  {  0.81758481f, -0.57580819f },
+    {  0.81581441f, -0.57831380f },  {  0.81403633f, -0.58081396f },  {  0.81225059f, -0.58330865f },
+    {  0.81045720f, -0.58579786f },  {  0.80865618f, -0.58828155f },  {  0.80684755f, -0.59075970f },
+    {  0.80503133f, -0.59323230f },  {  0.80320753f, -0.59569930f },  {  0.80137617f, -0.59816071f },
+    {  0.79953727f, -0.60061648f },  {  0.79769084f, -0.60306660f },  {  0.79583690f, -0.60551104f },
+    {  0.79397548f, -0.60794978f },  {  0.79210658f, -0.61038281f },  {  0.79023022f, -0.61281008f },
+    {  0.78834643f, -0.61523159f },  {  0.78645521f, -0.61764731f },  {  0.78455660f, -0.62005721f },
+    {  0.78265060f, -0.62246128f },  {  0.78073723f, -0.62485949f },  {  0.77881651f, -0.62725182f },
+    {  0.77688847f, -0.62963824f },  {  0.77495311f, -0.63201874f },  {  0.77301045f, -0.63439328f },
+    {  0.77106052f, -0.63676186f },  {  0.76910334f, -0.63912444f },  {  0.76713891f, -0.64148101f },
+    {  0.76516727f, -0.64383154f },  {  0.76318842f, -0.64617601f },  {  0.76120239f, -0.64851440f },
+    {  0.75920919f, -0.65084668f },  {  0.75720885f, -0.65317284f },  {  0.75520138f, -0.65549285f },
+    {  0.75318680f, -0.65780669f },  {  0.75116513f, -0.66011434f },  {  0.74913639f, -0.66241578f },
+    {  0.74710061f, -0.66471098f },  {  0.74505779f, -0.66699992f },  {  0.74300795f, -0.66928259f },
+    {  0.74095113f, -0.67155895f },  {  0.73888732f, -0.67382900f },  {  0.73681657f, -0.67609270f },
+    {  0.73473888f, -0.67835004f },  {  0.73265427f, -0.68060100f },  {  0.73056277f, -0.68284555f },
+    {  0.72846439f, -0.68508367f },  {  0.72635916f, -0.68731534f },  {  0.72424708f, -0.68954054f },
+    {  0.72212819f, -0.69175926f },  {  0.72000251f, -0.69397146f },  {  0.71787005f, -0.69617713f },
+    {  0.71573083f, -0.69837625f },  {  0.71358487f, -0.70056879f },  {  0.71143220f, -0.70275474f },
+    {  0.70927283f, -0.70493408f },  {  0.70710678f, -0.70710678f },  {  0.70493408f, -0.70927283f },
+    {  0.70275474f, -0.71143220f },  {  0.70056879f, -0.71358487f },  {  0.69837625f, -0.71573083f },
+    {  0.69617713f, -0.71787005f },  {  0.69397146f, -0.72000251f },  {  0.69175926f, -0.72212819f },
+    {  0.68954054f, -0.72424708f },  {  0.68731534f, -0.72635916f },  {  0.68508367f, -0.72846439f },
+    {  0.68284555f, -0.73056277f },  {  0.68060100f, -0.73265427f },  {  0.67835004f, -0.73473888f },
+    {  0.67609270f, -0.73681657f },  {  0.67382900f, -0.73888732f },  {  0.67155895f, -0.74095113f },
+    {  0.66928259f, -0.74300795f },  {  0.66699992f, -0.74505779f },  {  0.66471098f, -0.74710061f },
+    {  0.66241578f, -0.74913639f },  {  0.66011434f, -0.75116513f },  {  0.65780669f, -0.75318680f },
+    {  0.65549285f, -0.75520138f },  {  0.65317284f, -0.75720885f },  {  0.65084668f, -0.75920919f },
+    {  0.64851440f, -0.76120239f },  {  0.64617601f, -0.76318842f },  {  0.64383154f, -0.76516727f },
+    {  0.64148101f, -0.76713891f },  {  0.63912444f, -0.76910334f },  {  0.63676186f, -0.77106052f },
+    {  0.63439328f, -0.77301045f },  {  0.63201874f, -0.77495311f },  {  0.62963824f, -0.77688847f },
+    {  0.62725182f, -0.77881651f },  {  0.62485949f, -0.78073723f },  {  0.62246128f, -0.78265060f },
+    {  0.62005721f, -0.78455660f },  {  0.61764731f, -0.78645521f },  {  0.61523159f, -0.78834643f },
+    {  0.61281008f, -0.79023022f },  {  0.61038281f, -0.79210658f },  {  0.60794978f, -0.79397548f },
+    {  0.60551104f, -0.79583690f },  {  0.60306660f, -0.79769084f },  {  0.60061648f, -0.79953727f },
+    {  0.59816071f, -0.80137617f },  {  0.59569930f, -0.80320753f },  {  0.59323230f, -0.80503133f },
+    {  0.59075970f, -0.80684755f },  {  0.58828155f, -0.80865618f },  {  0.58579786f, -0.81045720f },
+    {  0.58330865f, -0.81225059f },  {  0.58081396f, -0.81403633f },  {  0.57831380f, -0.81581441f },
+    {  0.57580819f, -0.81758481f },  {  0.57329717f, -0.81934752f },  {  0.57078075f, -0.82110251f },
+    {  0.56825895f, -0.82284978f },  {  0.56573181f, -0.82458930f },  {  0.56319934f, -0.82632106f },
+    {  0.56066158f, -0.82804505f },  {  0.55811853f, -0.82976123f },  {  0.55557023f, -0.83146961f },
+    {  0.55301671f, -0.83317016f },  {  0.55045797f, -0.83486287f },  {  0.54789406f, -0.83654773f },
+    {  0.54532499f, -0.83822471f },  {  0.54275078f, -0.83989379f },  {  0.54017147f, -0.84155498f },
+    {  0.53758708f, -0.84320824f },  {  0.53499762f, -0.84485357f },  {  0.53240313f, -0.84649094f },
+    {  0.52980362f, -0.84812034f },  {  0.52719913f, -0.84974177f },  {  0.52458968f, -0.85135519f },
+    {  0.52197529f, -0.85296060f },  {  0.51935599f, -0.85455799f },  {  0.51673180f, -0.85614733f },
+    {  0.51410274f, -0.85772861f },  {  0.51146885f, -0.85930182f },  {  0.50883014f, -0.86086694f },
+    {  0.50618665f, -0.86242396f },  {  0.50353838f, -0.86397286f },  {  0.50088538f, -0.86551362f },
+    {  0.49822767f, -0.86704625f },  {  0.49556526f, -0.86857071f },  {  0.49289819f, -0.87008699f },
+    {  0.49022648f, -0.87159509f },  {  0.48755016f, -0.87309498f },  {  0.48486925f, -0.87458665f },
+    {  0.48218377f, -0.87607009f },  {  0.47949376f, -0.87754529f },  {  0.47679923f, -0.87901223f },
+    {  0.47410021f, -0.88047089f },  {  0.47139674f, -0.88192126f },  {  0.46868882f, -0.88336334f },
+    {  0.46597650f, -0.88479710f },  {  0.46325978f, -0.88622253f },  {  0.46053871f, -0.88763962f },
+    {  0.45781330f, -0.88904836f },  {  0.45508359f, -0.89044872f },  {  0.45234959f, -0.89184071f },
+    {  0.44961133f, -0.89322430f },  {  0.44686884f, -0.89459949f },  {  0.44412214f, -0.89596625f },
+    {  0.44137127f, -0.89732458f },  {  0.43861624f, -0.89867447f },  {  0.43585708f, -0.90001589f },
+    {  0.43309382f, -0.90134885f },  {  0.43032648f, -0.90267332f },  {  0.42755509f, -0.90398929f },
+    {  0.42477968f, -0.90529676f },  {  0.42200027f, -0.90659570f },  {  0.41921689f, -0.90788612f },
+    {  0.41642956f, -0.90916798f },  {  0.41363831f, -0.91044129f },  {  0.41084317f, -0.91170603f },
+    {  0.40804416f, -0.91296219f },  {  0.40524131f, -0.91420976f },  {  0.40243465f, -0.91544872f },
+    {  0.39962420f, -0.91667906f },  {  0.39680999f, -0.91790078f },  {  0.39399204f, -0.91911385f },
+    {  0.39117038f, -0.92031828f },  {  0.38834505f, -0.92151404f },  {  0.38551605f, -0.92270113f },
+    {  0.38268343f, -0.92387953f },  {  0.37984721f, -0.92504924f },  {  0.37700741f, -0.92621024f },
+    {  0.37416406f, -0.92736253f },  {  0.37131719f, -0.92850608f },  {  0.36846683f, -0.92964090f },
+    {  0.36561300f, -0.93076696f },  {  0.36275572f, -0.93188427f },  {  0.35989504f, -0.93299280f },
+    {  0.35703096f, -0.93409255f },  {  0.35416353f, -0.93518351f },  {  0.35129276f, -0.93626567f },
+    {  0.34841868f, -0.93733901f },  {  0.34554132f, -0.93840353f },  {  0.34266072f, -0.93945922f },
+    {  0.33977688f, -0.94050607f },  {  0.33688985f, -0.94154407f },  {  0.33399965f, -0.94257320f },
+    {  0.33110631f, -0.94359346f },  {  0.32820984f, -0.94460484f },  {  0.32531029f, -0.94560733f },
+    {  0.32240768f, -0.94660091f },  {  0.31950203f, -0.94758559f },  {  0.31659338f, -0.94856135f },
+    {  0.31368174f, -0.94952818f },  {  0.31076715f, -0.95048607f },  {  0.30784964f, -0.95143502f },
+    {  0.30492923f, -0.95237501f },  {  0.30200595f, -0.95330604f },  {  0.29907983f, -0.95422810f },
+    {  0.29615089f, -0.95514117f },  {  0.29321916f, -0.95604525f },  {  0.29028468f, -0.95694034f },
+    {  0.28734746f, -0.95782641f },  {  0.28440754f, -0.95870347f },  {  0.28146494f, -0.95957151f },
+    {  0.27851969f, -0.96043052f },  {  0.27557182f, -0.96128049f },  {  0.27262136f, -0.96212140f },
+    {  0.26966833f, -0.96295327f },  {  0.26671276f, -0.96377607f },  {  0.26375468f, -0.96458979f },
+    {  0.26079412f, -0.96539444f },  {  0.25783110f, -0.96619000f },  {  0.25486566f, -0.96697647f },
+    {  0.25189782f, -0.96775384f },  {  0.24892761f, -0.96852209f },  {  0.24595505f, -0.96928124f },
+    {  0.24298018f, -0.97003125f },  {  0.24000302f, -0.97077214f },  {  0.23702361f, -0.97150389f },
+    {  0.23404196f, -0.97222650f },  {  0.23105811f, -0.97293995f },  {  0.22807208f, -0.97364425f },
+    {  0.22508391f, -0.97433938f },  {  0.22209362f, -0.97502535f },  {  0.21910124f, -0.97570213f },
+    {  0.21610680f, -0.97636973f },  {  0.21311032f, -0.97702814f },  {  0.21011184f, -0.97767736f },
+    {  0.20711138f, -0.97831737f },  {  0.20410897f, -0.97894818f },  {  0.20110463f, -0.97956977f },
+    {  0.19809841f, -0.98018214f },  {  0.19509032f, -0.98078528f },  {  0.19208040f, -0.98137919f },
+    {  0.18906866f, -0.98196387f },  {  0.18605515f, -0.98253930f },  {  0.18303989f, -0.98310549f },
+    {  0.18002290f, -0.98366242f },  {  0.17700422f, -0.98421009f },  {  0.17398387f, -0.98474850f },
+    {  0.17096189f, -0.98527764f },  {  0.16793829f, -0.98579751f },  {  0.16491312f, -0.98630810f },
+    {  0.16188639f, -0.98680940f },  {  0.15885814f, -0.98730142f },  {  0.15582840f, -0.98778414f },
+    {  0.15279719f, -0.98825757f },  {  0.14976453f, -0.98872169f },  {  0.14673047f, -0.98917651f },
+    {  0.14369503f, -0.98962202f },  {  0.14065824f, -0.99005821f },  {  0.13762012f, -0.99048508f },
+    {  0.13458071f, -0.99090264f },  {  0.13154003f, -0.99131086f },  {  0.12849811f, -0.99170975f },
+    {  0.12545498f, -0.99209931f },  {  0.12241068f, -0.99247953f },  {  0.11936521f, -0.99285041f },
+    {  0.11631863f, -0.99321195f },  {  0.11327095f, -0.99356414f },  {  0.11022221f, -0.99390697f },
+    {  0.10717242f, -0.99424045f },  {  0.10412163f, -0.99456457f },  {  0.10106986f, -0.99487933f },
+    {  0.09801714f, -0.99518473f },  {  0.09496350f, -0.99548076f },  {  0.09190896f, -0.99576741f },
+    {  0.08885355f, -0.99604470f },  {  0.08579731f, -0.99631261f },  {  0.08274026f, -0.99657115f },
+    {  0.07968244f, -0.99682030f },  {  0.07662386f, -0.99706007f },  {  0.07356456f, -0.99729046f },
+    {  0.07050457f, -0.99751146f },  {  0.06744392f, -0.99772307f },  {  0.06438263f, -0.99792529f },
+    {  0.06132074f, -0.99811811f },  {  0.05825826f, -0.99830154f },  {  0.05519524f, -0.99847558f },
+    {  0.05213170f, -0.99864022f },  {  0.04906767f, -0.99879546f },  {  0.04600318f, -0.99894129f },
+    {  0.04293826f, -0.99907773f },  {  0.03987293f, -0.99920476f },  {  0.03680722f, -0.99932238f },
+    {  0.03374117f, -0.99943060f },  {  0.03067480f, -0.99952942f },  {  0.02760815f, -0.99961882f },
+    {  0.02454123f, -0.99969882f },  {  0.02147408f, -0.99976941f },  {  0.01840673f, -0.99983058f },
+    {  0.01533921f, -0.99988235f },  {  0.01227154f, -0.99992470f },  {  0.00920375f, -0.99995764f },
+    {  0.00613588f, -0.99998118f },  {  0.00306796f, -0.99999529f },  {  0.00000000f, -1.00000000f },
+    { -0.00306796f, -0.99999529f },  { -0.00613588f, -0.99998118f },  { -0.00920375f, -0.99995764f },
+    { -0.01227154f, -0.99992470f },  { -0.01533921f, -0.99988235f },  { -0.01840673f, -0.99983058f },
+    { -0.02147408f, -0.99976941f },  { -0.02454123f, -0.99969882f },  { -0.02760815f, -0.99961882f },
+    { -0.03067480f, -0.99952942f },  { -0.03374117f, -0.99943060f },  { -0.03680722f, -0.99932238f },
+    { -0.03987293f, -0.99920476f },  { -0.04293826f, -0.99907773f },  { -0.04600318f, -0.99894129f },
+    { -0.04906767f, -0.99879546f },  { -0.05213170f, -0.99864022f },  { -0.05519524f, -0.99847558f },
+    { -0.05825826f, -0.99830154f },  { -0.06132074f, -0.99811811f },  { -0.06438263f, -0.99792529f },
+    { -0.06744392f, -0.99772307f },  { -0.07050457f, -0.99751146f },  { -0.07356456f, -0.99729046f },
+    { -0.07662386f, -0.99706007f },  { -0.07968244f, -0.99682030f },  { -0.08274026f, -0.99657115f },
+    { -0.08579731f, -0.99631261f },  { -0.08885355f, -0.99604470f },  { -0.09190896f, -0.99576741f },
+    { -0.09496350f, -0.99548076f },  { -0.09801714f, -0.99518473f },  { -0.10106986f, -0.99487933f },
+    { -0.10412163f, -0.99456457f },  { -0.10717242f, -0.99424045f },  { -0.11022221f, -0.99390697f },
+    { -0.11327095f, -0.99356414f },  { -0.11631863f, -0.99321195f },  { -0.11936521f, -0.99285041f },
+    { -0.12241068f, -0.99247953f },  { -0.12545498f, -0.99209931f },  { -0.12849811f, -0.99170975f },
+    { -0.13154003f, -0.99131086f },  { -0.13458071f, -0.99090264f },  { -0.13762012f, -0.99048508f },
+    { -0.14065824f, -0.99005821f },  { -0.14369503f, -0.98962202f },  { -0.14673047f, -0.98917651f },
+    { -0.14976453f, -0.98872169f },  { -0.15279719f, -0.98825757f },  { -0.15582840f, -0.98778414f },
+    { -0.15885814f, -0.98730142f },  { -0.16188639f, -0.98680940f },  { -0.16491312f, -0.98630810f },
+    { -0.16793829f, -0.98579751f },  { -0.17096189f, -0.98527764f },  { -0.17398387f, -0.98474850f },
+    { -0.17700422f, -0.98421009f },  { -0.18002290f, -0.98366242f },  { -0.18303989f, -0.98310549f },
+    { -0.18605515f, -0.98253930f },  { -0.18906866f, -0.98196387f },  { -0.19208040f, -0.98137919f },
+    { -0.19509032f, -0.98078528f },  { -0.19809841f, -0.98018214f },  { -0.20110463f, -0.97956977f },
+    { -0.20410897f, -0.97894818f },  { -0.20711138f, -0.97831737f },  { -0.21011184f, -0.97767736f },
+    { -0.21311032f, -0.97702814f },  { -0.21610680f, -0.97636973f },  { -0.21910124f, -0.97570213f },
+    { -0.22209362f, -0.97502535f },  { -0.22508391f, -0.97433938f },  { -0.22807208f, -0.97364425f },
+    { -0.23105811f, -0.97293995f },  { -0.23404196f, -0.97222650f },  { -0.23702361f, -0.97150389f },
+    { -0.24000302f, -0.97077214f },  { -0.24298018f, -0.97003125f },  { -0.24595505f, -0.96928124f },
+    { -0.24892761f, -0.96852209f },  { -0.25189782f, -0.96775384f },  { -0.25486566f, -0.96697647f },
+    { -0.25783110f, -0.96619000f },  { -0.26079412f, -0.96539444f },  { -0.26375468f, -0.96458979f },
+    { -0.26671276f, -0.96377607f },  { -0.26966833f, -0.96295327f },  { -0.27262136f, -0.96212140f },
+    { -0.27557182f, -0.96128049f },  { -0.27851969f, -0.96043052f },  { -0.28146494f, -0.95957151f },
+    { -0.28440754f, -0.95870347f },  { -0.28734746f, -0.95782641f },  { -0.29028468f, -0.95694034f },
+    { -0.29321916f, -0.95604525f },  { -0.29615089f, -0.95514117f },  { -0.29907983f, -0.95422810f },
+    { -0.30200595f, -0.95330604f },  { -0.30492923f, -0.95237501f },  { -0.30784964f, -0.95143502f },
+    { -0.31076715f, -0.95048607f },  { -0.31368174f, -0.94952818f },  { -0.31659338f, -0.94856135f },
+    { -0.31950203f, -0.94758559f },  { -0.32240768f, -0.94660091f },  { -0.32531029f, -0.94560733f },
+    { -0.32820984f, -0.94460484f },  { -0.33110631f, -0.94359346f },  { -0.33399965f, -0.94257320f },
+    { -0.33688985f, -0.94154407f },  { -0.33977688f, -0.94050607f },  { -0.34266072f, -0.93945922f },
+    { -0.34554132f, -0.93840353f },  { -0.34841868f, -0.93733901f },  { -0.35129276f, -0.93626567f },
+    { -0.35416353f, -0.93518351f },  { -0.35703096f, -0.93409255f },  { -0.35989504f, -0.93299280f },
+    { -0.36275572f, -0.93188427f },  { -0.36561300f, -0.93076696f },  { -0.36846683f, -0.92964090f },
+    { -0.37131719f, -0.92850608f },  { -0.37416406f, -0.92736253f },  { -0.37700741f, -0.92621024f },
+    { -0.37984721f, -0.92504924f },  { -0.38268343f, -0.92387953f },  { -0.38551605f, -0.92270113f },
+    { -0.38834505f, -0.92151404f },  { -0.39117038f, -0.92031828f },  { -0.39399204f, -0.91911385f },
+    { -0.39680999f, -0.91790078f },  { -0.39962420f, -0.91667906f },  { -0.40243465f, -0.91544872f },
+    { -0.40524131f, -0.91420976f },  { -0.40804416f, -0.91296219f },  { -0.41084317f, -0.91170603f },
+    { -0.41363831f, -0.91044129f },  { -0.41642956f, -0.90916798f },  { -0.41921689f, -0.90788612f },
+    { -0.42200027f, -0.90659570f },  { -0.42477968f, -0.90529676f },  { -0.42755509f, -0.90398929f },
+    { -0.43032648f, -0.90267332f },  { -0.43309382f, -0.90134885f },  { -0.43585708f, -0.90001589f },
+    { -0.43861624f, -0.89867447f },  { -0.44137127f, -0.89732458f },  { -0.44412214f, -0.89596625f },
+    { -0.44686884f, -0.89459949f },  { -0.44961133f, -0.89322430f },  { -0.45234959f, -0.89184071f },
+    { -0.45508359f, -0.89044872f },  { -0.45781330f, -0.88904836f },  { -0.46053871f, -0.88763962f },
+    { -0.46325978f, -0.88622253f },  { -0.46597650f, -0.88479710f },  { -0.46868882f, -0.88336334f },
+    { -0.47139674f, -0.88192126f },  { -0.47410021f, -0.88047089f },  { -0.47679923f, -0.87901223f },
+    { -0.47949376f, -0.87754529f },  { -0.48218377f, -0.87607009f },  { -0.48486925f, -0.87458665f },
+    { -0.48755016f, -0.87309498f },  { -0.49022648f, -0.87159509f },  { -0.49289819f, -0.87008699f },
+    { -0.49556526f, -0.86857071f },  { -0.49822767f, -0.86704625f },  { -0.50088538f, -0.86551362f },
+    { -0.50353838f, -0.86397286f },  { -0.50618665f, -0.86242396f },  { -0.50883014f, -0.86086694f },
+    { -0.51146885f, -0.85930182f },  { -0.51410274f, -0.85772861f },  { -0.51673180f, -0.85614733f },
+    { -0.51935599f, -0.85455799f },  { -0.52197529f, -0.85296060f },  { -0.52458968f, -0.85135519f },
+    { -0.52719913f, -0.84974177f },  { -0.52980362f, -0.84812034f },  { -0.53240313f, -0.84649094f },
+    { -0.53499762f, -0.84485357f },  { -0.53758708f, -0.84320824f },  { -0.54017147f, -0.84155498f },
+    { -0.54275078f, -0.83989379f },  { -0.54532499f, -0.83822471f },  { -0.54789406f, -0.83654773f },
+    { -0.55045797f, -0.83486287f },  { -0.55301671f, -0.83317016f },  { -0.55557023f, -0.83146961f },
+    { -0.55811853f, -0.82976123f },  { -0.56066158f, -0.82804505f },  { -0.56319934f, -0.82632106f },
+    { -0.56573181f, -0.82458930f },  { -0.56825895f, -0.82284978f },  { -0.57078075f, -0.82110251f },
+    { -0.57329717f, -0.81934752f },  { -0.57580819f, -0.81758481f },  { -0.57831380f, -0.81581441f },
+    { -0.58081396f, -0.81403633f },  { -0.58330865f, -0.81225059f },  { -0.58579786f, -0.81045720f },
+    { -0.58828155f, -0.80865618f },  { -0.59075970f, -0.80684755f },  { -0.59323230f, -0.80503133f },
+    { -0.59569930f, -0.80320753f },  { -0.59816071f, -0.80137617f },  { -0.60061648f, -0.79953727f },
+    { -0.60306660f, -0.79769084f },  { -0.60551104f, -0.79583690f },  { -0.60794978f, -0.79397548f },
+    { -0.61038281f, -0.79210658f },  { -0.61281008f, -0.79023022f },  { -0.61523159f, -0.78834643f },
+    { -0.61764731f, -0.78645521f },  { -0.62005721f, -0.78455660f },  { -0.62246128f, -0.78265060f },
+    { -0.62485949f, -0.78073723f },  { -0.62725182f, -0.77881651f },  { -0.62963824f, -0.77688847f },
+    { -0.63201874f, -0.77495311f },  { -0.63439328f, -0.77301045f },  { -0.63676186f, -0.77106052f },
+    { -0.63912444f, -0.76910334f },  { -0.64148101f, -0.76713891f },  { -0.64383154f, -0.76516727f },
+    { -0.64617601f, -0.76318842f },  { -0.64851440f, -0.76120239f },  { -0.65084668f, -0.75920919f },
+    { -0.65317284f, -0.75720885f },  { -0.65549285f, -0.75520138f },  { -0.65780669f, -0.75318680f },
+    { -0.66011434f, -0.75116513f },  { -0.66241578f, -0.74913639f },  { -0.66471098f, -0.74710061f },
+    { -0.66699992f, -0.74505779f },  { -0.66928259f, -0.74300795f },  { -0.67155895f, -0.74095113f },
+    { -0.67382900f, -0.73888732f },  { -0.67609270f, -0.73681657f },  { -0.67835004f, -0.73473888f },
+    { -0.68060100f, -0.73265427f },  { -0.68284555f, -0.73056277f },  { -0.68508367f, -0.72846439f },
+    { -0.68731534f, -0.72635916f },  { -0.68954054f, -0.72424708f },  { -0.69175926f, -0.72212819f },
+    { -0.69397146f, -0.72000251f },  { -0.69617713f, -0.71787005f },  { -0.69837625f, -0.71573083f },
+    { -0.70056879f, -0.71358487f },  { -0.70275474f, -0.71143220f },  { -0.70493408f, -0.70927283f },
+    { -0.70710678f, -0.70710678f },  { -0.70927283f, -0.70493408f },  { -0.71143220f, -0.70275474f },
+    { -0.71358487f, -0.70056879f },  { -0.71573083f, -0.69837625f },  { -0.71787005f, -0.69617713f },
+    { -0.72000251f, -0.69397146f },  { -0.72212819f, -0.69175926f },  { -0.72424708f, -0.68954054f },
+    { -0.72635916f, -0.68731534f },  { -0.72846439f, -0.68508367f },  { -0.73056277f, -0.68284555f },
+    { -0.73265427f, -0.68060100f },  { -0.73473888f, -0.67835004f },  { -0.73681657f, -0.67609270f },
+    { -0.73888732f, -0.67382900f },  { -0.74095113f, -0.67155895f },  { -0.74300795f, -0.66928259f },
+    { -0.74505779f, -0.66699992f },  { -0.74710061f, -0.66471098f },  { -0.74913639f, -0.66241578f },
+    { -0.75116513f, -0.66011434f },  { -0.75318680f, -0.65780669f },  { -0.75520138f, -0.65549285f },
+    { -0.75720885f, -0.65317284f },  { -0.75920919f, -0.65084668f },  { -0.76120239f, -0.64851440f },
+    { -0.76318842f, -0.64617601f },  { -0.76516727f, -0.64383154f },  { -0.76713891f, -0.64148101f },
+    { -0.76910334f, -0.63912444f },  { -0.77106052f, -0.63676186f },  { -0.77301045f, -0.63439328f },
+    { -0.77495311f, -0.63201874f },  { -0.77688847f, -0.62963824f },  { -0.77881651f, -0.62725182f },
+    { -0.78073723f, -0.62485949f },  { -0.78265060f, -0.62246128f },  { -0.78455660f, -0.62005721f },
+    { -0.78645521f, -0.61764731f },  { -0.78834643f, -0.61523159f },  { -0.79023022f, -0.61281008f },
+    { -0.79210658f, -0.61038281f },  { -0.79397548f, -0.60794978f },  { -0.79583690f, -0.60551104f },
+    { -0.79769084f, -0.60306660f },  { -0.79953727f, -0.60061648f },  { -0.80137617f, -0.59816071f },
+    { -0.80320753f, -0.59569930f },  { -0.80503133f, -0.59323230f },  { -0.80684755f, -0.59075970f },
+    { -0.80865618f, -0.58828155f },  { -0.81045720f, -0.58579786f },  { -0.81225059f, -0.58330865f },
+    { -0.81403633f, -0.58081396f },  { -0.81581441f, -0.57831380f },  { -0.81758481f, -0.57580819f },
+    { -0.81934752f, -0.57329717f },  { -0.82110251f, -0.57078075f },  { -0.82284978f, -0.56825895f },
+    { -0.82458930f, -0.56573181f },  { -0.82632106f, -0.56319934f },  { -0.82804505f, -0.56066158f },
+    { -0.82976123f, -0.55811853f },  { -0.83146961f, -0.55557023f },  { -0.83317016f, -0.55301671f },
+    { -0.83486287f, -0.55045797f },  { -0.83654773f, -0.54789406f },  { -0.83822471f, -0.54532499f },
+    { -0.83989379f, -0.54275078f },  { -0.84155498f, -0.54017147f },  { -0.84320824f, -0.53758708f },
+    { -0.84485357f, -0.53499762f },  { -0.84649094f, -0.53240313f },  { -0.84812034f, -0.52980362f },
+    { -0.84974177f, -0.52719913f },  { -0.85135519f, -0.52458968f },  { -0.85296060f, -0.52197529f },
+    { -0.85455799f, -0.51935599f },  { -0.85614733f, -0.51673180f },  { -0.85772861f, -0.51410274f },
+    { -0.85930182f, -0.51146885f },  { -0.86086694f, -0.50883014f },  { -0.86242396f, -0.50618665f },
+    { -0.86397286f, -0.50353838f },  { -0.86551362f, -0.50088538f },  { -0.86704625f, -0.49822767f },
+    { -0.86857071f, -0.49556526f },  { -0.87008699f, -0.49289819f },  { -0.87159509f, -0.49022648f },
+    { -0.87309498f, -0.48755016f },  { -0.87458665f, -0.48486925f },  { -0.87607009f, -0.48218377f },
+    { -0.87754529f, -0.47949376f },  { -0.87901223f, -0.47679923f },  { -0.88047089f, -0.47410021f },
+    { -0.88192126f, -0.47139674f },  { -0.88336334f, -0.46868882f },  { -0.88479710f, -0.46597650f },
+    { -0.88622253f, -0.46325978f },  { -0.88763962f, -0.46053871f },  { -0.88904836f, -0.45781330f },
+    { -0.89044872f, -0.45508359f },  { -0.89184071f, -0.45234959f },  { -0.89322430f, -0.44961133f },
+    { -0.89459949f, -0.44686884f },  { -0.89596625f, -0.44412214f },  { -0.89732458f, -0.44137127f },
+    { -0.89867447f, -0.43861624f },  { -0.90001589f, -0.43585708f },  { -0.90134885f, -0.43309382f },
+    { -0.90267332f, -0.43032648f },  { -0.90398929f, -0.42755509f },  { -0.90529676f, -0.42477968f },
+    { -0.90659570f, -0.42200027f },  { -0.90788612f, -0.41921689f },  { -0.90916798f, -0.41642956f },
+    { -0.91044129f, -0.41363831f },  { -0.91170603f, -0.41084317f },  { -0.91296219f, -0.40804416f },
+    { -0.91420976f, -0.40524131f },  { -0.91544872f, -0.40243465f },  { -0.91667906f, -0.39962420f },
+    { -0.91790078f, -0.39680999f },  { -0.91911385f, -0.39399204f },  { -0.92031828f, -0.39117038f },
+    { -0.92151404f, -0.38834505f },  { -0.92270113f, -0.38551605f },  { -0.92387953f, -0.38268343f },
+    { -0.92504924f, -0.37984721f },  { -0.92621024f, -0.37700741f },  { -0.92736253f, -0.37416406f },
+    { -0.92850608f, -0.37131719f },  { -0.92964090f, -0.36846683f },  { -0.93076696f, -0.36561300f },
+    { -0.93188427f, -0.36275572f },  { -0.93299280f, -0.35989504f },  { -0.93409255f, -0.35703096f },
+    { -0.93518351f, -0.35416353f },  { -0.93626567f, -0.35129276f },  { -0.93733901f, -0.34841868f },
+    { -0.93840353f, -0.34554132f },  { -0.93945922f, -0.34266072f },  { -0.94050607f, -0.33977688f },
+    { -0.94154407f, -0.33688985f },  { -0.94257320f, -0.33399965f },  { -0.94359346f, -0.33110631f },
+    { -0.94460484f, -0.32820984f },  { -0.94560733f, -0.32531029f },  { -0.94660091f, -0.32240768f },
+    { -0.94758559f, -0.31950203f },  { -0.94856135f, -0.31659338f },  { -0.94952818f, -0.31368174f },
+    { -0.95048607f, -0.31076715f },  { -0.95143502f, -0.30784964f },  { -0.95237501f, -0.30492923f },
+    { -0.95330604f, -0.30200595f },  { -0.95422810f, -0.29907983f },  { -0.95514117f, -0.29615089f },
+    { -0.95604525f, -0.29321916f },  { -0.95694034f, -0.29028468f },  { -0.95782641f, -0.28734746f },
+    { -0.95870347f, -0.28440754f },  { -0.95957151f, -0.28146494f },  { -0.96043052f, -0.27851969f },
+    { -0.96128049f, -0.27557182f },  { -0.96212140f, -0.27262136f },  { -0.96295327f, -0.26966833f },
+    { -0.96377607f, -0.26671276f },  { -0.96458979f, -0.26375468f },  { -0.96539444f, -0.26079412f },
+    { -0.96619000f, -0.25783110f },  { -0.96697647f, -0.25486566f },  { -0.96775384f, -0.25189782f },
+    { -0.96852209f, -0.24892761f },  { -0.96928124f, -0.24595505f },  { -0.97003125f, -0.24298018f },
+    { -0.97077214f, -0.24000302f },  { -0.97150389f, -0.23702361f },  { -0.97222650f, -0.23404196f },
+    { -0.97293995f, -0.23105811f },  { -0.97364425f, -0.22807208f },  { -0.97433938f, -0.22508391f },
+    { -0.97502535f, -0.22209362f },  { -0.97570213f, -0.21910124f },  { -0.97636973f, -0.21610680f },
+    { -0.97702814f, -0.21311032f },  { -0.97767736f, -0.21011184f },  { -0.97831737f, -0.20711138f },
+    { -0.97894818f, -0.20410897f },  { -0.97956977f, -0.20110463f },  { -0.98018214f, -0.19809841f },
+    { -0.98078528f, -0.19509032f },  { -0.98137919f, -0.19208040f },  { -0.98196387f, -0.18906866f },
+    { -0.98253930f, -0.18605515f },  { -0.98310549f, -0.18303989f },  { -0.98366242f, -0.18002290f },
+    { -0.98421009f, -0.17700422f },  { -0.98474850f, -0.17398387f },  { -0.98527764f, -0.17096189f },
+    { -0.98579751f, -0.16793829f },  { -0.98630810f, -0.16491312f },  { -0.98680940f, -0.16188639f },
+    { -0.98730142f, -0.15885814f },  { -0.98778414f, -0.15582840f },  { -0.98825757f, -0.15279719f },
+    { -0.98872169f, -0.14976453f },  { -0.98917651f, -0.14673047f },  { -0.98962202f, -0.14369503f },
+    { -0.99005821f, -0.14065824f },  { -0.99048508f, -0.13762012f },  { -0.99090264f, -0.13458071f },
+    { -0.99131086f, -0.13154003f },  { -0.99170975f, -0.12849811f },  { -0.99209931f, -0.12545498f },
+    { -0.99247953f, -0.12241068f },  { -0.99285041f, -0.11936521f },  { -0.99321195f, -0.11631863f },
+    { -0.99356414f, -0.11327095f },  { -0.99390697f, -0.11022221f },  { -0.99424045f, -0.10717242f },
+    { -0.99456457f, -0.10412163f },  { -0.99487933f, -0.10106986f },  { -0.99518473f, -0.09801714f },
+    { -0.99548076f, -0.09496350f },  { -0.99576741f, -0.09190896f },  { -0.99604470f, -0.08885355f },
+    { -0.99631261f, -0.08579731f },  { -0.99657115f, -0.08274026f },  { -0.99682030f, -0.07968244f },
+    { -0.99706007f, -0.07662386f },  { -0.99729046f, -0.07356456f },  { -0.99751146f, -0.07050457f },
+    { -0.99772307f, -0.06744392f },  { -0.99792529f, -0.06438263f },  { -0.99811811f, -0.06132074f },
+    { -0.99830154f, -0.05825826f },  { -0.99847558f, -0.05519524f },  { -0.99864022f, -0.05213170f },
+    { -0.99879546f, -0.04906767f },  { -0.99894129f, -0.04600318f },  { -0.99907773f, -0.04293826f },
+    { -0.99920476f, -0.03987293f },  { -0.99932238f, -0.03680722f },  { -0.99943060f, -0.03374117f },
+    { -0.99952942f, -0.03067480f },  { -0.99961882f, -0.02760815f },  { -0.99969882f, -0.02454123f },
+    { -0.99976941f, -0.02147408f },  { -0.99983058f, -0.01840673f },  { -0.99988235f, -0.01533921f },
+    { -0.99992470f, -0.01227154f },  { -0.99995764f, -0.00920375f },  { -0.99998118f, -0.00613588f },
+    { -0.99999529f, -0.00306796f }
+};
+
+/* generated by rfft_bit_rev(2048), see plp_common_tables.c */
+short bit_rev_radix2_LUT[2048] = {
+0, 1024, 512, 1536, 256, 1280, 768, 1792, 128, 1152, 640, 1664, 384, 1408, 896,
+1920, 64, 1088, 576, 1600, 320, 1344, 832, 1856, 192, 1216, 704, 1728, 448,
+1472, 960, 1984, 32, 1056, 544, 1568, 288, 1312, 800, 1824, 160, 1184, 672,
+1696, 416, 1440, 928, 1952, 96, 1120, 608, 1632, 352, 1376, 864, 1888, 224,
+1248, 736, 1760, 480, 1504, 992, 2016, 16, 1040, 528, 1552, 272, 1296, 784,
+1808, 144, 1168, 656, 1680, 400, 1424, 912, 1936, 80, 1104, 592, 1616, 336,
+1360, 848, 1872, 208, 1232, 720, 1744, 464, 1488, 976, 2000, 48, 1072, 560,
+1584, 304, 1328, 816, 1840, 176, 1200, 688, 1712, 432, 1456, 944, 1968, 112,
+1136, 624, 1648, 368, 1392, 880, 1904, 240, 1264, 752, 1776, 496, 1520, 1008,
+2032, 8, 1032, 520, 1544, 264, 1288, 776, 1800, 136, 1160, 648, 1672, 392, 1416,
+904, 1928, 72, 1096, 584, 1608, 328, 1352, 840, 1864, 200, 1224, 712, 1736, 456,
+1480, 968, 1992, 40, 1064, 552, 1576, 296, 1320, 808, 1832, 168, 1192, 680,
+1704, 424, 1448, 936, 1960, 104, 1128, 616, 1640, 360, 1384, 872, 1896, 232,
+1256, 744, 1768, 488, 1512, 1000, 2024, 24, 1048, 536, 1560, 280, 1304, 792,
+1816, 152, 1176, 664, 1688, 408, 1432, 920, 1944, 88, 1112, 600, 1624, 344,
+1368, 856, 1880, 216, 1240, 728, 1752, 472, 1496, 984, 2008, 56, 1080, 568,
+1592, 312, 1336, 824, 1848, 184, 1208, 696, 1720, 440, 1464, 952, 1976, 120,
+1144, 632, 1656, 376, 1400, 888, 1912, 248, 1272, 760, 1784, 504, 1528, 1016,
+2040, 4, 1028, 516, 1540, 260, 1284, 772, 1796, 132, 1156, 644, 1668, 388, 1412,
+900, 1924, 68, 1092, 580, 1604, 324, 1348, 836, 1860, 196, 1220, 708, 1732, 452,
+1476, 964, 1988, 36, 1060, 548, 1572, 292, 1316, 804, 1828, 164, 1188, 676,
+1700, 420, 1444, 932, 1956, 100, 1124, 612, 1636, 356, 1380, 868, 1892, 228,
+1252, 740, 1764, 484, 1508, 996, 2020, 20, 1044, 532, 1556, 276, 1300, 788,
+1812, 148, 1172, 660, 1684, 404, 1428, 916, 1940, 84, 1108, 596, 1620, 340,
+1364, 852, 1876, 212, 1236, 724, 1748, 468, 1492, 980, 2004, 52, 1076, 564,
+1588, 308, 1332, 820, 1844, 180, 1204, 692, 1716, 436, 1460, 948, 1972, 116,
+1140, 628, 1652, 372, 1396, 884, 1908, 244, 1268, 756, 1780, 500, 1524, 1012,
+2036, 12, 1036, 524, 1548, 268, 1292, 780, 1804, 140, 1164, 652, 1676, 396,
+1420, 908, 1932, 76, 1100, 588, 1612, 332, 1356, 844, 1868, 204, 1228, 716,
+1740, 460, 1484, 972, 1996, 44, 1068, 556, 1580, 300, 1324, 812, 1836, 172,
+1196, 684, 1708, 428, 1452, 940, 1964, 108, 1132, 620, 1644, 364, 1388, 876,
+1900, 236, 1260, 748, 1772, 492, 1516, 1004, 2028, 28, 1052, 540, 1564, 284,
+1308, 796, 1820, 156, 1180, 668, 1692, 412, 1436, 924, 1948, 92, 1116, 604,
+1628, 348, 1372, 860, 1884, 220, 1244, 732, 1756, 476, 1500, 988, 2012, 60,
+1084, 572, 1596, 316, 1340, 828, 1852, 188, 1212, 700, 1724, 444, 1468, 956,
+1980, 124, 1148, 636, 1660, 380, 1404, 892, 1916, 252, 1276, 764, 1788, 508,
+1532, 1020, 2044, 2, 1026, 514, 1538, 258, 1282, 770, 1794, 130, 1154, 642,
+1666, 386, 1410, 898, 1922, 66, 1090, 578, 1602, 322, 1346, 834, 1858, 194,
+1218, 706, 1730, 450, 1474, 962, 1986, 34, 1058, 546, 1570, 290, 1314, 802,
+1826, 162, 1186, 674, 1698, 418, 1442, 930, 1954, 98, 1122, 610, 1634, 354,
+1378, 866, 1890, 226, 1250, 738, 1762, 482, 1506, 994, 2018, 18, 1042, 530,
+1554, 274, 1298, 786, 1810, 146, 1170, 658, 1682, 402, 1426, 914, 1938, 82,
+1106, 594, 1618, 338, 1362, 850, 1874, 210, 1234, 722, 1746, 466, 1490, 978,
+2002, 50, 1074, 562, 1586, 306, 1330, 818, 1842, 178, 1202, 690, 1714, 434,
+1458, 946, 1970, 114, 1138, 626, 1650, 370, 1394, 882, 1906, 242, 1266, 754,
+1778, 498, 1522, 1010, 2034, 10, 1034, 522, 1546, 266, 1290, 778, 1802, 138,
+1162, 650, 1674, 394, 1418, 906, 1930, 74, 1098, 586, 1610, 330, 1354, 842,
+1866, 202, 1226, 714, 1738, 458, 1482, 970, 1994, 42, 1066, 554, 1578, 298,
+1322, 810, 1834, 170, 1194, 682, 1706, 426, 1450, 938, 1962, 106, 1130, 618,
+1642, 362, 1386, 874, 1898, 234, 1258, 746, 1770, 490, 1514, 1002, 2026, 26,
+1050, 538, 1562, 282, 1306, 794, 1818, 154, 1178, 666, 1690, 410, 1434, 922,
+1946, 90, 1114, 602, 1626, 346, 1370, 858, 1882, 218, 1242, 730, 1754, 474,
+1498, 986, 2010, 58, 1082, 570, 1594, 314, 1338, 826, 1850, 186, 1210, 698,
+1722, 442, 1466, 954, 1978, 122, 1146, 634, 1658, 378, 1402, 890, 1914, 250,
+1274, 762, 1786, 506, 1530, 1018, 2042, 6, 1030, 518, 1542, 262, 1286, 774,
+1798, 134, 1158, 646, 1670, 390, 1414, 902, 1926, 70, 1094, 582, 1606, 326,
+1350, 838, 1862, 198, 1222, 710, 1734, 454, 1478, 966, 1990, 38, 1062, 550,
+1574, 294, 1318, 806, 1830, 166, 1190, 678, 1702, 422, 1446, 934, 1958, 102,
+1126, 614, 1638, 358, 1382, 870, 1894, 230, 1254, 742, 1766, 486, 1510, 998,
+2022, 22, 1046, 534, 1558, 278, 1302, 790, 1814, 150, 1174, 662, 1686, 406,
+1430, 918, 1942, 86, 1110, 598, 1622, 342, 1366, 854, 1878, 214, 1238, 726,
+1750, 470, 1494, 982, 2006, 54, 1078, 566, 1590, 310, 1334, 822, 1846, 182,
+1206, 694, 1718, 438, 1462, 950, 1974, 118, 1142, 630, 1654, 374, 1398, 886,
+1910, 246, 1270, 758, 1782, 502, 1526, 1014, 2038, 14, 1038, 526, 1550, 270,
+1294, 782, 1806, 142, 1166, 654, 1678, 398, 1422, 910, 1934, 78, 1102, 590,
+1614, 334, 1358, 846, 1870, 206, 1230, 718, 1742, 462, 1486, 974, 1998, 46,
+1070, 558, 1582, 302, 1326, 814, 1838, 174, 1198, 686, 1710, 430, 1454, 942,
+1966, 110, 1134, 622, 1646, 366, 1390, 878, 1902, 238, 1262, 750, 1774, 494,
+1518, 1006, 2030, 30, 1054, 542, 1566, 286, 1310, 798, 1822, 158, 1182, 670,
+1694, 414, 1438, 926, 1950, 94, 1118, 606, 1630, 350, 1374, 862, 1886, 222,
+1246, 734, 1758, 478, 1502, 990, 2014, 62, 1086, 574, 1598, 318, 1342, 830,
+1854, 190, 1214, 702, 1726, 446, 1470, 958, 1982, 126, 1150, 638, 1662, 382,
+1406, 894, 1918, 254, 1278, 766, 1790, 510, 1534, 1022, 2046, 1, 1025, 513,
+1537, 257, 1281, 769, 1793, 129, 1153, 641, 1665, 385, 1409, 897, 1921, 65,
+1089, 577, 1601, 321, 1345, 833, 1857, 193, 1217, 705, 1729, 449, 1473, 961,
+1985, 33, 1057, 545, 1569, 289, 1313, 801, 1825, 161, 1185, 673, 1697, 417,
+1441, 929, 1953, 97, 1121, 609, 1633, 353, 1377, 865, 1889, 225, 1249, 737,
+1761, 481, 1505, 993, 2017, 17, 1041, 529, 1553, 273, 1297, 785, 1809, 145,
+1169, 657, 1681, 401, 1425, 913, 1937, 81, 1105, 593, 1617, 337, 1361, 849,
+1873, 209, 1233, 721, 1745, 465, 1489, 977, 2001, 49, 1073, 561, 1585, 305,
+1329, 817, 1841, 177, 1201, 689, 1713, 433, 1457, 945, 1969, 113, 1137, 625,
+1649, 369, 1393, 881, 1905, 241, 1265, 753, 1777, 497, 1521, 1009, 2033, 9,
+1033, 521, 1545, 265, 1289, 777, 1801, 137, 1161, 649, 1673, 393, 1417, 905,
+1929, 73, 1097, 585, 1609, 329, 1353, 841, 1865, 201, 1225, 713, 1737, 457,
+1481, 969, 1993, 41, 1065, 553, 1577, 297, 1321, 809, 1833, 169, 1193, 681,
+1705, 425, 1449, 937, 1961, 105, 1129, 617, 1641, 361, 1385, 873, 1897, 233,
+1257, 745, 1769, 489, 1513, 1001, 2025, 25, 1049, 537, 1561, 281, 1305, 793,
+1817, 153, 1177, 665, 1689, 409, 1433, 921, 1945, 89, 1113, 601, 1625, 345,
+1369, 857, 1881, 217, 1241, 729, 1753, 473, 1497, 985, 2009, 57, 1081, 569,
+1593, 313, 1337, 825, 1849, 185, 1209, 697, 1721, 441, 1465, 953, 1977, 121,
+1145, 633, 1657, 377, 1401, 889, 1913, 249, 1273, 761, 1785, 505, 1529, 1017,
+2041, 5, 1029, 517, 1541, 261, 1285, 773, 1797, 133, 1157, 645, 1669, 389, 1413,
+901, 1925, 69, 1093, 581, 1605, 325, 1349, 837, 1861, 197, 1221, 709, 1733, 453,
+1477, 965, 1989, 37, 1061, 549, 1573, 293, 1317, 805, 1829, 165, 1189, 677,
+1701, 421, 1445, 933, 1957, 101, 1125, 613, 1637, 357, 1381, 869, 1893, 229,
+1253, 741, 1765, 485, 1509, 997, 2021, 21, 1045, 533, 1557, 277, 1301, 789,
+1813, 149, 1173, 661, 1685, 405, 1429, 917, 1941, 85, 1109, 597, 1621, 341,
+1365, 853, 1877, 213, 1237, 725, 1749, 469, 1493, 981, 2005, 53, 1077, 565,
+1589, 309, 1333, 821, 1845, 181, 1205, 693, 1717, 437, 1461, 949, 1973, 117,
+1141, 629, 1653, 373, 1397, 885, 1909, 245, 1269, 757, 1781, 501, 1525, 1013,
+2037, 13, 1037, 525, 1549, 269, 1293, 781, 1805, 141, 1165, 653, 1677, 397,
+1421, 909, 1933, 77, 1101, 589, 1613, 333, 1357, 845, 1869, 205, 1229, 717,
+1741, 461, 1485, 973, 1997, 45, 1069, 557, 1581, 301, 1325, 813, 1837, 173,
+1197, 685, 1709, 429, 1453, 941, 1965, 109, 1133, 621, 1645, 365, 1389, 877,
+1901, 237, 1261, 749, 1773, 493, 1517, 1005, 2029, 29, 1053, 541, 1565, 285,
+1309, 797, 1821, 157, 1181, 669, 1693, 413, 1437, 925, 1949, 93, 1117, 605,
+1629, 349, 1373, 861, 1885, 221, 1245, 733, 1757, 477, 1501, 989, 2013, 61,
+1085, 573, 1597, 317, 1341, 829, 1853, 189, 1213, 701, 1725, 445, 1469, 957,
+1981, 125, 1149, 637, 1661, 381, 1405, 893, 1917, 253, 1277, 765, 1789, 509,
+1533, 1021, 2045, 3, 1027, 515, 1539, 259, 1283, 771, 1795, 131, 1155, 643,
+1667, 387, 1411, 899, 1923, 67, 1091, 579, 1603, 323, 1347, 835, 1859, 195,
+1219, 707, 1731, 451, 1475, 963, 1987, 35, 1059, 547, 1571, 291, 1315, 803,
+1827, 163, 1187, 675, 1699, 419, 1443, 931, 1955, 99, 1123, 611, 1635, 355,
+1379, 867, 1891, 227, 1251, 739, 1763, 483, 1507, 995, 2019, 19, 1043, 531,
+1555, 275, 1299, 787, 1811, 147, 1171, 659, 1683, 403, 1427, 915, 1939, 83,
+1107, 595, 1619, 339, 1363, 851, 1875, 211, 1235, 723, 1747, 467, 1491, 979,
+2003, 51, 1075, 563, 1587, 307, 1331, 819, 1843, 179, 1203, 691, 1715, 435,
+1459, 947, 1971, 115, 1139, 627, 1651, 371, 1395, 883, 1907, 243, 1267, 755,
+1779, 499, 1523, 1011, 2035, 11, 1035, 523, 1547, 267, 1291, 779, 1803, 139,
+1163, 651, 1675, 395, 1419, 907, 1931, 75, 1099, 587, 1611, 331, 1355, 843,
+1867, 203, 1227, 715, 1739, 459, 1483, 971, 1995, 43, 1067, 555, 1579, 299,
+1323, 811, 1835, 171, 1195, 683, 1707, 427, 1451, 939, 1963, 107, 1131, 619,
+1643, 363, 1387, 875, 1899, 235, 1259, 747, 1771, 491, 1515, 1003, 2027, 27,
+1051, 539, 1563, 283, 1307, 795, 1819, 155, 1179, 667, 1691, 411, 1435, 923,
+1947, 91, 1115, 603, 1627, 347, 1371, 859, 1883, 219, 1243, 731, 1755, 475,
+1499, 987, 2011, 59, 1083, 571, 1595, 315, 1339, 827, 1851, 187, 1211, 699,
+1723, 443, 1467, 955, 1979, 123, 1147, 635, 1659, 379, 1403, 891, 1915, 251,
+1275, 763, 1787, 507, 1531, 1019, 2043, 7, 1031, 519, 1543, 263, 1287, 775,
+1799, 135, 1159, 647, 1671, 391, 1415, 903, 1927, 71, 1095, 583, 1607, 327,
+1351, 839, 1863, 199, 1223, 711, 1735, 455, 1479, 967, 1991, 39, 1063, 551,
+1575, 295, 1319, 807, 1831, 167, 1191, 679, 1703, 423, 1447, 935, 1959, 103,
+1127, 615, 1639, 359, 1383, 871, 1895, 231, 1255, 743, 1767, 487, 1511, 999,
+2023, 23, 1047, 535, 1559, 279, 1303, 791, 1815, 151, 1175, 663, 1687, 407,
+1431, 919, 1943, 87, 1111, 599, 1623, 343, 1367, 855, 1879, 215, 1239, 727,
+1751, 471, 1495, 983, 2007, 55, 1079, 567, 1591, 311, 1335, 823, 1847, 183,
+1207, 695, 1719, 439, 1463, 951, 1975, 119, 1143, 631, 1655, 375, 1399, 887,
+1911, 247, 1271, 759, 1783, 503, 1527, 1015, 2039, 15, 1039, 527, 1551, 271,
+1295, 783, 1807, 143, 1167, 655, 1679, 399, 1423, 911, 1935, 79, 1103, 591,
+1615, 335, 1359, 847, 1871, 207, 1231, 719, 1743, 463, 1487, 975, 1999, 47,
+1071, 559, 1583, 303, 1327, 815, 1839, 175, 1199, 687, 1711, 431, 1455, 943,
+1967, 111, 1135, 623, 1647, 367, 1391, 879, 1903, 239, 1263, 751, 1775, 495,
+1519, 1007, 2031, 31, 1055, 543, 1567, 287, 1311, 799, 1823, 159, 1183, 671,
+1695, 415, 1439, 927, 1951, 95, 1119, 607, 1631, 351, 1375, 863, 1887, 223,
+1247, 735, 1759, 479, 1503, 991, 2015, 63, 1087, 575, 1599, 319, 1343, 831,
+1855, 191, 1215, 703, 1727, 447, 1471, 959, 1983, 127, 1151, 639, 1663, 383,
+1407, 895, 1919, 255, 1279, 767, 1791, 511, 1535, 1023, 2047
+};
+
+const plp_fft_instance_f32 plp_rfft_sR_f32_len2048 = { 2048, 1, (float32_t *)twiddleCoef_rfft_2048,
+                                                       (uint16_t *)bit_rev_radix2_LUT };
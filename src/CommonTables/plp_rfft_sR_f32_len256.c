@@ -0,0 +1,95 @@
+/** ==========================================================================
+ * @file     plp_rfft_sR_f32_len256.c
+ * @brief    Tables and constant instance of the floating-point real FFT of length 256
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_const_structs.h"
+#include "plp_common_tables.h"
+
+/* generated by rfft_twiddles(256), see plp_common_tables.c */
+const Complex_type_f32 twiddleCoef_rfft_256[128] = {
+    {  1.00000000f, -0.00000000f },  {  0.99969882f, -0.02454123f },  {  0.99879546f, -0.04906767f },
+    {  0.99729046f, -0.07356456f },  {  0.99518473f, -0.09801714f },  {  0.99247953f, -0.12241068f },
+    {  0.98917651f, -0.14673047f },  {  0.98527764f, -0.17096189f },  {  0.98078528f, -0.19509032f },
+    {  0.97570213f, -0.21910124f },  {  0.97003125f, -0.24298018f },  {  0.96377607f, -0.26671276f },
+    {  0.95694034f, -0.29028468f },  {  0.94952818f, -0.31368174f },  {  0.94154407f, -0.33688985f },
+    {  0.93299280f, -0.35989504f },  {  0.92387953f, -0.38268343f },  {  0.91420976f, -0.40524131f },
+    {  0.90398929f, -0.42755509f },  {  0.89322430f, -0.44961133f },  {  0.88192126f, -0.47139674f },
+    {  0.87008699f, -0.49289819f },  {  0.85772861f, -0.51410274f },  {  0.84485357f, -0.53499762f },
+    {  0.83146961f, -0.55557023f },  {  0.81758481f, -0.57580819f },  {  0.80320753f, -0.59569930f },
+    {  0.78834643f, -0.61523159f },  {  0.77301045f, -0.63439328f },  {  0.75720885f, -0.65317284f },
+    {  0.74095113f, -0.67155895f },  {  0.72424708f, -0.68954054f },  {  0.70710678f, -0.70710678f },
+    {  0.68954054f, -0.72424708f },  {  0.67155895f, -0.74095113f },  {  0.65317284f, -0.75720885f },
+    {  0.63439328f, -0.77301045f },  {  0.61523159f, -0.78834643f },  {  0.59569930f, -0.80320753f },
+    {  0.57580819f, -0.81758481f },  {  0.55557023f, -0.83146961f },  {  0.53499762f, -0.84485357f },
+    {  0.51410274f, -0.85772861f },  {  0.49289819f, -0.87008699f },  {  0.47139674f, -0.88192126f },
+    {  0.44961133f, -0.89322430f },  {  0.42755509f, -0.90398929f },  {  0.40524131f, -0.91420976f },
+    {  0.38268343f, -0.92387953f },  {  0.35989504f, -0.93299280f },  {  0.33688985f, -0.94154407f },
+    {  0.31368174f, -0.94952818f },  {  0.29028468f, -0.95694034f },  {  0.26671276f, -0.96377607f },
+    {  0.24298018f, -0.97003125f },  {  0.21910124f, -0.97570213f },  {  0.19509032f, -0.98078528f },
+    {  0.17096189f, -0.98527764f },  {  0.14673047f, -0.98917651f },  {  0.12241068f, -0.99247953f },
+    {  0.09801714f, -0.99518473f },  {  0.07356456f, -0.99729046f },  {  0.04906767f, -0.99879546f },
+    {  0.02454123f, -0.99969882f },  {  0.00000000f, -1.00000000f },  { -0.02454123f, -0.99969882f },
+    { -0.04906767f, -0.99879546f },  { -0.07356456f, -0.99729046f },  { -0.09801714f, -0.99518473f },
+    { -0.12241068f, -0.99247953f },  { -0.14673047f, -0.98917651f },  { -0.17096189f, -0.98527764f },
+    { -0.19509032f, -0.98078528f },  { -0.21910124f, -0.97570213f },  { -0.24298018f, -0.97003125f },
+    { -0.26671276f, -0.96377607f },  { -0.29028468f, -0.95694034f },  { -0.31368174f, -0.94952818f },
+    { -0.33688985f, -0.94154407f },  { -0.35989504f, -0.93299280f },  { -0.38268343f, -0.92387953f },
+    { -0.40524131f, -0.91420976f },  { -0.42755509f, -0.90398929f },  { -0.44961133f, -0.89322430f },
+    { -0.47139674f, -0.88192126f },  { -0.49289819f, -0.87008699f },  { -0.51410274f, -0.85772861f },
+    { -0.53499762f, -0.84485357f },  { -0.55557023f, -0.83146961f },  { -0.57580819f, -0.81758481f },
+    { -0.59569930f, -0.80320753f },  { -0.61523159f, -0.78834643f },  { -0.63439328f, -0.77301045f },
+    { -0.65317284f, -0.75720885f },  { -0.67155895f, -0.74095113f },  { -0.68954054f, -0.72424708f },
+    { -0.70710678f, -0.70710678f },  { -0.72424708f, -0.68954054f },  { -0.74095113f, -0.67155895f },
+    { -0.75720885f, -0.65317284f },  { -0.77301045f, -0.63439328f },  { -0.78834643f, -0.61523159f },
+    { -0.80320753f, -0.59569930f },  { -0.81758481f, -0.57580819f },  { -0.83146961f, -0.55557023f },
+    { -0.84485357f, -0.53499762f },  { -0.85772861f, -0.51410274f },  { -0.87008699f, -0.49289819f },
+    { -0.88192126f, -0.47139674f },  { -0.89322430f, -0.44961133f },  { -0.90398929f, -0.42755509f },
+    { -0.91420976f, -0.40524131f },  { -0.92387953f, -0.38268343f },  { -0.93299280f, -0.35989504f },
+    { -0.94154407f, -0.33688985f },  { -0.94952818f, -0.31368174f },  { -0.95694034f, -0.29028468f },
+    { -0.96377607f, -0.26671276f },  { -0.97003125f, -0.24298018f },  { -0.97570213f, -0.21910124f },
+    { -0.98078528f, -0.19509032f },  { -0.98527764f, -0.17096189f },  { -0.98917651f, -0.14673047f },
+    { -0.99247953f, -0.12241068f },  { -0.99518473f, -0.09801714f },  { -0.99729046f, -0.07356456f },
+    { -0.99879546f, -0.04906767f },  { -0.99969882f, -0.02454123f }
+};
+
+/* generated by rfft_bit_rev(256), see plp_common_tables.c */
+short bit_rev_radix2_LUT_256[256] = {
+0, 128, 64, 192, 32, 160, 96, 224, 16, 144, 80, 208, 48, 176, 112, 240, 8, 136,
+72, 200, 40, 168, 104, 232, 24, 152, 88, 216, 56, 184, 120, 248, 4, 132, 68,
+196, 36, 164, 100, 228, 20, 148, 84, 212, 52, 180, 116, 244, 12, 140, 76, 204,
+44, 172, 108, 236, 28, 156, 92, 220, 60, 188, 124, 252, 2, 130, 66, 194, 34,
+162, 98, 226, 18, 146, 82, 210, 50, 178, 114, 242, 10, 138, 74, 202, 42, 170,
+106, 234, 26, 154, 90, 218, 58, 186, 122, 250, 6, 134, 70, 198, 38, 166, 102,
+230, 22, 150, 86, 214, 54, 182, 118, 246, 14, 142, 78, 206, 46, 174, 110, 238,
+30, 158, 94, 222, 62, 190, 126, 254, 1, 129, 65, 193, 33, 161, 97, 225, 17, 145,
+81, 209, 49, 177, 113, 241, 9, 137, 73, 201, 41, 169, 105, 233, 25, 153, 89,
+217, 57, 185, 121, 249, 5, 133, 69, 197, 37, 165, 101, 229, 21, 149, 85, 213,
+53, 181, 117, 245, 13, 141, 77, 205, 45, 173, 109, 237, 29, 157, 93, 221, 61,
+189, 125, 253, 3, 131, 67, 195, 35, 163, 99, 227, 19, 147, 83, 211, 51, 179,
+115, 243, 11, 139, 75, 203, 43, 171, 107, 235, 27, 155, 91, 219, 59, 187, 123,
+251, 7, 135, 71, 199, 39, 167, 103, 231, 23, 151, 87, 215, 55, 183, 119, 247,
+15, 143, 79, 207, 47, 175, 111, 239, 31, 159, 95, 223, 63, 191, 127, 255
+};
+
+const plp_fft_instance_f32 plp_rfft_sR_f32_len256 = { 256, 1, (float32_t *)twiddleCoef_rfft_256,
+                                                      (uint16_t *)bit_rev_radix2_LUT_256 };
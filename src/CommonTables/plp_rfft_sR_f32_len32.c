@@ -0,0 +1,45 @@
+/** ==========================================================================
+ * @file     plp_rfft_sR_f32_len32.c
+ * @brief    Tables and constant instance of the floating-point real FFT of length 32
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_const_structs.h"
+#include "plp_common_tables.h"
+
+/* generated by rfft_twiddles(32), see plp_common_tables.c */
+const Complex_type_f32 twiddleCoef_rfft_32[16] = {
+    {  1.00000000f, -0.00000000f },  {  0.98078528f, -0.19509032f },  {  0.92387953f, -0.38268343f },
+    {  0.83146961f, -0.55557023f },  {  0.70710678f, -0.70710678f },  {  0.55557023f, -0.83146961f },
+    {  0.38268343f, -0.92387953f },  {  0.19509032f, -0.98078528f },  {  0.00000000f, -1.00000000f },
+    { -0.19509032f, -0.98078528f },  { -0.38268343f, -0.92387953f },  { -0.55557023f, -0.83146961f },
+    { -0.70710678f, -0.70710678f },  { -0.83146961f, -0.55557023f },  { -0.92387953f, -0.38268343f },
+    { -0.98078528f, -0.19509032f }
+};
+
+/* generated by rfft_bit_rev(32), see plp_common_tables.c */
+short bit_rev_radix2_LUT_32[32] = {
+0, 16, 8, 24, 4, 20, 12, 28, 2, 18, 10, 26, 6, 22, 14, 30, 1, 17, 9, 25, 5, 21,
+13, 29, 3, 19, 11, 27, 7, 23, 15, 31
+};
+
+const plp_fft_instance_f32 plp_rfft_sR_f32_len32 = { 32, 1, (float32_t *)twiddleCoef_rfft_32,
+                                                     (uint16_t *)bit_rev_radix2_LUT_32 };
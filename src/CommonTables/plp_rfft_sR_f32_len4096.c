@@ -0,0 +1,1013 @@
+/** ==========================================================================
+ * @file     plp_rfft_sR_f32_len4096.c
+ * @brief    Tables and constant instance of the floating-point real FFT of length 4096
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_const_structs.h"
+#include "plp_common_tables.h"
+
+/* generated by rfft_twiddles(4096), see plp_common_tables.c */
+const Complex_type_f32 twiddleCoef_rfft_4096[2048] = {
+    {  1.00000000f, -0.00000000f },  {  0.99999882f, -0.00153398f },  {  0.99999529f, -0.00306796f },
+    {  0.99998941f, -0.00460193f },  {  0.99998118f, -0.00613588f },  {  0.99997059f, -0.00766983f },
+    {  0.99995764f, -0.00920375f },  {  0.99994235f, -0.01073766f },  {  0.99992470f, -0.01227154f },
+    {  0.99990470f, -0.01380539f },  {  0.99988235f, -0.01533921f },  {  0.99985764f, -0.01687299f },
+    {  0.99983058f, -0.01840673f },  {  0.99980117f, -0.01994043f },  {  0.99976941f, -0.02147408f },
+    {  0.99973529f, -0.02300768f },  {  0.99969882f, -0.02454123f },  {  0.99966000f, -0.02607472f },
+    {  0.99961882f, -0.02760815f },  {  0.99957530f, -0.02914151f },  {  0.99952942f, -0.03067480f },
+    {  0.99948119f, -0.03220803f },  {  0.99943060f, -0.03374117f },  {  0.99937767f, -0.03527424f },
+    {  0.99932238f, -0.03680722f },  {  0.99926475f, -0.03834012f },  {  0.99920476f, -0.03987293f },
+    {  0.99914242f, -0.04140564f },  {  0.99907773f, -0.04293826f },  {  0.99901069f, -0.04447077f },
+    {  0.99894129f, -0.04600318f },  {  0.99886955f, -0.04753548f },  {  0.99879546f, -0.04906767f },
+    {  0.99871901f, -0.05059975f },  {  0.99864022f, -0.05213170f },  {  0.99855907f, -0.05366354f },
+    {  0.99847558f, -0.05519524f },  {  0.99838974f, -0.05672682f },  {  0.99830154f, -0.05825826f },
+    {  0.99821100f, -0.05978957f },  {  0.99811811f, -0.06132074f },  {  0.99802287f, -0.06285176f },
+    {  0.99792529f, -0.06438263f },  {  0.99782535f, -0.06591335f },  {  0.99772307f, -0.06744392f },
+    {  0.99761844f, -0.06897433f },  {  0.99751146f, -0.07050457f },  {  0.99740213f, -0.07203465f },
+    {  0.99729046f, -0.07356456f },  {  0.99717644f, -0.07509430f },  {  0.99706007f, -0.07662386f },
+    {  0.99694136f, -0.07815324f },  {  0.99682030f, -0.07968244f },  {  0.99669690f, -0.08121145f },
+    {  0.99657115f, -0.08274026f },  {  0.99644305f, -0.08426889f },  {  0.99631261f, -0.08579731f },
+    {  0.99617983f, -0.08732554f },  {  0.99604470f, -0.08885355f },  {  0.99590723f, -0.09038136f },
+    {  0.99576741f, -0.09190896f },  {  0.99562526f, -0.09343634f },  {  0.99548076f, -0.09496350f },
+    {  0.99533391f, -0.09649043f },  {  0.99518473f, -0.09801714f },  {  0.99503320f, -0.09954362f },
+    {  0.99487933f, -0.10106986f },  {  0.99472312f, -0.10259587f },  {  0.99456457f, -0.10412163f },
+    {  0.99440368f, -0.10564715f },  {  0.99424045f, -0.10717242f },  {  0.99407488f, -0.10869744f },
+    {  0.99390697f, -0.11022221f },  {  0.99373672f, -0.11174671f },  {  0.99356414f, -0.11327095f },
+    {  0.99338921f, -0.11479493f },  {  0.99321195f, -0.11631863f },  {  0.99303235f, -0.11784206f },
+    {  0.99285041f, -0.11936521f },  {  0.99266614f, -0.12088809f },  {  0.99247953f, -0.12241068f },
+    {  0.99229059f, -0.12393298f },  {  0.99209931f, -0.12545498f },  {  0.99190570f, -0.12697670f },
+    {  0.99170975f, -0.12849811f },  {  0.99151147f, -0.13001922f },  {  0.99131086f, -0.13154003f },
+    {  0.99110791f, -0.13306053f },  {  0.99090264f, -0.13458071f },  {  0.99069503f, -0.13610058f },
+    {  0.99048508f, -0.13762012f },  {  0.99027281f, -0.13913934f },  {  0.99005821f, -0.14065824f },
+    {  0.98984128f, -0.14217680f },  {  0.98962202f, -0.14369503f },  {  0.98940043f, -0.14521292f },
+    {  0.98917651f, -0.14673047f },  {  0.98895026f, -0.14824768f },  {  0.98872169f, -0.14976453f },
+    {  0.98849079f, -0.15128104f },  {  0.98825757f, -0.15279719f },  {  0.98802202f, -0.15431297f },
+    {  0.98778414f, -0.15582840f },  {  0.98754394f, -0.15734346f },  {  0.98730142f, -0.15885814f },
+    {  0.98705657f, -0.16037246f },  {  0.98680940f, -0.16188639f },  {  0.98655991f, -0.16339995f },
+    {  0.98630810f, -0.16491312f },  {  0.98605396f, -0.16642590f },  {  0.98579751f, -0.16793829f },
+    {  0.98553874f, -0.16945029f },  {  0.98527764f, -0.17096189f },  {  0.98501423f, -0.17247308f },
+    {  0.98474850f, -0.17398387f },  {  0.98448046f, -0.17549425f },  {  0.98421009f, -0.17700422f },
+    {  0.98393741f, -0.17851377f },  {  0.98366242f, -0.18002290f },  {  0.98338511f, -0.18153161f },
+    {  0.98310549f, -0.18303989f },  {  0.98282355f, -0.18454774f },  {  0.98253930f, -0.18605515f },
+    {  0.98225274f, -0.18756213f },  {  0.98196387f, -0.18906866f },  {  0.98167269f, -0.19057475f },
+    {  0.98137919f, -0.19208040f },  {  0.98108339f, -0.19358559f },  {  0.98078528f, -0.19509032f },
+    {  0.98048486f, -0.19659460f },  {  0.98018214f, -0.19809841f },  {  0.97987710f, -0.19960176f },
+    {  0.97956977f, -0.20110463f },  {  0.97926012f, -0.20260704f },  {  0.97894818f, -0.20410897f },
+    {  0.97863392f, -0.20561041f },  {  0.97831737f, -0.20711138f },  {  0.97799851f, -0.20861185f },
+    {  0.97767736f, -0.21011184f },  {  0.97735390f, -0.21161133f },  {  0.97702814f, -0.21311032f },
+    {  0.97670009f, -0.21460881f },  {  0.97636973f, -0.21610680f },  {  0.97603708f, -0.21760427f },
+    {  0.97570213f, -0.21910124f },  {  0.97536489f, -0.22059769f },  {  0.97502535f, -0.22209362f },
+    {  0.97468351f, -0.22358903f },  {  0.97433938f, -0.22508391f },  {  0.97399296f, -0.22657826f },
+    {  0.97364425f, -0.22807208f },  {  0.97329325f, -0.22956537f },  {  0.97293995f, -0.23105811f },
+    {  0.97258437f, -0.23255031f },  {  0.97222650f, -0.23404196f },  {  0.97186634f, -0.23553306f },
+    {  0.97150389f, -0.23702361f },  {  0.97113916f, -0.23851359f },  {  0.97077214f, -0.24000302f },
+    {  0.97040284f, -0.24149189f },  {  0.97003125f, -0.24298018f },  {  0.96965739f, -0.24446790f },
+    {  0.96928124f, -0.24595505f },  {  0.96890280f, -0.24744162f },  {  0.96852209f, -0.24892761f },
+    {  0.96813910f, -0.25041301f },  {  0.96775384f, -0.25189782f },  {  0.96736629f, -0.25338204f },
+    {  0.96697647f, -0.25486566f },  {  0.96658437f, -0.25634868f },  {  0.96619000f, -0.25783110f },
+    {  0.96579336f, -0.25931292f },  {  0.96539444f, -0.26079412f },  {  0.96499325f, -0.26227471f },
+    {  0.96458979f, -0.26375468f },  {  0.96418406f, -0.26523403f },  {  0.96377607f, -0.26671276f },
+    {  0.96336580f, -0.26819086f },  {  0.96295327f, -0.26966833f },  {  0.96253847f, -0.27114516f },
+    {  0.96212140f, -0.27262136f },  {  0.96170208f, -0.27409691f },  {  0.96128049f, -0.27557182f },
+    {  0.96085663f, -0.27704608f },  {  0.96043052f, -0.27851969f },  {  0.96000215f, -0.27999264f },
+    {  0.95957151f, -0.28146494f },  {  0.95913862f, -0.28293657f },  {  0.95870347f, -0.28440754f },
+    {  0.95826607f, -0.28587783f },  {  0.95782641f, -0.28734746f },  {  0.95738450f, -0.28881641f },
+    {  0.95694034f, -0.29028468f },  {  0.95649392f, -0.29175226f },  {  0.95604525f, -0.29321916f },
+    {  0.95559433f, -0.29468537f },  {  0.95514117f, -0.29615089f },  {  0.95468575f, -0.29761571f },
+    {  0.95422810f, -0.29907983f },  {  0.95376819f, -0.30054324f },  {  0.95330604f, -0.30200595f },
+    {  0.95284165f, -0.30346795f },  {  0.95237501f, -0.30492923f },  {  0.95190614f, -0.30638980f },
+    {  0.95143502f, -0.30784964f },  {  0.95096167f, -0.30930876f },  {  0.95048607f, -0.31076715f },
+    {  0.95000825f, -0.31222481f },  {  0.94952818f, -0.31368174f },  {  0.94904588f, -0.31513793f },
+    {  0.94856135f, -0.31659338f },  {  0.94807459f, -0.31804808f },  {  0.94758559f, -0.31950203f },
+    {  0.94709437f, -0.32095523f },  {  0.94660091f, -0.32240768f },  {  0.94610523f, -0.32385937f },
+    {  0.94560733f, -0.32531029f },  {  0.94510719f, -0.32676045f },  {  0.94460484f, -0.32820984f },
+    {  0.94410026f, -0.32965846f },  {  0.94359346f, -0.33110631f },  {  0.94308444f, -0.33255337f },
+    {  0.94257320f, -0.33399965f },  {  0.94205974f, -0.33544515f },  {  0.94154407f, -0.33688985f },
+    {  0.94102618f, -0.33833377f },  {  0.94050607f, -0.33977688f },  {  0.93998375f, -0.34121920f },
+    {  0.93945922f, -0.34266072f },  {  0.93893248f, -0.34410143f },  {  0.93840353f, -0.34554132f },
+    {  0.93787238f, -0.34698041f },  {  0.93733901f, -0.34841868f },  {  0.93680344f, -0.34985613f },
+    {  0.93626567f, -0.35129276f },  {  0.93572569f, -0.35272856f },  {  0.93518351f, -0.35416353f },
+    {  0.93463913f, -0.35559766f },  {  0.93409255f, -0.35703096f },  {  0.93354377f, -0.35846342f },
+    {  0.93299280f, -0.35989504f },  {  0.93243963f, -0.36132581f },  {  0.93188427f, -0.36275572f },
+    {  0.93132671f, -0.36418479f },  {  0.93076696f, -0.36561300f },  {  0.93020502f, -0.36704035f },
+    {  0.92964090f, -0.36846683f },  {  0.92907458f, -0.36989245f },  {  0.92850608f, -0.37131719f },
+    {  0.92793539f, -0.37274107f },  {  0.92736253f, -0.37416406f },  {  0.92678747f, -0.37558618f },
+    {  0.92621024f, -0.37700741f },  {  0.92563083f, -0.37842775f },  {  0.92504924f, -0.37984721f },
+    {  0.92446547f, -0.38126577f },  {  0.92387953f, -0.38268343f },  {  0.92329142f, -0.38410020f },
+    {  0.92270113f, -0.38551605f },  {  0.92210867f, -0.38693101f },  {  0.92151404f, -0.38834505f },
+    {  0.92091724f, -0.38975817f },  {  0.92031828f, -0.39117038f },  {  0.91971715f, -0.39258167f },
+    {  0.91911385f, -0.39399204f },  {  0.91850839f, -0.39540148f },  {  0.91790078f, -0.39680999f },
+    {  0.91729100f, -0.39821756f },  {  0.91667906f, -0.39962420f },  {  0.91606497f, -0.40102990f },
+    {  0.91544872f, -0.40243465f },  {  0.91483031f, -0.40383846f },  {  0.91420976f, -0.40524131f },
+    {  0.91358705f, -0.40664322f },  {  0.91296219f, -0.40804416f },  {  0.91233518f, -0.40944415f },
+    {  0.91170603f, -0.41084317f },  {  0.91107473f, -0.41224123f },  {  0.91044129f, -0.41363831f },
+    {  0.90980571f, -0.41503442f },  {  0.90916798f, -0.41642956f },  {  0.90852812f, -0.41782372f },
+    {  0.90788612f, -0.41921689f },  {  0.90724198f, -0.42060907f },  {  0.90659570f, -0.42200027f },
+    {  0.90594730f, -0.42339047f },  {  0.90529676f, -0.42477968f },  {  0.90464409f, -0.42616789f },
+    {  0.90398929f, -0.42755509f },  {  0.90333237f, -0.42894129f },  {  0.90267332f, -0.43032648f },
+    {  0.90201214f, -0.43171066f },  {  0.90134885f, -0.43309382f },  {  0.90068343f, -0.43447596f },
+    {  0.90001589f, -0.43585708f },  {  0.89934624f, -0.43723717f },  {  0.89867447f, -0.43861624f },
+    {  0.89800058f, -0.43999427f },  {  0.89732458f, -0.44137127f },  {  0.89664647f, -0.44274723f },
+    {  0.89596625f, -0.44412214f },  {  0.89528392f, -0.44549602f },  {  0.89459949f, -0.44686884f },
+    {  0.89391295f, -0.44824061f },  {  0.89322430f, -0.44961133f },  {  0.89253356f, -0.45098099f },
+    {  0.89184071f, -0.45234959f },  {  0.89114576f, -0.45371712f },  {  0.89044872f, -0.45508359f },
+    {  0.88974959f, -0.45644898f },  {  0.88904836f, -0.45781330f },  {  0.88834503f, -0.45917655f },
+    {  0.88763962f, -0.46053871f },  {  0.88693212f, -0.46189979f },  {  0.88622253f, -0.46325978f },
+    {  0.88551086f, -0.46461869f },  {  0.88479710f, -0.46597650f },  {  0.88408126f, -0.46733321f },
+    {  0.88336334f, -0.46868882f },  {  0.88264334f, -0.47004333f },  {  0.88192126f, -0.47139674f },
+    {  0.88119711f, -0.47274903f },  {  0.88047089f, -0.47410021f },  {  0.87974259f, -0.47545028f },
+    {  0.87901223f, -0.47679923f },  {  0.87827979f, -0.47814706f },  {  0.87754529f, -0.47949376f },
+    {  0.87680872f, -0.48083933f },  {  0.87607009f, -0.48218377f },  {  0.87532940f, -0.48352708f },
+    {  0.87458665f, -0.48486925f },  {  0.87384184f, -0.48621028f },  {  0.87309498f, -0.48755016f },
+    {  0.87234606f, -0.48888890f },  {  0.87159509f, -0.49022648f },  {  0.87084206f, -0.49156292f },
+    {  0.87008699f, -0.49289819f },  {  0.86932987f, -0.49423231f },  {  0.86857071f, -0.49556526f },
+    {  0.86780950f, -0.49689705f },  {  0.86704625f, -0.49822767f },  {  0.86628095f, -0.49955711f },
+    {  0.86551362f, -0.50088538f },  {  0.86474426f, -0.50221247f },  {  0.86397286f, -0.50353838f },
+    {  0.86319942f, -0.50486311f },  {  0.86242396f, -0.50618665f },  {  0.86164646f, -0.50750899f },
+    {  0.86086694f, -0.50883014f },  {  0.86008539f, -0.51015010f },  {  0.85930182f, -0.51146885f },
+    {  0.85851622f, -0.51278640f },  {  0.85772861f, -0.51410274f },  {  0.85693898f, -0.51541788f },
+    {  0.85614733f, -0.51673180f },  {  0.85535366f, -0.51804450f },  {  0.85455799f, -0.51935599f },
+    {  0.85376030f, -0.52066625f },  {  0.85296060f, -0.52197529f },  {  0.85215890f, -0.52328310f },
+    {  0.85135519f, -0.52458968f },  {  0.85054948f, -0.52589503f },  {  0.84974177f, -0.52719913f },
+    {  0.84893206f, -0.52850200f },  {  0.84812034f, -0.52980362f },  {  0.84730664f, -0.53110400f },
+    {  0.84649094f, -0.53240313f },  {  0.84567325f, -0.53370100f },  {  0.84485357f, -0.53499762f },
+    {  0.84403190f, -0.53629298f },  {  0.84320824f, -0.53758708f },  {  0.84238260f, -0.53887991f },
+    {  0.84155498f, -0.54017147f },  {  0.84072537f, -0.54146177f },  {  0.83989379f, -0.54275078f },
+    {  0.83906024f, -0.54403853f },  {  0.83822471f, -0.54532499f },  {  0.83738720f, -0.54661017f },
+    {  0.83654773f, -0.54789406f },  {  0.83570628f, -0.54917666f },  {  0.83486287f, -0.55045797f },
+    {  0.83401750f, -0.55173799f },  {  0.83317016f, -0.55301671f },  {  0.83232087f, -0.55429412f },
+    {  0.83146961f, -0.55557023f },  {  0.83061640f, -0.55684504f },  {  0.82976123f, -0.55811853f },
+    {  0.82890411f, -0.55939071f },  {  0.82804505f, -0.56066158f },  {  0.82718403f, -0.56193112f },
+    {  0.82632106f, -0.56319934f },  {  0.82545615f, -0.56446624f },  {  0.82458930f, -0.56573181f },
+    {  0.82372051f, -0.56699605f },  {  0.82284978f, -0.56825895f },  {  0.82197712f, -0.56952052f },
+    {  0.82110251f, -0.57078075f },  {  0.82022598f, -0.57203963f },  {  0.81934752f, -0.57329717f },
+    {  0.81846713f, -0.57455336f },  {  0.81758481f, -0.57580819f },  {  0.81670057f, -0.57706167f },
+    {  0.81581441f, -0.57831380f },  {  0.81492633f, -0.57956456f },  {  0.81403633f, -0.58081396f },
+    {  0.81314441f, -0.58206199f },  {  0.81225059f, -0.58330865f },  {  0.81135485f, -0.58455394f },
+    {  0.81045720f, -0.58579786f },  {  0.80955764f, -0.58704039f },  {  0.80865618f, -0.58828155f },
+    {  0.80775282f, -0.58952132f },  {  0.80684755f, -0.59075970f },  {  0.80594039f, -0.59199669f },
+    {  0.80503133f, -0.59323230f },  {  0.80412038f, -0.59446650f },  {  0.80320753f, -0.59569930f },
+    {  0.80229280f, -0.59693071f },  {  0.80137617f, -0.59816071f },  {  0.80045766f, -0.59938930f },
+    {  0.79953727f, -0.60061648f },  {  0.79861499f, -0.60184225f },  {  0.79769084f, -0.60306660f },
+    {  0.79676481f, -0.60428953f },  {  0.79583690f, -0.60551104f },  {  0.79490713f, -0.60673113f },
+    {  0.79397548f, -0.60794978f },  {  0.79304196f, -0.60916701f },  {  0.79210658f, -0.61038281f },
+    {  0.79116933f, -0.61159716f },  {  0.79023022f, -0.61281008f },  {  0.78928925f, -0.61402156f },
+    {  0.78834643f, -0.61523159f },  {  0.78740175f, -0.61644017f },  {  0.78645521f, -0.61764731f },
+    {  0.78550683f, -0.61885299f },  {  0.78455660f, -0.62005721f },  {  0.78360452f, -0.62125998f },
+    {  0.78265060f, -0.62246128f },  {  0.78169483f, -0.62366112f },  {  0.78073723f, -0.62485949f },
+    {  0.77977779f, -0.62605639f },  {  0.77881651f, -0.62725182f },  {  0.77785340f, -0.62844577f },
+    {  0.77688847f, -0.62963824f },  {  0.77592170f, -0.63082923f },  {  0.77495311f, -0.63201874f },
+    {  0.77398269f, -0.63320676f },  {  0.77301045f, -0.63439328f },  {  0.77203640f, -0.63557832f },
+    {  0.77106052f, -0.63676186f },  {  0.77008284f, -0.63794390f },  {  0.76910334f, -0.63912444f },
+    {  0.76812203f, -0.64030348f },  {  0.76713891f, -0.64148101f },  {  0.76615399f, -0.64265703f },
+    {  0.76516727f, -0.64383154f },  {  0.76417874f, -0.64500454f },  {  0.76318842f, -0.64617601f },
+    {  0.76219630f, -0.64734597f },  {  0.76120239f, -0.64851440f },  {  0.76020668f, -0.64968131f },
+    {  0.75920919f, -0.65084668f },  {  0.75820991f, -0.65201053f },  {  0.75720885f, -0.65317284f },
+    {  0.75620600f, -0.65433362f },  {  0.75520138f, -0.65549285f },  {  0.75419498f, -0.65665055f },
+    {  0.75318680f, -0.65780669f },  {  0.75217685f, -0.65896129f },  {  0.75116513f, -0.66011434f },
+    {  0.75015165f, -0.66126584f },  {  0.74913639f, -0.66241578f },  {  0.74811938f, -0.66356416f },
+    {  0.74710061f, -0.66471098f },  {  0.74608007f, -0.66585623f },  {  0.74505779f, -0.66699992f },
+    {  0.74403374f, -0.66814204f },  {  0.74300795f, -0.66928259f },  {  0.74198041f, -0.67042156f },
+    {  0.74095113f, -0.67155895f },  {  0.73992010f, -0.67269477f },  {  0.73888732f, -0.67382900f },
+    {  0.73785281f, -0.67496165f },  {  0.73681657f, -0.67609270f },  {  0.73577859f, -0.67722217f },
+    {  0.73473888f, -0.67835004f },  {  0.73369744f, -0.67947632f },  {  0.73265427f, -0.68060100f },
+    {  0.73160938f, -0.68172407f },  {  0.73056277f, -0.68284555f },  {  0.72951444f, -0.68396541f },
+    {  0.72846439f, -0.68508367f },  {  0.72741263f, -0.68620031f },  {  0.72635916f, -0.68731534f },
+    {  0.72530397f, -0.68842875f },  {  0.72424708f, -0.68954054f },  {  0.72318849f, -0.69065071f },
+    {  0.72212819f, -0.69175926f },  {  0.72106620f, -0.69286617f },  {  0.72000251f, -0.69397146f },
+    {  0.71893712f, -0.69507511f },  {  0.71787005f, -0.69617713f },  {  0.71680128f, -0.69727751f },
+    {  0.71573083f, -0.69837625f },  {  0.71465869f, -0.69947334f },  {  0.71358487f, -0.70056879f },
+    {  0.71250937f, -0.70166259f },  {  0.71143220f, -0.70275474f },  {  0.71035335f, -0.70384524f },
+    {  0.70927283f, -0.70493408f },  {  0.70819064f, -0.70602126f },  {  0.70710678f, -0.70710678f },
+    {  0.70602126f, -0.70819064f },  {  0.70493408f, -0.70927283f },  {  0.70384524f, -0.71035335f },
+    {  0.70275474f, -0.71143220f },  {  0.70166259f, -0.71250937f },  {  0.70056879f, -0.71358487f },
+    {  0.69947334f, -0.71465869f },  {  0.69837625f, -0.71573083f },  {  0.69727751f, -0.71680128f },
+    {  0.69617713f, -0.71787005f },  {  0.69507511f, -0.71893712f },  {  0.69397146f, -0.72000251f },
+    {  0.69286617f, -0.72106620f },  {  0.69175926f, -0.72212819f },  {  0.69065071f, -0.72318849f },
+    {  0.68954054f, -0.72424708f },  {  0.68842875f, -0.72530397f },  {  0.68731534f, -0.72635916f },
+    {  0.68620031f, -0.72741263f },  {  0.68508367f, -0.72846439f },  {  0.68396541f, -0.72951444f },
+    {  0.68284555f, -0.73056277f },  {  0.68172407f, -0.73160938f },  {  0.68060100f, -0.73265427f },
+    {  0.67947632f, -0.73369744f },  {  0.67835004f, -0.73473888f },  {  0.67722217f, -0.73577859f },
+    {  0.67609270f, -0.73681657f },  {  0.67496165f, -0.73785281f },  {  0.67382900f, -0.73888732f },
+    {  0.67269477f, -0.73992010f },  {  0.67155895f, -0.74095113f },  {  0.67042156f, -0.74198041f },
+    {  0.66928259f, -0.74300795f },  {  0.66814204f, -0.74403374f },  {  0.66699992f, -0.74505779f },
+    {  0.66585623f, -0.74608007f },  {  0.66471098f, -0.74710061f },  {  0.66356416f, -0.74811938f },
+    {  0.66241578f, -0.74913639f },  {  0.66126584f, -0.75015165f },  {  0.66011434f, -0.75116513f },
+    {  0.65896129f, -0.75217685f },  {  0.65780669f, -0.75318680f },  {  0.65665055f, -0.75419498f },
+    {  0.65549285f, -0.75520138f },  {  0.65433362f, -0.75620600f },  {  0.65317284f, -0.75720885f },
+    {  0.65201053f, -0.75820991f },  {  0.65084668f, -0.75920919f },  {  0.64968131f, -0.76020668f },
+    {  0.64851440f, -0.76120239f },  {  0.64734597f, -0.76219630f },  {  0.64617601f, -0.76318842f },
+    {  0.64500454f, -0.76417874f },  {  0.64383154f, -0.76516727f },  {  0.64265703f, -0.76615399f },
+    {  0.64148101f, -0.76713891f },  {  0.64030348f, -0.76812203f },  {  0.63912444f, -0.76910334f },
+    {  0.63794390f, -0.77008284f },  {  0.63676186f, -0.77106052f },  {  0.63557832f, -0.77203640f },
+    {  0.63439328f, -0.77301045f },  {  0.63320676f, -0.77398269f },  {  0.63201874f, -0.77495311f },
+    {  0.63082923f, -0.77592170f },  {  0.62963824f, -0.77688847f },  {  0.62844577f, -0.77785340f },
+    {  0.62725182f, -0.77881651f },  {  0.62605639f, -0.77977779f },  {  0.62485949f, -0.78073723f },
+    {  0.62366112f, -0.78169483f },  {  0.62246128f, -0.78265060f },  {  0.62125998f, -0.78360452f },
+    {  0.62005721f, -0.78455660f },  {  0.61885299f, -0.78550683f },  {  0.61764731f, -0.78645521f },
+    {  0.61644017f, -0.78740175f },  {  0.61523159f, -0.78834643f },  {  0.61402156f, -0.78928925f },
+    {  0.61281008f, -0.79023022f },  {  0.61159716f, -0.79116933f },  {  0.61038281f, -0.79210658f },
+    {  0.60916701f, -0.79304196f },  {  0.60794978f, -0.79397548f },  {  0.60673113f, -0.79490713f },
+    {  0.60551104f, -0.79583690f },  {  0.60428953f, -0.79676481f },  {  0.60306660f, -0.79769084f },
+    {  0.60184225f, -0.79861499f },  {  0.60061648f, -0.79953727f },  {  0.59938930f, -0.80045766f },
+    {  0.59816071f, -0.80137617f },  {  0.59693071f, -0.80229280f },  {  0.59569930f, -0.80320753f },
+    {  0.59446650f, -0.80412038f },  {  0.59323230f, -0.80503133f },  {  0.59199669f, -0.80594039f },
+    {  0.59075970f, -0.80684755f },  {  0.58952132f, -0.80775282f },  {  0.58828155f, -0.80865618f },
+    {  0.58704039f, -0.80955764f },  {  0.58579786f, -0.81045720f },  {  0.58455394f, -0.81135485f },
+    {  0.58330865f, -0.81225059f },  {  0.58206199f, -0.81314441f },  {  0.58081396f, -0.81403633f },
+    {  0.57956456f, -0.81492633f },  {  0.57831380f, -0.81581441f },  {  0.57706167f, -0.81670057f },
+    {  0.57580819f, -0.81758481f },  {  0.57455336f, -0.81846713f },  {  0.57329717f, -0.81934752f },
+    {  0.57203963f, -0.82022598f },  {  0.57078075f, -0.82110251f },  {  0.56952052f, -0.82197712f },
+    {  0.56825895f, -0.82284978f },  {  0.56699605f, -0.82372051f },  {  0.56573181f, -0.82458930f },
+    {  0.56446624f, -0.82545615f },  {  0.56319934f, -0.82632106f },  {  0.56193112f, -0.82718403f },
+    {  0.56066158f, -0.82804505f },  {  0.55939071f, -0.82890411f },  {  0.55811853f, -0.82976123f },
+    {  0.55684504f, -0.83061640f },  {  0.55557023f, -0.83146961f },  {  0.55429412f, -0.83232087f },
+    {  0.55301671f, -0.83317016f },  {  0.55173799f, -0.83401750f },  {  0.55045797f, -0.83486287f },
+    {  0.54917666f, -0.83570628f },  {  0.54789406f, -0.83654773f },  {  0.54661017f, -0.83738720f },
+    {  0.54532499f, -0.83822471f },  {  0.54403853f, -0.83906024f },  {  0.54275078f, -0.83989379f },
+    {  0.54146177f, -0.84072537f },  {  0.54017147f, -0.84155498f },  {  0.53887991f, -0.84238260f },
+    {  0.53758708f, -0.84320824f },  {  0.53629298f, -0.84403190f },  {  0.53499762f, -0.84485357f },
+    {  0.53370100f, -0.84567325f },  {  0.53240313f, -0.84649094f },  {  0.53110400f, -0.84730664f },
+    {  0.52980362f, -0.84812034f },  {  0.52850200f, -0.84893206f },  {  0.52719913f, -0.84974177f },
+    {  0.52589503f, -0.85054948f },  {  0.52458968f, -0.85135519f },  {  0.52328310f, -0.85215890f },
+    {  0.52197529f, -0.85296060f },  {  0.52066625f, -0.85376030f },  {  0.51935599f, -0.85455799f },
+    {  0.51804450f, -0.85535366f },  {  0.51673180f, -0.85614733f },  {  0.51541788f, -0.85693898f },
+    {  0.51410274f, -0.85772861f },  {  0.51278640f, -0.85851622f },  {  0.51146885f, -0.85930182f },
+    {  0.51015010f, -0.86008539f },  {  0.50883014f, -0.86086694f },  {  0.50750899f, -0.86164646f },
+    {  0.50618665f, -0.86242396f },  {  0.50486311f, -0.86319942f },  {  0.50353838f, -0.86397286f },
+    {  0.50221247f, -0.86474426f },  {  0.50088538f, -0.86551362f },  {  0.49955711f, -0.86628095f },
+    {  0.49822767f, -0.86704625f },  {  0.49689705f, -0.86780950f },  {  0.49556526f, -0.86857071f },
+    {  0.49423231f, -0.86932987f },  {  0.49289819f, -0.87008699f },  {  0.49156292f, -0.87084206f },
+    {  0.49022648f, -0.87159509f },  {  0.48888890f, -0.87234606f },  {  0.48755016f, -0.87309498f },
+    {  0.48621028f, -0.87384184f },  {  0.48486925f, -0.87458665f },  {  0.48352708f, -0.87532940f },
+    {  0.48218377f, -0.87607009f },  {  0.48083933f, -0.87680872f },  {  0.47949376f, -0.87754529f },
+    {  0.47814706f, -0.87827979f },  {  0.47679923f, -0.87901223f },  {  0.47545028f, -0.87974259f },
+    {  0.47410021f, -0.88047089f },  {  0.47274903f, -0.88119711f },  {  0.47139674f, -0.88192126f },
+    {  0.47004333f, -0.88264334f },  {  0.46868882f, -0.88336334f },  {  0.46733321f, -0.88408126f },
+    {  0.46597650f, -0.88479710f },  {  0.46461869f, -0.88551086f },  {  0.46325978f, -0.88622253f },
+    {  0.46189979f, -0.88693212f },  {  0.46053871f, -0.88763962f },  {  0.45917655f, -0.88834503f },
+    {  0.45781330f, -0.88904836f },  {  0.45644898f, -0.88974959f },  {  0.45508359f, -0.89044872f },
+    {  0.45371712f, -0.89114576f },  {  0.45234959f, -0.89184071f },  {  0.45098099f, -0.89253356f },
+    {  0.44961133f, -0.89322430f },  {  0.44824061f, -0.89391295f },  {  0.44686884f, -0.89459949f },
+    {  0.44549602f, -0.89528392f },  {  0.44412214f, -0.89596625f },  {  0.44274723f, -0.89664647f },
+    {  0.44137127f, -0.89732458f },  {  0.43999427f, -0.89800058f },  {  0.43861624f, -0.89867447f },
+    {  0.43723717f, -0.89934624f },  {  0.43585708f, -0.90001589f },  {  0.43447596f, -0.90068343f },
+    {  0.43309382f, -0.90134885f },  {  0.43171066f, -0.90201214f },  {  0.43032648f, -0.90267332f },
+    {  0.42894129f, -0.90333237f },  {  0.42755509f, -0.90398929f },  {  0.42616789f, -0.90464409f },
+    {  0.42477968f, -0.90529676f },  {  0.42339047f, -0.90594730f },  {  0.42200027f, -0.90659570f },
+    {  0.42060907f, -0.90724198f },  {  0.41921689f, -0.90788612f },  {  0.41782372f, -0.90852812f },
+    {  0.41642956f, -0.90916798f },  {  0.41503442f, -0.90980571f },  {  0.41363831f, -0.91044129f },
+    {  0.41224123f, -0.91107473f },  {  0.41084317f, -0.91170603f },  {  0.40944415f, -0.91233518f },
+    {  0.40804416f, -0.91296219f },  {  0.40664322f, -0.91358705f },  {  0.40524131f, -0.91420976f },
+    {  0.40383846f, -0.91483031f },  {  0.40243465f, -0.91544872f },  {  0.40102990f, -0.91606497f },
+    {  0.39962420f, -0.91667906f },  {  0.39821756f, -0.91729100f },  {  0.39680999f, -0.91790078f },
+    {  0.39540148f, -0.91850839f },  {  0.39399204f, -0.91911385f },  {  0.39258167f, -0.91971715f },
+    {  0.39117038f, -0.92031828f },  {  0.38975817f, -0.92091724f },  {  0.38834505f, -0.92151404f },
+    {  0.38693101f, -0.92210867f },  {  0.38551605f, -0.92270113f },  {  0.38410020f, -0.92329142f },
+    {  0.38268343f, -0.92387953f },  {  0.38126577f, -0.92446547f },  {  0.37984721f, -0.92504924f },
+    {  0.37842775f, -0.92563083f },  {  0.37700741f, -0.92621024f },  {  0.37558618f, -0.92678747f },
+    {  0.37416406f, -0.92736253f },  {  0.37274107f, -0.92793539f },  {  0.37131719f, -0.92850608f },
+    {  0.36989245f, -0.92907458f },  {  0.36846683f, -0.92964090f },  {  0.36704035f, -0.93020502f },
+    {  0.36561300f, -0.93076696f },  {  0.36418479f, -0.93132671f },  {  0.36275572f, -0.93188427f },
+    {  0.36132581f, -0.93243963f },  {  0.35989504f, -0.93299280f },  {  0.35846342f, -0.93354377f },
+    {  0.35703096f, -0.93409255f },  {  0.35559766f, -0.93463913f },  {  0.35416353f, -0.93518351f },
+    {  0.35272856f, -0.93572569f },  {  0.35129276f, -0.93626567f },  {  0.34985613f, -0.93680344f },
+    {  0.34841868f, -0.93733901f },  {  0.34698041f, -0.93787238f },  {  0.34554132f, -0.93840353f },
+    {  0.34410143f, -0.93893248f },  {  0.34266072f, -0.93945922f },  {  0.34121920f, -0.93998375f },
+    {  0.33977688f, -0.94050607f },  {  0.33833377f, -0.94102618f },  {  0.33688985f, -0.94154407f },
+    {  0.33544515f, -0.94205974f },  {  0.33399965f, -0.94257320f },  {  0.33255337f, -0.94308444f },
+    {  0.33110631f, -0.94359346f },  {  0.32965846f, -0.94410026f },  {  0.32820984f, -0.94460484f },
+    {  0.32676045f, -0.94510719f },  {  0.32531029f, -0.94560733f },  {  0.32385937f, -0.94610523f },
+    {  0.32240768f, -0.94660091f },  {  0.32095523f, -0.94709437f },  {  0.31950203f, -0.94758559f },
+    {  0.31804808f, -0.94807459f },  {  0.31659338f, -0.94856135f },  {  0.31513793f, -0.94904588f },
+    {  0.31368174f, -0.94952818f },  {  0.31222481f, -0.95000825f },  {  0.31076715f, -0.95048607f },
+    {  0.30930876f, -0.95096167f },  {  0.30784964f, -0.95143502f },  {  0.30638980f, -0.95190614f },
+    {  0.30492923f, -0.95237501f },  {  0.30346795f, -0.95284165f },  {  0.30200595f, -0.95330604f },
+    {  0.30054324f, -0.95376819f },  {  0.29907983f, -0.95422810f },  {  0.29761571f, -0.95468575f },
+    {  0.29615089f, -0.95514117f },  {  0.29468537f, -0.95559433f },  {  0.29321916f, -0.95604525f },
+    {  0.29175226f, -0.95649392f },  {  0.29028468f, -0.95694034f },  {  0.28881641f, -0.95738450f },
+    {  0.28734746f, -0.95782641f },  {  0.28587783f, -0.95826607f },  {  0.28440754f, -0.95870347f },
+    {  0.28293657f, -0.95913862f },  {  0.28146494f, -0.95957151f },  {  0.27999264f, -0.96000215f },
+    {  0.27851969f, -0.96043052f },  {  0.27704608f, -0.96085663f },  {  0.27557182f, -0.96128049f },
+    {  0.27409691f, -0.96170208f },  {  0.27262136f, -0.96212140f },  {  0.27114516f, -0.96253847f },
+    {  0.26966833f, -0.96295327f },  {  0.26819086f, -0.96336580f },  {  0.26671276f, -0.96377607f },
+    {  0.26523403f, -0.96418406f },  {  0.26375468f, -0.96458979f },  {  0.26227471f, -0.96499325f },
+    {  0.26079412f, -0.96539444f },  {  0.25931292f, -0.96579336f },  {  0.25783110f, -0.96619000f },
+    {  0.25634868f, -0.96658437f },  {  0.25486566f, -0.96697647f },  {  0.25338204f, -0.96736629f },
+    {  0.25189782f, -0.96775384f },  {  0.25041301f, -0.96813910f },  {  0.24892761f, -0.96852209f },
+    {  0.24744162f, -0.96890280f },  {  0.24595505f, -0.96928124f },  {  0.24446790f, -0.96965739f },
+    {  0.24298018f, -0.97003125f },  {  0.24149189f, -0.97040284f },  {  0.24000302f, -0.97077214f },
+    {  0.23851359f, -0.97113916f },  {  0.23702361f, -0.97150389f },  {  0.23553306f, -0.97186634f },
+    {  0.23404196f, -0.97222650f },  {  0.23255031f, -0.97258437f },  {  0.23105811f, -0.97293995f },
+    {  0.22956537f, -0.97329325f },  {  0.22807208f, -0.97364425f },  {  0.22657826f, -0.97399296f },
+    {  0.22508391f, -0.97433938f },  {  0.22358903f, -0.97468351f },  {  0.22209362f, -0.97502535f },
+    {  0.22059769f, -0.97536489f },  {  0.21910124f, -0.97570213f },  {  0.21760427f, -0.97603708f },
+    {  0.21610680f, -0.97636973f },  {  0.21460881f, -0.97670009f },  {  0.21311032f, -0.97702814f },
+    {  0.21161133f, -0.97735390f },  {  0.21011184f, -0.97767736f },  {  0.20861185f, -0.97799851f },
+    {  0.20711138f, -0.97831737f },  {  0.20561041f, -0.97863392f },  {  0.20410897f, -0.97894818f },
+    {  0.20260704f, -0.97926012f },  {  0.20110463f, -0.97956977f },  {  0.19960176f, -0.97987710f },
+    {  0.19809841f, -0.98018214f },  {  0.19659460f, -0.98048486f },  {  0.19509032f, -0.98078528f },
+    {  0.19358559f, -0.98108339f },  {  0.19208040f, -0.98137919f },  {  0.19057475f, -0.98167269f },
+    {  0.18906866f, -0.98196387f },  {  0.18756213f, -0.98225274f },  {  0.18605515f, -0.98253930f },
+    {  0.18454774f, -0.98282355f },  {  0.18303989f, -0.98310549f },  {  0.18153161f, -0.98338511f },
+    {  0.18002290f, -0.98366242f },  {  0.17851377f, -0.98393741f },  {  0.17700422f, -0.98421009f },
+    {  0.17549425f, -0.98448046f },  {  0.17398387f, -0.98474850f },  {  0.17247308f, -0.98501423f },
+    {  0.17096189f, -0.98527764f },  {  0.16945029f, -0.98553874f },  {  0.16793829f, -0.98579751f },
+    {  0.16642590f, -0.98605396f },  {  0.16491312f, -0.98630810f },  {  0.16339995f, -0.98655991f },
+    {  0.16188639f, -0.98680940f },  {  0.16037246f, -0.98705657f },  {  0.15885814f, -0.98730142f },
+    {  0.15734346f, -0.98754394f },  {  0.15582840f, -0.98778414f },  {  0.15431297f, -0.98802202f },
+    {  0.15279719f, -0.98825757f },  {  0.15128104f, -0.98849079f },  {  0.14976453f, -0.98872169f },
+    {  0.14824768f, -0.98895026f },  {  0.14673047f, -0.98917651f },  {  0.14521292f, -0.98940043f },
+    {  0.14369503f, -0.98962202f },  {  0.14217680f, -0.98984128f },  {  0.14065824f, -0.99005821f },
+    {  0.13913934f, -0.99027281f },  {  0.13762012f, -0.99048508f },  {  0.13610058f, -0.99069503f },
+    {  0.13458071f, -0.99090264f },  {  0.13306053f, -0.99110791f },  {  0.13154003f, -0.99131086f },
+    {  0.13001922f, -0.99151147f },  {  0.12849811f, -0.99170975f },  {  0.12697670f, -0.99190570f },
+    {  0.12545498f, -0.99209931f },  {  0.12393298f, -0.99229059f },  {  0.12241068f, -0.99247953f },
+    {  0.12088809f, -0.99266614f },  {  0.11936521f, -0.99285041f },  {  0.11784206f, -0.99303235f },
+    {  0.11631863f, -0.99321195f },  {  0.11479493f, -0.99338921f },  {  0.11327095f, -0.99356414f },
+    {  0.11174671f, -0.99373672f },  {  0.11022221f, -0.99390697f },  {  0.10869744f, -0.99407488f },
+    {  0.10717242f, -0.99424045f },  {  0.10564715f, -0.99440368f },  {  0.10412163f, -0.99456457f },
+    {  0.10259587f, -0.99472312f },  {  0.10106986f, -0.99487933f },  {  0.09954362f, -0.99503320f },
+    {  0.09801714f, -0.99518473f },  {  0.09649043f, -0.99533391f },  {  0.09496350f, -0.99548076f },
+    {  0.09343634f, -0.99562526f },  {  0.09190896f, -0.99576741f },  {  0.09038136f, -0.99590723f },
+    {  0.08885355f, -0.99604470f },  {  0.08732554f, -0.99617983f },  {  0.08579731f, -0.99631261f },
+    {  0.08426889f, -0.99644305f },  {  0.08274026f, -0.99657115f },  {  0.08121145f, -0.99669690f },
+    {  0.07968244f, -0.99682030f },  {  0.07815324f, -0.99694136f },  {  0.07662386f, -0.99706007f },
+    {  0.07509430f, -0.99717644f },  {  0.07356456f, -0.99729046f },  {  0.07203465f, -0.99740213f },
+    {  0.07050457f, -0.99751146f },  {  0.06897433f, -0.99761844f },  {  0.06744392f, -0.99772307f },
+    {  0.06591335f, -0.99782535f },  {  0.06438263f, -0.99792529f },  {  0.06285176f, -0.99802287f },
+    {  0.06132074f, -0.99811811f },  {  0.05978957f, -0.99821100f },  {  0.05825826f, -0.99830154f },
+    {  0.05672682f, -0.99838974f },  {  0.05519524f, -0.99847558f },  {  0.05366354f, -0.99855907f },
+    {  0.05213170f, -0.99864022f },  {  0.05059975f, -0.99871901f },  {  0.04906767f, -0.99879546f },
+    {  0.04753548f, -0.99886955f },  {  0.04600318f, -0.99894129f },  {  0.04447077f, -0.99901069f },
+    {  0.04293826f, -0.99907773f },  {  0.04140564f, -0.99914242f },  {  0.03987293f, -0.99920476f },
+    {  0.03834012f, -0.99926475f },  {  0.03680722f, -0.99932238f },  {  0.03527424f, -0.99937767f },
+    {  0.03374117f, -0.99943060f },  {  0.03220803f, -0.99948119f },  {  0.03067480f, -0.99952942f },
+    {  0.02914151f, -0.99957530f },  {  0.02760815f, -0.99961882f },  {  0.02607472f, -0.99966000f },
+    {  0.02454123f, -0.99969882f },  {  0.02300768f, -0.99973529f },  {  0.02147408f, -0.99976941f },
+    {  0.01994043f, -0.99980117f },  {  0.01840673f, -0.99983058f },  {  0.01687299f, -0.99985764f },
+    {  0.01533921f, -0.99988235f },  {  0.01380539f, -0.99990470f },  {  0.01227154f, -0.99992470f },
+    {  0.01073766f, -0.99994235f },  {  0.00920375f, -0.99995764f },  {  0.00766983f, -0.99997059f },
+    {  0.00613588f, -0.99998118f },  {  0.00460193f, -0.99998941f },  {  0.00306796f, -0.99999529f },
+    {  0.00153398f, -0.99999882f },  {  0.00000000f, -1.00000000f },  { -0.00153398f, -0.99999882f },
+    { -0.00306796f, -0.99999529f },  { -0.00460193f, -0.99998941f },  { -0.00613588f, -0.99998118f },
+    { -0.00766983f, -0.99997059f },  { -0.00920375f, -0.99995764f },  { -0.01073766f, -0.99994235f },
+    { -0.01227154f, -0.99992470f },  { -0.01380539f, -0.99990470f },  { -0.01533921f, -0.99988235f },
+    { -0.01687299f, -0.99985764f },  { -0.01840673f, -0.99983058f },  { -0.01994043f, -0.99980117f },
+    { -0.02147408f, -0.99976941f },  { -0.02300768f, -0.99973529f },  { -0.02454123f, -0.99969882f },
+    { -0.02607472f, -0.99966000f },  { -0.02760815f, -0.99961882f },  { -0.02914151f, -0.99957530f },
+    { -0.03067480f, -0.99952942f },  { -0.03220803f, -0.99948119f },  { -0.03374117f, -0.99943060f },
+    { -0.03527424f, -0.99937767f },  { -0.03680722f, -0.99932238f },  { -0.03834012f, -0.99926475f },
+    { -0.03987293f, -0.99920476f },  { -0.04140564f, -0.99914242f },  { -0.04293826f, -0.99907773f },
+    { -0.04447077f, -0.99901069f },  { -0.04600318f, -0.99894129f },  { -0.04753548f, -0.99886955f },
+    { -0.04906767f, -0.99879546f },  { -0.05059975f, -0.99871901f },  { -0.05213170f, -0.99864022f },
+    { -0.05366354f, -0.99855907f },  { -0.05519524f, -0.99847558f },  { -0.05672682f, -0.99838974f },
+    { -0.05825826f, -0.99830154f },  { -0.05978957f, -0.99821100f },  { -0.06132074f, -0.99811811f },
+    { -0.06285176f, -0.99802287f },  { -0.06438263f, -0.99792529f },  { -0.06591335f, -0.99782535f },
+    { -0.06744392f, -0.99772307f },  { -0.06897433f, -0.99761844f },  { -0.07050457f, -0.99751146f },
+    { -0.07203465f, -0.99740213f },  { -0.07356456f, -0.99729046f },  { -0.07509430f, -0.99717644f },
+    { -0.07662386f, -0.99706007f },  { -0.07815324f, -0.99694136f },  { -0.07968244f, -0.99682030f },
+    { -0.08121145f, -0.99669690f },  { -0.08274026f, -0.99657115f },  { -0.08426889f, -0.99644305f },
+    { -0.08579731f, -0.99631261f },  { -0.08732554f, -0.99617983f },  { -0.08885355f, -0.99604470f },
+    { -0.09038136f, -0.99590723f },  { -0.09190896f, -0.99576741f },  { -0.09343634f, -0.99562526f },
+    { -0.09496350f, -0.99548076f },  { -0.09649043f, -0.99533391f },  { -0.09801714f, -0.99518473f },
+    { -0.09954362f, -0.99503320f },  { -0.10106986f, -0.99487933f },  { -0.10259587f, -0.99472312f },
+    { -0.10412163f, -0.99456457f },  { -0.10564715f, -0.99440368f },  { -0.10717242f, -0.99424045f },
+    { -0.10869744f, -0.99407488f },  { -0.11022221f, -0.99390697f },  { -0.11174671f, -0.99373672f },
+    { -0.11327095f, -0.99356414f },  { -0.11479493f, -0.99338921f },  { -0.11631863f, -0.99321195f },
+    { -0.11784206f, -0.99303235f },  { -0.11936521f, -0.99285041f },  { -0.12088809f, -0.99266614f },
+    { -0.12241068f, -0.99247953f },  { -0.12393298f, -0.99229059f },  { -0.12545498f, -0.99209931f },
+    { -0.12697670f, -0.99190570f },  { -0.12849811f, -0.99170975f },  { -0.13001922f, -0.99151147f },
+    { -0.13154003f, -0.99131086f },  { -0.13306053f, -0.99110791f },  { -0.13458071f, -0.99090264f },
+    { -0.13610058f, -0.99069503f },  { -0.13762012f, -0.99048508f },  { -0.13913934f, -0.99027281f },
+    { -0.14065824f, -0.99005821f },  { -0.14217680f, -0.98984128f },  { -0.14369503f, -0.98962202f },
+    { -0.14521292f, -0.98940043f },  { -0.14673047f, -0.98917651f },  { -0.14824768f, -0.98895026f },
+    { -0.14976453f, -0.98872169f },  { -0.15128104f, -0.98849079f },  { -0.15279719f, -0.98825757f },
+    { -0.15431297f, -0.98802202f },  { -0.15582840f, -0.98778414f },  { -0.15734346f, -0.98754394f },
+    { -0.15885814f, -0.98730142f },  { -0.16037246f, -0.98705657f },  { -0.16188639f, -0.98680940f },
+    { -0.16339995f, -0.98655991f },  { -0.16491312f, -0.98630810f },  { -0.16642590f, -0.98605396f },
+    { -0.16793829f, -0.98579751f },  { -0.16945029f, -0.98553874f },  { -0.17096189f, -0.98527764f },
+    { -0.17247308f, -0.98501423f },  { -0.17398387f, -0.98474850f },  { -0.17549425f, -0.98448046f },
+    { -0.17700422f, -0.98421009f },  { -0.17851377f, -0.98393741f },  { -0.18002290f, -0.98366242f },
+    { -0.18153161f, -0.98338511f },  { -0.18303989f, -0.98310549f },  { -0.18454774f, -0.98282355f },
+    { -0.18605515f, -0.98253930f },  { -0.18756213f, -0.98225274f },  { -0.18906866f, -0.98196387f },
+    { -0.19057475f, -0.98167269f },  { -0.19208040f, -0.98137919f },  { -0.19358559f, -0.98108339f },
+    { -0.19509032f, -0.98078528f },  { -0.19659460f, -0.98048486f },  { -0.19809841f, -0.98018214f },
+    { -0.19960176f, -0.97987710f },  { -0.20110463f, -0.97956977f },  { -0.20260704f, -0.97926012f },
+    { -0.20410897f, -0.97894818f },  { -0.20561041f, -0.97863392f },  { -0.20711138f, -0.97831737f },
+    { -0.20861185f, -0.97799851f },  { -0.21011184f, -0.97767736f },  { -0.21161133f, -0.97735390f },
+    { -0.21311032f, -0.97702814f },  { -0.21460881f, -0.97670009f },  { -0.21610680f, -0.97636973f },
+    { -0.21760427f, -0.97603708f },  { -0.21910124f, -0.97570213f },  { -0.22059769f, -0.97536489f },
+    { -0.22209362f, -0.97502535f },  { -0.22358903f, -0.97468351f },  { -0.22508391f, -0.97433938f },
+    { -0.22657826f, -0.97399296f },  { -0.22807208f, -0.97364425f },  { -0.22956537f, -0.97329325f },
+    { -0.23105811f, -0.97293995f },  { -0.23255031f, -0.97258437f },  { -0.23404196f, -0.97222650f },
+    { -0.23553306f, -0.97186634f },  { -0.23702361f, -0.97150389f },  { -0.23851359f, -0.97113916f },
+    { -0.24000302f, -0.97077214f },  { -0.24149189f, -0.97040284f },  { -0.24298018f, -0.97003125f },
+    { -0.24446790f, -0.96965739f },  { -0.24595505f, -0.96928124f },  { -0.24744162f, -0.96890280f },
+    { -0.24892761f, -0.96852209f },  { -0.25041301f, -0.96813910f },  { -0.25189782f, -0.96775384f },
+    { -0.25338204f, -0.96736629f },  { -0.25486566f, -0.96697647f },  { -0.25634868f, -0.96658437f },
+    { -0.25783110f, -0.96619000f },  { -0.25931292f, -0.96579336f },  { -0.26079412f, -0.96539444f },
+    { -0.26227471f, -0.96499325f },  { -0.26375468f, -0.96458979f },  { -0.26523403f, -0.96418406f },
+    { -0.26671276f, -0.96377607f },  { -0.26819086f, -0.96336580f },  { -0.26966833f, -0.96295327f },
+    { -0.27114516f, -0.96253847f },  { -0.27262136f, -0.96212140f },  { -0.27409691f, -0.96170208f },
+    { -0.27557182f, -0.96128049f },  { -0.27704608f, -0.96085663f },  { -0.27851969f, -0.96043052f },
+    { -0.27999264f, -0.96000215f },  { -0.28146494f, -0.95957151f },  { -0.28293657f, -0.95913862f },
+    { -0.28440754f, -0.95870347f },  { -0.28587783f, -0.95826607f },  { -0.28734746f, -0.95782641f },
+    { -0.28881641f, -0.95738450f },  { -0.29028468f, -0.95694034f },  { -0.29175226f, -0.95649392f },
+    { -0.29321916f, -0.95604525f },  { -0.29468537f, -0.95559433f },  { -0.29615089f, -0.95514117f },
+    { -0.29761571f, -0.95468575f },  { -0.29907983f, -0.95422810f },  { -0.30054324f, -0.95376819f },
+    { -0.30200595f, -0.95330604f },  { -0.30346795f, -0.95284165f },  { -0.30492923f, -0.95237501f },
+    { -0.30638980f, -0.95190614f },  { -0.30784964f, -0.95143502f },  { -0.30930876f, -0.95096167f },
+    { -0.31076715f, -0.95048607f },  { -0.31222481f, -0.95000825f },  { -0.31368174f, -0.94952818f },
+    { -0.31513793f, -0.94904588f },  { -0.31659338f, -0.94856135f },  { -0.31804808f, -0.94807459f },
+    { -0.31950203f, -0.94758559f },  { -0.32095523f, -0.94709437f },  { -0.32240768f, -0.94660091f },
+    { -0.32385937f, -0.94610523f },  { -0.32531029f, -0.94560733f },  { -0.32676045f, -0.94510719f },
+    { -0.32820984f, -0.94460484f },  { -0.32965846f, -0.94410026f },  { -0.33110631f, -0.94359346f },
+    { -0.33255337f, -0.94308444f },  { -0.33399965f, -0.94257320f },  { -0.33544515f, -0.94205974f },
+    { -0.33688985f, -0.94154407f },  { -0.33833377f, -0.94102618f },  { -0.33977688f, -0.94050607f },
+    { -0.34121920f, -0.93998375f },  { -0.34266072f, -0.93945922f },  { -0.34410143f, -0.93893248f },
+    { -0.34554132f, -0.93840353f },  { -0.34698041f, -0.93787238f },  { -0.34841868f, -0.93733901f },
+    { -0.34985613f, -0.93680344f },  { -0.35129276f, -0.93626567f },  { -0.35272856f, -0.93572569f },
+    { -0.35416353f, -0.93518351f },  { -0.35559766f, -0.93463913f },  { -0.35703096f, -0.93409255f },
+    { -0.35846342f, -0.93354377f },  { -0.35989504f, -0.93299280f },  { -0.36132581f, -0.93243963f },
+    { -0.36275572f, -0.93188427f },  { -0.36418479f, -0.93132671f },  { -0.36561300f, -0.93076696f },
+    { -0.36704035f, -0.93020502f },  { -0.36846683f, -0.92964090f },  { -0.36989245f, -0.92907458f },
+    { -0.37131719f, -0.92850608f },  { -0.37274107f, -0.92793539f },  { -0.37416406f, -0.92736253f },
+    { -0.37558618f, -0.92678747f },  { -0.37700741f, -0.92621024f },  { -0.37842775f, -0.92563083f },
+    { -0.37984721f, -0.92504924f },  { -0.38126577f, -0.92446547f },  { -0.38268343f, -0.92387953f },
+    { -0.38410020f, -0.92329142f },  { -0.38551605f, -0.92270113f },  { -0.38693101f, -0.92210867f },
+    { -0.38834505f, -0.92151404f },  { -0.38975817f, -0.92091724f },  { -0.39117038f, -0.92031828f },
+    { -0.39258167f, -0.91971715f },  { -0.39399204f, -0.91911385f },  { -0.39540148f, -0.91850839f },
+    { -0.39680999f, -0.91790078f },  { -0.39821756f, -0.91729100f },  { -0.39962420f, -0.91667906f },
+    { -0.40102990f, -0.91606497f },  { -0.40243465f, -0.91544872f },  { -0.40383846f, -0.91483031f },
+    { -0.40524131f, -0.91420976f },  { -0.40664322f, -0.91358705f },  { -0.40804416f, -0.91296219f },
+    { -0.40944415f, -0.91233518f },  { -0.41084317f, -0.91170603f },  { -0.41224123f, -0.91107473f },
+    { -0.41363831f, -0.91044129f },  { -0.41503442f, -0.90980571f },  { -0.41642956f, -0.90916798f },
+    { -0.41782372f, -0.90852812f },  { -0.41921689f, -0.90788612f },  { -0.42060907f, -0.90724198f },
+    { -0.42200027f, -0.90659570f },  { -0.42339047f, -0.90594730f },  { -0.42477968f, -0.90529676f },
+    { -0.42616789f, -0.90464409f },  { -0.42755509f, -0.90398929f },  { -0.42894129f, -0.90333237f },
+    { -0.43032648f, -0.90267332f },  { -0.43171066f, -0.90201214f },  { -0.43309382f, -0.90134885f },
+    { -0.43447596f, -0.90068343f },  { -0.43585708f, -0.90001589f },  { -0.43723717f, -0.89934624f },
+    { -0.43861624f, -0.89867447f },  { -0.43999427f, -0.89800058f },  { -0.44137127f, -0.89732458f },
+    { -0.44274723f, -0.89664647f },  { -0.44412214f, -0.89596625f },  { -0.44549602f, -0.89528392f },
+    { -0.44686884f, -0.89459949f },  { -0.44824061f, -0.89391295f },  { -0.44961133f, -0.89322430f },
+    { -0.45098099f, -0.89253356f },  { -0.45234959f, -0.89184071f },  { -0.45371712f, -0.89114576f },
+    { -0.45508359f, -0.89044872f },  { -0.45644898f, -0.88974959f },  { -0.45781330f, -0.88904836f },
+    { -0.45917655f, -0.88834503f },  { -0.46053871f, -0.88763962f },  { -0.46189979f, -0.88693212f },
+    { -0.46325978f, -0.88622253f },  { -0.46461869f, -0.88551086f },  { -0.46597650f, -0.88479710f },
+    { -0.46733321f, -0.88408126f },  { -0.46868882f, -0.88336334f },  { -0.47004333f, -0.88264334f },
+    { -0.47139674f, -0.88192126f },  { -0.47274903f, -0.88119711f },  { -0.47410021f, -0.88047089f },
+    { -0.47545028f, -0.87974259f },  { -0.47679923f, -0.87901223f },  { -0.47814706f, -0.87827979f },
+    { -0.47949376f, -0.87754529f },  { -0.48083933f, -0.87680872f },  { -0.48218377f, -0.87607009f },
+    { -0.48352708f, -0.87532940f },  { -0.48486925f, -0.87458665f },  { -0.48621028f, -0.87384184f },
+    { -0.48755016f, -0.87309498f },  { -0.48888890f, -0.87234606f },  { -0.49022648f, -0.87159509f },
+    { -0.49156292f, -0.87084206f },  { -0.49289819f, -0.87008699f },  { -0.49423231f, -0.86932987f },
+    { -0.49556526f, -0.86857071f },  { -0.49689705f, -0.86780950f },  { -0.49822767f, -0.86704625f },
+    { -0.49955711f, -0.86628095f },  { -0.50088538f, -0.86551362f },  { -0.50221247f, -0.86474426f },
+    { -0.50353838f, -0.86397286f },  { -0.50486311f, -0.86319942f },  { -0.50618665f, -0.86242396f },
+    { -0.50750899f, -0.86164646f },  { -0.50883014f, -0.86086694f },  { -0.51015010f, -0.86008539f },
+    { -0.51146885f, -0.85930182f },  { -0.51278640f, -0.85851622f },  { -0.51410274f, -0.85772861f },
+    { -0.51541788f, -0.85693898f },  { -0.51673180f, -0.85614733f },  { -0.51804450f, -0.85535366f },
+    { -0.51935599f, -0.85455799f },  { -0.52066625f, -0.85376030f },  { -0.52197529f, -0.85296060f },
+    { -0.52328310f, -0.85215890f },  { -0.52458968f, -0.85135519f },  { -0.52589503f, -0.85054948f },
+    { -0.52719913f, -0.84974177f },  { -0.52850200f, -0.84893206f },  { -0.52980362f, -0.84812034f },
+    { -0.53110400f, -0.84730664f },  { -0.53240313f, -0.84649094f },  { -0.53370100f, -0.84567325f },
+    { -0.53499762f, -0.84485357f },  { -0.53629298f, -0.84403190f },  { -0.53758708f, -0.84320824f },
+    { -0.53887991f, -0.84238260f },  { -0.54017147f, -0.84155498f },  { -0.54146177f, -0.84072537f },
+    { -0.54275078f, -0.83989379f },  { -0.54403853f, -0.83906024f },  { -0.54532499f, -0.83822471f },
+    { -0.54661017f, -0.83738720f },  { -0.54789406f, -0.83654773f },  { -0.54917666f, -0.83570628f },
+    { -0.55045797f, -0.83486287f },  { -0.55173799f, -0.83401750f },  { -0.55301671f, -0.83317016f },
+    { -0.55429412f, -0.83232087f },  { -0.55557023f, -0.83146961f },  { -0.55684504f, -0.83061640f },
+    { -0.55811853f, -0.82976123f },  { -0.55939071f, -0.82890411f },  { -0.56066158f, -0.82804505f },
+    { -0.56193112f, -0.82718403f },  { -0.56319934f, -0.82632106f },  { -0.56446624f, -0.82545615f },
+    { -0.56573181f, -0.82458930f },  { -0.56699605f, -0.82372051f },  { -0.56825895f, -0.82284978f },
+    { -0.56952052f, -0.82197712f },  { -0.57078075f, -0.82110251f },  { -0.57203963f, -0.82022598f },
+    { -0.57329717f, -0.81934752f },  { -0.57455336f, -0.81846713f },  { -0.57580819f, -0.81758481f },
+    { -0.57706167f, -0.81670057f },  { -0.57831380f, -0.81581441f },  { -0.57956456f, -0.81492633f },
+    { -0.58081396f, -0.81403633f },  { -0.58206199f, -0.81314441f },  { -0.58330865f, -0.81225059f },
+    { -0.58455394f, -0.81135485f },  { -0.58579786f, -0.81045720f },  { -0.58704039f, -0.80955764f },
+    { -0.58828155f, -0.80865618f },  { -0.58952132f, -0.80775282f },  { -0.59075970f, -0.80684755f },
+    { -0.59199669f, -0.80594039f },  { -0.59323230f, -0.80503133f },  { -0.59446650f, -0.80412038f },
+    { -0.59569930f, -0.80320753f },  { -0.59693071f, -0.80229280f },  { -0.59816071f, -0.80137617f },
+    { -0.59938930f, -0.80045766f },  { -0.60061648f, -0.79953727f },  { -0.60184225f, -0.79861499f },
+    { -0.60306660f, -0.79769084f },  { -0.60428953f, -0.79676481f },  { -0.60551104f, -0.79583690f },
+    { -0.60673113f, -0.79490713f },  { -0.60794978f, -0.79397548f },  { -0.60916701f, -0.79304196f },
+    { -0.61038281f, -0.79210658f },  { -0.61159716f, -0.79116933f },  { -0.61281008f, -0.79023022f },
+    { -0.61402156f, -0.78928925f },  { -0.61523159f, -0.78834643f },  { -0.61644017f, -0.78740175f },
+    { -0.61764731f, -0.78645521f },  { -0.61885299f, -0.78550683f },  { -0.62005721f, -0.78455660f },
+    { -0.62125998f, -0.78360452f },  { -0.62246128f, -0.78265060f },  { -0.62366112f, -0.78169483f },
+    { -0.62485949f, -0.78073723f },  { -0.62605639f, -0.77977779f },  { -0.62725182f, -0.77881651f },
+    { -0.62844577f, -0.77785340f },  { -0.62963824f, -0.77688847f },  { -0.63082923f, -0.77592170f },
+    { -0.63201874f, -0.77495311f },  { -0.63320676f, -0.77398269f },  { -0.63439328f, -0.77301045f },
+    { -0.63557832f, -0.77203640f },  { -0.63676186f, -0.77106052f },  { -0.63794390f, -0.77008284f },
+    { -0.63912444f, -0.76910334f },  { -0.64030348f, -0.76812203f },  { -0.64148101f, -0.76713891f },
+    { -0.64265703f, -0.76615399f },  { -0.64383154f, -0.76516727f },  { -0.64500454f, -0.76417874f },
+    { -0.64617601f, -0.76318842f },  { -0.64734597f, -0.76219630f },  { -0.64851440f, -0.76120239f },
+    { -0.64968131f, -0.76020668f },  { -0.65084668f, -0.75920919f },  { -0.65201053f, -0.75820991f },
+    { -0.65317284f, -0.75720885f },  { -0.65433362f, -0.75620600f },  { -0.65549285f, -0.75520138f },
+    { -0.65665055f, -0.75419498f },  { -0.65780669f, -0.75318680f },  { -0.65896129f, -0.75217685f },
+    { -0.66011434f, -0.75116513f },  { -0.66126584f, -0.75015165f },  { -0.66241578f, -0.74913639f },
+    { -0.66356416f, -0.74811938f },  { -0.66471098f, -0.74710061f },  { -0.66585623f, -0.74608007f },
+    { -0.66699992f, -0.74505779f },  { -0.66814204f, -0.74403374f },  { -0.66928259f, -0.74300795f },
+    { -0.67042156f, -0.74198041f },  { -0.67155895f, -0.74095113f },  { -0.67269477f, -0.73992010f },
+    { -0.67382900f, -0.73888732f },  { -0.67496165f, -0.73785281f },  { -0.67609270f, -0.73681657f },
+    { -0.67722217f, -0.73577859f },  { -0.67835004f, -0.73473888f },  { -0.67947632f, -0.73369744f },
+    { -0.68060100f, -0.73265427f },  { -0.68172407f, -0.73160938f },  { -0.68284555f, -0.73056277f },
+    { -0.68396541f, -0.72951444f },  { -0.68508367f, -0.72846439f },  { -0.68620031f, -0.72741263f },
+    { -0.68731534f, -0.72635916f },  { -0.68842875f, -0.72530397f },  { -0.68954054f, -0.72424708f },
+    { -0.69065071f, -0.72318849f },  { -0.69175926f, -0.72212819f },  { -0.69286617f, -0.72106620f },
+    { -0.69397146f, -0.72000251f },  { -0.69507511f, -0.71893712f },  { -0.69617713f, -0.71787005f },
+    { -0.69727751f, -0.71680128f },  { -0.69837625f, -0.71573083f },  { -0.69947334f, -0.71465869f },
+    { -0.70056879f, -0.71358487f },  { -0.70166259f, -0.71250937f },  { -0.70275474f, -0.71143220f },
+    { -0.70384524f, -0.71035335f },  { -0.70493408f, -0.70927283f },  { -0.70602126f, -0.70819064f },
+    { -0.70710678f, -0.70710678f },  { -0.70819064f, -0.70602126f },  { -0.70927283f, -0.70493408f },
+    { -0.71035335f, -0.70384524f },  { -0.71143220f, -0.70275474f },  { -0.71250937f, -0.70166259f },
+    { -0.71358487f, -0.70056879f },  { -0.71465869f, -0.69947334f },  { -0.71573083f, -0.69837625f },
+    { -0.71680128f, -0.69727751f },  { -0.71787005f, -0.69617713f },  { -0.71893712f, -0.69507511f },
+    { -0.72000251f, -0.69397146f },  { -0.72106620f, -0.69286617f },  { -0.72212819f, -0.69175926f },
+    { -0.72318849f, -0.69065071f },  { -0.72424708f, -0.68954054f },  { -0.72530397f, -0.68842875f },
+    { -0.72635916f, -0.68731534f },  { -0.72741263f, -0.68620031f },  { -0.72846439f, -0.68508367f },
+    { -0.72951444f, -0.68396541f },  { -0.73056277f, -0.68284555f },  { -0.73160938f, -0.68172407f },
+    { -0.73265427f, -0.68060100f },  { -0.73369744f, -0.67947632f },  { -0.73473888f, -0.67835004f },
+    { -0.73577859f, -0.67722217f },  { -0.73681657f, -0.67609270f },  { -0.73785281f, -0.67496165f },
+    { -0.73888732f, -0.67382900f },  { -0.73992010f, -0.67269477f },  { -0.74095113f, -0.67155895f },
+    { -0.74198041f, -0.67042156f },  { -0.74300795f, -0.66928259f },  { -0.74403374f, -0.66814204f },
+    { -0.74505779f, -0.66699992f },  { -0.74608007f, -0.66585623f },  { -0.74710061f, -0.66471098f },
+    { -0.74811938f, -0.66356416f },  { -0.74913639f, -0.66241578f },  { -0.75015165f, -0.66126584f },
+    { -0.75116513f, -0.66011434f },  { -0.75217685f, -0.65896129f },  { -0.75318680f, -0.65780669f },
+    { -0.75419498f, -0.65665055f },  { -0.75520138f, -0.65549285f },  { -0.75620600f, -0.65433362f },
+    { -0.75720885f, -0.65317284f },  { -0.75820991f, -0.65201053f },  { -0.75920919f, -0.65084668f },
+    { -0.76020668f, -0.64968131f },  { -0.76120239f, -0.64851440f },  { -0.76219630f, -0.64734597f },
+    { -0.76318842f, -0.64617601f },  { -0.76417874f, -0.64500454f },  { -0.76516727f, -0.64383154f },
+    { -0.76615399f, -0.64265703f },  { -0.76713891f, -0.64148101f },  { -0.76812203f, -0.64030348f },
+    { -0.76910334f, -0.63912444f },  { -0.77008284f, -0.63794390f },  { -0.77106052f, -0.63676186f },
+    { -0.77203640f, -0.63557832f },  { -0.77301045f, -0.63439328f },  { -0.77398269f, -0.63320676f },
+    { -0.77495311f, -0.63201874f },  { -0.77592170f, -0.63082923f },  { -0.77688847f, -0.62963824f },
+    { -0.77785340f, -0.62844577f },  { -0.77881651f, -0.62725182f },  { -0.77977779f, -0.62605639f },
+    { -0.78073723f, -0.62485949f },  { -0.78169483f, -0.62366112f },  { -0.78265060f, -0.62246128f },
+    { -0.78360452f, -0.62125998f },  { -0.78455660f, -0.62005721f },  { -0.78550683f, -0.61885299f },
+    { -0.78645521f, -0.61764731f },  { -0.78740175f, -0.61644017f },  { -0.78834643f, -0.61523159f },
+    { -0.78928925f, -0.61402156f },  { -0.79023022f, -0.61281008f },  { -0.79116933f, -0.61159716f },
+    { -0.79210658f, -0.61038281f },  { -0.79304196f, -0.60916701f },  { -0.79397548f, -0.60794978f },
+    { -0.79490713f, -0.60673113f },  { -0.79583690f, -0.60551104f },  { -0.79676481f, -0.60428953f },
+    { -0.79769084f, -0.60306660f },  { -0.79861499f, -0.60184225f },  { -0.79953727f, -0.60061648f },
+    { -0.80045766f, -0.59938930f },  { -0.80137617f, -0.59816071f },  { -0.80229280f, -0.59693071f },
+    { -0.80320753f, -0.59569930f },  { -0.80412038f, -0.59446650f },  { -0.80503133f, -0.59323230f },
+    { -0.80594039f, -0.59199669f },  { -0.80684755f, -0.59075970f },  { -0.80775282f, -0.58952132f },
+    { -0.80865618f, -0.58828155f },  { -0.80955764f, -0.58704039f },  { -0.81045720f, -0.58579786f },
+    { -0.81135485f, -0.58455394f },  { -0.81225059f, -0.58330865f },  { -0.81314441f, -0.58206199f },
+    { -0.81403633f, -0.58081396f },  { -0.81492633f, -0.57956456f },  { -0.81581441f, -0.57831380f },
+    { -0.81670057f, -0.57706167f },  { -0.81758481f, -0.57580819f },  { -0.81846713f, -0.57455336f },
+    { -0.81934752f, -0.57329717f },  { -0.82022598f, -0.57203963f },  { -0.82110251f, -0.57078075f },
+    { -0.82197712f, -0.56952052f },  { -0.82284978f, -0.56825895f },  { -0.82372051f, -0.56699605f },
+    { -0.82458930f, -0.56573181f },  { -0.82545615f, -0.56446624f },  { -0.82632106f, -0.56319934f },
+    { -0.82718403f, -0.56193112f },  { -0.82804505f, -0.56066158f },  { -0.82890411f, -0.55939071f },
+    { -0.82976123f, -0.55811853f },  { -0.83061640f, -0.55684504f },  { -0.83146961f, -0.55557023f },
+    { -0.83232087f, -0.55429412f },  { -0.83317016f, -0.55301671f },  { -0.83401750f, -0.55173799f },
+    { -0.83486287f, -0.55045797f },  { -0.83570628f, -0.54917666f },  { -0.83654773f, -0.54789406f },
+    { -0.83738720f, -0.54661017f },  { -0.83822471f, -0.54532499f },  { -0.83906024f, -0.54403853f },
+    { -0.83989379f, -0.54275078f },  { -0.84072537f, -0.54146177f },  { -0.84155498f, -0.54017147f },
+    { -0.84238260f, -0.53887991f },  { -0.84320824f, -0.53758708f },  { -0.84403190f, -0.53629298f },
+    { -0.84485357f, -0.53499762f },  { -0.84567325f, -0.53370100f },  { -0.84649094f, -0.53240313f },
+    { -0.84730664f, -0.53110400f },  { -0.84812034f, -0.52980362f },  { -0.84893206f, -0.52850200f },
+    { -0.84974177f, -0.52719913f },  { -0.85054948f, -0.52589503f },  { -0.85135519f, -0.52458968f },
+    { -0.85215890f, -0.52328310f },  { -0.85296060f, -0.52197529f },  { -0.85376030f, -0.52066625f },
+    { -0.85455799f, -0.51935599f },  { -0.85535366f, -0.51804450f },  { -0.85614733f, -0.51673180f },
+    { -0.85693898f, -0.51541788f },  { -0.85772861f, -0.51410274f },  { -0.85851622f, -0.51278640f },
+    { -0.85930182f, -0.51146885f },  { -0.86008539f, -0.51015010f },  { -0.86086694f, -0.50883014f },
+    { -0.86164646f, -0.50750899f },  { -0.86242396f, -0.50618665f },  { -0.86319942f, -0.50486311f },
+    { -0.86397286f, -0.50353838f },  { -0.86474426f, -0.50221247f },  { -0.86551362f, -0.50088538f },
+    { -0.86628095f, -0.49955711f },  { -0.86704625f, -0.49822767f },  { -0.86780950f, -0.49689705f },
+    { -0.86857071f, -0.49556526f },  { -0.86932987f, -0.49423231f },  { -0.87008699f, -0.49289819f },
+    { -0.87084206f, -0.49156292f },  { -0.87159509f, -0.49022648f },  { -0.87234606f, -0.48888890f },
+    { -0.87309498f, -0.48755016f },  { -0.87384184f, -0.48621028f },  { -0.87458665f, -0.48486925f },
+    { -0.87532940f, -0.48352708f },  { -0.87607009f, -0.48218377f },  { -0.87680872f, -0.48083933f },
+    { -0.87754529f, -0.47949376f },  { -0.87827979f, -0.47814706f },  { -0.87901223f, -0.47679923f },
+    { -0.87974259f, -0.47545028f },  { -0.88047089f, -0.47410021f },  { -0.88119711f, -0.47274903f },
+    { -0.88192126f, -0.47139674f },  { -0.88264334f, -0.47004333f },  { -0.88336334f, -0.46868882f },
+    { -0.88408126f, -0.46733321f },  { -0.88479710f, -0.46597650f },  { -0.88551086f, -0.46461869f },
+    { -0.88622253f, -0.46325978f },  { -0.88693212f, -0.46189979f },  { -0.88763962f, -0.46053871f },
+    { -0.88834503f, -0.45917655f },  { -0.88904836f, -0.45781330f },  { -0.88974959f, -0.45644898f },
+    { -0.89044872f, -0.45508359f },  { -0.89114576f, -0.45371712f },  { -0.89184071f, -0.45234959f },
+    { -0.89253356f, -0.45098099f },  { -0.89322430f, -0.44961133f },  { -0.89391295f, -0.44824061f },
+    { -0.89459949f, -0.44686884f },  { -0.89528392f, -0.44549602f },  { -0.89596625f, -0.44412214f },
+    { -0.89664647f, -0.44274723f },  { -0.89732458f, -0.44137127f },  { -0.89800058f, -0.43999427f },
+    { -0.89867447f, -0.43861624f },  { -0.89934624f, -0.43723717f },  { -0.90001589f, -0.43585708f },
+    { -0.90068343f, -0.43447596f },  { -0.90134885f, -0.43309382f },  { -0.90201214f, -0.43171066f },
+    { -0.90267332f, -0.43032648f },  { -0.90333237f, -0.42894129f },  { -0.90398929f, -0.42755509f },
+    { -0.90464409f, -0.42616789f },  { -0.90529676f, -0.42477968f },  { -0.90594730f, -0.42339047f },
+    { -0.90659570f, -0.42200027f },  { -0.90724198f, -0.42060907f },  { -0.90788612f, -0.41921689f },
+    { -0.90852812f, -0.41782372f },  { -0.90916798f, -0.41642956f },  { -0.90980571f, -0.41503442f },
+    { -0.91044129f, -0.41363831f },  { -0.91107473f, -0.41224123f },  { -0.91170603f, -0.41084317f },
+    { -0.91233518f, -0.40944415f },  { -0.91296219f, -0.40804416f },  { -0.91358705f, -0.40664322f },
+    { -0.91420976f, -0.40524131f },  { -0.91483031f, -0.40383846f },  { -0.91544872f, -0.40243465f },
+    { -0.91606497f, -0.40102990f },  { -0.91667906f, -0.39962420f },  { -0.91729100f, -0.39821756f },
+    { -0.91790078f, -0.39680999f },  { -0.91850839f, -0.39540148f },  { -0.91911385f, -0.39399204f },
+    { -0.91971715f, -0.39258167f },  { -0.92031828f, -0.39117038f },  { -0.92091724f, -0.38975817f },
+    { -0.92151404f, -0.38834505f },  { -0.92210867f, -0.38693101f },  { -0.92270113f, -0.38551605f },
+    { -0.92329142f, -0.38410020f },  { -0.92387953f, -0.38268343f },  { -0.92446547f, -0.38126577f },
+    { -0.92504924f, -0.37984721f },  { -0.92563083f, -0.37842775f },  { -0.92621024f, -0.37700741f },
+    { -0.92678747f, -0.37558618f },  { -0.92736253f, -0.37416406f },  { -0.92793539f, -0.37274107f },
+    { -0.92850608f, -0.37131719f },  { -0.92907458f, -0.36989245f },  { -0.92964090f, -0.36846683f },
+    { -0.93020502f, -0.36704035f },  { -0.93076696f, -0.36561300f },  { -0.93132671f, -0.36418479f },
+    { -0.93188427f, -0.36275572f },  { -0.93243963f, -0.36132581f },  { -0.93299280f, -0.35989504f },
+    { -0.93354377f, -0.35846342f },  { -0.93409255f, -0.35703096f },  { -0.93463913f, -0.35559766f },
+    { -0.93518351f, -0.35416353f },  { -0.93572569f, -0.35272856f },  { -0.93626567f, -0.35129276f },
+    { -0.93680344f, -0.34985613f },  { -0.93733901f, -0.34841868f },  { -0.93787238f, -0.34698041f },
+    { -0.93840353f, -0.34554132f },  { -0.93893248f, -0.34410143f },  { -0.93945922f, -0.34266072f },
+    { -0.93998375f, -0.34121920f },  { -0.94050607f, -0.33977688f },  { -0.94102618f, -0.33833377f },
+    { -0.94154407f, -0.33688985f },  { -0.94205974f, -0.33544515f },  { -0.94257320f, -0.33399965f },
+    { -0.94308444f, -0.33255337f },  { -0.94359346f, -0.33110631f },  { -0.94410026f, -0.32965846f },
+    { -0.94460484f, -0.32820984f },  { -0.94510719f, -0.32676045f },  { -0.94560733f, -0.32531029f },
+    { -0.94610523f, -0.32385937f },  { -0.94660091f, -0.32240768f },  { -0.94709437f, -0.32095523f },
+    { -0.94758559f, -0.31950203f },  { -0.94807459f, -0.31804808f },  { -0.94856135f, -0.31659338f },
+    { -0.94904588f, -0.31513793f },  { -0.94952818f, -0.31368174f },  { -0.95000825f, -0.31222481f },
+    { -0.95048607f, -0.31076715f },  { -0.95096167f, -0.30930876f },  { -0.95143502f, -0.30784964f },
+    { -0.95190614f, -0.30638980f },  { -0.95237501f, -0.30492923f },  { -0.95284165f, -0.30346795f },
+    { -0.95330604f, -0.30200595f },  { -0.95376819f, -0.30054324f },  { -0.95422810f, -0.29907983f },
+    { -0.95468575f, -0.29761571f },  { -0.95514117f, -0.29615089f },  { -0.95559433f, -0.29468537f },
+    { -0.95604525f, -0.29321916f },  { -0.95649392f, -0.29175226f },  { -0.95694034f, -0.29028468f },
+    { -0.95738450f, -0.28881641f },  { -0.95782641f, -0.28734746f },  { -0.95826607f, -0.28587783f },
+    { -0.95870347f, -0.28440754f },  { -0.95913862f, -0.28293657f },  { -0.95957151f, -0.28146494f },
+    { -0.96000215f, -0.27999264f },  { -0.96043052f, -0.27851969f },  { -0.96085663f, -0.27704608f },
+    { -0.96128049f, -0.27557182f },  { -0.96170208f, -0.27409691f },  { -0.96212140f, -0.27262136f },
+    { -0.96253847f, -0.27114516f },  { -0.96295327f, -0.26966833f },  { -0.96336580f, -0.26819086f },
+    { -0.96377607f, -0.26671276f },  { -0.96418406f, -0.26523403f },  { -0.96458979f, -0.26375468f },
+    { -0.96499325f, -0.26227471f },  { -0.96539444f, -0.26079412f },  { -0.96579336f, -0.25931292f },
+    { -0.96619000f, -0.25783110f },  { -0.96658437f, -0.25634868f },  { -0.96697647f, -0.25486566f },
+    { -0.96736629f, -0.25338204f },  { -0.96775384f, -0.25189782f },  { -0.96813910f, -0.25041301f },
+    { -0.96852209f, -0.24892761f },  { -0.96890280f, -0.24744162f },  { -0.96928124f, -0.24595505f },
+    { -0.96965739f, -0.24446790f },  { -0.97003125f, -0.24298018f },  { -0.97040284f, -0.24149189f },
+    { -0.97077214f, -0.24000302f },  { -0.97113916f, -0.23851359f },  { -0.97150389f, -0.23702361f },
+    { -0.97186634f, -0.23553306f },  { -0.97222650f, -0.23404196f },  { -0.97258437f, -0.23255031f },
+    { -0.97293995f, -0.23105811f },  { -0.97329325f, -0.22956537f },  { -0.97364425f, -0.22807208f },
+    { -0.97399296f, -0.22657826f },  { -0.97433938f, -0.22508391f },  { -0.97468351f, -0.22358903f },
+    { -0.97502535f, -0.22209362f },  { -0.97536489f, -0.22059769f },  { -0.97570213f, -0.21910124f },
+    { -0.97603708f, -0.21760427f },  { -0.97636973f, -0.21610680f },  { -0.97670009f, -0.21460881f },
+    { -0.97702814f, -0.21311032f },  { -0.97735390f, -0.21161133f },  { -0.97767736f, -0.21011184f },
+    { -0.97799851f, -0.20861185f },  { -0.97831737f, -0.20711138f },  { -0.97863392f, -0.20561041f },
+    { -0.97894818f, -0.20410897f },  { -0.97926012f, -0.20260704f },  { -0.97956977f, -0.20110463f },
+    { -0.97987710f, -0.19960176f },  { -0.98018214f, -0.19809841f },  { -0.98048486f, -0.19659460f },
+    { -0.98078528f, -0.19509032f },  { -0.98108339f, -0.19358559f },  { -0.98137919f, -0.19208040f },
+    { -0.98167269f, -0.19057475f },  { -0.98196387f, -0.18906866f },  { -0.98225274f, -0.18756213f },
+    { -0.98253930f, -0.18605515f },  { -0.98282355f, -0.18454774f },  { -0.98310549f, -0.18303989f },
+    { -0.98338511f, -0.18153161f },  { -0.98366242f, -0.18002290f },  { -0.98393741f, -0.17851377f },
+    { -0.98421009f, -0.17700422f },  { -0.98448046f, -0.17549425f },  { -0.98474850f, -0.17398387f },
+    { -0.98501423f, -0.17247308f },  { -0.98527764f, -0.17096189f },  { -0.98553874f, -0.16945029f },
+    { -0.98579751f, -0.16793829f },  { -0.98605396f, -0.16642590f },  { -0.98630810f, -0.16491312f },
+    { -0.98655991f, -0.16339995f },  { -0.98680940f, -0.16188639f },  { -0.98705657f, -0.16037246f },
+    { -0.98730142f, -0.15885814f },  { -0.98754394f, -0.15734346f },  { -0.98778414f, -0.15582840f },
+    { -0.98802202f, -0.15431297f },  { -0.98825757f, -0.15279719f },  { -0.98849079f, -0.15128104f },
+    { -0.98872169f, -0.14976453f },  { -0.98895026f, -0.14824768f },  { -0.98917651f, -0.14673047f },
+    { -0.98940043f, -0.14521292f },  { -0.98962202f, -0.14369503f },  { -0.98984128f, -0.14217680f },
+    { -0.99005821f, -0.14065824f },  { -0.99027281f, -0.13913934f },  { -0.99048508f, -0.13762012f },
+    { -0.99069503f, -0.13610058f },  { -0.99090264f, -0.13458071f },  { -0.99110791f, -0.13306053f },
+    { -0.99131086f, -0.13154003f },  { -0.99151147f, -0.13001922f },  { -0.99170975f, -0.12849811f },
+    { -0.99190570f, -0.12697670f },  { -0.99209931f, -0.12545498f },  { -0.99229059f, -0.12393298f },
+    { -0.99247953f, -0.12241068f },  { -0.99266614f, -0.12088809f },  { -0.99285041f, -0.11936521f },
+    { -0.99303235f, -0.11784206f },  { -0.99321195f, -0.11631863f },  { -0.99338921f, -0.11479493f },
+    { -0.99356414f, -0.11327095f },  { -0.99373672f, -0.11174671f },  { -0.99390697f, -0.11022221f },
+    { -0.99407488f, -0.10869744f },  { -0.99424045f, -0.10717242f },  { -0.99440368f, -0.10564715f },
+    { -0.99456457f, -0.10412163f },  { -0.99472312f, -0.10259587f },  { -0.99487933f, -0.10106986f },
+    { -0.99503320f, -0.09954362f },  { -0.99518473f, -0.09801714f },  { -0.99533391f, -0.09649043f },
+    { -0.99548076f, -0.09496350f },  { -0.99562526f, -0.09343634f },  { -0.99576741f, -0.09190896f },
+    { -0.99590723f, -0.09038136f },  { -0.99604470f, -0.08885355f },  { -0.99617983f, -0.08732554f },
+    { -0.99631261f, -0.08579731f },  { -0.99644305f, -0.08426889f },  { -0.99657115f, -0.08274026f },
+    { -0.99669690f, -0.08121145f },  { -0.99682030f, -0.07968244f },  { -0.99694136f, -0.07815324f },
+    { -0.99706007f, -0.07662386f },  { -0.99717644f, -0.07509430f },  { -0.99729046f, -0.07356456f },
+    { -0.99740213f, -0.07203465f },  { -0.99751146f, -0.07050457f },  { -0.99761844f, -0.06897433f },
+    { -0.99772307f, -0.06744392f },  { -0.99782535f, -0.06591335f },  { -0.99792529f, -0.06438263f },
+    { -0.99802287f, -0.06285176f },  { -0.99811811f, -0.06132074f },  { -0.99821100f, -0.05978957f },
+    { -0.99830154f, -0.05825826f },  { -0.99838974f, -0.05672682f },  { -0.99847558f, -0.05519524f },
+    { -0.99855907f, -0.05366354f },  { -0.99864022f, -0.05213170f },  { -0.99871901f, -0.05059975f },
+    { -0.99879546f, -0.04906767f },  { -0.99886955f, -0.04753548f },  { -0.99894129f, -0.04600318f },
+    { -0.99901069f, -0.04447077f },  { -0.99907773f, -0.04293826f },  { -0.99914242f, -0.04140564f },
+    { -0.99920476f, -0.03987293f },  { -0.99926475f, -0.03834012f },  { -0.99932238f, -0.03680722f },
+    { -0.99937767f, -0.03527424f },  { -0.99943060f, -0.03374117f },  { -0.99948119f, -0.03220803f },
+    { -0.99952942f, -0.03067480f },  { -0.99957530f, -0.02914151f },  { -0.99961882f, -0.02760815f },
+    { -0.99966000f, -0.02607472f },  { -0.99969882f, -0.02454123f },  { -0.99973529f, -0.02300768f },
+    { -0.99976941f, -0.02147408f },  { -0.99980117f, -0.01994043f },  { -0.99983058f, -0.01840673f },
+    { -0.99985764f, -0.01687299f },  { -0.99988235f, -0.01533921f },  { -0.99990470f, -0.01380539f },
+    { -0.99992470f, -0.01227154f },  { -0.99994235f, -0.01073766f },  { -0.99995764f, -0.00920375f },
+    { -0.99997059f, -0.00766983f },  { -0.99998118f, -0.00613588f },  { -0.99998941f, -0.00460193f },
+    { -0.99999529f, -0.00306796f },  { -0.99999882f, -0.00153398f }
+};
+
+/* generated by rfft_bit_rev(4096), see plp_common_tables.c */
+short bit_rev_radix2_LUT_4096[4096] = {
+0, 2048, 1024, 3072, 512, 2560, 1536, 3584, 256, 2304, 1280, 3328, 768, 2816,
+1792, 3840, 128, 2176, 1152, 3200, 640, 2688, 1664, 3712, 384, 2432, 1408, 3456,
+896, 2944, 1920, 3968, 64, 2112, 1088, 3136, 576, 2624, 1600, 3648, 320, 2368,
+1344, 3392, 832, 2880, 1856, 3904, 192, 2240, 1216, 3264, 704, 2752, 1728, 3776,
+448, 2496, 1472, 3520, 960, 3008, 1984, 4032, 32, 2080, 1056, 3104, 544, 2592,
+1568, 3616, 288, 2336, 1312, 3360, 800, 2848, 1824, 3872, 160, 2208, 1184, 3232,
+672, 2720, 1696, 3744, 416, 2464, 1440, 3488, 928, 2976, 1952, 4000, 96, 2144,
+1120, 3168, 608, 2656, 1632, 3680, 352, 2400, 1376, 3424, 864, 2912, 1888, 3936,
+224, 2272, 1248, 3296, 736, 2784, 1760, 3808, 480, 2528, 1504, 3552, 992, 3040,
+2016, 4064, 16, 2064, 1040, 3088, 528, 2576, 1552, 3600, 272, 2320, 1296, 3344,
+784, 2832, 1808, 3856, 144, 2192, 1168, 3216, 656, 2704, 1680, 3728, 400, 2448,
+1424, 3472, 912, 2960, 1936, 3984, 80, 2128, 1104, 3152, 592, 2640, 1616, 3664,
+336, 2384, 1360, 3408, 848, 2896, 1872, 3920, 208, 2256, 1232, 3280, 720, 2768,
+1744, 3792, 464, 2512, 1488, 3536, 976, 3024, 2000, 4048, 48, 2096, 1072, 3120,
+560, 2608, 1584, 3632, 304, 2352, 1328, 3376, 816, 2864, 1840, 3888, 176, 2224,
+1200, 3248, 688, 2736, 1712, 3760, 432, 2480, 1456, 3504, 944, 2992, 1968, 4016,
+112, 2160, 1136, 3184, 624, 2672, 1648, 3696, 368, 2416, 1392, 3440, 880, 2928,
+1904, 3952, 240, 2288, 1264, 3312, 752, 2800, 1776, 3824, 496, 2544, 1520, 3568,
+1008, 3056, 2032, 4080, 8, 2056, 1032, 3080, 520, 2568, 1544, 3592, 264, 2312,
+1288, 3336, 776, 2824, 1800, 3848, 136, 2184, 1160, 3208, 648, 2696, 1672, 3720,
+392, 2440, 1416, 3464, 904, 2952, 1928, 3976, 72, 2120, 1096, 3144, 584, 2632,
+1608, 3656, 328, 2376, 1352, 3400, 840, 2888, 1864, 3912, 200, 2248, 1224, 3272,
+712, 2760, 1736, 3784, 456, 2504, 1480, 3528, 968, 3016, 1992, 4040, 40, 2088,
+1064, 3112, 552, 2600, 1576, 3624, 296, 2344, 1320, 3368, 808, 2856, 1832, 3880,
+168, 2216, 1192, 3240, 680, 2728, 1704, 3752, 424, 2472, 1448, 3496, 936, 2984,
+1960, 4008, 104, 2152, 1128, 3176, 616, 2664, 1640, 3688, 360, 2408, 1384, 3432,
+872, 2920, 1896, 3944, 232, 2280, 1256, 3304, 744, 2792, 1768, 3816, 488, 2536,
+1512, 3560, 1000, 3048, 2024, 4072, 24, 2072, 1048, 3096, 536, 2584, 1560, 3608,
+280, 2328, 1304, 3352, 792, 2840, 1816, 3864, 152, 2200, 1176, 3224, 664, 2712,
+1688, 3736, 408, 2456, 1432, 3480, 920, 2968, 1944, 3992, 88, 2136, 1112, 3160,
+600, 2648, 1624, 3672, 344, 2392, 1368, 3416, 856, 2904, 1880, 3928, 216, 2264,
+1240, 3288, 728, 2776, 1752, 3800, 472, 2520, 1496, 3544, 984, 3032, 2008, 4056,
+56, 2104, 1080, 3128, 568, 2616, 1592, 3640, 312, 2360, 1336, 3384, 824, 2872,
+1848, 3896, 184, 2232, 1208, 3256, 696, 2744, 1720, 3768, 440, 2488, 1464, 3512,
+952, 3000, 1976, 4024, 120, 2168, 1144, 3192, 632, 2680, 1656, 3704, 376, 2424,
+1400, 3448, 888, 2936, 1912, 3960, 248, 2296, 1272, 3320, 760, 2808, 1784, 3832,
+504, 2552, 1528, 3576, 1016, 3064, 2040, 4088, 4, 2052, 1028, 3076, 516, 2564,
+1540, 3588, 260, 2308, 1284, 3332, 772, 2820, 1796, 3844, 132, 2180, 1156, 3204,
+644, 2692, 1668, 3716, 388, 2436, 1412, 3460, 900, 2948, 1924, 3972, 68, 2116,
+1092, 3140, 580, 2628, 1604, 3652, 324, 2372, 1348, 3396, 836, 2884, 1860, 3908,
+196, 2244, 1220, 3268, 708, 2756, 1732, 3780, 452, 2500, 1476, 3524, 964, 3012,
+1988, 4036, 36, 2084, 1060, 3108, 548, 2596, 1572, 3620, 292, 2340, 1316, 3364,
+804, 2852, 1828, 3876, 164, 2212, 1188, 3236, 676, 2724, 1700, 3748, 420, 2468,
+1444, 3492, 932, 2980, 1956, 4004, 100, 2148, 1124, 3172, 612, 2660, 1636, 3684,
+356, 2404, 1380, 3428, 868, 2916, 1892, 3940, 228, 2276, 1252, 3300, 740, 2788,
+1764, 3812, 484, 2532, 1508, 3556, 996, 3044, 2020, 4068, 20, 2068, 1044, 3092,
+532, 2580, 1556, 3604, 276, 2324, 1300, 3348, 788, 2836, 1812, 3860, 148, 2196,
+1172, 3220, 660, 2708, 1684, 3732, 404, 2452, 1428, 3476, 916, 2964, 1940, 3988,
+84, 2132, 1108, 3156, 596, 2644, 1620, 3668, 340, 2388, 1364, 3412, 852, 2900,
+1876, 3924, 212, 2260, 1236, 3284, 724, 2772, 1748, 3796, 468, 2516, 1492, 3540,
+980, 3028, 2004, 4052, 52, 2100, 1076, 3124, 564, 2612, 1588, 3636, 308, 2356,
+1332, 3380, 820, 2868, 1844, 3892, 180, 2228, 1204, 3252, 692, 2740, 1716, 3764,
+436, 2484, 1460, 3508, 948, 2996, 1972, 4020, 116, 2164, 1140, 3188, 628, 2676,
+1652, 3700, 372, 2420, 1396, 3444, 884, 2932, 1908, 3956, 244, 2292, 1268, 3316,
+756, 2804, 1780, 3828, 500, 2548, 1524, 3572, 1012, 3060, 2036, 4084, 12, 2060,
+1036, 3084, 524, 2572, 1548, 3596, 268, 2316, 1292, 3340, 780, 2828, 1804, 3852,
+140, 2188, 1164, 3212, 652, 2700, 1676, 3724, 396, 2444, 1420, 3468, 908, 2956,
+1932, 3980, 76, 2124, 1100, 3148, 588, 2636, 1612, 3660, 332, 2380, 1356, 3404,
+844, 2892, 1868, 3916, 204, 2252, 1228, 3276, 716, 2764, 1740, 3788, 460, 2508,
+1484, 3532, 972, 3020, 1996, 4044, 44, 2092, 1068, 3116, 556, 2604, 1580, 3628,
+300, 2348, 1324, 3372, 812, 2860, 1836, 3884, 172, 2220, 1196, 3244, 684, 2732,
+1708, 3756, 428, 2476, 1452, 3500, 940, 2988, 1964, 4012, 108, 2156, 1132, 3180,
+620, 2668, 1644, 3692, 364, 2412, 1388, 3436, 876, 2924, 1900, 3948, 236, 2284,
+1260, 3308, 748, 2796, 1772, 3820, 492, 2540, 1516, 3564, 1004, 3052, 2028,
+4076, 28, 2076, 1052, 3100, 540, 2588, 1564, 3612, 284, 2332, 1308, 3356, 796,
+2844, 1820, 3868, 156, 2204, 1180, 3228, 668, 2716, 1692, 3740, 412, 2460, 1436,
+3484, 924, 2972, 1948, 3996, 92, 2140, 1116, 3164, 604, 2652, 1628, 3676, 348,
+2396, 1372, 3420, 860, 2908, 1884, 3932, 220, 2268, 1244, 3292, 732, 2780, 1756,
+3804, 476, 2524, 1500, 3548, 988, 3036, 2012, 4060, 60, 2108, 1084, 3132, 572,
+2620, 1596, 3644, 316, 2364, 1340, 3388, 828, 2876, 1852, 3900, 188, 2236, 1212,
+3260, 700, 2748, 1724, 3772, 444, 2492, 1468, 3516, 956, 3004, 1980, 4028, 124,
+2172, 1148, 3196, 636, 2684, 1660, 3708, 380, 2428, 1404, 3452, 892, 2940, 1916,
+3964, 252, 2300, 1276, 3324, 764, 2812, 1788, 3836, 508, 2556, 1532, 3580, 1020,
+3068, 2044, 4092, 2, 2050, 1026, 3074, 514, 2562, 1538, 3586, 258, 2306, 1282,
+3330, 770, 2818, 1794, 3842, 130, 2178, 1154, 3202, 642, 2690, 1666, 3714, 386,
+2434, 1410, 3458, 898, 2946, 1922, 3970, 66, 2114, 1090, 3138, 578, 2626, 1602,
+3650, 322, 2370, 1346, 3394, 834, 2882, 1858, 3906, 194, 2242, 1218, 3266, 706,
+2754, 1730, 3778, 450, 2498, 1474, 3522, 962, 3010, 1986, 4034, 34, 2082, 1058,
+3106, 546, 2594, 1570, 3618, 290, 2338, 1314, 3362, 802, 2850, 1826, 3874, 162,
+2210, 1186, 3234, 674, 2722, 1698, 3746, 418, 2466, 1442, 3490, 930, 2978, 1954,
+4002, 98, 2146, 1122, 3170, 610, 2658, 1634, 3682, 354, 2402, 1378, 3426, 866,
+2914, 1890, 3938, 226, 2274, 1250, 3298, 738, 2786, 1762, 3810, 482, 2530, 1506,
+3554, 994, 3042, 2018, 4066, 18, 2066, 1042, 3090, 530, 2578, 1554, 3602, 274,
+2322, 1298, 3346, 786, 2834, 1810, 3858, 146, 2194, 1170, 3218, 658, 2706, 1682,
+3730, 402, 2450, 1426, 3474, 914, 2962, 1938, 3986, 82, 2130, 1106, 3154, 594,
+2642, 1618, 3666, 338, 2386, 1362, 3410, 850, 2898, 1874, 3922, 210, 2258, 1234,
+3282, 722, 2770, 1746, 3794, 466, 2514, 1490, 3538, 978, 3026, 2002, 4050, 50,
+2098, 1074, 3122, 562, 2610, 1586, 3634, 306, 2354, 1330, 3378, 818, 2866, 1842,
+3890, 178, 2226, 1202, 3250, 690, 2738, 1714, 3762, 434, 2482, 1458, 3506, 946,
+2994, 1970, 4018, 114, 2162, 1138, 3186, 626, 2674, 1650, 3698, 370, 2418, 1394,
+3442, 882, 2930, 1906, 3954, 242, 2290, 1266, 3314, 754, 2802, 1778, 3826, 498,
+2546, 1522, 3570, 1010, 3058, 2034, 4082, 10, 2058, 1034, 3082, 522, 2570, 1546,
+3594, 266, 2314, 1290, 3338, 778, 2826, 1802, 3850, 138, 2186, 1162, 3210, 650,
+2698, 1674, 3722, 394, 2442, 1418, 3466, 906, 2954, 1930, 3978, 74, 2122, 1098,
+3146, 586, 2634, 1610, 3658, 330, 2378, 1354, 3402, 842, 2890, 1866, 3914, 202,
+2250, 1226, 3274, 714, 2762, 1738, 3786, 458, 2506, 1482, 3530, 970, 3018, 1994,
+4042, 42, 2090, 1066, 3114, 554, 2602, 1578, 3626, 298, 2346, 1322, 3370, 810,
+2858, 1834, 3882, 170, 2218, 1194, 3242, 682, 2730, 1706, 3754, 426, 2474, 1450,
+3498, 938, 2986, 1962, 4010, 106, 2154, 1130, 3178, 618, 2666, 1642, 3690, 362,
+2410, 1386, 3434, 874, 2922, 1898, 3946, 234, 2282, 1258, 3306, 746, 2794, 1770,
+3818, 490, 2538, 1514, 3562, 1002, 3050, 2026, 4074, 26, 2074, 1050, 3098, 538,
+2586, 1562, 3610, 282, 2330, 1306, 3354, 794, 2842, 1818, 3866, 154, 2202, 1178,
+3226, 666, 2714, 1690, 3738, 410, 2458, 1434, 3482, 922, 2970, 1946, 3994, 90,
+2138, 1114, 3162, 602, 2650, 1626, 3674, 346, 2394, 1370, 3418, 858, 2906, 1882,
+3930, 218, 2266, 1242, 3290, 730, 2778, 1754, 3802, 474, 2522, 1498, 3546, 986,
+3034, 2010, 4058, 58, 2106, 1082, 3130, 570, 2618, 1594, 3642, 314, 2362, 1338,
+3386, 826, 2874, 1850, 3898, 186, 2234, 1210, 3258, 698, 2746, 1722, 3770, 442,
+2490, 1466, 3514, 954, 3002, 1978, 4026, 122, 2170, 1146, 3194, 634, 2682, 1658,
+3706, 378, 2426, 1402, 3450, 890, 2938, 1914, 3962, 250, 2298, 1274, 3322, 762,
+2810, 1786, 3834, 506, 2554, 1530, 3578, 1018, 3066, 2042, 4090, 6, 2054, 1030,
+3078, 518, 2566, 1542, 3590, 262, 2310, 1286, 3334, 774, 2822, 1798, 3846, 134,
+2182, 1158, 3206, 646, 2694, 1670, 3718, 390, 2438, 1414, 3462, 902, 2950, 1926,
+3974, 70, 2118, 1094, 3142, 582, 2630, 1606, 3654, 326, 2374, 1350, 3398, 838,
+2886, 1862, 3910, 198, 2246, 1222, 3270, 710, 2758, 1734, 3782, 454, 2502, 1478,
+3526, 966, 3014, 1990, 4038, 38, 2086, 1062, 3110, 550, 2598, 1574, 3622, 294,
+2342, 1318, 3366, 806, 2854, 1830, 3878, 166, 2214, 1190, 3238, 678, 2726, 1702,
+3750, 422, 2470, 1446, 3494, 934, 2982, 1958, 4006, 102, 2150, 1126, 3174, 614,
+2662, 1638, 3686, 358, 2406, 1382, 3430, 870, 2918, 1894, 3942, 230, 2278, 1254,
+3302, 742, 2790, 1766, 3814, 486, 2534, 1510, 3558, 998, 3046, 2022, 4070, 22,
+2070, 1046, 3094, 534, 2582, 1558, 3606, 278, 2326, 1302, 3350, 790, 2838, 1814,
+3862, 150, 2198, 1174, 3222, 662, 2710, 1686, 3734, 406, 2454, 1430, 3478, 918,
+2966, 1942, 3990, 86, 2134, 1110, 3158, 598, 2646, 1622, 3670, 342, 2390, 1366,
+3414, 854, 2902, 1878, 3926, 214, 2262, 1238, 3286, 726, 2774, 1750, 3798, 470,
+2518, 1494, 3542, 982, 3030, 2006, 4054, 54, 2102, 1078, 3126, 566, 2614, 1590,
+3638, 310, 2358, 1334, 3382, 822, 2870, 1846, 3894, 182, 2230, 1206, 3254, 694,
+2742, 1718, 3766, 438, 2486, 1462, 3510, 950, 2998, 1974, 4022, 118, 2166, 1142,
+3190, 630, 2678, 1654, 3702, 374, 2422, 1398, 3446, 886, 2934, 1910, 3958, 246,
+2294, 1270, 3318, 758, 2806, 1782, 3830, 502, 2550, 1526, 3574, 1014, 3062,
+2038, 4086, 14, 2062, 1038, 3086, 526, 2574, 1550, 3598, 270, 2318, 1294, 3342,
+782, 2830, 1806, 3854, 142, 2190, 1166, 3214, 654, 2702, 1678, 3726, 398, 2446,
+1422, 3470, 910, 2958, 1934, 3982, 78, 2126, 1102, 3150, 590, 2638, 1614, 3662,
+334, 2382, 1358, 3406, 846, 2894, 1870, 3918, 206, 2254, 1230, 3278, 718, 2766,
+1742, 3790, 462, 2510, 1486, 3534, 974, 3022, 1998, 4046, 46, 2094, 1070, 3118,
+558, 2606, 1582, 3630, 302, 2350, 1326, 3374, 814, 2862, 1838, 3886, 174, 2222,
+1198, 3246, 686, 2734, 1710, 3758, 430, 2478, 1454, 3502, 942, 2990, 1966, 4014,
+110, 2158, 1134, 3182, 622, 2670, 1646, 3694, 366, 2414, 1390, 3438, 878, 2926,
+1902, 3950, 238, 2286, 1262, 3310, 750, 2798, 1774, 3822, 494, 2542, 1518, 3566,
+1006, 3054, 2030, 4078, 30, 2078, 1054, 3102, 542, 2590, 1566, 3614, 286, 2334,
+1310, 3358, 798, 2846, 1822, 3870, 158, 2206, 1182, 3230, 670, 2718, 1694, 3742,
+414, 2462, 1438, 3486, 926, 2974, 1950, 3998, 94, 2142, 1118, 3166, 606, 2654,
+1630, 3678, 350, 2398, 1374, 3422, 862, 2910, 1886, 3934, 222, 2270, 1246, 3294,
+734, 2782, 1758, 3806, 478, 2526, 1502, 3550, 990, 3038, 2014, 4062, 62, 2110,
+1086, 3134, 574, 2622, 1598, 3646, 318, 2366, 1342, 3390, 830, 2878, 1854, 3902,
+190, 2238, 1214, 3262, 702, 2750, 1726, 3774, 446, 2494, 1470, 3518, 958, 3006,
+1982, 4030, 126, 2174, 1150, 3198, 638, 2686, 1662, 3710, 382, 2430, 1406, 3454,
+894, 2942, 1918, 3966, 254, 2302, 1278, 3326, 766, 2814, 1790, 3838, 510, 2558,
+1534, 3582, 1022, 3070, 2046, 4094, 1, 2049, 1025, 3073, 513, 2561, 1537, 3585,
+257, 2305, 1281, 3329, 769, 2817, 1793, 3841, 129, 2177, 1153, 3201, 641, 2689,
+1665, 3713, 385, 2433, 1409, 3457, 897, 2945, 1921, 3969, 65, 2113, 1089, 3137,
+577, 2625, 1601, 3649, 321, 2369, 1345, 3393, 833, 2881, 1857, 3905, 193, 2241,
+1217, 3265, 705, 2753, 1729, 3777, 449, 2497, 1473, 3521, 961, 3009, 1985, 4033,
+33, 2081, 1057, 3105, 545, 2593, 1569, 3617, 289, 2337, 1313, 3361, 801, 2849,
+1825, 3873, 161, 2209, 1185, 3233, 673, 2721, 1697, 3745, 417, 2465, 1441, 3489,
+929, 2977, 1953, 4001, 97, 2145, 1121, 3169, 609, 2657, 1633, 3681, 353, 2401,
+1377, 3425, 865, 2913, 1889, 3937, 225, 2273, 1249, 3297, 737, 2785, 1761, 3809,
+481, 2529, 1505, 3553, 993, 3041, 2017, 4065, 17, 2065, 1041, 3089, 529, 2577,
+1553, 3601, 273, 2321, 1297, 3345, 785, 2833, 1809, 3857, 145, 2193, 1169, 3217,
+657, 2705, 1681, 3729, 401, 2449, 1425, 3473, 913, 2961, 1937, 3985, 81, 2129,
+1105, 3153, 593, 2641, 1617, 3665, 337, 2385, 1361, 3409, 849, 2897, 1873, 3921,
+209, 2257, 1233, 3281, 721, 2769, 1745, 3793, 465, 2513, 1489, 3537, 977, 3025,
+2001, 4049, 49, 2097, 1073, 3121, 561, 2609, 1585, 3633, 305, 2353, 1329, 3377,
+817, 2865, 1841, 3889, 177, 2225, 1201, 3249, 689, 2737, 1713, 3761, 433, 2481,
+1457, 3505, 945, 2993, 1969, 4017, 113, 2161, 1137, 3185, 625, 2673, 1649, 3697,
+369, 2417, 1393, 3441, 881, 2929, 1905, 3953, 241, 2289, 1265, 3313, 753, 2801,
+1777, 3825, 497, 2545, 1521, 3569, 1009, 3057, 2033, 4081, 9, 2057, 1033, 3081,
+521, 2569, 1545, 3593, 265, 2313, 1289, 3337, 777, 2825, 1801, 3849, 137, 2185,
+1161, 3209, 649, 2697, 1673, 3721, 393, 2441, 1417, 3465, 905, 2953, 1929, 3977,
+73, 2121, 1097, 3145, 585, 2633, 1609, 3657, 329, 2377, 1353, 3401, 841, 2889,
+1865, 3913, 201, 2249, 1225, 3273, 713, 2761, 1737, 3785, 457, 2505, 1481, 3529,
+969, 3017, 1993, 4041, 41, 2089, 1065, 3113, 553, 2601, 1577, 3625, 297, 2345,
+1321, 3369, 809, 2857, 1833, 3881, 169, 2217, 1193, 3241, 681, 2729, 1705, 3753,
+425, 2473, 1449, 3497, 937, 2985, 1961, 4009, 105, 2153, 1129, 3177, 617, 2665,
+1641, 3689, 361, 2409, 1385, 3433, 873, 2921, 1897, 3945, 233, 2281, 1257, 3305,
+745, 2793, 1769, 3817, 489, 2537, 1513, 3561, 1001, 3049, 2025, 4073, 25, 2073,
+1049, 3097, 537, 2585, 1561, 3609, 281, 2329, 1305, 3353, 793, 2841, 1817, 3865,
+153, 2201, 1177, 3225, 665, 2713, 1689, 3737, 409, 2457, 1433, 3481, 921, 2969,
+1945, 3993, 89, 2137, 1113, 3161, 601, 2649, 1625, 3673, 345, 2393, 1369, 3417,
+857, 2905, 1881, 3929, 217, 2265, 1241, 3289, 729, 2777, 1753, 3801, 473, 2521,
+1497, 3545, 985, 3033, 2009, 4057, 57, 2105, 1081, 3129, 569, 2617, 1593, 3641,
+313, 2361, 1337, 3385, 825, 2873, 1849, 3897, 185, 2233, 1209, 3257, 697, 2745,
+1721, 3769, 441, 2489, 1465, 3513, 953, 3001, 1977, 4025, 121, 2169, 1145, 3193,
+633, 2681, 1657, 3705, 377, 2425, 1401, 3449, 889, 2937, 1913, 3961, 249, 2297,
+1273, 3321, 761, 2809, 1785, 3833, 505, 2553, 1529, 3577, 1017, 3065, 2041,
+4089, 5, 2053, 1029, 3077, 517, 2565, 1541, 3589, 261, 2309, 1285, 3333, 773,
+2821, 1797, 3845, 133, 2181, 1157, 3205, 645, 2693, 1669, 3717, 389, 2437, 1413,
+3461, 901, 2949, 1925, 3973, 69, 2117, 1093, 3141, 581, 2629, 1605, 3653, 325,
+2373, 1349, 3397, 837, 2885, 1861, 3909, 197, 2245, 1221, 3269, 709, 2757, 1733,
+3781, 453, 2501, 1477, 3525, 965, 3013, 1989, 4037, 37, 2085, 1061, 3109, 549,
+2597, 1573, 3621, 293, 2341, 1317, 3365, 805, 2853, 1829, 3877, 165, 2213, 1189,
+3237, 677, 2725, 1701, 3749, 421, 2469, 1445, 3493, 933, 2981, 1957, 4005, 101,
+2149, 1125, 3173, 613, 2661, 1637, 3685, 357, 2405, 1381, 3429, 869, 2917, 1893,
+3941, 229, 2277, 1253, 3301, 741, 2789, 1765, 3813, 485, 2533, 1509, 3557, 997,
+3045, 2021, 4069, 21, 2069, 1045, 3093, 533, 2581, 1557, 3605, 277, 2325, 1301,
+3349, 789, 2837, 1813, 3861, 149, 2197, 1173, 3221, 661, 2709, 1685, 3733, 405,
+2453, 1429, 3477, 917, 2965, 1941, 3989, 85, 2133, 1109, 3157, 597, 2645, 1621,
+3669, 341, 2389, 1365, 3413, 853, 2901, 1877, 3925, 213, 2261, 1237, 3285, 725,
+2773, 1749, 3797, 469, 2517, 1493, 3541, 981, 3029, 2005, 4053, 53, 2101, 1077,
+3125, 565, 2613, 1589, 3637, 309, 2357, 1333, 3381, 821, 2869, 1845, 3893, 181,
+2229, 1205, 3253, 693, 2741, 1717, 3765, 437, 2485, 1461, 3509, 949, 2997, 1973,
+4021, 117, 2165, 1141, 3189, 629, 2677, 1653, 3701, 373, 2421, 1397, 3445, 885,
+2933, 1909, 3957, 245, 2293, 1269, 3317, 757, 2805, 1781, 3829, 501, 2549, 1525,
+3573, 1013, 3061, 2037, 4085, 13, 2061, 1037, 3085, 525, 2573, 1549, 3597, 269,
+2317, 1293, 3341, 781, 2829, 1805, 3853, 141, 2189, 1165, 3213, 653, 2701, 1677,
+3725, 397, 2445, 1421, 3469, 909, 2957, 1933, 3981, 77, 2125, 1101, 3149, 589,
+2637, 1613, 3661, 333, 2381, 1357, 3405, 845, 2893, 1869, 3917, 205, 2253, 1229,
+3277, 717, 2765, 1741, 3789, 461, 2509, 1485, 3533, 973, 3021, 1997, 4045, 45,
+2093, 1069, 3117, 557, 2605, 1581, 3629, 301, 2349, 1325, 3373, 813, 2861, 1837,
+3885, 173, 2221, 1197, 3245, 685, 2733, 1709, 3757, 429, 2477, 1453, 3501, 941,
+2989, 1965, 4013, 109, 2157, 1133, 3181, 621, 2669, 1645, 3693, 365, 2413, 1389,
+3437, 877, 2925, 1901, 3949, 237, 2285, 1261, 3309, 749, 2797, 1773, 3821, 493,
+2541, 1517, 3565, 1005, 3053, 2029, 4077, 29, 2077, 1053, 3101, 541, 2589, 1565,
+3613, 285, 2333, 1309, 3357, 797, 2845, 1821, 3869, 157, 2205, 1181, 3229, 669,
+2717, 1693, 3741, 413, 2461, 1437, 3485, 925, 2973, 1949, 3997, 93, 2141, 1117,
+3165, 605, 2653, 1629, 3677, 349, 2397, 1373, 3421, 861, 2909, 1885, 3933, 221,
+2269, 1245, 3293, 733, 2781, 1757, 3805, 477, 2525, 1501, 3549, 989, 3037, 2013,
+4061, 61, 2109, 1085, 3133, 573, 2621, 1597, 3645, 317, 2365, 1341, 3389, 829,
+2877, 1853, 3901, 189, 2237, 1213, 3261, 701, 2749, 1725, 3773, 445, 2493, 1469,
+3517, 957, 3005, 1981, 4029, 125, 2173, 1149, 3197, 637, 2685, 1661, 3709, 381,
+2429, 1405, 3453, 893, 2941, 1917, 3965, 253, 2301, 1277, 3325, 765, 2813, 1789,
+3837, 509, 2557, 1533, 3581, 1021, 3069, 2045, 4093, 3, 2051, 1027, 3075, 515,
+2563, 1539, 3587, 259, 2307, 1283, 3331, 771, 2819, 1795, 3843, 131, 2179, 1155,
+3203, 643, 2691, 1667, 3715, 387, 2435, 1411, 3459, 899, 2947, 1923, 3971, 67,
+2115, 1091, 3139, 579, 2627, 1603, 3651, 323, 2371, 1347, 3395, 835, 2883, 1859,
+3907, 195, 2243, 1219, 3267, 707, 2755, 1731, 3779, 451, 2499, 1475, 3523, 963,
+3011, 1987, 4035, 35, 2083, 1059, 3107, 547, 2595, 1571, 3619, 291, 2339, 1315,
+3363, 803, 2851, 1827, 3875, 163, 2211, 1187, 3235, 675, 2723, 1699, 3747, 419,
+2467, 1443, 3491, 931, 2979, 1955, 4003, 99, 2147, 1123, 3171, 611, 2659, 1635,
+3683, 355, 2403, 1379, 3427, 867, 2915, 1891, 3939, 227, 2275, 1251, 3299, 739,
+2787, 1763, 3811, 483, 2531, 1507, 3555, 995, 3043, 2019, 4067, 19, 2067, 1043,
+3091, 531, 2579, 1555, 3603, 275, 2323, 1299, 3347, 787, 2835, 1811, 3859, 147,
+2195, 1171, 3219, 659, 2707, 1683, 3731, 403, 2451, 1427, 3475, 915, 2963, 1939,
+3987, 83, 2131, 1107, 3155, 595, 2643, 1619, 3667, 339, 2387, 1363, 3411, 851,
+2899, 1875, 3923, 211, 2259, 1235, 3283, 723, 2771, 1747, 3795, 467, 2515, 1491,
+3539, 979, 3027, 2003, 4051, 51, 2099, 1075, 3123, 563, 2611, 1587, 3635, 307,
+2355, 1331, 3379, 819, 2867, 1843, 3891, 179, 2227, 1203, 3251, 691, 2739, 1715,
+3763, 435, 2483, 1459, 3507, 947, 2995, 1971, 4019, 115, 2163, 1139, 3187, 627,
+2675, 1651, 3699, 371, 2419, 1395, 3443, 883, 2931, 1907, 3955, 243, 2291, 1267,
+3315, 755, 2803, 1779, 3827, 499, 2547, 1523, 3571, 1011, 3059, 2035, 4083, 11,
+2059, 1035, 3083, 523, 2571, 1547, 3595, 267, 2315, 1291, 3339, 779, 2827, 1803,
+3851, 139, 2187, 1163, 3211, 651, 2699, 1675, 3723, 395, 2443, 1419, 3467, 907,
+2955, 1931, 3979, 75, 2123, 1099, 3147, 587, 2635, 1611, 3659, 331, 2379, 1355,
+3403, 843, 2891, 1867, 3915, 203, 2251, 1227, 3275, 715, 2763, 1739, 3787, 459,
+2507, 1483, 3531, 971, 3019, 1995, 4043, 43, 2091, 1067, 3115, 555, 2603, 1579,
+3627, 299, 2347, 1323, 3371, 811, 2859, 1835, 3883, 171, 2219, 1195, 3243, 683,
+2731, 1707, 3755, 427, 2475, 1451, 3499, 939, 2987, 1963, 4011, 107, 2155, 1131,
+3179, 619, 2667, 1643, 3691, 363, 2411, 1387, 3435, 875, 2923, 1899, 3947, 235,
+2283, 1259, 3307, 747, 2795, 1771, 3819, 491, 2539, 1515, 3563, 1003, 3051,
+2027, 4075, 27, 2075, 1051, 3099, 539, 2587, 1563, 3611, 283, 2331, 1307, 3355,
+795, 2843, 1819, 3867, 155, 2203, 1179, 3227, 667, 2715, 1691, 3739, 411, 2459,
+1435, 3483, 923, 2971, 1947, 3995, 91, 2139, 1115, 3163, 603, 2651, 1627, 3675,
+347, 2395, 1371, 3419, 859, 2907, 1883, 3931, 219, 2267, 1243, 3291, 731, 2779,
+1755, 3803, 475, 2523, 1499, 3547, 987, 3035, 2011, 4059, 59, 2107, 1083, 3131,
+571, 2619, 1595, 3643, 315, 2363, 1339, 3387, 827, 2875, 1851, 3899, 187, 2235,
+1211, 3259, 699, 2747, 1723, 3771, 443, 2491, 1467, 3515, 955, 3003, 1979, 4027,
+123, 2171, 1147, 3195, 635, 2683, 1659, 3707, 379, 2427, 1403, 3451, 891, 2939,
+1915, 3963, 251, 2299, 1275, 3323, 763, 2811, 1787, 3835, 507, 2555, 1531, 3579,
+1019, 3067, 2043, 4091, 7, 2055, 1031, 3079, 519, 2567, 1543, 3591, 263, 2311,
+1287, 3335, 775, 2823, 1799, 3847, 135, 2183, 1159, 3207, 647, 2695, 1671, 3719,
+391, 2439, 1415, 3463, 903, 2951, 1927, 3975, 71, 2119, 1095, 3143, 583, 2631,
+1607, 3655, 327, 2375, 1351, 3399, 839, 2887, 1863, 3911, 199, 2247, 1223, 3271,
+711, 2759, 1735, 3783, 455, 2503, 1479, 3527, 967, 3015, 1991, 4039, 39, 2087,
+1063, 3111, 551, 2599, 1575, 3623, 295, 2343, 1319, 3367, 807, 2855, 1831, 3879,
+167, 2215, 1191, 3239, 679, 2727, 1703, 3751, 423, 2471, 1447, 3495, 935, 2983,
+1959, 4007, 103, 2151, 1127, 3175, 615, 2663, 1639, 3687, 359, 2407, 1383, 3431,
+871, 2919, 1895, 3943, 231, 2279, 1255, 3303, 743, 2791, 1767, 3815, 487, 2535,
+1511, 3559, 999, 3047, 2023, 4071, 23, 2071, 1047, 3095, 535, 2583, 1559, 3607,
+279, 2327, 1303, 3351, 791, 2839, 1815, 3863, 151, 2199, 1175, 3223, 663, 2711,
+1687, 3735, 407, 2455, 1431, 3479, 919, 2967, 1943, 3991, 87, 2135, 1111, 3159,
+599, 2647, 1623, 3671, 343, 2391, 1367, 3415, 855, 2903, 1879, 3927, 215, 2263,
+1239, 3287, 727, 2775, 1751, 3799, 471, 2519, 1495, 3543, 983, 3031, 2007, 4055,
+55, 2103, 1079, 3127, 567, 2615, 1591, 3639, 311, 2359, 1335, 3383, 823, 2871,
+1847, 3895, 183, 2231, 1207, 3255, 695, 2743, 1719, 3767, 439, 2487, 1463, 3511,
+951, 2999, 1975, 4023, 119, 2167, 1143, 3191, 631, 2679, 1655, 3703, 375, 2423,
+1399, 3447, 887, 2935, 1911, 3959, 247, 2295, 1271, 3319, 759, 2807, 1783, 3831,
+503, 2551, 1527, 3575, 1015, 3063, 2039, 4087, 15, 2063, 1039, 3087, 527, 2575,
+1551, 3599, 271, 2319, 1295, 3343, 783, 2831, 1807, 3855, 143, 2191, 1167, 3215,
+655, 2703, 1679, 3727, 399, 2447, 1423, 3471, 911, 2959, 1935, 3983, 79, 2127,
+1103, 3151, 591, 2639, 1615, 3663, 335, 2383, 1359, 3407, 847, 2895, 1871, 3919,
+207, 2255, 1231, 3279, 719, 2767, 1743, 3791, 463, 2511, 1487, 3535, 975, 3023,
+1999, 4047, 47, 2095, 1071, 3119, 559, 2607, 1583, 3631, 303, 2351, 1327, 3375,
+815, 2863, 1839, 3887, 175, 2223, 1199, 3247, 687, 2735, 1711, 3759, 431, 2479,
+1455, 3503, 943, 2991, 1967, 4015, 111, 2159, 1135, 3183, 623, 2671, 1647, 3695,
+367, 2415, 1391, 3439, 879, 2927, 1903, 3951, 239, 2287, 1263, 3311, 751, 2799,
+1775, 3823, 495, 2543, 1519, 3567, 1007, 3055, 2031, 4079, 31, 2079, 1055, 3103,
+543, 2591, 1567, 3615, 287, 2335, 1311, 3359, 799, 2847, 1823, 3871, 159, 2207,
+1183, 3231, 671, 2719, 1695, 3743, 415, 2463, 1439, 3487, 927, 2975, 1951, 3999,
+95, 2143, 1119, 3167, 607, 2655, 1631, 3679, 351, 2399, 1375, 3423, 863, 2911,
+1887, 3935, 223, 2271, 1247, 3295, 735, 2783, 1759, 3807, 479, 2527, 1503, 3551,
+991, 3039, 2015, 4063, 63, 2111, 1087, 3135, 575, 2623, 1599, 3647, 319, 2367,
+1343, 3391, 831, 2879, 1855, 3903, 191, 2239, 1215, 3263, 703, 2751, 1727, 3775,
+447, 2495, 1471, 3519, 959, 3007, 1983, 4031, 127, 2175, 1151, 3199, 639, 2687,
+1663, 3711, 383, 2431, 1407, 3455, 895, 2943, 1919, 3967, 255, 2303, 1279, 3327,
+767, 2815, 1791, 3839, 511, 2559, 1535, 3583, 1023, 3071, 2047, 4095
+};
+
+const plp_fft_instance_f32 plp_rfft_sR_f32_len4096 = { 4096, 1, (float32_t *)twiddleCoef_rfft_4096,
+                                                       (uint16_t *)bit_rev_radix2_LUT_4096 };
@@ -0,0 +1,155 @@
+/** ==========================================================================
+ * @file     plp_rfft_sR_f32_len512.c
+ * @brief    Tables and constant instance of the floating-point real FFT of length 512
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_const_structs.h"
+#include "plp_common_tables.h"
+
+/* generated by rfft_twiddles(512), see plp_common_tables.c */
+const Complex_type_f32 twiddleCoef_rfft_512[256] = {
+    {  1.00000000f, -0.00000000f },  {  0.99992470f, -0.01227154f },  {  0.99969882f, -0.02454123f },
+    {  0.99932238f, -0.03680722f },  {  0.99879546f, -0.04906767f },  {  0.99811811f, -0.06132074f },
+    {  0.99729046f, -0.07356456f },  {  0.99631261f, -0.08579731f },  {  0.99518473f, -0.09801714f },
+    {  0.99390697f, -0.11022221f },  {  0.99247953f, -0.12241068f },  {  0.99090264f, -0.13458071f },
+    {  0.98917651f, -0.14673047f },  {  0.98730142f, -0.15885814f },  {  0.98527764f, -0.17096189f },
+    {  0.98310549f, -0.18303989f },  {  0.98078528f, -0.19509032f },  {  0.97831737f, -0.20711138f },
+    {  0.97570213f, -0.21910124f },  {  0.97293995f, -0.23105811f },  {  0.97003125f, -0.24298018f },
+    {  0.96697647f, -0.25486566f },  {  0.96377607f, -0.26671276f },  {  0.96043052f, -0.27851969f },
+    {  0.95694034f, -0.29028468f },  {  0.95330604f, -0.30200595f },  {  0.94952818f, -0.31368174f },
+    {  0.94560733f, -0.32531029f },  {  0.94154407f, -0.33688985f },  {  0.93733901f, -0.34841868f },
+    {  0.93299280f, -0.35989504f },  {  0.92850608f, -0.37131719f },  {  0.92387953f, -0.38268343f },
+    {  0.91911385f, -0.39399204f },  {  0.91420976f, -0.40524131f },  {  0.90916798f, -0.41642956f },
+    {  0.90398929f, -0.42755509f },  {  0.89867447f, -0.43861624f },  {  0.89322430f, -0.44961133f },
+    {  0.88763962f, -0.46053871f },  {  0.88192126f, -0.47139674f },  {  0.87607009f, -0.48218377f },
+    {  0.87008699f, -0.49289819f },  {  0.86397286f, -0.50353838f },  {  0.85772861f, -0.51410274f },
+    {  0.85135519f, -0.52458968f },  {  0.84485357f, -0.53499762f },  {  0.83822471f, -0.54532499f },
+    {  0.83146961f, -0.55557023f },  {  0.82458930f, -0.56573181f },  {  0.81758481f, -0.57580819f },
+    {  0.81045720f, -0.58579786f },  {  0.80320753f, -0.59569930f },  {  0.79583690f, -0.60551104f },
+    {  0.78834643f, -0.61523159f },  {  0.78073723f, -0.62485949f },  {  0.77301045f, -0.63439328f },
+    {  0.76516727f, -0.64383154f },  {  0.75720885f, -0.65317284f },  {  0.74913639f, -0.66241578f },
+    {  0.74095113f, -0.67155895f },  {  0.73265427f, -0.68060100f },  {  0.72424708f, -0.68954054f },
+    {  0.71573083f, -0.69837625f },  {  0.70710678f, -0.70710678f },  {  0.69837625f, -0.71573083f },
+    {  0.68954054f, -0.72424708f },  {  0.68060100f, -0.73265427f },  {  0.67155895f, -0.74095113f },
+    {  0.66241578f, -0.74913639f },  {  0.65317284f, -0.75720885f },  {  0.64383154f, -0.76516727f },
+    {  0.63439328f, -0.77301045f },  {  0.62485949f, -0.78073723f },  {  0.61523159f, -0.78834643f },
+    {  0.60551104f, -0.79583690f },  {  0.59569930f, -0.80320753f },  {  0.58579786f, -0.81045720f },
+    {  0.57580819f, -0.81758481f },  {  0.56573181f, -0.82458930f },  {  0.55557023f, -0.83146961f },
+    {  0.54532499f, -0.83822471f },  {  0.53499762f, -0.84485357f },  {  0.52458968f, -0.85135519f },
+    {  0.51410274f, -0.85772861f },  {  0.50353838f, -0.86397286f },  {  0.49289819f, -0.87008699f },
+    {  0.48218377f, -0.87607009f },  {  0.47139674f, -0.88192126f },  {  0.46053871f, -0.88763962f },
+    {  0.44961133f, -0.89322430f },  {  0.43861624f, -0.89867447f },  {  0.42755509f, -0.90398929f },
+    {  0.41642956f, -0.90916798f },  {  0.40524131f, -0.91420976f },  {  0.39399204f, -0.91911385f },
+    {  0.38268343f, -0.92387953f },  {  0.37131719f, -0.92850608f },  {  0.35989504f, -0.93299280f },
+    {  0.34841868f, -0.93733901f },  {  0.33688985f, -0.94154407f },  {  0.32531029f, -0.94560733f },
+    {  0.31368174f, -0.94952818f },  {  0.30200595f, -0.95330604f },  {  0.29028468f, -0.95694034f },
+    {  0.27851969f, -0.96043052f },  {  0.26671276f, -0.96377607f },  {  0.25486566f, -0.96697647f },
+    {  0.24298018f, -0.97003125f },  {  0.23105811f, -0.97293995f },  {  0.21910124f, -0.97570213f },
+    {  0.20711138f, -0.97831737f },  {  0.19509032f, -0.98078528f },  {  0.18303989f, -0.98310549f },
+    {  0.17096189f, -0.98527764f },  {  0.15885814f, -0.98730142f },  {  0.14673047f, -0.98917651f },
+    {  0.13458071f, -0.99090264f },  {  0.12241068f, -0.99247953f },  {  0.11022221f, -0.99390697f },
+    {  0.09801714f, -0.99518473f },  {  0.08579731f, -0.99631261f },  {  0.07356456f, -0.99729046f },
+    {  0.06132074f, -0.99811811f },  {  0.04906767f, -0.99879546f },  {  0.03680722f, -0.99932238f },
+    {  0.02454123f, -0.99969882f },  {  0.01227154f, -0.99992470f },  {  0.00000000f, -1.00000000f },
+    { -0.01227154f, -0.99992470f },  { -0.02454123f, -0.99969882f },  { -0.03680722f, -0.99932238f },
+    { -0.04906767f, -0.99879546f },  { -0.06132074f, -0.99811811f },  { -0.07356456f, -0.99729046f },
+    { -0.08579731f, -0.99631261f },  { -0.09801714f, -0.99518473f },  { -0.11022221f, -0.99390697f },
+    { -0.12241068f, -0.99247953f },  { -0.13458071f, -0.99090264f },  { -0.14673047f, -0.98917651f },
+    { -0.15885814f, -0.98730142f },  { -0.17096189f, -0.98527764f },  { -0.18303989f, -0.98310549f },
+    { -0.19509032f, -0.98078528f },  { -0.20711138f, -0.97831737f },  { -0.21910124f, -0.97570213f },
+    { -0.23105811f, -0.97293995f },  { -0.24298018f, -0.97003125f },  { -0.25486566f, -0.96697647f },
+    { -0.26671276f, -0.96377607f },  { -0.27851969f, -0.96043052f },  { -0.29028468f, -0.95694034f },
+    { -0.30200595f, -0.95330604f },  { -0.31368174f, -0.94952818f },  { -0.32531029f, -0.94560733f },
+    { -0.33688985f, -0.94154407f },  { -0.34841868f, -0.93733901f },  { -0.35989504f, -0.93299280f },
+    { -0.37131719f, -0.92850608f },  { -0.38268343f, -0.92387953f },  { -0.39399204f, -0.91911385f },
+    { -0.40524131f, -0.91420976f },  { -0.41642956f, -0.90916798f },  { -0.42755509f, -0.90398929f },
+    { -0.43861624f, -0.89867447f },  { -0.44961133f, -0.89322430f },  { -0.46053871f, -0.88763962f },
+    { -0.47139674f, -0.88192126f },  { -0.48218377f, -0.87607009f },  { -0.49289819f, -0.87008699f },
+    { -0.50353838f, -0.86397286f },  { -0.51410274f, -0.85772861f },  { -0.52458968f, -0.85135519f },
+    { -0.53499762f, -0.84485357f },  { -0.54532499f, -0.83822471f },  { -0.55557023f, -0.83146961f },
+    { -0.56573181f, -0.82458930f },  { -0.57580819f, -0.81758481f },  { -0.58579786f, -0.81045720f },
+    { -0.59569930f, -0.80320753f },  { -0.60551104f, -0.79583690f },  { -0.61523159f, -0.78834643f },
+    { -0.62485949f, -0.78073723f },  { -0.63439328f, -0.77301045f },  { -0.64383154f, -0.76516727f },
+    { -0.65317284f, -0.75720885f },  { -0.66241578f, -0.74913639f },  { -0.67155895f, -0.74095113f },
+    { -0.68060100f, -0.73265427f },  { -0.68954054f, -0.72424708f },  { -0.69837625f, -0.71573083f },
+    { -0.70710678f, -0.70710678f },  { -0.71573083f, -0.69837625f },  { -0.72424708f, -0.68954054f },
+    { -0.73265427f, -0.68060100f },  { -0.74095113f, -0.67155895f },  { -0.74913639f, -0.66241578f },
+    { -0.75720885f, -0.65317284f },  { -0.76516727f, -0.64383154f },  { -0.77301045f, -0.63439328f },
+    { -0.78073723f, -0.62485949f },  { -0.78834643f, -0.61523159f },  { -0.79583690f, -0.60551104f },
+    { -0.80320753f, -0.59569930f },  { -0.81045720f, -0.58579786f },  { -0.81758481f, -0.57580819f },
+    { -0.82458930f, -0.56573181f },  { -0.83146961f, -0.55557023f },  { -0.83822471f, -0.54532499f },
+    { -0.84485357f, -0.53499762f },  { -0.85135519f, -0.52458968f },  { -0.85772861f, -0.51410274f },
+    { -0.86397286f, -0.50353838f },  { -0.87008699f, -0.49289819f },  { -0.87607009f, -0.48218377f },
+    { -0.88192126f, -0.47139674f },  { -0.88763962f, -0.46053871f },  { -0.89322430f, -0.44961133f },
+    { -0.89867447f, -0.43861624f },  { -0.90398929f, -0.42755509f },  { -0.90916798f, -0.41642956f },
+    { -0.91420976f, -0.40524131f },  { -0.91911385f, -0.39399204f },  { -0.92387953f, -0.38268343f },
+    { -0.92850608f, -0.37131719f },  { -0.93299280f, -0.35989504f },  { -0.93733901f, -0.34841868f },
+    { -0.94154407f, -0.33688985f },  { -0.94560733f, -0.32531029f },  { -0.94952818f, -0.31368174f },
+    { -0.95330604f, -0.30200595f },  { -0.95694034f, -0.29028468f },  { -0.96043052f, -0.27851969f },
+    { -0.96377607f, -0.26671276f },  { -0.96697647f, -0.25486566f },  { -0.97003125f, -0.24298018f },
+    { -0.97293995f, -0.23105811f },  { -0.97570213f, -0.21910124f },  { -0.97831737f, -0.20711138f },
+    { -0.98078528f, -0.19509032f },  { -0.98310549f, -0.18303989f },  { -0.98527764f, -0.17096189f },
+    { -0.98730142f, -0.15885814f },  { -0.98917651f, -0.14673047f },  { -0.99090264f, -0.13458071f },
+    { -0.99247953f, -0.12241068f },  { -0.99390697f, -0.11022221f },  { -0.99518473f, -0.09801714f },
+    { -0.99631261f, -0.08579731f },  { -0.99729046f, -0.07356456f },  { -0.99811811f, -0.06132074f },
+    { -0.99879546f, -0.04906767f },  { -0.99932238f, -0.03680722f },  { -0.99969882f, -0.02454123f },
+    { -0.99992470f, -0.01227154f }
+};
+
+/* generated by rfft_bit_rev(512), see plp_common_tables.c */
+short bit_rev_radix2_LUT_512[512] = {
+0, 256, 128, 384, 64, 320, 192, 448, 32, 288, 160, 416, 96, 352, 224, 480, 16,
+272, 144, 400, 80, 336, 208, 464, 48, 304, 176, 432, 112, 368, 240, 496, 8, 264,
+136, 392, 72, 328, 200, 456, 40, 296, 168, 424, 104, 360, 232, 488, 24, 280,
+152, 408, 88, 344, 216, 472, 56, 312, 184, 440, 120, 376, 248, 504, 4, 260, 132,
+388, 68, 324, 196, 452, 36, 292, 164, 420, 100, 356, 228, 484, 20, 276, 148,
+404, 84, 340, 212, 468, 52, 308, 180, 436, 116, 372, 244, 500, 12, 268, 140,
+396, 76, 332, 204, 460, 44, 300, 172, 428, 108, 364, 236, 492, 28, 284, 156,
+412, 92, 348, 220, 476, 60, 316, 188, 444, 124, 380, 252, 508, 2, 258, 130, 386,
+66, 322, 194, 450, 34, 290, 162, 418, 98, 354, 226, 482, 18, 274, 146, 402, 82,
+338, 210, 466, 50, 306, 178, 434, 114, 370, 242, 498, 10, 266, 138, 394, 74,
+330, 202, 458, 42, 298, 170, 426, 106, 362, 234, 490, 26, 282, 154, 410, 90,
+346, 218, 474, 58, 314, 186, 442, 122, 378, 250, 506, 6, 262, 134, 390, 70, 326,
+198, 454, 38, 294, 166, 422, 102, 358, 230, 486, 22, 278, 150, 406, 86, 342,
+214, 470, 54, 310, 182, 438, 118, 374, 246, 502, 14, 270, 142, 398, 78, 334,
+206, 462, 46, 302, 174, 430, 110, 366, 238, 494, 30, 286, 158, 414, 94, 350,
+222, 478, 62, 318, 190, 446, 126, 382, 254, 510, 1, 257, 129, 385, 65, 321, 193,
+449, 33, 289, 161, 417, 97, 353, 225, 481, 17, 273, 145, 401, 81, 337, 209, 465,
+49, 305, 177, 433, 113, 369, 241, 497, 9, 265, 137, 393, 73, 329, 201, 457, 41,
+297, 169, 425, 105, 361, 233, 489, 25, 281, 153, 409, 89, 345, 217, 473, 57,
+313, 185, 441, 121, 377, 249, 505, 5, 261, 133, 389, 69, 325, 197, 453, 37, 293,
+165, 421, 101, 357, 229, 485, 21, 277, 149, 405, 85, 341, 213, 469, 53, 309,
+181, 437, 117, 373, 245, 501, 13, 269, 141, 397, 77, 333, 205, 461, 45, 301,
+173, 429, 109, 365, 237, 493, 29, 285, 157, 413, 93, 349, 221, 477, 61, 317,
+189, 445, 125, 381, 253, 509, 3, 259, 131, 387, 67, 323, 195, 451, 35, 291, 163,
+419, 99, 355, 227, 483, 19, 275, 147, 403, 83, 339, 211, 467, 51, 307, 179, 435,
+115, 371, 243, 499, 11, 267, 139, 395, 75, 331, 203, 459, 43, 299, 171, 427,
+107, 363, 235, 491, 27, 283, 155, 411, 91, 347, 219, 475, 59, 315, 187, 443,
+123, 379, 251, 507, 7, 263, 135, 391, 71, 327, 199, 455, 39, 295, 167, 423, 103,
+359, 231, 487, 23, 279, 151, 407, 87, 343, 215, 471, 55, 311, 183, 439, 119,
+375, 247, 503, 15, 271, 143, 399, 79, 335, 207, 463, 47, 303, 175, 431, 111,
+367, 239, 495, 31, 287, 159, 415, 95, 351, 223, 479, 63, 319, 191, 447, 127,
+383, 255, 511
+};
+
+const plp_fft_instance_f32 plp_rfft_sR_f32_len512 = { 512, 1, (float32_t *)twiddleCoef_rfft_512,
+                                                      (uint16_t *)bit_rev_radix2_LUT_512 };
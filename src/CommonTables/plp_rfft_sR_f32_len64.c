@@ -0,0 +1,52 @@
+/** ==========================================================================
+ * @file     plp_rfft_sR_f32_len64.c
+ * @brief    Tables and constant instance of the floating-point real FFT of length 64
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_const_structs.h"
+#include "plp_common_tables.h"
+
+/* generated by rfft_twiddles(64), see plp_common_tables.c */
+const Complex_type_f32 twiddleCoef_rfft_64[32] = {
+    {  1.00000000f, -0.00000000f },  {  0.99518473f, -0.09801714f },  {  0.98078528f, -0.19509032f },
+    {  0.95694034f, -0.29028468f },  {  0.92387953f, -0.38268343f },  {  0.88192126f, -0.47139674f },
+    {  0.83146961f, -0.55557023f },  {  0.77301045f, -0.63439328f },  {  0.70710678f, -0.70710678f },
+    {  0.63439328f, -0.77301045f },  {  0.55557023f, -0.83146961f },  {  0.47139674f, -0.88192126f },
+    {  0.38268343f, -0.92387953f },  {  0.29028468f, -0.95694034f },  {  0.19509032f, -0.98078528f },
+    {  0.09801714f, -0.99518473f },  {  0.00000000f, -1.00000000f },  { -0.09801714f, -0.99518473f },
+    { -0.19509032f, -0.98078528f },  { -0.29028468f, -0.95694034f },  { -0.38268343f, -0.92387953f },
+    { -0.47139674f, -0.88192126f },  { -0.55557023f, -0.83146961f },  { -0.63439328f, -0.77301045f },
+    { -0.70710678f, -0.70710678f },  { -0.77301045f, -0.63439328f },  { -0.83146961f, -0.55557023f },
+    { -0.88192126f, -0.47139674f },  { -0.92387953f, -0.38268343f },  { -0.95694034f, -0.29028468f },
+    { -0.98078528f, -0.19509032f },  { -0.99518473f, -0.09801714f }
+};
+
+/* generated by rfft_bit_rev(64), see plp_common_tables.c */
+short bit_rev_radix2_LUT_64[64] = {
+0, 32, 16, 48, 8, 40, 24, 56, 4, 36, 20, 52, 12, 44, 28, 60, 2, 34, 18, 50, 10,
+42, 26, 58, 6, 38, 22, 54, 14, 46, 30, 62, 1, 33, 17, 49, 9, 41, 25, 57, 5, 37,
+21, 53, 13, 45, 29, 61, 3, 35, 19, 51, 11, 43, 27, 59, 7, 39, 23, 55, 15, 47,
+31, 63
+};
+
+const plp_fft_instance_f32 plp_rfft_sR_f32_len64 = { 64, 1, (float32_t *)twiddleCoef_rfft_64,
+                                                     (uint16_t *)bit_rev_radix2_LUT_64 };
@@ -0,0 +1,2027 @@
+/** ==========================================================================
+ * @file     plp_rfft_sR_f32_len8192.c
+ * @brief    Tables and constant instance of the floating-point real FFT of length 8192
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_const_structs.h"
+#include "plp_common_tables.h"
+
+/* generated by rfft_twiddles(8192), see plp_common_tables.c */
+const Complex_type_f32 twiddleCoef_rfft_8192[4096] = {
+    {  1.00000000f, -0.00000000f },  {  0.99999971f, -0.00076699f },  {  0.99999882f, -0.00153398f },
+    {  0.99999735f, -0.00230097f },  {  0.99999529f, -0.00306796f },  {  0.99999265f, -0.00383494f },
+    {  0.99998941f, -0.00460193f },  {  0.99998559f, -0.00536891f },  {  0.99998118f, -0.00613588f },
+    {  0.99997617f, -0.00690286f },  {  0.99997059f, -0.00766983f },  {  0.99996441f, -0.00843679f },
+    {  0.99995764f, -0.00920375f },  {  0.99995029f, -0.00997071f },  {  0.99994235f, -0.01073766f },
+    {  0.99993382f, -0.01150460f },  {  0.99992470f, -0.01227154f },  {  0.99991500f, -0.01303847f },
+    {  0.99990470f, -0.01380539f },  {  0.99989382f, -0.01457230f },  {  0.99988235f, -0.01533921f },
+    {  0.99987029f, -0.01610610f },  {  0.99985764f, -0.01687299f },  {  0.99984441f, -0.01763986f },
+    {  0.99983058f, -0.01840673f },  {  0.99981617f, -0.01917358f },  {  0.99980117f, -0.01994043f },
+    {  0.99978558f, -0.02070726f },  {  0.99976941f, -0.02147408f },  {  0.99975264f, -0.02224089f },
+    {  0.99973529f, -0.02300768f },  {  0.99971735f, -0.02377446f },  {  0.99969882f, -0.02454123f },
+    {  0.99967970f, -0.02530798f },  {  0.99966000f, -0.02607472f },  {  0.99963970f, -0.02684144f },
+    {  0.99961882f, -0.02760815f },  {  0.99959735f, -0.02837484f },  {  0.99957530f, -0.02914151f },
+    {  0.99955265f, -0.02990816f },  {  0.99952942f, -0.03067480f },  {  0.99950560f, -0.03144142f },
+    {  0.99948119f, -0.03220803f },  {  0.99945619f, -0.03297461f },  {  0.99943060f, -0.03374117f },
+    {  0.99940443f, -0.03450772f },  {  0.99937767f, -0.03527424f },  {  0.99935032f, -0.03604074f },
+    {  0.99932238f, -0.03680722f },  {  0.99929386f, -0.03757368f },  {  0.99926475f, -0.03834012f },
+    {  0.99923505f, -0.03910654f },  {  0.99920476f, -0.03987293f },  {  0.99917388f, -0.04063930f },
+    {  0.99914242f, -0.04140564f },  {  0.99911037f, -0.04217196f },  {  0.99907773f, -0.04293826f },
+    {  0.99904450f, -0.04370453f },  {  0.99901069f, -0.04447077f },  {  0.99897628f, -0.04523699f },
+    {  0.99894129f, -0.04600318f },  {  0.99890572f, -0.04676935f },  {  0.99886955f, -0.04753548f },
+    {  0.99883280f, -0.04830159f },  {  0.99879546f, -0.04906767f },  {  0.99875753f, -0.04983373f },
+    {  0.99871901f, -0.05059975f },  {  0.99867991f, -0.05136574f },  {  0.99864022f, -0.05213170f },
+    {  0.99859994f, -0.05289764f },  {  0.99855907f, -0.05366354f },  {  0.99851762f, -0.05442941f },
+    {  0.99847558f, -0.05519524f },  {  0.99843295f, -0.05596105f },  {  0.99838974f, -0.05672682f },
+    {  0.99834593f, -0.05749256f },  {  0.99830154f, -0.05825826f },  {  0.99825657f, -0.05902393f },
+    {  0.99821100f, -0.05978957f },  {  0.99816485f, -0.06055517f },  {  0.99811811f, -0.06132074f },
+    {  0.99807079f, -0.06208627f },  {  0.99802287f, -0.06285176f },  {  0.99797437f, -0.06361721f },
+    {  0.99792529f, -0.06438263f },  {  0.99787561f, -0.06514801f },  {  0.99782535f, -0.06591335f },
+    {  0.99777450f, -0.06667866f },  {  0.99772307f, -0.06744392f },  {  0.99767104f, -0.06820914f },
+    {  0.99761844f, -0.06897433f },  {  0.99756524f, -0.06973947f },  {  0.99751146f, -0.07050457f },
+    {  0.99745709f, -0.07126963f },  {  0.99740213f, -0.07203465f },  {  0.99734659f, -0.07279963f },
+    {  0.99729046f, -0.07356456f },  {  0.99723374f, -0.07432945f },  {  0.99717644f, -0.07509430f },
+    {  0.99711855f, -0.07585910f },  {  0.99706007f, -0.07662386f },  {  0.99700101f, -0.07738857f },
+    {  0.99694136f, -0.07815324f },  {  0.99688112f, -0.07891786f },  {  0.99682030f, -0.07968244f },
+    {  0.99675889f, -0.08044697f },  {  0.99669690f, -0.08121145f },  {  0.99663431f, -0.08197588f },
+    {  0.99657115f, -0.08274026f },  {  0.99650739f, -0.08350460f },  {  0.99644305f, -0.08426889f },
+    {  0.99637812f, -0.08503312f },  {  0.99631261f, -0.08579731f },  {  0.99624651f, -0.08656145f },
+    {  0.99617983f, -0.08732554f },  {  0.99611256f, -0.08808957f },  {  0.99604470f, -0.08885355f },
+    {  0.99597626f, -0.08961748f },  {  0.99590723f, -0.09038136f },  {  0.99583761f, -0.09114519f },
+    {  0.99576741f, -0.09190896f },  {  0.99569663f, -0.09267267f },  {  0.99562526f, -0.09343634f },
+    {  0.99555330f, -0.09419994f },  {  0.99548076f, -0.09496350f },  {  0.99540763f, -0.09572699f },
+    {  0.99533391f, -0.09649043f },  {  0.99525961f, -0.09725381f },  {  0.99518473f, -0.09801714f },
+    {  0.99510926f, -0.09878041f },  {  0.99503320f, -0.09954362f },  {  0.99495656f, -0.10030677f },
+    {  0.99487933f, -0.10106986f },  {  0.99480152f, -0.10183290f },  {  0.99472312f, -0.10259587f },
+    {  0.99464414f, -0.10335878f },  {  0.99456457f, -0.10412163f },  {  0.99448442f, -0.10488442f },
+    {  0.99440368f, -0.10564715f },  {  0.99432236f, -0.10640982f },  {  0.99424045f, -0.10717242f },
+    {  0.99415796f, -0.10793497f },  {  0.99407488f, -0.10869744f },  {  0.99399122f, -0.10945986f },
+    {  0.99390697f, -0.11022221f },  {  0.99382214f, -0.11098449f },  {  0.99373672f, -0.11174671f },
+    {  0.99365072f, -0.11250886f },  {  0.99356414f, -0.11327095f },  {  0.99347697f, -0.11403297f },
+    {  0.99338921f, -0.11479493f },  {  0.99330087f, -0.11555681f },  {  0.99321195f, -0.11631863f },
+    {  0.99312244f, -0.11708038f },  {  0.99303235f, -0.11784206f },  {  0.99294167f, -0.11860367f },
+    {  0.99285041f, -0.11936521f },  {  0.99275857f, -0.12012669f },  {  0.99266614f, -0.12088809f },
+    {  0.99257313f, -0.12164942f },  {  0.99247953f, -0.12241068f },  {  0.99238535f, -0.12317186f },
+    {  0.99229059f, -0.12393298f },  {  0.99219524f, -0.12469402f },  {  0.99209931f, -0.12545498f },
+    {  0.99200280f, -0.12621588f },  {  0.99190570f, -0.12697670f },  {  0.99180802f, -0.12773744f },
+    {  0.99170975f, -0.12849811f },  {  0.99161091f, -0.12925870f },  {  0.99151147f, -0.13001922f },
+    {  0.99141146f, -0.13077966f },  {  0.99131086f, -0.13154003f },  {  0.99120968f, -0.13230032f },
+    {  0.99110791f, -0.13306053f },  {  0.99100557f, -0.13382066f },  {  0.99090264f, -0.13458071f },
+    {  0.99079912f, -0.13534068f },  {  0.99069503f, -0.13610058f },  {  0.99059035f, -0.13686039f },
+    {  0.99048508f, -0.13762012f },  {  0.99037924f, -0.13837977f },  {  0.99027281f, -0.13913934f },
+    {  0.99016580f, -0.13989883f },  {  0.99005821f, -0.14065824f },  {  0.98995004f, -0.14141756f },
+    {  0.98984128f, -0.14217680f },  {  0.98973194f, -0.14293596f },  {  0.98962202f, -0.14369503f },
+    {  0.98951151f, -0.14445402f },  {  0.98940043f, -0.14521292f },  {  0.98928876f, -0.14597174f },
+    {  0.98917651f, -0.14673047f },  {  0.98906368f, -0.14748912f },  {  0.98895026f, -0.14824768f },
+    {  0.98883627f, -0.14900615f },  {  0.98872169f, -0.14976453f },  {  0.98860653f, -0.15052283f },
+    {  0.98849079f, -0.15128104f },  {  0.98837447f, -0.15203916f },  {  0.98825757f, -0.15279719f },
+    {  0.98814008f, -0.15355512f },  {  0.98802202f, -0.15431297f },  {  0.98790337f, -0.15507073f },
+    {  0.98778414f, -0.15582840f },  {  0.98766433f, -0.15658597f },  {  0.98754394f, -0.15734346f },
+    {  0.98742297f, -0.15810085f },  {  0.98730142f, -0.15885814f },  {  0.98717929f, -0.15961535f },
+    {  0.98705657f, -0.16037246f },  {  0.98693328f, -0.16112947f },  {  0.98680940f, -0.16188639f },
+    {  0.98668495f, -0.16264322f },  {  0.98655991f, -0.16339995f },  {  0.98643429f, -0.16415658f },
+    {  0.98630810f, -0.16491312f },  {  0.98618132f, -0.16566956f },  {  0.98605396f, -0.16642590f },
+    {  0.98592603f, -0.16718215f },  {  0.98579751f, -0.16793829f },  {  0.98566841f, -0.16869434f },
+    {  0.98553874f, -0.16945029f },  {  0.98540848f, -0.17020614f },  {  0.98527764f, -0.17096189f },
+    {  0.98514623f, -0.17171754f },  {  0.98501423f, -0.17247308f },  {  0.98488166f, -0.17322853f },
+    {  0.98474850f, -0.17398387f },  {  0.98461477f, -0.17473911f },  {  0.98448046f, -0.17549425f },
+    {  0.98434556f, -0.17624929f },  {  0.98421009f, -0.17700422f },  {  0.98407404f, -0.17775905f },
+    {  0.98393741f, -0.17851377f },  {  0.98380021f, -0.17926839f },  {  0.98366242f, -0.18002290f },
+    {  0.98352405f, -0.18077731f },  {  0.98338511f, -0.18153161f },  {  0.98324559f, -0.18228580f },
+    {  0.98310549f, -0.18303989f },  {  0.98296481f, -0.18379387f },  {  0.98282355f, -0.18454774f },
+    {  0.98268172f, -0.18530150f },  {  0.98253930f, -0.18605515f },  {  0.98239631f, -0.18680870f },
+    {  0.98225274f, -0.18756213f },  {  0.98210859f, -0.18831545f },  {  0.98196387f, -0.18906866f },
+    {  0.98181857f, -0.18982177f },  {  0.98167269f, -0.19057475f },  {  0.98152623f, -0.19132763f },
+    {  0.98137919f, -0.19208040f },  {  0.98123158f, -0.19283305f },  {  0.98108339f, -0.19358559f },
+    {  0.98093462f, -0.19433801f },  {  0.98078528f, -0.19509032f },  {  0.98063536f, -0.19584252f },
+    {  0.98048486f, -0.19659460f },  {  0.98033379f, -0.19734656f },  {  0.98018214f, -0.19809841f },
+    {  0.98002991f, -0.19885014f },  {  0.97987710f, -0.19960176f },  {  0.97972372f, -0.20035326f },
+    {  0.97956977f, -0.20110463f },  {  0.97941523f, -0.20185590f },  {  0.97926012f, -0.20260704f },
+    {  0.97910444f, -0.20335806f },  {  0.97894818f, -0.20410897f },  {  0.97879134f, -0.20485975f },
+    {  0.97863392f, -0.20561041f },  {  0.97847594f, -0.20636096f },  {  0.97831737f, -0.20711138f },
+    {  0.97815823f, -0.20786168f },  {  0.97799851f, -0.20861185f },  {  0.97783822f, -0.20936191f },
+    {  0.97767736f, -0.21011184f },  {  0.97751592f, -0.21086164f },  {  0.97735390f, -0.21161133f },
+    {  0.97719131f, -0.21236089f },  {  0.97702814f, -0.21311032f },  {  0.97686440f, -0.21385963f },
+    {  0.97670009f, -0.21460881f },  {  0.97653520f, -0.21535787f },  {  0.97636973f, -0.21610680f },
+    {  0.97620369f, -0.21685560f },  {  0.97603708f, -0.21760427f },  {  0.97586989f, -0.21835282f },
+    {  0.97570213f, -0.21910124f },  {  0.97553379f, -0.21984953f },  {  0.97536489f, -0.22059769f },
+    {  0.97519540f, -0.22134572f },  {  0.97502535f, -0.22209362f },  {  0.97485471f, -0.22284139f },
+    {  0.97468351f, -0.22358903f },  {  0.97451173f, -0.22433654f },  {  0.97433938f, -0.22508391f },
+    {  0.97416646f, -0.22583115f },  {  0.97399296f, -0.22657826f },  {  0.97381889f, -0.22732524f },
+    {  0.97364425f, -0.22807208f },  {  0.97346903f, -0.22881879f },  {  0.97329325f, -0.22956537f },
+    {  0.97311689f, -0.23031180f },  {  0.97293995f, -0.23105811f },  {  0.97276245f, -0.23180428f },
+    {  0.97258437f, -0.23255031f },  {  0.97240572f, -0.23329620f },  {  0.97222650f, -0.23404196f },
+    {  0.97204670f, -0.23478758f },  {  0.97186634f, -0.23553306f },  {  0.97168540f, -0.23627840f },
+    {  0.97150389f, -0.23702361f },  {  0.97132181f, -0.23776867f },  {  0.97113916f, -0.23851359f },
+    {  0.97095594f, -0.23925838f },  {  0.97077214f, -0.24000302f },  {  0.97058778f, -0.24074752f },
+    {  0.97040284f, -0.24149189f },  {  0.97021733f, -0.24223610f },  {  0.97003125f, -0.24298018f },
+    {  0.96984460f, -0.24372411f },  {  0.96965739f, -0.24446790f },  {  0.96946960f, -0.24521155f },
+    {  0.96928124f, -0.24595505f },  {  0.96909231f, -0.24669841f },  {  0.96890280f, -0.24744162f },
+    {  0.96871273f, -0.24818469f },  {  0.96852209f, -0.24892761f },  {  0.96833088f, -0.24967038f },
+    {  0.96813910f, -0.25041301f },  {  0.96794676f, -0.25115549f },  {  0.96775384f, -0.25189782f },
+    {  0.96756035f, -0.25264000f },  {  0.96736629f, -0.25338204f },  {  0.96717167f, -0.25412392f },
+    {  0.96697647f, -0.25486566f },  {  0.96678071f, -0.25560725f },  {  0.96658437f, -0.25634868f },
+    {  0.96638747f, -0.25708997f },  {  0.96619000f, -0.25783110f },  {  0.96599197f, -0.25857208f },
+    {  0.96579336f, -0.25931292f },  {  0.96559418f, -0.26005359f },  {  0.96539444f, -0.26079412f },
+    {  0.96519413f, -0.26153449f },  {  0.96499325f, -0.26227471f },  {  0.96479181f, -0.26301477f },
+    {  0.96458979f, -0.26375468f },  {  0.96438721f, -0.26449443f },  {  0.96418406f, -0.26523403f },
+    {  0.96398035f, -0.26597347f },  {  0.96377607f, -0.26671276f },  {  0.96357122f, -0.26745189f },
+    {  0.96336580f, -0.26819086f },  {  0.96315982f, -0.26892967f },  {  0.96295327f, -0.26966833f },
+    {  0.96274615f, -0.27040682f },  {  0.96253847f, -0.27114516f },  {  0.96233022f, -0.27188334f },
+    {  0.96212140f, -0.27262136f },  {  0.96191202f, -0.27335921f },  {  0.96170208f, -0.27409691f },
+    {  0.96149156f, -0.27483445f },  {  0.96128049f, -0.27557182f },  {  0.96106884f, -0.27630903f },
+    {  0.96085663f, -0.27704608f },  {  0.96064386f, -0.27778297f },  {  0.96043052f, -0.27851969f },
+    {  0.96021662f, -0.27925625f },  {  0.96000215f, -0.27999264f },  {  0.95978711f, -0.28072887f },
+    {  0.95957151f, -0.28146494f },  {  0.95935535f, -0.28220084f },  {  0.95913862f, -0.28293657f },
+    {  0.95892133f, -0.28367214f },  {  0.95870347f, -0.28440754f },  {  0.95848506f, -0.28514277f },
+    {  0.95826607f, -0.28587783f },  {  0.95804652f, -0.28661273f },  {  0.95782641f, -0.28734746f },
+    {  0.95760574f, -0.28808202f },  {  0.95738450f, -0.28881641f },  {  0.95716270f, -0.28955063f },
+    {  0.95694034f, -0.29028468f },  {  0.95671741f, -0.29101856f },  {  0.95649392f, -0.29175226f },
+    {  0.95626987f, -0.29248580f },  {  0.95604525f, -0.29321916f },  {  0.95582007f, -0.29395235f },
+    {  0.95559433f, -0.29468537f },  {  0.95536803f, -0.29541822f },  {  0.95514117f, -0.29615089f },
+    {  0.95491374f, -0.29688339f },  {  0.95468575f, -0.29761571f },  {  0.95445721f, -0.29834785f },
+    {  0.95422810f, -0.29907983f },  {  0.95399842f, -0.29981162f },  {  0.95376819f, -0.30054324f },
+    {  0.95353740f, -0.30127468f },  {  0.95330604f, -0.30200595f },  {  0.95307412f, -0.30273704f },
+    {  0.95284165f, -0.30346795f },  {  0.95260861f, -0.30419868f },  {  0.95237501f, -0.30492923f },
+    {  0.95214085f, -0.30565960f },  {  0.95190614f, -0.30638980f },  {  0.95167086f, -0.30711981f },
+    {  0.95143502f, -0.30784964f },  {  0.95119862f, -0.30857929f },  {  0.95096167f, -0.30930876f },
+    {  0.95072415f, -0.31003805f },  {  0.95048607f, -0.31076715f },  {  0.95024744f, -0.31149607f },
+    {  0.95000825f, -0.31222481f },  {  0.94976849f, -0.31295337f },  {  0.94952818f, -0.31368174f },
+    {  0.94928731f, -0.31440993f },  {  0.94904588f, -0.31513793f },  {  0.94880389f, -0.31586575f },
+    {  0.94856135f, -0.31659338f },  {  0.94831825f, -0.31732082f },  {  0.94807459f, -0.31804808f },
+    {  0.94783037f, -0.31877515f },  {  0.94758559f, -0.31950203f },  {  0.94734026f, -0.32022873f },
+    {  0.94709437f, -0.32095523f },  {  0.94684792f, -0.32168155f },  {  0.94660091f, -0.32240768f },
+    {  0.94635335f, -0.32313362f },  {  0.94610523f, -0.32385937f },  {  0.94585656f, -0.32458492f },
+    {  0.94560733f, -0.32531029f },  {  0.94535754f, -0.32603547f },  {  0.94510719f, -0.32676045f },
+    {  0.94485629f, -0.32748524f },  {  0.94460484f, -0.32820984f },  {  0.94435283f, -0.32893425f },
+    {  0.94410026f, -0.32965846f },  {  0.94384714f, -0.33038248f },  {  0.94359346f, -0.33110631f },
+    {  0.94333923f, -0.33182994f },  {  0.94308444f, -0.33255337f },  {  0.94282909f, -0.33327661f },
+    {  0.94257320f, -0.33399965f },  {  0.94231675f, -0.33472250f },  {  0.94205974f, -0.33544515f },
+    {  0.94180218f, -0.33616760f },  {  0.94154407f, -0.33688985f },  {  0.94128540f, -0.33761191f },
+    {  0.94102618f, -0.33833377f },  {  0.94076640f, -0.33905543f },  {  0.94050607f, -0.33977688f },
+    {  0.94024519f, -0.34049814f },  {  0.93998375f, -0.34121920f },  {  0.93972176f, -0.34194006f },
+    {  0.93945922f, -0.34266072f },  {  0.93919613f, -0.34338117f },  {  0.93893248f, -0.34410143f },
+    {  0.93866828f, -0.34482148f },  {  0.93840353f, -0.34554132f },  {  0.93813823f, -0.34626097f },
+    {  0.93787238f, -0.34698041f },  {  0.93760597f, -0.34769965f },  {  0.93733901f, -0.34841868f },
+    {  0.93707150f, -0.34913751f },  {  0.93680344f, -0.34985613f },  {  0.93653483f, -0.35057455f },
+    {  0.93626567f, -0.35129276f },  {  0.93599595f, -0.35201076f },  {  0.93572569f, -0.35272856f },
+    {  0.93545487f, -0.35344614f },  {  0.93518351f, -0.35416353f },  {  0.93491159f, -0.35488070f },
+    {  0.93463913f, -0.35559766f },  {  0.93436611f, -0.35631442f },  {  0.93409255f, -0.35703096f },
+    {  0.93381844f, -0.35774730f },  {  0.93354377f, -0.35846342f },  {  0.93326856f, -0.35917933f },
+    {  0.93299280f, -0.35989504f },  {  0.93271649f, -0.36061053f },  {  0.93243963f, -0.36132581f },
+    {  0.93216222f, -0.36204087f },  {  0.93188427f, -0.36275572f },  {  0.93160576f, -0.36347036f },
+    {  0.93132671f, -0.36418479f },  {  0.93104711f, -0.36489900f },  {  0.93076696f, -0.36561300f },
+    {  0.93048627f, -0.36632678f },  {  0.93020502f, -0.36704035f },  {  0.92992323f, -0.36775370f },
+    {  0.92964090f, -0.36846683f },  {  0.92935801f, -0.36917975f },  {  0.92907458f, -0.36989245f },
+    {  0.92879060f, -0.37060493f },  {  0.92850608f, -0.37131719f },  {  0.92822101f, -0.37202924f },
+    {  0.92793539f, -0.37274107f },  {  0.92764923f, -0.37345267f },  {  0.92736253f, -0.37416406f },
+    {  0.92707527f, -0.37487523f },  {  0.92678747f, -0.37558618f },  {  0.92649913f, -0.37629691f },
+    {  0.92621024f, -0.37700741f },  {  0.92592081f, -0.37771769f },  {  0.92563083f, -0.37842775f },
+    {  0.92534031f, -0.37913759f },  {  0.92504924f, -0.37984721f },  {  0.92475763f, -0.38055660f },
+    {  0.92446547f, -0.38126577f },  {  0.92417278f, -0.38197471f },  {  0.92387953f, -0.38268343f },
+    {  0.92358575f, -0.38339193f },  {  0.92329142f, -0.38410020f },  {  0.92299654f, -0.38480824f },
+    {  0.92270113f, -0.38551605f },  {  0.92240517f, -0.38622364f },  {  0.92210867f, -0.38693101f },
+    {  0.92181163f, -0.38763814f },  {  0.92151404f, -0.38834505f },  {  0.92121591f, -0.38905172f },
+    {  0.92091724f, -0.38975817f },  {  0.92061803f, -0.39046439f },  {  0.92031828f, -0.39117038f },
+    {  0.92001798f, -0.39187614f },  {  0.91971715f, -0.39258167f },  {  0.91941577f, -0.39328697f },
+    {  0.91911385f, -0.39399204f },  {  0.91881139f, -0.39469688f },  {  0.91850839f, -0.39540148f },
+    {  0.91820486f, -0.39610585f },  {  0.91790078f, -0.39680999f },  {  0.91759616f, -0.39751389f },
+    {  0.91729100f, -0.39821756f },  {  0.91698530f, -0.39892100f },  {  0.91667906f, -0.39962420f },
+    {  0.91637228f, -0.40032717f },  {  0.91606497f, -0.40102990f },  {  0.91575711f, -0.40173239f },
+    {  0.91544872f, -0.40243465f },  {  0.91513978f, -0.40313667f },  {  0.91483031f, -0.40383846f },
+    {  0.91452030f, -0.40454000f },  {  0.91420976f, -0.40524131f },  {  0.91389867f, -0.40594238f },
+    {  0.91358705f, -0.40664322f },  {  0.91327489f, -0.40734381f },  {  0.91296219f, -0.40804416f },
+    {  0.91264896f, -0.40874428f },  {  0.91233518f, -0.40944415f },  {  0.91202088f, -0.41014378f },
+    {  0.91170603f, -0.41084317f },  {  0.91139065f, -0.41154232f },  {  0.91107473f, -0.41224123f },
+    {  0.91075828f, -0.41293989f },  {  0.91044129f, -0.41363831f },  {  0.91012377f, -0.41433649f },
+    {  0.90980571f, -0.41503442f },  {  0.90948711f, -0.41573211f },  {  0.90916798f, -0.41642956f },
+    {  0.90884832f, -0.41712676f },  {  0.90852812f, -0.41782372f },  {  0.90820738f, -0.41852043f },
+    {  0.90788612f, -0.41921689f },  {  0.90756431f, -0.41991310f },  {  0.90724198f, -0.42060907f },
+    {  0.90691911f, -0.42130480f },  {  0.90659570f, -0.42200027f },  {  0.90627177f, -0.42269550f },
+    {  0.90594730f, -0.42339047f },  {  0.90562229f, -0.42408520f },  {  0.90529676f, -0.42477968f },
+    {  0.90497069f, -0.42547391f },  {  0.90464409f, -0.42616789f },  {  0.90431696f, -0.42686162f },
+    {  0.90398929f, -0.42755509f },  {  0.90366110f, -0.42824832f },  {  0.90333237f, -0.42894129f },
+    {  0.90300311f, -0.42963401f },  {  0.90267332f, -0.43032648f },  {  0.90234300f, -0.43101870f },
+    {  0.90201214f, -0.43171066f },  {  0.90168076f, -0.43240237f },  {  0.90134885f, -0.43309382f },
+    {  0.90101640f, -0.43378502f },  {  0.90068343f, -0.43447596f },  {  0.90034993f, -0.43516665f },
+    {  0.90001589f, -0.43585708f },  {  0.89968133f, -0.43654726f },  {  0.89934624f, -0.43723717f },
+    {  0.89901062f, -0.43792683f },  {  0.89867447f, -0.43861624f },  {  0.89833779f, -0.43930538f },
+    {  0.89800058f, -0.43999427f },  {  0.89766284f, -0.44068290f },  {  0.89732458f, -0.44137127f },
+    {  0.89698579f, -0.44205938f },  {  0.89664647f, -0.44274723f },  {  0.89630662f, -0.44343482f },
+    {  0.89596625f, -0.44412214f },  {  0.89562535f, -0.44480921f },  {  0.89528392f, -0.44549602f },
+    {  0.89494197f, -0.44618256f },  {  0.89459949f, -0.44686884f },  {  0.89425648f, -0.44755486f },
+    {  0.89391295f, -0.44824061f },  {  0.89356889f, -0.44892610f },  {  0.89322430f, -0.44961133f },
+    {  0.89287919f, -0.45029629f },  {  0.89253356f, -0.45098099f },  {  0.89218739f, -0.45166542f },
+    {  0.89184071f, -0.45234959f },  {  0.89149350f, -0.45303349f },  {  0.89114576f, -0.45371712f },
+    {  0.89079751f, -0.45440049f },  {  0.89044872f, -0.45508359f },  {  0.89009942f, -0.45576642f },
+    {  0.88974959f, -0.45644898f },  {  0.88939923f, -0.45713128f },  {  0.88904836f, -0.45781330f },
+    {  0.88869696f, -0.45849506f },  {  0.88834503f, -0.45917655f },  {  0.88799259f, -0.45985776f },
+    {  0.88763962f, -0.46053871f },  {  0.88728613f, -0.46121939f },  {  0.88693212f, -0.46189979f },
+    {  0.88657759f, -0.46257992f },  {  0.88622253f, -0.46325978f },  {  0.88586695f, -0.46393937f },
+    {  0.88551086f, -0.46461869f },  {  0.88515424f, -0.46529773f },  {  0.88479710f, -0.46597650f },
+    {  0.88443944f, -0.46665499f },  {  0.88408126f, -0.46733321f },  {  0.88372256f, -0.46801115f },
+    {  0.88336334f, -0.46868882f },  {  0.88300360f, -0.46936622f },  {  0.88264334f, -0.47004333f },
+    {  0.88228256f, -0.47072017f },  {  0.88192126f, -0.47139674f },  {  0.88155945f, -0.47207302f },
+    {  0.88119711f, -0.47274903f },  {  0.88083426f, -0.47342476f },  {  0.88047089f, -0.47410021f },
+    {  0.88010700f, -0.47477539f },  {  0.87974259f, -0.47545028f },  {  0.87937767f, -0.47612490f },
+    {  0.87901223f, -0.47679923f },  {  0.87864627f, -0.47747328f },  {  0.87827979f, -0.47814706f },
+    {  0.87791280f, -0.47882055f },  {  0.87754529f, -0.47949376f },  {  0.87717727f, -0.48016669f },
+    {  0.87680872f, -0.48083933f },  {  0.87643967f, -0.48151169f },  {  0.87607009f, -0.48218377f },
+    {  0.87570001f, -0.48285557f },  {  0.87532940f, -0.48352708f },  {  0.87495829f, -0.48419831f },
+    {  0.87458665f, -0.48486925f },  {  0.87421451f, -0.48553990f },  {  0.87384184f, -0.48621028f },
+    {  0.87346867f, -0.48688036f },  {  0.87309498f, -0.48755016f },  {  0.87272078f, -0.48821967f },
+    {  0.87234606f, -0.48888890f },  {  0.87197083f, -0.48955783f },  {  0.87159509f, -0.49022648f },
+    {  0.87121883f, -0.49089484f },  {  0.87084206f, -0.49156292f },  {  0.87046478f, -0.49223070f },
+    {  0.87008699f, -0.49289819f },  {  0.86970869f, -0.49356540f },  {  0.86932987f, -0.49423231f },
+    {  0.86895054f, -0.49489893f },  {  0.86857071f, -0.49556526f },  {  0.86819036f, -0.49623130f },
+    {  0.86780950f, -0.49689705f },  {  0.86742813f, -0.49756250f },  {  0.86704625f, -0.49822767f },
+    {  0.86666385f, -0.49889254f },  {  0.86628095f, -0.49955711f },  {  0.86589754f, -0.50022139f },
+    {  0.86551362f, -0.50088538f },  {  0.86512920f, -0.50154908f },  {  0.86474426f, -0.50221247f },
+    {  0.86435881f, -0.50287558f },  {  0.86397286f, -0.50353838f },  {  0.86358639f, -0.50420089f },
+    {  0.86319942f, -0.50486311f },  {  0.86281194f, -0.50552503f },  {  0.86242396f, -0.50618665f },
+    {  0.86203546f, -0.50684797f },  {  0.86164646f, -0.50750899f },  {  0.86125695f, -0.50816972f },
+    {  0.86086694f, -0.50883014f },  {  0.86047642f, -0.50949027f },  {  0.86008539f, -0.51015010f },
+    {  0.85969386f, -0.51080962f },  {  0.85930182f, -0.51146885f },  {  0.85890927f, -0.51212778f },
+    {  0.85851622f, -0.51278640f },  {  0.85812267f, -0.51344472f },  {  0.85772861f, -0.51410274f },
+    {  0.85733405f, -0.51476046f },  {  0.85693898f, -0.51541788f },  {  0.85654340f, -0.51607499f },
+    {  0.85614733f, -0.51673180f },  {  0.85575075f, -0.51738830f },  {  0.85535366f, -0.51804450f },
+    {  0.85495608f, -0.51870040f },  {  0.85455799f, -0.51935599f },  {  0.85415940f, -0.52001128f },
+    {  0.85376030f, -0.52066625f },  {  0.85336070f, -0.52132093f },  {  0.85296060f, -0.52197529f },
+    {  0.85256000f, -0.52262935f },  {  0.85215890f, -0.52328310f },  {  0.85175730f, -0.52393655f },
+    {  0.85135519f, -0.52458968f },  {  0.85095259f, -0.52524251f },  {  0.85054948f, -0.52589503f },
+    {  0.85014587f, -0.52654724f },  {  0.84974177f, -0.52719913f },  {  0.84933716f, -0.52785072f },
+    {  0.84893206f, -0.52850200f },  {  0.84852645f, -0.52915297f },  {  0.84812034f, -0.52980362f },
+    {  0.84771374f, -0.53045397f },  {  0.84730664f, -0.53110400f },  {  0.84689904f, -0.53175372f },
+    {  0.84649094f, -0.53240313f },  {  0.84608234f, -0.53305222f },  {  0.84567325f, -0.53370100f },
+    {  0.84526365f, -0.53434947f },  {  0.84485357f, -0.53499762f },  {  0.84444298f, -0.53564546f },
+    {  0.84403190f, -0.53629298f },  {  0.84362032f, -0.53694019f },  {  0.84320824f, -0.53758708f },
+    {  0.84279567f, -0.53823365f },  {  0.84238260f, -0.53887991f },  {  0.84196904f, -0.53952585f },
+    {  0.84155498f, -0.54017147f },  {  0.84114042f, -0.54081678f },  {  0.84072537f, -0.54146177f },
+    {  0.84030983f, -0.54210643f },  {  0.83989379f, -0.54275078f },  {  0.83947726f, -0.54339482f },
+    {  0.83906024f, -0.54403853f },  {  0.83864272f, -0.54468192f },  {  0.83822471f, -0.54532499f },
+    {  0.83780620f, -0.54596774f },  {  0.83738720f, -0.54661017f },  {  0.83696771f, -0.54725227f },
+    {  0.83654773f, -0.54789406f },  {  0.83612725f, -0.54853552f },  {  0.83570628f, -0.54917666f },
+    {  0.83528483f, -0.54981748f },  {  0.83486287f, -0.55045797f },  {  0.83444043f, -0.55109814f },
+    {  0.83401750f, -0.55173799f },  {  0.83359408f, -0.55237751f },  {  0.83317016f, -0.55301671f },
+    {  0.83274576f, -0.55365558f },  {  0.83232087f, -0.55429412f },  {  0.83189548f, -0.55493234f },
+    {  0.83146961f, -0.55557023f },  {  0.83104325f, -0.55620780f },  {  0.83061640f, -0.55684504f },
+    {  0.83018906f, -0.55748195f },  {  0.82976123f, -0.55811853f },  {  0.82933292f, -0.55875479f },
+    {  0.82890411f, -0.55939071f },  {  0.82847482f, -0.56002631f },  {  0.82804505f, -0.56066158f },
+    {  0.82761478f, -0.56129651f },  {  0.82718403f, -0.56193112f },  {  0.82675279f, -0.56256540f },
+    {  0.82632106f, -0.56319934f },  {  0.82588885f, -0.56383296f },  {  0.82545615f, -0.56446624f },
+    {  0.82502297f, -0.56509919f },  {  0.82458930f, -0.56573181f },  {  0.82415515f, -0.56636410f },
+    {  0.82372051f, -0.56699605f },  {  0.82328539f, -0.56762767f },  {  0.82284978f, -0.56825895f },
+    {  0.82241369f, -0.56888990f },  {  0.82197712f, -0.56952052f },  {  0.82154006f, -0.57015080f },
+    {  0.82110251f, -0.57078075f },  {  0.82066449f, -0.57141036f },  {  0.82022598f, -0.57203963f },
+    {  0.81978699f, -0.57266857f },  {  0.81934752f, -0.57329717f },  {  0.81890757f, -0.57392543f },
+    {  0.81846713f, -0.57455336f },  {  0.81802621f, -0.57518094f },  {  0.81758481f, -0.57580819f },
+    {  0.81714293f, -0.57643510f },  {  0.81670057f, -0.57706167f },  {  0.81625773f, -0.57768790f },
+    {  0.81581441f, -0.57831380f },  {  0.81537061f, -0.57893935f },  {  0.81492633f, -0.57956456f },
+    {  0.81448157f, -0.58018943f },  {  0.81403633f, -0.58081396f },  {  0.81359061f, -0.58143815f },
+    {  0.81314441f, -0.58206199f },  {  0.81269774f, -0.58268549f },  {  0.81225059f, -0.58330865f },
+    {  0.81180296f, -0.58393147f },  {  0.81135485f, -0.58455394f },  {  0.81090626f, -0.58517607f },
+    {  0.81045720f, -0.58579786f },  {  0.81000766f, -0.58641930f },  {  0.80955764f, -0.58704039f },
+    {  0.80910715f, -0.58766114f },  {  0.80865618f, -0.58828155f },  {  0.80820474f, -0.58890161f },
+    {  0.80775282f, -0.58952132f },  {  0.80730042f, -0.59014068f },  {  0.80684755f, -0.59075970f },
+    {  0.80639421f, -0.59137837f },  {  0.80594039f, -0.59199669f },  {  0.80548610f, -0.59261467f },
+    {  0.80503133f, -0.59323230f },  {  0.80457609f, -0.59384957f },  {  0.80412038f, -0.59446650f },
+    {  0.80366419f, -0.59508308f },  {  0.80320753f, -0.59569930f },  {  0.80275040f, -0.59631518f },
+    {  0.80229280f, -0.59693071f },  {  0.80183472f, -0.59754588f },  {  0.80137617f, -0.59816071f },
+    {  0.80091715f, -0.59877518f },  {  0.80045766f, -0.59938930f },  {  0.79999770f, -0.60000307f },
+    {  0.79953727f, -0.60061648f },  {  0.79907637f, -0.60122954f },  {  0.79861499f, -0.60184225f },
+    {  0.79815315f, -0.60245460f },  {  0.79769084f, -0.60306660f },  {  0.79722806f, -0.60367824f },
+    {  0.79676481f, -0.60428953f },  {  0.79630109f, -0.60490046f },  {  0.79583690f, -0.60551104f },
+    {  0.79537225f, -0.60612126f },  {  0.79490713f, -0.60673113f },  {  0.79444154f, -0.60734063f },
+    {  0.79397548f, -0.60794978f },  {  0.79350895f, -0.60855858f },  {  0.79304196f, -0.60916701f },
+    {  0.79257450f, -0.60977509f },  {  0.79210658f, -0.61038281f },  {  0.79163819f, -0.61099016f },
+    {  0.79116933f, -0.61159716f },  {  0.79070001f, -0.61220380f },  {  0.79023022f, -0.61281008f },
+    {  0.78975997f, -0.61341600f },  {  0.78928925f, -0.61402156f },  {  0.78881807f, -0.61462676f },
+    {  0.78834643f, -0.61523159f },  {  0.78787432f, -0.61583606f },  {  0.78740175f, -0.61644017f },
+    {  0.78692871f, -0.61704392f },  {  0.78645521f, -0.61764731f },  {  0.78598125f, -0.61825033f },
+    {  0.78550683f, -0.61885299f },  {  0.78503194f, -0.61945528f },  {  0.78455660f, -0.62005721f },
+    {  0.78408079f, -0.62065878f },  {  0.78360452f, -0.62125998f },  {  0.78312779f, -0.62186081f },
+    {  0.78265060f, -0.62246128f },  {  0.78217294f, -0.62306138f },  {  0.78169483f, -0.62366112f },
+    {  0.78121626f, -0.62426049f },  {  0.78073723f, -0.62485949f },  {  0.78025774f, -0.62545812f },
+    {  0.77977779f, -0.62605639f },  {  0.77929738f, -0.62665429f },  {  0.77881651f, -0.62725182f },
+    {  0.77833519f, -0.62784898f },  {  0.77785340f, -0.62844577f },  {  0.77737116f, -0.62904219f },
+    {  0.77688847f, -0.62963824f },  {  0.77640531f, -0.63023392f },  {  0.77592170f, -0.63082923f },
+    {  0.77543763f, -0.63142417f },  {  0.77495311f, -0.63201874f },  {  0.77446813f, -0.63261293f },
+    {  0.77398269f, -0.63320676f },  {  0.77349680f, -0.63380021f },  {  0.77301045f, -0.63439328f },
+    {  0.77252365f, -0.63498599f },  {  0.77203640f, -0.63557832f },  {  0.77154869f, -0.63617028f },
+    {  0.77106052f, -0.63676186f },  {  0.77057191f, -0.63735307f },  {  0.77008284f, -0.63794390f },
+    {  0.76959331f, -0.63853436f },  {  0.76910334f, -0.63912444f },  {  0.76861291f, -0.63971415f },
+    {  0.76812203f, -0.64030348f },  {  0.76763070f, -0.64089244f },  {  0.76713891f, -0.64148101f },
+    {  0.76664668f, -0.64206921f },  {  0.76615399f, -0.64265703f },  {  0.76566085f, -0.64324448f },
+    {  0.76516727f, -0.64383154f },  {  0.76467323f, -0.64441823f },  {  0.76417874f, -0.64500454f },
+    {  0.76368380f, -0.64559046f },  {  0.76318842f, -0.64617601f },  {  0.76269258f, -0.64676118f },
+    {  0.76219630f, -0.64734597f },  {  0.76169957f, -0.64793038f },  {  0.76120239f, -0.64851440f },
+    {  0.76070476f, -0.64909805f },  {  0.76020668f, -0.64968131f },  {  0.75970816f, -0.65026419f },
+    {  0.75920919f, -0.65084668f },  {  0.75870977f, -0.65142880f },  {  0.75820991f, -0.65201053f },
+    {  0.75770960f, -0.65259188f },  {  0.75720885f, -0.65317284f },  {  0.75670765f, -0.65375342f },
+    {  0.75620600f, -0.65433362f },  {  0.75570391f, -0.65491343f },  {  0.75520138f, -0.65549285f },
+    {  0.75469840f, -0.65607189f },  {  0.75419498f, -0.65665055f },  {  0.75369111f, -0.65722881f },
+    {  0.75318680f, -0.65780669f },  {  0.75268205f, -0.65838419f },  {  0.75217685f, -0.65896129f },
+    {  0.75167121f, -0.65953801f },  {  0.75116513f, -0.66011434f },  {  0.75065861f, -0.66069028f },
+    {  0.75015165f, -0.66126584f },  {  0.74964424f, -0.66184100f },  {  0.74913639f, -0.66241578f },
+    {  0.74862811f, -0.66299016f },  {  0.74811938f, -0.66356416f },  {  0.74761021f, -0.66413776f },
+    {  0.74710061f, -0.66471098f },  {  0.74659056f, -0.66528380f },  {  0.74608007f, -0.66585623f },
+    {  0.74556915f, -0.66642827f },  {  0.74505779f, -0.66699992f },  {  0.74454598f, -0.66757118f },
+    {  0.74403374f, -0.66814204f },  {  0.74352107f, -0.66871251f },  {  0.74300795f, -0.66928259f },
+    {  0.74249440f, -0.66985227f },  {  0.74198041f, -0.67042156f },  {  0.74146599f, -0.67099045f },
+    {  0.74095113f, -0.67155895f },  {  0.74043583f, -0.67212706f },  {  0.73992010f, -0.67269477f },
+    {  0.73940393f, -0.67326208f },  {  0.73888732f, -0.67382900f },  {  0.73837029f, -0.67439552f },
+    {  0.73785281f, -0.67496165f },  {  0.73733491f, -0.67552737f },  {  0.73681657f, -0.67609270f },
+    {  0.73629780f, -0.67665764f },  {  0.73577859f, -0.67722217f },  {  0.73525895f, -0.67778631f },
+    {  0.73473888f, -0.67835004f },  {  0.73421837f, -0.67891338f },  {  0.73369744f, -0.67947632f },
+    {  0.73317607f, -0.68003886f },  {  0.73265427f, -0.68060100f },  {  0.73213204f, -0.68116274f },
+    {  0.73160938f, -0.68172407f },  {  0.73108629f, -0.68228501f },  {  0.73056277f, -0.68284555f },
+    {  0.73003882f, -0.68340568f },  {  0.72951444f, -0.68396541f },  {  0.72898963f, -0.68452474f },
+    {  0.72846439f, -0.68508367f },  {  0.72793872f, -0.68564219f },  {  0.72741263f, -0.68620031f },
+    {  0.72688611f, -0.68675803f },  {  0.72635916f, -0.68731534f },  {  0.72583178f, -0.68787225f },
+    {  0.72530397f, -0.68842875f },  {  0.72477574f, -0.68898485f },  {  0.72424708f, -0.68954054f },
+    {  0.72371800f, -0.69009583f },  {  0.72318849f, -0.69065071f },  {  0.72265855f, -0.69120519f },
+    {  0.72212819f, -0.69175926f },  {  0.72159741f, -0.69231292f },  {  0.72106620f, -0.69286617f },
+    {  0.72053457f, -0.69341902f },  {  0.72000251f, -0.69397146f },  {  0.71947003f, -0.69452349f },
+    {  0.71893712f, -0.69507511f },  {  0.71840380f, -0.69562633f },  {  0.71787005f, -0.69617713f },
+    {  0.71733587f, -0.69672753f },  {  0.71680128f, -0.69727751f },  {  0.71626626f, -0.69782709f },
+    {  0.71573083f, -0.69837625f },  {  0.71519497f, -0.69892500f },  {  0.71465869f, -0.69947334f },
+    {  0.71412199f, -0.70002128f },  {  0.71358487f, -0.70056879f },  {  0.71304733f, -0.70111590f },
+    {  0.71250937f, -0.70166259f },  {  0.71197099f, -0.70220888f },  {  0.71143220f, -0.70275474f },
+    {  0.71089298f, -0.70330020f },  {  0.71035335f, -0.70384524f },  {  0.70981330f, -0.70438987f },
+    {  0.70927283f, -0.70493408f },  {  0.70873194f, -0.70547788f },  {  0.70819064f, -0.70602126f },
+    {  0.70764892f, -0.70656423f },  {  0.70710678f, -0.70710678f },  {  0.70656423f, -0.70764892f },
+    {  0.70602126f, -0.70819064f },  {  0.70547788f, -0.70873194f },  {  0.70493408f, -0.70927283f },
+    {  0.70438987f, -0.70981330f },  {  0.70384524f, -0.71035335f },  {  0.70330020f, -0.71089298f },
+    {  0.70275474f, -0.71143220f },  {  0.70220888f, -0.71197099f },  {  0.70166259f, -0.71250937f },
+    {  0.70111590f, -0.71304733f },  {  0.70056879f, -0.71358487f },  {  0.70002128f, -0.71412199f },
+    {  0.69947334f, -0.71465869f },  {  0.69892500f, -0.71519497f },  {  0.69837625f, -0.71573083f },
+    {  0.69782709f, -0.71626626f },  {  0.69727751f, -0.71680128f },  {  0.69672753f, -0.71733587f },
+    {  0.69617713f, -0.71787005f },  {  0.69562633f, -0.71840380f },  {  0.69507511f, -0.71893712f },
+    {  0.69452349f, -0.71947003f },  {  0.69397146f, -0.72000251f },  {  0.69341902f, -0.72053457f },
+    {  0.69286617f, -0.72106620f },  {  0.69231292f, -0.72159741f },  {  0.69175926f, -0.72212819f },
+    {  0.69120519f, -0.72265855f },  {  0.69065071f, -0.72318849f },  {  0.69009583f, -0.72371800f },
+    {  0.68954054f, -0.72424708f },  {  0.68898485f, -0.72477574f },  {  0.68842875f, -0.72530397f },
+    {  0.68787225f, -0.72583178f },  {  0.68731534f, -0.72635916f },  {  0.68675803f, -0.72688611f },
+    {  0.68620031f, -0.72741263f },  {  0.68564219f, -0.72793872f },  {  0.68508367f, -0.72846439f },
+    {  0.68452474f, -0.72898963f },  {  0.68396541f, -0.72951444f },  {  0.68340568f, -0.73003882f },
+    {  0.68284555f, -0.73056277f },  {  0.68228501f, -0.73108629f },  {  0.68172407f, -0.73160938f },
+    {  0.68116274f, -0.73213204f },  {  0.68060100f, -0.73265427f },  {  0.68003886f, -0.73317607f },
+    {  0.67947632f, -0.73369744f },  {  0.67891338f, -0.73421837f },  {  0.67835004f, -0.73473888f },
+    {  0.67778631f, -0.73525895f },  {  0.67722217f, -0.73577859f },  {  0.67665764f, -0.73629780f },
+    {  0.67609270f, -0.73681657f },  {  0.67552737f, -0.73733491f },  {  0.67496165f, -0.73785281f },
+    {  0.67439552f, -0.73837029f },  {  0.67382900f, -0.73888732f },  {  0.67326208f, -0.73940393f },
+    {  0.67269477f, -0.73992010f },  {  0.67212706f, -0.74043583f },  {  0.67155895f, -0.74095113f },
+    {  0.67099045f, -0.74146599f },  {  0.67042156f, -0.74198041f },  {  0.66985227f, -0.74249440f },
+    {  0.66928259f, -0.74300795f },  {  0.66871251f, -0.74352107f },  {  0.66814204f, -0.74403374f },
+    {  0.66757118f, -0.74454598f },  {  0.66699992f, -0.74505779f },  {  0.66642827f, -0.74556915f },
+    {  0.66585623f, -0.74608007f },  {  0.66528380f, -0.74659056f },  {  0.66471098f, -0.74710061f },
+    {  0.66413776f, -0.74761021f },  {  0.66356416f, -0.74811938f },  {  0.66299016f, -0.74862811f },
+    {  0.66241578f, -0.74913639f },  {  0.66184100f, -0.74964424f },  {  0.66126584f, -0.75015165f },
+    {  0.66069028f, -0.75065861f },  {  0.66011434f, -0.75116513f },  {  0.65953801f, -0.75167121f },
+    {  0.65896129f, -0.75217685f },  {  0.65838419f, -0.75268205f },  {  0.65780669f, -0.75318680f },
+    {  0.65722881f, -0.75369111f },  {  0.65665055f, -0.75419498f },  {  0.65607189f, -0.75469840f },
+    {  0.65549285f, -0.75520138f },  {  0.65491343f, -0.75570391f },  {  0.65433362f, -0.75620600f },
+    {  0.65375342f, -0.75670765f },  {  0.65317284f, -0.75720885f },  {  0.65259188f, -0.75770960f },
+    {  0.65201053f, -0.75820991f },  {  0.65142880f, -0.75870977f },  {  0.65084668f, -0.75920919f },
+    {  0.65026419f, -0.75970816f },  {  0.64968131f, -0.76020668f },  {  0.64909805f, -0.76070476f },
+    {  0.64851440f, -0.76120239f },  {  0.64793038f, -0.76169957f },  {  0.64734597f, -0.76219630f },
+    {  0.64676118f, -0.76269258f },  {  0.64617601f, -0.76318842f },  {  0.64559046f, -0.76368380f },
+    {  0.64500454f, -0.76417874f },  {  0.64441823f, -0.76467323f },  {  0.64383154f, -0.76516727f },
+    {  0.64324448f, -0.76566085f },  {  0.64265703f, -0.76615399f },  {  0.64206921f, -0.76664668f },
+    {  0.64148101f, -0.76713891f },  {  0.64089244f, -0.76763070f },  {  0.64030348f, -0.76812203f },
+    {  0.63971415f, -0.76861291f },  {  0.63912444f, -0.76910334f },  {  0.63853436f, -0.76959331f },
+    {  0.63794390f, -0.77008284f },  {  0.63735307f, -0.77057191f },  {  0.63676186f, -0.77106052f },
+    {  0.63617028f, -0.77154869f },  {  0.63557832f, -0.77203640f },  {  0.63498599f, -0.77252365f },
+    {  0.63439328f, -0.77301045f },  {  0.63380021f, -0.77349680f },  {  0.63320676f, -0.77398269f },
+    {  0.63261293f, -0.77446813f },  {  0.63201874f, -0.77495311f },  {  0.63142417f, -0.77543763f },
+    {  0.63082923f, -0.77592170f },  {  0.63023392f, -0.77640531f },  {  0.62963824f, -0.77688847f },
+    {  0.62904219f, -0.77737116f },  {  0.62844577f, -0.77785340f },  {  0.62784898f, -0.77833519f },
+    {  0.62725182f, -0.77881651f },  {  0.62665429f, -0.77929738f },  {  0.62605639f, -0.77977779f },
+    {  0.62545812f, -0.78025774f },  {  0.62485949f, -0.78073723f },  {  0.62426049f, -0.78121626f },
+    {  0.62366112f, -0.78169483f },  {  0.62306138f, -0.78217294f },  {  0.62246128f, -0.78265060f },
+    {  0.62186081f, -0.78312779f },  {  0.62125998f, -0.78360452f },  {  0.62065878f, -0.78408079f },
+    {  0.62005721f, -0.78455660f },  {  0.61945528f, -0.78503194f },  {  0.61885299f, -0.78550683f },
+    {  0.61825033f, -0.78598125f },  {  0.61764731f, -0.78645521f },  {  0.61704392f, -0.78692871f },
+    {  0.61644017f, -0.78740175f },  {  0.61583606f, -0.78787432f },  {  0.61523159f, -0.78834643f },
+    {  0.61462676f, -0.78881807f },  {  0.61402156f, -0.78928925f },  {  0.61341600f, -0.78975997f },
+    {  0.61281008f, -0.79023022f },  {  0.61220380f, -0.79070001f },  {  0.61159716f, -0.79116933f },
+    {  0.61099016f, -0.79163819f },  {  0.61038281f, -0.79210658f },  {  0.60977509f, -0.79257450f },
+    {  0.60916701f, -0.79304196f },  {  0.60855858f, -0.79350895f },  {  0.60794978f, -0.79397548f },
+    {  0.60734063f, -0.79444154f },  {  0.60673113f, -0.79490713f },  {  0.60612126f, -0.79537225f },
+    {  0.60551104f, -0.79583690f },  {  0.60490046f, -0.79630109f },  {  0.60428953f, -0.79676481f },
+    {  0.60367824f, -0.79722806f },  {  0.60306660f, -0.79769084f },  {  0.60245460f, -0.79815315f },
+    {  0.60184225f, -0.79861499f },  {  0.60122954f, -0.79907637f },  {  0.60061648f, -0.79953727f },
+    {  0.60000307f, -0.79999770f },  {  0.59938930f, -0.80045766f },  {  0.59877518f, -0.80091715f },
+    {  0.59816071f, -0.80137617f },  {  0.59754588f, -0.80183472f },  {  0.59693071f, -0.80229280f },
+    {  0.59631518f, -0.80275040f },  {  0.59569930f, -0.80320753f },  {  0.59508308f, -0.80366419f },
+    {  0.59446650f, -0.80412038f },  {  0.59384957f, -0.80457609f },  {  0.59323230f, -0.80503133f },
+    {  0.59261467f, -0.80548610f },  {  0.59199669f, -0.80594039f },  {  0.59137837f, -0.80639421f },
+    {  0.59075970f, -0.80684755f },  {  0.59014068f, -0.80730042f },  {  0.58952132f, -0.80775282f },
+    {  0.58890161f, -0.80820474f },  {  0.58828155f, -0.80865618f },  {  0.58766114f, -0.80910715f },
+    {  0.58704039f, -0.80955764f },  {  0.58641930f, -0.81000766f },  {  0.58579786f, -0.81045720f },
+    {  0.58517607f, -0.81090626f },  {  0.58455394f, -0.81135485f },  {  0.58393147f, -0.81180296f },
+    {  0.58330865f, -0.81225059f },  {  0.58268549f, -0.81269774f },  {  0.58206199f, -0.81314441f },
+    {  0.58143815f, -0.81359061f },  {  0.58081396f, -0.81403633f },  {  0.58018943f, -0.81448157f },
+    {  0.57956456f, -0.81492633f },  {  0.57893935f, -0.81537061f },  {  0.57831380f, -0.81581441f },
+    {  0.57768790f, -0.81625773f },  {  0.57706167f, -0.81670057f },  {  0.57643510f, -0.81714293f },
+    {  0.57580819f, -0.81758481f },  {  0.57518094f, -0.81802621f },  {  0.57455336f, -0.81846713f },
+    {  0.57392543f, -0.81890757f },  {  0.57329717f, -0.81934752f },  {  0.57266857f, -0.81978699f },
+    {  0.57203963f, -0.82022598f },  {  0.57141036f, -0.82066449f },  {  0.57078075f, -0.82110251f },
+    {  0.57015080f, -0.82154006f },  {  0.56952052f, -0.82197712f },  {  0.56888990f, -0.82241369f },
+    {  0.56825895f, -0.82284978f },  {  0.56762767f, -0.82328539f },  {  0.56699605f, -0.82372051f },
+    {  0.56636410f, -0.82415515f },  {  0.56573181f, -0.82458930f },  {  0.56509919f, -0.82502297f },
+    {  0.56446624f, -0.82545615f },  {  0.56383296f, -0.82588885f },  {  0.56319934f, -0.82632106f },
+    {  0.56256540f, -0.82675279f },  {  0.56193112f, -0.82718403f },  {  0.56129651f, -0.82761478f },
+    {  0.56066158f, -0.82804505f },  {  0.56002631f, -0.82847482f },  {  0.55939071f, -0.82890411f },
+    {  0.55875479f, -0.82933292f },  {  0.55811853f, -0.82976123f },  {  0.55748195f, -0.83018906f },
+    {  0.55684504f, -0.83061640f },  {  0.55620780f, -0.83104325f },  {  0.55557023f, -0.83146961f },
+    {  0.55493234f, -0.83189548f },  {  0.55429412f, -0.83232087f },  {  0.55365558f, -0.83274576f },
+    {  0.55301671f, -0.83317016f },  {  0.55237751f, -0.83359408f },  {  0.55173799f, -0.83401750f },
+    {  0.55109814f, -0.83444043f },  {  0.55045797f, -0.83486287f },  {  0.54981748f, -0.83528483f },
+    {  0.54917666f, -0.83570628f },  {  0.54853552f, -0.83612725f },  {  0.54789406f, -0.83654773f },
+    {  0.54725227f, -0.83696771f },  {  0.54661017f, -0.83738720f },  {  0.54596774f, -0.83780620f },
+    {  0.54532499f, -0.83822471f },  {  0.54468192f, -0.83864272f },  {  0.54403853f, -0.83906024f },
+    {  0.54339482f, -0.83947726f },  {  0.54275078f, -0.83989379f },  {  0.54210643f, -0.84030983f },
+    {  0.54146177f, -0.84072537f },  {  0.54081678f, -0.84114042f },  {  0.54017147f, -0.84155498f },
+    {  0.53952585f, -0.84196904f },  {  0.53887991f, -0.84238260f },  {  0.53823365f, -0.84279567f },
+    {  0.53758708f, -0.84320824f },  {  0.53694019f, -0.84362032f },  {  0.53629298f, -0.84403190f },
+    {  0.53564546f, -0.84444298f },  {  0.53499762f, -0.84485357f },  {  0.53434947f, -0.84526365f },
+    {  0.53370100f, -0.84567325f },  {  0.53305222f, -0.84608234f },  {  0.53240313f, -0.84649094f },
+    {  0.53175372f, -0.84689904f },  {  0.53110400f, -0.84730664f },  {  0.53045397f, -0.84771374f },
+    {  0.52980362f, -0.84812034f },  {  0.52915297f, -0.84852645f },  {  0.52850200f, -0.84893206f },
+    {  0.52785072f, -0.84933716f },  {  0.52719913f, -0.84974177f },  {  0.52654724f, -0.85014587f },
+    {  0.52589503f, -0.85054948f },  {  0.52524251f, -0.85095259f },  {  0.52458968f, -0.85135519f },
+    {  0.52393655f, -0.85175730f },  {  0.52328310f, -0.85215890f },  {  0.52262935f, -0.85256000f },
+    {  0.52197529f, -0.85296060f },  {  0.52132093f, -0.85336070f },  {  0.52066625f, -0.85376030f },
+    {  0.52001128f, -0.85415940f },  {  0.51935599f, -0.85455799f },  {  0.51870040f, -0.85495608f },
+    {  0.51804450f, -0.85535366f },  {  0.51738830f, -0.85575075f },  {  0.51673180f, -0.85614733f },
+    {  0.51607499f, -0.85654340f },  {  0.51541788f, -0.85693898f },  {  0.51476046f, -0.85733405f },
+    {  0.51410274f, -0.85772861f },  {  0.51344472f, -0.85812267f },  {  0.51278640f, -0.85851622f },
+    {  0.51212778f, -0.85890927f },  {  0.51146885f, -0.85930182f },  {  0.51080962f, -0.85969386f },
+    {  0.51015010f, -0.86008539f },  {  0.50949027f, -0.86047642f },  {  0.50883014f, -0.86086694f },
+    {  0.50816972f, -0.86125695f },  {  0.50750899f, -0.86164646f },  {  0.50684797f, -0.86203546f },
+    {  0.50618665f, -0.86242396f },  {  0.50552503f, -0.86281194f },  {  0.50486311f, -0.86319942f },
+    {  0.50420089f, -0.86358639f },  {  0.50353838f, -0.86397286f },  {  0.50287558f, -0.86435881f },
+    {  0.50221247f, -0.86474426f },  {  0.50154908f, -0.86512920f },  {  0.50088538f, -0.86551362f },
+    {  0.50022139f, -0.86589754f },  {  0.49955711f, -0.86628095f },  {  0.49889254f, -0.86666385f },
+    {  0.49822767f, -0.86704625f },  {  0.49756250f, -0.86742813f },  {  0.49689705f, -0.86780950f },
+    {  0.49623130f, -0.86819036f },  {  0.49556526f, -0.86857071f },  {  0.49489893f, -0.86895054f },
+    {  0.49423231f, -0.86932987f },  {  0.49356540f, -0.86970869f },  {  0.49289819f, -0.87008699f },
+    {  0.49223070f, -0.87046478f },  {  0.49156292f, -0.87084206f },  {  0.49089484f, -0.87121883f },
+    {  0.49022648f, -0.87159509f },  {  0.48955783f, -0.87197083f },  {  0.48888890f, -0.87234606f },
+    {  0.48821967f, -0.87272078f },  {  0.48755016f, -0.87309498f },  {  0.48688036f, -0.87346867f },
+    {  0.48621028f, -0.87384184f },  {  0.48553990f, -0.87421451f },  {  0.48486925f, -0.87458665f },
+    {  0.48419831f, -0.87495829f },  {  0.48352708f, -0.87532940f },  {  0.48285557f, -0.87570001f },
+    {  0.48218377f, -0.87607009f },  {  0.48151169f, -0.87643967f },  {  0.48083933f, -0.87680872f },
+    {  0.48016669f, -0.87717727f },  {  0.47949376f, -0.87754529f },  {  0.47882055f, -0.87791280f },
+    {  0.47814706f, -0.87827979f },  {  0.47747328f, -0.87864627f },  {  0.47679923f, -0.87901223f },
+    {  0.47612490f, -0.87937767f },  {  0.47545028f, -0.87974259f },  {  0.47477539f, -0.88010700f },
+    {  0.47410021f, -0.88047089f },  {  0.47342476f, -0.88083426f },  {  0.47274903f, -0.88119711f },
+    {  0.47207302f, -0.88155945f },  {  0.47139674f, -0.88192126f },  {  0.47072017f, -0.88228256f },
+    {  0.47004333f, -0.88264334f },  {  0.46936622f, -0.88300360f },  {  0.46868882f, -0.88336334f },
+    {  0.46801115f, -0.88372256f },  {  0.46733321f, -0.88408126f },  {  0.46665499f, -0.88443944f },
+    {  0.46597650f, -0.88479710f },  {  0.46529773f, -0.88515424f },  {  0.46461869f, -0.88551086f },
+    {  0.46393937f, -0.88586695f },  {  0.46325978f, -0.88622253f },  {  0.46257992f, -0.88657759f },
+    {  0.46189979f, -0.88693212f },  {  0.46121939f, -0.88728613f },  {  0.46053871f, -0.88763962f },
+    {  0.45985776f, -0.88799259f },  {  0.45917655f, -0.88834503f },  {  0.45849506f, -0.88869696f },
+    {  0.45781330f, -0.88904836f },  {  0.45713128f, -0.88939923f },  {  0.45644898f, -0.88974959f },
+    {  0.45576642f, -0.89009942f },  {  0.45508359f, -0.89044872f },  {  0.45440049f, -0.89079751f },
+    {  0.45371712f, -0.89114576f },  {  0.45303349f, -0.89149350f },  {  0.45234959f, -0.89184071f },
+    {  0.45166542f, -0.89218739f },  {  0.45098099f, -0.89253356f },  {  0.45029629f, -0.89287919f },
+    {  0.44961133f, -0.89322430f },  {  0.44892610f, -0.89356889f },  {  0.44824061f, -0.89391295f },
+    {  0.44755486f, -0.89425648f },  {  0.44686884f, -0.89459949f },  {  0.44618256f, -0.89494197f },
+    {  0.44549602f, -0.89528392f },  {  0.44480921f, -0.89562535f },  {  0.44412214f, -0.89596625f },
+    {  0.44343482f, -0.89630662f },  {  0.44274723f, -0.89664647f },  {  0.44205938f, -0.89698579f },
+    {  0.44137127f, -0.89732458f },  {  0.44068290f, -0.89766284f },  {  0.43999427f, -0.89800058f },
+    {  0.43930538f, -0.89833779f },  {  0.43861624f, -0.89867447f },  {  0.43792683f, -0.89901062f },
+    {  0.43723717f, -0.89934624f },  {  0.43654726f, -0.89968133f },  {  0.43585708f, -0.90001589f },
+    {  0.43516665f, -0.90034993f },  {  0.43447596f, -0.90068343f },  {  0.43378502f, -0.90101640f },
+    {  0.43309382f, -0.90134885f },  {  0.43240237f, -0.90168076f },  {  0.43171066f, -0.90201214f },
+    {  0.43101870f, -0.90234300f },  {  0.43032648f, -0.90267332f },  {  0.42963401f, -0.90300311f },
+    {  0.42894129f, -0.90333237f },  {  0.42824832f, -0.90366110f },  {  0.42755509f, -0.90398929f },
+    {  0.42686162f, -0.90431696f },  {  0.42616789f, -0.90464409f },  {  0.42547391f, -0.90497069f },
+    {  0.42477968f, -0.90529676f },  {  0.42408520f, -0.90562229f },  {  0.42339047f, -0.90594730f },
+    {  0.42269550f, -0.90627177f },  {  0.42200027f, -0.90659570f },  {  0.42130480f, -0.90691911f },
+    {  0.42060907f, -0.90724198f },  {  0.41991310f, -0.90756431f },  {  0.41921689f, -0.90788612f },
+    {  0.41852043f, -0.90820738f },  {  0.41782372f, -0.90852812f },  {  0.41712676f, -0.90884832f },
+    {  0.41642956f, -0.90916798f },  {  0.41573211f, -0.90948711f },  {  0.41503442f, -0.90980571f },
+    {  0.41433649f, -0.91012377f },  {  0.41363831f, -0.91044129f },  {  0.41293989f, -0.91075828f },
+    {  0.41224123f, -0.91107473f },  {  0.41154232f, -0.91139065f },  {  0.41084317f, -0.91170603f },
+    {  0.41014378f, -0.91202088f },  {  0.40944415f, -0.91233518f },  {  0.40874428f, -0.91264896f },
+    {  0.40804416f, -0.91296219f },  {  0.40734381f, -0.91327489f },  {  0.40664322f, -0.91358705f },
+    {  0.40594238f, -0.91389867f },  {  0.40524131f, -0.91420976f },  {  0.40454000f, -0.91452030f },
+    {  0.40383846f, -0.91483031f },  {  0.40313667f, -0.91513978f },  {  0.40243465f, -0.91544872f },
+    {  0.40173239f, -0.91575711f },  {  0.40102990f, -0.91606497f },  {  0.40032717f, -0.91637228f },
+    {  0.39962420f, -0.91667906f },  {  0.39892100f, -0.91698530f },  {  0.39821756f, -0.91729100f },
+    {  0.39751389f, -0.91759616f },  {  0.39680999f, -0.91790078f },  {  0.39610585f, -0.91820486f },
+    {  0.39540148f, -0.91850839f },  {  0.39469688f, -0.91881139f },  {  0.39399204f, -0.91911385f },
+    {  0.39328697f, -0.91941577f },  {  0.39258167f, -0.91971715f },  {  0.39187614f, -0.92001798f },
+    {  0.39117038f, -0.92031828f },  {  0.39046439f, -0.92061803f },  {  0.38975817f, -0.92091724f },
+    {  0.38905172f, -0.92121591f },  {  0.38834505f, -0.92151404f },  {  0.38763814f, -0.92181163f },
+    {  0.38693101f, -0.92210867f },  {  0.38622364f, -0.92240517f },  {  0.38551605f, -0.92270113f },
+    {  0.38480824f, -0.92299654f },  {  0.38410020f, -0.92329142f },  {  0.38339193f, -0.92358575f },
+    {  0.38268343f, -0.92387953f },  {  0.38197471f, -0.92417278f },  {  0.38126577f, -0.92446547f },
+    {  0.38055660f, -0.92475763f },  {  0.37984721f, -0.92504924f },  {  0.37913759f, -0.92534031f },
+    {  0.37842775f, -0.92563083f },  {  0.37771769f, -0.92592081f },  {  0.37700741f, -0.92621024f },
+    {  0.37629691f, -0.92649913f },  {  0.37558618f, -0.92678747f },  {  0.37487523f, -0.92707527f },
+    {  0.37416406f, -0.92736253f },  {  0.37345267f, -0.92764923f },  {  0.37274107f, -0.92793539f },
+    {  0.37202924f, -0.92822101f },  {  0.37131719f, -0.92850608f },  {  0.37060493f, -0.92879060f },
+    {  0.36989245f, -0.92907458f },  {  0.36917975f, -0.92935801f },  {  0.36846683f, -0.92964090f },
+    {  0.36775370f, -0.92992323f },  {  0.36704035f, -0.93020502f },  {  0.36632678f, -0.93048627f },
+    {  0.36561300f, -0.93076696f },  {  0.36489900f, -0.93104711f },  {  0.36418479f, -0.93132671f },
+    {  0.36347036f, -0.93160576f },  {  0.36275572f, -0.93188427f },  {  0.36204087f, -0.93216222f },
+    {  0.36132581f, -0.93243963f },  {  0.36061053f, -0.93271649f },  {  0.35989504f, -0.93299280f },
+    {  0.35917933f, -0.93326856f },  {  0.35846342f, -0.93354377f },  {  0.35774730f, -0.93381844f },
+    {  0.35703096f, -0.93409255f },  {  0.35631442f, -0.93436611f },  {  0.35559766f, -0.93463913f },
+    {  0.35488070f, -0.93491159f },  {  0.35416353f, -0.93518351f },  {  0.35344614f, -0.93545487f },
+    {  0.35272856f, -0.93572569f },  {  0.35201076f, -0.93599595f },  {  0.35129276f, -0.93626567f },
+    {  0.35057455f, -0.93653483f },  {  0.34985613f, -0.93680344f },  {  0.34913751f, -0.93707150f },
+    {  0.34841868f, -0.93733901f },  {  0.34769965f, -0.93760597f },  {  0.34698041f, -0.93787238f },
+    {  0.34626097f, -0.93813823f },  {  0.34554132f, -0.93840353f },  {  0.34482148f, -0.93866828f },
+    {  0.34410143f, -0.93893248f },  {  0.34338117f, -0.93919613f },  {  0.34266072f, -0.93945922f },
+    {  0.34194006f, -0.93972176f },  {  0.34121920f, -0.93998375f },  {  0.34049814f, -0.94024519f },
+    {  0.33977688f, -0.94050607f },  {  0.33905543f, -0.94076640f },  {  0.33833377f, -0.94102618f },
+    {  0.33761191f, -0.94128540f },  {  0.33688985f, -0.94154407f },  {  0.33616760f, -0.94180218f },
+    {  0.33544515f, -0.94205974f },  {  0.33472250f, -0.94231675f },  {  0.33399965f, -0.94257320f },
+    {  0.33327661f, -0.94282909f },  {  0.33255337f, -0.94308444f },  {  0.33182994f, -0.94333923f },
+    {  0.33110631f, -0.94359346f },  {  0.33038248f, -0.94384714f },  {  0.32965846f, -0.94410026f },
+    {  0.32893425f, -0.94435283f },  {  0.32820984f, -0.94460484f },  {  0.32748524f, -0.94485629f },
+    {  0.32676045f, -0.94510719f },  {  0.32603547f, -0.94535754f },  {  0.32531029f, -0.94560733f },
+    {  0.32458492f, -0.94585656f },  {  0.32385937f, -0.94610523f },  {  0.32313362f, -0.94635335f },
+    {  0.32240768f, -0.94660091f },  {  0.32168155f, -0.94684792f },  {  0.32095523f, -0.94709437f },
+    {  0.32022873f, -0.94734026f },  {  0.31950203f, -0.94758559f },  {  0.31877515f, -0.94783037f },
+    {  0.31804808f, -0.94807459f },  {  0.31732082f, -0.94831825f },  {  0.31659338f, -0.94856135f },
+    {  0.31586575f, -0.94880389f },  {  0.31513793f, -0.94904588f },  {  0.31440993f, -0.94928731f },
+    {  0.31368174f, -0.94952818f },  {  0.31295337f, -0.94976849f },  {  0.31222481f, -0.95000825f },
+    {  0.31149607f, -0.95024744f },  {  0.31076715f, -0.95048607f },  {  0.31003805f, -0.95072415f },
+    {  0.30930876f, -0.95096167f },  {  0.30857929f, -0.95119862f },  {  0.30784964f, -0.95143502f },
+    {  0.30711981f, -0.95167086f },  {  0.30638980f, -0.95190614f },  {  0.30565960f, -0.95214085f },
+    {  0.30492923f, -0.95237501f },  {  0.30419868f, -0.95260861f },  {  0.30346795f, -0.95284165f },
+    {  0.30273704f, -0.95307412f },  {  0.30200595f, -0.95330604f },  {  0.30127468f, -0.95353740f },
+    {  0.30054324f, -0.95376819f },  {  0.29981162f, -0.95399842f },  {  0.29907983f, -0.95422810f },
+    {  0.29834785f, -0.95445721f },  {  0.29761571f, -0.95468575f },  {  0.29688339f, -0.95491374f },
+    {  0.29615089f, -0.95514117f },  {  0.29541822f, -0.95536803f },  {  0.29468537f, -0.95559433f },
+    {  0.29395235f, -0.95582007f },  {  0.29321916f, -0.95604525f },  {  0.29248580f, -0.95626987f },
+    {  0.29175226f, -0.95649392f },  {  0.29101856f, -0.95671741f },  {  0.29028468f, -0.95694034f },
+    {  0.28955063f, -0.95716270f },  {  0.28881641f, -0.95738450f },  {  0.28808202f, -0.95760574f },
+    {  0.28734746f, -0.95782641f },  {  0.28661273f, -0.95804652f },  {  0.28587783f, -0.95826607f },
+    {  0.28514277f, -0.95848506f },  {  0.28440754f, -0.95870347f },  {  0.28367214f, -0.95892133f },
+    {  0.28293657f, -0.95913862f },  {  0.28220084f, -0.95935535f },  {  0.28146494f, -0.95957151f },
+    {  0.28072887f, -0.95978711f },  {  0.27999264f, -0.96000215f },  {  0.27925625f, -0.96021662f },
+    {  0.27851969f, -0.96043052f },  {  0.27778297f, -0.96064386f },  {  0.27704608f, -0.96085663f },
+    {  0.27630903f, -0.96106884f },  {  0.27557182f, -0.96128049f },  {  0.27483445f, -0.96149156f },
+    {  0.27409691f, -0.96170208f },  {  0.27335921f, -0.96191202f },  {  0.27262136f, -0.96212140f },
+    {  0.27188334f, -0.96233022f },  {  0.27114516f, -0.96253847f },  {  0.27040682f, -0.96274615f },
+    {  0.26966833f, -0.96295327f },  {  0.26892967f, -0.96315982f },  {  0.26819086f, -0.96336580f },
+    {  0.26745189f, -0.96357122f },  {  0.26671276f, -0.96377607f },  {  0.26597347f, -0.96398035f },
+    {  0.26523403f, -0.96418406f },  {  0.26449443f, -0.96438721f },  {  0.26375468f, -0.96458979f },
+    {  0.26301477f, -0.96479181f },  {  0.26227471f, -0.96499325f },  {  0.26153449f, -0.96519413f },
+    {  0.26079412f, -0.96539444f },  {  0.26005359f, -0.96559418f },  {  0.25931292f, -0.96579336f },
+    {  0.25857208f, -0.96599197f },  {  0.25783110f, -0.96619000f },  {  0.25708997f, -0.96638747f },
+    {  0.25634868f, -0.96658437f },  {  0.25560725f, -0.96678071f },  {  0.25486566f, -0.96697647f },
+    {  0.25412392f, -0.96717167f },  {  0.25338204f, -0.96736629f },  {  0.25264000f, -0.96756035f },
+    {  0.25189782f, -0.96775384f },  {  0.25115549f, -0.96794676f },  {  0.25041301f, -0.96813910f },
+    {  0.24967038f, -0.96833088f },  {  0.24892761f, -0.96852209f },  {  0.24818469f, -0.96871273f },
+    {  0.24744162f, -0.96890280f },  {  0.24669841f, -0.96909231f },  {  0.24595505f, -0.96928124f },
+    {  0.24521155f, -0.96946960f },  {  0.24446790f, -0.96965739f },  {  0.24372411f, -0.96984460f },
+    {  0.24298018f, -0.97003125f },  {  0.24223610f, -0.97021733f },  {  0.24149189f, -0.97040284f },
+    {  0.24074752f, -0.97058778f },  {  0.24000302f, -0.97077214f },  {  0.23925838f, -0.97095594f },
+    {  0.23851359f, -0.97113916f },  {  0.23776867f, -0.97132181f },  {  0.23702361f, -0.97150389f },
+    {  0.23627840f, -0.97168540f },  {  0.23553306f, -0.97186634f },  {  0.23478758f, -0.97204670f },
+    {  0.23404196f, -0.97222650f },  {  0.23329620f, -0.97240572f },  {  0.23255031f, -0.97258437f },
+    {  0.23180428f, -0.97276245f },  {  0.23105811f, -0.97293995f },  {  0.23031180f, -0.97311689f },
+    {  0.22956537f, -0.97329325f },  {  0.22881879f, -0.97346903f },  {  0.22807208f, -0.97364425f },
+    {  0.22732524f, -0.97381889f },  {  0.22657826f, -0.97399296f },  {  0.22583115f, -0.97416646f },
+    {  0.22508391f, -0.97433938f },  {  0.22433654f, -0.97451173f },  {  0.22358903f, -0.97468351f },
+    {  0.22284139f, -0.97485471f },  {  0.22209362f, -0.97502535f },  {  0.22134572f, -0.97519540f },
+    {  0.22059769f, -0.97536489f },  {  0.21984953f, -0.97553379f },  {  0.21910124f, -0.97570213f },
+    {  0.21835282f, -0.97586989f },  {  0.21760427f, -0.97603708f },  {  0.21685560f, -0.97620369f },
+    {  0.21610680f, -0.97636973f },  {  0.21535787f, -0.97653520f },  {  0.21460881f, -0.97670009f },
+    {  0.21385963f, -0.97686440f },  {  0.21311032f, -0.97702814f },  {  0.21236089f, -0.97719131f },
+    {  0.21161133f, -0.97735390f },  {  0.21086164f, -0.97751592f },  {  0.21011184f, -0.97767736f },
+    {  0.20936191f, -0.97783822f },  {  0.20861185f, -0.97799851f },  {  0.20786168f, -0.97815823f },
+    {  0.20711138f, -0.97831737f },  {  0.20636096f, -0.97847594f },  {  0.20561041f, -0.97863392f },
+    {  0.20485975f, -0.97879134f },  {  0.20410897f, -0.97894818f },  {  0.20335806f, -0.97910444f },
+    {  0.20260704f, -0.97926012f },  {  0.20185590f, -0.97941523f },  {  0.20110463f, -0.97956977f },
+    {  0.20035326f, -0.97972372f },  {  0.19960176f, -0.97987710f },  {  0.19885014f, -0.98002991f },
+    {  0.19809841f, -0.98018214f },  {  0.19734656f, -0.98033379f },  {  0.19659460f, -0.98048486f },
+    {  0.19584252f, -0.98063536f },  {  0.19509032f, -0.98078528f },  {  0.19433801f, -0.98093462f },
+    {  0.19358559f, -0.98108339f },  {  0.19283305f, -0.98123158f },  {  0.19208040f, -0.98137919f },
+    {  0.19132763f, -0.98152623f },  {  0.19057475f, -0.98167269f },  {  0.18982177f, -0.98181857f },
+    {  0.18906866f, -0.98196387f },  {  0.18831545f, -0.98210859f },  {  0.18756213f, -0.98225274f },
+    {  0.18680870f, -0.98239631f },  {  0.18605515f, -0.98253930f },  {  0.18530150f, -0.98268172f },
+    {  0.18454774f, -0.98282355f },  {  0.18379387f, -0.98296481f },  {  0.18303989f, -0.98310549f },
+    {  0.18228580f, -0.98324559f },  {  0.18153161f, -0.98338511f },  {  0.18077731f, -0.98352405f },
+    {  0.18002290f, -0.98366242f },  {  0.17926839f, -0.98380021f },  {  0.17851377f, -0.98393741f },
+    {  0.17775905f, -0.98407404f },  {  0.17700422f, -0.98421009f },  {  0.17624929f, -0.98434556f },
+    {  0.17549425f, -0.98448046f },  {  0.17473911f, -0.98461477f },  {  0.17398387f, -0.98474850f },
+    {  0.17322853f, -0.98488166f },  {  0.17247308f, -0.98501423f },  {  0.17171754f, -0.98514623f },
+    {  0.17096189f, -0.98527764f },  {  0.17020614f, -0.98540848f },  {  0.16945029f, -0.98553874f },
+    {  0.16869434f, -0.98566841f },  {  0.16793829f, -0.98579751f },  {  0.16718215f, -0.98592603f },
+    {  0.16642590f, -0.98605396f },  {  0.16566956f, -0.98618132f },  {  0.16491312f, -0.98630810f },
+    {  0.16415658f, -0.98643429f },  {  0.16339995f, -0.98655991f },  {  0.16264322f, -0.98668495f },
+    {  0.16188639f, -0.98680940f },  {  0.16112947f, -0.98693328f },  {  0.16037246f, -0.98705657f },
+    {  0.15961535f, -0.98717929f },  {  0.15885814f, -0.98730142f },  {  0.15810085f, -0.98742297f },
+    {  0.15734346f, -0.98754394f },  {  0.15658597f, -0.98766433f },  {  0.15582840f, -0.98778414f },
+    {  0.15507073f, -0.98790337f },  {  0.15431297f, -0.98802202f },  {  0.15355512f, -0.98814008f },
+    {  0.15279719f, -0.98825757f },  {  0.15203916f, -0.98837447f },  {  0.15128104f, -0.98849079f },
+    {  0.15052283f, -0.98860653f },  {  0.14976453f, -0.98872169f },  {  0.14900615f, -0.98883627f },
+    {  0.14824768f, -0.98895026f },  {  0.14748912f, -0.98906368f },  {  0.14673047f, -0.98917651f },
+    {  0.14597174f, -0.98928876f },  {  0.14521292f, -0.98940043f },  {  0.14445402f, -0.98951151f },
+    {  0.14369503f, -0.98962202f },  {  0.14293596f, -0.98973194f },  {  0.14217680f, -0.98984128f },
+    {  0.14141756f, -0.98995004f },  {  0.14065824f, -0.99005821f },  {  0.13989883f, -0.99016580f },
+    {  0.13913934f, -0.99027281f },  {  0.13837977f, -0.99037924f },  {  0.13762012f, -0.99048508f },
+    {  0.13686039f, -0.99059035f },  {  0.13610058f, -0.99069503f },  {  0.13534068f, -0.99079912f },
+    {  0.13458071f, -0.99090264f },  {  0.13382066f, -0.99100557f },  {  0.13306053f, -0.99110791f },
+    {  0.13230032f, -0.99120968f },  {  0.13154003f, -0.99131086f },  {  0.13077966f, -0.99141146f },
+    {  0.13001922f, -0.99151147f },  {  0.12925870f, -0.99161091f },  {  0.12849811f, -0.99170975f },
+    {  0.12773744f, -0.99180802f },  {  0.12697670f, -0.99190570f },  {  0.12621588f, -0.99200280f },
+    {  0.12545498f, -0.99209931f },  {  0.12469402f, -0.99219524f },  {  0.12393298f, -0.99229059f },
+    {  0.12317186f, -0.99238535f },  {  0.12241068f, -0.99247953f },  {  0.12164942f, -0.99257313f },
+    {  0.12088809f, -0.99266614f },  {  0.12012669f, -0.99275857f },  {  0.11936521f, -0.99285041f },
+    {  0.11860367f, -0.99294167f },  {  0.11784206f, -0.99303235f },  {  0.11708038f, -0.99312244f },
+    {  0.11631863f, -0.99321195f },  {  0.11555681f, -0.99330087f },  {  0.11479493f, -0.99338921f },
+    {  0.11403297f, -0.99347697f },  {  0.11327095f, -0.99356414f },  {  0.11250886f, -0.99365072f },
+    {  0.11174671f, -0.99373672f },  {  0.11098449f, -0.99382214f },  {  0.11022221f, -0.99390697f },
+    {  0.10945986f, -0.99399122f },  {  0.10869744f, -0.99407488f },  {  0.10793497f, -0.99415796f },
+    {  0.10717242f, -0.99424045f },  {  0.10640982f, -0.99432236f },  {  0.10564715f, -0.99440368f },
+    {  0.10488442f, -0.99448442f },  {  0.10412163f, -0.99456457f },  {  0.10335878f, -0.99464414f },
+    {  0.10259587f, -0.99472312f },  {  0.10183290f, -0.99480152f },  {  0.10106986f, -0.99487933f },
+    {  0.10030677f, -0.99495656f },  {  0.09954362f, -0.99503320f },  {  0.09878041f, -0.99510926f },
+    {  0.09801714f, -0.99518473f },  {  0.09725381f, -0.99525961f },  {  0.09649043f, -0.99533391f },
+    {  0.09572699f, -0.99540763f },  {  0.09496350f, -0.99548076f },  {  0.09419994f, -0.99555330f },
+    {  0.09343634f, -0.99562526f },  {  0.09267267f, -0.99569663f },  {  0.09190896f, -0.99576741f },
+    {  0.09114519f, -0.99583761f },  {  0.09038136f, -0.99590723f },  {  0.08961748f, -0.99597626f },
+    {  0.08885355f, -0.99604470f },  {  0.08808957f, -0.99611256f },  {  0.08732554f, -0.99617983f },
+    {  0.08656145f, -0.99624651f },  {  0.08579731f, -0.99631261f },  {  0.08503312f, -0.99637812f },
+    {  0.08426889f, -0.99644305f },  {  0.08350460f, -0.99650739f },  {  0.08274026f, -0.99657115f },
+    {  0.08197588f, -0.99663431f },  {  0.08121145f, -0.99669690f },  {  0.08044697f, -0.99675889f },
+    {  0.07968244f, -0.99682030f },  {  0.07891786f, -0.99688112f },  {  0.07815324f, -0.99694136f },
+    {  0.07738857f, -0.99700101f },  {  0.07662386f, -0.99706007f },  {  0.07585910f, -0.99711855f },
+    {  0.07509430f, -0.99717644f },  {  0.07432945f, -0.99723374f },  {  0.07356456f, -0.99729046f },
+    {  0.07279963f, -0.99734659f },  {  0.07203465f, -0.99740213f },  {  0.07126963f, -0.99745709f },
+    {  0.07050457f, -0.99751146f },  {  0.06973947f, -0.99756524f },  {  0.06897433f, -0.99761844f },
+    {  0.06820914f, -0.99767104f },  {  0.06744392f, -0.99772307f },  {  0.06667866f, -0.99777450f },
+    {  0.06591335f, -0.99782535f },  {  0.06514801f, -0.99787561f },  {  0.06438263f, -0.99792529f },
+    {  0.06361721f, -0.99797437f },  {  0.06285176f, -0.99802287f },  {  0.06208627f, -0.99807079f },
+    {  0.06132074f, -0.99811811f },  {  0.06055517f, -0.99816485f },  {  0.05978957f, -0.99821100f },
+    {  0.05902393f, -0.99825657f },  {  0.05825826f, -0.99830154f },  {  0.05749256f, -0.99834593f },
+    {  0.05672682f, -0.99838974f },  {  0.05596105f, -0.99843295f },  {  0.05519524f, -0.99847558f },
+    {  0.05442941f, -0.99851762f },  {  0.05366354f, -0.99855907f },  {  0.05289764f, -0.99859994f },
+    {  0.05213170f, -0.99864022f },  {  0.05136574f, -0.99867991f },  {  0.05059975f, -0.99871901f },
+    {  0.04983373f, -0.99875753f },  {  0.04906767f, -0.99879546f },  {  0.04830159f, -0.99883280f },
+    {  0.04753548f, -0.99886955f },  {  0.04676935f, -0.99890572f },  {  0.04600318f, -0.99894129f },
+    {  0.04523699f, -0.99897628f },  {  0.04447077f, -0.99901069f },  {  0.04370453f, -0.99904450f },
+    {  0.04293826f, -0.99907773f },  {  0.04217196f, -0.99911037f },  {  0.04140564f, -0.99914242f },
+    {  0.04063930f, -0.99917388f },  {  0.03987293f, -0.99920476f },  {  0.03910654f, -0.99923505f },
+    {  0.03834012f, -0.99926475f },  {  0.03757368f, -0.99929386f },  {  0.03680722f, -0.99932238f },
+    {  0.03604074f, -0.99935032f },  {  0.03527424f, -0.99937767f },  {  0.03450772f, -0.99940443f },
+    {  0.03374117f, -0.99943060f },  {  0.03297461f, -0.99945619f },  {  0.03220803f, -0.99948119f },
+    {  0.03144142f, -0.99950560f },  {  0.03067480f, -0.99952942f },  {  0.02990816f, -0.99955265f },
+    {  0.02914151f, -0.99957530f },  {  0.02837484f, -0.99959735f },  {  0.02760815f, -0.99961882f },
+    {  0.02684144f, -0.99963970f },  {  0.02607472f, -0.99966000f },  {  0.02530798f, -0.99967970f },
+    {  0.02454123f, -0.99969882f },  {  0.02377446f, -0.99971735f },  {  0.02300768f, -0.99973529f },
+    {  0.02224089f, -0.99975264f },  {  0.02147408f, -0.99976941f },  {  0.02070726f, -0.99978558f },
+    {  0.01994043f, -0.99980117f },  {  0.01917358f, -0.99981617f },  {  0.01840673f, -0.99983058f },
+    {  0.01763986f, -0.99984441f },  {  0.01687299f, -0.99985764f },  {  0.01610610f, -0.99987029f },
+    {  0.01533921f, -0.99988235f },  {  0.01457230f, -0.99989382f },  {  0.01380539f, -0.99990470f },
+    {  0.01303847f, -0.99991500f },  {  0.01227154f, -0.99992470f },  {  0.01150460f, -0.99993382f },
+    {  0.01073766f, -0.99994235f },  {  0.00997071f, -0.99995029f },  {  0.00920375f, -0.99995764f },
+    {  0.00843679f, -0.99996441f },  {  0.00766983f, -0.99997059f },  {  0.00690286f, -0.99997617f },
+    {  0.00613588f, -0.99998118f },  {  0.00536891f, -0.99998559f },  {  0.00460193f, -0.99998941f },
+    {  0.00383494f, -0.99999265f },  {  0.00306796f, -0.99999529f },  {  0.00230097f, -0.99999735f },
+    {  0.00153398f, -0.99999882f },  {  0.00076699f, -0.99999971f },  {  0.00000000f, -1.00000000f },
+    { -0.00076699f, -0.99999971f },  { -0.00153398f, -0.99999882f },  { -0.00230097f, -0.99999735f },
+    { -0.00306796f, -0.99999529f },  { -0.00383494f, -0.99999265f },  { -0.00460193f, -0.99998941f },
+    { -0.00536891f, -0.99998559f },  { -0.00613588f, -0.99998118f },  { -0.00690286f, -0.99997617f },
+    { -0.00766983f, -0.99997059f },  { -0.00843679f, -0.99996441f },  { -0.00920375f, -0.99995764f },
+    { -0.00997071f, -0.99995029f },  { -0.01073766f, -0.99994235f },  { -0.01150460f, -0.99993382f },
+    { -0.01227154f, -0.99992470f },  { -0.01303847f, -0.99991500f },  { -0.01380539f, -0.99990470f },
+    { -0.01457230f, -0.99989382f },  { -0.01533921f, -0.99988235f },  { -0.01610610f, -0.99987029f },
+    { -0.01687299f, -0.99985764f },  { -0.01763986f, -0.99984441f },  { -0.01840673f, -0.99983058f },
+    { -0.01917358f, -0.99981617f },  { -0.01994043f, -0.99980117f },  { -0.02070726f, -0.99978558f },
+    { -0.02147408f, -0.99976941f },  { -0.02224089f, -0.99975264f },  { -0.02300768f, -0.99973529f },
+    { -0.02377446f, -0.99971735f },  { -0.02454123f, -0.99969882f },  { -0.02530798f, -0.99967970f },
+    { -0.02607472f, -0.99966000f },  { -0.02684144f, -0.99963970f },  { -0.02760815f, -0.99961882f },
+    { -0.02837484f, -0.99959735f },  { -0.02914151f, -0.99957530f },  { -0.02990816f, -0.99955265f },
+    { -0.03067480f, -0.99952942f },  { -0.03144142f, -0.99950560f },  { -0.03220803f, -0.99948119f },
+    { -0.03297461f, -0.99945619f },  { -0.03374117f, -0.99943060f },  { -0.03450772f, -0.99940443f },
+    { -0.03527424f, -0.99937767f },  { -0.03604074f, -0.99935032f },  { -0.03680722f, -0.99932238f },
+    { -0.03757368f, -0.99929386f },  { -0.03834012f, -0.99926475f },  { -0.03910654f, -0.99923505f },
+    { -0.03987293f, -0.99920476f },  { -0.04063930f, -0.99917388f },  { -0.04140564f, -0.99914242f },
+    { -0.04217196f, -0.99911037f },  { -0.04293826f, -0.99907773f },  { -0.04370453f, -0.99904450f },
+    { -0.04447077f, -0.99901069f },  { -0.04523699f, -0.99897628f },  { -0.04600318f, -0.99894129f },
+    { -0.04676935f, -0.99890572f },  { -0.04753548f, -0.99886955f },  { -0.04830159f, -0.99883280f },
+    { -0.04906767f, -0.99879546f },  { -0.04983373f, -0.99875753f },  { -0.05059975f, -0.99871901f },
+    { -0.05136574f, -0.99867991f },  { -0.05213170f, -0.99864022f },  { -0.05289764f, -0.99859994f },
+    { -0.05366354f, -0.99855907f },  { -0.05442941f, -0.99851762f },  { -0.05519524f, -0.99847558f },
+    { -0.05596105f, -0.99843295f },  { -0.05672682f, -0.99838974f },  { -0.05749256f, -0.99834593f },
+    { -0.05825826f, -0.99830154f },  { -0.05902393f, -0.99825657f },  { -0.05978957f, -0.99821100f },
+    { -0.06055517f, -0.99816485f },  { -0.06132074f, -0.99811811f },  { -0.06208627f, -0.99807079f },
+    { -0.06285176f, -0.99802287f },  { -0.06361721f, -0.99797437f },  { -0.06438263f, -0.99792529f },
+    { -0.06514801f, -0.99787561f },  { -0.06591335f, -0.99782535f },  { -0.06667866f, -0.99777450f },
+    { -0.06744392f, -0.99772307f },  { -0.06820914f, -0.99767104f },  { -0.06897433f, -0.99761844f },
+    { -0.06973947f, -0.99756524f },  { -0.07050457f, -0.99751146f },  { -0.07126963f, -0.99745709f },
+    { -0.07203465f, -0.99740213f },  { -0.07279963f, -0.99734659f },  { -0.07356456f, -0.99729046f },
+    { -0.07432945f, -0.99723374f },  { -0.07509430f, -0.99717644f },  { -0.07585910f, -0.99711855f },
+    { -0.07662386f, -0.99706007f },  { -0.07738857f, -0.99700101f },  { -0.07815324f, -0.99694136f },
+    { -0.07891786f, -0.99688112f },  { -0.07968244f, -0.99682030f },  { -0.08044697f, -0.99675889f },
+    { -0.08121145f, -0.99669690f },  { -0.08197588f, -0.99663431f },  { -0.08274026f, -0.99657115f },
+    { -0.08350460f, -0.99650739f },  { -0.08426889f, -0.99644305f },  { -0.08503312f, -0.99637812f },
+    { -0.08579731f, -0.99631261f },  { -0.08656145f, -0.99624651f },  { -0.08732554f, -0.99617983f },
+    { -0.08808957f, -0.99611256f },  { -0.08885355f, -0.99604470f },  { -0.08961748f, -0.99597626f },
+    { -0.09038136f, -0.99590723f },  { -0.09114519f, -0.99583761f },  { -0.09190896f, -0.99576741f },
+    { -0.09267267f, -0.99569663f },  { -0.09343634f, -0.99562526f },  { -0.09419994f, -0.99555330f },
+    { -0.09496350f, -0.99548076f },  { -0.09572699f, -0.99540763f },  { -0.09649043f, -0.99533391f },
+    { -0.09725381f, -0.99525961f },  { -0.09801714f, -0.99518473f },  { -0.09878041f, -0.99510926f },
+    { -0.09954362f, -0.99503320f },  { -0.10030677f, -0.99495656f },  { -0.10106986f, -0.99487933f },
+    { -0.10183290f, -0.99480152f },  { -0.10259587f, -0.99472312f },  { -0.10335878f, -0.99464414f },
+    { -0.10412163f, -0.99456457f },  { -0.10488442f, -0.99448442f },  { -0.10564715f, -0.99440368f },
+    { -0.10640982f, -0.99432236f },  { -0.10717242f, -0.99424045f },  { -0.10793497f, -0.99415796f },
+    { -0.10869744f, -0.99407488f },  { -0.10945986f, -0.99399122f },  { -0.11022221f, -0.99390697f },
+    { -0.11098449f, -0.99382214f },  { -0.11174671f, -0.99373672f },  { -0.11250886f, -0.99365072f },
+    { -0.11327095f, -0.99356414f },  { -0.11403297f, -0.99347697f },  { -0.11479493f, -0.99338921f },
+    { -0.11555681f, -0.99330087f },  { -0.11631863f, -0.99321195f },  { -0.11708038f, -0.99312244f },
+    { -0.11784206f, -0.99303235f },  { -0.11860367f, -0.99294167f },  { -0.11936521f, -0.99285041f },
+    { -0.12012669f, -0.99275857f },  { -0.12088809f, -0.99266614f },  { -0.12164942f, -0.99257313f },
+    { -0.12241068f, -0.99247953f },  { -0.12317186f, -0.99238535f },  { -0.12393298f, -0.99229059f },
+    { -0.12469402f, -0.99219524f },  { -0.12545498f, -0.99209931f },  { -0.12621588f, -0.99200280f },
+    { -0.12697670f, -0.99190570f },  { -0.12773744f, -0.99180802f },  { -0.12849811f, -0.99170975f },
+    { -0.12925870f, -0.99161091f },  { -0.13001922f, -0.99151147f },  { -0.13077966f, -0.99141146f },
+    { -0.13154003f, -0.99131086f },  { -0.13230032f, -0.99120968f },  { -0.13306053f, -0.99110791f },
+    { -0.13382066f, -0.99100557f },  { -0.13458071f, -0.99090264f },  { -0.13534068f, -0.99079912f },
+    { -0.13610058f, -0.99069503f },  { -0.13686039f, -0.99059035f },  { -0.13762012f, -0.99048508f },
+    { -0.13837977f, -0.99037924f },  { -0.13913934f, -0.99027281f },  { -0.13989883f, -0.99016580f },
+    { -0.14065824f, -0.99005821f },  { -0.14141756f, -0.98995004f },  { -0.14217680f, -0.98984128f },
+    { -0.14293596f, -0.98973194f },  { -0.14369503f, -0.98962202f },  { -0.14445402f, -0.98951151f },
+    { -0.14521292f, -0.98940043f },  { -0.14597174f, -0.98928876f },  { -0.14673047f, -0.98917651f },
+    { -0.14748912f, -0.98906368f },  { -0.14824768f, -0.98895026f },  { -0.14900615f, -0.98883627f },
+    { -0.14976453f, -0.98872169f },  { -0.15052283f, -0.98860653f },  { -0.15128104f, -0.98849079f },
+    { -0.15203916f, -0.98837447f },  { -0.15279719f, -0.98825757f },  { -0.15355512f, -0.98814008f },
+    { -0.15431297f, -0.98802202f },  { -0.15507073f, -0.98790337f },  { -0.15582840f, -0.98778414f },
+    { -0.15658597f, -0.98766433f },  { -0.15734346f, -0.98754394f },  { -0.15810085f, -0.98742297f },
+    { -0.15885814f, -0.98730142f },  { -0.15961535f, -0.98717929f },  { -0.16037246f, -0.98705657f },
+    { -0.16112947f, -0.98693328f },  { -0.16188639f, -0.98680940f },  { -0.16264322f, -0.98668495f },
+    { -0.16339995f, -0.98655991f },  { -0.16415658f, -0.98643429f },  { -0.16491312f, -0.98630810f },
+    { -0.16566956f, -0.98618132f },  { -0.16642590f, -0.98605396f },  { -0.16718215f, -0.98592603f },
+    { -0.16793829f, -0.98579751f },  { -0.16869434f, -0.98566841f },  { -0.16945029f, -0.98553874f },
+    { -0.17020614f, -0.98540848f },  { -0.17096189f, -0.98527764f },  { -0.17171754f, -0.98514623f },
+    { -0.17247308f, -0.98501423f },  { -0.17322853f, -0.98488166f },  { -0.17398387f, -0.98474850f },
+    { -0.17473911f, -0.98461477f },  { -0.17549425f, -0.98448046f },  { -0.17624929f, -0.98434556f },
+    { -0.17700422f, -0.98421009f },  { -0.17775905f, -0.98407404f },  { -0.17851377f, -0.98393741f },
+    { -0.17926839f, -0.98380021f },  { -0.18002290f, -0.98366242f },  { -0.18077731f, -0.98352405f },
+    { -0.18153161f, -0.98338511f },  { -0.18228580f, -0.98324559f },  { -0.18303989f, -0.98310549f },
+    { -0.18379387f, -0.98296481f },  { -0.18454774f, -0.98282355f },  { -0.18530150f, -0.98268172f },
+    { -0.18605515f, -0.98253930f },  { -0.18680870f, -0.98239631f },  { -0.18756213f, -0.98225274f },
+    { -0.18831545f, -0.98210859f },  { -0.18906866f, -0.98196387f },  { -0.18982177f, -0.98181857f },
+    { -0.19057475f, -0.98167269f },  { -0.19132763f, -0.98152623f },  { -0.19208040f, -0.98137919f },
+    { -0.19283305f, -0.98123158f },  { -0.19358559f, -0.98108339f },  { -0.19433801f, -0.98093462f },
+    { -0.19509032f, -0.98078528f },  { -0.19584252f, -0.98063536f },  { -0.19659460f, -0.98048486f },
+    { -0.19734656f, -0.98033379f },  { -0.19809841f, -0.98018214f },  { -0.19885014f, -0.98002991f },
+    { -0.19960176f, -0.97987710f },  { -0.20035326f, -0.97972372f },  { -0.20110463f, -0.97956977f },
+    { -0.20185590f, -0.97941523f },  { -0.20260704f, -0.97926012f },  { -0.20335806f, -0.97910444f },
+    { -0.20410897f, -0.97894818f },  { -0.20485975f, -0.97879134f },  { -0.20561041f, -0.97863392f },
+    { -0.20636096f, -0.97847594f },  { -0.20711138f, -0.97831737f },  { -0.20786168f, -0.97815823f },
+    { -0.20861185f, -0.97799851f },  { -0.20936191f, -0.97783822f },  { -0.21011184f, -0.97767736f },
+    { -0.21086164f, -0.97751592f },  { -0.21161133f, -0.97735390f },  { -0.21236089f, -0.97719131f },
+    { -0.21311032f, -0.97702814f },  { -0.21385963f, -0.97686440f },  { -0.21460881f, -0.97670009f },
+    { -0.21535787f, -0.97653520f },  { -0.21610680f, -0.97636973f },  { -0.21685560f, -0.97620369f },
+    { -0.21760427f, -0.97603708f },  { -0.21835282f, -0.97586989f },  { -0.21910124f, -0.97570213f },
+    { -0.21984953f, -0.97553379f },  { -0.22059769f, -0.97536489f },  { -0.22134572f, -0.97519540f },
+    { -0.22209362f, -0.97502535f },  { -0.22284139f, -0.97485471f },  { -0.22358903f, -0.97468351f },
+    { -0.22433654f, -0.97451173f },  { -0.22508391f, -0.97433938f },  { -0.22583115f, -0.97416646f },
+    { -0.22657826f, -0.97399296f },  { -0.22732524f, -0.97381889f },  { -0.22807208f, -0.97364425f },
+    { -0.22881879f, -0.97346903f },  { -0.22956537f, -0.97329325f },  { -0.23031180f, -0.97311689f },
+    { -0.23105811f, -0.97293995f },  { -0.23180428f, -0.97276245f },  { -0.23255031f, -0.97258437f },
+    { -0.23329620f, -0.97240572f },  { -0.23404196f, -0.97222650f },  { -0.23478758f, -0.97204670f },
+    { -0.23553306f, -0.97186634f },  { -0.23627840f, -0.97168540f },  { -0.23702361f, -0.97150389f },
+    { -0.23776867f, -0.97132181f },  { -0.23851359f, -0.97113916f },  { -0.23925838f, -0.97095594f },
+    { -0.24000302f, -0.97077214f },  { -0.24074752f, -0.97058778f },  { -0.24149189f, -0.97040284f },
+    { -0.24223610f, -0.97021733f },  { -0.24298018f, -0.97003125f },  { -0.24372411f, -0.96984460f },
+    { -0.24446790f, -0.96965739f },  { -0.24521155f, -0.96946960f },  { -0.24595505f, -0.96928124f },
+    { -0.24669841f, -0.96909231f },  { -0.24744162f, -0.96890280f },  { -0.24818469f, -0.96871273f },
+    { -0.24892761f, -0.96852209f },  { -0.24967038f, -0.96833088f },  { -0.25041301f, -0.96813910f },
+    { -0.25115549f, -0.96794676f },  { -0.25189782f, -0.96775384f },  { -0.25264000f, -0.96756035f },
+    { -0.25338204f, -0.96736629f },  { -0.25412392f, -0.96717167f },  { -0.25486566f, -0.96697647f },
+    { -0.25560725f, -0.96678071f },  { -0.25634868f, -0.96658437f },  { -0.25708997f, -0.96638747f },
+    { -0.25783110f, -0.96619000f },  { -0.25857208f, -0.96599197f },  { -0.25931292f, -0.96579336f },
+    { -0.26005359f, -0.96559418f },  { -0.26079412f, -0.96539444f },  { -0.26153449f, -0.96519413f },
+    { -0.26227471f, -0.96499325f },  { -0.26301477f, -0.96479181f },  { -0.26375468f, -0.96458979f },
+    { -0.26449443f, -0.96438721f },  { -0.26523403f, -0.96418406f },  { -0.26597347f, -0.96398035f },
+    { -0.26671276f, -0.96377607f },  { -0.26745189f, -0.96357122f },  { -0.26819086f, -0.96336580f },
+    { -0.26892967f, -0.96315982f },  { -0.26966833f, -0.96295327f },  { -0.27040682f, -0.96274615f },
+    { -0.27114516f, -0.96253847f },  { -0.27188334f, -0.96233022f },  { -0.27262136f, -0.96212140f },
+    { -0.27335921f, -0.96191202f },  { -0.27409691f, -0.96170208f },  { -0.27483445f, -0.96149156f },
+    { -0.27557182f, -0.96128049f },  { -0.27630903f, -0.96106884f },  { -0.27704608f, -0.96085663f },
+    { -0.27778297f, -0.96064386f },  { -0.27851969f, -0.96043052f },  { -0.27925625f, -0.96021662f },
+    { -0.27999264f, -0.96000215f },  { -0.28072887f, -0.95978711f },  { -0.28146494f, -0.95957151f },
+    { -0.28220084f, -0.95935535f },  { -0.28293657f, -0.95913862f },  { -0.28367214f, -0.95892133f },
+    { -0.28440754f, -0.95870347f },  { -0.28514277f, -0.95848506f },  { -0.28587783f, -0.95826607f },
+    { -0.28661273f, -0.95804652f },  { -0.28734746f, -0.95782641f },  { -0.28808202f, -0.95760574f },
+    { -0.28881641f, -0.95738450f },  { -0.28955063f, -0.95716270f },  { -0.29028468f, -0.95694034f },
+    { -0.29101856f, -0.95671741f },  { -0.29175226f, -0.95649392f },  { -0.29248580f, -0.95626987f },
+    { -0.29321916f, -0.95604525f },  { -0.29395235f, -0.95582007f },  { -0.29468537f, -0.95559433f },
+    { -0.29541822f, -0.95536803f },  { -0.29615089f, -0.95514117f },  { -0.29688339f, -0.95491374f },
+    { -0.29761571f, -0.95468575f },  { -0.29834785f, -0.95445721f },  { -0.29907983f, -0.95422810f },
+    { -0.29981162f, -0.95399842f },  { -0.30054324f, -0.95376819f },  { -0.30127468f, -0.95353740f },
+    { -0.30200595f, -0.95330604f },  { -0.30273704f, -0.95307412f },  { -0.30346795f, -0.95284165f },
+    { -0.30419868f, -0.95260861f },  { -0.30492923f, -0.95237501f },  { -0.30565960f, -0.95214085f },
+    { -0.30638980f, -0.95190614f },  { -0.30711981f, -0.95167086f },  { -0.30784964f, -0.95143502f },
+    { -0.30857929f, -0.95119862f },  { -0.30930876f, -0.95096167f },  { -0.31003805f, -0.95072415f },
+    { -0.31076715f, -0.95048607f },  { -0.31149607f, -0.95024744f },  { -0.31222481f, -0.95000825f },
+    { -0.31295337f, -0.94976849f },  { -0.31368174f, -0.94952818f },  { -0.31440993f, -0.94928731f },
+    { -0.31513793f, -0.94904588f },  { -0.31586575f, -0.94880389f },  { -0.31659338f, -0.94856135f },
+    { -0.31732082f, -0.94831825f },  { -0.31804808f, -0.94807459f },  { -0.31877515f, -0.94783037f },
+    { -0.31950203f, -0.94758559f },  { -0.32022873f, -0.94734026f },  { -0.32095523f, -0.94709437f },
+    { -0.32168155f, -0.94684792f },  { -0.32240768f, -0.94660091f },  { -0.32313362f, -0.94635335f },
+    { -0.32385937f, -0.94610523f },  { -0.32458492f, -0.94585656f },  { -0.32531029f, -0.94560733f },
+    { -0.32603547f, -0.94535754f },  { -0.32676045f, -0.94510719f },  { -0.32748524f, -0.94485629f },
+    { -0.32820984f, -0.94460484f },  { -0.32893425f, -0.94435283f },  { -0.32965846f, -0.94410026f },
+    { -0.33038248f, -0.94384714f },  { -0.33110631f, -0.94359346f },  { -0.33182994f, -0.94333923f },
+    { -0.33255337f, -0.94308444f },  { -0.33327661f, -0.94282909f },  { -0.33399965f, -0.94257320f },
+    { -0.33472250f, -0.94231675f },  { -0.33544515f, -0.94205974f },  { -0.33616760f, -0.94180218f },
+    { -0.33688985f, -0.94154407f },  { -0.33761191f, -0.94128540f },  { -0.33833377f, -0.94102618f },
+    { -0.33905543f, -0.94076640f },  { -0.33977688f, -0.94050607f },  { -0.34049814f, -0.94024519f },
+    { -0.34121920f, -0.93998375f },  { -0.34194006f, -0.93972176f },  { -0.34266072f, -0.93945922f },
+    { -0.34338117f, -0.93919613f },  { -0.34410143f, -0.93893248f },  { -0.34482148f, -0.93866828f },
+    { -0.34554132f, -0.93840353f },  { -0.34626097f, -0.93813823f },  { -0.34698041f, -0.93787238f },
+    { -0.34769965f, -0.93760597f },  { -0.34841868f, -0.93733901f },  { -0.34913751f, -0.93707150f },
+    { -0.34985613f, -0.93680344f },  { -0.35057455f, -0.93653483f },  { -0.35129276f, -0.93626567f },
+    { -0.35201076f, -0.93599595f },  { -0.35272856f, -0.93572569f },  { -0.35344614f, -0.93545487f },
+    { -0.35416353f, -0.93518351f },  { -0.35488070f, -0.93491159f },  { -0.35559766f, -0.93463913f },
+    { -0.35631442f, -0.93436611f },  { -0.35703096f, -0.93409255f },  { -0.35774730f, -0.93381844f },
+    { -0.35846342f, -0.93354377f },  { -0.35917933f, -0.93326856f },  { -0.35989504f, -0.93299280f },
+    { -0.36061053f, -0.93271649f },  { -0.36132581f, -0.93243963f },  { -0.36204087f, -0.93216222f },
+    { -0.36275572f, -0.93188427f },  { -0.36347036f, -0.93160576f },  { -0.36418479f, -0.93132671f },
+    { -0.36489900f, -0.93104711f },  { -0.36561300f, -0.93076696f },  { -0.36632678f, -0.93048627f },
+    { -0.36704035f, -0.93020502f },  { -0.36775370f, -0.92992323f },  { -0.36846683f, -0.92964090f },
+    { -0.36917975f, -0.92935801f },  { -0.36989245f, -0.92907458f },  { -0.37060493f, -0.92879060f },
+    { -0.37131719f, -0.92850608f },  { -0.37202924f, -0.92822101f },  { -0.37274107f, -0.92793539f },
+    { -0.37345267f, -0.92764923f },  { -0.37416406f, -0.92736253f },  { -0.37487523f, -0.92707527f },
+    { -0.37558618f, -0.92678747f },  { -0.37629691f, -0.92649913f },  { -0.37700741f, -0.92621024f },
+    { -0.37771769f, -0.92592081f },  { -0.37842775f, -0.92563083f },  { -0.37913759f, -0.92534031f },
+    { -0.37984721f, -0.92504924f },  { -0.38055660f, -0.92475763f },  { -0.38126577f, -0.92446547f },
+    { -0.38197471f, -0.92417278f },  { -0.38268343f, -0.92387953f },  { -0.38339193f, -0.92358575f },
+    { -0.38410020f, -0.92329142f },  { -0.38480824f, -0.92299654f },  { -0.38551605f, -0.92270113f },
+    { -0.38622364f, -0.92240517f },  { -0.38693101f, -0.92210867f },  { -0.38763814f, -0.92181163f },
+    { -0.38834505f, -0.92151404f },  { -0.38905172f, -0.92121591f },  { -0.38975817f, -0.92091724f },
+    { -0.39046439f, -0.92061803f },  { -0.39117038f, -0.92031828f },  { -0.39187614f, -0.92001798f },
+    { -0.39258167f, -0.91971715f },  { -0.39328697f, -0.91941577f },  { -0.39399204f, -0.91911385f },
+    { -0.39469688f, -0.91881139f },  { -0.39540148f, -0.91850839f },  { -0.39610585f, -0.91820486f },
+    { -0.39680999f, -0.91790078f },  { -0.39751389f, -0.91759616f },  { -0.39821756f, -0.91729100f },
+    { -0.39892100f, -0.91698530f },  { -0.39962420f, -0.91667906f },  { -0.40032717f, -0.91637228f },
+    { -0.40102990f, -0.91606497f },  { -0.40173239f, -0.91575711f },  { -0.40243465f, -0.91544872f },
+    { -0.40313667f, -0.91513978f },  { -0.40383846f, -0.91483031f },  { -0.40454000f, -0.91452030f },
+    { -0.40524131f, -0.91420976f },  { -0.40594238f, -0.91389867f },  { -0.40664322f, -0.91358705f },
+    { -0.40734381f, -0.91327489f },  { -0.40804416f, -0.91296219f },  { -0.40874428f, -0.91264896f },
+    { -0.40944415f, -0.91233518f },  { -0.41014378f, -0.91202088f },  { -0.41084317f, -0.91170603f },
+    { -0.41154232f, -0.91139065f },  { -0.41224123f, -0.91107473f },  { -0.41293989f, -0.91075828f },
+    { -0.41363831f, -0.91044129f },  { -0.41433649f, -0.91012377f },  { -0.41503442f, -0.90980571f },
+    { -0.41573211f, -0.90948711f },  { -0.41642956f, -0.90916798f },  { -0.41712676f, -0.90884832f },
+    { -0.41782372f, -0.90852812f },  { -0.41852043f, -0.90820738f },  { -0.41921689f, -0.90788612f },
+    { -0.41991310f, -0.90756431f },  { -0.42060907f, -0.90724198f },  { -0.42130480f, -0.90691911f },
+    { -0.42200027f, -0.90659570f },  { -0.42269550f, -0.90627177f },  { -0.42339047f, -0.90594730f },
+    { -0.42408520f, -0.90562229f },  { -0.42477968f, -0.90529676f },  { -0.42547391f, -0.90497069f },
+    { -0.42616789f, -0.90464409f },  { -0.42686162f, -0.90431696f },  { -0.42755509f, -0.90398929f },
+    { -0.42824832f, -0.90366110f },  { -0.42894129f, -0.90333237f },  { -0.42963401f, -0.90300311f },
+    { -0.43032648f, -0.90267332f },  { -0.43101870f, -0.90234300f },  { -0.43171066f, -0.90201214f },
+    { -0.43240237f, -0.90168076f },  { -0.43309382f, -0.90134885f },  { -0.43378502f, -0.90101640f },
+    { -0.43447596f, -0.90068343f },  { -0.43516665f, -0.90034993f },  { -0.43585708f, -0.90001589f },
+    { -0.43654726f, -0.89968133f },  { -0.43723717f, -0.89934624f },  { -0.43792683f, -0.89901062f },
+    { -0.43861624f, -0.89867447f },  { -0.43930538f, -0.89833779f },  { -0.43999427f, -0.89800058f },
+    { -0.44068290f, -0.89766284f },  { -0.44137127f, -0.89732458f },  { -0.44205938f, -0.89698579f },
+    { -0.44274723f, -0.89664647f },  { -0.44343482f, -0.89630662f },  { -0.44412214f, -0.89596625f },
+    { -0.44480921f, -0.89562535f },  { -0.44549602f, -0.89528392f },  { -0.44618256f, -0.89494197f },
+    { -0.44686884f, -0.89459949f },  { -0.44755486f, -0.89425648f },  { -0.44824061f, -0.89391295f },
+    { -0.44892610f, -0.89356889f },  { -0.44961133f, -0.89322430f },  { -0.45029629f, -0.89287919f },
+    { -0.45098099f, -0.89253356f },  { -0.45166542f, -0.89218739f },  { -0.45234959f, -0.89184071f },
+    { -0.45303349f, -0.89149350f },  { -0.45371712f, -0.89114576f },  { -0.45440049f, -0.89079751f },
+    { -0.45508359f, -0.89044872f },  { -0.45576642f, -0.89009942f },  { -0.45644898f, -0.88974959f },
+    { -0.45713128f, -0.88939923f },  { -0.45781330f, -0.88904836f },  { -0.45849506f, -0.88869696f },
+    { -0.45917655f, -0.88834503f },  { -0.45985776f, -0.88799259f },  { -0.46053871f, -0.88763962f },
+    { -0.46121939f, -0.88728613f },  { -0.46189979f, -0.88693212f },  { -0.46257992f, -0.88657759f },
+    { -0.46325978f, -0.88622253f },  { -0.46393937f, -0.88586695f },  { -0.46461869f, -0.88551086f },
+    { -0.46529773f, -0.88515424f },  { -0.46597650f, -0.88479710f },  { -0.46665499f, -0.88443944f },
+    { -0.46733321f, -0.88408126f },  { -0.46801115f, -0.88372256f },  { -0.46868882f, -0.88336334f },
+    { -0.46936622f, -0.88300360f },  { -0.47004333f, -0.88264334f },  { -0.47072017f, -0.88228256f },
+    { -0.47139674f, -0.88192126f },  { -0.47207302f, -0.88155945f },  { -0.47274903f, -0.88119711f },
+    { -0.47342476f, -0.88083426f },  { -0.47410021f, -0.88047089f },  { -0.47477539f, -0.88010700f },
+    { -0.47545028f, -0.87974259f },  { -0.47612490f, -0.87937767f },  { -0.47679923f, -0.87901223f },
+    { -0.47747328f, -0.87864627f },  { -0.47814706f, -0.87827979f },  { -0.47882055f, -0.87791280f },
+    { -0.47949376f, -0.87754529f },  { -0.48016669f, -0.87717727f },  { -0.48083933f, -0.87680872f },
+    { -0.48151169f, -0.87643967f },  { -0.48218377f, -0.87607009f },  { -0.48285557f, -0.87570001f },
+    { -0.48352708f, -0.87532940f },  { -0.48419831f, -0.87495829f },  { -0.48486925f, -0.87458665f },
+    { -0.48553990f, -0.87421451f },  { -0.48621028f, -0.87384184f },  { -0.48688036f, -0.87346867f },
+    { -0.48755016f, -0.87309498f },  { -0.48821967f, -0.87272078f },  { -0.48888890f, -0.87234606f },
+    { -0.48955783f, -0.87197083f },  { -0.49022648f, -0.87159509f },  { -0.49089484f, -0.87121883f },
+    { -0.49156292f, -0.87084206f },  { -0.49223070f, -0.87046478f },  { -0.49289819f, -0.87008699f },
+    { -0.49356540f, -0.86970869f },  { -0.49423231f, -0.86932987f },  { -0.49489893f, -0.86895054f },
+    { -0.49556526f, -0.86857071f },  { -0.49623130f, -0.86819036f },  { -0.49689705f, -0.86780950f },
+    { -0.49756250f, -0.86742813f },  { -0.49822767f, -0.86704625f },  { -0.49889254f, -0.86666385f },
+    { -0.49955711f, -0.86628095f },  { -0.50022139f, -0.86589754f },  { -0.50088538f, -0.86551362f },
+    { -0.50154908f, -0.86512920f },  { -0.50221247f, -0.86474426f },  { -0.50287558f, -0.86435881f },
+    { -0.50353838f, -0.86397286f },  { -0.50420089f, -0.86358639f },  { -0.50486311f, -0.86319942f },
+    { -0.50552503f, -0.86281194f },  { -0.50618665f, -0.86242396f },  { -0.50684797f, -0.86203546f },
+    { -0.50750899f, -0.86164646f },  { -0.50816972f, -0.86125695f },  { -0.50883014f, -0.86086694f },
+    { -0.50949027f, -0.86047642f },  { -0.51015010f, -0.86008539f },  { -0.51080962f, -0.85969386f },
+    { -0.51146885f, -0.85930182f },  { -0.51212778f, -0.85890927f },  { -0.51278640f, -0.85851622f },
+    { -0.51344472f, -0.85812267f },  { -0.51410274f, -0.85772861f },  { -0.51476046f, -0.85733405f },
+    { -0.51541788f, -0.85693898f },  { -0.51607499f, -0.85654340f },  { -0.51673180f, -0.85614733f },
+    { -0.51738830f, -0.85575075f },  { -0.51804450f, -0.85535366f },  { -0.51870040f, -0.85495608f },
+    { -0.51935599f, -0.85455799f },  { -0.52001128f, -0.85415940f },  { -0.52066625f, -0.85376030f },
+    { -0.52132093f, -0.85336070f },  { -0.52197529f, -0.85296060f },  { -0.52262935f, -0.85256000f },
+    { -0.52328310f, -0.85215890f },  { -0.52393655f, -0.85175730f },  { -0.52458968f, -0.85135519f },
+    { -0.52524251f, -0.85095259f },  { -0.52589503f, -0.85054948f },  { -0.52654724f, -0.85014587f },
+    { -0.52719913f, -0.84974177f },  { -0.52785072f, -0.84933716f },  { -0.52850200f, -0.84893206f },
+    { -0.52915297f, -0.84852645f },  { -0.52980362f, -0.84812034f },  { -0.53045397f, -0.84771374f },
+    { -0.53110400f, -0.84730664f },  { -0.53175372f, -0.84689904f },  { -0.53240313f, -0.84649094f },
+    { -0.53305222f, -0.84608234f },  { -0.53370100f, -0.84567325f },  { -0.53434947f, -0.84526365f },
+    { -0.53499762f, -0.84485357f },  { -0.53564546f, -0.84444298f },  { -0.53629298f, -0.84403190f },
+    { -0.53694019f, -0.84362032f },  { -0.53758708f, -0.84320824f },  { -0.53823365f, -0.84279567f },
+    { -0.53887991f, -0.84238260f },  { -0.53952585f, -0.84196904f },  { -0.54017147f, -0.84155498f },
+    { -0.54081678f, -0.84114042f },  { -0.54146177f, -0.84072537f },  { -0.54210643f, -0.84030983f },
+    { -0.54275078f, -0.83989379f },  { -0.54339482f, -0.83947726f },  { -0.54403853f, -0.83906024f },
+    { -0.54468192f, -0.83864272f },  { -0.54532499f, -0.83822471f },  { -0.54596774f, -0.83780620f },
+    { -0.54661017f, -0.83738720f },  { -0.54725227f, -0.83696771f },  { -0.54789406f, -0.83654773f },
+    { -0.54853552f, -0.83612725f },  { -0.54917666f, -0.83570628f },  { -0.54981748f, -0.83528483f },
+    { -0.55045797f, -0.83486287f },  { -0.55109814f, -0.83444043f },  { -0.55173799f, -0.83401750f },
+    { -0.55237751f, -0.83359408f },  { -0.55301671f, -0.83317016f },  { -0.55365558f, -0.83274576f },
+    { -0.55429412f, -0.83232087f },  { -0.55493234f, -0.83189548f },  { -0.55557023f, -0.83146961f },
+    { -0.55620780f, -0.83104325f },  { -0.55684504f, -0.83061640f },  { -0.55748195f, -0.83018906f },
+    { -0.55811853f, -0.82976123f },  { -0.55875479f, -0.82933292f },  { -0.55939071f, -0.82890411f },
+    { -0.56002631f, -0.82847482f },  { -0.56066158f, -0.82804505f },  { -0.56129651f, -0.82761478f },
+    { -0.56193112f, -0.82718403f },  { -0.56256540f, -0.82675279f },  { -0.56319934f, -0.82632106f },
+    { -0.56383296f, -0.82588885f },  { -0.56446624f, -0.82545615f },  { -0.56509919f, -0.82502297f },
+    { -0.56573181f, -0.82458930f },  { -0.56636410f, -0.82415515f },  { -0.56699605f, -0.82372051f },
+    { -0.56762767f, -0.82328539f },  { -0.56825895f, -0.82284978f },  { -0.56888990f, -0.82241369f },
+    { -0.56952052f, -0.82197712f },  { -0.57015080f, -0.82154006f },  { -0.57078075f, -0.82110251f },
+    { -0.57141036f, -0.82066449f },  { -0.57203963f, -0.82022598f },  { -0.57266857f, -0.81978699f },
+    { -0.57329717f, -0.81934752f },  { -0.57392543f, -0.81890757f },  { -0.57455336f, -0.81846713f },
+    { -0.57518094f, -0.81802621f },  { -0.57580819f, -0.81758481f },  { -0.57643510f, -0.81714293f },
+    { -0.57706167f, -0.81670057f },  { -0.57768790f, -0.81625773f },  { -0.57831380f, -0.81581441f },
+    { -0.57893935f, -0.81537061f },  { -0.57956456f, -0.81492633f },  { -0.58018943f, -0.81448157f },
+    { -0.58081396f, -0.81403633f },  { -0.58143815f, -0.81359061f },  { -0.58206199f, -0.81314441f },
+    { -0.58268549f, -0.81269774f },  { -0.58330865f, -0.81225059f },  { -0.58393147f, -0.81180296f },
+    { -0.58455394f, -0.81135485f },  { -0.58517607f, -0.81090626f },  { -0.58579786f, -0.81045720f },
+    { -0.58641930f, -0.81000766f },  { -0.58704039f, -0.80955764f },  { -0.58766114f, -0.80910715f },
+    { -0.58828155f, -0.80865618f },  { -0.58890161f, -0.80820474f },  { -0.58952132f, -0.80775282f },
+    { -0.59014068f, -0.80730042f },  { -0.59075970f, -0.80684755f },  { -0.59137837f, -0.80639421f },
+    { -0.59199669f, -0.80594039f },  { -0.59261467f, -0.80548610f },  { -0.59323230f, -0.80503133f },
+    { -0.59384957f, -0.80457609f },  { -0.59446650f, -0.80412038f },  { -0.59508308f, -0.80366419f },
+    { -0.59569930f, -0.80320753f },  { -0.59631518f, -0.80275040f },  { -0.59693071f, -0.80229280f },
+    { -0.59754588f, -0.80183472f },  { -0.59816071f, -0.80137617f },  { -0.59877518f, -0.80091715f },
+    { -0.59938930f, -0.80045766f },  { -0.60000307f, -0.79999770f },  { -0.60061648f, -0.79953727f },
+    { -0.60122954f, -0.79907637f },  { -0.60184225f, -0.79861499f },  { -0.60245460f, -0.79815315f },
+    { -0.60306660f, -0.79769084f },  { -0.60367824f, -0.79722806f },  { -0.60428953f, -0.79676481f },
+    { -0.60490046f, -0.79630109f },  { -0.60551104f, -0.79583690f },  { -0.60612126f, -0.79537225f },
+    { -0.60673113f, -0.79490713f },  { -0.60734063f, -0.79444154f },  { -0.60794978f, -0.79397548f },
+    { -0.60855858f, -0.79350895f },  { -0.60916701f, -0.79304196f },  { -0.60977509f, -0.79257450f },
+    { -0.61038281f, -0.79210658f },  { -0.61099016f, -0.79163819f },  { -0.61159716f, -0.79116933f },
+    { -0.61220380f, -0.79070001f },  { -0.61281008f, -0.79023022f },  { -0.61341600f, -0.78975997f },
+    { -0.61402156f, -0.78928925f },  { -0.61462676f, -0.78881807f },  { -0.61523159f, -0.78834643f },
+    { -0.61583606f, -0.78787432f },  { -0.61644017f, -0.78740175f },  { -0.61704392f, -0.78692871f },
+    { -0.61764731f, -0.78645521f },  { -0.61825033f, -0.78598125f },  { -0.61885299f, -0.78550683f },
+    { -0.61945528f, -0.78503194f },  { -0.62005721f, -0.78455660f },  { -0.62065878f, -0.78408079f },
+    { -0.62125998f, -0.78360452f },  { -0.62186081f, -0.78312779f },  { -0.62246128f, -0.78265060f },
+    { -0.62306138f, -0.78217294f },  { -0.62366112f, -0.78169483f },  { -0.62426049f, -0.78121626f },
+    { -0.62485949f, -0.78073723f },  { -0.62545812f, -0.78025774f },  { -0.62605639f, -0.77977779f },
+    { -0.62665429f, -0.77929738f },  { -0.62725182f, -0.77881651f },  { -0.62784898f, -0.77833519f },
+    { -0.62844577f, -0.77785340f },  { -0.62904219f, -0.77737116f },  { -0.62963824f, -0.77688847f },
+    { -0.63023392f, -0.77640531f },  { -0.63082923f, -0.77592170f },  { -0.63142417f, -0.77543763f },
+    { -0.63201874f, -0.77495311f },  { -0.63261293f, -0.77446813f },  { -0.63320676f, -0.77398269f },
+    { -0.63380021f, -0.77349680f },  { -0.63439328f, -0.77301045f },  { -0.63498599f, -0.77252365f },
+    { -0.63557832f, -0.77203640f },  { -0.63617028f, -0.77154869f },  { -0.63676186f, -0.77106052f },
+    { -0.63735307f, -0.77057191f },  { -0.63794390f, -0.77008284f },  { -0.63853436f, -0.76959331f },
+    { -0.63912444f, -0.76910334f },  { -0.63971415f, -0.76861291f },  { -0.64030348f, -0.76812203f },
+    { -0.64089244f, -0.76763070f },  { -0.64148101f, -0.76713891f },  { -0.64206921f, -0.76664668f },
+    { -0.64265703f, -0.76615399f },  { -0.64324448f, -0.76566085f },  { -0.64383154f, -0.76516727f },
+    { -0.64441823f, -0.76467323f },  { -0.64500454f, -0.76417874f },  { -0.64559046f, -0.76368380f },
+    { -0.64617601f, -0.76318842f },  { -0.64676118f, -0.76269258f },  { -0.64734597f, -0.76219630f },
+    { -0.64793038f, -0.76169957f },  { -0.64851440f, -0.76120239f },  { -0.64909805f, -0.76070476f },
+    { -0.64968131f, -0.76020668f },  { -0.65026419f, -0.75970816f },  { -0.65084668f, -0.75920919f },
+    { -0.65142880f, -0.75870977f },  { -0.65201053f, -0.75820991f },  { -0.65259188f, -0.75770960f },
+    { -0.65317284f, -0.75720885f },  { -0.65375342f, -0.75670765f },  { -0.65433362f, -0.75620600f },
+    { -0.65491343f, -0.75570391f },  { -0.65549285f, -0.75520138f },  { -0.65607189f, -0.75469840f },
+    { -0.65665055f, -0.75419498f },  { -0.65722881f, -0.75369111f },  { -0.65780669f, -0.75318680f },
+    { -0.65838419f, -0.75268205f },  { -0.65896129f, -0.75217685f },  { -0.65953801f, -0.75167121f },
+    { -0.66011434f, -0.75116513f },  { -0.66069028f, -0.75065861f },  { -0.66126584f, -0.75015165f },
+    { -0.66184100f, -0.74964424f },  { -0.66241578f, -0.74913639f },  { -0.66299016f, -0.74862811f },
+    { -0.66356416f, -0.74811938f },  { -0.66413776f, -0.74761021f },  { -0.66471098f, -0.74710061f },
+    { -0.66528380f, -0.74659056f },  { -0.66585623f, -0.74608007f },  { -0.66642827f, -0.74556915f },
+    { -0.66699992f, -0.74505779f },  { -0.66757118f, -0.74454598f },  { -0.66814204f, -0.74403374f },
+    { -0.66871251f, -0.74352107f },  { -0.66928259f, -0.74300795f },  { -0.66985227f, -0.74249440f },
+    { -0.67042156f, -0.74198041f },  { -0.67099045f, -0.74146599f },  { -0.67155895f, -0.74095113f },
+    { -0.67212706f, -0.74043583f },  { -0.67269477f, -0.73992010f },  { -0.67326208f, -0.73940393f },
+    { -0.67382900f, -0.73888732f },  { -0.67439552f, -0.73837029f },  { -0.67496165f, -0.73785281f },
+    { -0.67552737f, -0.73733491f },  { -0.67609270f, -0.73681657f },  { -0.67665764f, -0.73629780f },
+    { -0.67722217f, -0.73577859f },  { -0.67778631f, -0.73525895f },  { -0.67835004f, -0.73473888f },
+    { -0.67891338f, -0.73421837f },  { -0.67947632f, -0.73369744f },  { -0.68003886f, -0.73317607f },
+    { -0.68060100f, -0.73265427f },  { -0.68116274f, -0.73213204f },  { -0.68172407f, -0.73160938f },
+    { -0.68228501f, -0.73108629f },  { -0.68284555f, -0.73056277f },  { -0.68340568f, -0.73003882f },
+    { -0.68396541f, -0.72951444f },  { -0.68452474f, -0.72898963f },  { -0.68508367f, -0.72846439f },
+    { -0.68564219f, -0.72793872f },  { -0.68620031f, -0.72741263f },  { -0.68675803f, -0.72688611f },
+    { -0.68731534f, -0.72635916f },  { -0.68787225f, -0.72583178f },  { -0.68842875f, -0.72530397f },
+    { -0.68898485f, -0.72477574f },  { -0.68954054f, -0.72424708f },  { -0.69009583f, -0.72371800f },
+    { -0.69065071f, -0.72318849f },  { -0.69120519f, -0.72265855f },  { -0.69175926f, -0.72212819f },
+    { -0.69231292f, -0.72159741f },  { -0.69286617f, -0.72106620f },  { -0.69341902f, -0.72053457f },
+    { -0.69397146f, -0.72000251f },  { -0.69452349f, -0.71947003f },  { -0.69507511f, -0.71893712f },
+    { -0.69562633f, -0.71840380f },  { -0.69617713f, -0.71787005f },  { -0.69672753f, -0.71733587f },
+    { -0.69727751f, -0.71680128f },  { -0.69782709f, -0.71626626f },  { -0.69837625f, -0.71573083f },
+    { -0.69892500f, -0.71519497f },  { -0.69947334f, -0.71465869f },  { -0.70002128f, -0.71412199f },
+    { -0.70056879f, -0.71358487f },  { -0.70111590f, -0.71304733f },  { -0.70166259f, -0.71250937f },
+    { -0.70220888f, -0.71197099f },  { -0.70275474f, -0.71143220f },  { -0.70330020f, -0.71089298f },
+    { -0.70384524f, -0.71035335f },  { -0.70438987f, -0.70981330f },  { -0.70493408f, -0.70927283f },
+    { -0.70547788f, -0.70873194f },  { -0.70602126f, -0.70819064f },  { -0.70656423f, -0.70764892f },
+    { -0.70710678f, -0.70710678f },  { -0.70764892f, -0.70656423f },  { -0.70819064f, -0.70602126f },
+    { -0.70873194f, -0.70547788f },  { -0.70927283f, -0.70493408f },  { -0.70981330f, -0.70438987f },
+    { -0.71035335f, -0.70384524f },  { -0.71089298f, -0.70330020f },  { -0.71143220f, -0.70275474f },
+    { -0.71197099f, -0.70220888f },  { -0.71250937f, -0.70166259f },  { -0.71304733f, -0.70111590f },
+    { -0.71358487f, -0.70056879f },  { -0.71412199f, -0.70002128f },  { -0.71465869f, -0.69947334f },
+    { -0.71519497f, -0.69892500f },  { -0.71573083f, -0.69837625f },  { -0.71626626f, -0.69782709f },
+    { -0.71680128f, -0.69727751f },  { -0.71733587f, -0.69672753f },  { -0.71787005f, -0.69617713f },
+    { -0.71840380f, -0.69562633f },  { -0.71893712f, -0.69507511f },  { -0.71947003f, -0.69452349f },
+    { -0.72000251f, -0.69397146f },  { -0.72053457f, -0.69341902f },  { -0.72106620f, -0.69286617f },
+    { -0.72159741f, -0.69231292f },  { -0.72212819f, -0.69175926f },  { -0.72265855f, -0.69120519f },
+    { -0.72318849f, -0.69065071f },  { -0.72371800f, -0.69009583f },  { -0.72424708f, -0.68954054f },
+    { -0.72477574f, -0.68898485f },  { -0.72530397f, -0.68842875f },  { -0.72583178f, -0.68787225f },
+    { -0.72635916f, -0.68731534f },  { -0.72688611f, -0.68675803f },  { -0.72741263f, -0.68620031f },
+    { -0.72793872f, -0.68564219f },  { -0.72846439f, -0.68508367f },  { -0.72898963f, -0.68452474f },
+    { -0.72951444f, -0.68396541f },  { -0.73003882f, -0.68340568f },  { -0.73056277f, -0.68284555f },
+    { -0.73108629f, -0.68228501f },  { -0.73160938f, -0.68172407f },  { -0.73213204f, -0.68116274f },
+    { -0.73265427f, -0.68060100f },  { -0.73317607f, -0.68003886f },  { -0.73369744f, -0.67947632f },
+    { -0.73421837f, -0.67891338f },  { -0.73473888f, -0.67835004f },  { -0.73525895f, -0.67778631f },
+    { -0.73577859f, -0.67722217f },  { -0.73629780f, -0.67665764f },  { -0.73681657f, -0.67609270f },
+    { -0.73733491f, -0.67552737f },  { -0.73785281f, -0.67496165f },  { -0.73837029f, -0.67439552f },
+    { -0.73888732f, -0.67382900f },  { -0.73940393f, -0.67326208f },  { -0.73992010f, -0.67269477f },
+    { -0.74043583f, -0.67212706f },  { -0.74095113f, -0.67155895f },  { -0.74146599f, -0.67099045f },
+    { -0.74198041f, -0.67042156f },  { -0.74249440f, -0.66985227f },  { -0.74300795f, -0.66928259f },
+    { -0.74352107f, -0.66871251f },  { -0.74403374f, -0.66814204f },  { -0.74454598f, -0.66757118f },
+    { -0.74505779f, -0.66699992f },  { -0.74556915f, -0.66642827f },  { -0.74608007f, -0.66585623f },
+    { -0.74659056f, -0.66528380f },  { -0.74710061f, -0.66471098f },  { -0.74761021f, -0.66413776f },
+    { -0.74811938f, -0.66356416f },  { -0.74862811f, -0.66299016f },  { -0.74913639f, -0.66241578f },
+    { -0.74964424f, -0.66184100f },  { -0.75015165f, -0.66126584f },  { -0.75065861f, -0.66069028f },
+    { -0.75116513f, -0.66011434f },  { -0.75167121f, -0.65953801f },  { -0.75217685f, -0.65896129f },
+    { -0.75268205f, -0.65838419f },  { -0.75318680f, -0.65780669f },  { -0.75369111f, -0.65722881f },
+    { -0.75419498f, -0.65665055f },  { -0.75469840f, -0.65607189f },  { -0.75520138f, -0.65549285f },
+    { -0.75570391f, -0.65491343f },  { -0.75620600f, -0.65433362f },  { -0.75670765f, -0.65375342f },
+    { -0.75720885f, -0.65317284f },  { -0.75770960f, -0.65259188f },  { -0.75820991f, -0.65201053f },
+    { -0.75870977f, -0.65142880f },  { -0.75920919f, -0.65084668f },  { -0.75970816f, -0.65026419f },
+    { -0.76020668f, -0.64968131f },  { -0.76070476f, -0.64909805f },  { -0.76120239f, -0.64851440f },
+    { -0.76169957f, -0.64793038f },  { -0.76219630f, -0.64734597f },  { -0.76269258f, -0.64676118f },
+    { -0.76318842f, -0.64617601f },  { -0.76368380f, -0.64559046f },  { -0.76417874f, -0.64500454f },
+    { -0.76467323f, -0.64441823f },  { -0.76516727f, -0.64383154f },  { -0.76566085f, -0.64324448f },
+    { -0.76615399f, -0.64265703f },  { -0.76664668f, -0.64206921f },  { -0.76713891f, -0.64148101f },
+    { -0.76763070f, -0.64089244f },  { -0.76812203f, -0.64030348f },  { -0.76861291f, -0.63971415f },
+    { -0.76910334f, -0.63912444f },  { -0.76959331f, -0.63853436f },  { -0.77008284f, -0.63794390f },
+    { -0.77057191f, -0.63735307f },  { -0.77106052f, -0.63676186f },  { -0.77154869f, -0.63617028f },
+    { -0.77203640f, -0.63557832f },  { -0.77252365f, -0.63498599f },  { -0.77301045f, -0.63439328f },
+    { -0.77349680f, -0.63380021f },  { -0.77398269f, -0.63320676f },  { -0.77446813f, -0.63261293f },
+    { -0.77495311f, -0.63201874f },  { -0.77543763f, -0.63142417f },  { -0.77592170f, -0.63082923f },
+    { -0.77640531f, -0.63023392f },  { -0.77688847f, -0.62963824f },  { -0.77737116f, -0.62904219f },
+    { -0.77785340f, -0.62844577f },  { -0.77833519f, -0.62784898f },  { -0.77881651f, -0.62725182f },
+    { -0.77929738f, -0.62665429f },  { -0.77977779f, -0.62605639f },  { -0.78025774f, -0.62545812f },
+    { -0.78073723f, -0.62485949f },  { -0.78121626f, -0.62426049f },  { -0.78169483f, -0.62366112f },
+    { -0.78217294f, -0.62306138f },  { -0.78265060f, -0.62246128f },  { -0.78312779f, -0.62186081f },
+    { -0.78360452f, -0.62125998f },  { -0.78408079f, -0.62065878f },  { -0.78455660f, -0.62005721f },
+    { -0.78503194f, -0.61945528f },  { -0.78550683f, -0.61885299f },  { -0.78598125f, -0.61825033f },
+    { -0.78645521f, -0.61764731f },  { -0.78692871f, -0.61704392f },  { -0.78740175f, -0.61644017f },
+    { -0.78787432f, -0.61583606f },  { -0.78834643f, -0.61523159f },  { -0.78881807f, -0.61462676f },
+    { -0.78928925f, -0.61402156f },  { -0.78975997f, -0.61341600f },  { -0.79023022f, -0.61281008f },
+    { -0.79070001f, -0.61220380f },  { -0.79116933f, -0.61159716f },  { -0.79163819f, -0.61099016f },
+    { -0.79210658f, -0.61038281f },  { -0.79257450f, -0.60977509f },  { -0.79304196f, -0.60916701f },
+    { -0.79350895f, -0.60855858f },  { -0.79397548f, -0.60794978f },  { -0.79444154f, -0.60734063f },
+    { -0.79490713f, -0.60673113f },  { -0.79537225f, -0.60612126f },  { -0.79583690f, -0.60551104f },
+    { -0.79630109f, -0.60490046f },  { -0.79676481f, -0.60428953f },  { -0.79722806f, -0.60367824f },
+    { -0.79769084f, -0.60306660f },  { -0.79815315f, -0.60245460f },  { -0.79861499f, -0.60184225f },
+    { -0.79907637f, -0.60122954f },  { -0.79953727f, -0.60061648f },  { -0.79999770f, -0.60000307f },
+    { -0.80045766f, -0.59938930f },  { -0.80091715f, -0.59877518f },  { -0.80137617f, -0.59816071f },
+    { -0.80183472f, -0.59754588f },  { -0.80229280f, -0.59693071f },  { -0.80275040f, -0.59631518f },
+    { -0.80320753f, -0.59569930f },  { -0.80366419f, -0.59508308f },  { -0.80412038f, -0.59446650f },
+    { -0.80457609f, -0.59384957f },  { -0.80503133f, -0.59323230f },  { -0.80548610f, -0.59261467f },
+    { -0.80594039f, -0.59199669f },  { -0.80639421f, -0.59137837f },  { -0.80684755f, -0.59075970f },
+    { -0.80730042f, -0.59014068f },  { -0.80775282f, -0.58952132f },  { -0.80820474f, -0.58890161f },
+    { -0.80865618f, -0.58828155f },  { -0.80910715f, -0.58766114f },  { -0.80955764f, -0.58704039f },
+    { -0.81000766f, -0.58641930f },  { -0.81045720f, -0.58579786f },  { -0.81090626f, -0.58517607f },
+    { -0.81135485f, -0.58455394f },  { -0.81180296f, -0.58393147f },  { -0.81225059f, -0.58330865f },
+    { -0.81269774f, -0.58268549f },  { -0.81314441f, -0.58206199f },  { -0.81359061f, -0.58143815f },
+    { -0.81403633f, -0.58081396f },  { -0.81448157f, -0.58018943f },  { -0.81492633f, -0.57956456f },
+    { -0.81537061f, -0.57893935f },  { -0.81581441f, -0.57831380f },  { -0.81625773f, -0.57768790f },
+    { -0.81670057f, -0.57706167f },  { -0.81714293f, -0.57643510f },  { -0.81758481f, -0.57580819f },
+    { -0.81802621f, -0.57518094f },  { -0.81846713f, -0.57455336f },  { -0.81890757f, -0.57392543f },
+    { -0.81934752f, -0.57329717f },  { -0.81978699f, -0.57266857f },  { -0.82022598f, -0.57203963f },
+    { -0.82066449f, -0.57141036f },  { -0.82110251f, -0.57078075f },  { -0.82154006f, -0.57015080f },
+    { -0.82197712f, -0.56952052f },  { -0.82241369f, -0.56888990f },  { -0.82284978f, -0.56825895f },
+    { -0.82328539f, -0.56762767f },  { -0.82372051f, -0.56699605f },  { -0.82415515f, -0.56636410f },
+    { -0.82458930f, -0.56573181f },  { -0.82502297f, -0.56509919f },  { -0.82545615f, -0.56446624f },
+    { -0.82588885f, -0.56383296f },  { -0.82632106f, -0.56319934f },  { -0.82675279f, -0.56256540f },
+    { -0.82718403f, -0.56193112f },  { -0.82761478f, -0.56129651f },  { -0.82804505f, -0.56066158f },
+    { -0.82847482f, -0.56002631f },  { -0.82890411f, -0.55939071f },  { -0.82933292f, -0.55875479f },
+    { -0.82976123f, -0.55811853f },  { -0.83018906f, -0.55748195f },  { -0.83061640f, -0.55684504f },
+    { -0.83104325f, -0.55620780f },  { -0.83146961f, -0.55557023f },  { -0.83189548f, -0.55493234f },
+    { -0.83232087f, -0.55429412f },  { -0.83274576f, -0.55365558f },  { -0.83317016f, -0.55301671f },
+    { -0.83359408f, -0.55237751f },  { -0.83401750f, -0.55173799f },  { -0.83444043f, -0.55109814f },
+    { -0.83486287f, -0.55045797f },  { -0.83528483f, -0.54981748f },  { -0.83570628f, -0.54917666f },
+    { -0.83612725f, -0.54853552f },  { -0.83654773f, -0.54789406f },  { -0.83696771f, -0.54725227f },
+    { -0.83738720f, -0.54661017f },  { -0.83780620f, -0.54596774f },  { -0.83822471f, -0.54532499f },
+    { -0.83864272f, -0.54468192f },  { -0.83906024f, -0.54403853f },  { -0.83947726f, -0.54339482f },
+    { -0.83989379f, -0.54275078f },  { -0.84030983f, -0.54210643f },  { -0.84072537f, -0.54146177f },
+    { -0.84114042f, -0.54081678f },  { -0.84155498f, -0.54017147f },  { -0.84196904f, -0.53952585f },
+    { -0.84238260f, -0.53887991f },  { -0.84279567f, -0.53823365f },  { -0.84320824f, -0.53758708f },
+    { -0.84362032f, -0.53694019f },  { -0.84403190f, -0.53629298f },  { -0.84444298f, -0.53564546f },
+    { -0.84485357f, -0.53499762f },  { -0.84526365f, -0.53434947f },  { -0.84567325f, -0.53370100f },
+    { -0.84608234f, -0.53305222f },  { -0.84649094f, -0.53240313f },  { -0.84689904f, -0.53175372f },
+    { -0.84730664f, -0.53110400f },  { -0.84771374f, -0.53045397f },  { -0.84812034f, -0.52980362f },
+    { -0.84852645f, -0.52915297f },  { -0.84893206f, -0.52850200f },  { -0.84933716f, -0.52785072f },
+    { -0.84974177f, -0.52719913f },  { -0.85014587f, -0.52654724f },  { -0.85054948f, -0.52589503f },
+    { -0.85095259f, -0.52524251f },  { -0.85135519f, -0.52458968f },  { -0.85175730f, -0.52393655f },
+    { -0.85215890f, -0.52328310f },  { -0.85256000f, -0.52262935f },  { -0.85296060f, -0.52197529f },
+    { -0.85336070f, -0.52132093f },  { -0.85376030f, -0.52066625f },  { -0.85415940f, -0.52001128f },
+    { -0.85455799f, -0.51935599f },  { -0.85495608f, -0.51870040f },  { -0.85535366f, -0.51804450f },
+    { -0.85575075f, -0.51738830f },  { -0.85614733f, -0.51673180f },  { -0.85654340f, -0.51607499f },
+    { -0.85693898f, -0.51541788f },  { -0.85733405f, -0.51476046f },  { -0.85772861f, -0.51410274f },
+    { -0.85812267f, -0.51344472f },  { -0.85851622f, -0.51278640f },  { -0.85890927f, -0.51212778f },
+    { -0.85930182f, -0.51146885f },  { -0.85969386f, -0.51080962f },  { -0.86008539f, -0.51015010f },
+    { -0.86047642f, -0.50949027f },  { -0.86086694f, -0.50883014f },  { -0.86125695f, -0.50816972f },
+    { -0.86164646f, -0.50750899f },  { -0.86203546f, -0.50684797f },  { -0.86242396f, -0.50618665f },
+    { -0.86281194f, -0.50552503f },  { -0.86319942f, -0.50486311f },  { -0.86358639f, -0.50420089f },
+    { -0.86397286f, -0.50353838f },  { -0.86435881f, -0.50287558f },  { -0.86474426f, -0.50221247f },
+    { -0.86512920f, -0.50154908f },  { -0.86551362f, -0.50088538f },  { -0.86589754f, -0.50022139f },
+    { -0.86628095f, -0.49955711f },  { -0.86666385f, -0.49889254f },  { -0.86704625f, -0.49822767f },
+    { -0.86742813f, -0.49756250f },  { -0.86780950f, -0.49689705f },  { -0.86819036f, -0.49623130f },
+    { -0.86857071f, -0.49556526f },  { -0.86895054f, -0.49489893f },  { -0.86932987f, -0.49423231f },
+    { -0.86970869f, -0.49356540f },  { -0.87008699f, -0.49289819f },  { -0.87046478f, -0.49223070f },
+    { -0.87084206f, -0.49156292f },  { -0.87121883f, -0.49089484f },  { -0.87159509f, -0.49022648f },
+    { -0.87197083f, -0.48955783f },  { -0.87234606f, -0.48888890f },  { -0.87272078f, -0.48821967f },
+    { -0.87309498f, -0.48755016f },  { -0.87346867f, -0.48688036f },  { -0.87384184f, -0.48621028f },
+    { -0.87421451f, -0.48553990f },  { -0.87458665f, -0.48486925f },  { -0.87495829f, -0.48419831f },
+    { -0.87532940f, -0.48352708f },  { -0.87570001f, -0.48285557f },  { -0.87607009f, -0.48218377f },
+    { -0.87643967f, -0.48151169f },  { -0.87680872f, -0.48083933f },  { -0.87717727f, -0.48016669f },
+    { -0.87754529f, -0.47949376f },  { -0.87791280f, -0.47882055f },  { -0.87827979f, -0.47814706f },
+    { -0.87864627f, -0.47747328f },  { -0.87901223f, -0.47679923f },  { -0.87937767f, -0.47612490f },
+    { -0.87974259f, -0.47545028f },  { -0.88010700f, -0.47477539f },  { -0.88047089f, -0.47410021f },
+    { -0.88083426f, -0.47342476f },  { -0.88119711f, -0.47274903f },  { -0.88155945f, -0.47207302f },
+    { -0.88192126f, -0.47139674f },  { -0.88228256f, -0.47072017f },  { -0.88264334f, -0.47004333f },
+    { -0.88300360f, -0.46936622f },  { -0.88336334f, -0.46868882f },  { -0.88372256f, -0.46801115f },
+    { -0.88408126f, -0.46733321f },  { -0.88443944f, -0.46665499f },  { -0.88479710f, -0.46597650f },
+    { -0.88515424f, -0.46529773f },  { -0.88551086f, -0.46461869f },  { -0.88586695f, -0.46393937f },
+    { -0.88622253f, -0.46325978f },  { -0.88657759f, -0.46257992f },  { -0.88693212f, -0.46189979f },
+    { -0.88728613f, -0.46121939f },  { -0.88763962f, -0.46053871f },  { -0.88799259f, -0.45985776f },
+    { -0.88834503f, -0.45917655f },  { -0.88869696f, -0.45849506f },  { -0.88904836f, -0.45781330f },
+    { -0.88939923f, -0.45713128f },  { -0.88974959f, -0.45644898f },  { -0.89009942f, -0.45576642f },
+    { -0.89044872f, -0.45508359f },  { -0.89079751f, -0.45440049f },  { -0.89114576f, -0.45371712f },
+    { -0.89149350f, -0.45303349f },  { -0.89184071f, -0.45234959f },  { -0.89218739f, -0.45166542f },
+    { -0.89253356f, -0.45098099f },  { -0.89287919f, -0.45029629f },  { -0.89322430f, -0.44961133f },
+    { -0.89356889f, -0.44892610f },  { -0.89391295f, -0.44824061f },  { -0.89425648f, -0.44755486f },
+    { -0.89459949f, -0.44686884f },  { -0.89494197f, -0.44618256f },  { -0.89528392f, -0.44549602f },
+    { -0.89562535f, -0.44480921f },  { -0.89596625f, -0.44412214f },  { -0.89630662f, -0.44343482f },
+    { -0.89664647f, -0.44274723f },  { -0.89698579f, -0.44205938f },  { -0.89732458f, -0.44137127f },
+    { -0.89766284f, -0.44068290f },  { -0.89800058f, -0.43999427f },  { -0.89833779f, -0.43930538f },
+    { -0.89867447f, -0.43861624f },  { -0.89901062f, -0.43792683f },  { -0.89934624f, -0.43723717f },
+    { -0.89968133f, -0.43654726f },  { -0.90001589f, -0.43585708f },  { -0.90034993f, -0.43516665f },
+    { -0.90068343f, -0.43447596f },  { -0.90101640f, -0.43378502f },  { -0.90134885f, -0.43309382f },
+    { -0.90168076f, -0.43240237f },  { -0.90201214f, -0.43171066f },  { -0.90234300f, -0.43101870f },
+    { -0.90267332f, -0.43032648f },  { -0.90300311f, -0.42963401f },  { -0.90333237f, -0.42894129f },
+    { -0.90366110f, -0.42824832f },  { -0.90398929f, -0.42755509f },  { -0.90431696f, -0.42686162f },
+    { -0.90464409f, -0.42616789f },  { -0.90497069f, -0.42547391f },  { -0.90529676f, -0.42477968f },
+    { -0.90562229f, -0.42408520f },  { -0.90594730f, -0.42339047f },  { -0.90627177f, -0.42269550f },
+    { -0.90659570f, -0.42200027f },  { -0.90691911f, -0.42130480f },  { -0.90724198f, -0.42060907f },
+    { -0.90756431f, -0.41991310f },  { -0.90788612f, -0.41921689f },  { -0.90820738f, -0.41852043f },
+    { -0.90852812f, -0.41782372f },  { -0.90884832f, -0.41712676f },  { -0.90916798f, -0.41642956f },
+    { -0.90948711f, -0.41573211f },  { -0.90980571f, -0.41503442f },  { -0.91012377f, -0.41433649f },
+    { -0.91044129f, -0.41363831f },  { -0.91075828f, -0.41293989f },  { -0.91107473f, -0.41224123f },
+    { -0.91139065f, -0.41154232f },  { -0.91170603f, -0.41084317f },  { -0.91202088f, -0.41014378f },
+    { -0.91233518f, -0.40944415f },  { -0.91264896f, -0.40874428f },  { -0.91296219f, -0.40804416f },
+    { -0.91327489f, -0.40734381f },  { -0.91358705f, -0.40664322f },  { -0.91389867f, -0.40594238f },
+    { -0.91420976f, -0.40524131f },  { -0.91452030f, -0.40454000f },  { -0.91483031f, -0.40383846f },
+    { -0.91513978f, -0.40313667f },  { -0.91544872f, -0.40243465f },  { -0.91575711f, -0.40173239f },
+    { -0.91606497f, -0.40102990f },  { -0.91637228f, -0.40032717f },  { -0.91667906f, -0.39962420f },
+    { -0.91698530f, -0.39892100f },  { -0.91729100f, -0.39821756f },  { -0.91759616f, -0.39751389f },
+    { -0.91790078f, -0.39680999f },  { -0.91820486f, -0.39610585f },  { -0.91850839f, -0.39540148f },
+    { -0.91881139f, -0.39469688f },  { -0.91911385f, -0.39399204f },  { -0.91941577f, -0.39328697f },
+    { -0.91971715f, -0.39258167f },  { -0.92001798f, -0.39187614f },  { -0.92031828f, -0.39117038f },
+    { -0.92061803f, -0.39046439f },  { -0.92091724f, -0.38975817f },  { -0.92121591f, -0.38905172f },
+    { -0.92151404f, -0.38834505f },  { -0.92181163f, -0.38763814f },  { -0.92210867f, -0.38693101f },
+    { -0.92240517f, -0.38622364f },  { -0.92270113f, -0.38551605f },  { -0.92299654f, -0.38480824f },
+    { -0.92329142f, -0.38410020f },  { -0.92358575f, -0.38339193f },  { -0.92387953f, -0.38268343f },
+    { -0.92417278f, -0.38197471f },  { -0.92446547f, -0.38126577f },  { -0.92475763f, -0.38055660f },
+    { -0.92504924f, -0.37984721f },  { -0.92534031f, -0.37913759f },  { -0.92563083f, -0.37842775f },
+    { -0.92592081f, -0.37771769f },  { -0.92621024f, -0.37700741f },  { -0.92649913f, -0.37629691f },
+    { -0.92678747f, -0.37558618f },  { -0.92707527f, -0.37487523f },  { -0.92736253f, -0.37416406f },
+    { -0.92764923f, -0.37345267f },  { -0.92793539f, -0.37274107f },  { -0.92822101f, -0.37202924f },
+    { -0.92850608f, -0.37131719f },  { -0.92879060f, -0.37060493f },  { -0.92907458f, -0.36989245f },
+    { -0.92935801f, -0.36917975f },  { -0.92964090f, -0.36846683f },  { -0.92992323f, -0.36775370f },
+    { -0.93020502f, -0.36704035f },  { -0.93048627f, -0.36632678f },  { -0.93076696f, -0.36561300f },
+    { -0.93104711f, -0.36489900f },  { -0.93132671f, -0.36418479f },  { -0.93160576f, -0.36347036f },
+    { -0.93188427f, -0.36275572f },  { -0.93216222f, -0.36204087f },  { -0.93243963f, -0.36132581f },
+    { -0.93271649f, -0.36061053f },  { -0.93299280f, -0.35989504f },  { -0.93326856f, -0.35917933f },
+    { -0.93354377f, -0.35846342f },  { -0.93381844f, -0.35774730f },  { -0.93409255f, -0.35703096f },
+    { -0.93436611f, -0.35631442f },  { -0.93463913f, -0.35559766f },  { -0.93491159f, -0.35488070f },
+    { -0.93518351f, -0.35416353f },  { -0.93545487f, -0.35344614f },  { -0.93572569f, -0.35272856f },
+    { -0.93599595f, -0.35201076f },  { -0.93626567f, -0.35129276f },  { -0.93653483f, -0.35057455f },
+    { -0.93680344f, -0.34985613f },  { -0.93707150f, -0.34913751f },  { -0.93733901f, -0.34841868f },
+    { -0.93760597f, -0.34769965f },  { -0.93787238f, -0.34698041f },  { -0.93813823f, -0.34626097f },
+    { -0.93840353f, -0.34554132f },  { -0.93866828f, -0.34482148f },  { -0.93893248f, -0.34410143f },
+    { -0.93919613f, -0.34338117f },  { -0.93945922f, -0.34266072f },  { -0.93972176f, -0.34194006f },
+    { -0.93998375f, -0.34121920f },  { -0.94024519f, -0.34049814f },  { -0.94050607f, -0.33977688f },
+    { -0.94076640f, -0.33905543f },  { -0.94102618f, -0.33833377f },  { -0.94128540f, -0.33761191f },
+    { -0.94154407f, -0.33688985f },  { -0.94180218f, -0.33616760f },  { -0.94205974f, -0.33544515f },
+    { -0.94231675f, -0.33472250f },  { -0.94257320f, -0.33399965f },  { -0.94282909f, -0.33327661f },
+    { -0.94308444f, -0.33255337f },  { -0.94333923f, -0.33182994f },  { -0.94359346f, -0.33110631f },
+    { -0.94384714f, -0.33038248f },  { -0.94410026f, -0.32965846f },  { -0.94435283f, -0.32893425f },
+    { -0.94460484f, -0.32820984f },  { -0.94485629f, -0.32748524f },  { -0.94510719f, -0.32676045f },
+    { -0.94535754f, -0.32603547f },  { -0.94560733f, -0.32531029f },  { -0.94585656f, -0.32458492f },
+    { -0.94610523f, -0.32385937f },  { -0.94635335f, -0.32313362f },  { -0.94660091f, -0.32240768f },
+    { -0.94684792f, -0.32168155f },  { -0.94709437f, -0.32095523f },  { -0.94734026f, -0.32022873f },
+    { -0.94758559f, -0.31950203f },  { -0.94783037f, -0.31877515f },  { -0.94807459f, -0.31804808f },
+    { -0.94831825f, -0.31732082f },  { -0.94856135f, -0.31659338f },  { -0.94880389f, -0.31586575f },
+    { -0.94904588f, -0.31513793f },  { -0.94928731f, -0.31440993f },  { -0.94952818f, -0.31368174f },
+    { -0.94976849f, -0.31295337f },  { -0.95000825f, -0.31222481f },  { -0.95024744f, -0.31149607f },
+    { -0.95048607f, -0.31076715f },  { -0.95072415f, -0.31003805f },  { -0.95096167f, -0.30930876f },
+    { -0.95119862f, -0.30857929f },  { -0.95143502f, -0.30784964f },  { -0.95167086f, -0.30711981f },
+    { -0.95190614f, -0.30638980f },  { -0.95214085f, -0.30565960f },  { -0.95237501f, -0.30492923f },
+    { -0.95260861f, -0.30419868f },  { -0.95284165f, -0.30346795f },  { -0.95307412f, -0.30273704f },
+    { -0.95330604f, -0.30200595f },  { -0.95353740f, -0.30127468f },  { -0.95376819f, -0.30054324f },
+    { -0.95399842f, -0.29981162f },  { -0.95422810f, -0.29907983f },  { -0.95445721f, -0.29834785f },
+    { -0.95468575f, -0.29761571f },  { -0.95491374f, -0.29688339f },  { -0.95514117f, -0.29615089f },
+    { -0.95536803f, -0.29541822f },  { -0.95559433f, -0.29468537f },  { -0.95582007f, -0.29395235f },
+    { -0.95604525f, -0.29321916f },  { -0.95626987f, -0.29248580f },  { -0.95649392f, -0.29175226f },
+    { -0.95671741f, -0.29101856f },  { -0.95694034f, -0.29028468f },  { -0.95716270f, -0.28955063f },
+    { -0.95738450f, -0.28881641f },  { -0.95760574f, -0.28808202f },  { -0.95782641f, -0.28734746f },
+    { -0.95804652f, -0.28661273f },  { -0.95826607f, -0.28587783f },  { -0.95848506f, -0.28514277f },
+    { -0.95870347f, -0.28440754f },  { -0.95892133f, -0.28367214f },  { -0.95913862f, -0.28293657f },
+    { -0.95935535f, -0.28220084f },  { -0.95957151f, -0.28146494f },  { -0.95978711f, -0.28072887f },
+    { -0.96000215f, -0.27999264f },  { -0.96021662f, -0.27925625f },  { -0.96043052f, -0.27851969f },
+    { -0.96064386f, -0.27778297f },  { -0.96085663f, -0.27704608f },  { -0.96106884f, -0.27630903f },
+    { -0.96128049f, -0.27557182f },  { -0.96149156f, -0.27483445f },  { -0.96170208f, -0.27409691f },
+    { -0.96191202f, -0.27335921f },  { -0.96212140f, -0.27262136f },  { -0.96233022f, -0.27188334f },
+    { -0.96253847f, -0.27114516f },  { -0.96274615f, -0.27040682f },  { -0.96295327f, -0.26966833f },
+    { -0.96315982f, -0.26892967f },  { -0.96336580f, -0.26819086f },  { -0.96357122f, -0.26745189f },
+    { -0.96377607f, -0.26671276f },  { -0.96398035f, -0.26597347f },  { -0.96418406f, -0.26523403f },
+    { -0.96438721f, -0.26449443f },  { -0.96458979f, -0.26375468f },  { -0.96479181f, -0.26301477f },
+    { -0.96499325f, -0.26227471f },  { -0.96519413f, -0.26153449f },  { -0.96539444f, -0.26079412f },
+    { -0.96559418f, -0.26005359f },  { -0.96579336f, -0.25931292f },  { -0.96599197f, -0.25857208f },
+    { -0.96619000f, -0.25783110f },  { -0.96638747f, -0.25708997f },  { -0.96658437f, -0.25634868f },
+    { -0.96678071f, -0.25560725f },  { -0.96697647f, -0.25486566f },  { -0.96717167f, -0.25412392f },
+    { -0.96736629f, -0.25338204f },  { -0.96756035f, -0.25264000f },  { -0.96775384f, -0.25189782f },
+    { -0.96794676f, -0.25115549f },  { -0.96813910f, -0.25041301f },  { -0.96833088f, -0.24967038f },
+    { -0.96852209f, -0.24892761f },  { -0.96871273f, -0.24818469f },  { -0.96890280f, -0.24744162f },
+    { -0.96909231f, -0.24669841f },  { -0.96928124f, -0.24595505f },  { -0.96946960f, -0.24521155f },
+    { -0.96965739f, -0.24446790f },  { -0.96984460f, -0.24372411f },  { -0.97003125f, -0.24298018f },
+    { -0.97021733f, -0.24223610f },  { -0.97040284f, -0.24149189f },  { -0.97058778f, -0.24074752f },
+    { -0.97077214f, -0.24000302f },  { -0.97095594f, -0.23925838f },  { -0.97113916f, -0.23851359f },
+    { -0.97132181f, -0.23776867f },  { -0.97150389f, -0.23702361f },  { -0.97168540f, -0.23627840f },
+    { -0.97186634f, -0.23553306f },  { -0.97204670f, -0.23478758f },  { -0.97222650f, -0.23404196f },
+    { -0.97240572f, -0.23329620f },  { -0.97258437f, -0.23255031f },  { -0.97276245f, -0.23180428f },
+    { -0.97293995f, -0.23105811f },  { -0.97311689f, -0.23031180f },  { -0.97329325f, -0.22956537f },
+    { -0.97346903f, -0.22881879f },  { -0.97364425f, -0.22807208f },  { -0.97381889f, -0.22732524f },
+    { -0.97399296f, -0.22657826f },  { -0.97416646f, -0.22583115f },  { -0.97433938f, -0.22508391f },
+    { -0.97451173f, -0.22433654f },  { -0.97468351f, -0.22358903f },  { -0.97485471f, -0.22284139f },
+    { -0.97502535f, -0.22209362f },  { -0.97519540f, -0.22134572f },  { -0.97536489f, -0.22059769f },
+    { -0.97553379f, -0.21984953f },  { -0.97570213f, -0.21910124f },  { -0.97586989f, -0.21835282f },
+    { -0.97603708f, -0.21760427f },  { -0.97620369f, -0.21685560f },  { -0.97636973f, -0.21610680f },
+    { -0.97653520f, -0.21535787f },  { -0.97670009f, -0.21460881f },  { -0.97686440f, -0.21385963f },
+    { -0.97702814f, -0.21311032f },  { -0.97719131f, -0.21236089f },  { -0.97735390f, -0.21161133f },
+    { -0.97751592f, -0.21086164f },  { -0.97767736f, -0.21011184f },  { -0.97783822f, -0.20936191f },
+    { -0.97799851f, -0.20861185f },  { -0.97815823f, -0.20786168f },  { -0.97831737f, -0.20711138f },
+    { -0.97847594f, -0.20636096f },  { -0.97863392f, -0.20561041f },  { -0.97879134f, -0.20485975f },
+    { -0.97894818f, -0.20410897f },  { -0.97910444f, -0.20335806f },  { -0.97926012f, -0.20260704f },
+    { -0.97941523f, -0.20185590f },  { -0.97956977f, -0.20110463f },  { -0.97972372f, -0.20035326f },
+    { -0.97987710f, -0.19960176f },  { -0.98002991f, -0.19885014f },  { -0.98018214f, -0.19809841f },
+    { -0.98033379f, -0.19734656f },  { -0.98048486f, -0.19659460f },  { -0.98063536f, -0.19584252f },
+    { -0.98078528f, -0.19509032f },  { -0.98093462f, -0.19433801f },  { -0.98108339f, -0.19358559f },
+    { -0.98123158f, -0.19283305f },  { -0.98137919f, -0.19208040f },  { -0.98152623f, -0.19132763f },
+    { -0.98167269f, -0.19057475f },  { -0.98181857f, -0.18982177f },  { -0.98196387f, -0.18906866f },
+    { -0.98210859f, -0.18831545f },  { -0.98225274f, -0.18756213f },  { -0.98239631f, -0.18680870f },
+    { -0.98253930f, -0.18605515f },  { -0.98268172f, -0.18530150f },  { -0.98282355f, -0.18454774f },
+    { -0.98296481f, -0.18379387f },  { -0.98310549f, -0.18303989f },  { -0.98324559f, -0.18228580f },
+    { -0.98338511f, -0.18153161f },  { -0.98352405f, -0.18077731f },  { -0.98366242f, -0.18002290f },
+    { -0.98380021f, -0.17926839f },  { -0.98393741f, -0.17851377f },  { -0.98407404f, -0.17775905f },
+    { -0.98421009f, -0.17700422f },  { -0.98434556f, -0.17624929f },  { -0.98448046f, -0.17549425f },
+    { -0.98461477f, -0.17473911f },  { -0.98474850f, -0.17398387f },  { -0.98488166f, -0.17322853f },
+    { -0.98501423f, -0.17247308f },  { -0.98514623f, -0.17171754f },  { -0.98527764f, -0.17096189f },
+    { -0.98540848f, -0.17020614f },  { -0.98553874f, -0.16945029f },  { -0.98566841f, -0.16869434f },
+    { -0.98579751f, -0.16793829f },  { -0.98592603f, -0.16718215f },  { -0.98605396f, -0.16642590f },
+    { -0.98618132f, -0.16566956f },  { -0.98630810f, -0.16491312f },  { -0.98643429f, -0.16415658f },
+    { -0.98655991f, -0.16339995f },  { -0.98668495f, -0.16264322f },  { -0.98680940f, -0.16188639f },
+    { -0.98693328f, -0.16112947f },  { -0.98705657f, -0.16037246f },  { -0.98717929f, -0.15961535f },
+    { -0.98730142f, -0.15885814f },  { -0.98742297f, -0.15810085f },  { -0.98754394f, -0.15734346f },
+    { -0.98766433f, -0.15658597f },  { -0.98778414f, -0.15582840f },  { -0.98790337f, -0.15507073f },
+    { -0.98802202f, -0.15431297f },  { -0.98814008f, -0.15355512f },  { -0.98825757f, -0.15279719f },
+    { -0.98837447f, -0.15203916f },  { -0.98849079f, -0.15128104f },  { -0.98860653f, -0.15052283f },
+    { -0.98872169f, -0.14976453f },  { -0.98883627f, -0.14900615f },  { -0.98895026f, -0.14824768f },
+    { -0.98906368f, -0.14748912f },  { -0.98917651f, -0.14673047f },  { -0.98928876f, -0.14597174f },
+    { -0.98940043f, -0.14521292f },  { -0.98951151f, -0.14445402f },  { -0.98962202f, -0.14369503f },
+    { -0.98973194f, -0.14293596f },  { -0.98984128f, -0.14217680f },  { -0.98995004f, -0.14141756f },
+    { -0.99005821f, -0.14065824f },  { -0.99016580f, -0.13989883f },  { -0.99027281f, -0.13913934f },
+    { -0.99037924f, -0.13837977f },  { -0.99048508f, -0.13762012f },  { -0.99059035f, -0.13686039f },
+    { -0.99069503f, -0.13610058f },  { -0.99079912f, -0.13534068f },  { -0.99090264f, -0.13458071f },
+    { -0.99100557f, -0.13382066f },  { -0.99110791f, -0.13306053f },  { -0.99120968f, -0.13230032f },
+    { -0.99131086f, -0.13154003f },  { -0.99141146f, -0.13077966f },  { -0.99151147f, -0.13001922f },
+    { -0.99161091f, -0.12925870f },  { -0.99170975f, -0.12849811f },  { -0.99180802f, -0.12773744f },
+    { -0.99190570f, -0.12697670f },  { -0.99200280f, -0.12621588f },  { -0.99209931f, -0.12545498f },
+    { -0.99219524f, -0.12469402f },  { -0.99229059f, -0.12393298f },  { -0.99238535f, -0.12317186f },
+    { -0.99247953f, -0.12241068f },  { -0.99257313f, -0.12164942f },  { -0.99266614f, -0.12088809f },
+    { -0.99275857f, -0.12012669f },  { -0.99285041f, -0.11936521f },  { -0.99294167f, -0.11860367f },
+    { -0.99303235f, -0.11784206f },  { -0.99312244f, -0.11708038f },  { -0.99321195f, -0.11631863f },
+    { -0.99330087f, -0.11555681f },  { -0.99338921f, -0.11479493f },  { -0.99347697f, -0.11403297f },
+    { -0.99356414f, -0.11327095f },  { -0.99365072f, -0.11250886f },  { -0.99373672f, -0.11174671f },
+    { -0.99382214f, -0.11098449f },  { -0.99390697f, -0.11022221f },  { -0.99399122f, -0.10945986f },
+    { -0.99407488f, -0.10869744f },  { -0.99415796f, -0.10793497f },  { -0.99424045f, -0.10717242f },
+    { -0.99432236f, -0.10640982f },  { -0.99440368f, -0.10564715f },  { -0.99448442f, -0.10488442f },
+    { -0.99456457f, -0.10412163f },  { -0.99464414f, -0.10335878f },  { -0.99472312f, -0.10259587f },
+    { -0.99480152f, -0.10183290f },  { -0.99487933f, -0.10106986f },  { -0.99495656f, -0.10030677f },
+    { -0.99503320f, -0.09954362f },  { -0.99510926f, -0.09878041f },  { -0.99518473f, -0.09801714f },
+    { -0.99525961f, -0.09725381f },  { -0.99533391f, -0.09649043f },  { -0.99540763f, -0.09572699f },
+    { -0.99548076f, -0.09496350f },  { -0.99555330f, -0.09419994f },  { -0.99562526f, -0.09343634f },
+    { -0.99569663f, -0.09267267f },  { -0.99576741f, -0.09190896f },  { -0.99583761f, -0.09114519f },
+    { -0.99590723f, -0.09038136f },  { -0.99597626f, -0.08961748f },  { -0.99604470f, -0.08885355f },
+    { -0.99611256f, -0.08808957f },  { -0.99617983f, -0.08732554f },  { -0.99624651f, -0.08656145f },
+    { -0.99631261f, -0.08579731f },  { -0.99637812f, -0.08503312f },  { -0.99644305f, -0.08426889f },
+    { -0.99650739f, -0.08350460f },  { -0.99657115f, -0.08274026f },  { -0.99663431f, -0.08197588f },
+    { -0.99669690f, -0.08121145f },  { -0.99675889f, -0.08044697f },  { -0.99682030f, -0.07968244f },
+    { -0.99688112f, -0.07891786f },  { -0.99694136f, -0.07815324f },  { -0.99700101f, -0.07738857f },
+    { -0.99706007f, -0.07662386f },  { -0.99711855f, -0.07585910f },  { -0.99717644f, -0.07509430f },
+    { -0.99723374f, -0.07432945f },  { -0.99729046f, -0.07356456f },  { -0.99734659f, -0.07279963f },
+    { -0.99740213f, -0.07203465f },  { -0.99745709f, -0.07126963f },  { -0.99751146f, -0.07050457f },
+    { -0.99756524f, -0.06973947f },  { -0.99761844f, -0.06897433f },  { -0.99767104f, -0.06820914f },
+    { -0.99772307f, -0.06744392f },  { -0.99777450f, -0.06667866f },  { -0.99782535f, -0.06591335f },
+    { -0.99787561f, -0.06514801f },  { -0.99792529f, -0.06438263f },  { -0.99797437f, -0.06361721f },
+    { -0.99802287f, -0.06285176f },  { -0.99807079f, -0.06208627f },  { -0.99811811f, -0.06132074f },
+    { -0.99816485f, -0.06055517f },  { -0.99821100f, -0.05978957f },  { -0.99825657f, -0.05902393f },
+    { -0.99830154f, -0.05825826f },  { -0.99834593f, -0.05749256f },  { -0.99838974f, -0.05672682f },
+    { -0.99843295f, -0.05596105f },  { -0.99847558f, -0.05519524f },  { -0.99851762f, -0.05442941f },
+    { -0.99855907f, -0.05366354f },  { -0.99859994f, -0.05289764f },  { -0.99864022f, -0.05213170f },
+    { -0.99867991f, -0.05136574f },  { -0.99871901f, -0.05059975f },  { -0.99875753f, -0.04983373f },
+    { -0.99879546f, -0.04906767f },  { -0.99883280f, -0.04830159f },  { -0.99886955f, -0.04753548f },
+    { -0.99890572f, -0.04676935f },  { -0.99894129f, -0.04600318f },  { -0.99897628f, -0.04523699f },
+    { -0.99901069f, -0.04447077f },  { -0.99904450f, -0.04370453f },  { -0.99907773f, -0.04293826f },
+    { -0.99911037f, -0.04217196f },  { -0.99914242f, -0.04140564f },  { -0.99917388f, -0.04063930f },
+    { -0.99920476f, -0.03987293f },  { -0.99923505f, -0.03910654f },  { -0.99926475f, -0.03834012f },
+    { -0.99929386f, -0.03757368f },  { -0.99932238f, -0.03680722f },  { -0.99935032f, -0.03604074f },
+    { -0.99937767f, -0.03527424f },  { -0.99940443f, -0.03450772f },  { -0.99943060f, -0.03374117f },
+    { -0.99945619f, -0.03297461f },  { -0.99948119f, -0.03220803f },  { -0.99950560f, -0.03144142f },
+    { -0.99952942f, -0.03067480f },  { -0.99955265f, -0.02990816f },  { -0.99957530f, -0.02914151f },
+    { -0.99959735f, -0.02837484f },  { -0.99961882f, -0.02760815f },  { -0.99963970f, -0.02684144f },
+    { -0.99966000f, -0.02607472f },  { -0.99967970f, -0.02530798f },  { -0.99969882f, -0.02454123f },
+    { -0.99971735f, -0.02377446f },  { -0.99973529f, -0.02300768f },  { -0.99975264f, -0.02224089f },
+    { -0.99976941f, -0.02147408f },  { -0.99978558f, -0.02070726f },  { -0.99980117f, -0.01994043f },
+    { -0.99981617f, -0.01917358f },  { -0.99983058f, -0.01840673f },  { -0.99984441f, -0.01763986f },
+    { -0.99985764f, -0.01687299f },  { -0.99987029f, -0.01610610f },  { -0.99988235f, -0.01533921f },
+    { -0.99989382f, -0.01457230f },  { -0.99990470f, -0.01380539f },  { -0.99991500f, -0.01303847f },
+    { -0.99992470f, -0.01227154f },  { -0.99993382f, -0.01150460f },  { -0.99994235f, -0.01073766f },
+    { -0.99995029f, -0.00997071f },  { -0.99995764f, -0.00920375f },  { -0.99996441f, -0.00843679f },
+    { -0.99997059f, -0.00766983f },  { -0.99997617f, -0.00690286f },  { -0.99998118f, -0.00613588f },
+    { -0.99998559f, -0.00536891f },  { -0.99998941f, -0.00460193f },  { -0.99999265f, -0.00383494f },
+    { -0.99999529f, -0.00306796f },  { -0.99999735f, -0.00230097f },  { -0.99999882f, -0.00153398f },
+    { -0.99999971f, -0.00076699f }
+};
+
+/* generated by rfft_bit_rev(8192), see plp_common_tables.c */
+short bit_rev_radix2_LUT_8192[8192] = {
+0, 4096, 2048, 6144, 1024, 5120, 3072, 7168, 512, 4608, 2560, 6656, 1536, 5632,
+3584, 7680, 256, 4352, 2304, 6400, 1280, 5376, 3328, 7424, 768, 4864, 2816,
+6912, 1792, 5888, 3840, 7936, 128, 4224, 2176, 6272, 1152, 5248, 3200, 7296,
+640, 4736, 2688, 6784, 1664, 5760, 3712, 7808, 384, 4480, 2432, 6528, 1408,
+5504, 3456, 7552, 896, 4992, 2944, 7040, 1920, 6016, 3968, 8064, 64, 4160, 2112,
+6208, 1088, 5184, 3136, 7232, 576, 4672, 2624, 6720, 1600, 5696, 3648, 7744,
+320, 4416, 2368, 6464, 1344, 5440, 3392, 7488, 832, 4928, 2880, 6976, 1856,
+5952, 3904, 8000, 192, 4288, 2240, 6336, 1216, 5312, 3264, 7360, 704, 4800,
+2752, 6848, 1728, 5824, 3776, 7872, 448, 4544, 2496, 6592, 1472, 5568, 3520,
+7616, 960, 5056, 3008, 7104, 1984, 6080, 4032, 8128, 32, 4128, 2080, 6176, 1056,
+5152, 3104, 7200, 544, 4640, 2592, 6688, 1568, 5664, 3616, 7712, 288, 4384,
+2336, 6432, 1312, 5408, 3360, 7456, 800, 4896, 2848, 6944, 1824, 5920, 3872,
+7968, 160, 4256, 2208, 6304, 1184, 5280, 3232, 7328, 672, 4768, 2720, 6816,
+1696, 5792, 3744, 7840, 416, 4512, 2464, 6560, 1440, 5536, 3488, 7584, 928,
+5024, 2976, 7072, 1952, 6048, 4000, 8096, 96, 4192, 2144, 6240, 1120, 5216,
+3168, 7264, 608, 4704, 2656, 6752, 1632, 5728, 3680, 7776, 352, 4448, 2400,
+6496, 1376, 5472, 3424, 7520, 864, 4960, 2912, 7008, 1888, 5984, 3936, 8032,
+224, 4320, 2272, 6368, 1248, 5344, 3296, 7392, 736, 4832, 2784, 6880, 1760,
+5856, 3808, 7904, 480, 4576, 2528, 6624, 1504, 5600, 3552, 7648, 992, 5088,
+3040, 7136, 2016, 6112, 4064, 8160, 16, 4112, 2064, 6160, 1040, 5136, 3088,
+7184, 528, 4624, 2576, 6672, 1552, 5648, 3600, 7696, 272, 4368, 2320, 6416,
+1296, 5392, 3344, 7440, 784, 4880, 2832, 6928, 1808, 5904, 3856, 7952, 144,
+4240, 2192, 6288, 1168, 5264, 3216, 7312, 656, 4752, 2704, 6800, 1680, 5776,
+3728, 7824, 400, 4496, 2448, 6544, 1424, 5520, 3472, 7568, 912, 5008, 2960,
+7056, 1936, 6032, 3984, 8080, 80, 4176, 2128, 6224, 1104, 5200, 3152, 7248, 592,
+4688, 2640, 6736, 1616, 5712, 3664, 7760, 336, 4432, 2384, 6480, 1360, 5456,
+3408, 7504, 848, 4944, 2896, 6992, 1872, 5968, 3920, 8016, 208, 4304, 2256,
+6352, 1232, 5328, 3280, 7376, 720, 4816, 2768, 6864, 1744, 5840, 3792, 7888,
+464, 4560, 2512, 6608, 1488, 5584, 3536, 7632, 976, 5072, 3024, 7120, 2000,
+6096, 4048, 8144, 48, 4144, 2096, 6192, 1072, 5168, 3120, 7216, 560, 4656, 2608,
+6704, 1584, 5680, 3632, 7728, 304, 4400, 2352, 6448, 1328, 5424, 3376, 7472,
+816, 4912, 2864, 6960, 1840, 5936, 3888, 7984, 176, 4272, 2224, 6320, 1200,
+5296, 3248, 7344, 688, 4784, 2736, 6832, 1712, 5808, 3760, 7856, 432, 4528,
+2480, 6576, 1456, 5552, 3504, 7600, 944, 5040, 2992, 7088, 1968, 6064, 4016,
+8112, 112, 4208, 2160, 6256, 1136, 5232, 3184, 7280, 624, 4720, 2672, 6768,
+1648, 5744, 3696, 7792, 368, 4464, 2416, 6512, 1392, 5488, 3440, 7536, 880,
+4976, 2928, 7024, 1904, 6000, 3952, 8048, 240, 4336, 2288, 6384, 1264, 5360,
+3312, 7408, 752, 4848, 2800, 6896, 1776, 5872, 3824, 7920, 496, 4592, 2544,
+6640, 1520, 5616, 3568, 7664, 1008, 5104, 3056, 7152, 2032, 6128, 4080, 8176, 8,
+4104, 2056, 6152, 1032, 5128, 3080, 7176, 520, 4616, 2568, 6664, 1544, 5640,
+3592, 7688, 264, 4360, 2312, 6408, 1288, 5384, 3336, 7432, 776, 4872, 2824,
+6920, 1800, 5896, 3848, 7944, 136, 4232, 2184, 6280, 1160, 5256, 3208, 7304,
+648, 4744, 2696, 6792, 1672, 5768, 3720, 7816, 392, 4488, 2440, 6536, 1416,
+5512, 3464, 7560, 904, 5000, 2952, 7048, 1928, 6024, 3976, 8072, 72, 4168, 2120,
+6216, 1096, 5192, 3144, 7240, 584, 4680, 2632, 6728, 1608, 5704, 3656, 7752,
+328, 4424, 2376, 6472, 1352, 5448, 3400, 7496, 840, 4936, 2888, 6984, 1864,
+5960, 3912, 8008, 200, 4296, 2248, 6344, 1224, 5320, 3272, 7368, 712, 4808,
+2760, 6856, 1736, 5832, 3784, 7880, 456, 4552, 2504, 6600, 1480, 5576, 3528,
+7624, 968, 5064, 3016, 7112, 1992, 6088, 4040, 8136, 40, 4136, 2088, 6184, 1064,
+5160, 3112, 7208, 552, 4648, 2600, 6696, 1576, 5672, 3624, 7720, 296, 4392,
+2344, 6440, 1320, 5416, 3368, 7464, 808, 4904, 2856, 6952, 1832, 5928, 3880,
+7976, 168, 4264, 2216, 6312, 1192, 5288, 3240, 7336, 680, 4776, 2728, 6824,
+1704, 5800, 3752, 7848, 424, 4520, 2472, 6568, 1448, 5544, 3496, 7592, 936,
+5032, 2984, 7080, 1960, 6056, 4008, 8104, 104, 4200, 2152, 6248, 1128, 5224,
+3176, 7272, 616, 4712, 2664, 6760, 1640, 5736, 3688, 7784, 360, 4456, 2408,
+6504, 1384, 5480, 3432, 7528, 872, 4968, 2920, 7016, 1896, 5992, 3944, 8040,
+232, 4328, 2280, 6376, 1256, 5352, 3304, 7400, 744, 4840, 2792, 6888, 1768,
+5864, 3816, 7912, 488, 4584, 2536, 6632, 1512, 5608, 3560, 7656, 1000, 5096,
+3048, 7144, 2024, 6120, 4072, 8168, 24, 4120, 2072, 6168, 1048, 5144, 3096,
+7192, 536, 4632, 2584, 6680, 1560, 5656, 3608, 7704, 280, 4376, 2328, 6424,
+1304, 5400, 3352, 7448, 792, 4888, 2840, 6936, 1816, 5912, 3864, 7960, 152,
+4248, 2200, 6296, 1176, 5272, 3224, 7320, 664, 4760, 2712, 6808, 1688, 5784,
+3736, 7832, 408, 4504, 2456, 6552, 1432, 5528, 3480, 7576, 920, 5016, 2968,
+7064, 1944, 6040, 3992, 8088, 88, 4184, 2136, 6232, 1112, 5208, 3160, 7256, 600,
+4696, 2648, 6744, 1624, 5720, 3672, 7768, 344, 4440, 2392, 6488, 1368, 5464,
+3416, 7512, 856, 4952, 2904, 7000, 1880, 5976, 3928, 8024, 216, 4312, 2264,
+6360, 1240, 5336, 3288, 7384, 728, 4824, 2776, 6872, 1752, 5848, 3800, 7896,
+472, 4568, 2520, 6616, 1496, 5592, 3544, 7640, 984, 5080, 3032, 7128, 2008,
+6104, 4056, 8152, 56, 4152, 2104, 6200, 1080, 5176, 3128, 7224, 568, 4664, 2616,
+6712, 1592, 5688, 3640, 7736, 312, 4408, 2360, 6456, 1336, 5432, 3384, 7480,
+824, 4920, 2872, 6968, 1848, 5944, 3896, 7992, 184, 4280, 2232, 6328, 1208,
+5304, 3256, 7352, 696, 4792, 2744, 6840, 1720, 5816, 3768, 7864, 440, 4536,
+2488, 6584, 1464, 5560, 3512, 7608, 952, 5048, 3000, 7096, 1976, 6072, 4024,
+8120, 120, 4216, 2168, 6264, 1144, 5240, 3192, 7288, 632, 4728, 2680, 6776,
+1656, 5752, 3704, 7800, 376, 4472, 2424, 6520, 1400, 5496, 3448, 7544, 888,
+4984, 2936, 7032, 1912, 6008, 3960, 8056, 248, 4344, 2296, 6392, 1272, 5368,
+3320, 7416, 760, 4856, 2808, 6904, 1784, 5880, 3832, 7928, 504, 4600, 2552,
+6648, 1528, 5624, 3576, 7672, 1016, 5112, 3064, 7160, 2040, 6136, 4088, 8184, 4,
+4100, 2052, 6148, 1028, 5124, 3076, 7172, 516, 4612, 2564, 6660, 1540, 5636,
+3588, 7684, 260, 4356, 2308, 6404, 1284, 5380, 3332, 7428, 772, 4868, 2820,
+6916, 1796, 5892, 3844, 7940, 132, 4228, 2180, 6276, 1156, 5252, 3204, 7300,
+644, 4740, 2692, 6788, 1668, 5764, 3716, 7812, 388, 4484, 2436, 6532, 1412,
+5508, 3460, 7556, 900, 4996, 2948, 7044, 1924, 6020, 3972, 8068, 68, 4164, 2116,
+6212, 1092, 5188, 3140, 7236, 580, 4676, 2628, 6724, 1604, 5700, 3652, 7748,
+324, 4420, 2372, 6468, 1348, 5444, 3396, 7492, 836, 4932, 2884, 6980, 1860,
+5956, 3908, 8004, 196, 4292, 2244, 6340, 1220, 5316, 3268, 7364, 708, 4804,
+2756, 6852, 1732, 5828, 3780, 7876, 452, 4548, 2500, 6596, 1476, 5572, 3524,
+7620, 964, 5060, 3012, 7108, 1988, 6084, 4036, 8132, 36, 4132, 2084, 6180, 1060,
+5156, 3108, 7204, 548, 4644, 2596, 6692, 1572, 5668, 3620, 7716, 292, 4388,
+2340, 6436, 1316, 5412, 3364, 7460, 804, 4900, 2852, 6948, 1828, 5924, 3876,
+7972, 164, 4260, 2212, 6308, 1188, 5284, 3236, 7332, 676, 4772, 2724, 6820,
+1700, 5796, 3748, 7844, 420, 4516, 2468, 6564, 1444, 5540, 3492, 7588, 932,
+5028, 2980, 7076, 1956, 6052, 4004, 8100, 100, 4196, 2148, 6244, 1124, 5220,
+3172, 7268, 612, 4708, 2660, 6756, 1636, 5732, 3684, 7780, 356, 4452, 2404,
+6500, 1380, 5476, 3428, 7524, 868, 4964, 2916, 7012, 1892, 5988, 3940, 8036,
+228, 4324, 2276, 6372, 1252, 5348, 3300, 7396, 740, 4836, 2788, 6884, 1764,
+5860, 3812, 7908, 484, 4580, 2532, 6628, 1508, 5604, 3556, 7652, 996, 5092,
+3044, 7140, 2020, 6116, 4068, 8164, 20, 4116, 2068, 6164, 1044, 5140, 3092,
+7188, 532, 4628, 2580, 6676, 1556, 5652, 3604, 7700, 276, 4372, 2324, 6420,
+1300, 5396, 3348, 7444, 788, 4884, 2836, 6932, 1812, 5908, 3860, 7956, 148,
+4244, 2196, 6292, 1172, 5268, 3220, 7316, 660, 4756, 2708, 6804, 1684, 5780,
+3732, 7828, 404, 4500, 2452, 6548, 1428, 5524, 3476, 7572, 916, 5012, 2964,
+7060, 1940, 6036, 3988, 8084, 84, 4180, 2132, 6228, 1108, 5204, 3156, 7252, 596,
+4692, 2644, 6740, 1620, 5716, 3668, 7764, 340, 4436, 2388, 6484, 1364, 5460,
+3412, 7508, 852, 4948, 2900, 6996, 1876, 5972, 3924, 8020, 212, 4308, 2260,
+6356, 1236, 5332, 3284, 7380, 724, 4820, 2772, 6868, 1748, 5844, 3796, 7892,
+468, 4564, 2516, 6612, 1492, 5588, 3540, 7636, 980, 5076, 3028, 7124, 2004,
+6100, 4052, 8148, 52, 4148, 2100, 6196, 1076, 5172, 3124, 7220, 564, 4660, 2612,
+6708, 1588, 5684, 3636, 7732, 308, 4404, 2356, 6452, 1332, 5428, 3380, 7476,
+820, 4916, 2868, 6964, 1844, 5940, 3892, 7988, 180, 4276, 2228, 6324, 1204,
+5300, 3252, 7348, 692, 4788, 2740, 6836, 1716, 5812, 3764, 7860, 436, 4532,
+2484, 6580, 1460, 5556, 3508, 7604, 948, 5044, 2996, 7092, 1972, 6068, 4020,
+8116, 116, 4212, 2164, 6260, 1140, 5236, 3188, 7284, 628, 4724, 2676, 6772,
+1652, 5748, 3700, 7796, 372, 4468, 2420, 6516, 1396, 5492, 3444, 7540, 884,
+4980, 2932, 7028, 1908, 6004, 3956, 8052, 244, 4340, 2292, 6388, 1268, 5364,
+3316, 7412, 756, 4852, 2804, 6900, 1780, 5876, 3828, 7924, 500, 4596, 2548,
+6644, 1524, 5620, 3572, 7668, 1012, 5108, 3060, 7156, 2036, 6132, 4084, 8180,
+12, 4108, 2060, 6156, 1036, 5132, 3084, 7180, 524, 4620, 2572, 6668, 1548, 5644,
+3596, 7692, 268, 4364, 2316, 6412, 1292, 5388, 3340, 7436, 780, 4876, 2828,
+6924, 1804, 5900, 3852, 7948, 140, 4236, 2188, 6284, 1164, 5260, 3212, 7308,
+652, 4748, 2700, 6796, 1676, 5772, 3724, 7820, 396, 4492, 2444, 6540, 1420,
+5516, 3468, 7564, 908, 5004, 2956, 7052, 1932, 6028, 3980, 8076, 76, 4172, 2124,
+6220, 1100, 5196, 3148, 7244, 588, 4684, 2636, 6732, 1612, 5708, 3660, 7756,
+332, 4428, 2380, 6476, 1356, 5452, 3404, 7500, 844, 4940, 2892, 6988, 1868,
+5964, 3916, 8012, 204, 4300, 2252, 6348, 1228, 5324, 3276, 7372, 716, 4812,
+2764, 6860, 1740, 5836, 3788, 7884, 460, 4556, 2508, 6604, 1484, 5580, 3532,
+7628, 972, 5068, 3020, 7116, 1996, 6092, 4044, 8140, 44, 4140, 2092, 6188, 1068,
+5164, 3116, 7212, 556, 4652, 2604, 6700, 1580, 5676, 3628, 7724, 300, 4396,
+2348, 6444, 1324, 5420, 3372, 7468, 812, 4908, 2860, 6956, 1836, 5932, 3884,
+7980, 172, 4268, 2220, 6316, 1196, 5292, 3244, 7340, 684, 4780, 2732, 6828,
+1708, 5804, 3756, 7852, 428, 4524, 2476, 6572, 1452, 5548, 3500, 7596, 940,
+5036, 2988, 7084, 1964, 6060, 4012, 8108, 108, 4204, 2156, 6252, 1132, 5228,
+3180, 7276, 620, 4716, 2668, 6764, 1644, 5740, 3692, 7788, 364, 4460, 2412,
+6508, 1388, 5484, 3436, 7532, 876, 4972, 2924, 7020, 1900, 5996, 3948, 8044,
+236, 4332, 2284, 6380, 1260, 5356, 3308, 7404, 748, 4844, 2796, 6892, 1772,
+5868, 3820, 7916, 492, 4588, 2540, 6636, 1516, 5612, 3564, 7660, 1004, 5100,
+3052, 7148, 2028, 6124, 4076, 8172, 28, 4124, 2076, 6172, 1052, 5148, 3100,
+7196, 540, 4636, 2588, 6684, 1564, 5660, 3612, 7708, 284, 4380, 2332, 6428,
+1308, 5404, 3356, 7452, 796, 4892, 2844, 6940, 1820, 5916, 3868, 7964, 156,
+4252, 2204, 6300, 1180, 5276, 3228, 7324, 668, 4764, 2716, 6812, 1692, 5788,
+3740, 7836, 412, 4508, 2460, 6556, 1436, 5532, 3484, 7580, 924, 5020, 2972,
+7068, 1948, 6044, 3996, 8092, 92, 4188, 2140, 6236, 1116, 5212, 3164, 7260, 604,
+4700, 2652, 6748, 1628, 5724, 3676, 7772, 348, 4444, 2396, 6492, 1372, 5468,
+3420, 7516, 860, 4956, 2908, 7004, 1884, 5980, 3932, 8028, 220, 4316, 2268,
+6364, 1244, 5340, 3292, 7388, 732, 4828, 2780, 6876, 1756, 5852, 3804, 7900,
+476, 4572, 2524, 6620, 1500, 5596, 3548, 7644, 988, 5084, 3036, 7132, 2012,
+6108, 4060, 8156, 60, 4156, 2108, 6204, 1084, 5180, 3132, 7228, 572, 4668, 2620,
+6716, 1596, 5692, 3644, 7740, 316, 4412, 2364, 6460, 1340, 5436, 3388, 7484,
+828, 4924, 2876, 6972, 1852, 5948, 3900, 7996, 188, 4284, 2236, 6332, 1212,
+5308, 3260, 7356, 700, 4796, 2748, 6844, 1724, 5820, 3772, 7868, 444, 4540,
+2492, 6588, 1468, 5564, 3516, 7612, 956, 5052, 3004, 7100, 1980, 6076, 4028,
+8124, 124, 4220, 2172, 6268, 1148, 5244, 3196, 7292, 636, 4732, 2684, 6780,
+1660, 5756, 3708, 7804, 380, 4476, 2428, 6524, 1404, 5500, 3452, 7548, 892,
+4988, 2940, 7036, 1916, 6012, 3964, 8060, 252, 4348, 2300, 6396, 1276, 5372,
+3324, 7420, 764, 4860, 2812, 6908, 1788, 5884, 3836, 7932, 508, 4604, 2556,
+6652, 1532, 5628, 3580, 7676, 1020, 5116, 3068, 7164, 2044, 6140, 4092, 8188, 2,
+4098, 2050, 6146, 1026, 5122, 3074, 7170, 514, 4610, 2562, 6658, 1538, 5634,
+3586, 7682, 258, 4354, 2306, 6402, 1282, 5378, 3330, 7426, 770, 4866, 2818,
+6914, 1794, 5890, 3842, 7938, 130, 4226, 2178, 6274, 1154, 5250, 3202, 7298,
+642, 4738, 2690, 6786, 1666, 5762, 3714, 7810, 386, 4482, 2434, 6530, 1410,
+5506, 3458, 7554, 898, 4994, 2946, 7042, 1922, 6018, 3970, 8066, 66, 4162, 2114,
+6210, 1090, 5186, 3138, 7234, 578, 4674, 2626, 6722, 1602, 5698, 3650, 7746,
+322, 4418, 2370, 6466, 1346, 5442, 3394, 7490, 834, 4930, 2882, 6978, 1858,
+5954, 3906, 8002, 194, 4290, 2242, 6338, 1218, 5314, 3266, 7362, 706, 4802,
+2754, 6850, 1730, 5826, 3778, 7874, 450, 4546, 2498, 6594, 1474, 5570, 3522,
+7618, 962, 5058, 3010, 7106, 1986, 6082, 4034, 8130, 34, 4130, 2082, 6178, 1058,
+5154, 3106, 7202, 546, 4642, 2594, 6690, 1570, 5666, 3618, 7714, 290, 4386,
+2338, 6434, 1314, 5410, 3362, 7458, 802, 4898, 2850, 6946, 1826, 5922, 3874,
+7970, 162, 4258, 2210, 6306, 1186, 5282, 3234, 7330, 674, 4770, 2722, 6818,
+1698, 5794, 3746, 7842, 418, 4514, 2466, 6562, 1442, 5538, 3490, 7586, 930,
+5026, 2978, 7074, 1954, 6050, 4002, 8098, 98, 4194, 2146, 6242, 1122, 5218,
+3170, 7266, 610, 4706, 2658, 6754, 1634, 5730, 3682, 7778, 354, 4450, 2402,
+6498, 1378, 5474, 3426, 7522, 866, 4962, 2914, 7010, 1890, 5986, 3938, 8034,
+226, 4322, 2274, 6370, 1250, 5346, 3298, 7394, 738, 4834, 2786, 6882, 1762,
+5858, 3810, 7906, 482, 4578, 2530, 6626, 1506, 5602, 3554, 7650, 994, 5090,
+3042, 7138, 2018, 6114, 4066, 8162, 18, 4114, 2066, 6162, 1042, 5138, 3090,
+7186, 530, 4626, 2578, 6674, 1554, 5650, 3602, 7698, 274, 4370, 2322, 6418,
+1298, 5394, 3346, 7442, 786, 4882, 2834, 6930, 1810, 5906, 3858, 7954, 146,
+4242, 2194, 6290, 1170, 5266, 3218, 7314, 658, 4754, 2706, 6802, 1682, 5778,
+3730, 7826, 402, 4498, 2450, 6546, 1426, 5522, 3474, 7570, 914, 5010, 2962,
+7058, 1938, 6034, 3986, 8082, 82, 4178, 2130, 6226, 1106, 5202, 3154, 7250, 594,
+4690, 2642, 6738, 1618, 5714, 3666, 7762, 338, 4434, 2386, 6482, 1362, 5458,
+3410, 7506, 850, 4946, 2898, 6994, 1874, 5970, 3922, 8018, 210, 4306, 2258,
+6354, 1234, 5330, 3282, 7378, 722, 4818, 2770, 6866, 1746, 5842, 3794, 7890,
+466, 4562, 2514, 6610, 1490, 5586, 3538, 7634, 978, 5074, 3026, 7122, 2002,
+6098, 4050, 8146, 50, 4146, 2098, 6194, 1074, 5170, 3122, 7218, 562, 4658, 2610,
+6706, 1586, 5682, 3634, 7730, 306, 4402, 2354, 6450, 1330, 5426, 3378, 7474,
+818, 4914, 2866, 6962, 1842, 5938, 3890, 7986, 178, 4274, 2226, 6322, 1202,
+5298, 3250, 7346, 690, 4786, 2738, 6834, 1714, 5810, 3762, 7858, 434, 4530,
+2482, 6578, 1458, 5554, 3506, 7602, 946, 5042, 2994, 7090, 1970, 6066, 4018,
+8114, 114, 4210, 2162, 6258, 1138, 5234, 3186, 7282, 626, 4722, 2674, 6770,
+1650, 5746, 3698, 7794, 370, 4466, 2418, 6514, 1394, 5490, 3442, 7538, 882,
+4978, 2930, 7026, 1906, 6002, 3954, 8050, 242, 4338, 2290, 6386, 1266, 5362,
+3314, 7410, 754, 4850, 2802, 6898, 1778, 5874, 3826, 7922, 498, 4594, 2546,
+6642, 1522, 5618, 3570, 7666, 1010, 5106, 3058, 7154, 2034, 6130, 4082, 8178,
+10, 4106, 2058, 6154, 1034, 5130, 3082, 7178, 522, 4618, 2570, 6666, 1546, 5642,
+3594, 7690, 266, 4362, 2314, 6410, 1290, 5386, 3338, 7434, 778, 4874, 2826,
+6922, 1802, 5898, 3850, 7946, 138, 4234, 2186, 6282, 1162, 5258, 3210, 7306,
+650, 4746, 2698, 6794, 1674, 5770, 3722, 7818, 394, 4490, 2442, 6538, 1418,
+5514, 3466, 7562, 906, 5002, 2954, 7050, 1930, 6026, 3978, 8074, 74, 4170, 2122,
+6218, 1098, 5194, 3146, 7242, 586, 4682, 2634, 6730, 1610, 5706, 3658, 7754,
+330, 4426, 2378, 6474, 1354, 5450, 3402, 7498, 842, 4938, 2890, 6986, 1866,
+5962, 3914, 8010, 202, 4298, 2250, 6346, 1226, 5322, 3274, 7370, 714, 4810,
+2762, 6858, 1738, 5834, 3786, 7882, 458, 4554, 2506, 6602, 1482, 5578, 3530,
+7626, 970, 5066, 3018, 7114, 1994, 6090, 4042, 8138, 42, 4138, 2090, 6186, 1066,
+5162, 3114, 7210, 554, 4650, 2602, 6698, 1578, 5674, 3626, 7722, 298, 4394,
+2346, 6442, 1322, 5418, 3370, 7466, 810, 4906, 2858, 6954, 1834, 5930, 3882,
+7978, 170, 4266, 2218, 6314, 1194, 5290, 3242, 7338, 682, 4778, 2730, 6826,
+1706, 5802, 3754, 7850, 426, 4522, 2474, 6570, 1450, 5546, 3498, 7594, 938,
+5034, 2986, 7082, 1962, 6058, 4010, 8106, 106, 4202, 2154, 6250, 1130, 5226,
+3178, 7274, 618, 4714, 2666, 6762, 1642, 5738, 3690, 7786, 362, 4458, 2410,
+6506, 1386, 5482, 3434, 7530, 874, 4970, 2922, 7018, 1898, 5994, 3946, 8042,
+234, 4330, 2282, 6378, 1258, 5354, 3306, 7402, 746, 4842, 2794, 6890, 1770,
+5866, 3818, 7914, 490, 4586, 2538, 6634, 1514, 5610, 3562, 7658, 1002, 5098,
+3050, 7146, 2026, 6122, 4074, 8170, 26, 4122, 2074, 6170, 1050, 5146, 3098,
+7194, 538, 4634, 2586, 6682, 1562, 5658, 3610, 7706, 282, 4378, 2330, 6426,
+1306, 5402, 3354, 7450, 794, 4890, 2842, 6938, 1818, 5914, 3866, 7962, 154,
+4250, 2202, 6298, 1178, 5274, 3226, 7322, 666, 4762, 2714, 6810, 1690, 5786,
+3738, 7834, 410, 4506, 2458, 6554, 1434, 5530, 3482, 7578, 922, 5018, 2970,
+7066, 1946, 6042, 3994, 8090, 90, 4186, 2138, 6234, 1114, 5210, 3162, 7258, 602,
+4698, 2650, 6746, 1626, 5722, 3674, 7770, 346, 4442, 2394, 6490, 1370, 5466,
+3418, 7514, 858, 4954, 2906, 7002, 1882, 5978, 3930, 8026, 218, 4314, 2266,
+6362, 1242, 5338, 3290, 7386, 730, 4826, 2778, 6874, 1754, 5850, 3802, 7898,
+474, 4570, 2522, 6618, 1498, 5594, 3546, 7642, 986, 5082, 3034, 7130, 2010,
+6106, 4058, 8154, 58, 4154, 2106, 6202, 1082, 5178, 3130, 7226, 570, 4666, 2618,
+6714, 1594, 5690, 3642, 7738, 314, 4410, 2362, 6458, 1338, 5434, 3386, 7482,
+826, 4922, 2874, 6970, 1850, 5946, 3898, 7994, 186, 4282, 2234, 6330, 1210,
+5306, 3258, 7354, 698, 4794, 2746, 6842, 1722, 5818, 3770, 7866, 442, 4538,
+2490, 6586, 1466, 5562, 3514, 7610, 954, 5050, 3002, 7098, 1978, 6074, 4026,
+8122, 122, 4218, 2170, 6266, 1146, 5242, 3194, 7290, 634, 4730, 2682, 6778,
+1658, 5754, 3706, 7802, 378, 4474, 2426, 6522, 1402, 5498, 3450, 7546, 890,
+4986, 2938, 7034, 1914, 6010, 3962, 8058, 250, 4346, 2298, 6394, 1274, 5370,
+3322, 7418, 762, 4858, 2810, 6906, 1786, 5882, 3834, 7930, 506, 4602, 2554,
+6650, 1530, 5626, 3578, 7674, 1018, 5114, 3066, 7162, 2042, 6138, 4090, 8186, 6,
+4102, 2054, 6150, 1030, 5126, 3078, 7174, 518, 4614, 2566, 6662, 1542, 5638,
+3590, 7686, 262, 4358, 2310, 6406, 1286, 5382, 3334, 7430, 774, 4870, 2822,
+6918, 1798, 5894, 3846, 7942, 134, 4230, 2182, 6278, 1158, 5254, 3206, 7302,
+646, 4742, 2694, 6790, 1670, 5766, 3718, 7814, 390, 4486, 2438, 6534, 1414,
+5510, 3462, 7558, 902, 4998, 2950, 7046, 1926, 6022, 3974, 8070, 70, 4166, 2118,
+6214, 1094, 5190, 3142, 7238, 582, 4678, 2630, 6726, 1606, 5702, 3654, 7750,
+326, 4422, 2374, 6470, 1350, 5446, 3398, 7494, 838, 4934, 2886, 6982, 1862,
+5958, 3910, 8006, 198, 4294, 2246, 6342, 1222, 5318, 3270, 7366, 710, 4806,
+2758, 6854, 1734, 5830, 3782, 7878, 454, 4550, 2502, 6598, 1478, 5574, 3526,
+7622, 966, 5062, 3014, 7110, 1990, 6086, 4038, 8134, 38, 4134, 2086, 6182, 1062,
+5158, 3110, 7206, 550, 4646, 2598, 6694, 1574, 5670, 3622, 7718, 294, 4390,
+2342, 6438, 1318, 5414, 3366, 7462, 806, 4902, 2854, 6950, 1830, 5926, 3878,
+7974, 166, 4262, 2214, 6310, 1190, 5286, 3238, 7334, 678, 4774, 2726, 6822,
+1702, 5798, 3750, 7846, 422, 4518, 2470, 6566, 1446, 5542, 3494, 7590, 934,
+5030, 2982, 7078, 1958, 6054, 4006, 8102, 102, 4198, 2150, 6246, 1126, 5222,
+3174, 7270, 614, 4710, 2662, 6758, 1638, 5734, 3686, 7782, 358, 4454, 2406,
+6502, 1382, 5478, 3430, 7526, 870, 4966, 2918, 7014, 1894, 5990, 3942, 8038,
+230, 4326, 2278, 6374, 1254, 5350, 3302, 7398, 742, 4838, 2790, 6886, 1766,
+5862, 3814, 7910, 486, 4582, 2534, 6630, 1510, 5606, 3558, 7654, 998, 5094,
+3046, 7142, 2022, 6118, 4070, 8166, 22, 4118, 2070, 6166, 1046, 5142, 3094,
+7190, 534, 4630, 2582, 6678, 1558, 5654, 3606, 7702, 278, 4374, 2326, 6422,
+1302, 5398, 3350, 7446, 790, 4886, 2838, 6934, 1814, 5910, 3862, 7958, 150,
+4246, 2198, 6294, 1174, 5270, 3222, 7318, 662, 4758, 2710, 6806, 1686, 5782,
+3734, 7830, 406, 4502, 2454, 6550, 1430, 5526, 3478, 7574, 918, 5014, 2966,
+7062, 1942, 6038, 3990, 8086, 86, 4182, 2134, 6230, 1110, 5206, 3158, 7254, 598,
+4694, 2646, 6742, 1622, 5718, 3670, 7766, 342, 4438, 2390, 6486, 1366, 5462,
+3414, 7510, 854, 4950, 2902, 6998, 1878, 5974, 3926, 8022, 214, 4310, 2262,
+6358, 1238, 5334, 3286, 7382, 726, 4822, 2774, 6870, 1750, 5846, 3798, 7894,
+470, 4566, 2518, 6614, 1494, 5590, 3542, 7638, 982, 5078, 3030, 7126, 2006,
+6102, 4054, 8150, 54, 4150, 2102, 6198, 1078, 5174, 3126, 7222, 566, 4662, 2614,
+6710, 1590, 5686, 3638, 7734, 310, 4406, 2358, 6454, 1334, 5430, 3382, 7478,
+822, 4918, 2870, 6966, 1846, 5942, 3894, 7990, 182, 4278, 2230, 6326, 1206,
+5302, 3254, 7350, 694, 4790, 2742, 6838, 1718, 5814, 3766, 7862, 438, 4534,
+2486, 6582, 1462, 5558, 3510, 7606, 950, 5046, 2998, 7094, 1974, 6070, 4022,
+8118, 118, 4214, 2166, 6262, 1142, 5238, 3190, 7286, 630, 4726, 2678, 6774,
+1654, 5750, 3702, 7798, 374, 4470, 2422, 6518, 1398, 5494, 3446, 7542, 886,
+4982, 2934, 7030, 1910, 6006, 3958, 8054, 246, 4342, 2294, 6390, 1270, 5366,
+3318, 7414, 758, 4854, 2806, 6902, 1782, 5878, 3830, 7926, 502, 4598, 2550,
+6646, 1526, 5622, 3574, 7670, 1014, 5110, 3062, 7158, 2038, 6134, 4086, 8182,
+14, 4110, 2062, 6158, 1038, 5134, 3086, 7182, 526, 4622, 2574, 6670, 1550, 5646,
+3598, 7694, 270, 4366, 2318, 6414, 1294, 5390, 3342, 7438, 782, 4878, 2830,
+6926, 1806, 5902, 3854, 7950, 142, 4238, 2190, 6286, 1166, 5262, 3214, 7310,
+654, 4750, 2702, 6798, 1678, 5774, 3726, 7822, 398, 4494, 2446, 6542, 1422,
+5518, 3470, 7566, 910, 5006, 2958, 7054, 1934, 6030, 3982, 8078, 78, 4174, 2126,
+6222, 1102, 5198, 3150, 7246, 590, 4686, 2638, 6734, 1614, 5710, 3662, 7758,
+334, 4430, 2382, 6478, 1358, 5454, 3406, 7502, 846, 4942, 2894, 6990, 1870,
+5966, 3918, 8014, 206, 4302, 2254, 6350, 1230, 5326, 3278, 7374, 718, 4814,
+2766, 6862, 1742, 5838, 3790, 7886, 462, 4558, 2510, 6606, 1486, 5582, 3534,
+7630, 974, 5070, 3022, 7118, 1998, 6094, 4046, 8142, 46, 4142, 2094, 6190, 1070,
+5166, 3118, 7214, 558, 4654, 2606, 6702, 1582, 5678, 3630, 7726, 302, 4398,
+2350, 6446, 1326, 5422, 3374, 7470, 814, 4910, 2862, 6958, 1838, 5934, 3886,
+7982, 174, 4270, 2222, 6318, 1198, 5294, 3246, 7342, 686, 4782, 2734, 6830,
+1710, 5806, 3758, 7854, 430, 4526, 2478, 6574, 1454, 5550, 3502, 7598, 942,
+5038, 2990, 7086, 1966, 6062, 4014, 8110, 110, 4206, 2158, 6254, 1134, 5230,
+3182, 7278, 622, 4718, 2670, 6766, 1646, 5742, 3694, 7790, 366, 4462, 2414,
+6510, 1390, 5486, 3438, 7534, 878, 4974, 2926, 7022, 1902, 5998, 3950, 8046,
+238, 4334, 2286, 6382, 1262, 5358, 3310, 7406, 750, 4846, 2798, 6894, 1774,
+5870, 3822, 7918, 494, 4590, 2542, 6638, 1518, 5614, 3566, 7662, 1006, 5102,
+3054, 7150, 2030, 6126, 4078, 8174, 30, 4126, 2078, 6174, 1054, 5150, 3102,
+7198, 542, 4638, 2590, 6686, 1566, 5662, 3614, 7710, 286, 4382, 2334, 6430,
+1310, 5406, 3358, 7454, 798, 4894, 2846, 6942, 1822, 5918, 3870, 7966, 158,
+4254, 2206, 6302, 1182, 5278, 3230, 7326, 670, 4766, 2718, 6814, 1694, 5790,
+3742, 7838, 414, 4510, 2462, 6558, 1438, 5534, 3486, 7582, 926, 5022, 2974,
+7070, 1950, 6046, 3998, 8094, 94, 4190, 2142, 6238, 1118, 5214, 3166, 7262, 606,
+4702, 2654, 6750, 1630, 5726, 3678, 7774, 350, 4446, 2398, 6494, 1374, 5470,
+3422, 7518, 862, 4958, 2910, 7006, 1886, 5982, 3934, 8030, 222, 4318, 2270,
+6366, 1246, 5342, 3294, 7390, 734, 4830, 2782, 6878, 1758, 5854, 3806, 7902,
+478, 4574, 2526, 6622, 1502, 5598, 3550, 7646, 990, 5086, 3038, 7134, 2014,
+6110, 4062, 8158, 62, 4158, 2110, 6206, 1086, 5182, 3134, 7230, 574, 4670, 2622,
+6718, 1598, 5694, 3646, 7742, 318, 4414, 2366, 6462, 1342, 5438, 3390, 7486,
+830, 4926, 2878, 6974, 1854, 5950, 3902, 7998, 190, 4286, 2238, 6334, 1214,
+5310, 3262, 7358, 702, 4798, 2750, 6846, 1726, 5822, 3774, 7870, 446, 4542,
+2494, 6590, 1470, 5566, 3518, 7614, 958, 5054, 3006, 7102, 1982, 6078, 4030,
+8126, 126, 4222, 2174, 6270, 1150, 5246, 3198, 7294, 638, 4734, 2686, 6782,
+1662, 5758, 3710, 7806, 382, 4478, 2430, 6526, 1406, 5502, 3454, 7550, 894,
+4990, 2942, 7038, 1918, 6014, 3966, 8062, 254, 4350, 2302, 6398, 1278, 5374,
+3326, 7422, 766, 4862, 2814, 6910, 1790, 5886, 3838, 7934, 510, 4606, 2558,
+6654, 1534, 5630, 3582, 7678, 1022, 5118, 3070, 7166, 2046, 6142, 4094, 8190, 1,
+4097, 2049, 6145, 1025, 5121, 3073, 7169, 513, 4609, 2561, 6657, 1537, 5633,
+3585, 7681, 257, 4353, 2305, 6401, 1281, 5377, 3329, 7425, 769, 4865, 2817,
+6913, 1793, 5889, 3841, 7937, 129, 4225, 2177, 6273, 1153, 5249, 3201, 7297,
+641, 4737, 2689, 6785, 1665, 5761, 3713, 7809, 385, 4481, 2433, 6529, 1409,
+5505, 3457, 7553, 897, 4993, 2945, 7041, 1921, 6017, 3969, 8065, 65, 4161, 2113,
+6209, 1089, 5185, 3137, 7233, 577, 4673, 2625, 6721, 1601, 5697, 3649, 7745,
+321, 4417, 2369, 6465, 1345, 5441, 3393, 7489, 833, 4929, 2881, 6977, 1857,
+5953, 3905, 8001, 193, 4289, 2241, 6337, 1217, 5313, 3265, 7361, 705, 4801,
+2753, 6849, 1729, 5825, 3777, 7873, 449, 4545, 2497, 6593, 1473, 5569, 3521,
+7617, 961, 5057, 3009, 7105, 1985, 6081, 4033, 8129, 33, 4129, 2081, 6177, 1057,
+5153, 3105, 7201, 545, 4641, 2593, 6689, 1569, 5665, 3617, 7713, 289, 4385,
+2337, 6433, 1313, 5409, 3361, 7457, 801, 4897, 2849, 6945, 1825, 5921, 3873,
+7969, 161, 4257, 2209, 6305, 1185, 5281, 3233, 7329, 673, 4769, 2721, 6817,
+1697, 5793, 3745, 7841, 417, 4513, 2465, 6561, 1441, 5537, 3489, 7585, 929,
+5025, 2977, 7073, 1953, 6049, 4001, 8097, 97, 4193, 2145, 6241, 1121, 5217,
+3169, 7265, 609, 4705, 2657, 6753, 1633, 5729, 3681, 7777, 353, 4449, 2401,
+6497, 1377, 5473, 3425, 7521, 865, 4961, 2913, 7009, 1889, 5985, 3937, 8033,
+225, 4321, 2273, 6369, 1249, 5345, 3297, 7393, 737, 4833, 2785, 6881, 1761,
+5857, 3809, 7905, 481, 4577, 2529, 6625, 1505, 5601, 3553, 7649, 993, 5089,
+3041, 7137, 2017, 6113, 4065, 8161, 17, 4113, 2065, 6161, 1041, 5137, 3089,
+7185, 529, 4625, 2577, 6673, 1553, 5649, 3601, 7697, 273, 4369, 2321, 6417,
+1297, 5393, 3345, 7441, 785, 4881, 2833, 6929, 1809, 5905, 3857, 7953, 145,
+4241, 2193, 6289, 1169, 5265, 3217, 7313, 657, 4753, 2705, 6801, 1681, 5777,
+3729, 7825, 401, 4497, 2449, 6545, 1425, 5521, 3473, 7569, 913, 5009, 2961,
+7057, 1937, 6033, 3985, 8081, 81, 4177, 2129, 6225, 1105, 5201, 3153, 7249, 593,
+4689, 2641, 6737, 1617, 5713, 3665, 7761, 337, 4433, 2385, 6481, 1361, 5457,
+3409, 7505, 849, 4945, 2897, 6993, 1873, 5969, 3921, 8017, 209, 4305, 2257,
+6353, 1233, 5329, 3281, 7377, 721, 4817, 2769, 6865, 1745, 5841, 3793, 7889,
+465, 4561, 2513, 6609, 1489, 5585, 3537, 7633, 977, 5073, 3025, 7121, 2001,
+6097, 4049, 8145, 49, 4145, 2097, 6193, 1073, 5169, 3121, 7217, 561, 4657, 2609,
+6705, 1585, 5681, 3633, 7729, 305, 4401, 2353, 6449, 1329, 5425, 3377, 7473,
+817, 4913, 2865, 6961, 1841, 5937, 3889, 7985, 177, 4273, 2225, 6321, 1201,
+5297, 3249, 7345, 689, 4785, 2737, 6833, 1713, 5809, 3761, 7857, 433, 4529,
+2481, 6577, 1457, 5553, 3505, 7601, 945, 5041, 2993, 7089, 1969, 6065, 4017,
+8113, 113, 4209, 2161, 6257, 1137, 5233, 3185, 7281, 625, 4721, 2673, 6769,
+1649, 5745, 3697, 7793, 369, 4465, 2417, 6513, 1393, 5489, 3441, 7537, 881,
+4977, 2929, 7025, 1905, 6001, 3953, 8049, 241, 4337, 2289, 6385, 1265, 5361,
+3313, 7409, 753, 4849, 2801, 6897, 1777, 5873, 3825, 7921, 497, 4593, 2545,
+6641, 1521, 5617, 3569, 7665, 1009, 5105, 3057, 7153, 2033, 6129, 4081, 8177, 9,
+4105, 2057, 6153, 1033, 5129, 3081, 7177, 521, 4617, 2569, 6665, 1545, 5641,
+3593, 7689, 265, 4361, 2313, 6409, 1289, 5385, 3337, 7433, 777, 4873, 2825,
+6921, 1801, 5897, 3849, 7945, 137, 4233, 2185, 6281, 1161, 5257, 3209, 7305,
+649, 4745, 2697, 6793, 1673, 5769, 3721, 7817, 393, 4489, 2441, 6537, 1417,
+5513, 3465, 7561, 905, 5001, 2953, 7049, 1929, 6025, 3977, 8073, 73, 4169, 2121,
+6217, 1097, 5193, 3145, 7241, 585, 4681, 2633, 6729, 1609, 5705, 3657, 7753,
+329, 4425, 2377, 6473, 1353, 5449, 3401, 7497, 841, 4937, 2889, 6985, 1865,
+5961, 3913, 8009, 201, 4297, 2249, 6345, 1225, 5321, 3273, 7369, 713, 4809,
+2761, 6857, 1737, 5833, 3785, 7881, 457, 4553, 2505, 6601, 1481, 5577, 3529,
+7625, 969, 5065, 3017, 7113, 1993, 6089, 4041, 8137, 41, 4137, 2089, 6185, 1065,
+5161, 3113, 7209, 553, 4649, 2601, 6697, 1577, 5673, 3625, 7721, 297, 4393,
+2345, 6441, 1321, 5417, 3369, 7465, 809, 4905, 2857, 6953, 1833, 5929, 3881,
+7977, 169, 4265, 2217, 6313, 1193, 5289, 3241, 7337, 681, 4777, 2729, 6825,
+1705, 5801, 3753, 7849, 425, 4521, 2473, 6569, 1449, 5545, 3497, 7593, 937,
+5033, 2985, 7081, 1961, 6057, 4009, 8105, 105, 4201, 2153, 6249, 1129, 5225,
+3177, 7273, 617, 4713, 2665, 6761, 1641, 5737, 3689, 7785, 361, 4457, 2409,
+6505, 1385, 5481, 3433, 7529, 873, 4969, 2921, 7017, 1897, 5993, 3945, 8041,
+233, 4329, 2281, 6377, 1257, 5353, 3305, 7401, 745, 4841, 2793, 6889, 1769,
+5865, 3817, 7913, 489, 4585, 2537, 6633, 1513, 5609, 3561, 7657, 1001, 5097,
+3049, 7145, 2025, 6121, 4073, 8169, 25, 4121, 2073, 6169, 1049, 5145, 3097,
+7193, 537, 4633, 2585, 6681, 1561, 5657, 3609, 7705, 281, 4377, 2329, 6425,
+1305, 5401, 3353, 7449, 793, 4889, 2841, 6937, 1817, 5913, 3865, 7961, 153,
+4249, 2201, 6297, 1177, 5273, 3225, 7321, 665, 4761, 2713, 6809, 1689, 5785,
+3737, 7833, 409, 4505, 2457, 6553, 1433, 5529, 3481, 7577, 921, 5017, 2969,
+7065, 1945, 6041, 3993, 8089, 89, 4185, 2137, 6233, 1113, 5209, 3161, 7257, 601,
+4697, 2649, 6745, 1625, 5721, 3673, 7769, 345, 4441, 2393, 6489, 1369, 5465,
+3417, 7513, 857, 4953, 2905, 7001, 1881, 5977, 3929, 8025, 217, 4313, 2265,
+6361, 1241, 5337, 3289, 7385, 729, 4825, 2777, 6873, 1753, 5849, 3801, 7897,
+473, 4569, 2521, 6617, 1497, 5593, 3545, 7641, 985, 5081, 3033, 7129, 2009,
+6105, 4057, 8153, 57, 4153, 2105, 6201, 1081, 5177, 3129, 7225, 569, 4665, 2617,
+6713, 1593, 5689, 3641, 7737, 313, 4409, 2361, 6457, 1337, 5433, 3385, 7481,
+825, 4921, 2873, 6969, 1849, 5945, 3897, 7993, 185, 4281, 2233, 6329, 1209,
+5305, 3257, 7353, 697, 4793, 2745, 6841, 1721, 5817, 3769, 7865, 441, 4537,
+2489, 6585, 1465, 5561, 3513, 7609, 953, 5049, 3001, 7097, 1977, 6073, 4025,
+8121, 121, 4217, 2169, 6265, 1145, 5241, 3193, 7289, 633, 4729, 2681, 6777,
+1657, 5753, 3705, 7801, 377, 4473, 2425, 6521, 1401, 5497, 3449, 7545, 889,
+4985, 2937, 7033, 1913, 6009, 3961, 8057, 249, 4345, 2297, 6393, 1273, 5369,
+3321, 7417, 761, 4857, 2809, 6905, 1785, 5881, 3833, 7929, 505, 4601, 2553,
+6649, 1529, 5625, 3577, 7673, 1017, 5113, 3065, 7161, 2041, 6137, 4089, 8185, 5,
+4101, 2053, 6149, 1029, 5125, 3077, 7173, 517, 4613, 2565, 6661, 1541, 5637,
+3589, 7685, 261, 4357, 2309, 6405, 1285, 5381, 3333, 7429, 773, 4869, 2821,
+6917, 1797, 5893, 3845, 7941, 133, 4229, 2181, 6277, 1157, 5253, 3205, 7301,
+645, 4741, 2693, 6789, 1669, 5765, 3717, 7813, 389, 4485, 2437, 6533, 1413,
+5509, 3461, 7557, 901, 4997, 2949, 7045, 1925, 6021, 3973, 8069, 69, 4165, 2117,
+6213, 1093, 5189, 3141, 7237, 581, 4677, 2629, 6725, 1605, 5701, 3653, 7749,
+325, 4421, 2373, 6469, 1349, 5445, 3397, 7493, 837, 4933, 2885, 6981, 1861,
+5957, 3909, 8005, 197, 4293, 2245, 6341, 1221, 5317, 3269, 7365, 709, 4805,
+2757, 6853, 1733, 5829, 3781, 7877, 453, 4549, 2501, 6597, 1477, 5573, 3525,
+7621, 965, 5061, 3013, 7109, 1989, 6085, 4037, 8133, 37, 4133, 2085, 6181, 1061,
+5157, 3109, 7205, 549, 4645, 2597, 6693, 1573, 5669, 3621, 7717, 293, 4389,
+2341, 6437, 1317, 5413, 3365, 7461, 805, 4901, 2853, 6949, 1829, 5925, 3877,
+7973, 165, 4261, 2213, 6309, 1189, 5285, 3237, 7333, 677, 4773, 2725, 6821,
+1701, 5797, 3749, 7845, 421, 4517, 2469, 6565, 1445, 5541, 3493, 7589, 933,
+5029, 2981, 7077, 1957, 6053, 4005, 8101, 101, 4197, 2149, 6245, 1125, 5221,
+3173, 7269, 613, 4709, 2661, 6757, 1637, 5733, 3685, 7781, 357, 4453, 2405,
+6501, 1381, 5477, 3429, 7525, 869, 4965, 2917, 7013, 1893, 5989, 3941, 8037,
+229, 4325, 2277, 6373, 1253, 5349, 3301, 7397, 741, 4837, 2789, 6885, 1765,
+5861, 3813, 7909, 485, 4581, 2533, 6629, 1509, 5605, 3557, 7653, 997, 5093,
+3045, 7141, 2021, 6117, 4069, 8165, 21, 4117, 2069, 6165, 1045, 5141, 3093,
+7189, 533, 4629, 2581, 6677, 1557, 5653, 3605, 7701, 277, 4373, 2325, 6421,
+1301, 5397, 3349, 7445, 789, 4885, 2837, 6933, 1813, 5909, 3861, 7957, 149,
+4245, 2197, 6293, 1173, 5269, 3221, 7317, 661, 4757, 2709, 6805, 1685, 5781,
+3733, 7829, 405, 4501, 2453, 6549, 1429, 5525, 3477, 7573, 917, 5013, 2965,
+7061, 1941, 6037, 3989, 8085, 85, 4181, 2133, 6229, 1109, 5205, 3157, 7253, 597,
+4693, 2645, 6741, 1621, 5717, 3669, 7765, 341, 4437, 2389, 6485, 1365, 5461,
+3413, 7509, 853, 4949, 2901, 6997, 1877, 5973, 3925, 8021, 213, 4309, 2261,
+6357, 1237, 5333, 3285, 7381, 725, 4821, 2773, 6869, 1749, 5845, 3797, 7893,
+469, 4565, 2517, 6613, 1493, 5589, 3541, 7637, 981, 5077, 3029, 7125, 2005,
+6101, 4053, 8149, 53, 4149, 2101, 6197, 1077, 5173, 3125, 7221, 565, 4661, 2613,
+6709, 1589, 5685, 3637, 7733, 309, 4405, 2357, 6453, 1333, 5429, 3381, 7477,
+821, 4917, 2869, 6965, 1845, 5941, 3893, 7989, 181, 4277, 2229, 6325, 1205,
+5301, 3253, 7349, 693, 4789, 2741, 6837, 1717, 5813, 3765, 7861, 437, 4533,
+2485, 6581, 1461, 5557, 3509, 7605, 949, 5045, 2997, 7093, 1973, 6069, 4021,
+8117, 117, 4213, 2165, 6261, 1141, 5237, 3189, 7285, 629, 4725, 2677, 6773,
+1653, 5749, 3701, 7797, 373, 4469, 2421, 6517, 1397, 5493, 3445, 7541, 885,
+4981, 2933, 7029, 1909, 6005, 3957, 8053, 245, 4341, 2293, 6389, 1269, 5365,
+3317, 7413, 757, 4853, 2805, 6901, 1781, 5877, 3829, 7925, 501, 4597, 2549,
+6645, 1525, 5621, 3573, 7669, 1013, 5109, 3061, 7157, 2037, 6133, 4085, 8181,
+13, 4109, 2061, 6157, 1037, 5133, 3085, 7181, 525, 4621, 2573, 6669, 1549, 5645,
+3597, 7693, 269, 4365, 2317, 6413, 1293, 5389, 3341, 7437, 781, 4877, 2829,
+6925, 1805, 5901, 3853, 7949, 141, 4237, 2189, 6285, 1165, 5261, 3213, 7309,
+653, 4749, 2701, 6797, 1677, 5773, 3725, 7821, 397, 4493, 2445, 6541, 1421,
+5517, 3469, 7565, 909, 5005, 2957, 7053, 1933, 6029, 3981, 8077, 77, 4173, 2125,
+6221, 1101, 5197, 3149, 7245, 589, 4685, 2637, 6733, 1613, 5709, 3661, 7757,
+333, 4429, 2381, 6477, 1357, 5453, 3405, 7501, 845, 4941, 2893, 6989, 1869,
+5965, 3917, 8013, 205, 4301, 2253, 6349, 1229, 5325, 3277, 7373, 717, 4813,
+2765, 6861, 1741, 5837, 3789, 7885, 461, 4557, 2509, 6605, 1485, 5581, 3533,
+7629, 973, 5069, 3021, 7117, 1997, 6093, 4045, 8141, 45, 4141, 2093, 6189, 1069,
+5165, 3117, 7213, 557, 4653, 2605, 6701, 1581, 5677, 3629, 7725, 301, 4397,
+2349, 6445, 1325, 5421, 3373, 7469, 813, 4909, 2861, 6957, 1837, 5933, 3885,
+7981, 173, 4269, 2221, 6317, 1197, 5293, 3245, 7341, 685, 4781, 2733, 6829,
+1709, 5805, 3757, 7853, 429, 4525, 2477, 6573, 1453, 5549, 3501, 7597, 941,
+5037, 2989, 7085, 1965, 6061, 4013, 8109, 109, 4205, 2157, 6253, 1133, 5229,
+3181, 7277, 621, 4717, 2669, 6765, 1645, 5741, 3693, 7789, 365, 4461, 2413,
+6509, 1389, 5485, 3437, 7533, 877, 4973, 2925, 7021, 1901, 5997, 3949, 8045,
+237, 4333, 2285, 6381, 1261, 5357, 3309, 7405, 749, 4845, 2797, 6893, 1773,
+5869, 3821, 7917, 493, 4589, 2541, 6637, 1517, 5613, 3565, 7661, 1005, 5101,
+3053, 7149, 2029, 6125, 4077, 8173, 29, 4125, 2077, 6173, 1053, 5149, 3101,
+7197, 541, 4637, 2589, 6685, 1565, 5661, 3613, 7709, 285, 4381, 2333, 6429,
+1309, 5405, 3357, 7453, 797, 4893, 2845, 6941, 1821, 5917, 3869, 7965, 157,
+4253, 2205, 6301, 1181, 5277, 3229, 7325, 669, 4765, 2717, 6813, 1693, 5789,
+3741, 7837, 413, 4509, 2461, 6557, 1437, 5533, 3485, 7581, 925, 5021, 2973,
+7069, 1949, 6045, 3997, 8093, 93, 4189, 2141, 6237, 1117, 5213, 3165, 7261, 605,
+4701, 2653, 6749, 1629, 5725, 3677, 7773, 349, 4445, 2397, 6493, 1373, 5469,
+3421, 7517, 861, 4957, 2909, 7005, 1885, 5981, 3933, 8029, 221, 4317, 2269,
+6365, 1245, 5341, 3293, 7389, 733, 4829, 2781, 6877, 1757, 5853, 3805, 7901,
+477, 4573, 2525, 6621, 1501, 5597, 3549, 7645, 989, 5085, 3037, 7133, 2013,
+6109, 4061, 8157, 61, 4157, 2109, 6205, 1085, 5181, 3133, 7229, 573, 4669, 2621,
+6717, 1597, 5693, 3645, 7741, 317, 4413, 2365, 6461, 1341, 5437, 3389, 7485,
+829, 4925, 2877, 6973, 1853, 5949, 3901, 7997, 189, 4285, 2237, 6333, 1213,
+5309, 3261, 7357, 701, 4797, 2749, 6845, 1725, 5821, 3773, 7869, 445, 4541,
+2493, 6589, 1469, 5565, 3517, 7613, 957, 5053, 3005, 7101, 1981, 6077, 4029,
+8125, 125, 4221, 2173, 6269, 1149, 5245, 3197, 7293, 637, 4733, 2685, 6781,
+1661, 5757, 3709, 7805, 381, 4477, 2429, 6525, 1405, 5501, 3453, 7549, 893,
+4989, 2941, 7037, 1917, 6013, 3965, 8061, 253, 4349, 2301, 6397, 1277, 5373,
+3325, 7421, 765, 4861, 2813, 6909, 1789, 5885, 3837, 7933, 509, 4605, 2557,
+6653, 1533, 5629, 3581, 7677, 1021, 5117, 3069, 7165, 2045, 6141, 4093, 8189, 3,
+4099, 2051, 6147, 1027, 5123, 3075, 7171, 515, 4611, 2563, 6659, 1539, 5635,
+3587, 7683, 259, 4355, 2307, 6403, 1283, 5379, 3331, 7427, 771, 4867, 2819,
+6915, 1795, 5891, 3843, 7939, 131, 4227, 2179, 6275, 1155, 5251, 3203, 7299,
+643, 4739, 2691, 6787, 1667, 5763, 3715, 7811, 387, 4483, 2435, 6531, 1411,
+5507, 3459, 7555, 899, 4995, 2947, 7043, 1923, 6019, 3971, 8067, 67, 4163, 2115,
+6211, 1091, 5187, 3139, 7235, 579, 4675, 2627, 6723, 1603, 5699, 3651, 7747,
+323, 4419, 2371, 6467, 1347, 5443, 3395, 7491, 835, 4931, 2883, 6979, 1859,
+5955, 3907, 8003, 195, 4291, 2243, 6339, 1219, 5315, 3267, 7363, 707, 4803,
+2755, 6851, 1731, 5827, 3779, 7875, 451, 4547, 2499, 6595, 1475, 5571, 3523,
+7619, 963, 5059, 3011, 7107, 1987, 6083, 4035, 8131, 35, 4131, 2083, 6179, 1059,
+5155, 3107, 7203, 547, 4643, 2595, 6691, 1571, 5667, 3619, 7715, 291, 4387,
+2339, 6435, 1315, 5411, 3363, 7459, 803, 4899, 2851, 6947, 1827, 5923, 3875,
+7971, 163, 4259, 2211, 6307, 1187, 5283, 3235, 7331, 675, 4771, 2723, 6819,
+1699, 5795, 3747, 7843, 419, 4515, 2467, 6563, 1443, 5539, 3491, 7587, 931,
+5027, 2979, 7075, 1955, 6051, 4003, 8099, 99, 4195, 2147, 6243, 1123, 5219,
+3171, 7267, 611, 4707, 2659, 6755, 1635, 5731, 3683, 7779, 355, 4451, 2403,
+6499, 1379, 5475, 3427, 7523, 867, 4963, 2915, 7011, 1891, 5987, 3939, 8035,
+227, 4323, 2275, 6371, 1251, 5347, 3299, 7395, 739, 4835, 2787, 6883, 1763,
+5859, 3811, 7907, 483, 4579, 2531, 6627, 1507, 5603, 3555, 7651, 995, 5091,
+3043, 7139, 2019, 6115, 4067, 8163, 19, 4115, 2067, 6163, 1043, 5139, 3091,
+7187, 531, 4627, 2579, 6675, 1555, 5651, 3603, 7699, 275, 4371, 2323, 6419,
+1299, 5395, 3347, 7443, 787, 4883, 2835, 6931, 1811, 5907, 3859, 7955, 147,
+4243, 2195, 6291, 1171, 5267, 3219, 7315, 659, 4755, 2707, 6803, 1683, 5779,
+3731, 7827, 403, 4499, 2451, 6547, 1427, 5523, 3475, 7571, 915, 5011, 2963,
+7059, 1939, 6035, 3987, 8083, 83, 4179, 2131, 6227, 1107, 5203, 3155, 7251, 595,
+4691, 2643, 6739, 1619, 5715, 3667, 7763, 339, 4435, 2387, 6483, 1363, 5459,
+3411, 7507, 851, 4947, 2899, 6995, 1875, 5971, 3923, 8019, 211, 4307, 2259,
+6355, 1235, 5331, 3283, 7379, 723, 4819, 2771, 6867, 1747, 5843, 3795, 7891,
+467, 4563, 2515, 6611, 1491, 5587, 3539, 7635, 979, 5075, 3027, 7123, 2003,
+6099, 4051, 8147, 51, 4147, 2099, 6195, 1075, 5171, 3123, 7219, 563, 4659, 2611,
+6707, 1587, 5683, 3635, 7731, 307, 4403, 2355, 6451, 1331, 5427, 3379, 7475,
+819, 4915, 2867, 6963, 1843, 5939, 3891, 7987, 179, 4275, 2227, 6323, 1203,
+5299, 3251, 7347, 691, 4787, 2739, 6835, 1715, 5811, 3763, 7859, 435, 4531,
+2483, 6579, 1459, 5555, 3507, 7603, 947, 5043, 2995, 7091, 1971, 6067, 4019,
+8115, 115, 4211, 2163, 6259, 1139, 5235, 3187, 7283, 627, 4723, 2675, 6771,
+1651, 5747, 3699, 7795, 371, 4467, 2419, 6515, 1395, 5491, 3443, 7539, 883,
+4979, 2931, 7027, 1907, 6003, 3955, 8051, 243, 4339, 2291, 6387, 1267, 5363,
+3315, 7411, 755, 4851, 2803, 6899, 1779, 5875, 3827, 7923, 499, 4595, 2547,
+6643, 1523, 5619, 3571, 7667, 1011, 5107, 3059, 7155, 2035, 6131, 4083, 8179,
+11, 4107, 2059, 6155, 1035, 5131, 3083, 7179, 523, 4619, 2571, 6667, 1547, 5643,
+3595, 7691, 267, 4363, 2315, 6411, 1291, 5387, 3339, 7435, 779, 4875, 2827,
+6923, 1803, 5899, 3851, 7947, 139, 4235, 2187, 6283, 1163, 5259, 3211, 7307,
+651, 4747, 2699, 6795, 1675, 5771, 3723, 7819, 395, 4491, 2443, 6539, 1419,
+5515, 3467, 7563, 907, 5003, 2955, 7051, 1931, 6027, 3979, 8075, 75, 4171, 2123,
+6219, 1099, 5195, 3147, 7243, 587, 4683, 2635, 6731, 1611, 5707, 3659, 7755,
+331, 4427, 2379, 6475, 1355, 5451, 3403, 7499, 843, 4939, 2891, 6987, 1867,
+5963, 3915, 8011, 203, 4299, 2251, 6347, 1227, 5323, 3275, 7371, 715, 4811,
+2763, 6859, 1739, 5835, 3787, 7883, 459, 4555, 2507, 6603, 1483, 5579, 3531,
+7627, 971, 5067, 3019, 7115, 1995, 6091, 4043, 8139, 43, 4139, 2091, 6187, 1067,
+5163, 3115, 7211, 555, 4651, 2603, 6699, 1579, 5675, 3627, 7723, 299, 4395,
+2347, 6443, 1323, 5419, 3371, 7467, 811, 4907, 2859, 6955, 1835, 5931, 3883,
+7979, 171, 4267, 2219, 6315, 1195, 5291, 3243, 7339, 683, 4779, 2731, 6827,
+1707, 5803, 3755, 7851, 427, 4523, 2475, 6571, 1451, 5547, 3499, 7595, 939,
+5035, 2987, 7083, 1963, 6059, 4011, 8107, 107, 4203, 2155, 6251, 1131, 5227,
+3179, 7275, 619, 4715, 2667, 6763, 1643, 5739, 3691, 7787, 363, 4459, 2411,
+6507, 1387, 5483, 3435, 7531, 875, 4971, 2923, 7019, 1899, 5995, 3947, 8043,
+235, 4331, 2283, 6379, 1259, 5355, 3307, 7403, 747, 4843, 2795, 6891, 1771,
+5867, 3819, 7915, 491, 4587, 2539, 6635, 1515, 5611, 3563, 7659, 1003, 5099,
+3051, 7147, 2027, 6123, 4075, 8171, 27, 4123, 2075, 6171, 1051, 5147, 3099,
+7195, 539, 4635, 2587, 6683, 1563, 5659, 3611, 7707, 283, 4379, 2331, 6427,
+1307, 5403, 3355, 7451, 795, 4891, 2843, 6939, 1819, 5915, 3867, 7963, 155,
+4251, 2203, 6299, 1179, 5275, 3227, 7323, 667, 4763, 2715, 6811, 1691, 5787,
+3739, 7835, 411, 4507, 2459, 6555, 1435, 5531, 3483, 7579, 923, 5019, 2971,
+7067, 1947, 6043, 3995, 8091, 91, 4187, 2139, 6235, 1115, 5211, 3163, 7259, 603,
+4699, 2651, 6747, 1627, 5723, 3675, 7771, 347, 4443, 2395, 6491, 1371, 5467,
+3419, 7515, 859, 4955, 2907, 7003, 1883, 5979, 3931, 8027, 219, 4315, 2267,
+6363, 1243, 5339, 3291, 7387, 731, 4827, 2779, 6875, 1755, 5851, 3803, 7899,
+475, 4571, 2523, 6619, 1499, 5595, 3547, 7643, 987, 5083, 3035, 7131, 2011,
+6107, 4059, 8155, 59, 4155, 2107, 6203, 1083, 5179, 3131, 7227, 571, 4667, 2619,
+6715, 1595, 5691, 3643, 7739, 315, 4411, 2363, 6459, 1339, 5435, 3387, 7483,
+827, 4923, 2875, 6971, 1851, 5947, 3899, 7995, 187, 4283, 2235, 6331, 1211,
+5307, 3259, 7355, 699, 4795, 2747, 6843, 1723, 5819, 3771, 7867, 443, 4539,
+2491, 6587, 1467, 5563, 3515, 7611, 955, 5051, 3003, 7099, 1979, 6075, 4027,
+8123, 123, 4219, 2171, 6267, 1147, 5243, 3195, 7291, 635, 4731, 2683, 6779,
+1659, 5755, 3707, 7803, 379, 4475, 2427, 6523, 1403, 5499, 3451, 7547, 891,
+4987, 2939, 7035, 1915, 6011, 3963, 8059, 251, 4347, 2299, 6395, 1275, 5371,
+3323, 7419, 763, 4859, 2811, 6907, 1787, 5883, 3835, 7931, 507, 4603, 2555,
+6651, 1531, 5627, 3579, 7675, 1019, 5115, 3067, 7163, 2043, 6139, 4091, 8187, 7,
+4103, 2055, 6151, 1031, 5127, 3079, 7175, 519, 4615, 2567, 6663, 1543, 5639,
+3591, 7687, 263, 4359, 2311, 6407, 1287, 5383, 3335, 7431, 775, 4871, 2823,
+6919, 1799, 5895, 3847, 7943, 135, 4231, 2183, 6279, 1159, 5255, 3207, 7303,
+647, 4743, 2695, 6791, 1671, 5767, 3719, 7815, 391, 4487, 2439, 6535, 1415,
+5511, 3463, 7559, 903, 4999, 2951, 7047, 1927, 6023, 3975, 8071, 71, 4167, 2119,
+6215, 1095, 5191, 3143, 7239, 583, 4679, 2631, 6727, 1607, 5703, 3655, 7751,
+327, 4423, 2375, 6471, 1351, 5447, 3399, 7495, 839, 4935, 2887, 6983, 1863,
+5959, 3911, 8007, 199, 4295, 2247, 6343, 1223, 5319, 3271, 7367, 711, 4807,
+2759, 6855, 1735, 5831, 3783, 7879, 455, 4551, 2503, 6599, 1479, 5575, 3527,
+7623, 967, 5063, 3015, 7111, 1991, 6087, 4039, 8135, 39, 4135, 2087, 6183, 1063,
+5159, 3111, 7207, 551, 4647, 2599, 6695, 1575, 5671, 3623, 7719, 295, 4391,
+2343, 6439, 1319, 5415, 3367, 7463, 807, 4903, 2855, 6951, 1831, 5927, 3879,
+7975, 167, 4263, 2215, 6311, 1191, 5287, 3239, 7335, 679, 4775, 2727, 6823,
+1703, 5799, 3751, 7847, 423, 4519, 2471, 6567, 1447, 5543, 3495, 7591, 935,
+5031, 2983, 7079, 1959, 6055, 4007, 8103, 103, 4199, 2151, 6247, 1127, 5223,
+3175, 7271, 615, 4711, 2663, 6759, 1639, 5735, 3687, 7783, 359, 4455, 2407,
+6503, 1383, 5479, 3431, 7527, 871, 4967, 2919, 7015, 1895, 5991, 3943, 8039,
+231, 4327, 2279, 6375, 1255, 5351, 3303, 7399, 743, 4839, 2791, 6887, 1767,
+5863, 3815, 7911, 487, 4583, 2535, 6631, 1511, 5607, 3559, 7655, 999, 5095,
+3047, 7143, 2023, 6119, 4071, 8167, 23, 4119, 2071, 6167, 1047, 5143, 3095,
+7191, 535, 4631, 2583, 6679, 1559, 5655, 3607, 7703, 279, 4375, 2327, 6423,
+1303, 5399, 3351, 7447, 791, 4887, 2839, 6935, 1815, 5911, 3863, 7959, 151,
+4247, 2199, 6295, 1175, 5271, 3223, 7319, 663, 4759, 2711, 6807, 1687, 5783,
+3735, 7831, 407, 4503, 2455, 6551, 1431, 5527, 3479, 7575, 919, 5015, 2967,
+7063, 1943, 6039, 3991, 8087, 87, 4183, 2135, 6231, 1111, 5207, 3159, 7255, 599,
+4695, 2647, 6743, 1623, 5719, 3671, 7767, 343, 4439, 2391, 6487, 1367, 5463,
+3415, 7511, 855, 4951, 2903, 6999, 1879, 5975, 3927, 8023, 215, 4311, 2263,
+6359, 1239, 5335, 3287, 7383, 727, 4823, 2775, 6871, 1751, 5847, 3799, 7895,
+471, 4567, 2519, 6615, 1495, 5591, 3543, 7639, 983, 5079, 3031, 7127, 2007,
+6103, 4055, 8151, 55, 4151, 2103, 6199, 1079, 5175, 3127, 7223, 567, 4663, 2615,
+6711, 1591, 5687, 3639, 7735, 311, 4407, 2359, 6455, 1335, 5431, 3383, 7479,
+823, 4919, 2871, 6967, 1847, 5943, 3895, 7991, 183, 4279, 2231, 6327, 1207,
+5303, 3255, 7351, 695, 4791, 2743, 6839, 1719, 5815, 3767, 7863, 439, 4535,
+2487, 6583, 1463, 5559, 3511, 7607, 951, 5047, 2999, 7095, 1975, 6071, 4023,
+8119, 119, 4215, 2167, 6263, 1143, 5239, 3191, 7287, 631, 4727, 2679, 6775,
+1655, 5751, 3703, 7799, 375, 4471, 2423, 6519, 1399, 5495, 3447, 7543, 887,
+4983, 2935, 7031, 1911, 6007, 3959, 8055, 247, 4343, 2295, 6391, 1271, 5367,
+3319, 7415, 759, 4855, 2807, 6903, 1783, 5879, 3831, 7927, 503, 4599, 2551,
+6647, 1527, 5623, 3575, 7671, 1015, 5111, 3063, 7159, 2039, 6135, 4087, 8183,
+15, 4111, 2063, 6159, 1039, 5135, 3087, 7183, 527, 4623, 2575, 6671, 1551, 5647,
+3599, 7695, 271, 4367, 2319, 6415, 1295, 5391, 3343, 7439, 783, 4879, 2831,
+6927, 1807, 5903, 3855, 7951, 143, 4239, 2191, 6287, 1167, 5263, 3215, 7311,
+655, 4751, 2703, 6799, 1679, 5775, 3727, 7823, 399, 4495, 2447, 6543, 1423,
+5519, 3471, 7567, 911, 5007, 2959, 7055, 1935, 6031, 3983, 8079, 79, 4175, 2127,
+6223, 1103, 5199, 3151, 7247, 591, 4687, 2639, 6735, 1615, 5711, 3663, 7759,
+335, 4431, 2383, 6479, 1359, 5455, 3407, 7503, 847, 4943, 2895, 6991, 1871,
+5967, 3919, 8015, 207, 4303, 2255, 6351, 1231, 5327, 3279, 7375, 719, 4815,
+2767, 6863, 1743, 5839, 3791, 7887, 463, 4559, 2511, 6607, 1487, 5583, 3535,
+7631, 975, 5071, 3023, 7119, 1999, 6095, 4047, 8143, 47, 4143, 2095, 6191, 1071,
+5167, 3119, 7215, 559, 4655, 2607, 6703, 1583, 5679, 3631, 7727, 303, 4399,
+2351, 6447, 1327, 5423, 3375, 7471, 815, 4911, 2863, 6959, 1839, 5935, 3887,
+7983, 175, 4271, 2223, 6319, 1199, 5295, 3247, 7343, 687, 4783, 2735, 6831,
+1711, 5807, 3759, 7855, 431, 4527, 2479, 6575, 1455, 5551, 3503, 7599, 943,
+5039, 2991, 7087, 1967, 6063, 4015, 8111, 111, 4207, 2159, 6255, 1135, 5231,
+3183, 7279, 623, 4719, 2671, 6767, 1647, 5743, 3695, 7791, 367, 4463, 2415,
+6511, 1391, 5487, 3439, 7535, 879, 4975, 2927, 7023, 1903, 5999, 3951, 8047,
+239, 4335, 2287, 6383, 1263, 5359, 3311, 7407, 751, 4847, 2799, 6895, 1775,
+5871, 3823, 7919, 495, 4591, 2543, 6639, 1519, 5615, 3567, 7663, 1007, 5103,
+3055, 7151, 2031, 6127, 4079, 8175, 31, 4127, 2079, 6175, 1055, 5151, 3103,
+7199, 543, 4639, 2591, 6687, 1567, 5663, 3615, 7711, 287, 4383, 2335, 6431,
+1311, 5407, 3359, 7455, 799, 4895, 2847, 6943, 1823, 5919, 3871, 7967, 159,
+4255, 2207, 6303, 1183, 5279, 3231, 7327, 671, 4767, 2719, 6815, 1695, 5791,
+3743, 7839, 415, 4511, 2463, 6559, 1439, 5535, 3487, 7583, 927, 5023, 2975,
+7071, 1951, 6047, 3999, 8095, 95, 4191, 2143, 6239, 1119, 5215, 3167, 7263, 607,
+4703, 2655, 6751, 1631, 5727, 3679, 7775, 351, 4447, 2399, 6495, 1375, 5471,
+3423, 7519, 863, 4959, 2911, 7007, 1887, 5983, 3935, 8031, 223, 4319, 2271,
+6367, 1247, 5343, 3295, 7391, 735, 4831, 2783, 6879, 1759, 5855, 3807, 7903,
+479, 4575, 2527, 6623, 1503, 5599, 3551, 7647, 991, 5087, 3039, 7135, 2015,
+6111, 4063, 8159, 63, 4159, 2111, 6207, 1087, 5183, 3135, 7231, 575, 4671, 2623,
+6719, 1599, 5695, 3647, 7743, 319, 4415, 2367, 6463, 1343, 5439, 3391, 7487,
+831, 4927, 2879, 6975, 1855, 5951, 3903, 7999, 191, 4287, 2239, 6335, 1215,
+5311, 3263, 7359, 703, 4799, 2751, 6847, 1727, 5823, 3775, 7871, 447, 4543,
+2495, 6591, 1471, 5567, 3519, 7615, 959, 5055, 3007, 7103, 1983, 6079, 4031,
+8127, 127, 4223, 2175, 6271, 1151, 5247, 3199, 7295, 639, 4735, 2687, 6783,
+1663, 5759, 3711, 7807, 383, 4479, 2431, 6527, 1407, 5503, 3455, 7551, 895,
+4991, 2943, 7039, 1919, 6015, 3967, 8063, 255, 4351, 2303, 6399, 1279, 5375,
+3327, 7423, 767, 4863, 2815, 6911, 1791, 5887, 3839, 7935, 511, 4607, 2559,
+6655, 1535, 5631, 3583, 7679, 1023, 5119, 3071, 7167, 2047, 6143, 4095, 8191
+};
+
+const plp_fft_instance_f32 plp_rfft_sR_f32_len8192 = { 8192, 1, (float32_t *)twiddleCoef_rfft_8192,
+                                                       (uint16_t *)bit_rev_radix2_LUT_8192 };
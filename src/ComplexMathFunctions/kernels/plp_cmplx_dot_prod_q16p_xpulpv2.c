@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_q16p_xpulpv2.c
+ * Description:  Parallel q16 complex dot product for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod
+  @{
+ */
+
+/**
+  @brief Parallel complex dot product of 16-bit fixed-point vectors for XPULPV2 extension.
+  Each core computes the dot product of a contiguous chunk of the samples with
+  plp_cmplx_dot_prod_q16_xpulpv2, then the partial results are summed in a tree.
+  @param[in]  args  points to the plp_cmplx_instance_i16 structure
+  @return     none
+ */
+
+void plp_cmplx_dot_prod_q16p_xpulpv2(void *args) {
+
+    plp_cmplx_instance_i16 *a = (plp_cmplx_instance_i16 *)args;
+
+    uint32_t numSamples = a->numSamples;
+    uint32_t nPE = a->nPE;
+    uint32_t core = hal_core_id();
+    uint32_t chunk = (numSamples + nPE - 1) / nPE;
+    uint32_t start = core * chunk;
+    uint32_t end = (start + chunk < numSamples) ? start + chunk : numSamples;
+    int16_t *pPartial = a->pDst;
+    uint32_t stride;
+
+    pPartial[2 * core] = 0;
+    pPartial[2 * core + 1] = 0;
+
+    if (start < end) {
+        plp_cmplx_dot_prod_q16_xpulpv2(a->pSrcA + 2 * start, a->pSrcB + 2 * start, end - start,
+                                       a->deciPoint, &pPartial[2 * core], &pPartial[2 * core + 1]);
+    }
+
+    /* pPartial[0] and pPartial[1] hold the result after the last step */
+    for (stride = 1; stride < nPE; stride <<= 1) {
+        hal_team_barrier();
+
+        if ((core & ((stride << 1) - 1)) == 0 && core + stride < nPE) {
+            pPartial[2 * core] += pPartial[2 * (core + stride)];
+            pPartial[2 * core + 1] += pPartial[2 * (core + stride) + 1];
+        }
+    }
+}
+
+/**
+  @} end of cmplx_dot_prod group
+ */
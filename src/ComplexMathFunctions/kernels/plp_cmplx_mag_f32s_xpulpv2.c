@@ -36,6 +36,29 @@
 
 #include "plp_math.h"
 
+/* fast inverse square root with two newton iterations, same arithmetic as plp_sqrt_f32 */
+static inline float32_t sqrt_newton_f32(float32_t in) {
+
+    const float32_t threehalfs = 1.5f;
+    float32_t x2, y;
+    union {
+        float32_t f;
+        int32_t i;
+    } conv;
+
+    if (in <= 0.f) {
+        return 0.f;
+    }
+
+    x2 = in * 0.5f;
+    conv.f = in;
+    conv.i = 0x5f3759df - (conv.i >> 1);
+    y = conv.f;
+    y = y * (threehalfs - (x2 * y * y));
+    y = y * (threehalfs - (x2 * y * y));
+
+    return in * y;
+}
 
 /**
   @ingroup groupCmplxMath
@@ -74,18 +97,28 @@
  * @param[in]  pSrc        pointer to source
  * @param      pRes        pointer to result
  * @param[in]  numSamples  The number samples
+ *
+ * @par
+ * The square root is inlined, with the same arithmetic as plp_sqrt_f32.
  */
 
 void plp_cmplx_mag_f32s_xpulpv2(const float32_t *pSrc,
                                 float32_t *pRes,
                                 uint32_t numSamples){
-    float32_t real, cmplx, sqr;
-    for (int i = 0; i < numSamples; i++) {
 
-        real = *pSrc++;
-        cmplx = *pSrc++;
-        sqr = (real*real) + (cmplx*cmplx);
-        plp_sqrt_f32(&sqr, &pRes[i]);
+    uint32_t blkCnt;
+
+    for (blkCnt = 0; blkCnt < (numSamples >> 1); blkCnt++) {
+        float32_t m0 = sqrt_newton_f32(pSrc[0] * pSrc[0] + pSrc[1] * pSrc[1]);
+        float32_t m1 = sqrt_newton_f32(pSrc[2] * pSrc[2] + pSrc[3] * pSrc[3]);
+        pRes[0] = m0;
+        pRes[1] = m1;
+        pSrc += 4;
+        pRes += 2;
+    }
+
+    if (numSamples & 1) {
+        *pRes = sqrt_newton_f32(pSrc[0] * pSrc[0] + pSrc[1] * pSrc[1]);
     }
 }
 
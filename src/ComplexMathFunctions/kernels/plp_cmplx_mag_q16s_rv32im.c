@@ -35,7 +35,7 @@
 
 
 #include "plp_math.h"
-
+#include "plp_isqrt.h"
 
 /**
   @ingroup groupCmplxMath
@@ -72,21 +72,29 @@
  * @brief      complex magnitude for q16 on RV32IM
  *
  * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param[in]  fracBits    fractional bits -> Q(16-fracBits).fracBits
  * @param      pRes        pointer to result
  * @param[in]  numSamples  The number of samples
+ *
+ * @par
+ * Computes floor(sqrt(re^2 + im^2)), saturated to 0x7FFF. The magnitude has the same
+ * fractional bits as the input, so the result does not depend on fracBits.
  */
+
 void plp_cmplx_mag_q16s_rv32im(const int16_t *pSrc,
                                const uint32_t fracBits,
                                int16_t *pRes,
                                uint32_t numSamples){
-    int16_t real, cmplx, sqr;
-    for (int i = 0; i < numSamples; i++) {
 
-        real = (pSrc[2 * i] * pSrc[2 * i]) >> fracBits;
-        cmplx = (pSrc[2 * i + 1] * pSrc[2 * i + 1]) >> fracBits;
-        sqr = real + cmplx;
-        plp_sqrt_q16(&sqr, fracBits, &pRes[i]);
+    uint32_t blkCnt, sq, m;
+    int32_t re, im;
+
+    for (blkCnt = 0; blkCnt < numSamples; blkCnt++) {
+        re = pSrc[2 * blkCnt];
+        im = pSrc[2 * blkCnt + 1];
+        sq = (uint32_t)(re * re) + (uint32_t)(im * im);
+        m = sq ? plp_isqrt32(sq) : 0;
+        pRes[blkCnt] = (m > 0x7FFF) ? 0x7FFF : m;
     }
 }
 
@@ -35,7 +35,7 @@
 
 
 #include "plp_math.h"
-
+#include "plp_isqrt.h"
 
 /**
   @ingroup groupCmplxMath
@@ -71,23 +71,44 @@
 /**
  * @brief      complex magnitude for q16 on XPULPV2
  *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param[in]  pSrc        pointer to source, 4-byte aligned
+ * @param[in]  fracBits    fractional bits -> Q(16-fracBits).fracBits
  * @param      pRes        pointer to result
  * @param[in]  numSamples  The number of samples
+ *
+ * @par
+ * Computes floor(sqrt(re^2 + im^2)), saturated to 0x7FFF. The magnitude has the same
+ * fractional bits as the input, so the result does not depend on fracBits.
+ * The sum of squares of each packed (re, im) pair is a single dot product, and the square root
+ * is inlined.
  */
+
 void plp_cmplx_mag_q16s_xpulpv2(const int16_t *pSrc,
                                 const uint32_t fracBits,
                                 int16_t *pRes,
                                 uint32_t numSamples){
 
-    int16_t real, cmplx, sqr;
-    for (int i = 0; i < numSamples; i++) {
+    const v2s *pIn = (const v2s *)pSrc;
+    uint32_t blkCnt, sq0, sq1, m0, m1;
+
+    for (blkCnt = 0; blkCnt < (numSamples >> 1); blkCnt++) {
+        v2s a = pIn[0];
+        v2s b = pIn[1];
+        sq0 = (uint32_t)__DOTP2(a, a);
+        sq1 = (uint32_t)__DOTP2(b, b);
+        m0 = sq0 ? plp_isqrt32(sq0) : 0;
+        m1 = sq1 ? plp_isqrt32(sq1) : 0;
+        pRes[0] = (m0 > 0x7FFF) ? 0x7FFF : m0;
+        pRes[1] = (m1 > 0x7FFF) ? 0x7FFF : m1;
+        pIn += 2;
+        pRes += 2;
+    }
 
-        real = (pSrc[2 * i] * pSrc[2 * i]) >> fracBits;
-        cmplx = (pSrc[2 * i + 1] * pSrc[2 * i + 1]) >> fracBits;
-        sqr = real + cmplx;
-        plp_sqrt_q16(&sqr, fracBits, &pRes[i]);
+    if (numSamples & 1) {
+        v2s a = *pIn;
+        sq0 = (uint32_t)__DOTP2(a, a);
+        m0 = sq0 ? plp_isqrt32(sq0) : 0;
+        *pRes = (m0 > 0x7FFF) ? 0x7FFF : m0;
     }
 }
 
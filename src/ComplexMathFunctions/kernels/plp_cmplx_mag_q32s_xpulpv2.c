@@ -35,7 +35,7 @@
 
 
 #include "plp_math.h"
-
+#include "plp_isqrt.h"
 
 /**
   @ingroup groupCmplxMath
@@ -71,10 +71,15 @@
 /**
  * @brief      complex magnitude for q32 on XPULPV2
  *
- * @param[in]  pSrc        pointer to source
+ * @param[in]  pSrc        pointer to source, 4-byte aligned
  * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
  * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
+ * @param[in]  numSamples  The number of samples
+ *
+ * @par
+ * Computes floor(sqrt(re^2 + im^2)), saturated to 0x7FFFFFFF. The magnitude has the same
+ * fractional bits as the input, so the result does not depend on fracBits.
+ * The square root is inlined.
  */
 
 void plp_cmplx_mag_q32s_xpulpv2(const int32_t *pSrc,
@@ -82,13 +87,16 @@ void plp_cmplx_mag_q32s_xpulpv2(const int32_t *pSrc,
                                 int32_t *pRes,
                                 uint32_t numSamples){
 
-    int32_t real, cmplx, sqr;
-    for (int i = 0; i < numSamples; i++) {
+    uint32_t blkCnt, m;
+    int64_t re, im;
+    uint64_t sq;
 
-        real = (pSrc[2 * i] * pSrc[2 * i]) >> fracBits;
-        cmplx = (pSrc[2 * i + 1] * pSrc[2 * i + 1]) >> fracBits;
-        sqr = real + cmplx;
-        plp_sqrt_q32(&sqr, fracBits, &pRes[i]);
+    for (blkCnt = 0; blkCnt < numSamples; blkCnt++) {
+        re = pSrc[2 * blkCnt];
+        im = pSrc[2 * blkCnt + 1];
+        sq = (uint64_t)(re * re) + (uint64_t)(im * im);
+        m = sq ? plp_isqrt64(sq) : 0;
+        pRes[blkCnt] = (m > 0x7FFFFFFF) ? 0x7FFFFFFF : m;
     }
 }
 
@@ -35,7 +35,7 @@
 
 
 #include "plp_math.h"
-
+#include "plp_isqrt.h"
 
 /**
   @ingroup groupCmplxMath
@@ -74,14 +74,28 @@
  * @param[in]  pSrc        pointer to source
  * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
  * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
+ * @param[in]  numSamples  The number of samples
+ *
+ * @par
+ * Computes floor(sqrt(re^2 + im^2)), saturated to 0x7F. The magnitude has the same
+ * fractional bits as the input, so the result does not depend on fracBits.
  */
 
 void plp_cmplx_mag_q8s_rv32im(const int8_t *pSrc,
                                const uint32_t fracBits,
                                int8_t *pRes,
                                uint32_t numSamples){
-    printf("Error: plp_sqrt_q8 not implemented yet!\n");
+
+    uint32_t blkCnt, sq, m;
+    int32_t re, im;
+
+    for (blkCnt = 0; blkCnt < numSamples; blkCnt++) {
+        re = pSrc[2 * blkCnt];
+        im = pSrc[2 * blkCnt + 1];
+        sq = (uint32_t)(re * re) + (uint32_t)(im * im);
+        m = sq ? plp_isqrt32(sq) : 0;
+        pRes[blkCnt] = (m > 0x7F) ? 0x7F : m;
+    }
 }
 
 /**
@@ -35,7 +35,7 @@
 
 
 #include "plp_math.h"
-
+#include "plp_isqrt.h"
 
 /**
   @ingroup groupCmplxMath
@@ -71,17 +71,46 @@
 /**
  * @brief      complex magnitude for q8 on XPULPV2
  *
- * @param[in]  pSrc        pointer to source
+ * @param[in]  pSrc        pointer to source, 4-byte aligned
  * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
  * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
+ * @param[in]  numSamples  The number of samples
+ *
+ * @par
+ * Computes floor(sqrt(re^2 + im^2)), saturated to 0x7F. The magnitude has the same
+ * fractional bits as the input, so the result does not depend on fracBits.
+ * Two samples are loaded at once, the sum of squares of the first one is a dot product of the
+ * masked vector, the one of the second one the dot product of the whole vector minus the first.
+ * The square root is inlined.
  */
 
 void plp_cmplx_mag_q8s_xpulpv2(const int8_t *pSrc,
                                 const uint32_t fracBits,
                                 int8_t *pRes,
                                 uint32_t numSamples){
-    printf("Error: plp_sqrt_q8 not implemented yet!\n");
+
+    const v4s *pIn = (const v4s *)pSrc;
+    const v4s mask = (v4s){ -1, -1, 0, 0 };
+    uint32_t blkCnt, sq0, sq1, m0, m1;
+
+    for (blkCnt = 0; blkCnt < (numSamples >> 1); blkCnt++) {
+        v4s a = *pIn++;
+        v4s a0 = __AND4(a, mask);
+        sq0 = __DOTP4(a0, a0);
+        sq1 = __DOTP4(a, a) - sq0;
+        m0 = sq0 ? plp_isqrt32(sq0) : 0;
+        m1 = sq1 ? plp_isqrt32(sq1) : 0;
+        pRes[0] = (m0 > 0x7F) ? 0x7F : m0;
+        pRes[1] = (m1 > 0x7F) ? 0x7F : m1;
+        pRes += 2;
+    }
+
+    if (numSamples & 1) {
+        const int8_t *pTail = (const int8_t *)pIn;
+        sq0 = pTail[0] * pTail[0] + pTail[1] * pTail[1];
+        m0 = sq0 ? plp_isqrt32(sq0) : 0;
+        *pRes = (m0 > 0x7F) ? 0x7F : m0;
+    }
 }
 
 /**
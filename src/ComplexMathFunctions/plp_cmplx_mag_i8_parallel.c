@@ -0,0 +1,59 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_i8_parallel.c
+ * Description:  Parallel i8 complex magnitude glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup cmplx_mag
+ */
+
+/**
+  @addtogroup cmplx_mag
+  @{
+ */
+
+/**
+ * @brief      Glue code for parallel complex magnitude calculation in 8-bit integer
+ *
+ * @param[in]  pSrc        pointer to source, 4-byte aligned
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ * @param[in]  nPE         number of parallel processing units
+ */
+
+void plp_cmplx_mag_i8_parallel(const int8_t *pSrc,
+                               int8_t *pRes,
+                               uint32_t numSamples,
+                               uint32_t nPE) {
+
+    plp_cmplx_mag_q8_parallel(pSrc, 0, pRes, numSamples, nPE);
+}
+
+/**
+  @} end of cmplx_mag
+ */
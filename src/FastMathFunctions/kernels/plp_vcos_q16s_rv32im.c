@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vcos_q16s_rv32im.c
+ * Description:  Element-wise cosine of a 16-bit fixed point vector for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Notice: project inspired by ARM CMSIS DSP and parts of source code
+ * ported and adopted for RISC-V PULP platform from ARM CMSIS DSP
+ * released under Copyright (C) 2010-2019 ARM Limited or its affiliates
+ * with Apache-2.0.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/* linear interpolation of sinTable_q16, same arithmetic as plp_sin_q16 */
+static inline int16_t sin_interp_q16(int32_t index, int32_t fract) {
+
+    int16_t sinVal;
+    int16_t a = sinTable_q16[index];
+    int16_t b = sinTable_q16[index + 1];
+
+    sinVal = (int32_t)(0x8000 - fract) * a >> 16;
+    sinVal = (int16_t)((((int32_t)sinVal << 16) + ((int32_t)fract * b)) >> 16);
+
+    return (sinVal << 1);
+}
+
+/**
+  @brief Element-wise cosine of a 16-bit fixed point vector for RV32IM extension.
+  Same result as plp_cos_q16 applied to every sample.
+  @param[in]  pSrc       points to the input vector, Q1.15 values in [-1, 1)
+                         mapped to [-2*PI, 2*PI)
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector
+  @return     none
+ */
+
+void plp_vcos_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+    int16_t x;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = (int16_t)((uint16_t)pSrc[blkCnt] + 0x2000) & 0x7FFF;
+        pDst[blkCnt] = sin_interp_q16(x >> FAST_MATH_Q16_SHIFT,
+                                      (x & ((1 << FAST_MATH_Q16_SHIFT) - 1)) << 9);
+    }
+}
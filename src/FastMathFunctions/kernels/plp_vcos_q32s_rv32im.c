@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vcos_q32s_rv32im.c
+ * Description:  Element-wise cosine of a 32-bit fixed point vector for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Notice: project inspired by ARM CMSIS DSP and parts of source code
+ * ported and adopted for RISC-V PULP platform from ARM CMSIS DSP
+ * released under Copyright (C) 2010-2019 ARM Limited or its affiliates
+ * with Apache-2.0.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/* linear interpolation of sinTable_q32, same arithmetic as plp_sin_q32 */
+static inline int32_t sin_interp_q32(int32_t index, int32_t fract) {
+
+    int32_t sinVal;
+    int32_t a = sinTable_q32[index];
+    int32_t b = sinTable_q32[index + 1];
+
+    sinVal = (int64_t)(0x80000000 - fract) * a >> 32;
+    sinVal = (int32_t)((((int64_t)sinVal << 32) + ((int64_t)fract * b)) >> 32);
+
+    return (sinVal << 1);
+}
+
+/**
+  @brief Element-wise cosine of a 32-bit fixed point vector for RV32IM extension.
+  Same result as plp_cos_q32 applied to every sample.
+  @param[in]  pSrc       points to the input vector, Q1.31 values in [-1, 1)
+                         mapped to [-2*PI, 2*PI)
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector
+  @return     none
+ */
+
+void plp_vcos_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+    int32_t x;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = (int32_t)((uint32_t)pSrc[blkCnt] + 0x20000000) & 0x7FFFFFFF;
+        pDst[blkCnt] = sin_interp_q32((uint32_t)x >> FAST_MATH_Q32_SHIFT,
+                                      (x & ((1 << FAST_MATH_Q32_SHIFT) - 1)) << 9);
+    }
+}
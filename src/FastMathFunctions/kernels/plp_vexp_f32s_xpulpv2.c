@@ -0,0 +1,120 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vexp_f32s_xpulpv2.c
+ * Description:  Element-wise exponential of a 32-bit floating point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/*
+ * exp(x) = 2^n * exp(r) with n = round(x / ln(2)) and r = x - n * ln(2) in [-ln(2)/2, ln(2)/2],
+ * ln(2) split into 0.693359375 (exact) and -2.12194440e-4. exp(r) is approximated by the minimax
+ * polynomial of the Cephes expf and 2^n is built in the exponent field.
+ */
+static inline float32_t vexp_f32(float32_t x) {
+
+    union {
+        float32_t f;
+        int32_t i;
+    } conv;
+    float32_t t, y, z;
+    int32_t n;
+
+    if (x > 88.72283905f) {
+        return INFINITY;
+    }
+    if (!(x >= -87.33654475f)) {
+        return (x < 0.0f) ? 0.0f : x;
+    }
+
+    t = x * 1.44269504088896341f;
+    n = (int32_t)(t + ((t >= 0.0f) ? 0.5f : -0.5f));
+    x = x - (float32_t)n * 0.693359375f;
+    x = x - (float32_t)n * -2.12194440e-4f;
+
+    z = x * x;
+    y = 1.9875691500E-4f;
+    y = y * x + 1.3981999507E-3f;
+    y = y * x + 8.3334519073E-3f;
+    y = y * x + 4.1665795894E-2f;
+    y = y * x + 1.6666665459E-1f;
+    y = y * x + 5.0000001201E-1f;
+    y = y * z + x + 1.0f;
+
+    // 2^128 is not representable, only reached just below ln(FLT_MAX)
+    if (n > 127) {
+        y *= 2.0f;
+        n--;
+    }
+    conv.i = (n + 127) << 23;
+    return y * conv.f;
+}
+
+/**
+   @ingroup vexp
+*/
+
+/**
+   @defgroup vexpKernels Vector Exponential Kernels
+*/
+
+/**
+   @addtogroup vexpKernels
+   @{
+*/
+
+/**
+  @brief Element-wise exponential of a 32-bit floating point vector for XPULPV2 extension.
+  Exponential of every sample. Inputs above ln(FLT_MAX) give +INFINITY, inputs below ln(FLT_MIN)
+  give 0, NaN gives NaN. The relative error is below 2^-22.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector, can be equal to pSrc
+  @return     none
+ */
+
+void plp_vexp_f32s_xpulpv2(const float32_t *pSrc,
+                           uint32_t blockSize,
+                           float32_t *pDst) {
+
+    uint32_t blkCnt;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        float32_t y0 = vexp_f32(pSrc[0]);
+        float32_t y1 = vexp_f32(pSrc[1]);
+        pDst[0] = y0;
+        pDst[1] = y1;
+        pSrc += 2;
+        pDst += 2;
+    }
+
+    if (blockSize & 1) {
+        *pDst = vexp_f32(*pSrc);
+    }
+}
+
+/**
+  @} end of vexpKernels group
+ */
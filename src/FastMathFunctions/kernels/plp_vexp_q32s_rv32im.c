@@ -0,0 +1,107 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vexp_q32s_rv32im.c
+ * Description:  Element-wise exponential of a 32-bit fixed point vector for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_common_tables.h"
+
+#define EXP_K_Q24 1549082005LL
+#define EXP_C_Q56 780414346020670LL
+
+/*
+ * exp(x * 2^-fracBits) * 2^fracBits, rounded and saturated to maxVal. With
+ * k = floor(x * 64 / ln2), exp(x) = 2^(k / 64) * exp(g), where the remainder
+ * g = x - k * ln2 / 64 in [0, ln2 / 64) is computed with 56 fractional bits.
+ * 2^((k mod 64) / 64) - 1 is read from expTable_q32 and exp(g) - 1 is approximated by its series
+ * up to the g^4 term, both with 32 fractional bits. Outside of [-64, 32), the result is 0 or
+ * saturated anyway.
+ */
+static inline uint32_t exp_fixed(int32_t x, uint32_t fracBits, uint32_t maxVal) {
+
+    if ((x >> fracBits) >= 32) {
+        return maxVal;
+    }
+    if ((x >> fracBits) < -64) {
+        return 0;
+    }
+
+    int64_t k = ((int64_t)x * EXP_K_Q24) >> (24 + fracBits);
+    int64_t g = (int64_t)x * (1LL << (56 - fracBits)) - k * EXP_C_Q56;
+    int64_t g32 = (g + (1LL << 23)) >> 24;
+    int64_t g2 = (g32 * g32 + (1LL << 31)) >> 32;
+    int64_t g3 = (g2 * g32 + (1LL << 31)) >> 32;
+    int64_t g4 = (g3 * g32 + (1LL << 31)) >> 32;
+    int64_t pe = g32 + ((g2 + 1) >> 1) + (g3 + 3) / 6 + (g4 + 12) / 24;
+    int64_t b = 0x100000000LL + expTable_q32[k & (FAST_MATH_LOG_TABLE_SIZE - 1)];
+    uint64_t mant = (uint64_t)(b + ((b * pe + (1LL << 31)) >> 32));
+    int32_t s = (int32_t)(k >> 6) + (int32_t)fracBits - 32;
+
+    if (s >= 0) {
+        return (s > 0 || mant > maxVal) ? maxVal : (uint32_t)mant;
+    }
+    if (s < -63) {
+        return 0;
+    }
+    mant = (mant + (1ULL << (-s - 1))) >> -s;
+    return (mant > maxVal) ? maxVal : (uint32_t)mant;
+}
+
+/**
+   @ingroup vexp
+*/
+
+/**
+   @addtogroup vexpKernels
+   @{
+*/
+
+/**
+  @brief Element-wise exponential of a 32-bit fixed point vector for RV32IM extension.
+  Computes exp(pSrc[n] * 2^-fracBits) * 2^fracBits, rounded and saturated to 0x7FFFFFFF, i.e. the
+  exponential with the same number of fractional bits. The error is at most 1 LSB.
+  @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  fracBits   number of fractional bits of input and output
+  @param[out] pDst       points to the output vector, can be equal to pSrc
+  @return     none
+ */
+
+void plp_vexp_q32s_rv32im(const int32_t *pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *pDst) {
+
+    uint32_t blkCnt;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = (int32_t)exp_fixed(pSrc[blkCnt], fracBits, 0x7FFFFFFF);
+    }
+}
+
+/**
+  @} end of vexpKernels group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vlog2_f32s_xpulpv2.c
+ * Description:  Element-wise base-2 logarithm of a 32-bit floating point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_log_reduce.h"
+
+/* base-2 logarithm, e + (m + y) * log2(e) with log2(e) = 1 + 0.44269504 */
+static inline float32_t vlog2_f32(float32_t x) {
+
+    int32_t e;
+    float32_t m, y, z;
+
+    if (!(x > 0.0f)) {
+        return (x == 0.0f) ? -INFINITY : NAN;
+    }
+    if (x == INFINITY) {
+        return x;
+    }
+
+    y = plp_log_reduce_f32(x, &e, &m);
+    z = y * 0.44269504088896340736f;
+    z += m * 0.44269504088896340736f;
+    z += y;
+    z += m;
+    return z + (float32_t)e;
+}
+
+/**
+   @ingroup vlog
+*/
+
+/**
+   @addtogroup vlogKernels
+   @{
+*/
+
+/**
+  @brief Element-wise base-2 logarithm of a 32-bit floating point vector for XPULPV2 extension.
+  Base-2 logarithm of every sample. Zero gives -INFINITY, negative inputs and NaN give NaN,
+  +INFINITY gives +INFINITY. The relative error is below 2^-22.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector, can be equal to pSrc
+  @return     none
+ */
+
+void plp_vlog2_f32s_xpulpv2(const float32_t *pSrc,
+                            uint32_t blockSize,
+                            float32_t *pDst) {
+
+    uint32_t blkCnt;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        float32_t y0 = vlog2_f32(pSrc[0]);
+        float32_t y1 = vlog2_f32(pSrc[1]);
+        pDst[0] = y0;
+        pDst[1] = y1;
+        pSrc += 2;
+        pDst += 2;
+    }
+
+    if (blockSize & 1) {
+        *pDst = vlog2_f32(*pSrc);
+    }
+}
+
+/**
+  @} end of vlogKernels group
+ */
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vlog_q32s_xpulpv2.c
+ * Description:  Element-wise natural logarithm of a 32-bit fixed point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_common_tables.h"
+
+#define LN2_Q40 762123384786LL
+
+/*
+ * ln(v * 2^-fracBits) * 2^40 for v > 0: v is normalized to m in [2^31, 2^32), i.e. the mantissa
+ * f = m * 2^-31 in [1, 2). With the reciprocal c = logRecipTable_q32[i] * 2^-31 of the table entry
+ * i of the upper six bits of f, f * c = 1 + r with 0 <= r < 1/64, such that
+ * ln(f) = ln(1/c) + ln(1 + r) with ln(1/c) read from logTable_q32 and the series of ln(1 + r) cut
+ * after the r^4 term. r and the series are computed with 32 fractional bits.
+ */
+static inline int64_t log_q40(uint32_t v, uint32_t fracBits) {
+
+    uint32_t shift = __builtin_clz(v);
+    uint32_t m = v << shift;
+    int32_t e = 31 - (int32_t)shift - (int32_t)fracBits;
+    uint32_t i = (m >> 25) & (FAST_MATH_LOG_TABLE_SIZE - 1);
+    uint32_t r = (uint32_t)((((uint64_t)m * logRecipTable_q32[i]) >> 30) - 0x100000000ULL);
+    uint32_t r2 = (uint32_t)(((uint64_t)r * r) >> 32);
+    uint32_t r3 = (uint32_t)(((uint64_t)r2 * r) >> 32);
+    uint32_t r4 = (uint32_t)(((uint64_t)r3 * r) >> 32);
+    int64_t p = (int64_t)r - (r2 >> 1) + r3 / 3 - (r4 >> 2);
+
+    return e * LN2_Q40 + (((int64_t)logTable_q32[i] + p) << 8);
+}
+
+/**
+   @ingroup vlog
+*/
+
+/**
+   @addtogroup vlogKernels
+   @{
+*/
+
+/**
+  @brief Element-wise natural logarithm of a 32-bit fixed point vector for XPULPV2 extension.
+  Computes ln(pSrc[n] * 2^-fracBits) * 2^fracBits, rounded and saturated, i.e. the natural
+  logarithm with the same number of fractional bits. Non-positive inputs give 0x80000000. The
+  error is at most 1 LSB.
+  @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  fracBits   number of fractional bits of input and output
+  @param[out] pDst       points to the output vector, can be equal to pSrc
+  @return     none
+ */
+
+void plp_vlog_q32s_xpulpv2(const int32_t *pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *pDst) {
+
+    uint32_t blkCnt;
+    int64_t y;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        if (pSrc[blkCnt] > 0) {
+            y = (log_q40((uint32_t)pSrc[blkCnt], fracBits) + (1LL << (39 - fracBits))) >>
+                (40 - fracBits);
+            y = (y > 0x7FFFFFFF) ? 0x7FFFFFFF : y;
+            pDst[blkCnt] = (y < (-0x7FFFFFFF - 1)) ? (-0x7FFFFFFF - 1) : (int32_t)y;
+        } else {
+            pDst[blkCnt] = (-0x7FFFFFFF - 1);
+        }
+    }
+}
+
+/**
+  @} end of vlogKernels group
+ */
@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vsin_f32s_xpulpv2.c
+ * Description:  Element-wise sine of a 32-bit floating point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Notice: project inspired by ARM CMSIS DSP and parts of source code
+ * ported and adopted for RISC-V PULP platform from ARM CMSIS DSP
+ * released under Copyright (C) 2010-2019 ARM Limited or its affiliates
+ * with Apache-2.0.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/* linear interpolation of sinTable_f32, in is the angle in turns, same arithmetic as plp_sin_f32 */
+static inline float32_t sin_interp_f32(float32_t in) {
+
+    float32_t fract, findex, a, b;
+    uint16_t index;
+    int32_t n = (int32_t)in;
+
+    /* Make negative values towards -infinity */
+    if (in < 0.0f) {
+        n--;
+    }
+
+    /* Map input value to [0 1] */
+    in = in - (float32_t)n;
+
+    findex = (float32_t)FAST_MATH_TABLE_SIZE * in;
+    index = (uint16_t)findex;
+
+    /* when "in" is exactly 1, we need to rotate the index down to 0 */
+    if (index >= FAST_MATH_TABLE_SIZE) {
+        index = 0;
+        findex -= (float32_t)FAST_MATH_TABLE_SIZE;
+    }
+
+    fract = findex - (float32_t)index;
+    a = sinTable_f32[index];
+    b = sinTable_f32[index + 1];
+
+    return (1.0f - fract) * a + fract * b;
+}
+
+/**
+  @brief Element-wise sine of a 32-bit floating point vector for XPULPV2 extension.
+  Same result as plp_sin_f32 applied to every sample.
+  @param[in]  pSrc       points to the input vector, angles in radians
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector
+  @return     none
+ */
+
+void plp_vsin_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        float32_t y0 = sin_interp_f32(pSrc[0] * 0.159154943092f);
+        float32_t y1 = sin_interp_f32(pSrc[1] * 0.159154943092f);
+        pDst[0] = y0;
+        pDst[1] = y1;
+        pSrc += 2;
+        pDst += 2;
+    }
+
+    if (blockSize & 1) {
+        *pDst = sin_interp_f32(*pSrc * 0.159154943092f);
+    }
+}
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vsin_q16s_xpulpv2.c
+ * Description:  Element-wise sine of a 16-bit fixed point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Notice: project inspired by ARM CMSIS DSP and parts of source code
+ * ported and adopted for RISC-V PULP platform from ARM CMSIS DSP
+ * released under Copyright (C) 2010-2019 ARM Limited or its affiliates
+ * with Apache-2.0.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/* linear interpolation of sinTable_q16, same arithmetic as plp_sin_q16 */
+static inline int16_t sin_interp_q16(int32_t index, int32_t fract) {
+
+    int16_t sinVal;
+    int16_t a = sinTable_q16[index];
+    int16_t b = sinTable_q16[index + 1];
+
+    sinVal = (int32_t)(0x8000 - fract) * a >> 16;
+    sinVal = (int16_t)((((int32_t)sinVal << 16) + ((int32_t)fract * b)) >> 16);
+
+    return (sinVal << 1);
+}
+
+/**
+  @brief Element-wise sine of a 16-bit fixed point vector for XPULPV2 extension.
+  Same result as plp_sin_q16 applied to every sample.
+  @param[in]  pSrc       points to the input vector, Q1.15 values in [-1, 1)
+                         mapped to [-2*PI, 2*PI)
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector
+  @return     none
+ */
+
+void plp_vsin_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int16_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+    int16_t x;
+    v2s x2, index, fract;
+    v2s posMask = (v2s){ 0x7FFF, 0x7FFF };
+    v2s fractMask = (v2s){ (1 << FAST_MATH_Q16_SHIFT) - 1, (1 << FAST_MATH_Q16_SHIFT) - 1 };
+    v2s indexShift = (v2s){ FAST_MATH_Q16_SHIFT, FAST_MATH_Q16_SHIFT };
+    v2s fractShift = (v2s){ 9, 9 };
+
+    /* index and fractional part of two samples at once, negative inputs wrap to [0, 1) */
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        x2 = *((const v2s *)pSrc);
+        x2 = __AND2(x2, posMask);
+        index = __SRA2(x2, indexShift);
+        fract = __SLL2(__AND2(x2, fractMask), fractShift);
+        *((v2s *)pDst) =
+            __PACK2(sin_interp_q16(index[0], fract[0]), sin_interp_q16(index[1], fract[1]));
+        pSrc += 2;
+        pDst += 2;
+    }
+
+    if (blockSize & 1) {
+        x = *pSrc & 0x7FFF;
+        *pDst = sin_interp_q16(x >> FAST_MATH_Q16_SHIFT,
+                               (x & ((1 << FAST_MATH_Q16_SHIFT) - 1)) << 9);
+    }
+}
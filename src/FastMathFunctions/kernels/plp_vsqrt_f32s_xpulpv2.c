@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vsqrt_f32s_xpulpv2.c
+ * Description:  Element-wise square root of a 32-bit floating point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* fast inverse square root with two newton iterations, same arithmetic as plp_sqrt_f32 */
+static inline float32_t sqrt_newton_f32(float32_t in) {
+
+    const float32_t threehalfs = 1.5f;
+    float32_t x2, y;
+    union {
+        float32_t f;
+        int32_t i;
+    } conv;
+
+    if (in <= 0.f) {
+        return 0.f;
+    }
+
+    x2 = in * 0.5f;
+    conv.f = in;
+    conv.i = 0x5f3759df - (conv.i >> 1);
+    y = conv.f;
+    y = y * (threehalfs - (x2 * y * y));
+    y = y * (threehalfs - (x2 * y * y));
+
+    return in * y;
+}
+
+/**
+   @ingroup sqrt
+*/
+
+/**
+   @addtogroup sqrtKernels
+   @{
+*/
+
+/**
+  @brief Element-wise square root of a 32-bit floating point vector for XPULPV2 extension.
+  Same result as plp_sqrt_f32 applied to every sample. Non-positive inputs give 0.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector
+  @return     none
+ */
+
+void plp_vsqrt_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            float32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        float32_t y0 = sqrt_newton_f32(pSrc[0]);
+        float32_t y1 = sqrt_newton_f32(pSrc[1]);
+        pDst[0] = y0;
+        pDst[1] = y1;
+        pSrc += 2;
+        pDst += 2;
+    }
+
+    if (blockSize & 1) {
+        *pDst = sqrt_newton_f32(*pSrc);
+    }
+}
+
+/**
+  @} end of sqrtKernels group
+ */
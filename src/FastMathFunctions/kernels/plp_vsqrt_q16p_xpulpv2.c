@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vsqrt_q16p_xpulpv2.c
+ * Description:  Parallel element-wise square root of a 16-bit fixed point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup sqrt
+*/
+
+/**
+   @addtogroup sqrtKernels
+   @{
+*/
+
+/**
+  @brief Parallel element-wise square root of a 16-bit fixed point vector for XPULPV2 extension.
+  Each core processes a contiguous chunk of the vector (an even number of
+  samples, which keeps the SIMD accesses aligned) with plp_vsqrt_q16s_xpulpv2.
+  @param[in]  args  points to the plp_vfast_math_instance_q16 structure
+  @return     none
+ */
+
+void plp_vsqrt_q16p_xpulpv2(void *args) {
+
+    plp_vfast_math_instance_q16 *a = (plp_vfast_math_instance_q16 *)args;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 1U) & ~1U;
+    uint32_t start = hal_core_id() * chunk;
+    uint32_t end = (start + chunk < blockSize) ? start + chunk : blockSize;
+
+    if (start < end) {
+        plp_vsqrt_q16s_xpulpv2(a->pSrc + start, end - start, a->fracBits, a->pDst + start);
+    }
+}
+
+/**
+  @} end of sqrtKernels group
+ */
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vsqrt_q16s_xpulpv2.c
+ * Description:  Element-wise square root of a 16-bit fixed point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_isqrt.h"
+
+/* floor(sqrt(x * 2^fracBits)) saturated to 0x7FFF, 0 for x <= 0 */
+static inline int16_t vsqrt_q16(int16_t x, uint32_t fracBits) {
+
+    uint32_t res;
+
+    if (x <= 0) {
+        return 0;
+    }
+    res = plp_isqrt32((uint32_t)x << fracBits);
+    return (res > 0x7FFF) ? 0x7FFF : res;
+}
+
+/**
+   @ingroup sqrt
+*/
+
+/**
+   @addtogroup sqrtKernels
+   @{
+*/
+
+/**
+  @brief Element-wise square root of a 16-bit fixed point vector for XPULPV2 extension.
+  Computes floor(sqrt(pSrc[n] * 2^fracBits)), i.e. the square root with the same
+  number of fractional bits, saturated to 0x7FFF. Non-positive inputs give 0.
+  @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  fracBits   number of fractional bits of input and output
+  @param[out] pDst       points to the output vector
+  @return     none
+ */
+
+void plp_vsqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int16_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+    int16_t x0, x1;
+
+    // two samples per iteration, read and written with post-increment loads and stores
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        x0 = *pSrc++;
+        x1 = *pSrc++;
+        *pDst++ = vsqrt_q16(x0, fracBits);
+        *pDst++ = vsqrt_q16(x1, fracBits);
+    }
+
+    if (blockSize & 1) {
+        *pDst = vsqrt_q16(*pSrc, fracBits);
+    }
+}
+
+/**
+  @} end of sqrtKernels group
+ */
@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vexp_q16.c
+ * Description:  Element-wise exponential of a 16-bit fixed point vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMath
+*/
+
+/**
+   @addtogroup vexp
+   @{
+*/
+
+/**
+  @brief Glue code for element-wise exponential of a 16-bit fixed point vector.
+  Computes exp(pSrc[n] * 2^-fracBits) * 2^fracBits, rounded and saturated to 0x7FFF, i.e. the
+  exponential with the same number of fractional bits. The error is at most 1 LSB.
+  @param[in]  pSrc       points to the input vector, values with fracBits fractional bits
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  fracBits   number of fractional bits of input and output
+  @param[out] pDst       points to the output vector, can be equal to pSrc
+  @return     none
+ */
+
+void plp_vexp_q16(const int16_t *pSrc,
+                  uint32_t blockSize,
+                  uint32_t fracBits,
+                  int16_t *pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_vexp_q16s_rv32im(pSrc, blockSize, fracBits, pDst);
+    } else {
+        plp_vexp_q16s_xpulpv2(pSrc, blockSize, fracBits, pDst);
+    }
+}
+
+/**
+  @} end of vexp group
+ */
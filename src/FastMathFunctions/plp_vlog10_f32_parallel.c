@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_vlog10_f32_parallel.c
+ * Description:  Parallel element-wise base-10 logarithm of a 32-bit floating point vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMath
+*/
+
+/**
+   @addtogroup vlog
+   @{
+*/
+
+/**
+  @brief Glue code for parallel element-wise base-10 logarithm of a 32-bit floating point vector.
+  Base-10 logarithm of every sample, e.g. for dB conversion. Zero gives -INFINITY, negative inputs
+  and NaN give NaN, +INFINITY gives +INFINITY. The relative error is below 2^-22.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the output vector, can be equal to pSrc
+  @return     none
+ */
+
+void plp_vlog10_f32_parallel(const float32_t *pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             float32_t *pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_vfast_math_instance_f32 S =
+        (plp_vfast_math_instance_f32){ pSrc, blockSize, nPE, pDst };
+
+    hal_cl_team_fork(nPE, plp_vlog10_f32p_xpulpv2, (void *)&S);
+}
+
+/**
+  @} end of vlog group
+ */
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q16s_xpulpv2.c
+ * Description:  16-bit fixed point Direct Form I biquad cascade kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BiquadCascade
+*/
+
+/**
+   @addtogroup BiquadCascadeKernels
+   @{
+*/
+
+/**
+   @brief         Direct Form I biquad cascade kernel for XPULPV2 extension (16-bit fixed point).
+   @param[in]     S          points to an initialized instance
+   @param[in]     pSrc       points to the input samples
+   @param[out]    pDst       points to the output samples, may be equal to pSrc
+   @param[in]     blockSize  number of samples to filter
+   @return        none
+
+   @par Exploiting SIMD instructions
+   The past inputs and outputs are kept packed in two 16-bit vectors, such that the four
+   feedforward and feedback products of a sample are computed by two sum-dot-products.
+*/
+
+void plp_biquad_cascade_df1_q16s_xpulpv2(const plp_biquad_df1_instance_q16 *S,
+                                         const int16_t *pSrc,
+                                         int16_t *pDst,
+                                         uint32_t blockSize) {
+
+    const int16_t *pIn = pSrc;
+    const int16_t *pCoeffs = S->pCoeffs;
+    int16_t *pState = S->pState;
+    uint32_t deciPoint = S->deciPoint;
+    int16_t b0, x0;
+    int32_t acc;
+    uint32_t stage, n;
+
+    v2s _b12, _a12; /* {b1, b2}, {a1, a2} */
+    v2s _x12, _y12; /* {x[n-1], x[n-2]}, {y[n-1], y[n-2]} */
+
+    for (stage = 0; stage < S->numStages; stage++) {
+        b0 = pCoeffs[0];
+        _b12 = *((v2s *)(pCoeffs + 2));
+        _a12 = *((v2s *)(pCoeffs + 4));
+        pCoeffs += 6;
+
+        _x12 = *((v2s *)pState);
+        _y12 = *((v2s *)(pState + 2));
+
+        for (n = 0; n < blockSize; n++) {
+            x0 = pIn[n];
+
+            acc = __SUMDOTP2(_x12, _b12, b0 * x0);
+            acc = __SUMDOTP2(_y12, _a12, acc);
+            acc = __CLIP(__ROUNDNORM_REG(acc, deciPoint), 15);
+
+            _x12 = __PACK2(x0, _x12[0]);
+            _y12 = __PACK2(acc, _y12[0]);
+
+            pDst[n] = (int16_t)acc;
+        }
+
+        *((v2s *)pState) = _x12;
+        *((v2s *)(pState + 2)) = _y12;
+        pState += 4;
+
+        /* the next stage filters the output of this one */
+        pIn = pDst;
+    }
+}
+
+/**
+   @} end of BiquadCascadeKernels group
+*/
@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q32p_xpulpv2.c
+ * Description:  32-bit fixed point Direct Form I multi-channel biquad cascade kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BiquadCascade
+*/
+
+/**
+   @addtogroup BiquadCascadeKernels
+   @{
+*/
+
+/**
+   @brief         Parallel multi-channel biquad cascade kernel for XPULPV2 extension
+                  (Direct Form I, 32-bit fixed point).
+   @param[in]     args  points to the plp_biquad_df1_instance_q32_parallel structure
+   @return        none
+
+   @par Work split
+   The channels are distributed over the cores in an interleaved way, each channel is filtered
+   by a single core with plp_biquad_cascade_df1_q32s_xpulpv2.
+*/
+
+void plp_biquad_cascade_df1_q32p_xpulpv2(void *args) {
+
+    plp_biquad_df1_instance_q32_parallel *a = (plp_biquad_df1_instance_q32_parallel *)args;
+
+    uint32_t blockSize = a->blockSize;
+
+    for (uint32_t ch = hal_core_id(); ch < a->nChannels; ch += a->nPE) {
+        plp_biquad_cascade_df1_q32s_xpulpv2(&a->S[ch], a->pSrc + ch * blockSize,
+                                            a->pDst + ch * blockSize, blockSize);
+    }
+}
+
+/**
+   @} end of BiquadCascadeKernels group
+*/
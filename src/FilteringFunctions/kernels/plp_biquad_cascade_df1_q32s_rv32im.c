@@ -0,0 +1,109 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q32s_rv32im.c
+ * Description:  32-bit fixed point Direct Form I biquad cascade kernel for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BiquadCascade
+*/
+
+/**
+   @addtogroup BiquadCascadeKernels
+   @{
+*/
+
+/**
+   @brief         Direct Form I biquad cascade kernel for RV32IM extension (32-bit fixed point).
+   @param[in]     S          points to an initialized instance
+   @param[in]     pSrc       points to the input samples
+   @param[out]    pDst       points to the output samples, may be equal to pSrc
+   @param[in]     blockSize  number of samples to filter
+   @return        none
+*/
+
+void plp_biquad_cascade_df1_q32s_rv32im(const plp_biquad_df1_instance_q32 *S,
+                                        const int32_t *pSrc,
+                                        int32_t *pDst,
+                                        uint32_t blockSize) {
+
+    const int32_t *pIn = pSrc;
+    const int32_t *pCoeffs = S->pCoeffs;
+    int32_t *pState = S->pState;
+    uint32_t deciPoint = S->deciPoint;
+    int64_t round = deciPoint > 0 ? (int64_t)1 << (deciPoint - 1) : 0;
+    int32_t b0, b1, b2, a1, a2;
+    int32_t x0, x1, x2, y1, y2;
+    int64_t acc;
+    uint32_t stage, n;
+
+    for (stage = 0; stage < S->numStages; stage++) {
+        b0 = pCoeffs[0];
+        b1 = pCoeffs[1];
+        b2 = pCoeffs[2];
+        a1 = pCoeffs[3];
+        a2 = pCoeffs[4];
+        pCoeffs += 5;
+
+        x1 = pState[0];
+        x2 = pState[1];
+        y1 = pState[2];
+        y2 = pState[3];
+
+        for (n = 0; n < blockSize; n++) {
+            x0 = pIn[n];
+
+            acc = (int64_t)b0 * x0;
+            acc += (int64_t)b1 * x1;
+            acc += (int64_t)b2 * x2;
+            acc += (int64_t)a1 * y1;
+            acc += (int64_t)a2 * y2;
+            acc = (acc + round) >> deciPoint;
+            acc = acc > INT32_MAX ? INT32_MAX : (acc < INT32_MIN ? INT32_MIN : acc);
+
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = (int32_t)acc;
+
+            pDst[n] = y1;
+        }
+
+        pState[0] = x1;
+        pState[1] = x2;
+        pState[2] = y1;
+        pState[3] = y2;
+        pState += 4;
+
+        /* the next stage filters the output of this one */
+        pIn = pDst;
+    }
+}
+
+/**
+   @} end of BiquadCascadeKernels group
+*/
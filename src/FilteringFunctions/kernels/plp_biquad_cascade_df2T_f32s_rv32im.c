@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df2T_f32s_rv32im.c
+ * Description:  32-bit float Transposed Direct Form II biquad cascade kernel for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BiquadCascade
+*/
+
+/**
+   @addtogroup BiquadCascadeKernels
+   @{
+*/
+
+/**
+   @brief         Transposed Direct Form II biquad cascade kernel for RV32IM extension (32-bit float).
+   @param[in]     S          points to an initialized instance
+   @param[in]     pSrc       points to the input samples
+   @param[out]    pDst       points to the output samples, may be equal to pSrc
+   @param[in]     blockSize  number of samples to filter
+   @return        none
+*/
+
+void plp_biquad_cascade_df2T_f32s_rv32im(const plp_biquad_df2T_instance_f32 *S,
+                                         const float32_t *pSrc,
+                                         float32_t *pDst,
+                                         uint32_t blockSize) {
+
+    const float32_t *pIn = pSrc;
+    const float32_t *pCoeffs = S->pCoeffs;
+    float32_t *pState = S->pState;
+    float32_t b0, b1, b2, a1, a2;
+    float32_t x0, y0, d1, d2;
+    uint32_t stage, n;
+
+    for (stage = 0; stage < S->numStages; stage++) {
+        b0 = pCoeffs[0];
+        b1 = pCoeffs[1];
+        b2 = pCoeffs[2];
+        a1 = pCoeffs[3];
+        a2 = pCoeffs[4];
+        pCoeffs += 5;
+
+        d1 = pState[0];
+        d2 = pState[1];
+
+        for (n = 0; n < blockSize; n++) {
+            x0 = pIn[n];
+
+            y0 = b0 * x0 + d1;
+            d1 = b1 * x0 + a1 * y0 + d2;
+            d2 = b2 * x0 + a2 * y0;
+
+            pDst[n] = y0;
+        }
+
+        pState[0] = d1;
+        pState[1] = d2;
+        pState += 2;
+
+        /* the next stage filters the output of this one */
+        pIn = pDst;
+    }
+}
+
+/**
+   @} end of BiquadCascadeKernels group
+*/
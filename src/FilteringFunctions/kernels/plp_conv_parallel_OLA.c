@@ -83,7 +83,9 @@ void plp_conv_parallel_OLA(uint32_t nPE,
         S.addOffset *= 2;
         remainingcycles = (remainingcycles + 1) >> 1;
         participants = S.numVectors >> 1;
-        S.coresPerVector = ((2 * nPE) / ((S.numVectors >> 1) << 1));
+        if (participants > 0) {
+            S.coresPerVector = ((2 * nPE) / ((S.numVectors >> 1) << 1));
+        }
     }
 }
 
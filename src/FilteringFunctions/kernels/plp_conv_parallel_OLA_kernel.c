@@ -71,136 +71,60 @@ void plp_conv_parallel_OLA_kernel(void *task_args) {
 
     uint32_t stepSize = (addLength + coresPerVector - 1) / coresPerVector;
     uint8_t shardId = coreId % coresPerVector;
-    uint32_t sharedLength = (addLengthsecond - addLength + coresPerVector - 1) / coresPerVector;
+    /* with short vectors, the trailing shards can start behind the end of the overlap */
+    uint32_t addStart = (shardId * stepSize < addLength) ? shardId * stepSize : addLength;
+    uint32_t addEnd = (shardId != coresPerVector - 1 && (shardId + 1) * stepSize < addLength)
+                          ? (shardId + 1) * stepSize
+                          : addLength;
 
-#if defined(PLP_MATH_LOOPUNROLL)
-    uint32_t k;
-    int32_t temp1, temp2, temp3, temp4;
-    int32_t *_pRes = (pRes + (shardId * stepSize) + addOffset);
-    const int32_t *pIn1 = (pRes + (shardId * stepSize) + addOffset);
-    const int32_t *pIn2 = (pRes + (shardId * stepSize) + blockOffset);
-    const int32_t *pIn3 = (pRes + (shardId * sharedLength) + blockOffset + addLength);
-    int32_t *_pRes2 = (pRes + (shardId * sharedLength) + addLength + addOffset);
-#endif
-
-    if (shardId != coresPerVector - 1) {
+    /* all cores must have read the instance before it is updated below */
+    hal_team_barrier();
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-        k = stepSize >> 1U;
-
-        while (k) {
-            temp1 = *pIn1++;
-            temp2 = *pIn1++;
-            temp3 = *pIn2++;
-            temp4 = *pIn2++;
-
-            *_pRes++ = temp1 + temp3;
-            *_pRes++ = temp2 + temp4;
-
-            k--;
-        }
-
-        k = (stepSize) % 0x2U;
-
-        if (k) {
-            *_pRes = *pIn1 + *pIn2;
-        }
-
-        if (addLength < addLengthsecond && sharedLength > 0) {
+    uint32_t k;
+    int32_t temp1, temp2, temp3, temp4;
+    int32_t *_pRes = (pRes + addStart + addOffset);
+    const int32_t *pIn1 = (pRes + addStart + addOffset);
+    const int32_t *pIn2 = (pRes + addStart + blockOffset);
 
-            k = sharedLength >> 1U;
+    k = (addEnd - addStart) >> 1U;
 
-            while (k) {
-                temp1 = *pIn3++;
-                temp2 = *pIn3++;
+    while (k) {
+        temp1 = *pIn1++;
+        temp2 = *pIn1++;
+        temp3 = *pIn2++;
+        temp4 = *pIn2++;
 
-                *_pRes2++ = temp1;
-                *_pRes2++ = temp2;
+        *_pRes++ = temp1 + temp3;
+        *_pRes++ = temp2 + temp4;
 
-                k--;
-            }
+        k--;
+    }
 
-            k = sharedLength % 0x2U;
+    k = (addEnd - addStart) % 0x2U;
 
-            if (k) {
-                *_pRes2 = *pIn3;
-            }
-        }
+    if (k) {
+        *_pRes = *pIn1 + *pIn2;
+    }
 
 #else
 
-        for (uint32_t i = shardId * stepSize; i < (shardId + 1) * stepSize; i++) {
-            pRes[i + addOffset] += pRes[i + blockOffset];
-        }
+    for (uint32_t i = addStart; i < addEnd; i++) {
+        pRes[i + addOffset] += pRes[i + blockOffset];
+    }
 
-        if (addLength < addLengthsecond && sharedLength > 0) {
-            for (uint32_t i = shardId * sharedLength; i < (shardId + 1) * sharedLength; i++) {
-                pRes[i + addLength + addOffset] = pRes[i + blockOffset + addLength];
-            }
-        }
 #endif // if defined(PLP_MATH_LOOPUNROLL)
 
-    } else {
-
-#if defined(PLP_MATH_LOOPUNROLL)
-
-        k = (addLength - shardId * stepSize) >> 1U;
-
-        while (k) {
-            temp1 = *pIn1++;
-            temp2 = *pIn1++;
-            temp3 = *pIn2++;
-            temp4 = *pIn2++;
-
-            *_pRes++ = temp1 + temp3;
-            *_pRes++ = temp2 + temp4;
-
-            k--;
-        }
-
-        k = (addLength - shardId * stepSize) % 0x2U;
-
-        if (k) {
-            *_pRes = *pIn1 + *pIn2;
-        }
-
-        if (addLength < addLengthsecond) {
-
-            k = ((addLengthsecond - addLength) - shardId * sharedLength) >> 1U;
-
-            while (k) {
-                temp1 = *pIn3++;
-                temp2 = *pIn3++;
-
-                *_pRes2++ = temp1;
-                *_pRes2++ = temp2;
-
-                k--;
-            }
-
-            k = ((addLengthsecond - addLength) - shardId * sharedLength) % 0x2U;
-
-            if (k) {
-                *_pRes2 = *pIn3;
-            }
-        }
-
-        if (coreId == (numVectors >> 1) * coresPerVector - 1) {
-            if (addLength >= addLengthsecond) {
-                S->addLengthsecond = addLengthfirst;
-            } else {
-                S->addLengthsecond = addLengthfirst + addLengthsecond - addLength;
-            }
-        }
+    /* The non-overlapping part of the second vector is moved down, behind the overlap. The move
+       overwrites samples read by the other shards above and its source and destination overlap,
+       so it is done by the last shard of each vector pair, after all shards finished adding. */
+    hal_team_barrier();
 
-#else
-        for (uint32_t i = shardId * stepSize; i < addLength; i++) {
-            pRes[i + addOffset] += pRes[i + blockOffset];
-        }
+    if (shardId == coresPerVector - 1) {
 
         if (addLength < addLengthsecond) {
-            for (uint32_t i = shardId * sharedLength; i < (addLengthsecond - addLength); i++) {
+            for (uint32_t i = 0; i < (addLengthsecond - addLength); i++) {
                 pRes[i + addLength + addOffset] = pRes[i + blockOffset + addLength];
             }
         }
@@ -212,9 +136,8 @@ void plp_conv_parallel_OLA_kernel(void *task_args) {
                 S->addLengthsecond = addLengthfirst + addLengthsecond - addLength;
             }
         }
-
-#endif // if defined(PLP_MATH_LOOPUNROLL)
     }
+
     hal_team_barrier();
     return;
 }
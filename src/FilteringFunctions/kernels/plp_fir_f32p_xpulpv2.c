@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_f32p_xpulpv2.c
+ * Description:  32-bit float parallel FIR filter kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+/**
+   @brief         Parallel FIR filter of 32-bit float samples kernel for XPULPV2 extension.
+   @param[in]     args  points to the plp_fir_instance_f32_parallel structure
+   @return        none
+
+   @par Work split
+   Each core appends its part of the input block to the delay line and, after a barrier, computes
+   a contiguous chunk of outputs (a multiple of four samples) with plp_fir_f32s_xpulpv2. After a
+   second barrier the history for the next block is moved to the front of the delay line.
+*/
+
+void plp_fir_f32p_xpulpv2(void *args) {
+
+    plp_fir_instance_f32_parallel *a = (plp_fir_instance_f32_parallel *)args;
+    const plp_fir_instance_f32 *S = a->S;
+
+    uint32_t core_id = hal_core_id();
+    uint32_t nPE = a->nPE;
+    uint32_t numTaps = S->numTaps;
+    uint32_t blockSize = S->blockSize;
+    float32_t *pState = S->pState;
+    uint32_t i;
+
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 3U) & ~3U;
+    uint32_t start = core_id * chunk;
+    uint32_t end = (start + chunk < blockSize) ? start + chunk : blockSize;
+
+    /* append the new block to the delay line */
+    for (i = start; i < end; i++) {
+        pState[numTaps - 1 + i] = a->pSrc[i];
+    }
+
+    hal_team_barrier();
+
+    if (start < end) {
+        plp_fir_f32s_xpulpv2(pState + start, S->pCoeffs, numTaps, end - start,
+                             a->pDst + start);
+    }
+
+    hal_team_barrier();
+
+    /* keep the last numTaps - 1 samples for the next block */
+    if (blockSize >= numTaps - 1) {
+        uint32_t histChunk = (numTaps - 1 + nPE - 1) / nPE;
+        uint32_t histStart = core_id * histChunk;
+        uint32_t histEnd =
+            (histStart + histChunk < numTaps - 1) ? histStart + histChunk : numTaps - 1;
+
+        for (i = histStart; i < histEnd; i++) {
+            pState[i] = pState[blockSize + i];
+        }
+    } else if (core_id == 0) {
+        /* source and destination overlap */
+        for (i = 0; i < numTaps - 1; i++) {
+            pState[i] = pState[blockSize + i];
+        }
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_f32s_rv32im.c
+ * Description:  32-bit float FIR filter kernel for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+/**
+   @brief         FIR filter of 32-bit float samples kernel for RV32IM extension.
+   @param[in]     pState     points to the delay line, numTaps - 1 + blockSize samples
+   @param[in]     pCoeffs    points to the coefficients, in time reversed order
+   @param[in]     numTaps    number of filter coefficients
+   @param[in]     blockSize  number of output samples to compute
+   @param[out]    pDst       points to the output samples
+   @return        none
+*/
+
+void plp_fir_f32s_rv32im(const float32_t *__restrict__ pState,
+                         const float32_t *__restrict__ pCoeffs,
+                         uint32_t numTaps,
+                         uint32_t blockSize,
+                         float32_t *__restrict__ pDst) {
+
+    const float32_t *px; /* delay line pointer */
+    const float32_t *pc; /* coefficient pointer */
+    float32_t sum;
+    uint32_t blkCnt, k;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        px = pState + blkCnt;
+        pc = pCoeffs;
+        sum = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+        for (k = numTaps >> 1U; k > 0U; k--) {
+            float32_t x0 = *px++;
+            float32_t c0 = *pc++;
+            float32_t x1 = *px++;
+            float32_t c1 = *pc++;
+
+            sum += x0 * c0;
+            sum += x1 * c1;
+        }
+
+        if (numTaps & 1U) {
+            sum += (*px) * (*pc);
+        }
+#else
+        for (k = 0; k < numTaps; k++) {
+            sum += (*px++) * (*pc++);
+        }
+#endif
+
+        pDst[blkCnt] = sum;
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
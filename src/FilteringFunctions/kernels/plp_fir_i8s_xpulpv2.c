@@ -0,0 +1,165 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_i8s_xpulpv2.c
+ * Description:  8-bit integer FIR filter kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define shufflemask1                                                                               \
+    (v4s) { 1, 2, 3, 4 }
+#define shufflemask2                                                                               \
+    (v4s) { 2, 3, 4, 5 }
+#define shufflemask3                                                                               \
+    (v4s) { 3, 4, 5, 6 }
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+/**
+   @brief         FIR filter of 8-bit integer samples kernel for XPULPV2 extension.
+   @param[in]     pState     points to the delay line, numTaps - 1 + blockSize samples (plus one
+                             sample of padding)
+   @param[in]     pCoeffs    points to the coefficients, in time reversed order
+   @param[in]     numTaps    number of filter coefficients
+   @param[in]     blockSize  number of output samples to compute
+   @param[out]    pDst       points to the output samples
+   @return        none
+
+   @par Exploiting SIMD instructions
+   Four outputs are computed at the same time. The 8 bit samples and coefficients are loaded four
+   by four, the shifted sample windows are built with shuffles and accumulated with
+   sum-dot-products.
+*/
+
+void plp_fir_i8s_xpulpv2(const int8_t *__restrict__ pState,
+                         const int8_t *__restrict__ pCoeffs,
+                         uint32_t numTaps,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pDst) {
+
+    const int8_t *px; /* delay line pointer */
+    const int8_t *pc; /* coefficient pointer */
+    int32_t acc0, acc1, acc2, acc3, sum;
+    uint32_t blkCnt, k;
+    int8_t c0;
+
+    v4s _x0, _x1, _x2, _x3, _x4;
+    v4s _c;
+
+    /* compute 4 outputs at a time */
+    blkCnt = blockSize >> 2U;
+    while (blkCnt > 0U) {
+        acc0 = 0;
+        acc1 = 0;
+        acc2 = 0;
+        acc3 = 0;
+
+        px = pState;
+        pc = pCoeffs;
+
+        /* 4 taps at a time */
+        k = numTaps >> 2U;
+        while (k > 0U) {
+            _c = *((v4s *)pc); // {c[0], c[1], c[2], c[3]}
+
+            _x0 = *((v4s *)px);       // {x[0], x[1], x[2], x[3]}
+            _x4 = *((v4s *)(px + 4)); // {x[4], x[5], x[6], x[7]}
+
+            _x1 = __builtin_shuffle(_x0, _x4, shufflemask1); // {x[1], x[2], x[3], x[4]}
+            _x2 = __builtin_shuffle(_x0, _x4, shufflemask2); // {x[2], x[3], x[4], x[5]}
+            _x3 = __builtin_shuffle(_x0, _x4, shufflemask3); // {x[3], x[4], x[5], x[6]}
+
+            acc0 = __SUMDOTP4(_x0, _c, acc0);
+            acc1 = __SUMDOTP4(_x1, _c, acc1);
+            acc2 = __SUMDOTP4(_x2, _c, acc2);
+            acc3 = __SUMDOTP4(_x3, _c, acc3);
+
+            px += 4U;
+            pc += 4U;
+            k--;
+        }
+
+        /* remaining 1 to 3 taps */
+        k = numTaps % 4U;
+        while (k > 0U) {
+            c0 = *pc++;
+
+            acc0 += px[0] * c0;
+            acc1 += px[1] * c0;
+            acc2 += px[2] * c0;
+            acc3 += px[3] * c0;
+
+            px++;
+            k--;
+        }
+
+        *pDst++ = acc0;
+        *pDst++ = acc1;
+        *pDst++ = acc2;
+        *pDst++ = acc3;
+
+        pState += 4U;
+        blkCnt--;
+    }
+
+    /* remaining 1 to 3 outputs */
+    blkCnt = blockSize % 4U;
+    while (blkCnt > 0U) {
+        px = pState;
+        pc = pCoeffs;
+        sum = 0;
+
+        k = numTaps >> 2U;
+        while (k > 0U) {
+            sum = __SUMDOTP4(*((v4s *)px), *((v4s *)pc), sum);
+
+            px += 4U;
+            pc += 4U;
+            k--;
+        }
+
+        k = numTaps % 4U;
+        while (k > 0U) {
+            sum += (*px++) * (*pc++);
+            k--;
+        }
+
+        *pDst++ = sum;
+
+        pState++;
+        blkCnt--;
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
@@ -0,0 +1,168 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q16s_xpulpv2.c
+ * Description:  16-bit fixed point FIR filter kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define shufflemask1                                                                               \
+    (v2s) { 1, 2 }
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+/**
+   @brief         FIR filter of 16-bit fixed point samples kernel for XPULPV2 extension.
+   @param[in]     pState     points to the delay line, numTaps - 1 + blockSize samples (plus one
+                             sample of padding)
+   @param[in]     pCoeffs    points to the coefficients, in time reversed order
+   @param[in]     numTaps    number of filter coefficients
+   @param[in]     blockSize  number of output samples to compute
+   @param[in]     deciPoint  decimal point for right shift of the result
+   @param[out]    pDst       points to the output samples
+   @return        none
+
+   @par Exploiting SIMD instructions
+   Four outputs are computed at the same time. The 16 bit samples and coefficients are loaded two
+   by two, the shifted sample pairs are built with shuffles and accumulated with sum-dot-products.
+*/
+
+void plp_fir_q16s_xpulpv2(const int16_t *__restrict__ pState,
+                          const int16_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          uint32_t blockSize,
+                          uint32_t deciPoint,
+                          int16_t *__restrict__ pDst) {
+
+    const int16_t *px; /* delay line pointer */
+    const int16_t *pc; /* coefficient pointer */
+    int32_t acc0, acc1, acc2, acc3, sum;
+    uint32_t blkCnt, k;
+    int16_t c0;
+
+    v2s _x01, _x12, _x23, _x34, _x45, _x56, _x67;
+    v2s _c01, _c23;
+
+    /* compute 4 outputs at a time */
+    blkCnt = blockSize >> 2U;
+    while (blkCnt > 0U) {
+        acc0 = 0;
+        acc1 = 0;
+        acc2 = 0;
+        acc3 = 0;
+
+        px = pState;
+        pc = pCoeffs;
+
+        /* 4 taps at a time */
+        k = numTaps >> 2U;
+        while (k > 0U) {
+            _c01 = *((v2s *)pc);       // {c[0], c[1]}
+            _c23 = *((v2s *)(pc + 2)); // {c[2], c[3]}
+
+            _x01 = *((v2s *)px);       // {x[0], x[1]}
+            _x23 = *((v2s *)(px + 2)); // {x[2], x[3]}
+            _x45 = *((v2s *)(px + 4)); // {x[4], x[5]}
+            _x67 = *((v2s *)(px + 6)); // {x[6], x[7]}
+
+            _x12 = __builtin_shuffle(_x01, _x23, shufflemask1); // {x[1], x[2]}
+            _x34 = __builtin_shuffle(_x23, _x45, shufflemask1); // {x[3], x[4]}
+            _x56 = __builtin_shuffle(_x45, _x67, shufflemask1); // {x[5], x[6]}
+
+            acc0 = __SUMDOTP2(_x01, _c01, acc0);
+            acc1 = __SUMDOTP2(_x12, _c01, acc1);
+            acc2 = __SUMDOTP2(_x23, _c01, acc2);
+            acc3 = __SUMDOTP2(_x34, _c01, acc3);
+
+            acc0 = __SUMDOTP2(_x23, _c23, acc0);
+            acc1 = __SUMDOTP2(_x34, _c23, acc1);
+            acc2 = __SUMDOTP2(_x45, _c23, acc2);
+            acc3 = __SUMDOTP2(_x56, _c23, acc3);
+
+            px += 4U;
+            pc += 4U;
+            k--;
+        }
+
+        /* remaining 1 to 3 taps */
+        k = numTaps % 4U;
+        while (k > 0U) {
+            c0 = *pc++;
+
+            acc0 += px[0] * c0;
+            acc1 += px[1] * c0;
+            acc2 += px[2] * c0;
+            acc3 += px[3] * c0;
+
+            px++;
+            k--;
+        }
+
+        *pDst++ = (int16_t)__CLIP(__ROUNDNORM_REG(acc0, deciPoint), 15);
+        *pDst++ = (int16_t)__CLIP(__ROUNDNORM_REG(acc1, deciPoint), 15);
+        *pDst++ = (int16_t)__CLIP(__ROUNDNORM_REG(acc2, deciPoint), 15);
+        *pDst++ = (int16_t)__CLIP(__ROUNDNORM_REG(acc3, deciPoint), 15);
+
+        pState += 4U;
+        blkCnt--;
+    }
+
+    /* remaining 1 to 3 outputs */
+    blkCnt = blockSize % 4U;
+    while (blkCnt > 0U) {
+        px = pState;
+        pc = pCoeffs;
+        sum = 0;
+
+        k = numTaps >> 1U;
+        while (k > 0U) {
+            sum = __SUMDOTP2(*((v2s *)px), *((v2s *)pc), sum);
+
+            px += 2U;
+            pc += 2U;
+            k--;
+        }
+
+        if (numTaps & 1U) {
+            sum += (*px) * (*pc);
+        }
+
+        *pDst++ = (int16_t)__CLIP(__ROUNDNORM_REG(sum, deciPoint), 15);
+
+        pState++;
+        blkCnt--;
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
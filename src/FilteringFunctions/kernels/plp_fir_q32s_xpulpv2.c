@@ -0,0 +1,129 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q32s_xpulpv2.c
+ * Description:  32-bit fixed point FIR filter kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+/**
+   @brief         FIR filter of 32-bit fixed point samples kernel for XPULPV2 extension.
+   @param[in]     pState     points to the delay line, numTaps - 1 + blockSize samples (plus one
+                             sample of padding)
+   @param[in]     pCoeffs    points to the coefficients, in time reversed order
+   @param[in]     numTaps    number of filter coefficients
+   @param[in]     blockSize  number of output samples to compute
+   @param[in]     deciPoint  decimal point for right shift of the result
+   @param[out]    pDst       points to the output samples
+   @return        none
+
+   @par Register blocking
+   Four outputs are computed at the same time, such that every coefficient and state sample is
+   loaded only once per block of four outputs.
+*/
+
+void plp_fir_q32s_xpulpv2(const int32_t *__restrict__ pState,
+                          const int32_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          uint32_t blockSize,
+                          uint32_t deciPoint,
+                          int32_t *__restrict__ pDst) {
+
+    const int32_t *px; /* delay line pointer */
+    const int32_t *pc; /* coefficient pointer */
+    int32_t acc0, acc1, acc2, acc3, sum;
+    int32_t x0, x1, x2, x3, c0;
+    uint32_t blkCnt, k;
+
+    /* compute 4 outputs at a time, sharing the coefficient and state loads */
+    blkCnt = blockSize >> 2U;
+    while (blkCnt > 0U) {
+        acc0 = 0;
+        acc1 = 0;
+        acc2 = 0;
+        acc3 = 0;
+
+        px = pState;
+        pc = pCoeffs;
+
+        x0 = *px++;
+        x1 = *px++;
+        x2 = *px++;
+
+        k = numTaps;
+        while (k > 0U) {
+            c0 = *pc++;
+            x3 = *px++;
+
+            acc0 += x0 * c0;
+            acc1 += x1 * c0;
+            acc2 += x2 * c0;
+            acc3 += x3 * c0;
+
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+            k--;
+        }
+
+        *pDst++ = __ROUNDNORM_REG(acc0, deciPoint);
+        *pDst++ = __ROUNDNORM_REG(acc1, deciPoint);
+        *pDst++ = __ROUNDNORM_REG(acc2, deciPoint);
+        *pDst++ = __ROUNDNORM_REG(acc3, deciPoint);
+
+        pState += 4U;
+        blkCnt--;
+    }
+
+    /* remaining 1 to 3 outputs */
+    blkCnt = blockSize % 4U;
+    while (blkCnt > 0U) {
+        px = pState;
+        pc = pCoeffs;
+        sum = 0;
+
+        for (k = 0; k < numTaps; k++) {
+            sum += (*px++) * (*pc++);
+        }
+
+        *pDst++ = __ROUNDNORM_REG(sum, deciPoint);
+
+        pState++;
+        blkCnt--;
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point Direct Form I biquad cascade
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup BiquadCascade Biquad Cascade IIR Filters
+   Cascades of second order IIR sections (biquads). Each stage computes
+   <pre>
+       y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+   </pre>
+   Note that the feedback coefficients a1 and a2 are stored negated with respect to the usual
+   transfer function <code>H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 - a1 z^-1 - a2 z^-2)</code>.
+   The output of a stage is the input of the next one.
+
+   Available variants:
+   - Direct Form I for 16-bit fixed point. The coefficients of a stage are stored as
+     <code>{b0, 0, b1, b2, a1, a2}</code>, the zero keeps the coefficient pairs aligned for the
+     SIMD kernels. The state of a stage is <code>{x[n-1], x[n-2], y[n-1], y[n-2]}</code>.
+     Products are accumulated in 32 bit, shifted right by deciPoint with rounding and saturated
+     to 16 bit.
+   - Direct Form I for 32-bit fixed point, with coefficients <code>{b0, b1, b2, a1, a2}</code>
+     and the same state layout. Products are accumulated in 64 bit, shifted right by deciPoint
+     with rounding and saturated to 32 bit, because stable poles need more coefficient precision
+     than the 32-bit products of the other fixed point functions leave.
+   - Transposed Direct Form II for 32-bit float, with coefficients
+     <code>{b0, b1, b2, a1, a2}</code> and the state <code>{d1, d2}</code> per stage.
+
+   The deciPoint of the fixed point variants is the number of fractional bits of the
+   coefficients.
+
+   Since the state makes each channel inherently serial, the parallel versions filter several
+   independent channels, each with its own instance, distributing the channels over the cores.
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief         Initialization of the 16-bit fixed point Direct Form I biquad cascade.
+   @param[out]    S          points to the instance structure to initialize
+   @param[in]     numStages  number of second order stages
+   @param[in]     pCoeffs    points to the coefficients, 6 per stage: {b0, 0, b1, b2, a1, a2}
+   @param[in]     pState     points to the state buffer, 4 values per stage
+   @param[in]     deciPoint  number of fractional bits of the coefficients
+   @return        none
+
+   @par Note
+   The state buffer is cleared.
+*/
+
+void plp_biquad_cascade_df1_init_q16(plp_biquad_df1_instance_q16 *S,
+                                     uint32_t numStages,
+                                     const int16_t *pCoeffs,
+                                     int16_t *pState,
+                                     uint32_t deciPoint) {
+
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->deciPoint = deciPoint;
+
+    for (uint32_t i = 0; i < 4 * numStages; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_init_q32.c
+ * Description:  Initialization of the 32-bit fixed point Direct Form I biquad cascade
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief         Initialization of the 32-bit fixed point Direct Form I biquad cascade.
+   @param[out]    S          points to the instance structure to initialize
+   @param[in]     numStages  number of second order stages
+   @param[in]     pCoeffs    points to the coefficients, 5 per stage: {b0, b1, b2, a1, a2}
+   @param[in]     pState     points to the state buffer, 4 values per stage
+   @param[in]     deciPoint  number of fractional bits of the coefficients
+   @return        none
+
+   @par Note
+   The state buffer is cleared.
+*/
+
+void plp_biquad_cascade_df1_init_q32(plp_biquad_df1_instance_q32 *S,
+                                     uint32_t numStages,
+                                     const int32_t *pCoeffs,
+                                     int32_t *pState,
+                                     uint32_t deciPoint) {
+
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->deciPoint = deciPoint;
+
+    for (uint32_t i = 0; i < 4 * numStages; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
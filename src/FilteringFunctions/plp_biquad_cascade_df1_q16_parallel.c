@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q16_parallel.c
+ * Description:  16-bit fixed point Direct Form I multi-channel biquad cascade glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief         Glue code for filtering multiple channels with biquad cascades on multiple
+                  cores (Direct Form I, 16-bit fixed point).
+   @param[in]     S          points to an array of nChannels initialized instances, one per
+                             channel
+   @param[in]     nChannels  number of channels
+   @param[in]     pSrc       points to the input samples, the blocks of all channels one after
+                             the other
+   @param[out]    pDst       points to the output samples, same layout as pSrc
+   @param[in]     blockSize  number of samples to filter per channel
+   @param[in]     nPE        number of cores to use
+   @return        none
+*/
+
+void plp_biquad_cascade_df1_q16_parallel(const plp_biquad_df1_instance_q16 *S,
+                                         uint32_t nChannels,
+                                         const int16_t *pSrc,
+                                         int16_t *pDst,
+                                         uint32_t blockSize,
+                                         uint32_t nPE) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_biquad_df1_instance_q16_parallel args = { .S = S,
+                                                      .nChannels = nChannels,
+                                                      .pSrc = pSrc,
+                                                      .pDst = pDst,
+                                                      .blockSize = blockSize,
+                                                      .nPE = nPE };
+
+        hal_cl_team_fork(nPE, plp_biquad_cascade_df1_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df2T_init_f32.c
+ * Description:  Initialization of the 32-bit float Transposed Direct Form II biquad cascade
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief         Initialization of the 32-bit float Transposed Direct Form II biquad cascade.
+   @param[out]    S          points to the instance structure to initialize
+   @param[in]     numStages  number of second order stages
+   @param[in]     pCoeffs    points to the coefficients, 5 per stage: {b0, b1, b2, a1, a2}
+   @param[in]     pState     points to the state buffer, 2 values per stage
+   @return        none
+
+   @par Note
+   The state buffer is cleared.
+*/
+
+void plp_biquad_cascade_df2T_init_f32(plp_biquad_df2T_instance_f32 *S,
+                                      uint32_t numStages,
+                                      const float32_t *pCoeffs,
+                                      float32_t *pState) {
+
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+
+    for (uint32_t i = 0; i < 2 * numStages; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
@@ -31,7 +31,7 @@
 #include "plp_math.h"
 #include "rtos_hal.h"
 
-HAL_CL_L1 int32_t *resultsBuffer;
+static HAL_CL_L1 int32_t *resultsBuffer;
 
 /**
    @ingroup groupFilters
@@ -71,16 +71,23 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
         uint32_t pIn1Len;
         uint32_t pIn2Len;
 
+        /* the longer vector is split across the cores, the shorter one sets the overlap */
         if (srcALen >= srcBLen) {
-            pIn2 = pSrcA;
-            pIn1 = pSrcB;
-            pIn2Len = srcALen;
-            pIn1Len = srcBLen;
-        } else {
-            pIn2 = pSrcB;
             pIn1 = pSrcA;
-            pIn2Len = srcBLen;
+            pIn2 = pSrcB;
             pIn1Len = srcALen;
+            pIn2Len = srcBLen;
+        } else {
+            pIn1 = pSrcB;
+            pIn2 = pSrcA;
+            pIn1Len = srcBLen;
+            pIn2Len = srcALen;
+        }
+
+        /* every core needs a non-empty part of the longer vector */
+        if (((pIn1Len + nPE - 1) / nPE) * (nPE - 1) >= pIn1Len) {
+            plp_conv_i16(pSrcA, srcALen, pSrcB, srcBLen, pRes);
+            return;
         }
 
         uint32_t srcAoffset = ((pIn1Len + nPE - 1) / nPE);
@@ -92,7 +99,7 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
 
         if (nPE > 1) {
             resultsBuffer =
-                (int32_t *)hal_cl_l1_malloc(sizeof(int32_t) * resultsoffset * nPE);
+                (int32_t *)plp_scratch_alloc(sizeof(int32_t) * resultsoffset * nPE);
             resBuf = resultsBuffer;
             // printf("Address of resultsBuffer: 0x%x, End: 0x%x\n", resultsBuffer, resultsBuffer +
             // sizeof(int32_t)*resultsLen);
@@ -160,7 +167,7 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
                 pRes[i] = resultsBuffer[i];
             }
 #endif
-            hal_cl_l1_free(resBuf, sizeof(int32_t) * resultsoffset * nPE);
+            plp_scratch_free(resBuf, sizeof(int32_t) * resultsoffset * nPE);
 #endif
         }
 
@@ -150,9 +150,10 @@ void plp_conv_i32(const int32_t *pSrcA,
             *pOut++ += *_pRes++;
         }
 
+        hal_fc_l1_free(_pRes1_32, sizeof(int32_t) * (resultsoffset));
     } else {
 
-        _pRes1_32 = hal_cl_l1_malloc(sizeof(int32_t) * (resultsoffset));
+        _pRes1_32 = plp_scratch_alloc(sizeof(int32_t) * (resultsoffset));
 
         int32_t *pOut = pRes;
         int32_t *_pRes = _pRes1_32;
@@ -206,8 +207,9 @@ void plp_conv_i32(const int32_t *pSrcA,
         if (k) {
             *pOut++ += *_pRes++;
         }
+
+        plp_scratch_free(_pRes1_32, sizeof(int32_t) * (resultsoffset));
     }
-    hal_cl_l1_free(_pRes1_32, sizeof(int32_t) * (resultsoffset));
 }
 
 /**
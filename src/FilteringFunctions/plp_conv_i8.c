@@ -142,9 +142,10 @@ void plp_conv_i8(const int8_t *pSrcA,
             *pOut++ += *_pRes++;
         }
 
+        hal_fc_l1_free(_pRes1_8, sizeof(int32_t) * (resultsoffset));
     } else {
 
-        _pRes1_8 = hal_cl_l1_malloc(sizeof(int32_t) * (resultsoffset));
+        _pRes1_8 = plp_scratch_alloc(sizeof(int32_t) * (resultsoffset));
 
         int32_t *pOut = pRes;
         int32_t *_pRes = _pRes1_8;
@@ -198,8 +199,9 @@ void plp_conv_i8(const int8_t *pSrcA,
         if (k) {
             *pOut++ += *_pRes++;
         }
+
+        plp_scratch_free(_pRes1_8, sizeof(int32_t) * (resultsoffset));
     }
-    hal_cl_l1_free(_pRes1_8, sizeof(int32_t) * (resultsoffset));
 }
 
 /**
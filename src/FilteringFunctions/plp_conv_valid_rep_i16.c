@@ -88,8 +88,8 @@ void plp_conv_valid_rep_i16(const int16_t *pSrcA,
         uint32_t len_align = ((in1Len + 1) >> 1) << 1; // compute aligned memory size
         uint32_t mem_size = len_align << 1;            // memory size for all 2 replications
 
-        int16_t *p_1_loc = hal_cl_l1_malloc(sizeof(int16_t) * mem_size);
-        int16_t *p_2_loc = hal_cl_l1_malloc(sizeof(int16_t) * in2Len);
+        int16_t *p_1_loc = plp_scratch_alloc(sizeof(int16_t) * mem_size);
+        int16_t *p_2_loc = plp_scratch_alloc(sizeof(int16_t) * in2Len);
 
         if (p_1_loc == NULL || p_2_loc == NULL) {
             printf("Error: insufficient L1 memory!\n");
@@ -101,20 +101,20 @@ void plp_conv_valid_rep_i16(const int16_t *pSrcA,
         int merge = 0;
 
         for (int i = 0; i < 2; i++) {
-            hal_cl_dma_cmd((unsigned int)(pIn1 + i), (unsigned int)(p_1_loc + i * len_align),
+            hal_cl_dma_cmd((uintptr_t)(pIn1 + i), (uintptr_t)(p_1_loc + i * len_align),
                           sizeof(int16_t) * (in1Len - i), HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
             merge = 1;
         }
 
-        hal_cl_dma_cmd((unsigned int)pIn2, (unsigned int)p_2_loc, sizeof(int16_t) * in2Len,
+        hal_cl_dma_cmd((uintptr_t)pIn2, (uintptr_t)p_2_loc, sizeof(int16_t) * in2Len,
                       HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
 
         hal_cl_dma_cmd_wait(&copy);
 
         plp_conv_valid_rep_i16s_xpulpv2(p_1_loc, in1Len, len_align, p_2_loc, in2Len, pRes);
 
-        hal_cl_l1_free(p_1_loc, sizeof(int16_t) * mem_size);
-        hal_cl_l1_free(p_2_loc, sizeof(int16_t) * in2Len);
+        plp_scratch_free(p_2_loc, sizeof(int16_t) * in2Len);
+        plp_scratch_free(p_1_loc, sizeof(int16_t) * mem_size);
     }
 }
 
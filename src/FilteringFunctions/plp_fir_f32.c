@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_f32.c
+ * Description:  32-bit float FIR filter glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FIR
+   @{
+*/
+
+/**
+   @brief         Glue code for filtering a block of 32-bit float samples with a FIR filter.
+   @param[in]     S     points to an initialized 32-bit float FIR instance
+   @param[in]     pSrc  points to the input block of S->blockSize samples
+   @param[out]    pDst  points to the output block of S->blockSize samples
+   @return        none
+*/
+
+void plp_fir_f32(const plp_fir_instance_f32 *S, const float32_t *pSrc, float32_t *pDst) {
+
+    float32_t *pState = S->pState;
+    uint32_t numTaps = S->numTaps;
+    uint32_t blockSize = S->blockSize;
+    uint32_t i;
+
+    /* append the new block to the delay line */
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_fir_f32s_rv32im(pState, S->pCoeffs, numTaps, blockSize, pDst);
+    } else {
+        plp_fir_f32s_xpulpv2(pState, S->pCoeffs, numTaps, blockSize, pDst);
+    }
+
+    /* keep the last numTaps - 1 samples for the next block */
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIR group
+*/
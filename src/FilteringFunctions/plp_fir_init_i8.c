@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_init_i8.c
+ * Description:  Initialization of the 8-bit integer FIR filter instance
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup FIR Finite Impulse Response Filters
+   Streaming FIR filters which keep their delay line in an instance structure, such that a signal
+   can be filtered block by block without recomputing the overlap between consecutive blocks.
+   <pre>
+       y[n] = b[0] * x[n] + b[1] * x[n-1] + ... + b[numTaps-1] * x[n-numTaps+1]
+   </pre>
+   The filter is set up once with plp_fir_init_<type> and then called with blockSize new input
+   samples at a time. The instance holds:
+   - pCoeffs, the numTaps coefficients stored in time reversed order:
+     <code>{b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}</code>
+   - pState, the delay line with the last numTaps - 1 input samples followed by the current
+     block. It must hold numTaps + blockSize samples; the last one is padding for the SIMD
+     kernels, which may read (but never use) one sample past the current block.
+
+   The glue code appends the new block to the delay line, filters it and keeps the last
+   numTaps - 1 samples for the next call. The parallel versions split the output samples of a
+   block in contiguous chunks of a multiple of four samples across the cores.
+
+   The 8- and 16-bit integer versions return 32-bit results. The fixed point versions accumulate
+   in 32 bit and shift the result right by deciPoint with rounding; the 16-bit fixed point version
+   saturates the result to 16 bit.
+*/
+
+/**
+   @addtogroup FIR
+   @{
+*/
+
+/**
+   @brief         Initialization of the 8-bit integer FIR filter instance.
+   @param[out]    S          points to the instance structure to initialize
+   @param[in]     numTaps    number of filter coefficients, at least 1
+   @param[in]     pCoeffs    points to the coefficients, in time reversed order
+   @param[in]     pState     points to the state buffer of size numTaps + blockSize
+   @param[in]     blockSize  number of samples processed per call
+   @return        none
+
+   @par Note
+   The state buffer is cleared, i.e. the filter starts from a zero history.
+*/
+
+void plp_fir_init_i8(plp_fir_instance_i8 *S,
+                     uint32_t numTaps,
+                     const int8_t *pCoeffs,
+                     int8_t *pState,
+                     uint32_t blockSize) {
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->blockSize = blockSize;
+
+    for (uint32_t i = 0; i < numTaps + blockSize; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of FIR group
+*/
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_init_q32.c
+ * Description:  Initialization of the 32-bit fixed point FIR filter instance
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FIR
+   @{
+*/
+
+/**
+   @brief         Initialization of the 32-bit fixed point FIR filter instance.
+   @param[out]    S          points to the instance structure to initialize
+   @param[in]     numTaps    number of filter coefficients, at least 1
+   @param[in]     pCoeffs    points to the coefficients, in time reversed order
+   @param[in]     pState     points to the state buffer of size numTaps + blockSize
+   @param[in]     blockSize  number of samples processed per call
+   @param[in]     deciPoint  decimal point for right shift of the result
+   @return        none
+
+   @par Note
+   The state buffer is cleared, i.e. the filter starts from a zero history.
+*/
+
+void plp_fir_init_q32(plp_fir_instance_q32 *S,
+                      uint32_t numTaps,
+                      const int32_t *pCoeffs,
+                      int32_t *pState,
+                      uint32_t blockSize,
+                      uint32_t deciPoint) {
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->blockSize = blockSize;
+    S->deciPoint = deciPoint;
+
+    for (uint32_t i = 0; i < numTaps + blockSize; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of FIR group
+*/
@@ -0,0 +1,150 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        rtos_hal_host.c
+ * Description:  Host (Linux) backend of the hardware abstraction layer
+ *
+ * $Date:        18. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM Linux hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <pthread.h>
+#include <time.h>
+
+#include "rtos_hal.h"
+
+/*
+ * The cluster is emulated by a team of POSIX threads. The calling thread always acts as core 0 of
+ * the team (as the master core does on PULP), the other nb_cores-1 threads are spawned for the
+ * duration of the fork. The calling thread is considered to run on cluster 0 by default, so that
+ * the glue code dispatches to the XPULPV2 kernels and the parallel entry points are available.
+ * Call hal_host_set_cluster_id(ARCHI_FC_CID) to exercise the RV32IM kernels instead.
+ */
+
+typedef struct {
+    int core_id;
+    void (*entry)(void *);
+    void *arg;
+} hal_host_worker_t;
+
+static __thread int tls_core_id = 0;
+static __thread int tls_cluster_id = 0;
+
+static pthread_barrier_t team_barrier;
+static int team_nb_cores = 1;
+
+static __thread uint64_t perf_start_ns = 0;
+static __thread uint64_t perf_acc_ns = 0;
+static __thread int perf_running = 0;
+
+int hal_host_core_id(void) { return tls_core_id; }
+
+int hal_host_cluster_id(void) { return tls_cluster_id; }
+
+void hal_host_set_cluster_id(int cid) { tls_cluster_id = cid; }
+
+static void *hal_host_worker(void *p) {
+    hal_host_worker_t *w = (hal_host_worker_t *)p;
+    tls_core_id = w->core_id;
+    tls_cluster_id = 0;
+    w->entry(w->arg);
+    return NULL;
+}
+
+void hal_host_team_fork(int nb_cores, void (*entry)(void *), void *arg) {
+    if (nb_cores <= 0 || nb_cores > HAL_HOST_NB_PE_CORES) {
+        nb_cores = HAL_HOST_NB_PE_CORES;
+    }
+
+    pthread_t threads[HAL_HOST_NB_PE_CORES];
+    hal_host_worker_t workers[HAL_HOST_NB_PE_CORES];
+    int master_core_id = tls_core_id;
+    int master_cluster_id = tls_cluster_id;
+    int i;
+
+    team_nb_cores = nb_cores;
+    pthread_barrier_init(&team_barrier, NULL, nb_cores);
+
+    for (i = 1; i < nb_cores; i++) {
+        workers[i].core_id = i;
+        workers[i].entry = entry;
+        workers[i].arg = arg;
+        if (pthread_create(&threads[i], NULL, hal_host_worker, &workers[i]) != 0) {
+            fprintf(stderr, "hal_host_team_fork: unable to spawn core %d\n", i);
+            abort();
+        }
+    }
+
+    tls_core_id = 0;
+    tls_cluster_id = 0;
+    entry(arg);
+
+    for (i = 1; i < nb_cores; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    tls_core_id = master_core_id;
+    tls_cluster_id = master_cluster_id;
+    pthread_barrier_destroy(&team_barrier);
+    team_nb_cores = 1;
+}
+
+void hal_host_team_barrier(void) {
+    if (team_nb_cores > 1) {
+        pthread_barrier_wait(&team_barrier);
+    }
+}
+
+static uint64_t hal_host_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+void hal_host_perf_conf(unsigned events __attribute__((unused))) {}
+
+void hal_host_perf_reset(void) {
+    perf_acc_ns = 0;
+    perf_start_ns = hal_host_now_ns();
+}
+
+void hal_host_perf_start(void) {
+    perf_start_ns = hal_host_now_ns();
+    perf_running = 1;
+}
+
+void hal_host_perf_stop(void) {
+    if (perf_running) {
+        perf_acc_ns += hal_host_now_ns() - perf_start_ns;
+        perf_running = 0;
+    }
+}
+
+unsigned int hal_host_perf_read(int id) {
+    if (id != HAL_PERF_CYCLES && id != HAL_PERF_ACTIVE_CYCLES) {
+        return 0;
+    }
+    uint64_t ns = perf_acc_ns;
+    if (perf_running) {
+        ns += hal_host_now_ns() - perf_start_ns;
+    }
+    return (unsigned int)ns;
+}
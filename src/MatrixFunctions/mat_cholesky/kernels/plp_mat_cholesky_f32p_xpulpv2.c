@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_f32p_xpulpv2.c
+ * Description:  parallel Cholesky decomposition kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholesky
+ */
+
+/**
+  @addtogroup MatCholeskyKernels
+  @{
+ */
+
+/**
+   @brief Parallel Cholesky decomposition of a 32-bit floating-point matrix kernel for XPULPV2
+          extension.
+
+   The columns are computed one after the other, with a barrier after each column. Every core
+   computes the diagonal element itself (in the same order, thus to the same result), and the
+   elements below the diagonal are split over the rows.
+
+   @param[in]  args  pointer to plp_mat_cholesky_instance_f32 struct initialized by
+                     plp_mat_cholesky_f32_parallel. The result (0: Success, 1: Matrix is not
+                     positive definite) is returned in its ret field.
+   @return     none
+*/
+
+void plp_mat_cholesky_f32p_xpulpv2(void *args) {
+
+    plp_mat_cholesky_instance_f32 *a = (plp_mat_cholesky_instance_f32 *)args;
+
+    const float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstL = a->pDstL;
+
+    uint32_t core_id = hal_core_id();
+
+    uint32_t i, j, k;
+
+    for (j = 0; j < N; j++) {
+        const float *pRowJ = pDstL + j * N;
+
+        float diag = pSrc[j * N + j];
+        for (k = 0; k < j; k++) {
+            diag -= pRowJ[k] * pRowJ[k];
+        }
+        if (diag <= 0.0f) {
+            if (core_id == 0) {
+                a->ret = 1;
+            }
+            return;
+        }
+        diag = sqrtf(diag);
+        float invDiag = 1.0f / diag;
+
+        if (core_id == 0) {
+            pDstL[j * N + j] = diag;
+            for (k = j + 1; k < N; k++) {
+                pDstL[j * N + k] = 0.0f;
+            }
+        }
+
+        for (i = j + 1 + core_id; i < N; i += nPE) {
+            const float *pRowI = pDstL + i * N;
+            float sum = pSrc[i * N + j];
+            for (k = 0; k < j; k++) {
+                sum -= pRowI[k] * pRowJ[k];
+            }
+            pDstL[i * N + j] = sum * invDiag;
+        }
+
+        hal_team_barrier();
+    }
+}
+
+/**
+  @} end of MatCholeskyKernels group
+ */
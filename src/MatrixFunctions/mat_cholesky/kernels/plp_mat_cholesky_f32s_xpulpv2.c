@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_f32s_xpulpv2.c
+ * Description:  Cholesky decomposition kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholesky
+ */
+
+/**
+  @defgroup MatCholeskyKernels Cholesky decomposition kernels
+  This module contains the kernel functions for the Cholesky decomposition.
+
+  @par Algorithm
+  The Cholesky-Banachiewicz method computes L column by column. The diagonal element of column j
+  is the square root of the remaining diagonal of A, and the elements below are the remaining
+  elements of A divided by it:
+
+  \f[
+    L_{jj} = \sqrt{A_{jj} - \sum_{k<j} L_{jk}^2}, \qquad
+    L_{ij} = \frac{1}{L_{jj}} \left( A_{ij} - \sum_{k<j} L_{ik} L_{jk} \right)
+  \f]
+ */
+
+/**
+  @addtogroup MatCholeskyKernels
+  @{
+ */
+
+/**
+  @brief Cholesky decomposition of a 32-bit floating-point matrix kernel for XPULPV2 extension.
+  @param[in]  pSrc  Points to the symmetric positive definite input matrix of shape NxN, only its
+                    lower triangle is read
+  @param[in]  N     Width and height of both matrices
+  @param[out] pDstL Points to the lower triangular output matrix L of shape NxN, its upper
+                    triangle is set to zero
+  @return     0: Success, 1: Matrix is not positive definite
+ */
+
+int plp_mat_cholesky_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                  uint32_t N,
+                                  float *__restrict__ pDstL) {
+
+    uint32_t i, j, k;
+
+    for (j = 0; j < N; j++) {
+        const float *pRowJ = pDstL + j * N;
+
+        float diag = pSrc[j * N + j];
+        for (k = 0; k < j; k++) {
+            diag -= pRowJ[k] * pRowJ[k];
+        }
+        if (diag <= 0.0f) {
+            return 1;
+        }
+        diag = sqrtf(diag);
+        float invDiag = 1.0f / diag;
+
+        pDstL[j * N + j] = diag;
+        for (k = j + 1; k < N; k++) {
+            pDstL[j * N + k] = 0.0f;
+        }
+
+        for (i = j + 1; i < N; i++) {
+            const float *pRowI = pDstL + i * N;
+            float sum = pSrc[i * N + j];
+            for (k = 0; k < j; k++) {
+                sum -= pRowI[k] * pRowJ[k];
+            }
+            pDstL[i * N + j] = sum * invDiag;
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatCholeskyKernels group
+ */
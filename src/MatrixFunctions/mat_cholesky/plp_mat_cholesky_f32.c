@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_f32.c
+ * Description:  Cholesky decomposition glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatCholesky Cholesky decomposition
+  This module contains the glue code for the Cholesky decomposition. The kernel codes (kernels)
+  are in the Module Cholesky decomposition Kernels.
+
+  A symmetric positive definite matrix A is decomposed into a lower triangular matrix L with a
+  positive diagonal, such that
+
+  \f[
+    A = L \cdot L^T
+  \f]
+
+  Together with plp_mat_solve_lower_triangular_f32 and plp_mat_solve_upper_triangular_f32, this
+  solves symmetric positive definite systems (e.g. covariance updates) at roughly a sixth of the
+  operations of an explicit inversion with plp_mat_inv_f32.
+ */
+
+/**
+  @addtogroup MatCholesky
+  @{
+ */
+
+/**
+  @brief Glue code for the Cholesky decomposition of a 32-bit floating-point matrix.
+  @param[in]  pSrc  Points to the symmetric positive definite input matrix of shape NxN, only its
+                    lower triangle is read
+  @param[in]  N     Width and height of both matrices
+  @param[out] pDstL Points to the lower triangular output matrix L of shape NxN, its upper
+                    triangle is set to zero
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+
+  @par This function will use plp_mat_cholesky_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_cholesky_f32(const float *__restrict__ pSrc,
+                         uint32_t N,
+                         float *__restrict__ pDstL) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_cholesky_f32s_xpulpv2(pSrc, N, pDstL);
+    }
+}
+
+/**
+  @} end of MatCholesky group
+ */
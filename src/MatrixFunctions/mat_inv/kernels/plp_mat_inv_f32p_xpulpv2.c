@@ -41,18 +41,134 @@
 
 /**
    @brief Parallel matrix inversion of 32-bit floating-point matrices kernel for XPULPV2 extension.
-   @param[in]  args  pointer to plp_mat_inv_instance_f32 struct initialized by
-                    plp_mat_inv_f32_parallel
-   @return     0: Success, 1: Matrix is singular
 
-   @warn Not yet implemented
+   Gauss-Jordan elimination with partial pivoting. Each pivot step consists of three phases, each
+   followed by a barrier:
+   1. parallel pivot search: every core looks for the largest absolute value of the pivot column
+      in an interleaved subset of the remaining rows.
+   2. every core reduces the nPE candidates to the same pivot row, then the row exchange and the
+      normalization of the pivot row are split over the columns.
+   3. the elimination of the pivot column is split over the rows.
+
+   @param[in]  args  pointer to plp_mat_inv_instance_f32 struct initialized by
+                     plp_mat_inv_f32_parallel. The result (0: Success, 1: Matrix is singular) is
+                     returned in its ret field.
+   @return     none
 */
 
-int plp_mat_inv_f32p_xpulpv2(void *args) {
+void plp_mat_inv_f32p_xpulpv2(void *args) {
+
+    plp_mat_inv_instance_f32 *a = (plp_mat_inv_instance_f32 *)args;
+
+    float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = a->pDst;
+    float *pPivotVal = a->pPivotVal;
+    uint32_t *pPivotIdx = a->pPivotIdx;
+
+    uint32_t core_id = hal_core_id();
+
+    uint32_t i, j, l, p;
+
+    /* Initialize the destination matrix as identity matrix (split over the rows) */
+    for (i = core_id; i < N; i += nPE) {
+        float *pRow = pDst + i * N;
+        for (j = 0; j < N; j++) {
+            pRow[j] = 0.0f;
+        }
+        pRow[i] = 1.0f;
+    }
+
+    for (l = 0; l < N; l++) {
+
+        /* 1. Pivot search over the rows l + core_id, l + core_id + nPE, ... */
+        float best = 0.0f;
+        float bestAbs = 0.0f;
+        uint32_t bestIdx = l;
+        for (i = l + core_id; i < N; i += nPE) {
+            float val = pSrc[i * N + l];
+            float valAbs = val < 0.0f ? -val : val;
+            if (valAbs > bestAbs) {
+                best = val;
+                bestAbs = valAbs;
+                bestIdx = i;
+            }
+        }
+        pPivotVal[core_id] = best;
+        pPivotIdx[core_id] = bestIdx;
+
+        hal_team_barrier();
+
+        /* 2. Every core reduces the candidates (in the same order, thus to the same result) */
+        float pivot = pPivotVal[0];
+        float pivotAbs = pivot < 0.0f ? -pivot : pivot;
+        p = pPivotIdx[0];
+        for (i = 1; i < nPE; i++) {
+            float val = pPivotVal[i];
+            float valAbs = val < 0.0f ? -val : val;
+            if (valAbs > pivotAbs || (valAbs == pivotAbs && pPivotIdx[i] < p)) {
+                pivot = val;
+                pivotAbs = valAbs;
+                p = pPivotIdx[i];
+            }
+        }
+
+        if (pivotAbs == 0.0f) {
+            if (core_id == 0) {
+                a->ret = 1;
+            }
+            return;
+        }
+
+        /* Exchange row l and row p and normalize the new row l, split over the columns. Columns
+           left of the pivot are already zero in both rows of pSrc. */
+        float invPivot = 1.0f / pivot;
+        float *pRowL = pSrc + l * N;
+        float *pRowP = pSrc + p * N;
+        float *pDstL = pDst + l * N;
+        float *pDstP = pDst + p * N;
+
+        for (j = l + core_id; j < N; j += nPE) {
+            float tmp = pRowP[j];
+            pRowP[j] = pRowL[j];
+            pRowL[j] = tmp * invPivot;
+        }
+        for (j = core_id; j < N; j += nPE) {
+            float tmp = pDstP[j];
+            pDstP[j] = pDstL[j];
+            pDstL[j] = tmp * invPivot;
+        }
+
+        hal_team_barrier();
+
+        /* 3. Eliminate column l from all other rows, split over the rows */
+        for (i = core_id; i < N; i += nPE) {
+            if (i == l) {
+                continue;
+            }
+
+            float *pRowI = pSrc + i * N;
+            float *pDstI = pDst + i * N;
+            float factor = pRowI[l];
+
+            if (factor != 0.0f) {
+                pRowI[l] = 0.0f;
+                for (j = l + 1; j < N; j++) {
+                    pRowI[j] -= factor * pRowL[j];
+                }
+                for (j = 0; j < N; j++) {
+                    pDstI[j] -= factor * pDstL[j];
+                }
+            }
+        }
 
-    // TODO
+        hal_team_barrier();
+    }
 
-    return 1;
+    if (core_id == 0) {
+        a->ret = 0;
+    }
 }
 
 /**
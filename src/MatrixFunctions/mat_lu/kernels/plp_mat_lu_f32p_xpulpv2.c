@@ -0,0 +1,156 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_f32p_xpulpv2.c
+ * Description:  parallel LU decomposition kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatLU
+ */
+
+/**
+  @addtogroup MatLUKernels
+  @{
+ */
+
+/**
+   @brief Parallel LU decomposition of a 32-bit floating-point matrix kernel for XPULPV2 extension.
+
+   Gaussian elimination with partial pivoting, organized like plp_mat_inv_f32p_xpulpv2. Each pivot
+   step consists of three phases, each followed by a barrier:
+   1. parallel pivot search: every core looks for the largest absolute value of the pivot column
+      in an interleaved subset of the remaining rows.
+   2. every core reduces the nPE candidates to the same pivot row, then the row exchange is split
+      over the columns.
+   3. the elimination of the pivot column is split over the rows below the pivot.
+
+   @param[in]  args  pointer to plp_mat_lu_instance_f32 struct initialized by
+                     plp_mat_lu_f32_parallel. The result (0: Success, 1: Matrix is singular) is
+                     returned in its ret field.
+   @return     none
+*/
+
+void plp_mat_lu_f32p_xpulpv2(void *args) {
+
+    plp_mat_lu_instance_f32 *a = (plp_mat_lu_instance_f32 *)args;
+
+    float *__restrict__ pSrc = a->pSrcDst;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    uint32_t *__restrict__ pPerm = a->pPerm;
+    float *pPivotVal = a->pPivotVal;
+    uint32_t *pPivotIdx = a->pPivotIdx;
+
+    uint32_t core_id = hal_core_id();
+
+    uint32_t i, j, l, p;
+
+    for (i = core_id; i < N; i += nPE) {
+        pPerm[i] = i;
+    }
+
+    for (l = 0; l < N; l++) {
+
+        /* 1. Pivot search over the rows l + core_id, l + core_id + nPE, ... */
+        float best = 0.0f;
+        float bestAbs = 0.0f;
+        uint32_t bestIdx = l;
+        for (i = l + core_id; i < N; i += nPE) {
+            float val = pSrc[i * N + l];
+            float valAbs = val < 0.0f ? -val : val;
+            if (valAbs > bestAbs) {
+                best = val;
+                bestAbs = valAbs;
+                bestIdx = i;
+            }
+        }
+        pPivotVal[core_id] = best;
+        pPivotIdx[core_id] = bestIdx;
+
+        hal_team_barrier();
+
+        /* 2. Every core reduces the candidates (in the same order, thus to the same result) */
+        float pivot = pPivotVal[0];
+        float pivotAbs = pivot < 0.0f ? -pivot : pivot;
+        p = pPivotIdx[0];
+        for (i = 1; i < nPE; i++) {
+            float val = pPivotVal[i];
+            float valAbs = val < 0.0f ? -val : val;
+            if (valAbs > pivotAbs || (valAbs == pivotAbs && pPivotIdx[i] < p)) {
+                pivot = val;
+                pivotAbs = valAbs;
+                p = pPivotIdx[i];
+            }
+        }
+
+        if (pivotAbs == 0.0f) {
+            if (core_id == 0) {
+                a->ret = 1;
+            }
+            return;
+        }
+
+        /* Exchange the complete rows l and p, split over the columns */
+        float *pRowL = pSrc + l * N;
+
+        if (p != l) {
+            float *pRowP = pSrc + p * N;
+            for (j = core_id; j < N; j += nPE) {
+                float tmp = pRowP[j];
+                pRowP[j] = pRowL[j];
+                pRowL[j] = tmp;
+            }
+            if (core_id == 0) {
+                uint32_t tmp = pPerm[p];
+                pPerm[p] = pPerm[l];
+                pPerm[l] = tmp;
+            }
+        }
+
+        hal_team_barrier();
+
+        /* 3. Eliminate column l from the rows below, split over the rows */
+        float invPivot = 1.0f / pivot;
+        for (i = l + 1 + core_id; i < N; i += nPE) {
+            float *pRowI = pSrc + i * N;
+            float factor = pRowI[l] * invPivot;
+
+            pRowI[l] = factor;
+            if (factor != 0.0f) {
+                for (j = l + 1; j < N; j++) {
+                    pRowI[j] -= factor * pRowL[j];
+                }
+            }
+        }
+
+        hal_team_barrier();
+    }
+}
+
+/**
+  @} end of MatLUKernels group
+ */
@@ -0,0 +1,126 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_f32s_xpulpv2.c
+ * Description:  LU decomposition kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatLU
+ */
+
+/**
+  @defgroup MatLUKernels LU decomposition kernels
+  This module contains the kernel functions for the LU decomposition.
+
+  @par Algorithm
+  Gaussian elimination with partial pivoting. In step l, the row with the largest absolute value
+  in column l is exchanged with row l, and multiples of row l are subtracted from the rows below.
+  The multipliers form column l of L and are stored in place of the eliminated elements.
+ */
+
+/**
+  @addtogroup MatLUKernels
+  @{
+ */
+
+/**
+  @brief LU decomposition of a 32-bit floating-point matrix kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the input matrix of shape NxN, which is
+                        overwritten with L below the diagonal (without its unit diagonal) and U
+                        on and above the diagonal
+  @param[in]     N       Width and height of the matrix
+  @param[out]    pPerm   Points to the N row indices of the input matrix, row i of L * U is row
+                         pPerm[i] of the input matrix
+  @return        0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_lu_f32s_xpulpv2(float *__restrict__ pSrcDst,
+                            uint32_t N,
+                            uint32_t *__restrict__ pPerm) {
+
+    uint32_t i, j, l, p;
+
+    for (i = 0; i < N; i++) {
+        pPerm[i] = i;
+    }
+
+    for (l = 0; l < N; l++) {
+
+        /* Pivot search */
+        float pivot = pSrcDst[l * N + l];
+        float pivotAbs = pivot < 0.0f ? -pivot : pivot;
+        p = l;
+        for (i = l + 1; i < N; i++) {
+            float val = pSrcDst[i * N + l];
+            float valAbs = val < 0.0f ? -val : val;
+            if (valAbs > pivotAbs) {
+                pivot = val;
+                pivotAbs = valAbs;
+                p = i;
+            }
+        }
+
+        if (pivotAbs == 0.0f) {
+            return 1;
+        }
+
+        float *pRowL = pSrcDst + l * N;
+
+        /* Exchange the complete rows, including the multipliers already stored in L */
+        if (p != l) {
+            float *pRowP = pSrcDst + p * N;
+            for (j = 0; j < N; j++) {
+                float tmp = pRowP[j];
+                pRowP[j] = pRowL[j];
+                pRowL[j] = tmp;
+            }
+            uint32_t tmp = pPerm[p];
+            pPerm[p] = pPerm[l];
+            pPerm[l] = tmp;
+        }
+
+        /* Eliminate column l from the rows below and store the multipliers */
+        float invPivot = 1.0f / pivot;
+        for (i = l + 1; i < N; i++) {
+            float *pRowI = pSrcDst + i * N;
+            float factor = pRowI[l] * invPivot;
+
+            pRowI[l] = factor;
+            if (factor != 0.0f) {
+                for (j = l + 1; j < N; j++) {
+                    pRowI[j] -= factor * pRowL[j];
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatLUKernels group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_f32.c
+ * Description:  LU decomposition glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatLU LU decomposition
+  This module contains the glue code for the LU decomposition. The kernel codes (kernels) are in
+  the Module LU decomposition Kernels.
+
+  A square matrix A is decomposed into a lower triangular matrix L with a unit diagonal and an
+  upper triangular matrix U, such that
+
+  \f[
+    P \cdot A = L \cdot U
+  \f]
+
+  where the permutation P of the rows is chosen by partial pivoting and returned as a vector of
+  row indices. Both factors are stored in place of A.
+ */
+
+/**
+  @addtogroup MatLU
+  @{
+ */
+
+/**
+  @brief Glue code for the LU decomposition of a 32-bit floating-point matrix.
+  @param[in,out] pSrcDst Points to the input matrix of shape NxN, which is
+                        overwritten with L below the diagonal (without its unit diagonal) and U
+                        on and above the diagonal
+  @param[in]     N       Width and height of the matrix
+  @param[out]    pPerm   Points to the N row indices of the input matrix, row i of L * U is row
+                         pPerm[i] of the input matrix
+  @return        0: Success, 1: Matrix is singular, 2: operation not supported
+
+  @par This function will use plp_mat_lu_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_lu_f32(float *__restrict__ pSrcDst,
+                   uint32_t N,
+                   uint32_t *__restrict__ pPerm) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_lu_f32s_xpulpv2(pSrcDst, N, pPerm);
+    }
+}
+
+/**
+  @} end of MatLU group
+ */
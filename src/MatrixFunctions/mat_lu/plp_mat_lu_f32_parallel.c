@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_f32_parallel.c
+ * Description:  parallel LU decomposition glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatLU
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel LU decomposition of a 32-bit floating-point matrix.
+  @param[in,out] pSrcDst Points to the input matrix of shape NxN, which is
+                        overwritten with L below the diagonal (without its unit diagonal) and U
+                        on and above the diagonal
+  @param[in]     N       Width and height of the matrix
+  @param[in]     nPE     Number of cores to use for computation
+  @param[out]    pPerm   Points to the N row indices of the input matrix, row i of L * U is row
+                         pPerm[i] of the input matrix
+  @return        0: Success, 1: Matrix is singular, 2: operation not supported
+ */
+
+int plp_mat_lu_f32_parallel(float *__restrict__ pSrcDst,
+                            uint32_t N,
+                            uint32_t nPE,
+                            uint32_t *__restrict__ pPerm) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+        float pivotVal[hal_cl_nb_pe_cores()];
+        uint32_t pivotIdx[hal_cl_nb_pe_cores()];
+
+        plp_mat_lu_instance_f32 args = { .pSrcDst = pSrcDst,
+                                         .N = N,
+                                         .nPE = nPE,
+                                         .pPerm = pPerm,
+                                         .pPivotVal = pivotVal,
+                                         .pPivotIdx = pivotIdx,
+                                         .ret = 0 };
+
+        hal_cl_team_fork(nPE, plp_mat_lu_f32p_xpulpv2, (void *)&args);
+
+        return args.ret;
+    }
+}
+
+/**
+  @} end of MatLU group
+ */
@@ -42,11 +42,21 @@
 /**
    @brief Parallel matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
           extension.
+
+   The output matrix is divided into register tiles, which are distributed over the cores in an
+   interleaved fashion. The rows which are a multiple of 4 are computed in 4x2 tiles (6 loads for
+   8 multiply-accumulates), the remaining M % 4 rows in 1x4 tiles. Since both rows and columns are
+   split, all cores are used even if M < nPE (e.g. for vector-matrix products with M = 1).
+
    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
                      plp_mat_mult_f32_parallel
    @return     none
 */
 
+// #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+
+#ifdef BASIC_VERSION
+
 void plp_mat_mult_f32p_xpulpv2(void *args) {
 
     int core_id = hal_core_id();
@@ -61,9 +71,6 @@ void plp_mat_mult_f32p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     float *__restrict__ pDstC = a->pDstC;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
-
     uint32_t m, n, o;
 
     for (m = core_id; m < M; m += nPE) {
@@ -75,14 +82,146 @@ void plp_mat_mult_f32p_xpulpv2(void *args) {
             pDstC[m * O + o] = sum;
         }
     }
+}
 
 #else
 
-    // TODO: Hackathon
+void plp_mat_mult_f32p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_mat_mult_instance_f32 *a = (plp_mat_mult_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+
+    uint32_t m, n, o, t;
+
+    uint32_t M4 = M & ~3U;                 // rows covered by 4x2 tiles
+    uint32_t tilesPerRow4 = (O + 1) >> 1;  // 4x2 tiles per block of 4 rows
+    uint32_t tilesPerRow1 = (O + 3) >> 2;  // 1x4 tiles per remaining row
+    uint32_t nTiles4 = (M4 >> 2) * tilesPerRow4;
+    uint32_t nTiles = nTiles4 + (M - M4) * tilesPerRow1;
+
+    for (t = core_id; t < nTiles; t += nPE) {
+
+        if (t < nTiles4) {
+
+            m = (t / tilesPerRow4) << 2;
+            o = (t % tilesPerRow4) << 1;
+
+            const float *__restrict__ pA0 = pSrcA + m * N;
+            const float *__restrict__ pA1 = pA0 + N;
+            const float *__restrict__ pA2 = pA1 + N;
+            const float *__restrict__ pA3 = pA2 + N;
+            const float *__restrict__ pB = pSrcB + o;
+            float *__restrict__ pC = pDstC + m * O + o;
+
+            if (o + 1 < O) {
+                float sum00 = 0, sum01 = 0;
+                float sum10 = 0, sum11 = 0;
+                float sum20 = 0, sum21 = 0;
+                float sum30 = 0, sum31 = 0;
+
+                for (n = 0; n < N; n++) {
+                    float b0 = pB[0];
+                    float b1 = pB[1];
+                    float a0 = pA0[n];
+                    float a1 = pA1[n];
+                    float a2 = pA2[n];
+                    float a3 = pA3[n];
+                    pB += O;
+
+                    sum00 += a0 * b0;
+                    sum01 += a0 * b1;
+                    sum10 += a1 * b0;
+                    sum11 += a1 * b1;
+                    sum20 += a2 * b0;
+                    sum21 += a2 * b1;
+                    sum30 += a3 * b0;
+                    sum31 += a3 * b1;
+                }
+
+                pC[0] = sum00;
+                pC[1] = sum01;
+                pC[O] = sum10;
+                pC[O + 1] = sum11;
+                pC[2 * O] = sum20;
+                pC[2 * O + 1] = sum21;
+                pC[3 * O] = sum30;
+                pC[3 * O + 1] = sum31;
+            } else {
+                // last column if O is odd
+                float sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+                for (n = 0; n < N; n++) {
+                    float b0 = *pB;
+                    pB += O;
+
+                    sum0 += pA0[n] * b0;
+                    sum1 += pA1[n] * b0;
+                    sum2 += pA2[n] * b0;
+                    sum3 += pA3[n] * b0;
+                }
+
+                pC[0] = sum0;
+                pC[O] = sum1;
+                pC[2 * O] = sum2;
+                pC[3 * O] = sum3;
+            }
+
+        } else {
+
+            m = M4 + (t - nTiles4) / tilesPerRow1;
+            o = ((t - nTiles4) % tilesPerRow1) << 2;
+
+            const float *__restrict__ pA = pSrcA + m * N;
+            const float *__restrict__ pB = pSrcB + o;
+            float *__restrict__ pC = pDstC + m * O + o;
+
+            if (o + 3 < O) {
+                float sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+                for (n = 0; n < N; n++) {
+                    float a0 = pA[n];
+                    float b0 = pB[0];
+                    float b1 = pB[1];
+                    float b2 = pB[2];
+                    float b3 = pB[3];
+                    pB += O;
+
+                    sum0 += a0 * b0;
+                    sum1 += a0 * b1;
+                    sum2 += a0 * b2;
+                    sum3 += a0 * b3;
+                }
+
+                pC[0] = sum0;
+                pC[1] = sum1;
+                pC[2] = sum2;
+                pC[3] = sum3;
+            } else {
+                // last (up to 3) columns
+                uint32_t k;
+                for (k = 0; k < O - o; k++) {
+                    float sum = 0;
+                    for (n = 0; n < N; n++) {
+                        sum += pA[n] * pB[n * O + k];
+                    }
+                    pC[k] = sum;
+                }
+            }
+        }
+    }
+}
 
 #endif
 #undef BASIC_VERSION
-}
 
 /**
    @} end of BasicMatMultKernels group
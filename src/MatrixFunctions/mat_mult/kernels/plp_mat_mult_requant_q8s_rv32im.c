@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_q8s_rv32im.c
+ * Description:  8-bit matrix multiplication with requantization kernel for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of 8-bit matrices with per-channel requantization kernel for
+         RV32IM extension.
+  @param[in]  pSrcA     points to the first input matrix of shape MxN (activations)
+  @param[in]  pSrcB     points to the second input matrix of shape NxO (weights)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix, i.e. number of output channels
+  @param[in]  pBias     points to the O biases in accumulator scale, may be NULL
+  @param[in]  pMult     points to the O multipliers
+  @param[in]  pShift    points to the O right shifts
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_requant_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     const int32_t *__restrict__ pBias,
+                                     const int32_t *__restrict__ pMult,
+                                     const uint32_t *__restrict__ pShift,
+                                     int8_t *__restrict__ pDstC) {
+
+    uint32_t i, j, k;
+
+    for (k = 0; k < O; k++) {
+        int32_t bias = pBias != NULL ? pBias[k] : 0;
+        for (i = 0; i < M; i++) {
+            int32_t sum = 0;
+            for (j = 0; j < N; j++) {
+                sum += pSrcA[i * N + j] * pSrcB[j * O + k];
+            }
+            sum = (sum + bias) * pMult[k];
+            if (pShift[k] > 0) {
+                sum = (sum + (1 << (pShift[k] - 1))) >> pShift[k];
+            }
+            pDstC[i * O + k] = (int8_t)(sum > 127 ? 127 : (sum < -128 ? -128 : sum));
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
@@ -0,0 +1,171 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_q8s_xpulpv2.c
+ * Description:  8-bit matrix multiplication with requantization kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+HAL_CL_L1 static v4s mask0 = { 0, 1, 4, 5 };
+HAL_CL_L1 static v4s mask1 = { 2, 3, 6, 7 };
+HAL_CL_L1 static v4s mask2 = { 0, 2, 4, 6 };
+HAL_CL_L1 static v4s mask3 = { 1, 3, 5, 7 };
+
+/* requantization of the accumulator of the c-th column of the current block of 4 columns */
+#define REQUANT(acc, c) ((int8_t)__CLIP(__ROUNDNORM_REG(((acc) + bias[c]) * mult[c], shift[c]), 7))
+
+/**
+  @brief Matrix multiplication of 8-bit matrices with per-channel requantization kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix of shape MxN (activations)
+  @param[in]  pSrcB     points to the second input matrix of shape NxO (weights)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix, i.e. number of output channels
+  @param[in]  pBias     points to the O biases in accumulator scale, may be NULL
+  @param[in]  pMult     points to the O multipliers
+  @param[in]  pShift    points to the O right shifts
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par
+  Blocks of 2 rows x 4 columns are accumulated with pv.sdotsp.b like in plp_mat_mult_i8s_xpulpv2,
+  and requantized with p.addRN and p.clip before they are stored, so that the 32-bit accumulators
+  never leave the registers.
+ */
+
+void plp_mat_mult_requant_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const int32_t *__restrict__ pBias,
+                                      const int32_t *__restrict__ pMult,
+                                      const uint32_t *__restrict__ pShift,
+                                      int8_t *__restrict__ pDstC) {
+
+    uint32_t i, j, k, c;
+    uint32_t N4 = N & ~3U;
+    uint32_t O4 = O & ~3U;
+    int32_t bias[4], mult[4];
+    uint32_t shift[4];
+
+    for (k = 0; k < O4; k += 4) {
+
+        // the requantization parameters of the 4 output channels are loaded once per block
+        for (c = 0; c < 4; c++) {
+            bias[c] = pBias != NULL ? pBias[k + c] : 0;
+            mult[c] = pMult[k + c];
+            shift[c] = pShift[k + c];
+        }
+
+        for (i = 0; i < M; i += 2) {
+            // the last row of an odd M is computed twice, once as its own pair
+            uint32_t i1 = i + 1 < M ? i + 1 : i;
+            const int8_t *pA0 = pSrcA + i * N;
+            const int8_t *pA1 = pSrcA + i1 * N;
+
+            int32_t sum00 = 0, sum01 = 0, sum02 = 0, sum03 = 0;
+            int32_t sum10 = 0, sum11 = 0, sum12 = 0, sum13 = 0;
+
+            for (j = 0; j < N4; j += 4) {
+                v4s aVec0 = *((v4s *)&pA0[j]);
+                v4s aVec1 = *((v4s *)&pA1[j]);
+
+                v4s temp0 = *((v4s *)&pSrcB[j * O + k]);
+                v4s temp1 = *((v4s *)&pSrcB[(j + 1) * O + k]);
+                v4s temp2 = *((v4s *)&pSrcB[(j + 2) * O + k]);
+                v4s temp3 = *((v4s *)&pSrcB[(j + 3) * O + k]);
+
+                v4s temp4 = __builtin_shuffle(temp0, temp1, mask0); // 0,1,4,5
+                v4s temp5 = __builtin_shuffle(temp2, temp3, mask0); // 8,9,12,13
+                v4s temp6 = __builtin_shuffle(temp0, temp1, mask1); // 2,3,6,7
+                v4s temp7 = __builtin_shuffle(temp2, temp3, mask1); // 10,11,14,15
+
+                v4s bVec0 = __builtin_shuffle(temp4, temp5, mask2); // 0,4,8,12
+                v4s bVec1 = __builtin_shuffle(temp4, temp5, mask3); // 1,5,9,13
+                v4s bVec2 = __builtin_shuffle(temp6, temp7, mask2); // 2,6,10,14
+                v4s bVec3 = __builtin_shuffle(temp6, temp7, mask3); // 3,7,11,15
+
+                sum00 = __SUMDOTP4(aVec0, bVec0, sum00);
+                sum01 = __SUMDOTP4(aVec0, bVec1, sum01);
+                sum02 = __SUMDOTP4(aVec0, bVec2, sum02);
+                sum03 = __SUMDOTP4(aVec0, bVec3, sum03);
+                sum10 = __SUMDOTP4(aVec1, bVec0, sum10);
+                sum11 = __SUMDOTP4(aVec1, bVec1, sum11);
+                sum12 = __SUMDOTP4(aVec1, bVec2, sum12);
+                sum13 = __SUMDOTP4(aVec1, bVec3, sum13);
+            }
+
+            for (; j < N; j++) {
+                const int8_t *pB = &pSrcB[j * O + k];
+                sum00 += pA0[j] * pB[0];
+                sum01 += pA0[j] * pB[1];
+                sum02 += pA0[j] * pB[2];
+                sum03 += pA0[j] * pB[3];
+                sum10 += pA1[j] * pB[0];
+                sum11 += pA1[j] * pB[1];
+                sum12 += pA1[j] * pB[2];
+                sum13 += pA1[j] * pB[3];
+            }
+
+            pDstC[i1 * O + k] = REQUANT(sum10, 0);
+            pDstC[i1 * O + k + 1] = REQUANT(sum11, 1);
+            pDstC[i1 * O + k + 2] = REQUANT(sum12, 2);
+            pDstC[i1 * O + k + 3] = REQUANT(sum13, 3);
+            pDstC[i * O + k] = REQUANT(sum00, 0);
+            pDstC[i * O + k + 1] = REQUANT(sum01, 1);
+            pDstC[i * O + k + 2] = REQUANT(sum02, 2);
+            pDstC[i * O + k + 3] = REQUANT(sum03, 3);
+        }
+    }
+
+    // remaining columns
+    for (k = O4; k < O; k += 1) {
+        bias[0] = pBias != NULL ? pBias[k] : 0;
+        mult[0] = pMult[k];
+        shift[0] = pShift[k];
+        for (i = 0; i < M; i++) {
+            int32_t sum = 0;
+            for (j = 0; j < N; j++) {
+                sum += pSrcA[i * N + j] * pSrcB[j * O + k];
+            }
+            pDstC[i * O + k] = REQUANT(sum, 0);
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_q8_requant_parallel.c
+ * Description:  8-bit quantized parallel matrix multiplication with requantization glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix multiplication of 8-bit matrices with per-channel
+         requantization.
+  @param[in]  pSrcA     points to the first input matrix of shape MxN (activations)
+  @param[in]  pSrcB     points to the second input matrix of shape NxO (weights)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix, i.e. number of output channels
+  @param[in]  pBias     points to the O biases in accumulator scale, may be NULL
+  @param[in]  pMult     points to the O multipliers
+  @param[in]  pShift    points to the O right shifts
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Requantization
+  Every output element is computed in one pass from the 32-bit accumulator of its column o:
+  <pre>
+      pDstC[m, o] = clip8(((sum_n pSrcA[m, n] * pSrcB[n, o]) + pBias[o]) * pMult[o] >> pShift[o])
+  </pre>
+  where the right shift rounds to nearest and clip8 saturates to [-128, 127]. The product with
+  the multiplier is computed in 32 bits, choose pMult such that it does not overflow.
+ */
+
+void plp_mat_mult_q8_requant_parallel(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const int32_t *__restrict__ pBias,
+                                      const int32_t *__restrict__ pMult,
+                                      const uint32_t *__restrict__ pShift,
+                                      uint32_t nPE,
+                                      int8_t *__restrict__ pDstC) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_requant_instance_q8 args = { .pSrcA = pSrcA,
+                                                  .pSrcB = pSrcB,
+                                                  .M = M,
+                                                  .N = N,
+                                                  .O = O,
+                                                  .pBias = pBias,
+                                                  .pMult = pMult,
+                                                  .pShift = pShift,
+                                                  .nPE = nPE,
+                                                  .pDstC = pDstC };
+        hal_cl_team_fork(nPE, plp_mat_mult_requant_q8p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicMatMult group
+ */
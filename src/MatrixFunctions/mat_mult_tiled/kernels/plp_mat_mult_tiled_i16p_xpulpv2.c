@@ -0,0 +1,174 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_tiled_i16p_xpulpv2.c
+ * Description:  16-bit integer tiled matrix multiplication kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultTiled
+ */
+
+/**
+  @addtogroup MatMultTiledKernels
+  @{
+ */
+
+/* position and size of the tiles of A, B and C used in one step */
+typedef struct {
+    uint32_t m0, n0, o0; // first row of A and C, column of A and row of B, column of B and C
+    uint32_t tm, tn, to; // size of the tiles
+    uint32_t kt;         // index of the tile along N
+    uint32_t tile;       // index of the tile of C
+} tiled_step;
+
+static void tiled_step_get(const plp_mat_mult_tiled_instance_i16 *a,
+                           uint32_t s,
+                           tiled_step *p) {
+    uint32_t nTilesN = (a->N + PLP_MAT_MULT_TILE_N - 1) / PLP_MAT_MULT_TILE_N;
+    uint32_t nTilesO = (a->O + PLP_MAT_MULT_TILE_O - 1) / PLP_MAT_MULT_TILE_O;
+
+    p->kt = s % nTilesN;
+    p->tile = s / nTilesN;
+    p->m0 = (p->tile / nTilesO) * PLP_MAT_MULT_TILE_M;
+    p->n0 = p->kt * PLP_MAT_MULT_TILE_N;
+    p->o0 = (p->tile % nTilesO) * PLP_MAT_MULT_TILE_O;
+    p->tm = a->M - p->m0 < PLP_MAT_MULT_TILE_M ? a->M - p->m0 : PLP_MAT_MULT_TILE_M;
+    p->tn = a->N - p->n0 < PLP_MAT_MULT_TILE_N ? a->N - p->n0 : PLP_MAT_MULT_TILE_N;
+    p->to = a->O - p->o0 < PLP_MAT_MULT_TILE_O ? a->O - p->o0 : PLP_MAT_MULT_TILE_O;
+}
+
+/* start the transfers of the tiles of A and B of step s into the buffers s % 2 */
+static void tiled_load(const plp_mat_mult_tiled_instance_i16 *a,
+                       uint32_t s,
+                       hal_cl_dma_cmd_t *cmdA,
+                       hal_cl_dma_cmd_t *cmdB) {
+    tiled_step p;
+    uint32_t buf = s & 1;
+
+    tiled_step_get(a, s, &p);
+    hal_cl_dma_cmd_2d((uintptr_t)(a->pSrcA + p.m0 * a->N + p.n0), (uintptr_t)a->pBufA[buf],
+                      p.tm * p.tn * sizeof(int16_t), a->N * sizeof(int16_t), p.tn * sizeof(int16_t),
+                      HAL_CL_DMA_DIR_EXT2LOC, 0, &cmdA[buf]);
+    hal_cl_dma_cmd_2d((uintptr_t)(a->pSrcB + p.n0 * a->O + p.o0), (uintptr_t)a->pBufB[buf],
+                      p.tn * p.to * sizeof(int16_t), a->O * sizeof(int16_t), p.to * sizeof(int16_t),
+                      HAL_CL_DMA_DIR_EXT2LOC, 0, &cmdB[buf]);
+}
+
+/**
+  @brief Parallel tiled matrix multiplication of 16-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_mult_tiled_instance_i16 struct initialized by
+                    plp_mat_mult_tiled_i16_parallel
+  @return     none
+
+  @par
+  Core 0 issues and waits for all DMA transfers. In every step, all cores multiply the current
+  tiles with plp_mat_mult_i16p_xpulpv2, while the tiles of the next step are transferred. Along N,
+  the partial products are accumulated into the tile of C.
+ */
+
+void plp_mat_mult_tiled_i16p_xpulpv2(void *args) {
+
+    plp_mat_mult_tiled_instance_i16 *a = (plp_mat_mult_tiled_instance_i16 *)args;
+
+    uint32_t core_id = hal_core_id();
+    uint32_t nPE = a->nPE;
+    uint32_t nTilesN = (a->N + PLP_MAT_MULT_TILE_N - 1) / PLP_MAT_MULT_TILE_N;
+    uint32_t nTilesO = (a->O + PLP_MAT_MULT_TILE_O - 1) / PLP_MAT_MULT_TILE_O;
+    uint32_t nTilesM = (a->M + PLP_MAT_MULT_TILE_M - 1) / PLP_MAT_MULT_TILE_M;
+    uint32_t nSteps = nTilesM * nTilesO * nTilesN;
+
+    // only used by core 0
+    hal_cl_dma_cmd_t cmdA[2], cmdB[2], cmdC[2];
+    uint32_t busyC[2] = { 0, 0 };
+
+    tiled_step p;
+    uint32_t s, i, cnt, chunk, start, end;
+
+    if (core_id == 0 && nSteps > 0) {
+        tiled_load(a, 0, cmdA, cmdB);
+    }
+
+    for (s = 0; s < nSteps; s++) {
+        uint32_t buf = s & 1;
+
+        tiled_step_get(a, s, &p);
+        int32_t *pC = a->pBufC[p.tile & 1];
+
+        if (core_id == 0) {
+            hal_cl_dma_cmd_wait(&cmdA[buf]);
+            hal_cl_dma_cmd_wait(&cmdB[buf]);
+            // the other buffers were released by the barrier after the previous multiplication
+            if (s + 1 < nSteps) {
+                tiled_load(a, s + 1, cmdA, cmdB);
+            }
+            // the buffer of C is free once the tile computed two tiles before is written back
+            if (p.kt == 0 && busyC[p.tile & 1]) {
+                hal_cl_dma_cmd_wait(&cmdC[p.tile & 1]);
+                busyC[p.tile & 1] = 0;
+            }
+        }
+        hal_team_barrier();
+
+        plp_mat_mult_instance_i16 mult = {
+            .pSrcA = a->pBufA[buf], .pSrcB = a->pBufB[buf], .M = p.tm, .N = p.tn, .O = p.to,
+            .nPE = nPE, .pDstC = p.kt == 0 ? pC : a->pTmp
+        };
+        plp_mat_mult_i16p_xpulpv2(&mult);
+        hal_team_barrier();
+
+        if (p.kt > 0) {
+            cnt = p.tm * p.to;
+            chunk = (cnt + nPE - 1) / nPE;
+            start = core_id * chunk;
+            end = start + chunk < cnt ? start + chunk : cnt;
+            for (i = start; i < end; i++) {
+                pC[i] += a->pTmp[i];
+            }
+            hal_team_barrier();
+        }
+
+        if (p.kt == nTilesN - 1 && core_id == 0) {
+            hal_cl_dma_cmd_2d((uintptr_t)(a->pDstC + p.m0 * a->O + p.o0), (uintptr_t)pC,
+                              p.tm * p.to * sizeof(int32_t), a->O * sizeof(int32_t),
+                              p.to * sizeof(int32_t), HAL_CL_DMA_DIR_LOC2EXT, 0, &cmdC[p.tile & 1]);
+            busyC[p.tile & 1] = 1;
+        }
+    }
+
+    if (core_id == 0) {
+        for (i = 0; i < 2; i++) {
+            if (busyC[i]) {
+                hal_cl_dma_cmd_wait(&cmdC[i]);
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatMultTiledKernels group
+ */
@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_tiled_i16_parallel.c
+ * Description:  16-bit integer tiled matrix multiplication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultTiled
+  @{
+ */
+
+/**
+  @brief Glue code for tiled matrix multiplication of 16-bit integer matrices in L2.
+  @param[in]  pSrcA     points to the first input matrix in L2
+  @param[in]  pSrcB     points to the second input matrix in L2
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstC     points to the output matrix in L2
+  @return     none
+ */
+
+void plp_mat_mult_tiled_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    uint32_t sizeA = PLP_MAT_MULT_TILE_M * PLP_MAT_MULT_TILE_N * sizeof(int16_t);
+    uint32_t sizeB = PLP_MAT_MULT_TILE_N * PLP_MAT_MULT_TILE_O * sizeof(int16_t);
+    uint32_t sizeC = PLP_MAT_MULT_TILE_M * PLP_MAT_MULT_TILE_O * sizeof(int32_t);
+    uint32_t size = 2 * sizeA + 2 * sizeB + (N > PLP_MAT_MULT_TILE_N ? 3 : 2) * sizeC;
+    uint8_t *pBuf = plp_scratch_alloc(size);
+
+    if (pBuf == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    plp_mat_mult_tiled_instance_i16 args = {
+        .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
+    };
+    args.pBufC[0] = (int32_t *)pBuf;
+    args.pBufC[1] = (int32_t *)(pBuf + sizeC);
+    args.pTmp = N > PLP_MAT_MULT_TILE_N ? (int32_t *)(pBuf + 2 * sizeC) : NULL;
+    pBuf += (N > PLP_MAT_MULT_TILE_N ? 3 : 2) * sizeC;
+    args.pBufA[0] = (int16_t *)pBuf;
+    args.pBufA[1] = (int16_t *)(pBuf + sizeA);
+    args.pBufB[0] = (int16_t *)(pBuf + 2 * sizeA);
+    args.pBufB[1] = (int16_t *)(pBuf + 2 * sizeA + sizeB);
+
+    hal_cl_team_fork(nPE, plp_mat_mult_tiled_i16p_xpulpv2, (void *)&args);
+
+    plp_scratch_free(args.pBufC[0], size);
+}
+
+/**
+  @} end of MatMultTiled group
+ */
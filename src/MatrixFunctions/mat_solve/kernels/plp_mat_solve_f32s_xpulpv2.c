@@ -0,0 +1,131 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_f32s_xpulpv2.c
+ * Description:  linear system solve kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolve
+ */
+
+/**
+  @defgroup MatSolveKernels linear system solve kernels
+  This module contains the kernel functions for solving systems of linear equations.
+
+  @par Algorithm
+  Gaussian elimination with partial pivoting reduces A to an upper triangular matrix, applying the
+  same row operations to B. The solution is then computed by back substitution with the upper
+  triangular solve kernels. Elements of A below the diagonal are not cleared.
+ */
+
+/**
+  @addtogroup MatSolveKernels
+  @{
+ */
+
+/**
+  @brief Solve a system of 32-bit floating-point linear equations, kernel for XPULPV2 extension.
+  @param[in]  pSrcA Points to the matrix of shape NxN. pSrcA is modified by this function
+  @param[in]  pSrcB Points to the right-hand side matrix of shape NxK. pSrcB is modified by this
+                    function
+  @param[in]  N     Width and height of pSrcA
+  @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+  @param[out] pDstX Points to the solution matrix of shape NxK
+  @return     0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_solve_f32s_xpulpv2(float *__restrict__ pSrcA,
+                               float *__restrict__ pSrcB,
+                               uint32_t N,
+                               uint32_t K,
+                               float *__restrict__ pDstX) {
+
+    uint32_t i, j, c, l, p;
+
+    for (l = 0; l < N; l++) {
+
+        /* Pivot search */
+        float pivot = pSrcA[l * N + l];
+        float pivotAbs = pivot < 0.0f ? -pivot : pivot;
+        p = l;
+        for (i = l + 1; i < N; i++) {
+            float val = pSrcA[i * N + l];
+            float valAbs = val < 0.0f ? -val : val;
+            if (valAbs > pivotAbs) {
+                pivot = val;
+                pivotAbs = valAbs;
+                p = i;
+            }
+        }
+
+        if (pivotAbs == 0.0f) {
+            return 1;
+        }
+
+        float *pRowL = pSrcA + l * N;
+        float *pRowBL = pSrcB + l * K;
+
+        /* Exchange rows l and p of A (left of the pivot only multipliers remain) and of B */
+        if (p != l) {
+            float *pRowP = pSrcA + p * N;
+            float *pRowBP = pSrcB + p * K;
+            for (j = l; j < N; j++) {
+                float tmp = pRowP[j];
+                pRowP[j] = pRowL[j];
+                pRowL[j] = tmp;
+            }
+            for (c = 0; c < K; c++) {
+                float tmp = pRowBP[c];
+                pRowBP[c] = pRowBL[c];
+                pRowBL[c] = tmp;
+            }
+        }
+
+        /* Eliminate column l from the rows below */
+        float invPivot = 1.0f / pivot;
+        for (i = l + 1; i < N; i++) {
+            float *pRowI = pSrcA + i * N;
+            float *pRowBI = pSrcB + i * K;
+            float factor = pRowI[l] * invPivot;
+
+            if (factor != 0.0f) {
+                for (j = l + 1; j < N; j++) {
+                    pRowI[j] -= factor * pRowL[j];
+                }
+                for (c = 0; c < K; c++) {
+                    pRowBI[c] -= factor * pRowBL[c];
+                }
+            }
+        }
+    }
+
+    return plp_mat_solve_upper_triangular_f32s_xpulpv2(pSrcA, pSrcB, N, K, pDstX);
+}
+
+/**
+  @} end of MatSolveKernels group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_f32.c
+ * Description:  linear system solve glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSolve linear system solve
+  This module contains the glue code for solving systems of linear equations. The kernel codes
+  (kernels) are in the Module linear system solve Kernels.
+
+  For a non-singular matrix A of shape NxN and a matrix B of shape NxK, the matrix X of shape NxK
+  is computed, such that
+
+  \f[
+    A \cdot X = B
+  \f]
+
+  This replaces the multiplication with the inverse computed by plp_mat_inv_f32: the elimination
+  takes about N^3 / 3 multiply-accumulates instead of the N^3 of the Gauss-Jordan inversion, plus
+  N^2 K for the right-hand sides in both cases, and it is numerically more stable.
+ */
+
+/**
+  @addtogroup MatSolve
+  @{
+ */
+
+/**
+  @brief Glue code for solving a system of 32-bit floating-point linear equations.
+  @param[in]  pSrcA Points to the matrix of shape NxN. pSrcA is modified by this function
+  @param[in]  pSrcB Points to the right-hand side matrix of shape NxK. pSrcB is modified by this
+                    function
+  @param[in]  N     Width and height of pSrcA
+  @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+  @param[out] pDstX Points to the solution matrix of shape NxK
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+
+  @par This function will use plp_mat_solve_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_solve_f32(float *__restrict__ pSrcA,
+                      float *__restrict__ pSrcB,
+                      uint32_t N,
+                      uint32_t K,
+                      float *__restrict__ pDstX) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_solve_f32s_xpulpv2(pSrcA, pSrcB, N, K, pDstX);
+    }
+}
+
+/**
+  @} end of MatSolve group
+ */
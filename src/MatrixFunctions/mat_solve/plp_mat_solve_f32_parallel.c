@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_f32_parallel.c
+ * Description:  parallel linear system solve glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSolve
+  @{
+ */
+
+/**
+  @brief Glue code for solving a system of 32-bit floating-point linear equations in parallel.
+  @param[in]  pSrcA Points to the matrix of shape NxN. pSrcA is modified by this function
+  @param[in]  pSrcB Points to the right-hand side matrix of shape NxK. pSrcB is modified by this
+                    function
+  @param[in]  N     Width and height of pSrcA
+  @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstX Points to the solution matrix of shape NxK
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+ */
+
+int plp_mat_solve_f32_parallel(float *__restrict__ pSrcA,
+                               float *__restrict__ pSrcB,
+                               uint32_t N,
+                               uint32_t K,
+                               uint32_t nPE,
+                               float *__restrict__ pDstX) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+        float pivotVal[hal_cl_nb_pe_cores()];
+        uint32_t pivotIdx[hal_cl_nb_pe_cores()];
+
+        plp_mat_solve_instance_f32 args = { .pSrcA = pSrcA,
+                                            .pSrcB = pSrcB,
+                                            .N = N,
+                                            .K = K,
+                                            .nPE = nPE,
+                                            .pDstX = pDstX,
+                                            .pPivotVal = pivotVal,
+                                            .pPivotIdx = pivotIdx,
+                                            .ret = 0 };
+
+        hal_cl_team_fork(nPE, plp_mat_solve_f32p_xpulpv2, (void *)&args);
+
+        return args.ret;
+    }
+}
+
+/**
+  @} end of MatSolve group
+ */
@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_lower_triangular_f32p_xpulpv2.c
+ * Description:  parallel lower triangular solve kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolveTriangular
+ */
+
+/**
+  @addtogroup MatSolveTriangularKernels
+  @{
+ */
+
+/**
+   @brief Parallel solve of a lower triangular system of 32-bit floating-point equations, kernel
+          for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_solve_triangular_instance_f32 struct initialized by
+                     plp_mat_solve_lower_triangular_f32_parallel. The result (0: Success, 1:
+                     Matrix is singular) is returned in its ret field.
+   @return     none
+*/
+
+void plp_mat_solve_lower_triangular_f32p_xpulpv2(void *args) {
+
+    plp_mat_solve_triangular_instance_f32 *a = (plp_mat_solve_triangular_instance_f32 *)args;
+
+    const float *__restrict__ pSrcL = a->pSrcT;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t N = a->N;
+    uint32_t K = a->K;
+    uint8_t unitDiag = a->unitDiag;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstX = a->pDstX;
+
+    uint32_t core_id = hal_core_id();
+
+    uint32_t i, r, c;
+
+    /* Every core checks the whole diagonal, such that all of them return together */
+    if (!unitDiag) {
+        for (i = 0; i < N; i++) {
+            if (pSrcL[i * N + i] == 0.0f) {
+                if (core_id == 0) {
+                    a->ret = 1;
+                }
+                return;
+            }
+        }
+    }
+
+    for (r = core_id; r < N; r += nPE) {
+        for (c = 0; c < K; c++) {
+            pDstX[r * K + c] = pSrcB[r * K + c];
+        }
+    }
+
+    hal_team_barrier();
+
+    /* Subtract the contribution of row i from the rows below, split over the rows. Row i is
+       final, but not yet divided by its diagonal element. */
+    for (i = 0; i + 1 < N; i++) {
+        const float *pRowX = pDstX + i * K;
+        float invDiag = unitDiag ? 1.0f : 1.0f / pSrcL[i * N + i];
+        for (r = i + 1 + core_id; r < N; r += nPE) {
+            float factor = pSrcL[r * N + i] * invDiag;
+            if (factor != 0.0f) {
+                for (c = 0; c < K; c++) {
+                    pDstX[r * K + c] -= factor * pRowX[c];
+                }
+            }
+        }
+        hal_team_barrier();
+    }
+
+    if (!unitDiag) {
+        for (r = core_id; r < N; r += nPE) {
+            float invDiag = 1.0f / pSrcL[r * N + r];
+            for (c = 0; c < K; c++) {
+                pDstX[r * K + c] *= invDiag;
+            }
+        }
+
+        hal_team_barrier();
+    }
+}
+
+/**
+  @} end of MatSolveTriangularKernels group
+ */
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_lower_triangular_f32s_xpulpv2.c
+ * Description:  lower triangular solve kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolveTriangular
+ */
+
+/**
+  @defgroup MatSolveTriangularKernels triangular solve kernels
+  This module contains the kernel functions for solving triangular systems of linear equations.
+
+  @par Algorithm
+  Forward substitution for lower triangular and back substitution for upper triangular matrices.
+  The parallel kernels subtract the contribution of every solved row from all remaining rows,
+  split over the rows, and divide by the diagonal at the end. With a unit diagonal, the lower
+  triangular kernels skip the divisions.
+ */
+
+/**
+  @addtogroup MatSolveTriangularKernels
+  @{
+ */
+
+/**
+  @brief Solve a lower triangular system of 32-bit floating-point equations by forward
+         substitution, kernel for XPULPV2 extension.
+  @param[in]  pSrcL Points to the lower triangular matrix of shape NxN
+  @param[in]  pSrcB Points to the right-hand side matrix of shape NxK
+  @param[in]  N     Width and height of the triangular matrix
+  @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+  @param[in]  unitDiag 1: The diagonal of pSrcL is not read and taken as one, 0: pSrcL has a
+                       general diagonal
+  @param[out] pDstX Points to the solution matrix of shape NxK
+  @return     0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_solve_lower_triangular_f32s_xpulpv2(const float *__restrict__ pSrcL,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t K,
+                                                uint8_t unitDiag,
+                                                float *__restrict__ pDstX) {
+
+    uint32_t i, k, c;
+
+    if (!unitDiag) {
+        for (i = 0; i < N; i++) {
+            if (pSrcL[i * N + i] == 0.0f) {
+                return 1;
+            }
+        }
+    }
+
+    for (i = 0; i < N; i++) {
+        const float *pRowL = pSrcL + i * N;
+        float invDiag = unitDiag ? 1.0f : 1.0f / pRowL[i];
+        for (c = 0; c < K; c++) {
+            float sum = pSrcB[i * K + c];
+            for (k = 0; k < i; k++) {
+                sum -= pRowL[k] * pDstX[k * K + c];
+            }
+            pDstX[i * K + c] = sum * invDiag;
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatSolveTriangularKernels group
+ */
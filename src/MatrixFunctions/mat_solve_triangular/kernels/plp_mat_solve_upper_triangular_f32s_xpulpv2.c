@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_upper_triangular_f32s_xpulpv2.c
+ * Description:  upper triangular solve kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolveTriangular
+ */
+
+/**
+  @addtogroup MatSolveTriangularKernels
+  @{
+ */
+
+/**
+  @brief Solve an upper triangular system of 32-bit floating-point equations by back
+         substitution, kernel for XPULPV2 extension.
+  @param[in]  pSrcU Points to the upper triangular matrix of shape NxN
+  @param[in]  pSrcB Points to the right-hand side matrix of shape NxK
+  @param[in]  N     Width and height of the triangular matrix
+  @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+  @param[out] pDstX Points to the solution matrix of shape NxK
+  @return     0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_solve_upper_triangular_f32s_xpulpv2(const float *__restrict__ pSrcU,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t K,
+                                                float *__restrict__ pDstX) {
+
+    uint32_t i, k, c;
+
+    for (i = 0; i < N; i++) {
+        if (pSrcU[i * N + i] == 0.0f) {
+            return 1;
+        }
+    }
+
+    for (i = N; i-- > 0;) {
+        const float *pRowU = pSrcU + i * N;
+        float invDiag = 1.0f / pRowU[i];
+        for (c = 0; c < K; c++) {
+            float sum = pSrcB[i * K + c];
+            for (k = i + 1; k < N; k++) {
+                sum -= pRowU[k] * pDstX[k * K + c];
+            }
+            pDstX[i * K + c] = sum * invDiag;
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatSolveTriangularKernels group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_lower_triangular_f32.c
+ * Description:  lower triangular solve glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSolveTriangular triangular solve
+  This module contains the glue code for solving triangular systems of linear equations. The
+  kernel codes (kernels) are in the Module triangular solve Kernels.
+
+  For a lower triangular matrix L (or an upper triangular matrix U) of shape NxN and a matrix B of
+  shape NxK, the matrix X of shape NxK is computed, such that
+
+  \f[
+    L \cdot X = B \qquad \mathrm{or} \qquad U \cdot X = B
+  \f]
+
+  The columns of B are independent right-hand sides. Only the triangle of the input matrix is
+  read, such that the factors of plp_mat_cholesky_f32 and plp_mat_lu_f32 can be used in place.
+  plp_mat_lu_f32 does not store the unit diagonal of L, the diagonal elements belong to U.
+  Solving with its lower factor therefore needs unitDiag = 1, and the rows of B must be permuted
+  as returned in pPerm:
+
+  \f[
+    L \cdot Y = P \cdot B, \qquad U \cdot X = Y
+  \f]
+ */
+
+/**
+  @addtogroup MatSolveTriangular
+  @{
+ */
+
+/**
+  @brief Glue code for solving a lower triangular system of 32-bit floating-point equations.
+  @param[in]  pSrcL Points to the lower triangular matrix of shape NxN
+  @param[in]  pSrcB Points to the right-hand side matrix of shape NxK
+  @param[in]  N     Width and height of the triangular matrix
+  @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+  @param[in]  unitDiag 1: The diagonal of pSrcL is not read and taken as one, 0: pSrcL has a
+                       general diagonal
+  @param[out] pDstX Points to the solution matrix of shape NxK
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+
+  @par This function will use plp_mat_solve_lower_triangular_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_solve_lower_triangular_f32(const float *__restrict__ pSrcL,
+                                       const float *__restrict__ pSrcB,
+                                       uint32_t N,
+                                       uint32_t K,
+                                       uint8_t unitDiag,
+                                       float *__restrict__ pDstX) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_solve_lower_triangular_f32s_xpulpv2(pSrcL, pSrcB, N, K, unitDiag, pDstX);
+    }
+}
+
+/**
+  @} end of MatSolveTriangular group
+ */
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_upper_triangular_f32.c
+ * Description:  upper triangular solve glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSolveTriangular
+  @{
+ */
+
+/**
+  @brief Glue code for solving an upper triangular system of 32-bit floating-point equations.
+  @param[in]  pSrcU Points to the upper triangular matrix of shape NxN
+  @param[in]  pSrcB Points to the right-hand side matrix of shape NxK
+  @param[in]  N     Width and height of the triangular matrix
+  @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+  @param[out] pDstX Points to the solution matrix of shape NxK
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+
+  @par This function will use plp_mat_solve_upper_triangular_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_solve_upper_triangular_f32(const float *__restrict__ pSrcU,
+                                       const float *__restrict__ pSrcB,
+                                       uint32_t N,
+                                       uint32_t K,
+                                       float *__restrict__ pDstX) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_solve_upper_triangular_f32s_xpulpv2(pSrcU, pSrcB, N, K, pDstX);
+    }
+}
+
+/**
+  @} end of MatSolveTriangular group
+ */
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_upper_triangular_f32_parallel.c
+ * Description:  parallel upper triangular solve glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSolveTriangular
+  @{
+ */
+
+/**
+  @brief Glue code for solving an upper triangular system of 32-bit floating-point equations in
+         parallel.
+  @param[in]  pSrcU Points to the upper triangular matrix of shape NxN
+  @param[in]  pSrcB Points to the right-hand side matrix of shape NxK
+  @param[in]  N     Width and height of the triangular matrix
+  @param[in]  K     Number of right-hand sides, i.e. width of pSrcB and pDstX
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstX Points to the solution matrix of shape NxK
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+ */
+
+int plp_mat_solve_upper_triangular_f32_parallel(const float *__restrict__ pSrcU,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t N,
+                                                uint32_t K,
+                                                uint32_t nPE,
+                                                float *__restrict__ pDstX) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+        plp_mat_solve_triangular_instance_f32 args = { .pSrcT = pSrcU,
+                                                       .pSrcB = pSrcB,
+                                                       .N = N,
+                                                       .K = K,
+                                                       .nPE = nPE,
+                                                       .pDstX = pDstX,
+                                                       .ret = 0 };
+
+        hal_cl_team_fork(nPE, plp_mat_solve_upper_triangular_f32p_xpulpv2, (void *)&args);
+
+        return args.ret;
+    }
+}
+
+/**
+  @} end of MatSolveTriangular group
+ */
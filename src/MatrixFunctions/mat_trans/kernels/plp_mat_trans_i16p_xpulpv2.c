@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_trans.h"
 
 /**
   @ingroup MatTrans
@@ -46,8 +47,9 @@
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  If M and N are even, 2x2 tiles are loaded as two words, transposed with two shuffles and stored
+  as two words. The pairs of output rows are distributed over the cores, so that every core writes
+  contiguous rows instead of a column with stride M. pSrc and pDst have to be 4-byte aligned.
 */
 
 void plp_mat_trans_i16p_xpulpv2(void *args) {
@@ -62,21 +64,29 @@ void plp_mat_trans_i16p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int16_t *__restrict__ pDst = a->pDst;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
+    uint32_t m, n;
+    v2s r0, r1, c0, c1;
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
-            pDst[n * M + m] = pSrc[m * N + n];
+    if (((M | N) & 1) == 0) {
+        // every core writes pairs of output rows, 2x2 tiles are transposed in registers
+        for (n = 2 * core_id; n < N; n += 2 * nPE) {
+            for (m = 0; m < M; m += 2) {
+                r0 = *((v2s *)&pSrc[m * N + n]);
+                r1 = *((v2s *)&pSrc[(m + 1) * N + n]);
+                TRANS_2X2(r0, r1, c0, c1);
+                *((v2s *)&pDst[n * M + m]) = c0;
+                *((v2s *)&pDst[(n + 1) * M + m]) = c1;
+            }
+        }
+    } else {
+        // odd shapes: the words of a tile would not be aligned, the output rows are still
+        // written contiguously
+        for (n = core_id; n < N; n += nPE) {
+            for (m = 0; m < M; m++) {
+                pDst[n * M + m] = pSrc[m * N + n];
+            }
         }
     }
-
-#else
-
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
 }
 
 /**
@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_trans.h"
 
 /**
   @ingroup MatTrans
@@ -46,6 +47,10 @@
   @param[in]  N    Width of the input matrix and height of the output matrix
   @param[out] pDst Points to the output matrix of shape NxM
   @return     none
+
+  @par Exploiting SIMD instructions
+  If M and N are even, 2x2 tiles are loaded as two words, transposed with two shuffles and stored
+  as two words. pSrc and pDst have to be 4-byte aligned.
  */
 
 void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
@@ -53,21 +58,29 @@ void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
                                 uint32_t N,
                                 int16_t *__restrict__ pDst) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
+    uint32_t m, n;
+    v2s a, b, c0, c1;
 
-    for (int m = 0; m < M; m++) {
-        for (int n = 0; n < N; n++) {
-            pDst[n * M + m] = pSrc[m * N + n];
+    if (((M | N) & 1) == 0) {
+        // the output is written in pairs of contiguous rows, 2x2 tiles are transposed in registers
+        for (n = 0; n < N; n += 2) {
+            for (m = 0; m < M; m += 2) {
+                a = *((v2s *)&pSrc[m * N + n]);
+                b = *((v2s *)&pSrc[(m + 1) * N + n]);
+                TRANS_2X2(a, b, c0, c1);
+                *((v2s *)&pDst[n * M + m]) = c0;
+                *((v2s *)&pDst[(n + 1) * M + m]) = c1;
+            }
+        }
+    } else {
+        // odd shapes: the words of a tile would not be aligned, the output rows are still
+        // written contiguously
+        for (n = 0; n < N; n += 1) {
+            for (m = 0; m < M; m++) {
+                pDst[n * M + m] = pSrc[m * N + n];
+            }
         }
     }
-
-#else
-
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
 }
 /**
    @} end of MatTransKernels group
@@ -44,6 +44,10 @@
   @param[in]  args  pointer to plp_mat_trans_instance_i32 struct initialized by
                     plp_mat_trans_i32_parallel
   @return     none
+
+  @par Tiling
+  The blocks of four output rows are distributed over the cores and filled from 4x4 tiles, so
+  that every core writes contiguous rows instead of a column with stride M.
  */
 
 void plp_mat_trans_i32p_xpulpv2(void *args) {
@@ -58,21 +62,21 @@ void plp_mat_trans_i32p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int32_t *__restrict__ pDst = a->pDst;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
+    uint32_t m, n, i, nb;
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
-            pDst[n * M + m] = pSrc[m * N + n];
+    // every core writes a block of four output rows at a time, for every four input rows the
+    // 4x4 tile is read row by row and written column by column
+    for (nb = core_id * 4; nb < N; nb += nPE * 4) {
+        uint32_t nEnd = nb + 4 < N ? nb + 4 : N;
+        for (m = 0; m < M; m += 4) {
+            uint32_t mEnd = m + 4 < M ? m + 4 : M;
+            for (n = nb; n < nEnd; n++) {
+                for (i = m; i < mEnd; i++) {
+                    pDst[n * M + i] = pSrc[i * N + n];
+                }
+            }
         }
     }
-
-#else
-
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
 }
 
 /**
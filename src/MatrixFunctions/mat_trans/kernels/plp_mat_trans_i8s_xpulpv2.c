@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_trans.h"
 
 /**
   @ingroup MatTrans
@@ -46,6 +47,10 @@
   @param[in]  N    Width of the input matrix and height of the output matrix
   @param[out] pDst Points to the output matrix of shape NxM
   @return     none
+
+  @par Exploiting SIMD instructions
+  If M and N are multiples of 4, 4x4 tiles are loaded as four words, transposed with eight
+  shuffles and stored as four words. pSrc and pDst have to be 4-byte aligned.
  */
 
 void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
@@ -53,21 +58,34 @@ void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
                                uint32_t N,
                                int8_t *__restrict__ pDst) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
+    uint32_t m, n;
+    v4s r0, r1, r2, r3;
 
-    for (int m = 0; m < M; m++) {
-        for (int n = 0; n < N; n++) {
-            pDst[n * M + m] = pSrc[m * N + n];
+    if (((M | N) & 3) == 0) {
+        // the output is written in blocks of four contiguous rows, 4x4 tiles are transposed in
+        // registers
+        for (n = 0; n < N; n += 4) {
+            for (m = 0; m < M; m += 4) {
+                r0 = *((v4s *)&pSrc[m * N + n]);
+                r1 = *((v4s *)&pSrc[(m + 1) * N + n]);
+                r2 = *((v4s *)&pSrc[(m + 2) * N + n]);
+                r3 = *((v4s *)&pSrc[(m + 3) * N + n]);
+                TRANS_4X4(r0, r1, r2, r3);
+                *((v4s *)&pDst[n * M + m]) = r0;
+                *((v4s *)&pDst[(n + 1) * M + m]) = r1;
+                *((v4s *)&pDst[(n + 2) * M + m]) = r2;
+                *((v4s *)&pDst[(n + 3) * M + m]) = r3;
+            }
+        }
+    } else {
+        // shapes which are not a multiple of the tile: the words of a tile would not be aligned,
+        // the output rows are still written contiguously
+        for (n = 0; n < N; n += 1) {
+            for (m = 0; m < M; m++) {
+                pDst[n * M + m] = pSrc[m * N + n];
+            }
         }
     }
-
-#else
-
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
 }
 /**
    @} end of MatTransKernels group
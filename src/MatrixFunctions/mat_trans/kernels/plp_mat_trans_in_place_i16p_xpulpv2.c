@@ -0,0 +1,109 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_in_place_i16p_xpulpv2.c
+ * Description:  parallel 16-bit integer in-place square matrix transpose for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_trans.h"
+
+/**
+  @ingroup MatTrans
+ */
+
+/**
+  @addtogroup MatTransKernels
+  @{
+ */
+
+/**
+  @brief Parallel in-place transpose of a square 16-bit integer matrix kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_trans_in_place_instance_i16 struct initialized by
+                    plp_mat_trans_in_place_i16_parallel
+  @return     none
+
+  @par
+  Every core swaps the tiles of its rows of the upper triangle with their mirror tiles. The
+  rows touch disjoint parts of the matrix, hence no synchronization is needed.
+
+  @par Exploiting SIMD instructions
+  If N is a multiple of 2, the rows are processed in 2x2 tiles, which are loaded as 2 words and
+  transposed with 2 shuffles. pSrcDst has to be 4-byte aligned.
+ */
+
+void plp_mat_trans_in_place_i16p_xpulpv2(void *args) {
+
+    uint32_t core_id = hal_core_id();
+
+    plp_mat_trans_in_place_instance_i16 *a = (plp_mat_trans_in_place_instance_i16 *)args;
+
+    int16_t *__restrict__ pSrcDst = a->pSrcDst;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+
+    uint32_t i, j;
+    int16_t tmp;
+    v2s t0, t1, t2, t3, a0, a1, c0, c1;
+
+    if ((N & 1) == 0) {
+        // the tile on the diagonal is transposed in place, every other tile of the upper triangle
+        // is swapped with its mirror tile, both transposed in registers
+        for (i = 0; i < N; i += 2) {
+            if (!OWNS_ROW(i / 2, core_id, nPE))
+                continue;
+            t0 = *((v2s *)&pSrcDst[i * N + i]);
+            t1 = *((v2s *)&pSrcDst[(i + 1) * N + i]);
+            TRANS_2X2(t0, t1, c0, c1);
+            *((v2s *)&pSrcDst[i * N + i]) = c0;
+            *((v2s *)&pSrcDst[(i + 1) * N + i]) = c1;
+            for (j = i + 2; j < N; j += 2) {
+                t0 = *((v2s *)&pSrcDst[i * N + j]);
+                t1 = *((v2s *)&pSrcDst[(i + 1) * N + j]);
+                t2 = *((v2s *)&pSrcDst[j * N + i]);
+                t3 = *((v2s *)&pSrcDst[(j + 1) * N + i]);
+                TRANS_2X2(t0, t1, a0, a1);
+                TRANS_2X2(t2, t3, c0, c1);
+                *((v2s *)&pSrcDst[i * N + j]) = c0;
+                *((v2s *)&pSrcDst[(i + 1) * N + j]) = c1;
+                *((v2s *)&pSrcDst[j * N + i]) = a0;
+                *((v2s *)&pSrcDst[(j + 1) * N + i]) = a1;
+            }
+        }
+    } else {
+        for (i = 0; i < N; i++) {
+            if (!OWNS_ROW(i, core_id, nPE))
+                continue;
+            for (j = i + 1; j < N; j++) {
+                tmp = pSrcDst[i * N + j];
+                pSrcDst[i * N + j] = pSrcDst[j * N + i];
+                pSrcDst[j * N + i] = tmp;
+            }
+        }
+    }
+}
+
+/**
+   @} end of MatTransKernels group
+*/
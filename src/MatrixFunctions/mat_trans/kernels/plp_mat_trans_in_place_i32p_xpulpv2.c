@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_in_place_i32p_xpulpv2.c
+ * Description:  parallel 32-bit integer in-place square matrix transpose for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_trans.h"
+
+/**
+  @ingroup MatTrans
+ */
+
+/**
+  @addtogroup MatTransKernels
+  @{
+ */
+
+/**
+  @brief Parallel in-place transpose of a square 32-bit integer matrix kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_trans_in_place_instance_i32 struct initialized by
+                    plp_mat_trans_in_place_i32_parallel
+  @return     none
+
+  @par
+  Every core swaps the elements of its rows of the upper triangle with their mirror elements. The
+  rows touch disjoint parts of the matrix, hence no synchronization is needed.
+ */
+
+void plp_mat_trans_in_place_i32p_xpulpv2(void *args) {
+
+    uint32_t core_id = hal_core_id();
+
+    plp_mat_trans_in_place_instance_i32 *a = (plp_mat_trans_in_place_instance_i32 *)args;
+
+    int32_t *__restrict__ pSrcDst = a->pSrcDst;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+
+    uint32_t i, j;
+    int32_t tmp;
+
+    for (i = 0; i < N; i++) {
+        if (!OWNS_ROW(i, core_id, nPE))
+            continue;
+        for (j = i + 1; j < N; j++) {
+            tmp = pSrcDst[i * N + j];
+            pSrcDst[i * N + j] = pSrcDst[j * N + i];
+            pSrcDst[j * N + i] = tmp;
+        }
+    }
+}
+
+/**
+   @} end of MatTransKernels group
+*/
@@ -0,0 +1,121 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_in_place_i8p_xpulpv2.c
+ * Description:  parallel 8-bit integer in-place square matrix transpose for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_trans.h"
+
+/**
+  @ingroup MatTrans
+ */
+
+/**
+  @addtogroup MatTransKernels
+  @{
+ */
+
+/**
+  @brief Parallel in-place transpose of a square 8-bit integer matrix kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_trans_in_place_instance_i8 struct initialized by
+                    plp_mat_trans_in_place_i8_parallel
+  @return     none
+
+  @par
+  Every core swaps the tiles of its rows of the upper triangle with their mirror tiles. The
+  rows touch disjoint parts of the matrix, hence no synchronization is needed.
+
+  @par Exploiting SIMD instructions
+  If N is a multiple of 4, the rows are processed in 4x4 tiles, which are loaded as 4 words and
+  transposed with 8 shuffles. pSrcDst has to be 4-byte aligned.
+ */
+
+void plp_mat_trans_in_place_i8p_xpulpv2(void *args) {
+
+    uint32_t core_id = hal_core_id();
+
+    plp_mat_trans_in_place_instance_i8 *a = (plp_mat_trans_in_place_instance_i8 *)args;
+
+    int8_t *__restrict__ pSrcDst = a->pSrcDst;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+
+    uint32_t i, j;
+    int8_t tmp;
+    v4s a0, a1, a2, a3, b0, b1, b2, b3;
+
+    if ((N & 3) == 0) {
+        // the tile on the diagonal is transposed in place, every other tile of the upper triangle
+        // is swapped with its mirror tile, both transposed in registers
+        for (i = 0; i < N; i += 4) {
+            if (!OWNS_ROW(i / 4, core_id, nPE))
+                continue;
+            a0 = *((v4s *)&pSrcDst[i * N + i]);
+            a1 = *((v4s *)&pSrcDst[(i + 1) * N + i]);
+            a2 = *((v4s *)&pSrcDst[(i + 2) * N + i]);
+            a3 = *((v4s *)&pSrcDst[(i + 3) * N + i]);
+            TRANS_4X4(a0, a1, a2, a3);
+            *((v4s *)&pSrcDst[i * N + i]) = a0;
+            *((v4s *)&pSrcDst[(i + 1) * N + i]) = a1;
+            *((v4s *)&pSrcDst[(i + 2) * N + i]) = a2;
+            *((v4s *)&pSrcDst[(i + 3) * N + i]) = a3;
+            for (j = i + 4; j < N; j += 4) {
+                a0 = *((v4s *)&pSrcDst[i * N + j]);
+                a1 = *((v4s *)&pSrcDst[(i + 1) * N + j]);
+                a2 = *((v4s *)&pSrcDst[(i + 2) * N + j]);
+                a3 = *((v4s *)&pSrcDst[(i + 3) * N + j]);
+                b0 = *((v4s *)&pSrcDst[j * N + i]);
+                b1 = *((v4s *)&pSrcDst[(j + 1) * N + i]);
+                b2 = *((v4s *)&pSrcDst[(j + 2) * N + i]);
+                b3 = *((v4s *)&pSrcDst[(j + 3) * N + i]);
+                TRANS_4X4(a0, a1, a2, a3);
+                TRANS_4X4(b0, b1, b2, b3);
+                *((v4s *)&pSrcDst[i * N + j]) = b0;
+                *((v4s *)&pSrcDst[(i + 1) * N + j]) = b1;
+                *((v4s *)&pSrcDst[(i + 2) * N + j]) = b2;
+                *((v4s *)&pSrcDst[(i + 3) * N + j]) = b3;
+                *((v4s *)&pSrcDst[j * N + i]) = a0;
+                *((v4s *)&pSrcDst[(j + 1) * N + i]) = a1;
+                *((v4s *)&pSrcDst[(j + 2) * N + i]) = a2;
+                *((v4s *)&pSrcDst[(j + 3) * N + i]) = a3;
+            }
+        }
+    } else {
+        for (i = 0; i < N; i++) {
+            if (!OWNS_ROW(i, core_id, nPE))
+                continue;
+            for (j = i + 1; j < N; j++) {
+                tmp = pSrcDst[i * N + j];
+                pSrcDst[i * N + j] = pSrcDst[j * N + i];
+                pSrcDst[j * N + i] = tmp;
+            }
+        }
+    }
+}
+
+/**
+   @} end of MatTransKernels group
+*/
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_arg_combine_i32p_xpulpv2.c
+ * Description:  Tree combine of the per-core partial arg-max / arg-min results
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @addtogroup argmaxKernels
+   @{
+*/
+
+/**
+   @brief         Combines the per-core partial integer arg-max / arg-min results
+                  of a team in log2(nPE) steps.
+   @details       Has to be called by every core of the team after it wrote its own partial
+                  result. In step k, core i (with i a multiple of 2^(k+1)) takes over the partial
+                  result of core i + 2^k if it is strictly better. As core i + 2^k searched the
+                  later part of the input, pPartial[0] holds the first occurrence of the extreme
+                  value when the fork returns.
+   @param[in,out] pPartial  per-core partial results, nPE entries
+   @param[in]     nPE       number of parallel processing units
+   @param[in]     isMax     1 to combine maxima, 0 to combine minima
+   @return        none
+*/
+
+void plp_arg_combine_i32p_xpulpv2(plp_arg_partial_i32 *__restrict__ pPartial,
+                                  uint32_t nPE,
+                                  uint32_t isMax) {
+
+    uint32_t core = hal_core_id();
+    uint32_t stride;
+    plp_arg_partial_i32 *a, *b;
+
+    for (stride = 1; stride < nPE; stride <<= 1) {
+        hal_team_barrier();
+
+        if ((core & ((stride << 1) - 1)) == 0 && core + stride < nPE) {
+            a = &pPartial[core];
+            b = &pPartial[core + stride];
+
+            if (b->count == 0) {
+                continue;
+            }
+            if (a->count == 0 || (isMax ? b->value > a->value : b->value < a->value)) {
+                a->value = b->value;
+                a->index = b->index;
+            }
+            a->count += b->count;
+        }
+    }
+}
+
+/**
+  @} end of argmaxKernels group
+ */
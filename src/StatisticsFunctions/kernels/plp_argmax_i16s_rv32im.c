@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argmax_i16s_rv32im.c
+ * Description:  ArgMax of a 16-bit integer vector on RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup argmax
+*/
+
+/**
+   @defgroup argmaxKernels ArgMax Kernels
+*/
+
+/**
+   @addtogroup argmaxKernels
+   @{
+*/
+
+/**
+   @brief         ArgMax of a 16-bit integer vector for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector (> 0)
+   @param[out]    pRes       maximum value returned here
+   @param[out]    pIndex     index of the first occurrence of the maximum returned here
+   @return        none
+*/
+
+void plp_argmax_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int16_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex) {
+
+    uint32_t blkCnt;
+    uint32_t bestIdx = 0;
+    int16_t best = pSrc[0];
+    int16_t x1, x2;
+
+    // strict comparisons keep the first occurrence
+    for (blkCnt = 1; blkCnt + 1 < blockSize; blkCnt += 2) {
+        x1 = pSrc[blkCnt];
+        x2 = pSrc[blkCnt + 1];
+        if (x1 > best) {
+            best = x1;
+            bestIdx = blkCnt;
+        }
+        if (x2 > best) {
+            best = x2;
+            bestIdx = blkCnt + 1;
+        }
+    }
+    if (blkCnt < blockSize && pSrc[blkCnt] > best) {
+        best = pSrc[blkCnt];
+        bestIdx = blkCnt;
+    }
+
+    *pRes = best;
+    *pIndex = bestIdx;
+}
+
+/**
+  @} end of argmaxKernels group
+ */
@@ -0,0 +1,107 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argmax_i8s_xpulpv2.c
+ * Description:  ArgMax of an 8-bit integer vector on XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup argmax
+*/
+
+/**
+   @defgroup argmaxKernels ArgMax Kernels
+*/
+
+/**
+   @addtogroup argmaxKernels
+   @{
+*/
+
+/** samples per block, reduced with packed maximum instructions before the block is compared */
+#define ARG_BLOCK 32U
+
+/**
+   @brief         ArgMax of an 8-bit integer vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector (> 0)
+   @param[out]    pRes       maximum value returned here
+   @param[out]    pIndex     index of the first occurrence of the maximum returned here
+   @return        none
+
+   @par SIMD
+   The input is processed in blocks of 32 samples, whose maximum is found with packed
+   instructions on 4 samples per word. Only a block which improves on the running
+   maximum is scanned a second time to find the index.
+   pSrc has to be 4-byte aligned.
+*/
+
+void plp_argmax_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int8_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex) {
+
+    const int8_t *pBlk = pSrc;
+    const v4s *pWord;
+    uint32_t blkCnt, i;
+    uint32_t bestIdx = 0;
+    int32_t best = pSrc[0];
+    int32_t blockBest;
+    v4s vbest;
+
+    for (blkCnt = blockSize / ARG_BLOCK; blkCnt > 0; blkCnt--) {
+        pWord = (const v4s *)pBlk;
+        vbest = pWord[0];
+        for (i = 1; i < ARG_BLOCK / 4; i++) {
+            vbest = __MAX4(vbest, pWord[i]);
+        }
+        blockBest = __MAX(__MAX(vbest[0], vbest[1]), __MAX(vbest[2], vbest[3]));
+
+        // the block is rescanned only if it holds a new maximum, which is rare for long
+        // vectors; the strict comparison keeps the first occurrence
+        if (blockBest > best) {
+            best = blockBest;
+            for (i = 0; pBlk[i] != blockBest; i++)
+                ;
+            bestIdx = (uint32_t)(pBlk - pSrc) + i;
+        }
+        pBlk += ARG_BLOCK;
+    }
+
+    for (i = (uint32_t)(pBlk - pSrc); i < blockSize; i++) {
+        if (pSrc[i] > best) {
+            best = pSrc[i];
+            bestIdx = i;
+        }
+    }
+
+    *pRes = (int8_t)best;
+    *pIndex = bestIdx;
+}
+
+/**
+  @} end of argmaxKernels group
+ */
@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argmin_i16p_xpulpv2.c
+ * Description:  Parallel argmin of a 16-bit integer vector on XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @addtogroup argminKernels
+   @{
+*/
+
+/**
+   @brief         Parallel minimum value and index of a 16-bit integer vector for XPULPV2
+                  extension.
+   @details       Every core searches a contiguous part of the input with the single core kernel,
+                  then the partial results are combined in a tree.
+   @param[in]     S  points to the instance structure (plp_arg_instance_i16_parallel)
+   @return        none
+*/
+
+void plp_argmin_i16p_xpulpv2(void *S) {
+
+    plp_arg_instance_i16_parallel *a = (plp_arg_instance_i16_parallel *)S;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 1U) & ~1U;
+    uint32_t start = hal_core_id() * chunk;
+    uint32_t end = (start + chunk < blockSize) ? start + chunk : blockSize;
+    plp_arg_partial_i32 *p = &a->pPartial[hal_core_id()];
+    int16_t value;
+
+    p->count = 0;
+    if (start < end) {
+        p->count = end - start;
+        plp_argmin_i16s_xpulpv2(a->pSrc + start, p->count, &value, &p->index);
+        p->value = value;
+        p->index += start;
+    }
+
+    plp_arg_combine_i32p_xpulpv2(a->pPartial, nPE, 0);
+}
+
+/**
+  @} end of argminKernels group
+ */
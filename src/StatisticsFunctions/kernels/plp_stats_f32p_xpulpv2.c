@@ -0,0 +1,151 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_f32p_xpulpv2.c
+ * Description:  Parallel partial statistics of a 32-bit floating point vector on XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @addtogroup statsKernels
+   @{
+*/
+
+/* mean and sum of squared deviations of one part, accumulated around its first sample */
+static void chunk_moments(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          plp_stats_partial_f32 *__restrict__ p) {
+
+    uint32_t blkCnt;
+    float32_t shift = pSrc[0];
+    float32_t sum0 = 0.0f, sum1 = 0.0f, sq0 = 0.0f, sq1 = 0.0f;
+    float32_t d0, d1, sum;
+
+    for (blkCnt = blockSize >> 1; blkCnt > 0; blkCnt--) {
+        d0 = *pSrc++ - shift;
+        d1 = *pSrc++ - shift;
+        sum0 += d0;
+        sum1 += d1;
+        sq0 += d0 * d0;
+        sq1 += d1 * d1;
+    }
+    if (blockSize & 1) {
+        d0 = *pSrc - shift;
+        sum0 += d0;
+        sq0 += d0 * d0;
+    }
+
+    sum = sum0 + sum1;
+    p->mean = shift + sum / blockSize;
+    p->m2 = sq0 + sq1 - sum * sum / blockSize;
+    if (p->m2 < 0.0f)
+        p->m2 = 0.0f;
+}
+
+/* pairwise update of Chan et al. for the mean and the sum of squared deviations */
+static void merge(plp_stats_partial_f32 *__restrict__ a,
+                  const plp_stats_partial_f32 *__restrict__ b,
+                  uint32_t flags) {
+
+    uint32_t count = a->count + b->count;
+    float32_t wb = (float32_t)b->count / count;
+    float32_t delta = b->mean - a->mean;
+
+    if (flags & (PLP_STATS_SUM | PLP_STATS_M2)) {
+        a->m2 += b->m2 + delta * delta * a->count * wb;
+        a->mean += delta * wb;
+    }
+    if (flags & PLP_STATS_POWER)
+        a->power += b->power;
+    if (flags & PLP_STATS_MIN)
+        a->min = b->min < a->min ? b->min : a->min;
+    if (flags & PLP_STATS_MAX)
+        a->max = b->max > a->max ? b->max : a->max;
+    a->count = count;
+}
+
+/**
+   @brief         Parallel partial statistics of a 32-bit floating point vector for XPULPV2
+                  extension.
+   @details       Every core reduces a contiguous part of the input, then the partial results are
+                  combined in a tree: in step k, core i (with i a multiple of 2^(k+1)) merges the
+                  partial result of core i + 2^k into its own, so that pPartial[0] holds the
+                  statistics of the whole vector when the fork returns. The mean and the variance
+                  are merged with the numerically stable update of Chan et al.
+   @param[in]     S  points to the instance structure (plp_stats_instance_f32_parallel)
+   @return        none
+*/
+
+void plp_stats_f32p_xpulpv2(void *S) {
+
+    plp_stats_instance_f32_parallel *a = (plp_stats_instance_f32_parallel *)S;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t flags = a->flags;
+    uint32_t core = hal_core_id();
+    uint32_t chunk = (blockSize + nPE - 1) / nPE;
+    uint32_t start = core * chunk;
+    uint32_t end = (start + chunk < blockSize) ? start + chunk : blockSize;
+    uint32_t stride;
+    plp_stats_partial_f32 *p = &a->pPartial[core];
+    const float32_t *pSrc = a->pSrc + start;
+
+    p->count = 0;
+    if (start < end) {
+        p->count = end - start;
+        if (flags & (PLP_STATS_SUM | PLP_STATS_M2)) {
+            chunk_moments(pSrc, p->count, p);
+        }
+        if (flags & PLP_STATS_POWER) {
+            plp_power_f32s_xpulpv2(pSrc, p->count, &p->power);
+        }
+        if (flags & PLP_STATS_MIN) {
+            plp_min_f32s_xpulpv2(pSrc, p->count, &p->min);
+        }
+        if (flags & PLP_STATS_MAX) {
+            plp_max_f32s_xpulpv2(pSrc, p->count, &p->max);
+        }
+    }
+
+    for (stride = 1; stride < nPE; stride <<= 1) {
+        hal_team_barrier();
+
+        if ((core & ((stride << 1) - 1)) == 0 && core + stride < nPE) {
+            if (a->pPartial[core + stride].count == 0) {
+                continue;
+            }
+            if (p->count == 0) {
+                *p = a->pPartial[core + stride];
+                continue;
+            }
+            merge(p, &a->pPartial[core + stride], flags);
+        }
+    }
+}
+
+/**
+  @} end of statsKernels group
+ */
@@ -0,0 +1,110 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_f32s_xpulpv2.c
+ * Description:  Fused statistics of a 32-bit floating point vector on XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup stats
+*/
+
+/**
+   @defgroup statsKernels Stats Kernels
+*/
+
+/**
+   @addtogroup statsKernels
+   @{
+*/
+
+/**
+   @brief         Fused statistics of a 32-bit floating point vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector (> 0)
+   @param[out]    pRes       mean, var, std, rms, min and max returned here
+   @return        none
+
+   @par Shifted data
+   The samples are shifted by the first sample K before they are accumulated, the variance is
+   then (sum(d^2) - sum(d)^2 / N) / N with d = x - K. Both sums are split over two accumulators
+   to break the dependency chain of the floating point adds.
+*/
+
+void plp_stats_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            plp_stats_result_f32 *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+    float32_t shift = pSrc[0];
+    float32_t sum0 = 0.0f, sum1 = 0.0f, sq0 = 0.0f, sq1 = 0.0f;
+    float32_t min = pSrc[0], max = pSrc[0];
+    float32_t x0, x1, d0, d1, sum, meanDelta, var, meanSq;
+
+    for (blkCnt = blockSize >> 1; blkCnt > 0; blkCnt--) {
+        x0 = *pSrc++;
+        x1 = *pSrc++;
+        d0 = x0 - shift;
+        d1 = x1 - shift;
+        sum0 += d0;
+        sum1 += d1;
+        sq0 += d0 * d0;
+        sq1 += d1 * d1;
+        min = x0 < min ? x0 : min;
+        max = x0 > max ? x0 : max;
+        min = x1 < min ? x1 : min;
+        max = x1 > max ? x1 : max;
+    }
+
+    if (blockSize & 1) {
+        x0 = *pSrc;
+        d0 = x0 - shift;
+        sum0 += d0;
+        sq0 += d0 * d0;
+        min = x0 < min ? x0 : min;
+        max = x0 > max ? x0 : max;
+    }
+
+    sum = sum0 + sum1;
+    meanDelta = sum / blockSize;
+    var = (sq0 + sq1 - sum * meanDelta) / blockSize;
+    if (var < 0.0f)
+        var = 0.0f;
+
+    pRes->mean = shift + meanDelta;
+    pRes->var = var;
+    pRes->min = min;
+    pRes->max = max;
+
+    // E[x^2] = var + mean^2
+    meanSq = var + pRes->mean * pRes->mean;
+    plp_sqrt_f32s_xpulpv2(&var, &pRes->std);
+    plp_sqrt_f32s_xpulpv2(&meanSq, &pRes->rms);
+}
+
+/**
+  @} end of statsKernels group
+ */
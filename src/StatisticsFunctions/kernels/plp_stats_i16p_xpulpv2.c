@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_i16p_xpulpv2.c
+ * Description:  Parallel partial statistics of a 16-bit integer vector on XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @addtogroup statsKernels
+   @{
+*/
+
+static int32_t chunk_sum(const int16_t *__restrict__ pSrc, uint32_t blockSize) {
+
+    uint32_t blkCnt;
+    int32_t sum = 0;
+    const v2s ones = { 1, 1 };
+
+    for (blkCnt = blockSize >> 1; blkCnt > 0; blkCnt--) {
+        sum = __SUMDOTP2(*((v2s *)pSrc), ones, sum);
+        pSrc += 2;
+    }
+    if (blockSize & 1) {
+        sum += *pSrc;
+    }
+
+    return sum;
+}
+
+/**
+   @brief         Parallel partial statistics of a 16-bit integer vector for XPULPV2 extension.
+   @details       Every core reduces a contiguous part of the input with the single core kernels,
+                  then the partial results are combined in a tree.
+   The parts are multiples of 2 samples, so that the SIMD kernels group the samples exactly as
+   on a single core.
+   @param[in]     S  points to the instance structure (plp_stats_instance_i16_parallel)
+   @return        none
+*/
+
+void plp_stats_i16p_xpulpv2(void *S) {
+
+    plp_stats_instance_i16_parallel *a = (plp_stats_instance_i16_parallel *)S;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t flags = a->flags;
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 1U) & ~1U;
+    uint32_t start = hal_core_id() * chunk;
+    uint32_t end = (start + chunk < blockSize) ? start + chunk : blockSize;
+    plp_stats_partial_i32 *p = &a->pPartial[hal_core_id()];
+    const int16_t *pSrc = a->pSrc + start;
+    int16_t extreme;
+
+    p->count = 0;
+    if (start < end) {
+        p->count = end - start;
+        if (flags & PLP_STATS_SUM) {
+            p->sum = chunk_sum(pSrc, p->count);
+        }
+        if (flags & PLP_STATS_POWER) {
+            plp_power_q16s_xpulpv2(pSrc, p->count, a->fracBits, &p->power);
+        }
+        if (flags & PLP_STATS_MIN) {
+            plp_min_i16s_xpulpv2(pSrc, p->count, &extreme);
+            p->min = extreme;
+        }
+        if (flags & PLP_STATS_MAX) {
+            plp_max_i16s_xpulpv2(pSrc, p->count, &extreme);
+            p->max = extreme;
+        }
+    }
+
+    plp_stats_combine_i32p_xpulpv2(a->pPartial, nPE, flags);
+}
+
+/**
+  @} end of statsKernels group
+ */
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_i16s_xpulpv2.c
+ * Description:  Fused statistics of a 16-bit integer vector on XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup stats
+*/
+
+/**
+   @defgroup statsKernels Stats Kernels
+*/
+
+/**
+   @addtogroup statsKernels
+   @{
+*/
+
+/** 2-sample words per 32-bit partial sum, 2^14 * 2^16 stays below 2^31 */
+#define STATS_I16_CHUNK 16384U
+
+/**
+   @brief         Fused statistics of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector (> 0)
+   @param[out]    pRes       mean, var, std, rms, min and max returned here
+   @return        none
+
+   @par SIMD
+   Two samples are loaded per word. The sum is accumulated by a sum-of-dot-product against a
+   vector of ones, the squares of a word (up to 2^31) by a dot product into a 64-bit accumulator,
+   and the minimum and maximum are tracked lane wise with packed min / max.
+*/
+
+void plp_stats_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            plp_stats_result *__restrict__ pRes) {
+
+    uint32_t blkCnt, chunk, remaining = blockSize >> 1;
+    int64_t sum = 0;
+    uint64_t sumSq = 0;
+    int32_t min, max, x, acc;
+    v2s ones = { 1, 1 };
+    v2s vmin = { 32767, 32767 };
+    v2s vmax = { -32768, -32768 };
+    v2s a;
+
+    while (remaining > 0) {
+        chunk = remaining < STATS_I16_CHUNK ? remaining : STATS_I16_CHUNK;
+        acc = 0;
+        for (blkCnt = 0; blkCnt < chunk; blkCnt++) {
+            a = *((v2s *)pSrc);
+            pSrc += 2;
+            acc = __SUMDOTP2(a, ones, acc);
+            sumSq += (uint32_t)__DOTP2(a, a);
+            vmin = __MIN2(a, vmin);
+            vmax = __MAX2(a, vmax);
+        }
+        sum += acc;
+        remaining -= chunk;
+    }
+
+    min = __MIN(vmin[0], vmin[1]);
+    max = __MAX(vmax[0], vmax[1]);
+
+    if (blockSize & 1) {
+        x = *pSrc;
+        sum += x;
+        sumSq += (uint32_t)(x * x);
+        min = __MIN(x, min);
+        max = __MAX(x, max);
+    }
+
+    plp_stats_moments_i32(blockSize, sum, sumSq, min, max, pRes);
+}
+
+/**
+  @} end of statsKernels group
+ */
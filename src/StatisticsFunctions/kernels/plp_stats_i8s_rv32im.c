@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_i8s_rv32im.c
+ * Description:  Fused statistics of an 8-bit integer vector on RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup stats
+*/
+
+/**
+   @defgroup statsKernels Stats Kernels
+*/
+
+/**
+   @addtogroup statsKernels
+   @{
+*/
+
+/** samples per 32-bit partial sum, 2^15 * 2^14 squares stay below 2^31 */
+#define STATS_I8_CHUNK 32768U
+
+/**
+   @brief         Fused statistics of an 8-bit integer vector for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector (> 0)
+   @param[out]    pRes       mean, var, std, rms, min and max returned here
+   @return        none
+*/
+
+void plp_stats_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          plp_stats_result *__restrict__ pRes) {
+
+    uint32_t blkCnt, chunk, remaining = blockSize;
+    int64_t sum = 0;
+    uint64_t sumSq = 0;
+    int32_t min = 127, max = -128;
+    int32_t x, acc, accSq;
+
+    while (remaining > 0) {
+        chunk = remaining < STATS_I8_CHUNK ? remaining : STATS_I8_CHUNK;
+        acc = 0;
+        accSq = 0;
+        for (blkCnt = 0; blkCnt < chunk; blkCnt++) {
+            x = *pSrc++;
+            acc += x;
+            accSq += x * x;
+            if (x < min)
+                min = x;
+            if (x > max)
+                max = x;
+        }
+        sum += acc;
+        sumSq += (uint32_t)accSq;
+        remaining -= chunk;
+    }
+
+    plp_stats_moments_i32(blockSize, sum, sumSq, min, max, pRes);
+}
+
+/**
+  @} end of statsKernels group
+ */
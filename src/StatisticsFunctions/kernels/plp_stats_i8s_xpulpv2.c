@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_i8s_xpulpv2.c
+ * Description:  Fused statistics of an 8-bit integer vector on XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup stats
+*/
+
+/**
+   @defgroup statsKernels Stats Kernels
+*/
+
+/**
+   @addtogroup statsKernels
+   @{
+*/
+
+/** 4-sample words per 32-bit partial sum, 2^13 * 2^16 squares stay below 2^31 */
+#define STATS_I8_CHUNK 8192U
+
+/**
+   @brief         Fused statistics of an 8-bit integer vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector (> 0)
+   @param[out]    pRes       mean, var, std, rms, min and max returned here
+   @return        none
+
+   @par SIMD
+   Four samples are loaded per word, the sum and the sum of squares are both accumulated by
+   sum-of-dot-product instructions (against a vector of ones and against the word itself), and the
+   minimum and maximum are tracked lane wise with packed min / max.
+*/
+
+void plp_stats_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           plp_stats_result *__restrict__ pRes) {
+
+    uint32_t blkCnt, chunk, remaining = blockSize >> 2;
+    int64_t sum = 0;
+    uint64_t sumSq = 0;
+    int32_t min, max, x, acc, accSq;
+    v4s ones = { 1, 1, 1, 1 };
+    v4s vmin = { 127, 127, 127, 127 };
+    v4s vmax = { -128, -128, -128, -128 };
+    v4s a;
+
+    while (remaining > 0) {
+        chunk = remaining < STATS_I8_CHUNK ? remaining : STATS_I8_CHUNK;
+        acc = 0;
+        accSq = 0;
+        for (blkCnt = 0; blkCnt < chunk; blkCnt++) {
+            a = *((v4s *)pSrc);
+            pSrc += 4;
+            acc = __SUMDOTP4(a, ones, acc);
+            accSq = __SUMDOTP4(a, a, accSq);
+            vmin = __MIN4(a, vmin);
+            vmax = __MAX4(a, vmax);
+        }
+        sum += acc;
+        sumSq += (uint32_t)accSq;
+        remaining -= chunk;
+    }
+
+    min = __MIN(__MIN(vmin[0], vmin[1]), __MIN(vmin[2], vmin[3]));
+    max = __MAX(__MAX(vmax[0], vmax[1]), __MAX(vmax[2], vmax[3]));
+
+    for (blkCnt = blockSize & 3; blkCnt > 0; blkCnt--) {
+        x = *pSrc++;
+        sum += x;
+        sumSq += x * x;
+        min = __MIN(x, min);
+        max = __MAX(x, max);
+    }
+
+    plp_stats_moments_i32(blockSize, sum, sumSq, min, max, pRes);
+}
+
+/**
+  @} end of statsKernels group
+ */
@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats.c
+ * Description:  Shared finalization of the fused integer statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup stats Stats
+   Fused statistics: mean, variance, standard deviation, root mean square, minimum and maximum of a
+   vector, computed in a single sweep over the input.
+
+   The separate functions (e.g. plp_std_q16, which calls plp_mean and plp_power) read the input
+   once per quantity. The fused kernels instead accumulate the sum and the sum of squares together
+   with the running minimum and maximum, so that every sample is loaded exactly once. The integer
+   kernels accumulate in 32 bit and flush into 64 bit before the partial sums can overflow, hence
+   the results are exact (up to the truncation of the final divisions and square roots) for any
+   blockSize. The floating point kernel accumulates the sum and the sum of squares of the samples
+   shifted by the first sample, which avoids the cancellation of the textbook formula
+   E[x^2] - E[x]^2 when the mean is large compared to the spread.
+
+   All functions compute the population variance (division by blockSize), blockSize must be > 0.
+*/
+
+/**
+   @addtogroup stats
+   @{
+*/
+
+/**
+   @brief         Computes the statistics of an integer vector from its raw moments.
+   @param[in]     blockSize  number of samples the moments were accumulated over (> 0)
+   @param[in]     sum        sum of the samples
+   @param[in]     sumSq      sum of the squared samples
+   @param[in]     min        minimum of the samples
+   @param[in]     max        maximum of the samples
+   @param[out]    pRes       statistics returned here, the variance is in squared input units
+   @return        none
+
+   @par Exactness
+   mean = sum / blockSize rounded towards zero, var = floor((sumSq - sum^2 / blockSize) /
+   blockSize), std = floor(sqrt(var)) and rms = floor(sqrt(sumSq / blockSize)). The term sum^2,
+   which would overflow 64 bit, is expanded around the quotient q = sum / blockSize and the
+   remainder r, so that the only fraction left, r^2 / blockSize, is below blockSize.
+*/
+
+void plp_stats_moments_i32(uint32_t blockSize,
+                           int64_t sum,
+                           uint64_t sumSq,
+                           int32_t min,
+                           int32_t max,
+                           plp_stats_result *__restrict__ pRes) {
+
+    uint64_t n = blockSize;
+    int64_t q = sum / (int64_t)n;
+    int64_t r = sum - q * (int64_t)n;
+    uint64_t dev, rr;
+    int32_t var, meanSq;
+
+    // n * var = sumSq - sum^2 / n = dev - r^2 / n, with dev = sumSq - q^2 n - 2 q r, where q and r
+    // have the same sign and |r| < n
+    dev = sumSq - (uint64_t)(q * q) * n - (uint64_t)(2 * q * r);
+    rr = (uint64_t)(r * r);
+    var = (int32_t)(dev / n);
+    if ((dev % n) * n < rr)
+        var--;
+    meanSq = (int32_t)(sumSq / n);
+
+    pRes->mean = (int32_t)q;
+    pRes->var = var;
+    pRes->min = min;
+    pRes->max = max;
+    plp_vsqrt_q32s_rv32im(&var, 1, 0, &pRes->std);
+    plp_vsqrt_q32s_rv32im(&meanSq, 1, 0, &pRes->rms);
+}
+
+/**
+  @} end of stats group
+ */
@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_q16.c
+ * Description:  Statistics of a 16-bit fixed point vector glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @addtogroup stats
+   @{
+*/
+
+/**
+   @brief         Glue code for the fused statistics of a 16-bit fixed point vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector (> 0)
+   @param[in]     fracBits   number of fractional bits of the input
+   @param[out]    pRes       mean, var, std, rms, min and max returned here
+   @return        none
+
+   @par Fixed point
+   The 16-bit integer kernels are used, mean, std, rms, min and max are in the input format
+   Q(16-fracBits).fracBits, the variance is shifted back from Q(2*fracBits) to the input format.
+*/
+
+void plp_stats_q16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   plp_stats_result *__restrict__ pRes) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_stats_i16s_rv32im(pSrc, blockSize, pRes);
+    } else {
+        plp_stats_i16s_xpulpv2(pSrc, blockSize, pRes);
+    }
+
+    // the integer kernel returns the variance in Q(2*fracBits)
+    pRes->var >>= fracBits;
+}
+
+/**
+  @} end of stats group
+ */
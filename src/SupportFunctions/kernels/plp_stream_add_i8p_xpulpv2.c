@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_add_i8p_xpulpv2.c
+ * Description:  8-bit integer DMA streamed element-by-element addition team kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Stream
+ */
+
+/**
+  @addtogroup StreamKernels
+  @{
+ */
+
+/**
+  @brief Team kernel of the element-by-element addition of 8-bit integer vectors, streamed through
+         cluster L1.
+  @param[in]  args  pointer to plp_stream_instance struct initialized by
+                    plp_stream_add_i8
+  @return     none
+
+  @par
+  Every core works on a contiguous chunk of the current tiles.
+ */
+
+void plp_stream_add_i8p_xpulpv2(void *args) {
+
+    plp_stream_instance *a = (plp_stream_instance *)args;
+    plp_stream *const streams[3] = { a->pStreamA, a->pStreamB, a->pStreamDst };
+
+    uint32_t core_id = hal_core_id();
+    uint32_t nPE = a->nPE;
+    const int8_t *pA, *pB;
+    int32_t *pDst;
+    uint32_t len, chunk, start, end;
+
+    while ((len = plp_stream_team_next(streams, 3)) != 0) {
+        pA = (const int8_t *)a->pStreamA->pTile;
+        pB = (const int8_t *)a->pStreamB->pTile;
+        pDst = (int32_t *)a->pStreamDst->pTile;
+
+        // chunks are multiples of 4 samples, so that every core starts on an aligned word
+        chunk = ((len + nPE - 1) / nPE + 3) & ~3U;
+        start = core_id * chunk;
+        end = start + chunk < len ? start + chunk : len;
+        if (start < end) {
+            plp_add_i8s_xpulpv2(pA + start, pB + start, pDst + start, end - start);
+        }
+    }
+}
+
+/**
+  @} end of StreamKernels group
+ */
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_dot_prod_i16p_xpulpv2.c
+ * Description:  16-bit integer DMA streamed dot product team kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Stream
+ */
+
+/**
+  @addtogroup StreamKernels
+  @{
+ */
+
+/**
+  @brief Team kernel of the dot product of 16-bit integer vectors, streamed through cluster L1.
+  @param[in]  args  pointer to plp_stream_instance struct initialized by
+                    plp_stream_dot_prod_i16
+  @return     none
+
+  @par
+  Every core works on a contiguous chunk of the current tiles, and writes the sum over its chunks to
+  its entry of pPartial.
+ */
+
+void plp_stream_dot_prod_i16p_xpulpv2(void *args) {
+
+    plp_stream_instance *a = (plp_stream_instance *)args;
+    plp_stream *const streams[2] = { a->pStreamA, a->pStreamB };
+
+    uint32_t core_id = hal_core_id();
+    uint32_t nPE = a->nPE;
+    int32_t sum = 0, part;
+    const int16_t *pA, *pB;
+    uint32_t len, chunk, start, end;
+
+    while ((len = plp_stream_team_next(streams, 2)) != 0) {
+        pA = (const int16_t *)a->pStreamA->pTile;
+        pB = (const int16_t *)a->pStreamB->pTile;
+
+        // chunks are multiples of 4 samples, so that every core starts on an aligned word
+        chunk = ((len + nPE - 1) / nPE + 3) & ~3U;
+        start = core_id * chunk;
+        end = start + chunk < len ? start + chunk : len;
+        if (start < end) {
+            plp_dot_prod_i16s_xpulpv2(pA + start, pB + start, end - start, &part);
+            sum += part;
+        }
+    }
+
+    ((int32_t *)a->pPartial)[core_id] = sum;
+}
+
+/**
+  @} end of StreamKernels group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_mat_mult_i16p_xpulpv2.c
+ * Description:  16-bit integer DMA streamed matrix multiplication team kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Stream
+ */
+
+/**
+  @addtogroup StreamKernels
+  @{
+ */
+
+/**
+  @brief Team kernel of the matrix multiplication of 16-bit integer matrices, streamed through
+         cluster L1.
+  @param[in]  args  pointer to plp_stream_mat_mult_instance struct initialized by
+                    plp_stream_mat_mult_i16
+  @return     none
+
+  @par
+  Every core multiplies its rows of the current panel of A with B, which is resident in L1, into
+  the same rows of the current panel of C.
+ */
+
+void plp_stream_mat_mult_i16p_xpulpv2(void *args) {
+
+    plp_stream_mat_mult_instance *a = (plp_stream_mat_mult_instance *)args;
+    plp_stream *const streams[2] = { a->pStreamA, a->pStreamDst };
+
+    uint32_t core_id = hal_core_id();
+    uint32_t nPE = a->nPE;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    const int16_t *pB = (const int16_t *)a->pSrcB;
+    const int16_t *pA;
+    int32_t *pC;
+    uint32_t len, rows, chunk, start, end;
+
+    while ((len = plp_stream_team_next(streams, 2)) != 0) {
+        pA = (const int16_t *)a->pStreamA->pTile;
+        pC = (int32_t *)a->pStreamDst->pTile;
+
+        // the rows of the panel are split among the cores
+        rows = len / N;
+        chunk = (rows + nPE - 1) / nPE;
+        start = core_id * chunk;
+        end = start + chunk < rows ? start + chunk : rows;
+        if (start < end) {
+            plp_mat_mult_i16s_xpulpv2(pA + start * N, pB, end - start, N, O, pC + start * O);
+        }
+    }
+}
+
+/**
+  @} end of StreamKernels group
+ */
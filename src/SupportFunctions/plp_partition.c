@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_partition.c
+ * Description:  Contiguous work partitioning for the parallel kernels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Partition Work Partitioning
+  Split of a vector into one contiguous block per core for the parallel kernels.
+
+  Giving each core the elements core_id + k * nPE (interleaved access) prevents post-increment
+  loads and packed SIMD on 8- and 16-bit data, and every core touches every cache line / TCDM bank
+  row. plp_partition instead hands core c the range [start, end) of one contiguous block. All
+  blocks but the last have the same length, rounded up to a multiple of align, such that each
+  block starts on a multiple of align elements (e.g. 2 for 16-bit and 4 for 8-bit SIMD). The last
+  non-empty block takes the remainder, and cores beyond it get an empty range (start == end), so
+  the kernels do not need any tail code in the glue.
+
+  A typical kernel looks like:
+  <pre>
+      uint32_t start, end;
+      plp_partition(a->blockSize, a->nPE, hal_core_id(), 2, &start, &end);
+      plp_add_i16s_xpulpv2(a->pSrcA + start, a->pSrcB + start, a->pDst + start, end - start);
+  </pre>
+ */
+
+/**
+  @addtogroup Partition
+  @{
+ */
+
+/**
+  @brief         Compute the contiguous block of a vector processed by one core.
+  @param[in]     blockSize  number of elements in the vector
+  @param[in]     nPE        number of cores the vector is split across
+  @param[in]     coreId     index of the core, 0 <= coreId < nPE
+  @param[in]     align      block alignment in elements, must be a power of two (1 for none)
+  @param[out]    pStart     first element of the block
+  @param[out]    pEnd       one past the last element of the block
+  @return        none
+ */
+
+void plp_partition(uint32_t blockSize,
+                   uint32_t nPE,
+                   uint32_t coreId,
+                   uint32_t align,
+                   uint32_t *pStart,
+                   uint32_t *pEnd) {
+    uint32_t chunk = ((blockSize + nPE - 1) / nPE + align - 1) & ~(align - 1);
+    uint32_t start = coreId * chunk;
+
+    if (start > blockSize) {
+        start = blockSize;
+    }
+
+    *pStart = start;
+    *pEnd = blockSize - start < chunk ? blockSize : start + chunk;
+}
+
+/**
+  @} end of Partition group
+ */
@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_scratch.c
+ * Description:  Persistent cluster L1 scratch arena used by the glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "rtos_hal.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Scratch Scratch Arena
+  Library-wide scratch memory for the glue code running on the cluster.
+
+  Several glue functions (e.g. the parallel convolutions) need temporary buffers in cluster L1.
+  Without an arena, they allocate and free them with hal_cl_l1_malloc / hal_cl_l1_free on every
+  call. The application can instead hand a persistent L1 buffer to the library once:
+  <pre>
+      static PI_L1 uint8_t scratch[8192];
+      plp_scratch_init(scratch, sizeof(scratch));
+  </pre>
+  Afterwards, temporary buffers are taken from this buffer by bumping an offset. Freeing the most
+  recent buffer gives its space back right away. Space of a buffer freed out of order is only
+  given back once every arena buffer is freed, and plp_scratch_reset drops every allocation at
+  once (frame reset). Requests which do not fit into the arena, as well as all requests issued before
+  plp_scratch_init is called, fall back to hal_cl_l1_malloc.
+
+  The arena is not protected against concurrent use: it must only be used by the glue code,
+  i.e. outside of a team fork, on the core that called the glue function.
+ */
+
+/**
+  @addtogroup Scratch
+  @{
+ */
+
+/** all arena allocations are rounded up to this many bytes */
+#define PLP_SCRATCH_ALIGN 4U
+
+static HAL_CL_L1 uint8_t *scratchBase = NULL;
+static HAL_CL_L1 uint32_t scratchSize = 0;
+static HAL_CL_L1 uint32_t scratchOffset = 0;
+static HAL_CL_L1 uint32_t scratchLive = 0; /* bytes of the arena buffers not yet freed */
+
+/**
+  @brief         Register a persistent buffer as library-wide scratch arena.
+  @param[in]     pBuf  points to the buffer (should be in cluster L1), NULL disables the arena
+  @param[in]     size  size of the buffer in bytes
+  @return        none
+ */
+
+void plp_scratch_init(void *pBuf, uint32_t size) {
+    uint32_t misalign = (uintptr_t)pBuf & (PLP_SCRATCH_ALIGN - 1);
+
+    if (pBuf == NULL || size <= misalign) {
+        scratchBase = NULL;
+        scratchSize = 0;
+    } else if (misalign) {
+        scratchBase = (uint8_t *)pBuf + (PLP_SCRATCH_ALIGN - misalign);
+        scratchSize = size - (PLP_SCRATCH_ALIGN - misalign);
+    } else {
+        scratchBase = (uint8_t *)pBuf;
+        scratchSize = size;
+    }
+    scratchOffset = 0;
+    scratchLive = 0;
+}
+
+/**
+  @brief         Allocate a temporary buffer from the scratch arena.
+  @param[in]     size  size of the buffer in bytes
+  @return        pointer to the buffer, taken from the arena if it fits, otherwise from
+                 hal_cl_l1_malloc
+ */
+
+void *plp_scratch_alloc(uint32_t size) {
+    uint32_t aligned = (size + PLP_SCRATCH_ALIGN - 1) & ~(PLP_SCRATCH_ALIGN - 1);
+
+    if (scratchBase != NULL && aligned <= scratchSize - scratchOffset) {
+        void *chunk = scratchBase + scratchOffset;
+        scratchOffset += aligned;
+        scratchLive += aligned;
+        return chunk;
+    }
+
+    return hal_cl_l1_malloc(size);
+}
+
+/**
+  @brief         Release a buffer obtained from plp_scratch_alloc.
+  @details       Freeing the most recent arena buffer gives its space back. The space of an
+                 older arena buffer stays in use until all arena buffers are freed or the arena
+                 is reset. Buffers from the hal_cl_l1_malloc fallback are freed immediately.
+                 Freeing an arena buffer after plp_scratch_reset has no effect.
+  @param[in]     pChunk  points to the buffer
+  @param[in]     size    size of the buffer in bytes, as passed to plp_scratch_alloc
+  @return        none
+ */
+
+void plp_scratch_free(void *pChunk, uint32_t size) {
+    uint8_t *p = (uint8_t *)pChunk;
+
+    /* zero sized buffers take no arena space, and one taken from a full arena points to its end */
+    if (size == 0) {
+        if (scratchBase == NULL) {
+            hal_cl_l1_free(pChunk, size);
+        }
+        return;
+    }
+
+    if (scratchBase != NULL && p >= scratchBase && p < scratchBase + scratchSize) {
+        uint32_t aligned = (size + PLP_SCRATCH_ALIGN - 1) & ~(PLP_SCRATCH_ALIGN - 1);
+        /* the buffer was already released by plp_scratch_reset */
+        if (p >= scratchBase + scratchOffset) {
+            return;
+        }
+        scratchLive -= aligned;
+        if (scratchLive == 0) {
+            scratchOffset = 0;
+        } else if (p + aligned == scratchBase + scratchOffset) {
+            scratchOffset -= aligned;
+        }
+        return;
+    }
+
+    hal_cl_l1_free(pChunk, size);
+}
+
+/**
+  @brief         Release all buffers allocated from the scratch arena (frame reset).
+  @return        none
+ */
+
+void plp_scratch_reset(void) {
+    scratchOffset = 0;
+    scratchLive = 0;
+}
+
+/**
+  @} end of Scratch group
+ */
@@ -0,0 +1,230 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream.c
+ * Description:  Double-buffered DMA streaming of L2 vectors through cluster L1
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Stream DMA Streaming
+  Double-buffered streaming of vectors and matrices which reside in L2 through cluster L1.
+
+  The working sets of many applications do not fit into cluster L1, and reading the operands
+  directly from L2 makes every kernel memory-bound. A stream splits an L2 array into tiles of
+  tileLen elements and moves them through two L1 buffers (ping-pong): while the cores work on the
+  tile in one buffer, the DMA fills (input streams) or drains (output streams) the other one.
+  <pre>
+      plp_stream a;
+      plp_stream_init(&a, pSrc, sizeof(int32_t), blockSize, 256, HAL_CL_DMA_DIR_EXT2LOC);
+      while ((len = plp_stream_acquire(&a)) != 0) {
+          compute(a.pTile, len);
+          plp_stream_release(&a);
+      }
+      plp_stream_deinit(&a);
+  </pre>
+  The L1 buffers are taken from the scratch arena (see plp_scratch_init). Streams must be
+  deinitialized in the reverse order of their initialization, so that the arena is released in
+  LIFO order.
+
+  All DMA transfers of a stream must be issued and waited for by the same core. Inside a team
+  fork, plp_stream_team_next lets core 0 drive a group of streams while all cores compute on the
+  current tiles. The plp_stream_* functions built on top of it (dot products, element-wise
+  operations and matrix multiplication) run on the cluster only.
+ */
+
+/**
+  @addtogroup Stream
+  @{
+ */
+
+static inline uint32_t plp_stream_min(uint32_t a, uint32_t b) { return a < b ? a : b; }
+
+static void plp_stream_transfer(plp_stream *s, uint32_t buf, uint32_t offset, uint32_t len) {
+    hal_cl_dma_cmd((uintptr_t)(s->pExt + offset * s->elemSize), (uintptr_t)s->pBuf[buf],
+                   len * s->elemSize, s->dir, 0, &s->cmd[buf]);
+    s->busy[buf] = 1;
+}
+
+static void plp_stream_wait(plp_stream *s, uint32_t buf) {
+    if (s->busy[buf]) {
+        hal_cl_dma_cmd_wait(&s->cmd[buf]);
+        s->busy[buf] = 0;
+    }
+}
+
+/**
+  @brief         Initialize a stream over an L2 array and start the transfer of its first tile.
+  @param[out]    s         points to the stream
+  @param[in]     pExt      points to the array in L2
+  @param[in]     elemSize  size of one element in bytes
+  @param[in]     length    number of elements of the array
+  @param[in]     tileLen   number of elements per tile, should be a multiple of 4 so that the tiles
+                           keep the alignment needed by the SIMD kernels
+  @param[in]     dir       HAL_CL_DMA_DIR_EXT2LOC for inputs, HAL_CL_DMA_DIR_LOC2EXT for outputs
+  @return        0 on success, -1 if the L1 buffers cannot be allocated
+ */
+
+int plp_stream_init(plp_stream *s,
+                    void *pExt,
+                    uint32_t elemSize,
+                    uint32_t length,
+                    uint32_t tileLen,
+                    hal_cl_dma_dir_e dir) {
+
+    uint32_t bufSize = (tileLen * elemSize + 3) & ~3U;
+
+    s->pExt = (uint8_t *)pExt;
+    s->elemSize = elemSize;
+    s->length = length;
+    s->tileLen = tileLen;
+    s->dir = dir;
+    s->offset = 0;
+    s->buf = 0;
+    s->busy[0] = 0;
+    s->busy[1] = 0;
+    s->pTile = NULL;
+    s->tileCnt = 0;
+
+    s->pBuf[0] = plp_scratch_alloc(2 * bufSize);
+    if (s->pBuf[0] == NULL) {
+        return -1;
+    }
+    s->pBuf[1] = s->pBuf[0] + bufSize;
+
+    if (dir == HAL_CL_DMA_DIR_EXT2LOC && length > 0) {
+        plp_stream_transfer(s, 0, 0, plp_stream_min(tileLen, length));
+    }
+
+    return 0;
+}
+
+/**
+  @brief         Acquire the next tile of a stream.
+  @details       For an input stream, waits until the tile has arrived in L1 and starts the transfer
+                 of the following tile into the other buffer. For an output stream, waits until the
+                 buffer has been written back to L2 by the transfer issued two tiles before.
+                 The tile is available in s->pTile until plp_stream_release is called.
+  @param[in,out] s  points to the stream
+  @return        number of elements in the tile, 0 if the end of the array has been reached
+ */
+
+uint32_t plp_stream_acquire(plp_stream *s) {
+
+    uint32_t len;
+
+    if (s->offset >= s->length) {
+        return 0;
+    }
+    len = plp_stream_min(s->tileLen, s->length - s->offset);
+
+    plp_stream_wait(s, s->buf);
+
+    if (s->dir == HAL_CL_DMA_DIR_EXT2LOC && s->offset + len < s->length) {
+        plp_stream_transfer(s, s->buf ^ 1, s->offset + len,
+                            plp_stream_min(s->tileLen, s->length - s->offset - len));
+    }
+
+    s->pTile = s->pBuf[s->buf];
+    s->tileCnt = len;
+
+    return len;
+}
+
+/**
+  @brief         Release the current tile of a stream.
+  @details       For an output stream, starts the transfer of the tile back to L2.
+  @param[in,out] s  points to the stream
+  @return        none
+ */
+
+void plp_stream_release(plp_stream *s) {
+
+    if (s->pTile == NULL) {
+        return;
+    }
+
+    if (s->dir == HAL_CL_DMA_DIR_LOC2EXT) {
+        plp_stream_transfer(s, s->buf, s->offset, s->tileCnt);
+    }
+
+    s->offset += s->tileCnt;
+    s->buf ^= 1;
+    s->pTile = NULL;
+    s->tileCnt = 0;
+}
+
+/**
+  @brief         Wait for all transfers of a stream and release its L1 buffers.
+  @param[in,out] s  points to the stream
+  @return        none
+ */
+
+void plp_stream_deinit(plp_stream *s) {
+
+    uint32_t bufSize = (s->tileLen * s->elemSize + 3) & ~3U;
+
+    plp_stream_wait(s, 0);
+    plp_stream_wait(s, 1);
+    plp_scratch_free(s->pBuf[0], 2 * bufSize);
+}
+
+/**
+  @brief         Advance a group of streams to their next tiles, from inside a team fork.
+  @details       Must be called by all cores of the team. Once every core is done with the current
+                 tiles, core 0 releases them and acquires the next ones, the other cores wait at
+                 a barrier until the new tiles are available in ppStreams[i]->pTile.
+  @param[in,out] ppStreams  points to the streams of the group
+  @param[in]     nStreams   number of streams in the group
+  @return        number of elements in the tile of the first stream, 0 if it has ended
+ */
+
+uint32_t plp_stream_team_next(plp_stream *const *ppStreams, uint32_t nStreams) {
+
+    uint32_t i;
+
+    hal_team_barrier();
+
+    if (hal_core_id() == 0) {
+        for (i = 0; i < nStreams; i++) {
+            plp_stream_release(ppStreams[i]);
+        }
+        for (i = 0; i < nStreams; i++) {
+            plp_stream_acquire(ppStreams[i]);
+        }
+    }
+
+    hal_team_barrier();
+
+    return ppStreams[0]->tileCnt;
+}
+
+/**
+  @} end of Stream group
+ */
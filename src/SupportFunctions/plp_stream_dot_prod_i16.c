@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_dot_prod_i16.c
+ * Description:  16-bit integer DMA streamed dot product glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Stream
+  @{
+ */
+
+/**
+  @brief         Glue code for dot product of 16-bit integer vectors in L2, streamed through cluster
+                 L1.
+  @param[in]     pSrcA      points to the first input vector in L2
+  @param[in]     pSrcB      points to the second input vector in L2
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     nPE        number of cores to use for computation
+  @param[out]    pRes       output result returned here
+  @return        none
+ */
+
+void plp_stream_dot_prod_i16(const int16_t *pSrcA,
+                             const int16_t *pSrcB,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int32_t *pRes) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA streaming supported only for cluster side\n");
+        return;
+    }
+
+    plp_stream sA, sB;
+    uint32_t tileLen = (PLP_STREAM_TILE_BYTES / sizeof(int16_t)) & ~3U;
+    int32_t partial[nPE];
+    int32_t sum = 0;
+    uint32_t i;
+
+    if (plp_stream_init(&sA, (void *)pSrcA, sizeof(int16_t), blockSize, tileLen,
+                        HAL_CL_DMA_DIR_EXT2LOC) != 0) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+    if (plp_stream_init(&sB, (void *)pSrcB, sizeof(int16_t), blockSize, tileLen,
+                        HAL_CL_DMA_DIR_EXT2LOC) != 0) {
+        plp_stream_deinit(&sA);
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    plp_stream_instance args = { .pStreamA = &sA,
+                                  .pStreamB = &sB,
+                                  .pStreamDst = NULL,
+                                  .nPE = nPE,
+                                  .pPartial = partial };
+
+    hal_cl_team_fork(nPE, plp_stream_dot_prod_i16p_xpulpv2, (void *)&args);
+
+    plp_stream_deinit(&sB);
+    plp_stream_deinit(&sA);
+
+    for (i = 0; i < nPE; i++) {
+        sum += partial[i];
+    }
+    *pRes = sum;
+}
+
+/**
+  @} end of Stream group
+ */
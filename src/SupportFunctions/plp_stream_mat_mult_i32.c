@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_mat_mult_i32.c
+ * Description:  32-bit integer DMA streamed matrix multiplication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Stream
+  @{
+ */
+
+/**
+  @brief         Glue code for matrix multiplication of 32-bit integer matrices in L2, streamed
+                 through cluster L1.
+  @param[in]     pSrcA  points to the first input matrix of shape MxN in L2
+  @param[in]     pSrcB  points to the second input matrix of shape NxO in L2, it is copied to L1
+                        and must fit into it
+  @param[in]     M      height of the first matrix and of the output matrix
+  @param[in]     N      width of the first matrix and height of the second matrix
+  @param[in]     O      width of the second matrix and of the output matrix
+  @param[in]     nPE    number of cores to use for computation
+  @param[out]    pDstC  points to the output matrix of shape MxO in L2
+  @return        none
+ */
+
+void plp_stream_mat_mult_i32(const int32_t *pSrcA,
+                             const int32_t *pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t nPE,
+                             int32_t *pDstC) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA streaming supported only for cluster side\n");
+        return;
+    }
+
+    int32_t *pB;
+    plp_stream sA, sC;
+    hal_cl_dma_cmd_t copy;
+    uint32_t rowBytesA = N * sizeof(int32_t);
+    uint32_t rowBytesC = O * sizeof(int32_t);
+    uint32_t rowBytes = rowBytesA > rowBytesC ? rowBytesA : rowBytesC;
+    uint32_t rows = rowBytes < PLP_STREAM_TILE_BYTES ? PLP_STREAM_TILE_BYTES / rowBytes : 1;
+
+    pB = plp_scratch_alloc(sizeof(int32_t) * N * O);
+    if (pB == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+    hal_cl_dma_cmd((uintptr_t)pSrcB, (uintptr_t)pB, sizeof(int32_t) * N * O,
+                   HAL_CL_DMA_DIR_EXT2LOC, 0, &copy);
+
+    // one tile holds a panel of rows of A, and the same rows of C
+    if (plp_stream_init(&sA, (void *)pSrcA, sizeof(int32_t), M * N, rows * N,
+                        HAL_CL_DMA_DIR_EXT2LOC) != 0) {
+        hal_cl_dma_cmd_wait(&copy);
+        plp_scratch_free(pB, sizeof(int32_t) * N * O);
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+    if (plp_stream_init(&sC, (void *)pDstC, sizeof(int32_t), M * O, rows * O,
+                        HAL_CL_DMA_DIR_LOC2EXT) != 0) {
+        plp_stream_deinit(&sA);
+        hal_cl_dma_cmd_wait(&copy);
+        plp_scratch_free(pB, sizeof(int32_t) * N * O);
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+    hal_cl_dma_cmd_wait(&copy);
+
+    plp_stream_mat_mult_instance args = {
+        .pStreamA = &sA, .pSrcB = pB, .pStreamDst = &sC, .N = N, .O = O, .nPE = nPE
+    };
+
+    hal_cl_team_fork(nPE, plp_stream_mat_mult_i32p_xpulpv2, (void *)&args);
+
+    plp_stream_deinit(&sC);
+    plp_stream_deinit(&sA);
+    plp_scratch_free(pB, sizeof(int32_t) * N * O);
+}
+
+/**
+  @} end of Stream group
+ */
@@ -34,7 +34,7 @@ static HAL_CL_L1 float32_t ROT_CONST = 0.707106781f;
 
 /* HELPER FUNCTIONS */
 
-int bit_rev_radix2(int index, int log2FFTLen);
+static int bit_rev_radix2(int index, int log2FFTLen);
 int bit_rev_radix4(int index, int log2FFTLen);
 int bit_rev_radix8(int index, int log2FFTLen);
 
@@ -83,6 +83,38 @@ static void plp_cfft_radix2_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *
 static void plp_cfft_radix4_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
 static void plp_cfft_radix8_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
 
+/* maximum number of stages of the mixed-radix FFT, enough for FFTLength <= 2^16 */
+#define PLP_CFFT_MIXED_MAX_STAGES 6
+
+static int mixed_radix_stages(uint32_t FFTLength, int *log2Radix);
+static inline Complex_type_f32 mixed_twiddle(const Complex_type_f32 *twiddle_ptr,
+                                             uint32_t k,
+                                             uint32_t half);
+static inline void mixed_butterfly_radix8(Complex_type_f32 *input,
+                                          Complex_type_f32 *output,
+                                          uint32_t twiddle_index,
+                                          int index,
+                                          int distance,
+                                          const Complex_type_f32 *twiddle_ptr,
+                                          uint32_t half);
+static inline void mixed_butterfly_radix4(Complex_type_f32 *input,
+                                          Complex_type_f32 *output,
+                                          uint32_t twiddle_index,
+                                          int index,
+                                          int distance,
+                                          const Complex_type_f32 *twiddle_ptr,
+                                          uint32_t half);
+static inline void mixed_butterfly_radix2(Complex_type_f32 *input,
+                                          Complex_type_f32 *output,
+                                          int index,
+                                          int distance);
+static inline void window_load(const float32_t *pSrc,
+                               const float32_t *pWindow,
+                               Complex_type_f32 *output,
+                               int index,
+                               int distance,
+                               int radix);
+
 /**
   @ingroup fft
  */
@@ -95,7 +127,10 @@ static void plp_cfft_radix8_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *
   FFTLen complex values in the form (real part, complex part).
   Input and output can refer to the same memory location (in-place computation).
   The best algorithm is executed based on the val FFTLen.
-  Supported algorithms: radix-2, radix-4, radix-8
+  Supported algorithms: radix-2, radix-4, radix-8.
+  The mixed radix-8/4 kernels (plp_cfft_mixed_f32_xpulpv2) support every power of two, read the
+  twiddle factors from a table of half a period and leave the output in bit-reversed order; they
+  are used by the real FFT.
 */
 
 /**
@@ -425,10 +460,13 @@ static void plp_cfft_radix8_f32_xpulpv2(const plp_fft_instance_f32 *S,
 
 /**
    @brief  Floating-point FFT on complex input data for XPULPV2 extension.
-   @param[in]   arg      points to an instance of the floating-point FFT structure
+   @param[in]   args     points to an instance of the floating-point FFT structure
    @return      none
 */
-void plp_cfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
+void plp_cfft_f32_xpulpv2_parallel(void *args) {
+
+    plp_fft_instance_f32_parallel *arg = (plp_fft_instance_f32_parallel *)args;
+
     switch(arg->S->FFTLength) {
       case 64:
       case 512:
@@ -482,8 +520,8 @@ void plp_cfft_radix2_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
     stage = stage + 1;
     dist = dist >> 1;
 
-    // STAGES 2 -> n-1
-    while (dist > nPE / 2) {
+    // STAGES 2 -> n-1, split over the butterflies of a group while there are enough of them
+    while (dist > 1 && dist >= nPE) {
         hal_team_barrier();
         step = dist << 1;
         for (j = 0; j < butt; j++) {
@@ -499,18 +537,16 @@ void plp_cfft_radix2_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
         butt = butt << 1;
     }
 
+    // then over all butterflies of the stage, as there can be less groups than cores
+    _in_ptr = (Complex_type_f32 *)pDst;
     while (dist > 1) {
         hal_team_barrier();
         step = dist << 1;
-        for (j = 0; j < butt / nPE; j++) {
-            _in_ptr = _in_ptr = (Complex_type_f32 *)pDst;
-            ;
-            for (d = 0; d < dist; d++) {
-                process_butterfly_radix2(_in_ptr, _in_ptr, butt * d, (j * nPE + core_id) * step, dist,
-                                         _tw_ptr);
-                _in_ptr++;
-            } // d
-        }     // j
+        for (k = core_id; k < butt * dist; k += nPE) {
+            j = k / dist;
+            d = k % dist;
+            process_butterfly_radix2(_in_ptr, _in_ptr, butt * d, j * step + d, dist, _tw_ptr);
+        } // k
         stage = stage + 1;
         dist = dist >> 1;
         butt = butt << 1;
@@ -615,7 +651,7 @@ void plp_cfft_radix4_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
     dist = dist >> 2;
 
     // STAGES 2 -> n-1
-    while (dist >= nPE) {
+    while (dist > 1 && dist >= nPE) {
         hal_team_barrier();
         step = dist << 2;
         for (j = 0; j < butt; j++) {
@@ -742,7 +778,7 @@ void plp_cfft_radix8_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
   dist = dist >> 3;
 
   // STAGES 2 -> n-1
-  while (dist >= nPE) {
+  while (dist > 1 && dist >= nPE) {
       hal_team_barrier();
       step = dist << 3;
       for (j = 0; j < butt; j++) {
@@ -833,11 +869,210 @@ void plp_cfft_radix8_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
   }
 }
 
+/**
+   @brief  Mixed radix-8/4 floating-point FFT on complex input data for XPULPV2 extension.
+   @details The transform is split into radix-8 stages, followed by the radix-4 (or, for
+            FFTLength == 2, radix-2) stages needed to reach any power of two. Every butterfly
+            stores its outputs in bit-reversed order, so the output of the FFT is left in
+            bit-reversed order: frequency bin k is stored at position
+            plp_cfft_mixed_rev_index_f32(k, FFTLength).
+   @param[in]   pSrc            points to the input buffer (complex data)
+   @param[out]  pDst            points to the output buffer (complex data), can be equal to pSrc
+   @param[in]   FFTLength       length of the FFT (power of two, at least 2)
+   @param[in]   pTwiddleFactors points to the twiddle factors of half a period, i.e.
+                                FFTLength * twiddleStride / 2 values, the second half follows from
+                                W^(k + FFTLength / 2) = -W^k
+   @param[in]   twiddleStride   twiddle factor k of the FFT is read at index k*twiddleStride, e.g.
+                                2 to run a FFT of length N/2 on the N/2 twiddles of a radix-2 FFT
+                                of length N
+   @return      none
+*/
+void plp_cfft_mixed_f32_xpulpv2(const float32_t *pSrc,
+                                float32_t *pDst,
+                                uint32_t FFTLength,
+                                const float32_t *pTwiddleFactors,
+                                uint32_t twiddleStride) {
+
+    int j, d, stage, radix;
+    int log2Radix[PLP_CFFT_MIXED_MAX_STAGES];
+    int nStages = mixed_radix_stages(FFTLength, log2Radix);
+
+    int dist = FFTLength;
+    int butt = 1; // number of groups
+    uint32_t half = (FFTLength * twiddleStride) >> 1;
+
+    Complex_type_f32 *_in_ptr = (Complex_type_f32 *)pSrc;
+    Complex_type_f32 *_out_ptr = (Complex_type_f32 *)pDst;
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)pTwiddleFactors;
+
+    // STAGES 1 -> n-1
+    for (stage = 0; stage < nStages - 1; stage++) {
+        dist = dist >> log2Radix[stage];
+        int step = dist << log2Radix[stage];
+        int tw_step = butt * twiddleStride;
+        for (j = 0; j < butt; j++) {
+            if (log2Radix[stage] == 3) {
+                for (d = 0; d < dist; d++)
+                    mixed_butterfly_radix8(_in_ptr, _out_ptr, d * tw_step, j * step + d, dist,
+                                           _tw_ptr, half);
+            } else {
+                for (d = 0; d < dist; d++)
+                    mixed_butterfly_radix4(_in_ptr, _out_ptr, d * tw_step, j * step + d, dist,
+                                           _tw_ptr, half);
+            }
+        } // j
+        _in_ptr = _out_ptr;
+        butt = butt << log2Radix[stage];
+    }
+
+    // LAST STAGE, twiddle factors are all 1
+    radix = 1 << log2Radix[nStages - 1];
+    for (j = 0; j < FFTLength; j += radix) {
+        if (radix == 8)
+            mixed_butterfly_radix8(_in_ptr, _out_ptr, 0, j, 1, _tw_ptr, half);
+        else if (radix == 4)
+            mixed_butterfly_radix4(_in_ptr, _out_ptr, 0, j, 1, _tw_ptr, half);
+        else
+            mixed_butterfly_radix2(_in_ptr, _out_ptr, j, 1);
+    } // j
+}
+
+/**
+   @brief  Mixed radix-8/4 floating-point FFT on complex input data for XPULPV2 extension
+           (parallel version).
+   @details Must be called by all the nPE cores of a team, e.g. from inside the kernel of a
+            parallel transform. The butterflies of every stage are interleaved on the cores and
+            the function returns after a final barrier. See plp_cfft_mixed_f32_xpulpv2 for the
+            output order.
+   @param[in]   pSrc            points to the input buffer (complex data)
+   @param[out]  pDst            points to the output buffer (complex data), can be equal to pSrc
+   @param[in]   FFTLength       length of the FFT (power of two, at least 2)
+   @param[in]   pTwiddleFactors points to the twiddle factors of half a period
+   @param[in]   twiddleStride   twiddle factor k of the FFT is read at index k*twiddleStride
+   @param[in]   nPE             number of cores of the team
+   @return      none
+*/
+void plp_cfft_mixed_f32_xpulpv2_parallel(const float32_t *pSrc,
+                                         float32_t *pDst,
+                                         uint32_t FFTLength,
+                                         const float32_t *pTwiddleFactors,
+                                         uint32_t twiddleStride,
+                                         uint32_t nPE) {
+
+    plp_cfft_mixed_windowed_f32_xpulpv2_parallel(pSrc, NULL, pDst, FFTLength, pTwiddleFactors,
+                                                 twiddleStride, nPE);
+}
+
+/**
+   @brief  Mixed radix-8/4 floating-point FFT on windowed complex input data for XPULPV2
+           extension (parallel version).
+   @details Same as plp_cfft_mixed_f32_xpulpv2_parallel, but every input value is multiplied by
+            the corresponding window value while the first stage loads it, which saves a separate
+            windowing pass and barrier. The window is applied to the real and imaginary parts
+            separately, i.e. pWindow has 2*FFTLength values. A real signal of length 2*FFTLength
+            packed as complex data is thus windowed with a window of its own length.
+   @param[in]   pSrc            points to the input buffer (complex data)
+   @param[in]   pWindow         points to the window (2*FFTLength values), NULL for no window
+   @param[out]  pDst            points to the output buffer (complex data), can be equal to pSrc
+   @param[in]   FFTLength       length of the FFT (power of two, at least 2)
+   @param[in]   pTwiddleFactors points to the twiddle factors of half a period
+   @param[in]   twiddleStride   twiddle factor k of the FFT is read at index k*twiddleStride
+   @param[in]   nPE             number of cores of the team
+   @return      none
+*/
+void plp_cfft_mixed_windowed_f32_xpulpv2_parallel(const float32_t *pSrc,
+                                                  const float32_t *pWindow,
+                                                  float32_t *pDst,
+                                                  uint32_t FFTLength,
+                                                  const float32_t *pTwiddleFactors,
+                                                  uint32_t twiddleStride,
+                                                  uint32_t nPE) {
+
+    int b, j, d, stage, radix;
+    int log2Radix[PLP_CFFT_MIXED_MAX_STAGES];
+    int nStages = mixed_radix_stages(FFTLength, log2Radix);
+
+    int log2Dist = 0;
+    int butt = 1; // number of groups
+    int core_id = hal_core_id();
+    uint32_t half = (FFTLength * twiddleStride) >> 1;
+
+    Complex_type_f32 *_in_ptr = (Complex_type_f32 *)pSrc;
+    Complex_type_f32 *_out_ptr = (Complex_type_f32 *)pDst;
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)pTwiddleFactors;
+
+    while ((1U << log2Dist) < FFTLength)
+        log2Dist++;
+
+    // STAGES 1 -> n-1
+    for (stage = 0; stage < nStages - 1; stage++) {
+        log2Dist -= log2Radix[stage];
+        int dist = 1 << log2Dist;
+        int step = dist << log2Radix[stage];
+        int tw_step = butt * twiddleStride;
+        int nbutterfly = FFTLength >> log2Radix[stage];
+        for (b = core_id; b < nbutterfly; b += nPE) {
+            j = b >> log2Dist;
+            d = b & (dist - 1);
+            if (pWindow) {
+                // a butterfly writes back to the positions it reads, so it can run in place on
+                // its windowed inputs
+                window_load(pSrc, pWindow, _out_ptr, j * step + d, dist, 1 << log2Radix[stage]);
+                _in_ptr = _out_ptr;
+            }
+            if (log2Radix[stage] == 3)
+                mixed_butterfly_radix8(_in_ptr, _out_ptr, d * tw_step, j * step + d, dist, _tw_ptr,
+                                       half);
+            else
+                mixed_butterfly_radix4(_in_ptr, _out_ptr, d * tw_step, j * step + d, dist, _tw_ptr,
+                                       half);
+        } // b
+        _in_ptr = _out_ptr;
+        pWindow = NULL;
+        butt = butt << log2Radix[stage];
+        hal_team_barrier();
+    }
+
+    // LAST STAGE, twiddle factors are all 1
+    radix = 1 << log2Radix[nStages - 1];
+    for (j = core_id * radix; j < FFTLength; j += nPE * radix) {
+        if (pWindow) {
+            window_load(pSrc, pWindow, _out_ptr, j, 1, radix);
+            _in_ptr = _out_ptr;
+        }
+        if (radix == 8)
+            mixed_butterfly_radix8(_in_ptr, _out_ptr, 0, j, 1, _tw_ptr, half);
+        else if (radix == 4)
+            mixed_butterfly_radix4(_in_ptr, _out_ptr, 0, j, 1, _tw_ptr, half);
+        else
+            mixed_butterfly_radix2(_in_ptr, _out_ptr, j, 1);
+    } // j
+
+    hal_team_barrier();
+}
+
+/**
+   @brief  Position of a frequency bin in the output of the mixed-radix FFT.
+   @param[in]   index       frequency bin
+   @param[in]   FFTLength   length of the FFT (power of two, at least 2)
+   @return      position of bin index in the output of plp_cfft_mixed_f32_xpulpv2, i.e. index
+                bit-reversed over log2(FFTLength) bits
+*/
+uint32_t plp_cfft_mixed_rev_index_f32(uint32_t index, uint32_t FFTLength) {
+
+    int log2FFTLen = 0;
+
+    while ((1U << log2FFTLen) < FFTLength)
+        log2FFTLen++;
+
+    return bit_rev_radix2(index, log2FFTLen);
+}
+
 /**
    @} end of complexFFTKernels group
 */
 
-int bit_rev_radix2(int index, int log2FFTLen) {
+static int bit_rev_radix2(int index, int log2FFTLen) {
     int i;
     unsigned int revNum = 0;
 
@@ -850,6 +1085,201 @@ int bit_rev_radix2(int index, int log2FFTLen) {
     return revNum;
 }
 
+/* writes the windowed inputs index, index + distance, .. of a butterfly of the given radix */
+static inline void window_load(const float32_t *pSrc,
+                               const float32_t *pWindow,
+                               Complex_type_f32 *output,
+                               int index,
+                               int distance,
+                               int radix) {
+    int r, p;
+
+    for (r = 0, p = index; r < radix; r++, p += distance) {
+        output[p].re = pSrc[2 * p] * pWindow[2 * p];
+        output[p].im = pSrc[2 * p + 1] * pWindow[2 * p + 1];
+    }
+}
+
+static int mixed_radix_stages(uint32_t FFTLength, int *log2Radix) {
+
+    int nStages = 0;
+    int log2FFTLen = 0;
+
+    while ((1U << log2FFTLen) < FFTLength)
+        log2FFTLen++;
+
+    // radix-8 stages first, then radix-4 stages: a log2 remainder of 4 becomes 4x4 instead of 8x2
+    while (log2FFTLen > 0) {
+        if (log2FFTLen == 1)
+            log2Radix[nStages] = 1;
+        else if (log2FFTLen == 2 || log2FFTLen == 4)
+            log2Radix[nStages] = 2;
+        else
+            log2Radix[nStages] = 3;
+        log2FFTLen -= log2Radix[nStages];
+        nStages++;
+    }
+
+    return nStages;
+}
+
+/* twiddle factor k of the mixed-radix FFT, from a table of half a period: W^(k + half) = -W^k */
+static inline Complex_type_f32 mixed_twiddle(const Complex_type_f32 *twiddle_ptr,
+                                             uint32_t k,
+                                             uint32_t half) {
+    Complex_type_f32 tw;
+
+    if (k < half)
+        return twiddle_ptr[k];
+
+    tw = twiddle_ptr[k - half];
+    tw.re = -tw.re;
+    tw.im = -tw.im;
+    return tw;
+}
+
+/*
+ * Radix-8 butterfly of the mixed-radix FFT on the inputs index, index + distance, ..
+ * index + 7*distance. Output r is multiplied by the twiddle factor r*twiddle_index and stored at
+ * index + bitrev3(r)*distance, such that the FFT leaves its result in bit-reversed order. The
+ * last stage uses twiddle_index = 0 (no rotation) and distance = 1. Computed as two radix-4
+ * butterflies on the even and the odd inputs, combined with W_8^r.
+ */
+static inline void mixed_butterfly_radix8(Complex_type_f32 *input,
+                                          Complex_type_f32 *output,
+                                          uint32_t twiddle_index,
+                                          int index,
+                                          int distance,
+                                          const Complex_type_f32 *twiddle_ptr,
+                                          uint32_t half) {
+
+    Complex_type_f32 x0 = input[index];
+    Complex_type_f32 x1 = input[index + distance];
+    Complex_type_f32 x2 = input[index + 2 * distance];
+    Complex_type_f32 x3 = input[index + 3 * distance];
+    Complex_type_f32 x4 = input[index + 4 * distance];
+    Complex_type_f32 x5 = input[index + 5 * distance];
+    Complex_type_f32 x6 = input[index + 6 * distance];
+    Complex_type_f32 x7 = input[index + 7 * distance];
+    Complex_type_f32 r[8];
+    int k;
+
+    // radix-4 on the even inputs: E[k] = sum x[2n] W_4^(nk)
+    float32_t a0r = x0.re + x4.re, a0i = x0.im + x4.im;
+    float32_t a1r = x0.re - x4.re, a1i = x0.im - x4.im;
+    float32_t a2r = x2.re + x6.re, a2i = x2.im + x6.im;
+    float32_t a3r = x2.re - x6.re, a3i = x2.im - x6.im;
+    float32_t e0r = a0r + a2r, e0i = a0i + a2i;
+    float32_t e2r = a0r - a2r, e2i = a0i - a2i;
+    float32_t e1r = a1r + a3i, e1i = a1i - a3r;
+    float32_t e3r = a1r - a3i, e3i = a1i + a3r;
+
+    // radix-4 on the odd inputs: O[k] = sum x[2n+1] W_4^(nk)
+    float32_t b0r = x1.re + x5.re, b0i = x1.im + x5.im;
+    float32_t b1r = x1.re - x5.re, b1i = x1.im - x5.im;
+    float32_t b2r = x3.re + x7.re, b2i = x3.im + x7.im;
+    float32_t b3r = x3.re - x7.re, b3i = x3.im - x7.im;
+    float32_t o0r = b0r + b2r, o0i = b0i + b2i;
+    float32_t o2r = b0r - b2r, o2i = b0i - b2i;
+    float32_t o1r = b1r + b3i, o1i = b1i - b3r;
+    float32_t o3r = b1r - b3i, o3i = b1i + b3r;
+
+    // W_8^k O[k], with W_8 = (1 - j) / sqrt(2), W_8^2 = -j and W_8^3 = -(1 + j) / sqrt(2)
+    float32_t t1r = ROT_CONST * (o1r + o1i), t1i = ROT_CONST * (o1i - o1r);
+    float32_t t2r = o2i, t2i = -o2r;
+    float32_t t3r = ROT_CONST * (o3i - o3r), t3i = -ROT_CONST * (o3r + o3i);
+
+    // r[bitrev3(k)] = E[k] + W_8^k O[k], r[bitrev3(k + 4)] = E[k] - W_8^k O[k]
+    r[0].re = e0r + o0r;
+    r[0].im = e0i + o0i;
+    r[1].re = e0r - o0r;
+    r[1].im = e0i - o0i;
+    r[4].re = e1r + t1r;
+    r[4].im = e1i + t1i;
+    r[5].re = e1r - t1r;
+    r[5].im = e1i - t1i;
+    r[2].re = e2r + t2r;
+    r[2].im = e2i + t2i;
+    r[3].re = e2r - t2r;
+    r[3].im = e2i - t2i;
+    r[6].re = e3r + t3r;
+    r[6].im = e3i + t3i;
+    r[7].re = e3r - t3r;
+    r[7].im = e3i - t3i;
+
+    output[index] = r[0];
+    if (twiddle_index == 0) {
+        for (k = 1; k < 8; k++)
+            output[index + k * distance] = r[k];
+    } else {
+        // position p holds output bitrev3(p) of the butterfly
+        static const uint8_t bitrev3[8] = { 0, 4, 2, 6, 1, 5, 3, 7 };
+        for (k = 1; k < 8; k++)
+            output[index + k * distance] =
+                complex_mul(mixed_twiddle(twiddle_ptr, bitrev3[k] * twiddle_index, half), r[k]);
+    }
+}
+
+/* radix-4 butterfly of the mixed-radix FFT, see mixed_butterfly_radix8 */
+static inline void mixed_butterfly_radix4(Complex_type_f32 *input,
+                                          Complex_type_f32 *output,
+                                          uint32_t twiddle_index,
+                                          int index,
+                                          int distance,
+                                          const Complex_type_f32 *twiddle_ptr,
+                                          uint32_t half) {
+
+    Complex_type_f32 x0 = input[index];
+    Complex_type_f32 x1 = input[index + distance];
+    Complex_type_f32 x2 = input[index + 2 * distance];
+    Complex_type_f32 x3 = input[index + 3 * distance];
+    Complex_type_f32 r0, r1, r2, r3;
+
+    float32_t a0r = x0.re + x2.re, a0i = x0.im + x2.im;
+    float32_t a1r = x0.re - x2.re, a1i = x0.im - x2.im;
+    float32_t a2r = x1.re + x3.re, a2i = x1.im + x3.im;
+    float32_t a3r = x1.re - x3.re, a3i = x1.im - x3.im;
+
+    // outputs 0, 2, 1, 3 of the butterfly, in bit-reversed order
+    r0.re = a0r + a2r;
+    r0.im = a0i + a2i;
+    r1.re = a0r - a2r;
+    r1.im = a0i - a2i;
+    r2.re = a1r + a3i;
+    r2.im = a1i - a3r;
+    r3.re = a1r - a3i;
+    r3.im = a1i + a3r;
+
+    output[index] = r0;
+    if (twiddle_index == 0) {
+        output[index + distance] = r1;
+        output[index + 2 * distance] = r2;
+        output[index + 3 * distance] = r3;
+    } else {
+        output[index + distance] =
+            complex_mul(mixed_twiddle(twiddle_ptr, 2 * twiddle_index, half), r1);
+        output[index + 2 * distance] =
+            complex_mul(mixed_twiddle(twiddle_ptr, twiddle_index, half), r2);
+        output[index + 3 * distance] =
+            complex_mul(mixed_twiddle(twiddle_ptr, 3 * twiddle_index, half), r3);
+    }
+}
+
+/* radix-2 butterfly of the mixed-radix FFT, only used as last stage (FFTLength == 2) */
+static inline void mixed_butterfly_radix2(Complex_type_f32 *input,
+                                          Complex_type_f32 *output,
+                                          int index,
+                                          int distance) {
+
+    Complex_type_f32 x0 = input[index];
+    Complex_type_f32 x1 = input[index + distance];
+
+    output[index].re = x0.re + x1.re;
+    output[index].im = x0.im + x1.im;
+    output[index + distance].re = x0.re - x1.re;
+    output[index + distance].im = x0.im - x1.im;
+}
+
 int bit_rev_radix4(int index, int log2FFTLen) //digit reverse 2 bit blocks
 {
   int i;
@@ -0,0 +1,293 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q32p_xpulpv2.c
+ * Description:  Parallel 32-bit fixed point Fast Fourier Transform on Complex Input Data
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/* (re + j im) * (co - j si) in Q31, rounded; si is negated by the caller for the inverse FFT */
+#define cmplx_mult_q32_re(re, im, co, si) \
+    ((int32_t)((((int64_t)(re) * (co)) + ((int64_t)(im) * (si)) + 0x40000000LL) >> 31))
+
+#define cmplx_mult_q32_im(re, im, co, si) \
+    ((int32_t)((((int64_t)(im) * (co)) - ((int64_t)(re) * (si)) + 0x40000000LL) >> 31))
+
+static void plp_radix2_stage_q32(int32_t *pSrc,
+                                 uint32_t fftLen,
+                                 const int32_t *pCoef,
+                                 int32_t siSign,
+                                 uint32_t shift,
+                                 uint32_t nPE);
+
+static void plp_radix4_butterfly_q32p(int32_t *pSrc,
+                                      uint32_t fftLen,
+                                      uint32_t nBlocks,
+                                      const int32_t *pCoef,
+                                      uint32_t twidCoefModifier,
+                                      int32_t siSign,
+                                      uint32_t scaleMask,
+                                      uint32_t nPE);
+
+/**
+ * @brief      Parallel quantized 32 bit complex fast fourier transform for XPULPV2
+ * @details    Lengths 4^k run radix-4 stages only, lengths 2*4^k run a radix-2 stage followed
+ *             by the radix-4 stages on both halves (radix-4 by 2). In every stage the
+ *             butterflies are split in contiguous blocks among the cores, with a barrier between
+ *             the stages. Stage s (in execution order) divides its outputs by its radix if bit s
+ *             of scaleMask is set, and runs at full gain otherwise.
+ * @param[in]   args    points to the plp_cfft_instance_q32_parallel
+ */
+
+void plp_cfft_q32p_xpulpv2(void *args) {
+    plp_cfft_instance_q32_parallel *a = (plp_cfft_instance_q32_parallel *)args;
+
+    uint32_t L = a->S->fftLen;
+    const int32_t *pCoef = a->S->pTwiddle;
+    int32_t siSign = a->ifftFlag ? -1 : 1;
+
+    switch (L) {
+    case 16:
+    case 64:
+    case 256:
+    case 1024:
+    case 4096:
+        plp_radix4_butterfly_q32p(a->p1, L, 1, pCoef, 1, siSign, a->scaleMask, a->nPE);
+        break;
+    case 32:
+    case 128:
+    case 512:
+    case 2048:
+        plp_radix2_stage_q32(a->p1, L, pCoef, siSign, a->scaleMask & 1, a->nPE);
+        hal_team_barrier();
+        plp_radix4_butterfly_q32p(a->p1, L >> 1, 2, pCoef, 2, siSign, a->scaleMask >> 1,
+                                  a->nPE);
+        break;
+    }
+    hal_team_barrier();
+
+    if (a->bitReverseFlag) {
+        plp_bitreversal_32p_xpulpv2((uint32_t *)a->p1, a->S->bitRevLength,
+                                    (const uint16_t *)a->S->pBitRevTable, a->nPE);
+        hal_team_barrier();
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
+
+/*
+ * Radix-2 decimation in frequency stage over the full length, the outputs x(n) + x(n+N/2) and
+ * (x(n) - x(n+N/2)) * W^n are the inputs of the two FFTs of length N/2.
+ */
+static void plp_radix2_stage_q32(int32_t *pSrc,
+                                 uint32_t fftLen,
+                                 const int32_t *pCoef,
+                                 int32_t siSign,
+                                 uint32_t shift,
+                                 uint32_t nPE) {
+    int core_id = hal_core_id();
+    uint32_t i, l, n2, step;
+    int32_t xa, ya, xb, yb, xt, yt, co, si;
+
+    n2 = fftLen >> 1;
+    step = (n2 + nPE - 1) / nPE;
+
+    for (i = core_id * step; i < MIN(core_id * step + step, n2); i++) {
+        l = i + n2;
+
+        co = pCoef[2 * i];
+        si = siSign * pCoef[2 * i + 1];
+
+        xa = pSrc[2 * i] >> shift;
+        ya = pSrc[2 * i + 1] >> shift;
+        xb = pSrc[2 * l] >> shift;
+        yb = pSrc[2 * l + 1] >> shift;
+
+        pSrc[2 * i] = xa + xb;
+        pSrc[2 * i + 1] = ya + yb;
+
+        xt = xa - xb;
+        yt = ya - yb;
+        pSrc[2 * l] = cmplx_mult_q32_re(xt, yt, co, si);
+        pSrc[2 * l + 1] = cmplx_mult_q32_im(xt, yt, co, si);
+    }
+}
+
+/*
+ * Radix-4 decimation in frequency FFT of nBlocks consecutive buffers of length fftLen (see
+ * plp_cfft_q16p_xpulpv2.c for the butterfly equations). Outputs are stored in the order of the
+ * CMSIS radix-4 FFT, so the plpBitRevIndexTable_fixed_* tables apply.
+ */
+static void plp_radix4_butterfly_q32p(int32_t *pSrc,
+                                      uint32_t fftLen,
+                                      uint32_t nBlocks,
+                                      const int32_t *pCoef,
+                                      uint32_t twidCoefModifier,
+                                      int32_t siSign,
+                                      uint32_t scaleMask,
+                                      uint32_t nPE) {
+    int core_id = hal_core_id();
+    uint32_t n1, n2, b, j, g, blk, i0, i1, i2, i3, ic, step, shift, nButterflies, groups;
+    uint32_t log2Quarter = 0, log2Groups = 0;
+    uint32_t jPrev = 0xFFFFFFFF;
+    int32_t xa, xb, xc, xd, ya, yb, yc, yd;
+    int32_t r1, r2, s1, s2, t1, t2;
+    int32_t co1 = 0, si1 = 0, co2 = 0, si2 = 0, co3 = 0, si3 = 0;
+    int32_t *pBuf;
+
+    /* butterflies per stage, over all the blocks */
+    nButterflies = nBlocks * (fftLen >> 2);
+    step = (nButterflies + nPE - 1) / nPE;
+
+    /* all the divisors of the butterfly index are powers of two */
+    while ((1U << log2Quarter) < (fftLen >> 2))
+        log2Quarter++;
+
+    /* first and middle stages */
+    for (n1 = fftLen; n1 > 4; n1 >>= 2, log2Groups += 2) {
+        n2 = n1 >> 2;
+        groups = 1U << log2Groups;
+        shift = (scaleMask & 1) ? 2 : 0;
+
+        /* butterfly b handles twiddle j of group g in block blk */
+        for (b = core_id * step; b < MIN(core_id * step + step, nButterflies); b++) {
+            blk = b >> log2Quarter;
+            j = (b & ((fftLen >> 2) - 1)) >> log2Groups;
+            g = b & (groups - 1);
+
+            if (j != jPrev) {
+                ic = j * twidCoefModifier;
+                co1 = pCoef[2 * ic];
+                si1 = siSign * pCoef[2 * ic + 1];
+                co2 = pCoef[4 * ic];
+                si2 = siSign * pCoef[4 * ic + 1];
+                co3 = pCoef[6 * ic];
+                si3 = siSign * pCoef[6 * ic + 1];
+                jPrev = j;
+            }
+
+            pBuf = pSrc + 2 * blk * fftLen;
+            i0 = g * n1 + j;
+            i1 = i0 + n2;
+            i2 = i1 + n2;
+            i3 = i2 + n2;
+
+            xa = pBuf[2 * i0] >> shift;
+            ya = pBuf[2 * i0 + 1] >> shift;
+            xb = pBuf[2 * i1] >> shift;
+            yb = pBuf[2 * i1 + 1] >> shift;
+            xc = pBuf[2 * i2] >> shift;
+            yc = pBuf[2 * i2 + 1] >> shift;
+            xd = pBuf[2 * i3] >> shift;
+            yd = pBuf[2 * i3 + 1] >> shift;
+
+            r1 = xa + xc;
+            r2 = xa - xc;
+            s1 = ya + yc;
+            s2 = ya - yc;
+            t1 = xb + xd;
+            t2 = yb + yd;
+
+            /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+            pBuf[2 * i0] = r1 + t1;
+            pBuf[2 * i0 + 1] = s1 + t2;
+
+            /* (xc', yc') = (xa-xb+xc-xd, ya-yb+yc-yd) * W2n */
+            r1 = r1 - t1;
+            s1 = s1 - t2;
+            pBuf[2 * i1] = cmplx_mult_q32_re(r1, s1, co2, si2);
+            pBuf[2 * i1 + 1] = cmplx_mult_q32_im(r1, s1, co2, si2);
+
+            /* the inverse FFT multiplies by +j instead of -j */
+            t1 = siSign * (yb - yd);
+            t2 = siSign * (xb - xd);
+
+            /* (xb', yb') = (xa+yb-xc-yd, ya-xb-yc+xd) * Wn */
+            r1 = r2 + t1;
+            s1 = s2 - t2;
+            pBuf[2 * i2] = cmplx_mult_q32_re(r1, s1, co1, si1);
+            pBuf[2 * i2 + 1] = cmplx_mult_q32_im(r1, s1, co1, si1);
+
+            /* (xd', yd') = (xa-yb-xc+yd, ya+xb-yc-xd) * W3n */
+            r2 = r2 - t1;
+            s2 = s2 + t2;
+            pBuf[2 * i3] = cmplx_mult_q32_re(r2, s2, co3, si3);
+            pBuf[2 * i3 + 1] = cmplx_mult_q32_im(r2, s2, co3, si3);
+        }
+
+        twidCoefModifier <<= 2;
+        scaleMask >>= 1;
+        jPrev = 0xFFFFFFFF;
+        hal_team_barrier();
+    }
+
+    /* last stage, twiddle factors are all 1 */
+    shift = (scaleMask & 1) ? 2 : 0;
+    for (b = core_id * step; b < MIN(core_id * step + step, nButterflies); b++) {
+        pBuf = pSrc + 8 * b;
+
+        xa = pBuf[0] >> shift;
+        ya = pBuf[1] >> shift;
+        xb = pBuf[2] >> shift;
+        yb = pBuf[3] >> shift;
+        xc = pBuf[4] >> shift;
+        yc = pBuf[5] >> shift;
+        xd = pBuf[6] >> shift;
+        yd = pBuf[7] >> shift;
+
+        /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+        pBuf[0] = xa + xb + xc + xd;
+        pBuf[1] = ya + yb + yc + yd;
+
+        /* xc' = xa - xb + xc - xd, yc' = ya - yb + yc - yd */
+        pBuf[2] = xa - xb + xc - xd;
+        pBuf[3] = ya - yb + yc - yd;
+
+        /* the inverse FFT multiplies by +j instead of -j */
+        t1 = siSign * (yb - yd);
+        t2 = siSign * (xb - xd);
+
+        /* xb' = xa + yb - xc - yd, yb' = ya - xb - yc + xd */
+        pBuf[4] = xa - xc + t1;
+        pBuf[5] = ya - yc - t2;
+
+        /* xd' = xa - yb - xc + yd, yd' = ya + xb - yc - xd */
+        pBuf[6] = xa - xc - t1;
+        pBuf[7] = ya - yc + t2;
+    }
+}
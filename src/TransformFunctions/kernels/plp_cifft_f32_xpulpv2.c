@@ -0,0 +1,123 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cifft_f32_xpulpv2.c
+ * Description:  Floating-point inverse FFT on complex input data for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @defgroup complexIFFTKernels Inverse FFT kernels on complex input values
+  These kernels compute the inverse FFT as IFFT(x) = conj(FFT(conj(x))) / FFTLength, with the
+  forward FFT kernels and the same instance (and twiddle factors). The conjugation of the input
+  also copies it to the output buffer, on which the forward FFT then runs in place. The
+  FFTLengths of plp_cfft_f32_xpulpv2 are supported.
+*/
+
+/**
+  @addtogroup complexIFFTKernels
+  @{
+ */
+
+/**
+   @brief  Floating-point inverse FFT on complex input data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data), can be equal to pSrc
+   @return      none
+*/
+void plp_cifft_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pDst) {
+
+    uint32_t i;
+    uint32_t N = S->FFTLength;
+    float32_t scale = 1.0f / N;
+
+    // CONJUGATE the input into the output buffer
+    for (i = 0; i < N; i++) {
+        pDst[2 * i] = pSrc[2 * i];
+        pDst[2 * i + 1] = -pSrc[2 * i + 1];
+    }
+
+    // FORWARD FFT, in place
+    plp_cfft_f32_xpulpv2(S, pDst, pDst);
+
+    // CONJUGATE and SCALE the result
+    for (i = 0; i < N; i++) {
+        pDst[2 * i] *= scale;
+        pDst[2 * i + 1] *= -scale;
+    }
+}
+
+/**
+   @brief  Floating-point inverse FFT on complex input data for XPULPV2 extension (parallel
+           version).
+   @param[in]   args     points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_cifft_f32_xpulpv2_parallel(void *args) {
+
+    uint32_t i;
+
+    plp_fft_instance_f32_parallel *arg = (plp_fft_instance_f32_parallel *)args;
+    plp_fft_instance_f32 *S = arg->S;
+    const float32_t *pSrc = arg->pSrc;
+    const uint32_t nPE = arg->nPE;
+    float32_t *pDst = arg->pDst;
+
+    uint32_t N = S->FFTLength;
+    float32_t scale = 1.0f / N;
+
+    int core_id = hal_core_id();
+
+    // CONJUGATE the input into the output buffer
+    for (i = core_id; i < N; i += nPE) {
+        pDst[2 * i] = pSrc[2 * i];
+        pDst[2 * i + 1] = -pSrc[2 * i + 1];
+    }
+
+    hal_team_barrier();
+
+    // FORWARD FFT, in place, ends with a barrier
+    plp_fft_instance_f32_parallel fft = { S, pDst, nPE, pDst };
+    plp_cfft_f32_xpulpv2_parallel(&fft);
+
+    // CONJUGATE and SCALE the result
+    for (i = core_id; i < N; i += nPE) {
+        pDst[2 * i] *= scale;
+        pDst[2 * i + 1] *= -scale;
+    }
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of complexIFFTKernels group
+*/
@@ -0,0 +1,223 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_f32p_xpulpv2.c
+ * Description:  Fused parallel floating-point MFCC kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+
+static inline void power_split(const Complex_type_f32 *fft,
+                               float32_t *power,
+                               int index,
+                               int nCplx,
+                               const uint16_t *pLUT,
+                               const Complex_type_f32 *twiddle_ptr);
+
+static inline float32_t mel_energy(const float32_t *pMag, const float32_t *pFilter, int length);
+
+/**
+  @ingroup feature
+ */
+
+/**
+  @defgroup featureKernels feature transform kernels
+  These kernels compute feature transforms inside a single team fork.
+*/
+
+/**
+  @addtogroup featureKernels
+  @{
+ */
+
+/**
+   @brief  Fused MFCC on real input data for XPULPV2 extension (parallel version).
+   @details All the steps run on the same team of cores, separated by barriers:
+            1. RFFT of the windowed input. The window is applied while the first stage of the
+               complex FFT loads its input, and the final split stage of the RFFT directly
+               returns the power spectrum |X[k]|^2, so neither the windowed signal nor the complex
+               spectrum is written back to memory.
+            2. Mel filterbank and offset, one filter at a time per core.
+            3. DCT-II of the log mels (Makhoul): the log (plp_vlog_f32s_xpulpv2) runs in place on
+               a contiguous block of mels per core, followed by the reordering, the RFFT and the
+               final rotation, all split across the cores.
+            Buffer usage, with N = n_fft and M = n_mels: pDst[N .. 2N) holds the complex FFT,
+            pDst[2N .. 2N + N/2 + 1) the power spectrum; the DCT reuses pDst[N .. N + M) and
+            pDst[2N .. 2N + 2M).
+   @param[in]   args  points to the instance structure plp_mfcc_instance_f32_parallel
+   @return      none
+*/
+void plp_mfcc_f32p_xpulpv2(void *args) {
+
+    plp_mfcc_instance_f32_parallel *a = (plp_mfcc_instance_f32_parallel *)args;
+    const plp_fft_instance_f32 *SFFT = a->SFFT;
+    const plp_fft_instance_f32 *SDCT = a->SDCT;
+    const plp_triangular_filter_f32 *filterBank = a->filterBank;
+    const uint32_t nPE = a->nPE;
+    float32_t *pDst = a->pDst;
+
+    int k, i;
+    int core_id = hal_core_id();
+    int n_fft = SFFT->FFTLength;
+    int nCplx = n_fft >> 1;
+    int n_mels = filterBank->nFilters;
+
+    Complex_type_f32 *fft = (Complex_type_f32 *)(pDst + n_fft);
+    float32_t *power = pDst + 2 * n_fft;
+    float32_t *mel_logs = pDst;
+
+    // 1: windowed RFFT, the complex FFT of length n_fft/2 ends with a barrier
+    plp_cfft_mixed_windowed_f32_xpulpv2_parallel(a->pSrc, a->window, (float32_t *)fft, nCplx,
+                                                 SFFT->pTwiddleFactors, 2, nPE);
+
+    for (k = core_id; k <= (nCplx >> 1); k += nPE) {
+        power_split(fft, power, k, nCplx, SFFT->pBitReverseLUT,
+                    (const Complex_type_f32 *)SFFT->pTwiddleFactors);
+    }
+
+    hal_team_barrier();
+
+    // 2: mel filterbank, the offset is copied from pytorch
+    const float32_t *pFilter = filterBank->V;
+    int filter = 0; // filter pFilter points to
+    for (i = core_id; i < n_mels; i += nPE) {
+        for (; filter < i; filter++)
+            pFilter += filterBank->filterLength[filter];
+        float32_t energy =
+            mel_energy(power + filterBank->firstValue[i], pFilter, filterBank->filterLength[i]);
+        mel_logs[i] = energy + 1e-6f;
+    }
+
+    hal_team_barrier();
+
+    // 3: DCT of log mels, the log runs in place on a contiguous block per core
+    uint32_t start, end;
+    plp_partition(n_mels, nPE, core_id, 2, &start, &end);
+    if (end > start)
+        plp_vlog_f32s_xpulpv2(mel_logs + start, end - start, mel_logs + start);
+
+    hal_team_barrier();
+
+    // reordering: even indices first, odd indices reversed
+    float32_t *dct_in = pDst + n_fft;
+    float32_t *dct_out = pDst + 2 * n_fft;
+    for (i = core_id; i < n_mels / 2; i += nPE) {
+        dct_in[i] = mel_logs[2 * i];
+        dct_in[n_mels - 1 - i] = mel_logs[2 * i + 1];
+    }
+
+    hal_team_barrier();
+
+    plp_fft_instance_f32_parallel rfftArgs = (plp_fft_instance_f32_parallel){
+        (plp_fft_instance_f32 *)SDCT, dct_in, nPE, dct_out
+    };
+    plp_rfft_f32_xpulpv2_parallel(&rfftArgs);
+
+    // shift by pShift, the bins above n_mels/2 follow from X[k] = X*[n_mels - k]
+    Complex_type_f32 *spectrum = (Complex_type_f32 *)dct_out;
+    const Complex_type_f32 *pShift = a->pShift;
+    float32_t scale = a->orthoNorm ? sqrtf(2.f / (float32_t)n_mels) : 2.f;
+    for (k = core_id; k < n_mels; k += nPE) {
+        float32_t re, im;
+        if (k <= n_mels / 2) {
+            re = spectrum[k].re;
+            im = spectrum[k].im;
+        } else {
+            re = spectrum[n_mels - k].re;
+            im = -spectrum[n_mels - k].im;
+        }
+        float32_t y = (re * pShift[k].re - im * pShift[k].im) * scale;
+        if (k == 0 && a->orthoNorm)
+            y *= M_SQRT1_2;
+        pDst[k] = y;
+    }
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of featureKernels group
+*/
+
+/*
+ * Final split stage of the real FFT (see plp_rfft_f32_xpulpv2), returning the power of bins
+ * index and nCplx-index instead of the complex values.
+ */
+static inline void power_split(const Complex_type_f32 *fft,
+                               float32_t *power,
+                               int index,
+                               int nCplx,
+                               const uint16_t *pLUT,
+                               const Complex_type_f32 *twiddle_ptr) {
+
+    if (index == 0) {
+        Complex_type_f32 z0 = fft[0];
+        float32_t r0 = z0.re + z0.im;
+        float32_t r1 = z0.re - z0.im;
+        power[0] = r0 * r0;
+        power[nCplx] = r1 * r1;
+        return;
+    }
+
+    // bin k of the complex FFT is at bitreverse_{N/2}(k) = bitreverse_N(2k)
+    uint32_t ia = pLUT ? pLUT[2 * index] : plp_cfft_mixed_rev_index_f32(index, nCplx);
+    uint32_t ib =
+        pLUT ? pLUT[2 * (nCplx - index)] : plp_cfft_mixed_rev_index_f32(nCplx - index, nCplx);
+    Complex_type_f32 a = fft[ia];
+    Complex_type_f32 b = fft[ib];
+    Complex_type_f32 tw = twiddle_ptr[index];
+
+    float32_t e_re = 0.5f * (a.re + b.re);
+    float32_t e_im = 0.5f * (a.im - b.im);
+    float32_t o_re = 0.5f * (a.im + b.im);
+    float32_t o_im = 0.5f * (b.re - a.re);
+
+    float32_t t_re = tw.re * o_re - tw.im * o_im;
+    float32_t t_im = tw.re * o_im + tw.im * o_re;
+
+    float32_t r0_re = e_re + t_re;
+    float32_t r0_im = e_im + t_im;
+    float32_t r1_re = e_re - t_re;
+    float32_t r1_im = t_im - e_im;
+
+    power[index] = r0_re * r0_re + r0_im * r0_im;
+    power[nCplx - index] = r1_re * r1_re + r1_im * r1_im;
+}
+
+/* dot product of a filter with the power spectrum, unrolled with two accumulators */
+static inline float32_t mel_energy(const float32_t *pMag, const float32_t *pFilter, int length) {
+    int i;
+    float32_t sum0 = 0.f, sum1 = 0.f;
+
+    for (i = 0; i < (length & ~1); i += 2) {
+        sum0 += pMag[i] * pFilter[i];
+        sum1 += pMag[i + 1] * pFilter[i + 1];
+    }
+    if (length & 1)
+        sum0 += pMag[length - 1] * pFilter[length - 1];
+
+    return sum0 + sum1;
+}
@@ -3,8 +3,8 @@
  * Title:        plp_rfft_f32_xpulpv2.c
  * Description:  Floating-point FFT on real input data for XPULPV2
  *
- * $Date:        10. Aug 2020
- * $Revision:    V1
+ * $Date:        18. October 2026
+ * $Revision:    V2
  *
  * Target Processor: PULP cores with "F" support (wolfe, vega)
  * ===================================================================== */
@@ -28,29 +28,38 @@
  * limitations under the License.
  */
 
+
 #include "plp_math.h"
 
 /* HELPER FUNCTIONS */
 
-int bit_rev_radix2(int index, int log2FFTLen);
-static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B);
-static inline Complex_type_f32 complex_mul_real(float32_t A, Complex_type_f32 B);
-static inline void process_butterfly_real_radix2(const float32_t *input,
-                                                 Complex_type_f32 *output,
-                                                 int twiddle_index,
-                                                 int distance,
-                                                 Complex_type_f32 *twiddle_ptr);
-static inline void process_butterfly_radix2(Complex_type_f32 *input,
-                                            int twiddle_index,
-                                            int index,
-                                            int distance,
-                                            Complex_type_f32 *twiddle_ptr);
-static inline void process_butterfly_last_radix2_partial(Complex_type_f32 *input,
-                                                         Complex_type_f32 *output,
-                                                         int outindex);
-static inline void process_butterfly_last_radix2_full(Complex_type_f32 *input,
-                                                      Complex_type_f32 *output,
-                                                      int outindex);
+static inline uint32_t rev_index(const uint16_t *pLUT, uint32_t index, uint32_t nCplx);
+static inline uint32_t bit_rev_index(const uint16_t *pLUT, uint32_t index, uint32_t FFTLength);
+static inline void bit_rev_swap(Complex_type_f32 *buf, uint32_t index, uint32_t rev);
+static inline uint32_t reorder_src(const uint16_t *pLUT,
+                                   uint32_t index,
+                                   uint32_t nCplx,
+                                   uint32_t negate);
+static inline void reorder_cycle(Complex_type_f32 *fft,
+                                 uint32_t start,
+                                 uint32_t nCplx,
+                                 const uint16_t *pLUT,
+                                 uint32_t negate);
+static inline void process_split(Complex_type_f32 *fft,
+                                 Complex_type_f32 *output,
+                                 int index,
+                                 int nCplx,
+                                 uint32_t ia,
+                                 uint32_t ib,
+                                 uint32_t oa,
+                                 uint32_t ob,
+                                 Complex_type_f32 *twiddle_ptr);
+static inline void process_merge(const Complex_type_f32 *input,
+                                 Complex_type_f32 *output,
+                                 uint32_t index,
+                                 uint32_t nCplx,
+                                 float32_t scale,
+                                 const Complex_type_f32 *twiddle_ptr);
 
 /**
   @ingroup fft
@@ -62,8 +71,32 @@ static inline void process_butterfly_last_radix2_full(Complex_type_f32 *input,
   If the dimension of input is FFTLen float32 numbers, the output buffer must contain
   at least (2*FFTLen) float32 values (used for intermediate computations).
   Due to the symmetry of real FFT only the first (FFTLen + 2) values of the result
-  are computed in the last stage, corresponding to (FFTLen / 2 + 1) complex values.
-  Supported algorithms: radix-2
+  are computed, corresponding to (FFTLen / 2 + 1) complex values.
+  The FFTLen real values are processed as FFTLen/2 complex values by the mixed radix-8/4
+  complex FFT (plp_cfft_mixed_f32_xpulpv2), which runs on the FFTLen/2 twiddle factors of the
+  instance and whose bit-reversed result is stored in the upper half of the output buffer. A
+  final split stage separates the even and odd samples and writes the spectrum, in natural order,
+  to the lower half of the output buffer. If bitReverseFlag is 0, the spectrum is extended to all
+  FFTLen bins by conjugate symmetry and left in bit-reversed order, as the radix-2 FFT does.
+  Every power of two FFTLen >= 16 is supported.
+
+  The in-place kernels (plp_rfft_in_place_f32_xpulpv2) need a single buffer of (FFTLen + 2)
+  float32 values and no scratch memory: the complex FFT runs in place on the input, its
+  bit-reversed result is brought into natural order by swapping pairs of values, and the split
+  stage reads and writes the bins k and FFTLen/2 - k in the same call. If bitReverseFlag is 0, the
+  reordering is skipped and bin k < FFTLen/2 is left at position bitreverse(2k), the Nyquist bin
+  at position FFTLen/2.
+
+  The inverse kernels (plp_rifft_f32_xpulpv2) run the same steps backwards: a merge stage combines
+  the bins k and FFTLen/2 - k of the (FFTLen/2 + 1) input bins into the FFT of x[2n] + j x[2n+1],
+  scaled by 1/FFTLen, the forward complex FFT runs on it in place, and the reordering moves bin -n
+  of its result to position n, since IFFT(Z)[n] = FFT(Z)[-n] / (FFTLen/2). The output buffer can be
+  the input buffer, no scratch memory is needed. The inverse kernels take the input in natural
+  order and always return the output in natural order.
+
+  The bit reversal LUT of the instance holds bitreverse(k) over log2(FFTLen) bits for
+  k = 0 .. FFTLen-1, as for the radix-2 FFT; the kernels compute the values on the fly if it is
+  NULL.
 */
 
 /**
@@ -82,370 +115,424 @@ void plp_rfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
                           const float32_t *__restrict__ pSrc,
                           float32_t *__restrict__ pDst) {
 
-    int k, j, stage, step, d, index;
-
-    Complex_type_f32 temp;
-    int dist = S->FFTLength >> 1;
-    int nbutterfly = S->FFTLength >> 1;
-    int butt = 2; // number of butterflies in the same group
-
-    const float32_t *_in_ptr_real;
-    Complex_type_f32 *_in_ptr;
-    Complex_type_f32 *_out_ptr;
-    Complex_type_f32 *_tw_ptr;
-
-    // FIRST STAGE, input is real
-    stage = 1;
-
-    _in_ptr_real = pSrc;
-    _in_ptr = (Complex_type_f32 *)pDst;
-    _tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
-
-    for (j = 0; j < nbutterfly; j++) {
-        process_butterfly_real_radix2(_in_ptr_real, _in_ptr, j, dist, _tw_ptr);
-        _in_ptr_real++;
-        _in_ptr++;
-    } // j
-
-    stage = stage + 1;
-    dist = dist >> 1;
-
-    // STAGES 2 -> n-1
-    while (dist > 1) {
-        step = dist << 1;
-        for (j = 0; j < butt; j++) {
-            _in_ptr = (Complex_type_f32 *)pDst;
-            for (d = 0; d < dist; d++) {
-                process_butterfly_radix2(_in_ptr, d * butt, j * step, dist, _tw_ptr);
-                _in_ptr++;
-            } // d
-        } // j
-        stage = stage + 1;
-        dist = dist >> 1;
-        butt = butt << 1;
-    }
-
-    // LAST STAGE
-    _in_ptr = (Complex_type_f32 *)pDst;
-    index = 0;
-    process_butterfly_last_radix2_full(_in_ptr, (Complex_type_f32 *)pDst, index);
-    _in_ptr += 2;
-    index   += 2;
-    for (j = 1; j < (S->FFTLength >> 1); j++) {
-        process_butterfly_last_radix2_partial(_in_ptr, (Complex_type_f32 *)pDst, index);
-        _in_ptr += 2;
-        index += 2;
-    } // j
-
-    // ORDER VALUES
-    if (S->bitReverseFlag) {
-        int index1, index2, index3, index4;
-        _out_ptr = (Complex_type_f32 *)pDst;
-        for (j = 0; j < S->FFTLength; j += 4) {
-            if (S->pBitReverseLUT) {
-                unsigned int index12 = *((unsigned int *)(&S->pBitReverseLUT[j]));
-                unsigned int index34 = *((unsigned int *)(&S->pBitReverseLUT[j + 2]));
-                index1 = index12 & 0x0000FFFF;
-                index2 = index12 >> 16;
-                index3 = index34 & 0x0000FFFF;
-                index4 = index34 >> 16;
-            } else {
-                int log2FFTLen = log2(S->FFTLength);
-                index1 = bit_rev_radix2(j, log2FFTLen);
-                index2 = bit_rev_radix2(j + 1, log2FFTLen);
-                index3 = bit_rev_radix2(j + 2, log2FFTLen);
-                index4 = bit_rev_radix2(j + 3, log2FFTLen);
-            }
-            if (index1 > j) {
-                temp = _out_ptr[j];
-                _out_ptr[j] = _out_ptr[index1];
-                _out_ptr[index1] = temp;
-            }
-            if (index2 > j + 1) {
-                temp = _out_ptr[j + 1];
-                _out_ptr[j + 1] = _out_ptr[index2];
-                _out_ptr[index2] = temp;
-            }
-            if (index3 > j + 2) {
-                temp = _out_ptr[j + 2];
-                _out_ptr[j + 2] = _out_ptr[index3];
-                _out_ptr[index3] = temp;
-            }
-            if (index4 > j + 3) {
-                temp = _out_ptr[j + 3];
-                _out_ptr[j + 3] = _out_ptr[index4];
-                _out_ptr[index4] = temp;
-            }
-        }
-    }
+    uint32_t k;
+    uint32_t nCplx = S->FFTLength >> 1;
+
+    Complex_type_f32 *_out_ptr = (Complex_type_f32 *)pDst;
+    Complex_type_f32 *_fft_ptr = _out_ptr + nCplx;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+
+    // COMPLEX FFT of length FFTLength/2, twiddles W_{N/2}^k = W_N^{2k}
+    plp_cfft_mixed_f32_xpulpv2(pSrc, (float32_t *)_fft_ptr, nCplx, S->pTwiddleFactors, 2);
+
+    // SPLIT, bin 0 first since its result overwrites _fft_ptr[0]
+    for (k = 0; k <= (nCplx >> 1); k++) {
+        process_split(_fft_ptr, _out_ptr, k, nCplx, rev_index(S->pBitReverseLUT, k, nCplx),
+                      rev_index(S->pBitReverseLUT, (nCplx - k) & (nCplx - 1), nCplx), k,
+                      nCplx - k, _tw_ptr);
+    } // k
+
+    if (S->bitReverseFlag)
+        return;
+
+    // EXTEND by conjugate symmetry and ORDER VALUES in bit-reversed order
+    for (k = 1; k < nCplx; k++) {
+        _out_ptr[nCplx + k].re = _out_ptr[nCplx - k].re;
+        _out_ptr[nCplx + k].im = -_out_ptr[nCplx - k].im;
+    } // k
+    for (k = 0; k < S->FFTLength; k++) {
+        bit_rev_swap(_out_ptr, k, bit_rev_index(S->pBitReverseLUT, k, S->FFTLength));
+    } // k
 }
 
 /**
    @brief  Floating-point FFT on real input data for XPULPV2 extension.
-   @param[in]   arg      points to an instance of the floating-point FFT structure
+   @param[in]   args     points to an instance of the floating-point FFT structure
    @return      none
 */
-void plp_rfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
+void plp_rfft_f32_xpulpv2_parallel(void *args) {
 
-    int k, j, stage, step, d, index;
+    uint32_t k;
 
+    plp_fft_instance_f32_parallel *arg = (plp_fft_instance_f32_parallel *)args;
     plp_fft_instance_f32 *S = arg->S;
     const float32_t *pSrc = arg->pSrc;
     const uint32_t nPE = arg->nPE;
     float32_t *pDst = arg->pDst;
 
-    Complex_type_f32 temp;
-    int dist = S->FFTLength >> 1;
-    int nbutterfly = S->FFTLength >> 1;
-    int butt = 2; // number of butterflies in the same group
+    uint32_t nCplx = S->FFTLength >> 1;
 
-    const float32_t *_in_ptr_real;
-    Complex_type_f32 *_in_ptr;
-    Complex_type_f32 *_out_ptr;
-    Complex_type_f32 *_tw_ptr;
+    Complex_type_f32 *_out_ptr = (Complex_type_f32 *)pDst;
+    Complex_type_f32 *_fft_ptr = _out_ptr + nCplx;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
 
     int core_id = hal_core_id();
 
-    // FIRST STAGE, input is real, stage=1
-    stage = 1;
-    _in_ptr_real = &pSrc[core_id];
-    _in_ptr = (Complex_type_f32 *)&pDst[2 * core_id];
-    _tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+    // COMPLEX FFT of length FFTLength/2, ends with a barrier
+    plp_cfft_mixed_f32_xpulpv2_parallel(pSrc, (float32_t *)_fft_ptr, nCplx, S->pTwiddleFactors, 2,
+                                        nPE);
 
-    for (j = 0; j < nbutterfly / nPE; j++) {
-        process_butterfly_real_radix2(_in_ptr_real, _in_ptr, j * nPE + core_id, dist, _tw_ptr);
-        _in_ptr_real += nPE;
-        _in_ptr += nPE;
-    } // j
+    // SPLIT, only bin 0 reads _fft_ptr[0], which its result overwrites
+    for (k = core_id; k <= (nCplx >> 1); k += nPE) {
+        process_split(_fft_ptr, _out_ptr, k, nCplx, rev_index(S->pBitReverseLUT, k, nCplx),
+                      rev_index(S->pBitReverseLUT, (nCplx - k) & (nCplx - 1), nCplx), k,
+                      nCplx - k, _tw_ptr);
+    } // k
 
-    stage = stage + 1;
-    dist = dist >> 1;
+    hal_team_barrier();
 
-    // STAGES 2 -> n-1
-    while (dist > nPE / 2) {
-        hal_team_barrier();
-        step = dist << 1;
-        for (j = 0; j < butt; j++) {
-            _in_ptr = (Complex_type_f32 *)&pDst[2 * core_id];
-            for (d = 0; d < dist / nPE; d++) {
-                process_butterfly_radix2(_in_ptr, (d * nPE + core_id) * butt, j * step, dist,
-                                         _tw_ptr);
-                _in_ptr += nPE;
-            } // d
-        } // j
-        stage = stage + 1;
-        dist = dist >> 1;
-        butt = butt << 1;
-    }
+    if (S->bitReverseFlag)
+        return;
 
-    while (dist > 1) {
-        hal_team_barrier();
-        step = dist << 1;
-        for (j = 0; j < butt / nPE; j++) {
-            _in_ptr = _in_ptr = (Complex_type_f32 *)pDst;
-            ;
-            for (d = 0; d < dist; d++) {
-                process_butterfly_radix2(_in_ptr, butt * d, (j * nPE + core_id) * step, dist,
-                                         _tw_ptr);
-                _in_ptr++;
-            } // d
-        }     // j
-        stage = stage + 1;
-        dist = dist >> 1;
-        butt = butt << 1;
-    }
+    // EXTEND by conjugate symmetry and ORDER VALUES in bit-reversed order
+    for (k = core_id + 1; k < nCplx; k += nPE) {
+        _out_ptr[nCplx + k].re = _out_ptr[nCplx - k].re;
+        _out_ptr[nCplx + k].im = -_out_ptr[nCplx - k].im;
+    } // k
 
     hal_team_barrier();
 
-    // LAST STAGE
-    _in_ptr = (Complex_type_f32 *)&pDst[4 * core_id];
-    index = 2 * core_id;
-    if(core_id ==0 ) {
-      process_butterfly_last_radix2_full(_in_ptr, (Complex_type_f32 *)pDst, index);
-      _in_ptr += 2 * nPE;
-      index += 2 * nPE;
-      j = 1;
+    for (k = core_id; k < S->FFTLength; k += nPE) {
+        bit_rev_swap(_out_ptr, k, bit_rev_index(S->pBitReverseLUT, k, S->FFTLength));
+    } // k
+
+    hal_team_barrier();
+}
+
+/**
+   @brief  In-place floating-point FFT on real input data for XPULPV2 extension.
+   @param[in]   S           points to an instance of the floating-point FFT structure
+   @param[in,out] pSrcDst   points to the buffer of (FFTLength + 2) values, holding the real input
+                            in the first FFTLength values and the (FFTLength / 2 + 1) complex
+                            output values afterwards
+   @return      none
+*/
+void plp_rfft_in_place_f32_xpulpv2(const plp_fft_instance_f32 *S, float32_t *pSrcDst) {
+
+    uint32_t k;
+    uint32_t nCplx = S->FFTLength >> 1;
+
+    Complex_type_f32 *_buf_ptr = (Complex_type_f32 *)pSrcDst;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+
+    // COMPLEX FFT of length FFTLength/2, in place
+    plp_cfft_mixed_f32_xpulpv2(pSrcDst, pSrcDst, nCplx, S->pTwiddleFactors, 2);
+
+    if (S->bitReverseFlag) {
+        // ORDER VALUES
+        for (k = 0; k < nCplx; k++) {
+            bit_rev_swap(_buf_ptr, k, rev_index(S->pBitReverseLUT, k, nCplx));
+        } // k
+
+        // SPLIT, bin 0 also writes the Nyquist bin behind the input
+        for (k = 0; k <= (nCplx >> 1); k++) {
+            process_split(_buf_ptr, _buf_ptr, k, nCplx, k, (nCplx - k) & (nCplx - 1), k, nCplx - k,
+                          _tw_ptr);
+        } // k
+    } else {
+        // SPLIT in bit-reversed order, bin 0 also writes the Nyquist bin behind the input
+        for (k = 0; k <= (nCplx >> 1); k++) {
+            uint32_t ia = rev_index(S->pBitReverseLUT, k, nCplx);
+            uint32_t ib = rev_index(S->pBitReverseLUT, (nCplx - k) & (nCplx - 1), nCplx);
+            process_split(_buf_ptr, _buf_ptr, k, nCplx, ia, ib, ia, ib, _tw_ptr);
+        } // k
     }
-    else
-      j = 0;
+}
+
+/**
+   @brief  In-place floating-point FFT on real input data for XPULPV2 extension (parallel version).
+   @param[in]   args     points to an instance of the floating-point FFT structure, pSrc and pDst
+                         both point to the buffer of (FFTLength + 2) values
+   @return      none
+*/
+void plp_rfft_in_place_f32_xpulpv2_parallel(void *args) {
 
-    for (j = 0; j < S->FFTLength / (2 * nPE); j++) {
-        process_butterfly_last_radix2_partial(_in_ptr, (Complex_type_f32 *)pDst, index);
-        _in_ptr += 2 * nPE;
-        index += 2 * nPE;
-    } // j
+    uint32_t k;
 
-    hal_team_barrier();
+    plp_fft_instance_f32_parallel *arg = (plp_fft_instance_f32_parallel *)args;
+    plp_fft_instance_f32 *S = arg->S;
+    const uint32_t nPE = arg->nPE;
+    float32_t *pSrcDst = arg->pDst;
+
+    uint32_t nCplx = S->FFTLength >> 1;
+
+    Complex_type_f32 *_buf_ptr = (Complex_type_f32 *)pSrcDst;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+
+    int core_id = hal_core_id();
+
+    // COMPLEX FFT of length FFTLength/2, in place, ends with a barrier
+    plp_cfft_mixed_f32_xpulpv2_parallel(pSrcDst, pSrcDst, nCplx, S->pTwiddleFactors, 2, nPE);
 
-    // ORDER VALUES
     if (S->bitReverseFlag) {
+        // ORDER VALUES, every pair is swapped by the core of its smaller position
+        for (k = core_id; k < nCplx; k += nPE) {
+            bit_rev_swap(_buf_ptr, k, rev_index(S->pBitReverseLUT, k, nCplx));
+        } // k
 
-        int index1, index2, index3, index4;
-        _out_ptr = (Complex_type_f32 *)pDst;
-        for (j = 4 * core_id; j < S->FFTLength; j += nPE * 4) {
-            if (S->pBitReverseLUT) {
-                unsigned int index12 = *((unsigned int *)(&S->pBitReverseLUT[j]));
-                unsigned int index34 = *((unsigned int *)(&S->pBitReverseLUT[j + 2]));
-                index1 = index12 & 0x0000FFFF;
-                index2 = index12 >> 16;
-                index3 = index34 & 0x0000FFFF;
-                index4 = index34 >> 16;
-            } else {
-                int log2FFTLen = log2(S->FFTLength);
-                index1 = bit_rev_radix2(j, log2FFTLen);
-                index2 = bit_rev_radix2(j + 1, log2FFTLen);
-                index3 = bit_rev_radix2(j + 2, log2FFTLen);
-                index4 = bit_rev_radix2(j + 3, log2FFTLen);
-            }
-            if (index1 > j) {
-                temp = _out_ptr[j];
-                _out_ptr[j] = _out_ptr[index1];
-                _out_ptr[index1] = temp;
-            }
-            if (index2 > j + 1) {
-                temp = _out_ptr[j + 1];
-                _out_ptr[j + 1] = _out_ptr[index2];
-                _out_ptr[index2] = temp;
-            }
-            if (index3 > j + 2) {
-                temp = _out_ptr[j + 2];
-                _out_ptr[j + 2] = _out_ptr[index3];
-                _out_ptr[index3] = temp;
-            }
-            if (index4 > j + 3) {
-                temp = _out_ptr[j + 3];
-                _out_ptr[j + 3] = _out_ptr[index4];
-                _out_ptr[index4] = temp;
-            }
-        }
         hal_team_barrier();
+
+        // SPLIT, every call reads and writes its own pair of bins
+        for (k = core_id; k <= (nCplx >> 1); k += nPE) {
+            process_split(_buf_ptr, _buf_ptr, k, nCplx, k, (nCplx - k) & (nCplx - 1), k, nCplx - k,
+                          _tw_ptr);
+        } // k
+    } else {
+        // SPLIT in bit-reversed order, every call reads and writes its own pair of bins
+        for (k = core_id; k <= (nCplx >> 1); k += nPE) {
+            uint32_t ia = rev_index(S->pBitReverseLUT, k, nCplx);
+            uint32_t ib = rev_index(S->pBitReverseLUT, (nCplx - k) & (nCplx - 1), nCplx);
+            process_split(_buf_ptr, _buf_ptr, k, nCplx, ia, ib, ia, ib, _tw_ptr);
+        } // k
     }
+
+    hal_team_barrier();
 }
 
 /**
-   @} end of realFFTKernels group
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer of (FFTLength / 2 + 1) complex values
+   @param[out]  pDst    points to the output buffer of FFTLength real values, can be equal to pSrc
+   @return      none
 */
+void plp_rifft_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pDst) {
 
-int bit_rev_radix2(int index, int log2FFTLen) {
+    uint32_t k;
+    uint32_t nCplx = S->FFTLength >> 1;
+    float32_t scale = 0.5f / nCplx;
 
-    unsigned int revNum = 0;
-    unsigned i;
+    Complex_type_f32 *_buf_ptr = (Complex_type_f32 *)pDst;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
 
-    for (i = 0; i < log2FFTLen; i++) {
-        unsigned int temp = (index & (1 << i));
-        if (temp != 0)
-            revNum |= (1 << ((log2FFTLen - 1) - i));
-    }
+    // MERGE, bin 0 also reads the Nyquist bin behind the output
+    for (k = 0; k <= (nCplx >> 1); k++) {
+        process_merge((const Complex_type_f32 *)pSrc, _buf_ptr, k, nCplx, scale, _tw_ptr);
+    } // k
 
-    return revNum;
+    // COMPLEX FFT of length FFTLength/2, in place
+    plp_cfft_mixed_f32_xpulpv2(pDst, pDst, nCplx, S->pTwiddleFactors, 2);
+
+    // ORDER VALUES, bin -n goes to position n
+    for (k = 0; k < nCplx; k++) {
+        reorder_cycle(_buf_ptr, k, nCplx, S->pBitReverseLUT, 1);
+    } // k
 }
 
-static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B) {
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension (parallel
+           version).
+   @param[in]   args     points to an instance of the floating-point FFT structure, pSrc points to
+                         the (FFTLength / 2 + 1) complex input values and pDst to the FFTLength
+                         real output values, pDst can be equal to pSrc
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2_parallel(void *args) {
+
+    uint32_t k;
 
-    Complex_type_f32 result;
-    result.re = A.re * B.re - A.im * B.im;
-    result.im = A.re * B.im + A.im * B.re;
-    return result;
-}
+    plp_fft_instance_f32_parallel *arg = (plp_fft_instance_f32_parallel *)args;
+    plp_fft_instance_f32 *S = arg->S;
+    const float32_t *pSrc = arg->pSrc;
+    const uint32_t nPE = arg->nPE;
+    float32_t *pDst = arg->pDst;
+
+    uint32_t nCplx = S->FFTLength >> 1;
+    float32_t scale = 0.5f / nCplx;
+
+    Complex_type_f32 *_buf_ptr = (Complex_type_f32 *)pDst;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+
+    int core_id = hal_core_id();
 
-static inline Complex_type_f32 complex_mul_real(float32_t A, Complex_type_f32 B) {
+    // MERGE, every call reads and writes its own pair of bins
+    for (k = core_id; k <= (nCplx >> 1); k += nPE) {
+        process_merge((const Complex_type_f32 *)pSrc, _buf_ptr, k, nCplx, scale, _tw_ptr);
+    } // k
 
-    Complex_type_f32 result;
-    result.re = A * B.re;
-    result.im = A * B.im;
-    return result;
+    hal_team_barrier();
+
+    // COMPLEX FFT of length FFTLength/2, in place, ends with a barrier
+    plp_cfft_mixed_f32_xpulpv2_parallel(pDst, pDst, nCplx, S->pTwiddleFactors, 2, nPE);
+
+    // ORDER VALUES, bin -n goes to position n, every cycle is moved by the core of its smallest
+    // position
+    for (k = core_id; k < nCplx; k += nPE) {
+        reorder_cycle(_buf_ptr, k, nCplx, S->pBitReverseLUT, 1);
+    } // k
+
+    hal_team_barrier();
 }
 
-static inline void process_butterfly_real_radix2(const float32_t *input,
-                                                 Complex_type_f32 *output,
-                                                 int twiddle_index,
-                                                 int distance,
-                                                 Complex_type_f32 *twiddle_ptr) {
+/**
+   @} end of realFFTKernels group
+*/
 
-    int index = 0;
-    float32_t d0 = input[index];
-    float32_t d1 = input[index + distance];
+/*
+ * position of bin index in the bit-reversed result of the complex FFT of length nCplx, read from
+ * the LUT of the real FFT of length 2*nCplx since bitreverse_N(2k) = bitreverse_{N/2}(k)
+ */
+static inline uint32_t rev_index(const uint16_t *pLUT, uint32_t index, uint32_t nCplx) {
+    if (pLUT)
+        return pLUT[index << 1];
+    else
+        return plp_cfft_mixed_rev_index_f32(index, nCplx);
+}
 
-    Complex_type_f32 r0, r1;
+/* bit reversal of index over log2(FFTLength) bits */
+static inline uint32_t bit_rev_index(const uint16_t *pLUT, uint32_t index, uint32_t FFTLength) {
+    if (pLUT)
+        return pLUT[index];
+    else
+        return plp_cfft_mixed_rev_index_f32(index, FFTLength);
+}
 
-    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im, since c1 is real = c1.re*c2.re
-    r0.re = d0 + d1;
-    r0.im = 0.0f;
-    r1.re = d0 - d1;
+/* swaps the values at positions index and rev if rev is larger, i.e. every pair exactly once */
+static inline void bit_rev_swap(Complex_type_f32 *buf, uint32_t index, uint32_t rev) {
+    if (rev > index) {
+        Complex_type_f32 temp = buf[index];
+        buf[index] = buf[rev];
+        buf[rev] = temp;
+    }
+}
 
-    Complex_type_f32 tw0 = twiddle_ptr[twiddle_index];
+/* position of the bit-reversed FFT result that is moved to position index */
+static inline uint32_t reorder_src(const uint16_t *pLUT,
+                                   uint32_t index,
+                                   uint32_t nCplx,
+                                   uint32_t negate) {
+    if (negate)
+        index = (nCplx - index) & (nCplx - 1);
+    return rev_index(pLUT, index, nCplx);
+}
 
-    output[index] = r0;
-    output[index + distance] = complex_mul_real(r1.re, tw0);
+/*
+ * Moves the values of the cycle of the permutation starting at position start from position
+ * reorder_src(k) to position k: bin k to position k, or bin -k to position k if negate is set. The
+ * cycle is only moved if start is its smallest position, such that every cycle is moved exactly
+ * once.
+ */
+static inline void reorder_cycle(Complex_type_f32 *fft,
+                                 uint32_t start,
+                                 uint32_t nCplx,
+                                 const uint16_t *pLUT,
+                                 uint32_t negate) {
+
+    uint32_t j = reorder_src(pLUT, start, nCplx, negate);
+
+    while (j > start)
+        j = reorder_src(pLUT, j, nCplx, negate);
+    if (j < start)
+        return;
+
+    Complex_type_f32 temp = fft[start];
+    uint32_t k = start;
+    for (j = reorder_src(pLUT, start, nCplx, negate); j != start;
+         j = reorder_src(pLUT, j, nCplx, negate)) {
+        fft[k] = fft[j];
+        k = j;
+    }
+    fft[k] = temp;
 }
 
-static inline void process_butterfly_radix2(Complex_type_f32 *input,
-                                            int twiddle_index,
-                                            int index,
-                                            int distance,
-                                            Complex_type_f32 *twiddle_ptr) {
+/*
+ * Computes the bins index and nCplx-index of the real FFT from the bins of the complex FFT
+ * Z = FFT(x[2n] + j x[2n+1]), where bins index and nCplx-index are read at positions ia and ib
+ * of fft and written at positions oa and ob of output (bin 0 at oa, the Nyquist bin at nCplx):
+ *   E[k] = (Z[k] + conj(Z[nCplx-k])) / 2      (FFT of the even samples)
+ *   O[k] = -j (Z[k] - conj(Z[nCplx-k])) / 2   (FFT of the odd samples)
+ *   X[k] = E[k] + W_N^k O[k],   X[nCplx-k] = conj(E[k] - W_N^k O[k])
+ */
+static inline void process_split(Complex_type_f32 *fft,
+                                 Complex_type_f32 *output,
+                                 int index,
+                                 int nCplx,
+                                 uint32_t ia,
+                                 uint32_t ib,
+                                 uint32_t oa,
+                                 uint32_t ob,
+                                 Complex_type_f32 *twiddle_ptr) {
 
     Complex_type_f32 r0, r1;
 
-    float32_t d0 = input[index].re;
-    float32_t d1 = input[index + distance].re;
-    float32_t e0 = input[index].im;
-    float32_t e1 = input[index + distance].im;
+    if (index == 0) {
+        Complex_type_f32 z0 = fft[ia];
+        r0.re = z0.re + z0.im;
+        r0.im = 0.0f;
+        r1.re = z0.re - z0.im;
+        r1.im = 0.0f;
+        output[oa] = r0;
+        output[nCplx] = r1;
+        return;
+    }
+
+    Complex_type_f32 a = fft[ia];
+    Complex_type_f32 b = fft[ib];
+    Complex_type_f32 tw = twiddle_ptr[index];
 
-    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im
-    r0.re = d0 + d1;
-    r1.re = d0 - d1;
+    float32_t e_re = 0.5f * (a.re + b.re);
+    float32_t e_im = 0.5f * (a.im - b.im);
+    float32_t o_re = 0.5f * (a.im + b.im);
+    float32_t o_im = 0.5f * (b.re - a.re);
 
-    // Im(c1*c2) = c1.re*c2.im + c1.im*c2.re
-    r0.im = e0 + e1;
-    r1.im = e0 - e1;
+    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im, Im(c1*c2) = c1.re*c2.im + c1.im*c2.re
+    float32_t t_re = tw.re * o_re - tw.im * o_im;
+    float32_t t_im = tw.re * o_im + tw.im * o_re;
 
-    Complex_type_f32 tw0 = twiddle_ptr[twiddle_index];
+    r0.re = e_re + t_re;
+    r0.im = e_im + t_im;
+    r1.re = e_re - t_re;
+    r1.im = t_im - e_im;
 
-    input[index] = r0;
-    input[index + distance] = complex_mul(tw0, r1);
+    output[oa] = r0;
+    output[ob] = r1;
 }
 
-static inline void process_butterfly_last_radix2_partial(Complex_type_f32 *input,
-                                                         Complex_type_f32 *output,
-                                                         int outindex) {
+/*
+ * Inverse of process_split: computes the bins index and nCplx-index of Z = FFT(x[2n] + j x[2n+1])
+ * from the bins index and nCplx-index of the real FFT X, multiplied by 2*scale:
+ *   E[k] = (X[k] + conj(X[nCplx-k])) / 2,   O[k] = conj(W_N^k) (X[k] - conj(X[nCplx-k])) / 2
+ *   Z[k] = E[k] + j O[k],                   Z[nCplx-k] = conj(E[k]) + j conj(O[k])
+ * Bin 0 also reads the Nyquist bin X[nCplx]. Both bins are read before they are written.
+ */
+static inline void process_merge(const Complex_type_f32 *input,
+                                 Complex_type_f32 *output,
+                                 uint32_t index,
+                                 uint32_t nCplx,
+                                 float32_t scale,
+                                 const Complex_type_f32 *twiddle_ptr) {
 
-    int index = 0;
     Complex_type_f32 r0, r1;
-    float32_t d0 = input[index].re;
-    float32_t d1 = input[index + 1].re;
-    float32_t e0 = input[index].im;
-    float32_t e1 = input[index + 1].im;
 
-    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im
-    r0.re = d0 + d1;
+    if (index == 0) {
+        float32_t x0 = input[0].re;
+        float32_t xn = input[nCplx].re;
+        r0.re = scale * (x0 + xn);
+        r0.im = scale * (x0 - xn);
+        output[0] = r0;
+        return;
+    }
 
-    // Im(c1*c2) = c1.re*c2.im + c1.im*c2.re
-    r0.im = e0 + e1;
+    Complex_type_f32 a = input[index];
+    Complex_type_f32 b = input[nCplx - index];
+    Complex_type_f32 tw = twiddle_ptr[index];
 
-    /* In the Last step, twiddle factors are all 1 */
-    output[outindex] = r0;
-}
+    float32_t e_re = scale * (a.re + b.re);
+    float32_t e_im = scale * (a.im - b.im);
+    float32_t d_re = scale * (a.re - b.re);
+    float32_t d_im = scale * (a.im + b.im);
 
-static inline void process_butterfly_last_radix2_full(Complex_type_f32 *input,
-                                                      Complex_type_f32 *output,
-                                                      int outindex) {
+    // O = D * conj(tw)
+    float32_t o_re = d_re * tw.re + d_im * tw.im;
+    float32_t o_im = d_im * tw.re - d_re * tw.im;
 
-    int index = 0;
-    Complex_type_f32 r0, r1;
-    float32_t d0 = input[index].re;
-    float32_t d1 = input[index + 1].re;
-    float32_t e0 = input[index].im;
-    float32_t e1 = input[index + 1].im;
-    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im
-    r0.re = d0 + d1;
-    r1.re = d0 - d1;
-
-    // Im(c1*c2) = c1.re*c2.im + c1.im*c2.re
-    r0.im = e0 + e1;
-    r1.im = e0 - e1;
-
-    /* In the Last step, twiddle factors are all 1 */
-    output[outindex] = r0;
-    output[outindex + 1] = r1;
+    r0.re = e_re - o_im;
+    r0.im = e_im + o_re;
+    r1.re = e_re + o_im;
+    r1.im = o_re - e_im;
+
+    output[index] = r0;
+    output[nCplx - index] = r1;
 }
@@ -62,7 +62,7 @@
    @param[in]   orthoNorm   whether to use dct orthonormalisation or not
    @param[in]   pSrc        points to the input buffer (real data, size n_fft)
    @param[out]  pDst        points to the output buffer 
-   			    of length at least 3*n_fft.
+   			    of length at least 3*n_fft/2 + 3 and 3*n_mels.
 			    pSrc and pDst must not overlap, the calculation can
 			    not be done in place. 
 			    MFCCs are returned in the first n_mels spots.
@@ -73,19 +73,18 @@ void plp_mfcc_f32(const plp_fft_instance_f32 *SFFT,
 		  const Complex_type_f32 *pShift,
 		  const plp_triangular_filter_f32 *filterBank,
 		  const float32_t *window,
-		  const uint8_t *orthoNorm,
+		  const uint8_t orthoNorm,
                   const float32_t *__restrict__ pSrc,
                   float32_t *__restrict__ pDst) {
 
 
 	// Step 0: Windowing. Stored in buffer space of pDst.
 	uint32_t n_fft = SFFT->FFTLength;
-	float32_t *fft_in = pDst + 2*n_fft;
-	plp_mult_f32(window, pSrc, fft_in, n_fft);
+	plp_mult_f32(window, pSrc, pDst, n_fft);
 	
 
-	// Step 1: FFT
-	plp_rfft_f32(SFFT, fft_in, pDst);
+	// Step 1: FFT, in place on the windowed input
+	plp_rfft_in_place_f32(SFFT, pDst);
 	
 
 	// Step 2: ||.||^2 of each RFFT point / Take squared magnitude.
@@ -115,10 +114,7 @@ void plp_mfcc_f32(const plp_fft_instance_f32 *SFFT,
 	// the offset is copied from pytorch
 	plp_offset_f32(fb_out, 1e-6f, fb_out, n_mels);
 	float32_t *mel_logs = fb_out;
-	for (int i=0;i<n_mels;i++){
-        	float32_t log_i = log(fb_out[i]);
-        	mel_logs[i] = log_i;
-	}
+	plp_vlog_f32(fb_out, n_mels, mel_logs);
 
 
 	// Step 5: DCT of log mels
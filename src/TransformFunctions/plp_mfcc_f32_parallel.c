@@ -1,7 +1,7 @@
 /* ----------------------------------------------------------------------
  * Project:      PULP DSP Library
- * Title:        plp_mfcc_f32.c
- * Description:  Floating-point MFCC on real input data
+ * Title:        plp_mfcc_f32_parallel.c
+ * Description:  Parallel floating-point MFCC on real input data
  *
  * $Date:        05. July 2021
  * $Revision:    V0
@@ -74,53 +74,22 @@ void plp_mfcc_f32_parallel(const plp_fft_instance_f32 *SFFT,
 		  	   const Complex_type_f32 *pShift,
 		  	   const plp_triangular_filter_f32 *filterBank,
 		  	   const float32_t *window,
-		  	   const uint8_t *orthoNorm,
+		  	   const uint8_t orthoNorm,
                   	   const float32_t *__restrict__ pSrc,
                   	   const uint32_t nPE,
                   	   float32_t *__restrict__ pDst) {
 
-	// Step 0: Windowing. Stored in buffer space of pDst.
-	uint32_t n_fft = SFFT->FFTLength;
-	float32_t *fft_in = pDst + 2*n_fft;
-	plp_mult_f32_parallel(window, pSrc, n_fft, nPE, fft_in);
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
 
-	// Step 1: FFT
-	plp_rfft_f32_parallel(SFFT, fft_in, nPE, pDst);
-	
-	// Step 2: ||.||^2 of each RFFT point / Take squared magnitude.
-	// Stores result in free buffer space of pDst, right behind
-	// the RFFT's (n_fft+2)-long output. 
-	float32_t *fft_mag = pDst + n_fft+2;
-	plp_cmplx_mag_squared_f32(pDst, fft_mag, n_fft/2 + 1);
+    // windowing, FFT, power spectrum, mel filterbank, log and DCT all run in a single fork
+    plp_mfcc_instance_f32_parallel args = (plp_mfcc_instance_f32_parallel){
+        SFFT, SDCT, pShift, filterBank, window, orthoNorm, pSrc, nPE, pDst
+    };
 
-	// Step 3: Apply triangular filter bank.
-	// results are stored in the beginning of pDst.
-	float32_t *fb_out = pDst;
-	uint16_t n_mels = filterBank->nFilters;
-	float32_t *filter_start = (float32_t*)filterBank->V;
-	for (int i=0;i<n_mels;i++){
-		uint16_t current_length = filterBank->filterLength[i];
-		plp_dot_prod_f32(
-		//plp_dot_prod_f32_parallel(
-                          fft_mag+filterBank->firstValue[i], 
-                          filter_start,
-                          current_length, 
-			  //nPE,
-                          fb_out+i);
-		filter_start += current_length;
-  	}
-
-	// Step 4: Take the log of the computed mel scale. 
-	// the offset is copied from pytorch
-	plp_offset_f32(fb_out, 1e-6f, fb_out, n_mels);
-	float32_t *mel_logs = fb_out;
-	plp_log_f32_parallel(fb_out, n_mels, nPE, mel_logs);
-
-	// Step 5: DCT of log mels
-	// corresponds to using pytorch MFCC with norm = None
-	float32_t *dct_inout = mel_logs;
-	float32_t *dct_buffer = pDst + n_mels;
-	plp_dct2_f32_parallel(SDCT, pShift, orthoNorm, dct_inout, nPE, dct_buffer, dct_inout);
+    hal_cl_team_fork(nPE, plp_mfcc_f32p_xpulpv2, (void *)&args);
 }
 
 /**
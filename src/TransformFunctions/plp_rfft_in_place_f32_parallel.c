@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_in_place_f32_parallel.c
+ * Description:  in-place floating-point FFT on real input data (parallel)
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief In-place floating-point FFT on real input data (parallel version).
+   @param[in]   S           points to an instance of the floating-point FFT structure
+   @param[in,out] pSrcDst   points to the buffer of (FFTLength + 2) values, holding the real input
+                            in the first FFTLength values and, afterwards, the (FFTLength / 2 + 1)
+                            complex output values. No further scratch memory is needed
+   @param[in]   nPE         number of parallel processing units
+   @return      none
+*/
+void plp_rfft_in_place_f32_parallel(const plp_fft_instance_f32 *S,
+                                    float32_t *pSrcDst,
+                                    const uint32_t nPE) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_fft_instance_f32_parallel arg =
+        (plp_fft_instance_f32_parallel){ (plp_fft_instance_f32 *)S, pSrcDst, nPE, pSrcDst };
+
+    hal_cl_team_fork(nPE, plp_rfft_in_place_f32_xpulpv2_parallel, (void *)&arg);
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rifft_f32.c
+ * Description:  Floating-point inverse FFT with real output data
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Floating-point inverse FFT with real output data.
+   @param[in]   S       points to an instance of the floating-point FFT structure, the same as
+                        for plp_rfft_f32
+   @param[in]   pSrc    points to the input buffer of (FFTLength / 2 + 1) complex values, the
+                        first half of a spectrum with conjugate symmetry
+   @param[out]  pDst    points to the output buffer of FFTLength real values. It can be equal to
+                        pSrc, the buffer then needs (FFTLength + 2) values
+   @return      none
+
+   @par
+   The output is scaled by 1/FFTLength, such that plp_rifft_f32 inverts plp_rfft_f32. The
+   imaginary parts of the bins 0 and FFTLength / 2 are ignored. No scratch memory is needed.
+*/
+void plp_rifft_f32(const plp_fft_instance_f32 *S, const float32_t *pSrc, float32_t *pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_rifft_f32_xpulpv2(S, pSrc, pDst);
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        main.c
+ * Description:  Native host regression tests
+ *
+ * $Date:        18. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM Linux hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_host.h"
+
+int test_host_failures = 0;
+
+#define TEST_RAND_SEED 0x12345678
+
+static uint32_t rand_state = TEST_RAND_SEED;
+
+void test_seed(void) { rand_state = TEST_RAND_SEED; }
+
+int32_t test_rand(void) {
+    rand_state = rand_state * 1664525u + 1013904223u;
+    return (int32_t)(rand_state >> 8);
+}
+
+float32_t test_randf(void) { return (float32_t)(test_rand() & 0xffff) / 32768.0f - 1.0f; }
+
+void test_on_fc_and_cluster(void (*fn)(const char *where)) {
+    hal_host_set_cluster_id(ARCHI_FC_CID);
+    fn("fc");
+    hal_host_set_cluster_id(0);
+    fn("cluster");
+}
+
+int main(void) {
+    test_basic_math();
+    test_matrix();
+    test_filtering();
+    test_transform();
+    test_fast_math();
+    test_complex_math();
+    test_statistics();
+
+    if (test_host_failures) {
+        printf("%d check(s) failed\n", test_host_failures);
+        return 1;
+    }
+    printf("all host tests passed\n");
+    return 0;
+}
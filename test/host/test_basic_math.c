@@ -0,0 +1,343 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        test_basic_math.c
+ * Description:  Host regression tests for the basic math functions
+ *
+ * $Date:        18. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM Linux hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_host.h"
+
+#define LEN 203
+
+static void test_dot_prod(const char *where) {
+    static int32_t a32[LEN], b32[LEN];
+    static int16_t a16[LEN], b16[LEN];
+    static int8_t a8[LEN], b8[LEN];
+    int32_t exp32 = 0, exp16 = 0, exp8 = 0, res;
+    char name[64];
+
+    test_seed();
+
+    for (int i = 0; i < LEN; i++) {
+        a32[i] = test_rand() % 1000;
+        b32[i] = test_rand() % 1000;
+        a16[i] = test_rand() % 1000;
+        b16[i] = test_rand() % 1000;
+        a8[i] = test_rand() % 100;
+        b8[i] = test_rand() % 100;
+        exp32 += a32[i] * b32[i];
+        exp16 += a16[i] * b16[i];
+        exp8 += a8[i] * b8[i];
+    }
+
+    snprintf(name, sizeof(name), "plp_dot_prod_i32 (%s)", where);
+    plp_dot_prod_i32(a32, b32, LEN, &res);
+    CHECK_EQ_INT(name, res, exp32);
+
+    snprintf(name, sizeof(name), "plp_dot_prod_i16 (%s)", where);
+    plp_dot_prod_i16(a16, b16, LEN, &res);
+    CHECK_EQ_INT(name, res, exp16);
+
+    snprintf(name, sizeof(name), "plp_dot_prod_i8 (%s)", where);
+    plp_dot_prod_i8(a8, b8, LEN, &res);
+    CHECK_EQ_INT(name, res, exp8);
+}
+
+static void test_dot_prod_parallel(void) {
+    static int32_t a32[LEN], b32[LEN];
+    static float32_t af[LEN], bf[LEN];
+    int32_t exp32 = 0, res;
+    float32_t expf = 0, resf;
+
+    test_seed();
+
+    for (int i = 0; i < LEN; i++) {
+        a32[i] = test_rand() % 1000;
+        b32[i] = test_rand() % 1000;
+        af[i] = test_randf();
+        bf[i] = test_randf();
+        exp32 += a32[i] * b32[i];
+        expf += af[i] * bf[i];
+    }
+
+    for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+        plp_dot_prod_i32_parallel(a32, b32, LEN, nPE, &res);
+        CHECK_EQ_INT("plp_dot_prod_i32_parallel", res, exp32);
+        plp_dot_prod_f32_parallel(af, bf, LEN, nPE, &resf);
+        CHECK_NEAR("plp_dot_prod_f32_parallel", resf, expf, 1e-4);
+    }
+}
+
+/* the parallel kernels must cover every element exactly once, also for short vectors */
+static void test_partition(void) {
+    static const uint32_t lens[] = { 0, 1, 2, 3, 5, 8, 17, 64, LEN };
+    static const uint32_t aligns[] = { 1, 2, 4 };
+
+    for (unsigned l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        for (unsigned a = 0; a < sizeof(aligns) / sizeof(aligns[0]); a++) {
+            for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+                uint32_t next = 0, start, end;
+                for (uint32_t core = 0; core < nPE; core++) {
+                    plp_partition(lens[l], nPE, core, aligns[a], &start, &end);
+                    CHECK_EQ_INT("plp_partition contiguous", start, next);
+                    CHECK_EQ_INT("plp_partition order", end >= start, 1);
+                    if (end > start) {
+                        CHECK_EQ_INT("plp_partition align", start % aligns[a], 0);
+                    }
+                    next = end;
+                }
+                CHECK_EQ_INT("plp_partition covers", next, lens[l]);
+            }
+        }
+    }
+}
+
+static void test_contiguous_parallel(void) {
+    static int32_t a32[LEN], b32[LEN];
+    static float32_t af[LEN], bf[LEN], ref[LEN], dst[LEN];
+    int32_t exp, res;
+
+    test_seed();
+
+    for (int i = 0; i < LEN; i++) {
+        a32[i] = test_rand() % 100000 - 50000;
+        b32[i] = test_rand() % 100000 - 50000;
+        af[i] = test_randf();
+        bf[i] = 1e-3f + test_rand() * (100.0f / (1 << 24));
+    }
+
+    /* the q32 blocks start on even elements, hence the rounding matches the single core result */
+    plp_dot_prod_q32(a32, b32, LEN, 12, &exp);
+    plp_mult_f32(af, bf, ref, LEN);
+    for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+        plp_dot_prod_q32_parallel(a32, b32, LEN, 12, nPE, &res);
+        CHECK_EQ_INT("plp_dot_prod_q32_parallel", res, exp);
+
+        memset(dst, 0, sizeof(dst));
+        plp_mult_f32_parallel(af, bf, LEN, nPE, dst);
+        for (int i = 0; i < LEN; i++) {
+            CHECK_EQ_INT("plp_mult_f32_parallel", dst[i] == ref[i], 1);
+        }
+
+        memset(dst, 0, sizeof(dst));
+        plp_log_f32_parallel(bf, LEN, nPE, dst);
+        for (int i = 0; i < LEN; i++) {
+            CHECK_NEAR("plp_log_f32_parallel", dst[i], logf(bf[i]), 1e-6);
+        }
+    }
+}
+
+static void test_add(const char *where) {
+    static int8_t a8[LEN], b8[LEN];
+    static int32_t dst[LEN];
+    char name[64];
+
+    test_seed();
+
+    for (int i = 0; i < LEN; i++) {
+        a8[i] = test_rand();
+        b8[i] = test_rand();
+    }
+
+    snprintf(name, sizeof(name), "plp_add_i8 (%s)", where);
+    plp_add_i8(a8, b8, dst, LEN);
+    for (int i = 0; i < LEN; i++) {
+        CHECK_EQ_INT(name, dst[i], a8[i] + b8[i]);
+    }
+}
+
+#define CHECK_SAME(name, got, exp, n)                                                              \
+    do {                                                                                           \
+        for (uint32_t _i = 0; _i < (n); _i++)                                                      \
+            CHECK_EQ_INT(name, (got)[_i] == (exp)[_i], 1);                                         \
+    } while (0)
+
+/* runs the single core and the parallel call and compares the outputs ref<O> and out<O> */
+#define CHECK_PAR(name, O, serial, parallel)                                                       \
+    do {                                                                                           \
+        serial;                                                                                    \
+        memset(out##O, 0, sizeof(out##O));                                                        \
+        parallel;                                                                                  \
+        CHECK_SAME(name, out##O, ref##O, n);                                                       \
+    } while (0)
+
+/* the element-wise functions compute every sample like the single core ones, also for vectors
+   shorter than the number of cores */
+static void test_elementwise_parallel(void) {
+    static const uint32_t lens[] = { 5, LEN };
+    static int32_t a32[LEN], b32[LEN], ref32[LEN], out32[LEN];
+    static int16_t a16[LEN], b16[LEN], ref16[LEN], out16[LEN];
+    static int8_t a8[LEN], b8[LEN], ref8[LEN], out8[LEN];
+    static float32_t af[LEN], bf[LEN], reff[LEN], outf[LEN];
+
+    test_seed();
+
+    for (int i = 0; i < LEN; i++) {
+        a32[i] = test_rand() % 40000 - 20000;
+        b32[i] = test_rand() % 40000 - 20000;
+        a16[i] = test_rand();
+        b16[i] = test_rand();
+        a8[i] = test_rand();
+        b8[i] = test_rand();
+        af[i] = test_randf();
+        bf[i] = test_randf();
+    }
+
+    for (unsigned l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        uint32_t n = lens[l];
+        for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+            CHECK_PAR("plp_abs_i32_parallel", 32, plp_abs_i32(a32, ref32, n),
+                      plp_abs_i32_parallel(a32, n, nPE, out32));
+            CHECK_PAR("plp_abs_i16_parallel", 16, plp_abs_i16(a16, ref16, n),
+                      plp_abs_i16_parallel(a16, n, nPE, out16));
+            CHECK_PAR("plp_abs_i8_parallel", 8, plp_abs_i8(a8, ref8, n),
+                      plp_abs_i8_parallel(a8, n, nPE, out8));
+
+            CHECK_PAR("plp_add_i32_parallel", 32, plp_add_i32(a32, b32, ref32, n),
+                      plp_add_i32_parallel(a32, b32, n, nPE, out32));
+            CHECK_PAR("plp_add_i16_parallel", 32, plp_add_i16(a16, b16, ref32, n),
+                      plp_add_i16_parallel(a16, b16, n, nPE, out32));
+            CHECK_PAR("plp_add_i8_parallel", 32, plp_add_i8(a8, b8, ref32, n),
+                      plp_add_i8_parallel(a8, b8, n, nPE, out32));
+
+            CHECK_PAR("plp_mult_i32_parallel", 32, plp_mult_i32(a32, b32, ref32, n),
+                      plp_mult_i32_parallel(a32, b32, n, nPE, out32));
+            CHECK_PAR("plp_mult_i16_parallel", 32, plp_mult_i16(a16, b16, ref32, n),
+                      plp_mult_i16_parallel(a16, b16, n, nPE, out32));
+            CHECK_PAR("plp_mult_i8_parallel", 32, plp_mult_i8(a8, b8, ref32, n),
+                      plp_mult_i8_parallel(a8, b8, n, nPE, out32));
+
+            CHECK_PAR("plp_negate_f32_parallel", f, plp_negate_f32(af, reff, n),
+                      plp_negate_f32_parallel(af, n, nPE, outf));
+            CHECK_PAR("plp_negate_i32_parallel", 32, plp_negate_i32(a32, ref32, n),
+                      plp_negate_i32_parallel(a32, n, nPE, out32));
+            CHECK_PAR("plp_negate_i16_parallel", 16, plp_negate_i16(a16, ref16, n),
+                      plp_negate_i16_parallel(a16, n, nPE, out16));
+            CHECK_PAR("plp_negate_i8_parallel", 8, plp_negate_i8(a8, ref8, n),
+                      plp_negate_i8_parallel(a8, n, nPE, out8));
+
+            CHECK_PAR("plp_offset_f32_parallel", f, plp_offset_f32(af, 0.25f, reff, n),
+                      plp_offset_f32_parallel(af, n, 0.25f, nPE, outf));
+            CHECK_PAR("plp_offset_i32_parallel", 32, plp_offset_i32(a32, -77, ref32, n),
+                      plp_offset_i32_parallel(a32, n, -77, nPE, out32));
+            CHECK_PAR("plp_offset_i16_parallel", 16, plp_offset_i16(a16, 1234, ref16, n),
+                      plp_offset_i16_parallel(a16, n, 1234, nPE, out16));
+            CHECK_PAR("plp_offset_i8_parallel", 8, plp_offset_i8(a8, 17, ref8, n),
+                      plp_offset_i8_parallel(a8, n, 17, nPE, out8));
+
+            CHECK_PAR("plp_sub_f32_parallel", f, plp_sub_f32(af, bf, reff, n),
+                      plp_sub_f32_parallel(af, bf, n, nPE, outf));
+            CHECK_PAR("plp_sub_i32_parallel", 32, plp_sub_i32(a32, b32, ref32, n),
+                      plp_sub_i32_parallel(a32, b32, n, nPE, out32));
+            CHECK_PAR("plp_sub_i16_parallel", 32, plp_sub_i16(a16, b16, ref32, n),
+                      plp_sub_i16_parallel(a16, b16, n, nPE, out32));
+            CHECK_PAR("plp_sub_i8_parallel", 32, plp_sub_i8(a8, b8, ref32, n),
+                      plp_sub_i8_parallel(a8, b8, n, nPE, out32));
+
+            CHECK_PAR("plp_scale_f32_parallel", f, plp_scale_f32(af, -1.5f, reff, n),
+                      plp_scale_f32_parallel(af, n, -1.5f, nPE, outf));
+            CHECK_PAR("plp_scale_i32_parallel", 32, plp_scale_i32(a32, 3000, 4, ref32, n),
+                      plp_scale_i32_parallel(a32, n, 3000, 4, nPE, out32));
+            CHECK_PAR("plp_scale_i16_parallel", 16, plp_scale_i16(a16, -300, 8, ref16, n),
+                      plp_scale_i16_parallel(a16, n, -300, 8, nPE, out16));
+            CHECK_PAR("plp_scale_i8_parallel", 8, plp_scale_i8(a8, 5, 2, ref8, n),
+                      plp_scale_i8_parallel(a8, n, 5, 2, nPE, out8));
+        }
+    }
+}
+
+/* streamed operations on lengths around the tile size, from misaligned sources */
+#define CHECK_STREAM_VEC(T, O, sfx, randv)                                                         \
+    do {                                                                                           \
+        static T a[STREAM_LEN + 1], b[STREAM_LEN + 1];                                             \
+        static O dst[STREAM_LEN];                                                                  \
+        for (uint32_t i = 0; i <= STREAM_LEN; i++) {                                               \
+            a[i] = (T)(randv);                                                                     \
+            b[i] = (T)(randv);                                                                     \
+        }                                                                                          \
+        for (unsigned l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {                            \
+            uint32_t n = lens[l];                                                                  \
+            O dot = 0, res;                                                                        \
+            for (uint32_t i = 0; i < n; i++)                                                       \
+                dot += (O)a[i + 1] * b[i + 1];                                                     \
+            for (uint32_t nPE = 1; nPE <= 8; nPE++) {                                              \
+                plp_stream_dot_prod_##sfx(a + 1, b + 1, n, nPE, &res);                             \
+                CHECK_NEAR("plp_stream_dot_prod_" #sfx, res, dot, 1e-3);                           \
+                plp_stream_mult_##sfx(a + 1, b + 1, dst, n, nPE);                                  \
+                for (uint32_t i = 0; i < n; i++)                                                   \
+                    CHECK_NEAR("plp_stream_mult_" #sfx, dst[i], (O)a[i + 1] * b[i + 1], 1e-6);     \
+            }                                                                                      \
+        }                                                                                          \
+    } while (0)
+
+#define CHECK_STREAM_ADD(T, sfx)                                                                   \
+    do {                                                                                           \
+        static T a[STREAM_LEN + 1], b[STREAM_LEN + 1];                                             \
+        static int32_t dst[STREAM_LEN];                                                            \
+        for (uint32_t i = 0; i <= STREAM_LEN; i++) {                                               \
+            a[i] = (T)test_rand();                                                                 \
+            b[i] = (T)test_rand();                                                                 \
+        }                                                                                          \
+        for (unsigned l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {                            \
+            uint32_t n = lens[l];                                                                  \
+            for (uint32_t nPE = 1; nPE <= 8; nPE++) {                                              \
+                plp_stream_add_##sfx(a + 1, b + 1, dst, n, nPE);                                   \
+                for (uint32_t i = 0; i < n; i++)                                                   \
+                    CHECK_EQ_INT("plp_stream_add_" #sfx, dst[i], (int32_t)a[i + 1] + b[i + 1]);    \
+            }                                                                                      \
+        }                                                                                          \
+    } while (0)
+
+#define STREAM_LEN 5000
+
+static void test_stream(void) {
+    static const uint32_t lens[] = { 0, 1, 7, 511, 512, 513, 1024, 2048, 2049, STREAM_LEN };
+    static int32_t arena[4096];
+
+    test_seed();
+
+    /* the streams must hand their buffers back to the arena in LIFO order */
+    plp_scratch_init(arena, sizeof(arena));
+
+    CHECK_STREAM_VEC(int32_t, int32_t, i32, test_rand() % 1000);
+    CHECK_STREAM_VEC(int16_t, int32_t, i16, test_rand() % 1000);
+    CHECK_STREAM_VEC(int8_t, int32_t, i8, test_rand());
+    CHECK_STREAM_VEC(float32_t, float32_t, f32, test_randf());
+    CHECK_STREAM_ADD(int32_t, i32);
+    CHECK_STREAM_ADD(int16_t, i16);
+    CHECK_STREAM_ADD(int8_t, i8);
+
+    CHECK_EQ_INT("plp_stream arena released", plp_scratch_alloc(4) == (void *)arena, 1);
+    plp_scratch_init(NULL, 0);
+}
+
+void test_basic_math(void) {
+    test_on_fc_and_cluster(test_dot_prod);
+    test_on_fc_and_cluster(test_add);
+    test_dot_prod_parallel();
+    test_partition();
+    test_contiguous_parallel();
+    test_elementwise_parallel();
+    test_stream();
+}
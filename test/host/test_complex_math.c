@@ -0,0 +1,332 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        test_complex_math.c
+ * Description:  Host regression tests for the complex math functions
+ *
+ * $Date:        18. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM Linux hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "test_host.h"
+
+#define NCMPLX 67 /* odd, so that the SIMD kernels run their tail */
+
+static int8_t src8[2 * NCMPLX] __attribute__((aligned(4))), res8[NCMPLX];
+static int16_t src16[2 * NCMPLX] __attribute__((aligned(4))), res16[NCMPLX];
+static int32_t src32[2 * NCMPLX], res32[NCMPLX];
+static float32_t srcf32[2 * NCMPLX], resf32[NCMPLX];
+
+/* second complex operand, real operand and outputs of the parallel element-wise functions */
+static int8_t srcB8[2 * NCMPLX], real8[NCMPLX], ref8[2 * NCMPLX], out8[2 * NCMPLX];
+static int16_t srcB16[2 * NCMPLX], real16[NCMPLX], ref16[2 * NCMPLX], out16[2 * NCMPLX];
+static int32_t srcB32[2 * NCMPLX], real32[NCMPLX], ref32[2 * NCMPLX], out32[2 * NCMPLX];
+static float32_t srcBf32[2 * NCMPLX], realf32[NCMPLX], reff32[2 * NCMPLX], outf32[2 * NCMPLX];
+
+static void setup(void) {
+    test_seed();
+
+    for (int i = 0; i < 2 * NCMPLX; i++) {
+        src8[i] = (int8_t)test_rand();
+        src16[i] = (int16_t)test_rand();
+        src32[i] = test_rand() * 256 + (test_rand() & 0xff);
+        srcf32[i] = 100.0f * test_randf();
+        srcB8[i] = (int8_t)test_rand();
+        srcB16[i] = (int16_t)test_rand();
+        srcB32[i] = test_rand() * 256 + (test_rand() & 0xff);
+        srcBf32[i] = test_randf();
+    }
+    for (int i = 0; i < NCMPLX; i++) {
+        real8[i] = (int8_t)test_rand();
+        real16[i] = (int16_t)test_rand();
+        real32[i] = test_rand() * 256 + (test_rand() & 0xff);
+        realf32[i] = test_randf();
+    }
+    /* zero, the most negative values and the saturating cases */
+    src8[0] = src8[1] = src16[0] = src16[1] = src32[0] = src32[1] = 0;
+    src8[2] = src8[3] = -128;
+    src16[2] = src16[3] = -32768;
+    src32[2] = src32[3] = INT32_MIN;
+    src8[4] = 127;
+    src8[5] = 0;
+    src16[4] = 0;
+    src16[5] = -32768;
+    src32[4] = INT32_MIN;
+    src32[5] = 0;
+}
+
+/* floor(sqrt(re^2 + im^2)), saturated to max */
+static long long mag_ref(long long re, long long im, long long max) {
+    unsigned long long v = (unsigned long long)(re * re) + (unsigned long long)(im * im);
+    unsigned long long r = (unsigned long long)sqrtl((long double)v);
+
+    while (r * r > v)
+        r--;
+    while ((r + 1) * (r + 1) <= v)
+        r++;
+    return (long long)r > max ? max : (long long)r;
+}
+
+static void test_cmplx_mag_fixed(const char *where) {
+    char name[64];
+
+    snprintf(name, sizeof(name), "plp_cmplx_mag_q8 (%s)", where);
+    memset(res8, 0, sizeof(res8));
+    plp_cmplx_mag_q8(src8, 5, res8, NCMPLX);
+    for (int i = 0; i < NCMPLX; i++)
+        CHECK_EQ_INT(name, res8[i], mag_ref(src8[2 * i], src8[2 * i + 1], 0x7F));
+    snprintf(name, sizeof(name), "plp_cmplx_mag_i8 (%s)", where);
+    memset(res8, 0, sizeof(res8));
+    plp_cmplx_mag_i8(src8, res8, NCMPLX);
+    for (int i = 0; i < NCMPLX; i++)
+        CHECK_EQ_INT(name, res8[i], mag_ref(src8[2 * i], src8[2 * i + 1], 0x7F));
+
+    snprintf(name, sizeof(name), "plp_cmplx_mag_q16 (%s)", where);
+    memset(res16, 0, sizeof(res16));
+    plp_cmplx_mag_q16(src16, 12, res16, NCMPLX);
+    for (int i = 0; i < NCMPLX; i++)
+        CHECK_EQ_INT(name, res16[i], mag_ref(src16[2 * i], src16[2 * i + 1], 0x7FFF));
+    snprintf(name, sizeof(name), "plp_cmplx_mag_i16 (%s)", where);
+    memset(res16, 0, sizeof(res16));
+    plp_cmplx_mag_i16(src16, res16, NCMPLX);
+    for (int i = 0; i < NCMPLX; i++)
+        CHECK_EQ_INT(name, res16[i], mag_ref(src16[2 * i], src16[2 * i + 1], 0x7FFF));
+
+    snprintf(name, sizeof(name), "plp_cmplx_mag_q32 (%s)", where);
+    memset(res32, 0, sizeof(res32));
+    plp_cmplx_mag_q32(src32, 24, res32, NCMPLX);
+    for (int i = 0; i < NCMPLX; i++)
+        CHECK_EQ_INT(name, res32[i], mag_ref(src32[2 * i], src32[2 * i + 1], 0x7FFFFFFF));
+    snprintf(name, sizeof(name), "plp_cmplx_mag_i32 (%s)", where);
+    memset(res32, 0, sizeof(res32));
+    plp_cmplx_mag_i32(src32, res32, NCMPLX);
+    for (int i = 0; i < NCMPLX; i++)
+        CHECK_EQ_INT(name, res32[i], mag_ref(src32[2 * i], src32[2 * i + 1], 0x7FFFFFFF));
+}
+
+static void test_cmplx_mag_parallel(void) {
+    plp_cmplx_mag_f32(srcf32, resf32, NCMPLX);
+    for (int i = 0; i < NCMPLX; i++)
+        CHECK_NEAR("plp_cmplx_mag_f32", resf32[i], hypot(srcf32[2 * i], srcf32[2 * i + 1]), 1e-5);
+
+    for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+        memset(res8, 0, sizeof(res8));
+        plp_cmplx_mag_q8_parallel(src8, 3, res8, NCMPLX, nPE);
+        for (int i = 0; i < NCMPLX; i++)
+            CHECK_EQ_INT("plp_cmplx_mag_q8_parallel", res8[i],
+                         mag_ref(src8[2 * i], src8[2 * i + 1], 0x7F));
+        memset(res8, 0, sizeof(res8));
+        plp_cmplx_mag_i8_parallel(src8, res8, NCMPLX, nPE);
+        for (int i = 0; i < NCMPLX; i++)
+            CHECK_EQ_INT("plp_cmplx_mag_i8_parallel", res8[i],
+                         mag_ref(src8[2 * i], src8[2 * i + 1], 0x7F));
+
+        memset(res16, 0, sizeof(res16));
+        plp_cmplx_mag_q16_parallel(src16, 8, res16, NCMPLX, nPE);
+        for (int i = 0; i < NCMPLX; i++)
+            CHECK_EQ_INT("plp_cmplx_mag_q16_parallel", res16[i],
+                         mag_ref(src16[2 * i], src16[2 * i + 1], 0x7FFF));
+        memset(res16, 0, sizeof(res16));
+        plp_cmplx_mag_i16_parallel(src16, res16, NCMPLX, nPE);
+        for (int i = 0; i < NCMPLX; i++)
+            CHECK_EQ_INT("plp_cmplx_mag_i16_parallel", res16[i],
+                         mag_ref(src16[2 * i], src16[2 * i + 1], 0x7FFF));
+
+        memset(res32, 0, sizeof(res32));
+        plp_cmplx_mag_q32_parallel(src32, 16, res32, NCMPLX, nPE);
+        for (int i = 0; i < NCMPLX; i++)
+            CHECK_EQ_INT("plp_cmplx_mag_q32_parallel", res32[i],
+                         mag_ref(src32[2 * i], src32[2 * i + 1], 0x7FFFFFFF));
+        memset(res32, 0, sizeof(res32));
+        plp_cmplx_mag_i32_parallel(src32, res32, NCMPLX, nPE);
+        for (int i = 0; i < NCMPLX; i++)
+            CHECK_EQ_INT("plp_cmplx_mag_i32_parallel", res32[i],
+                         mag_ref(src32[2 * i], src32[2 * i + 1], 0x7FFFFFFF));
+
+        memset(resf32, 0, sizeof(resf32));
+        plp_cmplx_mag_f32_parallel(srcf32, resf32, NCMPLX, nPE);
+        for (int i = 0; i < NCMPLX; i++)
+            CHECK_NEAR("plp_cmplx_mag_f32_parallel", resf32[i],
+                       hypot(srcf32[2 * i], srcf32[2 * i + 1]), 1e-5);
+    }
+}
+
+#define CHECK_SAME(name, got, exp, n)                                                              \
+    do {                                                                                           \
+        for (int _i = 0; _i < (n); _i++)                                                           \
+            CHECK_EQ_INT(name, (got)[_i] == (exp)[_i], 1);                                         \
+    } while (0)
+
+/* the element-wise functions compute every sample like the single core ones */
+static void test_cmplx_elementwise_parallel(void) {
+    for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+        memset(outf32, 0, sizeof(outf32));
+        plp_cmplx_conj_f32(srcf32, reff32, NCMPLX);
+        plp_cmplx_conj_f32_parallel(srcf32, outf32, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_conj_f32_parallel", outf32, reff32, 2 * NCMPLX);
+        memset(out32, 0, sizeof(out32));
+        plp_cmplx_conj_i32(src32, ref32, NCMPLX);
+        plp_cmplx_conj_i32_parallel(src32, out32, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_conj_i32_parallel", out32, ref32, 2 * NCMPLX);
+        memset(out16, 0, sizeof(out16));
+        plp_cmplx_conj_i16(src16, ref16, NCMPLX);
+        plp_cmplx_conj_i16_parallel(src16, out16, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_conj_i16_parallel", out16, ref16, 2 * NCMPLX);
+        memset(out8, 0, sizeof(out8));
+        plp_cmplx_conj_i8(src8, ref8, NCMPLX);
+        plp_cmplx_conj_i8_parallel(src8, out8, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_conj_i8_parallel", out8, ref8, 2 * NCMPLX);
+        memset(outf32, 0, sizeof(outf32));
+        plp_cmplx_mult_real_f32(srcf32, realf32, reff32, NCMPLX);
+        plp_cmplx_mult_real_f32_parallel(srcf32, realf32, outf32, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_real_f32_parallel", outf32, reff32, 2 * NCMPLX);
+        memset(out32, 0, sizeof(out32));
+        plp_cmplx_mult_real_i32(src32, real32, ref32, NCMPLX);
+        plp_cmplx_mult_real_i32_parallel(src32, real32, out32, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_real_i32_parallel", out32, ref32, 2 * NCMPLX);
+        memset(out16, 0, sizeof(out16));
+        plp_cmplx_mult_real_i16(src16, real16, ref16, NCMPLX);
+        plp_cmplx_mult_real_i16_parallel(src16, real16, out16, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_real_i16_parallel", out16, ref16, 2 * NCMPLX);
+        memset(out8, 0, sizeof(out8));
+        plp_cmplx_mult_real_i8(src8, real8, ref8, NCMPLX);
+        plp_cmplx_mult_real_i8_parallel(src8, real8, out8, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_real_i8_parallel", out8, ref8, 2 * NCMPLX);
+        memset(out32, 0, sizeof(out32));
+        plp_cmplx_mult_real_q32(src32, real32, ref32, 20, NCMPLX);
+        plp_cmplx_mult_real_q32_parallel(src32, real32, out32, 20, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_real_q32_parallel", out32, ref32, 2 * NCMPLX);
+        memset(out16, 0, sizeof(out16));
+        plp_cmplx_mult_real_q16(src16, real16, ref16, 9, NCMPLX);
+        plp_cmplx_mult_real_q16_parallel(src16, real16, out16, 9, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_real_q16_parallel", out16, ref16, 2 * NCMPLX);
+        memset(out8, 0, sizeof(out8));
+        plp_cmplx_mult_real_q8(src8, real8, ref8, 4, NCMPLX);
+        plp_cmplx_mult_real_q8_parallel(src8, real8, out8, 4, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_real_q8_parallel", out8, ref8, 2 * NCMPLX);
+        memset(outf32, 0, sizeof(outf32));
+        plp_cmplx_mult_cmplx_f32(srcf32, srcBf32, reff32, NCMPLX);
+        plp_cmplx_mult_cmplx_f32_parallel(srcf32, srcBf32, outf32, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_cmplx_f32_parallel", outf32, reff32, 2 * NCMPLX);
+        memset(out32, 0, sizeof(out32));
+        plp_cmplx_mult_cmplx_i32(src32, srcB32, ref32, NCMPLX);
+        plp_cmplx_mult_cmplx_i32_parallel(src32, srcB32, out32, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_cmplx_i32_parallel", out32, ref32, 2 * NCMPLX);
+        memset(out16, 0, sizeof(out16));
+        plp_cmplx_mult_cmplx_i16(src16, srcB16, ref16, NCMPLX);
+        plp_cmplx_mult_cmplx_i16_parallel(src16, srcB16, out16, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_cmplx_i16_parallel", out16, ref16, 2 * NCMPLX);
+        memset(out8, 0, sizeof(out8));
+        plp_cmplx_mult_cmplx_i8(src8, srcB8, ref8, NCMPLX);
+        plp_cmplx_mult_cmplx_i8_parallel(src8, srcB8, out8, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_cmplx_i8_parallel", out8, ref8, 2 * NCMPLX);
+        memset(out32, 0, sizeof(out32));
+        plp_cmplx_mult_cmplx_q32(src32, srcB32, ref32, 20, NCMPLX);
+        plp_cmplx_mult_cmplx_q32_parallel(src32, srcB32, out32, 20, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_cmplx_q32_parallel", out32, ref32, 2 * NCMPLX);
+        memset(out16, 0, sizeof(out16));
+        plp_cmplx_mult_cmplx_q16(src16, srcB16, ref16, 9, NCMPLX);
+        plp_cmplx_mult_cmplx_q16_parallel(src16, srcB16, out16, 9, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_cmplx_q16_parallel", out16, ref16, 2 * NCMPLX);
+        memset(out8, 0, sizeof(out8));
+        plp_cmplx_mult_cmplx_q8(src8, srcB8, ref8, 4, NCMPLX);
+        plp_cmplx_mult_cmplx_q8_parallel(src8, srcB8, out8, 4, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mult_cmplx_q8_parallel", out8, ref8, 2 * NCMPLX);
+        memset(outf32, 0, sizeof(outf32));
+        plp_cmplx_mag_squared_f32(srcf32, reff32, NCMPLX);
+        plp_cmplx_mag_squared_f32_parallel(srcf32, outf32, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mag_squared_f32_parallel", outf32, reff32, NCMPLX);
+        memset(out32, 0, sizeof(out32));
+        plp_cmplx_mag_squared_i32(src32, ref32, NCMPLX);
+        plp_cmplx_mag_squared_i32_parallel(src32, out32, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mag_squared_i32_parallel", out32, ref32, NCMPLX);
+        memset(out16, 0, sizeof(out16));
+        plp_cmplx_mag_squared_i16(src16, ref16, NCMPLX);
+        plp_cmplx_mag_squared_i16_parallel(src16, out16, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mag_squared_i16_parallel", out16, ref16, NCMPLX);
+        memset(out8, 0, sizeof(out8));
+        plp_cmplx_mag_squared_i8(src8, ref8, NCMPLX);
+        plp_cmplx_mag_squared_i8_parallel(src8, out8, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mag_squared_i8_parallel", out8, ref8, NCMPLX);
+        memset(out32, 0, sizeof(out32));
+        plp_cmplx_mag_squared_q32(src32, ref32, 20, NCMPLX);
+        plp_cmplx_mag_squared_q32_parallel(src32, out32, 20, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mag_squared_q32_parallel", out32, ref32, NCMPLX);
+        memset(out16, 0, sizeof(out16));
+        plp_cmplx_mag_squared_q16(src16, ref16, 9, NCMPLX);
+        plp_cmplx_mag_squared_q16_parallel(src16, out16, 9, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mag_squared_q16_parallel", out16, ref16, NCMPLX);
+        memset(out8, 0, sizeof(out8));
+        plp_cmplx_mag_squared_q8(src8, ref8, 4, NCMPLX);
+        plp_cmplx_mag_squared_q8_parallel(src8, out8, 4, NCMPLX, nPE);
+        CHECK_SAME("plp_cmplx_mag_squared_q8_parallel", out8, ref8, NCMPLX);
+    }
+}
+
+/* the integer partial sums wrap like the single core accumulators, so the results are exact */
+static void test_cmplx_dot_prod_parallel(void) {
+    int8_t re8, im8, pre8, pim8;
+    int16_t re16, im16, pre16, pim16;
+    int32_t re32, im32, pre32, pim32;
+    float32_t ref, imf, pref, pimf;
+
+    plp_cmplx_dot_prod_f32(srcBf32, srcf32, NCMPLX, &ref, &imf);
+    plp_cmplx_dot_prod_i32(srcB32, src32, NCMPLX, &re32, &im32);
+    for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+        plp_cmplx_dot_prod_f32_parallel(srcBf32, srcf32, NCMPLX, &pref, &pimf, nPE);
+        CHECK_NEAR("plp_cmplx_dot_prod_f32_parallel (real)", pref, ref, 1e-5);
+        CHECK_NEAR("plp_cmplx_dot_prod_f32_parallel (imag)", pimf, imf, 1e-5);
+        plp_cmplx_dot_prod_i32_parallel(srcB32, src32, NCMPLX, &pre32, &pim32, nPE);
+        CHECK_EQ_INT("plp_cmplx_dot_prod_i32_parallel (real)", pre32, re32);
+        CHECK_EQ_INT("plp_cmplx_dot_prod_i32_parallel (imag)", pim32, im32);
+    }
+
+    plp_cmplx_dot_prod_i16(srcB16, src16, NCMPLX, &re16, &im16);
+    plp_cmplx_dot_prod_i8(srcB8, src8, NCMPLX, &re8, &im8);
+    for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+        plp_cmplx_dot_prod_i16_parallel(srcB16, src16, NCMPLX, &pre16, &pim16, nPE);
+        CHECK_EQ_INT("plp_cmplx_dot_prod_i16_parallel (real)", pre16, re16);
+        CHECK_EQ_INT("plp_cmplx_dot_prod_i16_parallel (imag)", pim16, im16);
+        plp_cmplx_dot_prod_i8_parallel(srcB8, src8, NCMPLX, &pre8, &pim8, nPE);
+        CHECK_EQ_INT("plp_cmplx_dot_prod_i8_parallel (real)", pre8, re8);
+        CHECK_EQ_INT("plp_cmplx_dot_prod_i8_parallel (imag)", pim8, im8);
+    }
+
+    plp_cmplx_dot_prod_q32(srcB32, src32, NCMPLX, 24, &re32, &im32);
+    plp_cmplx_dot_prod_q16(srcB16, src16, NCMPLX, 12, &re16, &im16);
+    for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+        plp_cmplx_dot_prod_q32_parallel(srcB32, src32, NCMPLX, 24, &pre32, &pim32, nPE);
+        CHECK_EQ_INT("plp_cmplx_dot_prod_q32_parallel (real)", pre32, re32);
+        CHECK_EQ_INT("plp_cmplx_dot_prod_q32_parallel (imag)", pim32, im32);
+        plp_cmplx_dot_prod_q16_parallel(srcB16, src16, NCMPLX, 12, &pre16, &pim16, nPE);
+        CHECK_EQ_INT("plp_cmplx_dot_prod_q16_parallel (real)", pre16, re16);
+        CHECK_EQ_INT("plp_cmplx_dot_prod_q16_parallel (imag)", pim16, im16);
+    }
+}
+
+void test_complex_math(void) {
+    setup();
+    test_on_fc_and_cluster(test_cmplx_mag_fixed);
+    test_cmplx_mag_parallel();
+    test_cmplx_elementwise_parallel();
+    test_cmplx_dot_prod_parallel();
+}
@@ -0,0 +1,348 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        test_fast_math.c
+ * Description:  Host regression tests for the fast math functions
+ *
+ * $Date:        18. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM Linux hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_host.h"
+
+#define VLEN 67 /* odd, so that the SIMD kernels run their tail */
+
+static int16_t in16[VLEN] __attribute__((aligned(4))), out16[VLEN] __attribute__((aligned(4)));
+static int32_t in32[VLEN], out32[VLEN];
+static float32_t inf32[VLEN], outf32[VLEN];
+
+static void setup(void) {
+    test_seed();
+
+    for (int i = 0; i < VLEN; i++) {
+        in16[i] = (int16_t)test_rand();
+        in32[i] = test_rand() * 256 + (test_rand() & 0xff);
+        inf32[i] = 10.0f * test_randf();
+    }
+}
+
+/* vectors must match the scalar functions sample by sample */
+static void test_vtrig_fixed(const char *where) {
+    char name[64];
+
+    snprintf(name, sizeof(name), "plp_vsin_q16 (%s)", where);
+    plp_vsin_q16(in16, VLEN, out16);
+    for (int i = 0; i < VLEN; i++)
+        CHECK_EQ_INT(name, out16[i], plp_sin_q16(in16[i]));
+
+    snprintf(name, sizeof(name), "plp_vcos_q16 (%s)", where);
+    plp_vcos_q16(in16, VLEN, out16);
+    for (int i = 0; i < VLEN; i++)
+        CHECK_EQ_INT(name, out16[i], plp_cos_q16(in16[i]));
+
+    snprintf(name, sizeof(name), "plp_vsin_q32 (%s)", where);
+    plp_vsin_q32(in32, VLEN, out32);
+    for (int i = 0; i < VLEN; i++)
+        CHECK_EQ_INT(name, out32[i], plp_sin_q32(in32[i]));
+
+    snprintf(name, sizeof(name), "plp_vcos_q32 (%s)", where);
+    plp_vcos_q32(in32, VLEN, out32);
+    for (int i = 0; i < VLEN; i++)
+        CHECK_EQ_INT(name, out32[i], plp_cos_q32(in32[i]));
+}
+
+static void test_vtrig_parallel(void) {
+    for (uint32_t nPE = 1; nPE <= 8; nPE *= 2) {
+        plp_vsin_q16_parallel(in16, VLEN, nPE, out16);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vsin_q16_parallel", out16[i], plp_sin_q16(in16[i]));
+        plp_vcos_q16_parallel(in16, VLEN, nPE, out16);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vcos_q16_parallel", out16[i], plp_cos_q16(in16[i]));
+        plp_vsin_q32_parallel(in32, VLEN, nPE, out32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vsin_q32_parallel", out32[i], plp_sin_q32(in32[i]));
+        plp_vcos_q32_parallel(in32, VLEN, nPE, out32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vcos_q32_parallel", out32[i], plp_cos_q32(in32[i]));
+    }
+}
+
+static void test_vtrig_f32(void) {
+    plp_vsin_f32(inf32, VLEN, outf32);
+    for (int i = 0; i < VLEN; i++) {
+        CHECK_NEAR("plp_vsin_f32", outf32[i], plp_sin_f32(inf32[i]), 1e-6);
+        CHECK_NEAR("plp_vsin_f32 accuracy", outf32[i], sin(inf32[i]), 1e-4);
+    }
+    plp_vcos_f32(inf32, VLEN, outf32);
+    for (int i = 0; i < VLEN; i++) {
+        CHECK_NEAR("plp_vcos_f32", outf32[i], plp_cos_f32(inf32[i]), 1e-6);
+        CHECK_NEAR("plp_vcos_f32 accuracy", outf32[i], cos(inf32[i]), 1e-4);
+    }
+
+    for (uint32_t nPE = 1; nPE <= 8; nPE *= 2) {
+        plp_vsin_f32_parallel(inf32, VLEN, nPE, outf32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_NEAR("plp_vsin_f32_parallel", outf32[i], plp_sin_f32(inf32[i]), 1e-6);
+        plp_vcos_f32_parallel(inf32, VLEN, nPE, outf32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_NEAR("plp_vcos_f32_parallel", outf32[i], plp_cos_f32(inf32[i]), 1e-6);
+    }
+}
+
+/* floor(sqrt(v)), exact for all 64-bit v used here */
+static uint64_t isqrt_ref(uint64_t v) {
+    uint64_t r = (uint64_t)sqrtl((long double)v);
+    while (r * r > v)
+        r--;
+    while ((r + 1) * (r + 1) <= v)
+        r++;
+    return r;
+}
+
+static void test_vsqrt_fixed(const char *where) {
+    static const uint32_t fracBits16[] = { 0, 8, 15, 16 };
+    static const uint32_t fracBits32[] = { 0, 16, 31 };
+    char name[64];
+
+    for (uint32_t f = 0; f < sizeof(fracBits16) / sizeof(fracBits16[0]); f++) {
+        snprintf(name, sizeof(name), "plp_vsqrt_q16 (%s, fracBits=%u)", where, fracBits16[f]);
+        plp_vsqrt_q16(in16, VLEN, fracBits16[f], out16);
+        for (int i = 0; i < VLEN; i++) {
+            uint64_t e = in16[i] > 0 ? isqrt_ref((uint64_t)in16[i] << fracBits16[f]) : 0;
+            CHECK_EQ_INT(name, out16[i], e > 0x7FFF ? 0x7FFF : e);
+        }
+    }
+
+    for (uint32_t f = 0; f < sizeof(fracBits32) / sizeof(fracBits32[0]); f++) {
+        snprintf(name, sizeof(name), "plp_vsqrt_q32 (%s, fracBits=%u)", where, fracBits32[f]);
+        plp_vsqrt_q32(in32, VLEN, fracBits32[f], out32);
+        for (int i = 0; i < VLEN; i++) {
+            uint64_t e = in32[i] > 0 ? isqrt_ref((uint64_t)in32[i] << fracBits32[f]) : 0;
+            CHECK_EQ_INT(name, out32[i], e);
+        }
+    }
+}
+
+static void test_vsqrt_parallel(void) {
+    for (uint32_t nPE = 1; nPE <= 8; nPE *= 2) {
+        plp_vsqrt_q16_parallel(in16, VLEN, 12, nPE, out16);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vsqrt_q16_parallel", out16[i],
+                         in16[i] > 0 ? isqrt_ref((uint64_t)in16[i] << 12) : 0);
+        plp_vsqrt_q32_parallel(in32, VLEN, 24, nPE, out32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vsqrt_q32_parallel", out32[i],
+                         in32[i] > 0 ? isqrt_ref((uint64_t)in32[i] << 24) : 0);
+        plp_vsqrt_f32_parallel(inf32, VLEN, nPE, outf32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_NEAR("plp_vsqrt_f32_parallel", outf32[i], inf32[i] > 0 ? sqrt(inf32[i]) : 0,
+                       1e-5);
+    }
+
+    plp_vsqrt_f32(inf32, VLEN, outf32);
+    for (int i = 0; i < VLEN; i++)
+        CHECK_NEAR("plp_vsqrt_f32", outf32[i], inf32[i] > 0 ? sqrt(inf32[i]) : 0, 1e-5);
+}
+
+/* round(f(x * 2^-fracBits) * 2^fracBits), saturated to [lo, hi] */
+static long long fixed_ref(long double (*f)(long double),
+                           long long x,
+                           uint32_t fracBits,
+                           long long lo,
+                           long long hi) {
+    long double s = ldexpl(1.0L, fracBits);
+    long double y = f((long double)x / s) * s;
+
+    if (!(y >= lo)) {
+        return lo;
+    }
+    return y >= hi ? hi : llroundl(y);
+}
+
+#define CHECK_LSB(name, got, exp)                                                                  \
+    do {                                                                                           \
+        long long _d = (long long)(got) - (long long)(exp);                                        \
+        if (_d < -1 || _d > 1)                                                                     \
+            CHECK_EQ_INT(name, got, exp);                                                          \
+    } while (0)
+
+/* inputs of the exponential within [-2^(15 - shift), 2^(15 - shift)) resp. 2^(31 - shift) */
+static void exp_inputs(uint32_t shift) {
+    for (int i = 0; i < VLEN; i++) {
+        in16[i] = (int16_t)test_rand() >> shift;
+        in32[i] = (int32_t)(test_rand() * 256 + (test_rand() & 0xff)) >> shift;
+    }
+}
+
+static void test_vlog_vexp_fixed(const char *where) {
+    static const uint32_t fracBits16[] = { 0, 8, 15 };
+    static const uint32_t fracBits32[] = { 0, 16, 31 };
+    char name[64];
+
+    setup();
+    in16[0] = 0;
+    in16[1] = -1;
+    in16[2] = 0x7FFF;
+    in16[3] = 1;
+    in32[0] = 0;
+    in32[1] = -1;
+    in32[2] = 0x7FFFFFFF;
+    in32[3] = 1;
+    for (uint32_t f = 0; f < 3; f++) {
+        snprintf(name, sizeof(name), "plp_vlog_q16 (%s, fracBits=%u)", where, fracBits16[f]);
+        plp_vlog_q16(in16, VLEN, fracBits16[f], out16);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_LSB(name, out16[i], fixed_ref(logl, in16[i], fracBits16[f], -0x8000, 0x7FFF));
+
+        snprintf(name, sizeof(name), "plp_vlog_q32 (%s, fracBits=%u)", where, fracBits32[f]);
+        plp_vlog_q32(in32, VLEN, fracBits32[f], out32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_LSB(name, out32[i],
+                      fixed_ref(logl, in32[i], fracBits32[f], -0x80000000LL, 0x7FFFFFFF));
+    }
+
+    for (uint32_t shift = 0; shift <= 8; shift += 4) {
+        exp_inputs(shift);
+        for (uint32_t f = 0; f < 3; f++) {
+            snprintf(name, sizeof(name), "plp_vexp_q16 (%s, fracBits=%u)", where, fracBits16[f]);
+            plp_vexp_q16(in16, VLEN, fracBits16[f], out16);
+            for (int i = 0; i < VLEN; i++)
+                CHECK_LSB(name, out16[i], fixed_ref(expl, in16[i], fracBits16[f], 0, 0x7FFF));
+
+            snprintf(name, sizeof(name), "plp_vexp_q32 (%s, fracBits=%u)", where, fracBits32[f]);
+            plp_vexp_q32(in32, VLEN, fracBits32[f], out32);
+            for (int i = 0; i < VLEN; i++)
+                CHECK_LSB(name, out32[i], fixed_ref(expl, in32[i], fracBits32[f], 0, 0x7FFFFFFF));
+        }
+    }
+    setup();
+}
+
+static void test_vlog_vexp_parallel(void) {
+    int16_t ref16[VLEN];
+    int32_t ref32[VLEN];
+    float32_t reff32[VLEN];
+
+    test_seed();
+
+    for (int i = 0; i < VLEN; i++)
+        inf32[i] = 1000.0f * (test_randf() + 1.0f);
+    for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+        plp_vlog_q16(in16, VLEN, 12, ref16);
+        plp_vlog_q16_parallel(in16, VLEN, 12, nPE, out16);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vlog_q16_parallel", out16[i], ref16[i]);
+        plp_vexp_q16(in16, VLEN, 13, ref16);
+        plp_vexp_q16_parallel(in16, VLEN, 13, nPE, out16);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vexp_q16_parallel", out16[i], ref16[i]);
+        plp_vlog_q32(in32, VLEN, 20, ref32);
+        plp_vlog_q32_parallel(in32, VLEN, 20, nPE, out32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vlog_q32_parallel", out32[i], ref32[i]);
+        plp_vexp_q32(in32, VLEN, 28, ref32);
+        plp_vexp_q32_parallel(in32, VLEN, 28, nPE, out32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vexp_q32_parallel", out32[i], ref32[i]);
+
+        plp_vlog_f32(inf32, VLEN, reff32);
+        plp_vlog_f32_parallel(inf32, VLEN, nPE, outf32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vlog_f32_parallel", outf32[i] == reff32[i], 1);
+        plp_vlog2_f32(inf32, VLEN, reff32);
+        plp_vlog2_f32_parallel(inf32, VLEN, nPE, outf32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vlog2_f32_parallel", outf32[i] == reff32[i], 1);
+        plp_vlog10_f32(inf32, VLEN, reff32);
+        plp_vlog10_f32_parallel(inf32, VLEN, nPE, outf32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vlog10_f32_parallel", outf32[i] == reff32[i], 1);
+        plp_vexp_f32(reff32, VLEN, outf32);
+        plp_vexp_f32_parallel(reff32, VLEN, nPE, reff32);
+        for (int i = 0; i < VLEN; i++)
+            CHECK_EQ_INT("plp_vexp_f32_parallel", outf32[i] == reff32[i], 1);
+    }
+    setup();
+}
+
+static void test_vlog_vexp_f32(void) {
+    float32_t x[VLEN], y[VLEN];
+
+    test_seed();
+
+    /* logarithmically distributed over the whole range, including subnormals */
+    for (int i = 0; i < VLEN; i++)
+        x[i] = ldexpf(1.0f + 0.5f * (test_randf() + 1.0f), (int)(test_rand() % 276) - 149);
+    x[0] = 1.0f;
+    x[1] = 0x1p-149f;
+    x[2] = 3.4e38f;
+    plp_vlog_f32(x, VLEN, y);
+    for (int i = 0; i < VLEN; i++)
+        CHECK_NEAR("plp_vlog_f32", y[i], log(x[i]), 3e-7);
+    plp_vlog2_f32(x, VLEN, y);
+    for (int i = 0; i < VLEN; i++)
+        CHECK_NEAR("plp_vlog2_f32", y[i], log2(x[i]), 3e-7);
+    plp_vlog10_f32(x, VLEN, y);
+    for (int i = 0; i < VLEN; i++)
+        CHECK_NEAR("plp_vlog10_f32", y[i], log10(x[i]), 3e-7);
+
+    for (int i = 0; i < VLEN; i++)
+        x[i] = 87.0f * test_randf();
+    x[0] = 0.0f;
+    x[1] = 88.7f;
+    x[2] = -87.3f;
+    plp_vexp_f32(x, VLEN, y);
+    for (int i = 0; i < VLEN; i++)
+        CHECK_NEAR("plp_vexp_f32", y[i] / exp(x[i]), 1.0, 3e-7);
+
+    /* special values, computed in place */
+    x[0] = 0.0f;
+    x[1] = -1.0f;
+    x[2] = INFINITY;
+    x[3] = 1.0f;
+    plp_vlog_f32(x, 4, x);
+    CHECK_EQ_INT("plp_vlog_f32 (0)", isinf(x[0]) && x[0] < 0, 1);
+    CHECK_EQ_INT("plp_vlog_f32 (-1)", isnan(x[1]), 1);
+    CHECK_EQ_INT("plp_vlog_f32 (inf)", isinf(x[2]) && x[2] > 0, 1);
+    CHECK_EQ_INT("plp_vlog_f32 (1)", x[3] == 0.0f, 1);
+    x[0] = 100.0f;
+    x[1] = -100.0f;
+    x[2] = -INFINITY;
+    x[3] = 0.0f;
+    plp_vexp_f32(x, 4, x);
+    CHECK_EQ_INT("plp_vexp_f32 (100)", isinf(x[0]) && x[0] > 0, 1);
+    CHECK_EQ_INT("plp_vexp_f32 (-100)", x[1] == 0.0f, 1);
+    CHECK_EQ_INT("plp_vexp_f32 (-inf)", x[2] == 0.0f, 1);
+    CHECK_EQ_INT("plp_vexp_f32 (0)", x[3] == 1.0f, 1);
+}
+
+void test_fast_math(void) {
+    setup();
+    test_on_fc_and_cluster(test_vtrig_fixed);
+    test_vtrig_parallel();
+    test_vtrig_f32();
+    test_on_fc_and_cluster(test_vsqrt_fixed);
+    test_vsqrt_parallel();
+    test_on_fc_and_cluster(test_vlog_vexp_fixed);
+    test_vlog_vexp_parallel();
+    test_vlog_vexp_f32();
+}
@@ -0,0 +1,614 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        test_filtering.c
+ * Description:  Host regression tests for the filtering functions
+ *
+ * $Date:        18. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM Linux hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_host.h"
+
+#define LEN_A 128
+#define LEN_B 64
+
+static int16_t a16[LEN_A], b16[LEN_B];
+static int32_t ref[LEN_A + LEN_B - 1];
+
+static void setup(void) {
+    test_seed();
+
+    for (int i = 0; i < LEN_A; i++)
+        a16[i] = test_rand() % 512;
+    for (int i = 0; i < LEN_B; i++)
+        b16[i] = test_rand() % 512;
+    for (int n = 0; n < LEN_A + LEN_B - 1; n++) {
+        int32_t sum = 0;
+        for (int k = 0; k < LEN_B; k++) {
+            if (n - k >= 0 && n - k < LEN_A)
+                sum += a16[n - k] * b16[k];
+        }
+        ref[n] = sum;
+    }
+}
+
+static void test_conv_i16(const char *where) {
+    static int32_t res[LEN_A + LEN_B - 1];
+    char name[64];
+
+    snprintf(name, sizeof(name), "plp_conv_i16 (%s)", where);
+    plp_conv_i16(a16, LEN_A, b16, LEN_B, res);
+    for (int n = 0; n < LEN_A + LEN_B - 1; n++)
+        CHECK_EQ_INT(name, res[n], ref[n]);
+}
+
+static void test_conv_i16_parallel(void) {
+    static int32_t res[LEN_A + LEN_B - 1];
+
+    for (uint8_t nPE = 1; nPE <= 8; nPE *= 2) {
+        plp_conv_i16_parallel(a16, LEN_A, b16, LEN_B, nPE, res);
+        for (int n = 0; n < LEN_A + LEN_B - 1; n++)
+            CHECK_EQ_INT("plp_conv_i16_parallel", res[n], ref[n]);
+    }
+}
+
+static void test_conv_i32_parallel(void) {
+    static int32_t a32[LEN_A], b32[LEN_B], res[LEN_A + LEN_B - 1];
+
+    for (int i = 0; i < LEN_A; i++)
+        a32[i] = a16[i];
+    for (int i = 0; i < LEN_B; i++)
+        b32[i] = b16[i];
+
+    for (uint8_t nPE = 1; nPE <= 8; nPE *= 2) {
+        plp_conv_i32_parallel(a32, LEN_A, b32, LEN_B, nPE, res);
+        for (int n = 0; n < LEN_A + LEN_B - 1; n++)
+            CHECK_EQ_INT("plp_conv_i32_parallel", res[n], ref[n]);
+    }
+}
+
+/* short second vectors leave less overlap than there are cores to add it */
+static void test_conv_short_parallel(void) {
+    static int32_t a32[LEN_A], b32[3], res[LEN_A + 2], exp[LEN_A + 2];
+
+    for (int i = 0; i < LEN_A; i++)
+        a32[i] = a16[i];
+
+    for (uint32_t lenB = 1; lenB <= 3; lenB++) {
+        for (uint32_t i = 0; i < lenB; i++)
+            b32[i] = b16[i];
+        for (uint32_t n = 0; n < LEN_A + lenB - 1; n++) {
+            exp[n] = 0;
+            for (uint32_t k = 0; k < lenB; k++) {
+                if (n >= k && n - k < LEN_A)
+                    exp[n] += a32[n - k] * b32[k];
+            }
+        }
+        for (uint8_t nPE = 1; nPE <= 8; nPE *= 2) {
+            memset(res, 0, sizeof(res));
+            plp_conv_i32_parallel(a32, LEN_A, b32, lenB, nPE, res);
+            for (uint32_t n = 0; n < LEN_A + lenB - 1; n++)
+                CHECK_EQ_INT("plp_conv_i32_parallel (short srcB)", res[n], exp[n]);
+        }
+    }
+}
+
+static void test_scratch(void) {
+    static uint32_t arena[8 * (LEN_A + LEN_B)];
+    static uint32_t tiny[4];
+    uint8_t *p1, *p2, *p3;
+
+    /* LIFO allocation and frame reset */
+    plp_scratch_init(arena, sizeof(arena));
+    p1 = plp_scratch_alloc(5);
+    p2 = plp_scratch_alloc(8);
+    CHECK_EQ_INT("plp_scratch_alloc base", p1 == (uint8_t *)arena, 1);
+    CHECK_EQ_INT("plp_scratch_alloc align", p2 - p1, 8);
+    plp_scratch_free(p2, 8);
+    p3 = plp_scratch_alloc(4);
+    CHECK_EQ_INT("plp_scratch_free lifo", p3 == p2, 1);
+    plp_scratch_reset();
+    CHECK_EQ_INT("plp_scratch_reset", plp_scratch_alloc(4) == (void *)arena, 1);
+    plp_scratch_reset();
+
+    /* out of order frees give the space back once everything is freed */
+    p1 = plp_scratch_alloc(8);
+    p2 = plp_scratch_alloc(8);
+    plp_scratch_free(p1, 8);
+    plp_scratch_free(p2, 8);
+    CHECK_EQ_INT("plp_scratch_free out of order", plp_scratch_alloc(4) == (void *)arena, 1);
+    plp_scratch_reset();
+
+    /* zero sized buffer from a full arena stays in the arena */
+    p1 = plp_scratch_alloc(sizeof(arena));
+    p2 = plp_scratch_alloc(0);
+    CHECK_EQ_INT("plp_scratch_alloc zero", p2 == p1 + sizeof(arena), 1);
+    plp_scratch_free(p2, 0);
+    plp_scratch_free(p1, sizeof(arena));
+    CHECK_EQ_INT("plp_scratch_free zero", plp_scratch_alloc(4) == (void *)arena, 1);
+    plp_scratch_reset();
+
+    /* a free after the frame reset must not release the buffers allocated since */
+    p1 = plp_scratch_alloc(8);
+    p2 = plp_scratch_alloc(8);
+    plp_scratch_reset();
+    plp_scratch_free(p2, 8);
+    p1 = plp_scratch_alloc(8);
+    p2 = plp_scratch_alloc(8);
+    plp_scratch_free(p1, 8);
+    CHECK_EQ_INT("plp_scratch_free after reset", plp_scratch_alloc(4) == (void *)(p2 + 8), 1);
+    plp_scratch_reset();
+
+    /* glue code drawing from the arena, and a leak check afterwards */
+    test_conv_i16_parallel();
+    test_conv_i32_parallel();
+    CHECK_EQ_INT("plp_scratch arena released", plp_scratch_alloc(4) == (void *)arena, 1);
+
+    /* arena too small: falls back to hal_cl_l1_malloc */
+    plp_scratch_init(tiny, sizeof(tiny));
+    test_conv_i16_parallel();
+    test_conv_i32_parallel();
+
+    plp_scratch_init(NULL, 0);
+}
+
+#define FIR_MAX_TAPS 16
+#define FIR_MAX_BLOCK 40
+#define FIR_BLOCKS 3
+#define FIR_LEN (FIR_BLOCKS * FIR_MAX_BLOCK)
+
+static const uint32_t firTaps[] = { 1, 3, 4, 5, 8, 13 };
+static const uint32_t firBlocks[] = { 1, 4, 7, 16, 33 };
+static const uint32_t firPEs[] = { 1, 2, 3, 8 };
+
+#define FIR_NTAPS (sizeof(firTaps) / sizeof(firTaps[0]))
+#define FIR_NBLOCKS (sizeof(firBlocks) / sizeof(firBlocks[0]))
+
+/* Each FIR test runs the filter over FIR_BLOCKS consecutive blocks on the FC (mode 0), on the
+   cluster (mode 1) and in parallel on the cluster (mode 2 + index into firPEs). */
+#define FIR_MODES (2 + sizeof(firPEs) / sizeof(firPEs[0]))
+
+/* taps in the order b[0] .. b[numTaps - 1] and input signal of the current test case */
+static double firB[FIR_MAX_TAPS], firX[FIR_LEN];
+
+/* direct evaluation of the filter at sample n of the whole signal */
+static double fir_ref(uint32_t numTaps, uint32_t n) {
+    double acc = 0;
+    for (uint32_t k = 0; k < numTaps && k <= n; k++)
+        acc += firB[k] * firX[n - k];
+    return acc;
+}
+
+static int32_t fir_round_shift(double acc, uint32_t shift, int32_t lo, int32_t hi) {
+    int32_t v = (int32_t)acc;
+    if (shift)
+        v = (v + (1 << (shift - 1))) >> shift;
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+static void test_fir_i8(void) {
+    static int8_t x[FIR_LEN], c[FIR_MAX_TAPS], state[FIR_MAX_TAPS + FIR_MAX_BLOCK];
+    static int32_t y[FIR_LEN];
+    plp_fir_instance_i8 S;
+
+    test_seed();
+
+    for (uint32_t t = 0; t < FIR_NTAPS; t++) {
+        for (uint32_t bs = 0; bs < FIR_NBLOCKS; bs++) {
+            uint32_t numTaps = firTaps[t], blockSize = firBlocks[bs];
+            for (uint32_t i = 0; i < numTaps; i++) {
+                c[numTaps - 1 - i] = (int8_t)(test_rand() % 128);
+                firB[i] = c[numTaps - 1 - i];
+            }
+            for (uint32_t i = 0; i < FIR_BLOCKS * blockSize; i++) {
+                x[i] = (int8_t)(test_rand() % 128);
+                firX[i] = x[i];
+            }
+
+            for (uint32_t mode = 0; mode < FIR_MODES; mode++) {
+                plp_fir_init_i8(&S, numTaps, c, state, blockSize);
+                hal_host_set_cluster_id(mode == 0 ? ARCHI_FC_CID : 0);
+                for (uint32_t blk = 0; blk < FIR_BLOCKS; blk++) {
+                    if (mode < 2)
+                        plp_fir_i8(&S, x + blk * blockSize, y + blk * blockSize);
+                    else
+                        plp_fir_i8_parallel(&S, x + blk * blockSize, firPEs[mode - 2],
+                                            y + blk * blockSize);
+                }
+                hal_host_set_cluster_id(0);
+
+                for (uint32_t n = 0; n < FIR_BLOCKS * blockSize; n++)
+                    CHECK_EQ_INT("plp_fir_i8", y[n], fir_ref(numTaps, n));
+            }
+        }
+    }
+}
+
+static void test_fir_i16(void) {
+    static int16_t x[FIR_LEN], c[FIR_MAX_TAPS], state[FIR_MAX_TAPS + FIR_MAX_BLOCK];
+    static int32_t y[FIR_LEN];
+    plp_fir_instance_i16 S;
+
+    test_seed();
+
+    for (uint32_t t = 0; t < FIR_NTAPS; t++) {
+        for (uint32_t bs = 0; bs < FIR_NBLOCKS; bs++) {
+            uint32_t numTaps = firTaps[t], blockSize = firBlocks[bs];
+            for (uint32_t i = 0; i < numTaps; i++) {
+                c[numTaps - 1 - i] = (int16_t)(test_rand() % 4096);
+                firB[i] = c[numTaps - 1 - i];
+            }
+            for (uint32_t i = 0; i < FIR_BLOCKS * blockSize; i++) {
+                x[i] = (int16_t)(test_rand() % 4096);
+                firX[i] = x[i];
+            }
+
+            for (uint32_t mode = 0; mode < FIR_MODES; mode++) {
+                plp_fir_init_i16(&S, numTaps, c, state, blockSize);
+                hal_host_set_cluster_id(mode == 0 ? ARCHI_FC_CID : 0);
+                for (uint32_t blk = 0; blk < FIR_BLOCKS; blk++) {
+                    if (mode < 2)
+                        plp_fir_i16(&S, x + blk * blockSize, y + blk * blockSize);
+                    else
+                        plp_fir_i16_parallel(&S, x + blk * blockSize, firPEs[mode - 2],
+                                             y + blk * blockSize);
+                }
+                hal_host_set_cluster_id(0);
+
+                for (uint32_t n = 0; n < FIR_BLOCKS * blockSize; n++)
+                    CHECK_EQ_INT("plp_fir_i16", y[n], fir_ref(numTaps, n));
+            }
+        }
+    }
+}
+
+static void test_fir_q16(void) {
+    static int16_t x[FIR_LEN], c[FIR_MAX_TAPS], state[FIR_MAX_TAPS + FIR_MAX_BLOCK];
+    static int16_t y[FIR_LEN];
+    plp_fir_instance_q16 S;
+
+    test_seed();
+
+    for (uint32_t t = 0; t < FIR_NTAPS; t++) {
+        for (uint32_t bs = 0; bs < FIR_NBLOCKS; bs++) {
+            uint32_t numTaps = firTaps[t], blockSize = firBlocks[bs];
+            for (uint32_t i = 0; i < numTaps; i++) {
+                c[numTaps - 1 - i] = (int16_t)(test_rand() % 8192);
+                firB[i] = c[numTaps - 1 - i];
+            }
+            for (uint32_t i = 0; i < FIR_BLOCKS * blockSize; i++) {
+                x[i] = (int16_t)(test_rand() % 8192);
+                firX[i] = x[i];
+            }
+
+            for (uint32_t mode = 0; mode < FIR_MODES; mode++) {
+                plp_fir_init_q16(&S, numTaps, c, state, blockSize, 12);
+                hal_host_set_cluster_id(mode == 0 ? ARCHI_FC_CID : 0);
+                for (uint32_t blk = 0; blk < FIR_BLOCKS; blk++) {
+                    if (mode < 2)
+                        plp_fir_q16(&S, x + blk * blockSize, y + blk * blockSize);
+                    else
+                        plp_fir_q16_parallel(&S, x + blk * blockSize, firPEs[mode - 2],
+                                             y + blk * blockSize);
+                }
+                hal_host_set_cluster_id(0);
+
+                for (uint32_t n = 0; n < FIR_BLOCKS * blockSize; n++)
+                    CHECK_EQ_INT("plp_fir_q16", y[n],
+                                 fir_round_shift(fir_ref(numTaps, n), 12, -32768, 32767));
+            }
+        }
+    }
+}
+
+static void test_fir_q32(void) {
+    static int32_t x[FIR_LEN], c[FIR_MAX_TAPS], state[FIR_MAX_TAPS + FIR_MAX_BLOCK];
+    static int32_t y[FIR_LEN];
+    plp_fir_instance_q32 S;
+
+    test_seed();
+
+    for (uint32_t t = 0; t < FIR_NTAPS; t++) {
+        for (uint32_t bs = 0; bs < FIR_NBLOCKS; bs++) {
+            uint32_t numTaps = firTaps[t], blockSize = firBlocks[bs];
+            for (uint32_t i = 0; i < numTaps; i++) {
+                c[numTaps - 1 - i] = test_rand() % 16384;
+                firB[i] = c[numTaps - 1 - i];
+            }
+            for (uint32_t i = 0; i < FIR_BLOCKS * blockSize; i++) {
+                x[i] = test_rand() % 16384;
+                firX[i] = x[i];
+            }
+
+            for (uint32_t mode = 0; mode < FIR_MODES; mode++) {
+                plp_fir_init_q32(&S, numTaps, c, state, blockSize, 8);
+                hal_host_set_cluster_id(mode == 0 ? ARCHI_FC_CID : 0);
+                for (uint32_t blk = 0; blk < FIR_BLOCKS; blk++) {
+                    if (mode < 2)
+                        plp_fir_q32(&S, x + blk * blockSize, y + blk * blockSize);
+                    else
+                        plp_fir_q32_parallel(&S, x + blk * blockSize, firPEs[mode - 2],
+                                             y + blk * blockSize);
+                }
+                hal_host_set_cluster_id(0);
+
+                for (uint32_t n = 0; n < FIR_BLOCKS * blockSize; n++)
+                    CHECK_EQ_INT("plp_fir_q32", y[n],
+                                 fir_round_shift(fir_ref(numTaps, n), 8, INT32_MIN, INT32_MAX));
+            }
+        }
+    }
+}
+
+static void test_fir_f32(void) {
+    static float32_t x[FIR_LEN], c[FIR_MAX_TAPS], state[FIR_MAX_TAPS + FIR_MAX_BLOCK];
+    static float32_t y[FIR_LEN];
+    plp_fir_instance_f32 S;
+
+    test_seed();
+
+    for (uint32_t t = 0; t < FIR_NTAPS; t++) {
+        for (uint32_t bs = 0; bs < FIR_NBLOCKS; bs++) {
+            uint32_t numTaps = firTaps[t], blockSize = firBlocks[bs];
+            for (uint32_t i = 0; i < numTaps; i++) {
+                c[numTaps - 1 - i] = test_randf();
+                firB[i] = c[numTaps - 1 - i];
+            }
+            for (uint32_t i = 0; i < FIR_BLOCKS * blockSize; i++) {
+                x[i] = test_randf();
+                firX[i] = x[i];
+            }
+
+            for (uint32_t mode = 0; mode < FIR_MODES; mode++) {
+                plp_fir_init_f32(&S, numTaps, c, state, blockSize);
+                hal_host_set_cluster_id(mode == 0 ? ARCHI_FC_CID : 0);
+                for (uint32_t blk = 0; blk < FIR_BLOCKS; blk++) {
+                    if (mode < 2)
+                        plp_fir_f32(&S, x + blk * blockSize, y + blk * blockSize);
+                    else
+                        plp_fir_f32_parallel(&S, x + blk * blockSize, firPEs[mode - 2],
+                                             y + blk * blockSize);
+                }
+                hal_host_set_cluster_id(0);
+
+                for (uint32_t n = 0; n < FIR_BLOCKS * blockSize; n++)
+                    CHECK_NEAR("plp_fir_f32", y[n], fir_ref(numTaps, n), 1e-5);
+            }
+        }
+    }
+}
+
+#define BQ_STAGES 2
+#define BQ_CHANNELS 5
+#define BQ_BLOCK 17
+#define BQ_BLOCKS 3
+#define BQ_LEN (BQ_BLOCKS * BQ_BLOCK)
+
+/* {b0, b1, b2, a1, a2} of two stable stages, feedback coefficients negated */
+static const double bqCoeffs[BQ_STAGES][5] = { { 0.2, 0.4, 0.2, 0.5, -0.3 },
+                                                { 0.5, -0.3, 0.1, -0.2, 0.1 } };
+
+static const uint32_t bqPEs[] = { 1, 2, 3, 8 };
+
+/* Each biquad test runs the cascade over BQ_BLOCKS consecutive blocks of BQ_CHANNELS channels on
+   the FC (mode 0), on the cluster (mode 1) and in parallel (mode 2 + index into bqPEs). */
+#define BQ_MODES (2 + sizeof(bqPEs) / sizeof(bqPEs[0]))
+
+/* copies block blk of every channel from the whole signals in x to the block buffer w */
+static void bq_gather(void *w, const void *x, size_t size, uint32_t blk) {
+    for (uint32_t ch = 0; ch < BQ_CHANNELS; ch++)
+        memcpy((uint8_t *)w + ch * BQ_BLOCK * size,
+               (const uint8_t *)x + (ch * BQ_LEN + blk * BQ_BLOCK) * size, BQ_BLOCK * size);
+}
+
+/* copies the block buffer w back to block blk of every channel of the whole signals in y */
+static void bq_scatter(void *y, const void *w, size_t size, uint32_t blk) {
+    for (uint32_t ch = 0; ch < BQ_CHANNELS; ch++)
+        memcpy((uint8_t *)y + (ch * BQ_LEN + blk * BQ_BLOCK) * size,
+               (const uint8_t *)w + ch * BQ_BLOCK * size, BQ_BLOCK * size);
+}
+
+static int64_t bq_fixed(double acc, uint32_t shift, int64_t lo, int64_t hi) {
+    int64_t v = ((int64_t)acc + ((int64_t)1 << (shift - 1))) >> shift;
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+/* Runs the cascade with the coefficients c in place over the BQ_LEN samples of v. With a non-zero
+   shift, each output is rounded, shifted and saturated to [lo, hi] like in the fixed point
+   kernels. Integer products are exact in double. */
+static void bq_ref(double *v, const double c[BQ_STAGES][5], uint32_t shift, int64_t lo,
+                   int64_t hi) {
+    for (uint32_t st = 0; st < BQ_STAGES; st++) {
+        double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+        for (uint32_t n = 0; n < BQ_LEN; n++) {
+            double x0 = v[n];
+            double y0 = c[st][0] * x0 + c[st][1] * x1 + c[st][2] * x2 + c[st][3] * y1 +
+                        c[st][4] * y2;
+            if (shift)
+                y0 = (double)bq_fixed(y0, shift, lo, hi);
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+            v[n] = y0;
+        }
+    }
+}
+
+static void test_biquad_df1_q16(void) {
+    static int16_t x[BQ_CHANNELS * BQ_LEN], y[BQ_CHANNELS * BQ_LEN], w[BQ_CHANNELS * BQ_BLOCK];
+    static int16_t state[BQ_CHANNELS][4 * BQ_STAGES];
+    static int16_t coeffs[6 * BQ_STAGES];
+    static double v[BQ_LEN];
+    double c[BQ_STAGES][5];
+    plp_biquad_df1_instance_q16 S[BQ_CHANNELS];
+
+    test_seed();
+
+    /* {b0, 0, b1, b2, a1, a2} in Q14, the reference uses the quantized coefficients */
+    for (uint32_t st = 0; st < BQ_STAGES; st++) {
+        for (uint32_t k = 0; k < 5; k++)
+            c[st][k] = (int16_t)(bqCoeffs[st][k] * (1 << 14));
+        coeffs[6 * st] = (int16_t)c[st][0];
+        coeffs[6 * st + 1] = 0;
+        for (uint32_t k = 1; k < 5; k++)
+            coeffs[6 * st + k + 1] = (int16_t)c[st][k];
+    }
+    for (uint32_t i = 0; i < BQ_CHANNELS * BQ_LEN; i++)
+        x[i] = (int16_t)(test_rand() % 8192);
+
+    for (uint32_t mode = 0; mode < BQ_MODES; mode++) {
+        for (uint32_t ch = 0; ch < BQ_CHANNELS; ch++)
+            plp_biquad_cascade_df1_init_q16(&S[ch], BQ_STAGES, coeffs, state[ch], 14);
+        hal_host_set_cluster_id(mode == 0 ? ARCHI_FC_CID : 0);
+        for (uint32_t blk = 0; blk < BQ_BLOCKS; blk++) {
+            bq_gather(w, x, sizeof(w[0]), blk);
+            if (mode < 2) {
+                for (uint32_t ch = 0; ch < BQ_CHANNELS; ch++)
+                    plp_biquad_cascade_df1_q16(&S[ch], w + ch * BQ_BLOCK, w + ch * BQ_BLOCK,
+                                               BQ_BLOCK);
+            } else {
+                plp_biquad_cascade_df1_q16_parallel(S, BQ_CHANNELS, w, w, BQ_BLOCK,
+                                                    bqPEs[mode - 2]);
+            }
+            bq_scatter(y, w, sizeof(w[0]), blk);
+        }
+        hal_host_set_cluster_id(0);
+
+        for (uint32_t ch = 0; ch < BQ_CHANNELS; ch++) {
+            for (uint32_t n = 0; n < BQ_LEN; n++)
+                v[n] = x[ch * BQ_LEN + n];
+            bq_ref(v, c, 14, -32768, 32767);
+            for (uint32_t n = 0; n < BQ_LEN; n++)
+                CHECK_EQ_INT("plp_biquad_cascade_df1_q16", y[ch * BQ_LEN + n], v[n]);
+        }
+    }
+}
+
+static void test_biquad_df1_q32(void) {
+    static int32_t x[BQ_CHANNELS * BQ_LEN], y[BQ_CHANNELS * BQ_LEN], w[BQ_CHANNELS * BQ_BLOCK];
+    static int32_t state[BQ_CHANNELS][4 * BQ_STAGES];
+    static int32_t coeffs[5 * BQ_STAGES];
+    static double v[BQ_LEN];
+    double c[BQ_STAGES][5];
+    plp_biquad_df1_instance_q32 S[BQ_CHANNELS];
+
+    test_seed();
+
+    /* {b0, b1, b2, a1, a2} in Q24, the reference uses the quantized coefficients */
+    for (uint32_t st = 0; st < BQ_STAGES; st++) {
+        for (uint32_t k = 0; k < 5; k++) {
+            coeffs[5 * st + k] = (int32_t)(bqCoeffs[st][k] * (1 << 24));
+            c[st][k] = coeffs[5 * st + k];
+        }
+    }
+    for (uint32_t i = 0; i < BQ_CHANNELS * BQ_LEN; i++)
+        x[i] = test_rand() % (1 << 28);
+
+    for (uint32_t mode = 0; mode < BQ_MODES; mode++) {
+        for (uint32_t ch = 0; ch < BQ_CHANNELS; ch++)
+            plp_biquad_cascade_df1_init_q32(&S[ch], BQ_STAGES, coeffs, state[ch], 24);
+        hal_host_set_cluster_id(mode == 0 ? ARCHI_FC_CID : 0);
+        for (uint32_t blk = 0; blk < BQ_BLOCKS; blk++) {
+            bq_gather(w, x, sizeof(w[0]), blk);
+            if (mode < 2) {
+                for (uint32_t ch = 0; ch < BQ_CHANNELS; ch++)
+                    plp_biquad_cascade_df1_q32(&S[ch], w + ch * BQ_BLOCK, w + ch * BQ_BLOCK,
+                                               BQ_BLOCK);
+            } else {
+                plp_biquad_cascade_df1_q32_parallel(S, BQ_CHANNELS, w, w, BQ_BLOCK,
+                                                    bqPEs[mode - 2]);
+            }
+            bq_scatter(y, w, sizeof(w[0]), blk);
+        }
+        hal_host_set_cluster_id(0);
+
+        for (uint32_t ch = 0; ch < BQ_CHANNELS; ch++) {
+            for (uint32_t n = 0; n < BQ_LEN; n++)
+                v[n] = x[ch * BQ_LEN + n];
+            bq_ref(v, c, 24, INT32_MIN, INT32_MAX);
+            for (uint32_t n = 0; n < BQ_LEN; n++)
+                CHECK_EQ_INT("plp_biquad_cascade_df1_q32", y[ch * BQ_LEN + n], v[n]);
+        }
+    }
+}
+
+static void test_biquad_df2T_f32(void) {
+    static float32_t x[BQ_CHANNELS * BQ_LEN], y[BQ_CHANNELS * BQ_LEN], w[BQ_CHANNELS * BQ_BLOCK];
+    static float32_t state[BQ_CHANNELS][2 * BQ_STAGES];
+    static float32_t coeffs[5 * BQ_STAGES];
+    static double v[BQ_LEN];
+    plp_biquad_df2T_instance_f32 S[BQ_CHANNELS];
+
+    test_seed();
+
+    for (uint32_t st = 0; st < BQ_STAGES; st++) {
+        for (uint32_t k = 0; k < 5; k++)
+            coeffs[5 * st + k] = (float32_t)bqCoeffs[st][k];
+    }
+    for (uint32_t i = 0; i < BQ_CHANNELS * BQ_LEN; i++)
+        x[i] = test_randf();
+
+    for (uint32_t mode = 0; mode < BQ_MODES; mode++) {
+        for (uint32_t ch = 0; ch < BQ_CHANNELS; ch++)
+            plp_biquad_cascade_df2T_init_f32(&S[ch], BQ_STAGES, coeffs, state[ch]);
+        hal_host_set_cluster_id(mode == 0 ? ARCHI_FC_CID : 0);
+        for (uint32_t blk = 0; blk < BQ_BLOCKS; blk++) {
+            bq_gather(w, x, sizeof(w[0]), blk);
+            if (mode < 2) {
+                for (uint32_t ch = 0; ch < BQ_CHANNELS; ch++)
+                    plp_biquad_cascade_df2T_f32(&S[ch], w + ch * BQ_BLOCK, w + ch * BQ_BLOCK,
+                                                BQ_BLOCK);
+            } else {
+                plp_biquad_cascade_df2T_f32_parallel(S, BQ_CHANNELS, w, w, BQ_BLOCK,
+                                                     bqPEs[mode - 2]);
+            }
+            bq_scatter(y, w, sizeof(w[0]), blk);
+        }
+        hal_host_set_cluster_id(0);
+
+        for (uint32_t ch = 0; ch < BQ_CHANNELS; ch++) {
+            for (uint32_t n = 0; n < BQ_LEN; n++)
+                v[n] = x[ch * BQ_LEN + n];
+            bq_ref(v, bqCoeffs, 0, 0, 0);
+            for (uint32_t n = 0; n < BQ_LEN; n++)
+                CHECK_NEAR("plp_biquad_cascade_df2T_f32", y[ch * BQ_LEN + n], v[n], 1e-4);
+        }
+    }
+}
+
+void test_filtering(void) {
+    setup();
+    test_on_fc_and_cluster(test_conv_i16);
+    test_conv_i16_parallel();
+    test_conv_i32_parallel();
+    test_conv_short_parallel();
+    test_scratch();
+    test_fir_i8();
+    test_fir_i16();
+    test_fir_q16();
+    test_fir_q32();
+    test_fir_f32();
+    test_biquad_df1_q16();
+    test_biquad_df1_q32();
+    test_biquad_df2T_f32();
+}
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        test_host.h
+ * Description:  Minimal harness for the native host regression tests
+ *
+ * $Date:        18. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM Linux hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __TEST_HOST_H__
+#define __TEST_HOST_H__
+
+#include "plp_math.h"
+
+/* Number of failed checks, incremented by the CHECK_* macros */
+extern int test_host_failures;
+
+#define CHECK_EQ_INT(name, got, exp)                                                               \
+    do {                                                                                           \
+        long long _g = (long long)(got), _e = (long long)(exp);                                    \
+        if (_g != _e) {                                                                            \
+            printf("FAIL %s (%s:%d): got %lld, expected %lld\n", name, __FILE__, __LINE__, _g,     \
+                   _e);                                                                            \
+            test_host_failures++;                                                                  \
+        }                                                                                          \
+    } while (0)
+
+#define CHECK_NEAR(name, got, exp, tol)                                                            \
+    do {                                                                                           \
+        double _g = (double)(got), _e = (double)(exp);                                             \
+        if (!(fabs(_g - _e) <= (tol) * (1.0 + fabs(_e)))) {                                        \
+            printf("FAIL %s (%s:%d): got %g, expected %g\n", name, __FILE__, __LINE__, _g, _e);    \
+            test_host_failures++;                                                                  \
+        }                                                                                          \
+    } while (0)
+
+/* Deterministic pseudo random numbers, so that failures are reproducible */
+void test_seed(void); /* restarts the sequence, called first by every test that draws from it */
+int32_t test_rand(void);
+float32_t test_randf(void);
+
+/* Runs fn once on the fabric controller (RV32IM kernels) and once on the cluster (XPULPV2
+   kernels) */
+void test_on_fc_and_cluster(void (*fn)(const char *where));
+
+void test_basic_math(void);
+void test_matrix(void);
+void test_filtering(void);
+void test_transform(void);
+void test_fast_math(void);
+void test_complex_math(void);
+void test_statistics(void);
+
+#endif // __TEST_HOST_H__
@@ -0,0 +1,510 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        test_matrix.c
+ * Description:  Host regression tests for the matrix functions
+ *
+ * $Date:        18. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM Linux hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_host.h"
+
+static void ref_mat_mult_f32(const float32_t *A, const float32_t *B, uint32_t M, uint32_t N,
+                             uint32_t O, float32_t *C) {
+    for (uint32_t m = 0; m < M; m++) {
+        for (uint32_t o = 0; o < O; o++) {
+            float32_t sum = 0;
+            for (uint32_t n = 0; n < N; n++) {
+                sum += A[m * N + n] * B[n * O + o];
+            }
+            C[m * O + o] = sum;
+        }
+    }
+}
+
+static void test_mat_mult_f32(void) {
+    static const uint32_t dims[][3] = { { 1, 7, 5 },  { 1, 16, 32 }, { 2, 5, 1 },
+                                        { 3, 4, 9 },  { 8, 8, 8 },   { 13, 11, 17 },
+                                        { 6, 1, 3 } };
+    static float32_t A[32 * 32], B[32 * 32], C[32 * 32], R[32 * 32];
+
+    test_seed();
+
+    for (unsigned d = 0; d < sizeof(dims) / sizeof(dims[0]); d++) {
+        uint32_t M = dims[d][0], N = dims[d][1], O = dims[d][2];
+        for (uint32_t i = 0; i < M * N; i++)
+            A[i] = test_randf();
+        for (uint32_t i = 0; i < N * O; i++)
+            B[i] = test_randf();
+        ref_mat_mult_f32(A, B, M, N, O, R);
+
+        plp_mat_mult_f32(A, B, M, N, O, C);
+        for (uint32_t i = 0; i < M * O; i++)
+            CHECK_NEAR("plp_mat_mult_f32", C[i], R[i], 1e-5);
+
+        for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+            plp_mat_mult_f32_parallel(A, B, M, N, O, nPE, C);
+            for (uint32_t i = 0; i < M * O; i++)
+                CHECK_NEAR("plp_mat_mult_f32_parallel", C[i], R[i], 1e-5);
+        }
+    }
+}
+
+static void test_mat_mult_i16(const char *where) {
+    static int16_t A[12 * 10], B[10 * 6];
+    static int32_t C[12 * 6];
+    const uint32_t M = 12, N = 10, O = 6;
+    char name[64];
+
+    test_seed();
+
+    for (uint32_t i = 0; i < M * N; i++)
+        A[i] = test_rand() % 256;
+    for (uint32_t i = 0; i < N * O; i++)
+        B[i] = test_rand() % 256;
+
+    snprintf(name, sizeof(name), "plp_mat_mult_i16 (%s)", where);
+    plp_mat_mult_i16(A, B, M, N, O, C);
+    for (uint32_t m = 0; m < M; m++) {
+        for (uint32_t o = 0; o < O; o++) {
+            int32_t sum = 0;
+            for (uint32_t n = 0; n < N; n++)
+                sum += A[m * N + n] * B[n * O + o];
+            CHECK_EQ_INT(name, C[m * O + o], sum);
+        }
+    }
+}
+
+static int8_t ref_requant_q8(int32_t acc, int32_t bias, int32_t mult, uint32_t shift) {
+    int64_t y = ((int64_t)acc + bias) * mult;
+    if (shift > 0)
+        y = (y + ((int64_t)1 << (shift - 1))) >> shift;
+    return (int8_t)(y > 127 ? 127 : (y < -128 ? -128 : y));
+}
+
+static void test_mat_mult_q8_requant(const char *where) {
+    static const uint32_t dims[][3] = { { 1, 1, 1 },  { 2, 4, 4 },   { 5, 7, 9 },
+                                        { 4, 16, 8 }, { 16, 32, 12 }, { 33, 70, 65 } };
+    static int8_t A[33 * 70] __attribute__((aligned(4))), B[70 * 65] __attribute__((aligned(4)));
+    static int8_t C[33 * 65];
+    static int32_t bias[65], mult[65];
+    static uint32_t shift[65];
+    int parallel = strcmp(where, "cluster") == 0;
+    char name[64];
+
+    test_seed();
+
+    for (unsigned d = 0; d < sizeof(dims) / sizeof(dims[0]); d++) {
+        uint32_t M = dims[d][0], N = dims[d][1], O = dims[d][2];
+        for (uint32_t i = 0; i < M * N; i++)
+            A[i] = (int8_t)test_rand();
+        for (uint32_t i = 0; i < N * O; i++)
+            B[i] = (int8_t)test_rand();
+        for (uint32_t o = 0; o < O; o++) {
+            bias[o] = test_rand() % 2001 - 1000;
+            mult[o] = 1 + test_rand() % 255;
+            shift[o] = 12 + test_rand() % 11;
+        }
+        // the first case of every shape runs without bias
+        for (uint32_t run = 0; run < 2; run++) {
+            const int32_t *pBias = run == 0 ? NULL : bias;
+            for (uint32_t nPE = 0; nPE <= (parallel ? 8 : 0); nPE++) {
+                memset(C, 0, sizeof(C));
+                if (nPE == 0) {
+                    snprintf(name, sizeof(name), "plp_mat_mult_q8_requant (%s)", where);
+                    plp_mat_mult_q8_requant(A, B, M, N, O, pBias, mult, shift, C);
+                } else {
+                    snprintf(name, sizeof(name), "plp_mat_mult_q8_requant_parallel (%u)", nPE);
+                    plp_mat_mult_q8_requant_parallel(A, B, M, N, O, pBias, mult, shift, nPE, C);
+                }
+                for (uint32_t m = 0; m < M; m++) {
+                    for (uint32_t o = 0; o < O; o++) {
+                        int32_t sum = 0;
+                        for (uint32_t n = 0; n < N; n++)
+                            sum += A[m * N + n] * B[n * O + o];
+                        CHECK_EQ_INT(name, C[m * O + o],
+                                     ref_requant_q8(sum, pBias ? bias[o] : 0, mult[o], shift[o]));
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void test_mat_inv_f32(void) {
+    static float32_t A[64 * 64], Src[64 * 64], Inv[64 * 64], R[64 * 64];
+    static const uint32_t sizes[] = { 1, 3, 8, 13, 16, 33, 64 };
+
+    test_seed();
+
+    for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t N = sizes[s];
+        for (uint32_t i = 0; i < N * N; i++)
+            A[i] = test_randf();
+        /* diagonally weighted, so that the matrix is well conditioned */
+        for (uint32_t i = 0; i < N; i++)
+            A[i * N + i] += (float32_t)N;
+
+        for (uint32_t nPE = 0; nPE <= 8; nPE++) {
+            memcpy(Src, A, sizeof(float32_t) * N * N);
+            int ret = nPE == 0 ? plp_mat_inv_f32(Src, N, Inv)
+                               : plp_mat_inv_f32_parallel(Src, N, nPE, Inv);
+            CHECK_EQ_INT("plp_mat_inv_f32 return", ret, 0);
+
+            /* A * A^-1 must be the identity */
+            plp_mat_mult_f32(A, Inv, N, N, N, R);
+            for (uint32_t i = 0; i < N; i++)
+                for (uint32_t j = 0; j < N; j++)
+                    CHECK_NEAR("plp_mat_inv_f32", R[i * N + j], i == j ? 1.0f : 0.0f, 1e-4);
+        }
+    }
+
+    /* singular matrix: two equal rows, and a pivot that needs a row exchange */
+    float32_t S[9] = { 0, 1, 2, 1, 2, 3, 1, 2, 3 };
+    float32_t P[9] = { 0, 1, 2, 1, 0, 3, 4, 2, 1 };
+    for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+        memcpy(Src, S, sizeof(S));
+        CHECK_EQ_INT("plp_mat_inv_f32_parallel singular", plp_mat_inv_f32_parallel(Src, 3, nPE, Inv),
+                     1);
+        memcpy(Src, P, sizeof(P));
+        CHECK_EQ_INT("plp_mat_inv_f32_parallel pivot", plp_mat_inv_f32_parallel(Src, 3, nPE, Inv),
+                     0);
+        plp_mat_mult_f32(P, Inv, 3, 3, 3, R);
+        for (uint32_t i = 0; i < 3; i++)
+            for (uint32_t j = 0; j < 3; j++)
+                CHECK_NEAR("plp_mat_inv_f32_parallel pivot", R[i * 3 + j], i == j ? 1.0f : 0.0f,
+                           1e-5);
+    }
+}
+
+/* transposes of every type, all shapes of the tiled path and odd ones for the scalar fallback */
+static const uint32_t solve_sizes[] = { 1, 3, 8, 13, 16, 33, 64 };
+
+static void test_mat_cholesky_lu_f32(void) {
+    static float32_t A[64 * 64], F[64 * 64];
+    static float32_t b[64], Pb[64], y[64], x[64];
+    static uint32_t perm[64];
+
+    test_seed();
+
+    for (unsigned s = 0; s < sizeof(solve_sizes) / sizeof(solve_sizes[0]); s++) {
+        uint32_t N = solve_sizes[s];
+
+        /* symmetric positive definite: R * R^T + N * I */
+        for (uint32_t i = 0; i < N * N; i++)
+            F[i] = test_randf();
+        for (uint32_t i = 0; i < N; i++)
+            for (uint32_t j = 0; j < N; j++) {
+                float32_t sum = i == j ? (float32_t)N : 0.0f;
+                for (uint32_t k = 0; k < N; k++)
+                    sum += F[i * N + k] * F[j * N + k];
+                A[i * N + j] = sum;
+            }
+
+        for (uint32_t nPE = 0; nPE <= 8; nPE++) {
+            memset(F, 0xff, sizeof(F));
+            int ret = nPE == 0 ? plp_mat_cholesky_f32(A, N, F)
+                               : plp_mat_cholesky_f32_parallel(A, N, nPE, F);
+            CHECK_EQ_INT("plp_mat_cholesky_f32 return", ret, 0);
+            for (uint32_t i = 0; i < N; i++)
+                for (uint32_t j = 0; j < N; j++) {
+                    float32_t sum = 0.0f;
+                    for (uint32_t k = 0; k < N; k++)
+                        sum += F[i * N + k] * F[j * N + k];
+                    CHECK_NEAR("plp_mat_cholesky_f32", sum, A[i * N + j], 1e-4);
+                    if (j > i)
+                        CHECK_EQ_INT("plp_mat_cholesky_f32 upper", F[i * N + j] == 0.0f, 1);
+                }
+        }
+
+        /* the largest element of every column is on the anti-diagonal, every step exchanges rows */
+        for (uint32_t i = 0; i < N * N; i++)
+            A[i] = test_randf();
+        for (uint32_t i = 0; i < N; i++)
+            A[i * N + N - 1 - i] += (float32_t)N;
+
+        for (uint32_t nPE = 0; nPE <= 8; nPE++) {
+            memcpy(F, A, sizeof(float32_t) * N * N);
+            int ret = nPE == 0 ? plp_mat_lu_f32(F, N, perm)
+                               : plp_mat_lu_f32_parallel(F, N, nPE, perm);
+            CHECK_EQ_INT("plp_mat_lu_f32 return", ret, 0);
+            /* L * U must be the permuted input matrix */
+            for (uint32_t i = 0; i < N; i++)
+                for (uint32_t j = 0; j < N; j++) {
+                    float32_t sum = i <= j ? F[i * N + j] : 0.0f;
+                    for (uint32_t k = 0; k < i && k <= j; k++)
+                        sum += F[i * N + k] * F[k * N + j];
+                    CHECK_NEAR("plp_mat_lu_f32", sum, A[perm[i] * N + j], 1e-4);
+                }
+
+            /* solve A * x = b with the factors: L * y = P * b, then U * x = y */
+            for (uint32_t i = 0; i < N; i++)
+                b[i] = test_randf();
+            for (uint32_t i = 0; i < N; i++)
+                Pb[i] = b[perm[i]];
+            ret = nPE == 0 ? plp_mat_solve_lower_triangular_f32(F, Pb, N, 1, 1, y)
+                           : plp_mat_solve_lower_triangular_f32_parallel(F, Pb, N, 1, 1, nPE, y);
+            CHECK_EQ_INT("plp_mat_lu_f32 lower solve return", ret, 0);
+            ret = nPE == 0 ? plp_mat_solve_upper_triangular_f32(F, y, N, 1, x)
+                           : plp_mat_solve_upper_triangular_f32_parallel(F, y, N, 1, nPE, x);
+            CHECK_EQ_INT("plp_mat_lu_f32 upper solve return", ret, 0);
+            for (uint32_t i = 0; i < N; i++) {
+                float32_t sum = 0.0f;
+                for (uint32_t k = 0; k < N; k++)
+                    sum += A[i * N + k] * x[k];
+                CHECK_NEAR("plp_mat_lu_f32 solve", sum, b[i], 1e-4);
+            }
+        }
+    }
+
+    float32_t S[9] = { 0, 1, 2, 1, 2, 3, 1, 2, 3 };
+    float32_t I[4] = { 1, 2, 2, 1 };
+    for (uint32_t nPE = 0; nPE <= 8; nPE++) {
+        memcpy(F, S, sizeof(S));
+        CHECK_EQ_INT("plp_mat_lu_f32 singular",
+                     nPE == 0 ? plp_mat_lu_f32(F, 3, perm)
+                              : plp_mat_lu_f32_parallel(F, 3, nPE, perm),
+                     1);
+        CHECK_EQ_INT("plp_mat_cholesky_f32 indefinite",
+                     nPE == 0 ? plp_mat_cholesky_f32(I, 2, F)
+                              : plp_mat_cholesky_f32_parallel(I, 2, nPE, F),
+                     1);
+    }
+}
+
+static void test_mat_solve_f32(void) {
+    static float32_t A[64 * 64], Src[64 * 64], B[64 * 3], SrcB[64 * 3], X[64 * 3];
+    static const uint32_t rhs[] = { 1, 3 };
+
+    test_seed();
+
+    for (unsigned s = 0; s < sizeof(solve_sizes) / sizeof(solve_sizes[0]); s++) {
+        uint32_t N = solve_sizes[s];
+        for (unsigned r = 0; r < sizeof(rhs) / sizeof(rhs[0]); r++) {
+            uint32_t K = rhs[r];
+            for (uint32_t i = 0; i < N * K; i++)
+                B[i] = test_randf();
+
+            /* lower and upper triangular, diagonally weighted */
+            for (uint32_t upper = 0; upper < 2; upper++) {
+                for (uint32_t i = 0; i < N; i++)
+                    for (uint32_t j = 0; j < N; j++)
+                        A[i * N + j] = i == j ? (float32_t)N + test_randf()
+                                              : ((j > i) == upper ? test_randf() : 0.0f);
+                for (uint32_t nPE = 0; nPE <= 8; nPE++) {
+                    memset(X, 0, sizeof(X));
+                    int ret;
+                    if (upper)
+                        ret = nPE == 0
+                            ? plp_mat_solve_upper_triangular_f32(A, B, N, K, X)
+                            : plp_mat_solve_upper_triangular_f32_parallel(A, B, N, K, nPE, X);
+                    else
+                        ret = nPE == 0
+                            ? plp_mat_solve_lower_triangular_f32(A, B, N, K, 0, X)
+                            : plp_mat_solve_lower_triangular_f32_parallel(A, B, N, K, 0, nPE, X);
+                    CHECK_EQ_INT("plp_mat_solve_triangular_f32 return", ret, 0);
+                    for (uint32_t i = 0; i < N; i++)
+                        for (uint32_t c = 0; c < K; c++) {
+                            float32_t sum = 0.0f;
+                            for (uint32_t k = 0; k < N; k++)
+                                sum += A[i * N + k] * X[k * K + c];
+                            CHECK_NEAR("plp_mat_solve_triangular_f32", sum, B[i * K + c], 1e-4);
+                        }
+                }
+                /* a zero on the diagonal */
+                A[(N - 1) * N + N - 1] = 0.0f;
+                CHECK_EQ_INT("plp_mat_solve_triangular_f32 singular",
+                             upper ? plp_mat_solve_upper_triangular_f32(A, B, N, K, X)
+                                   : plp_mat_solve_lower_triangular_f32_parallel(A, B, N, K, 0, 3, X),
+                             1);
+            }
+
+            /* general system, with row exchanges in every step */
+            for (uint32_t i = 0; i < N * N; i++)
+                A[i] = test_randf();
+            for (uint32_t i = 0; i < N; i++)
+                A[i * N + N - 1 - i] += (float32_t)N;
+            for (uint32_t nPE = 0; nPE <= 8; nPE++) {
+                memcpy(Src, A, sizeof(float32_t) * N * N);
+                memcpy(SrcB, B, sizeof(float32_t) * N * K);
+                memset(X, 0, sizeof(X));
+                int ret = nPE == 0 ? plp_mat_solve_f32(Src, SrcB, N, K, X)
+                                   : plp_mat_solve_f32_parallel(Src, SrcB, N, K, nPE, X);
+                CHECK_EQ_INT("plp_mat_solve_f32 return", ret, 0);
+                for (uint32_t i = 0; i < N; i++)
+                    for (uint32_t c = 0; c < K; c++) {
+                        float32_t sum = 0.0f;
+                        for (uint32_t k = 0; k < N; k++)
+                            sum += A[i * N + k] * X[k * K + c];
+                        CHECK_NEAR("plp_mat_solve_f32", sum, B[i * K + c], 1e-4);
+                    }
+            }
+        }
+    }
+
+    float32_t S[9] = { 0, 1, 2, 1, 2, 3, 1, 2, 3 };
+    for (uint32_t nPE = 0; nPE <= 8; nPE++) {
+        memcpy(Src, S, sizeof(S));
+        memcpy(SrcB, B, sizeof(float32_t) * 3);
+        CHECK_EQ_INT("plp_mat_solve_f32 singular",
+                     nPE == 0 ? plp_mat_solve_f32(Src, SrcB, 3, 1, X)
+                              : plp_mat_solve_f32_parallel(Src, SrcB, 3, 1, nPE, X),
+                     1);
+    }
+}
+
+#define CHECK_TRANS(T, sfx, name)                                                                  \
+    do {                                                                                           \
+        static T A[16 * 16] __attribute__((aligned(4))), B[16 * 16] __attribute__((aligned(4)));  \
+        for (unsigned d = 0; d < sizeof(dims) / sizeof(dims[0]); d++) {                           \
+            uint32_t M = dims[d][0], N = dims[d][1];                                               \
+            for (uint32_t i = 0; i < M * N; i++)                                                   \
+                A[i] = (T)test_rand();                                                             \
+            for (uint32_t nPE = 0; nPE <= (parallel ? 8 : 0); nPE++) {                             \
+                memset(B, 0, sizeof(B));                                                           \
+                if (nPE == 0)                                                                      \
+                    plp_mat_trans_##sfx(A, M, N, B);                                               \
+                else                                                                               \
+                    plp_mat_trans_##sfx##_parallel(A, M, N, nPE, B);                               \
+                for (uint32_t m = 0; m < M; m++)                                                   \
+                    for (uint32_t n = 0; n < N; n++)                                               \
+                        CHECK_EQ_INT(name, B[n * M + m] == A[m * N + n], 1);                       \
+            }                                                                                      \
+            if (M != N)                                                                            \
+                continue;                                                                          \
+            for (uint32_t nPE = 0; nPE <= (parallel ? 8 : 0); nPE++) {                             \
+                memcpy(B, A, sizeof(T) * N * N);                                                   \
+                if (nPE == 0)                                                                      \
+                    plp_mat_trans_in_place_##sfx(B, N);                                            \
+                else                                                                               \
+                    plp_mat_trans_in_place_##sfx##_parallel(B, N, nPE);                            \
+                for (uint32_t m = 0; m < N; m++)                                                   \
+                    for (uint32_t n = 0; n < N; n++)                                               \
+                        CHECK_EQ_INT(name " in place", B[n * N + m] == A[m * N + n], 1);           \
+            }                                                                                      \
+        }                                                                                          \
+    } while (0)
+
+static void test_mat_trans(const char *where) {
+    static const uint32_t dims[][2] = { { 1, 1 }, { 3, 3 }, { 4, 4 },  { 8, 8 },  { 13, 13 },
+                                        { 16, 16 }, { 4, 8 }, { 12, 4 }, { 2, 6 }, { 5, 7 },
+                                        { 1, 9 },   { 6, 3 } };
+    int parallel = strcmp(where, "cluster") == 0;
+
+    CHECK_TRANS(int8_t, i8, "plp_mat_trans_i8");
+    CHECK_TRANS(int16_t, i16, "plp_mat_trans_i16");
+    CHECK_TRANS(int32_t, i32, "plp_mat_trans_i32");
+    if (parallel)
+        CHECK_TRANS(float32_t, f32, "plp_mat_trans_f32");
+}
+
+static void test_stream_mat_mult(void) {
+    /* row panels of one, several and all rows, and a partial last panel */
+    static const uint32_t dims[][3] = { { 1, 7, 5 }, { 9, 600, 3 }, { 37, 16, 24 }, { 64, 64, 64 } };
+    static int16_t A[64 * 600], B[600 * 64];
+    static float32_t Af[64 * 64], Bf[64 * 64], Cf[64 * 64], Rf[64 * 64];
+    static int32_t C[64 * 64];
+
+    test_seed();
+
+    for (unsigned d = 0; d < sizeof(dims) / sizeof(dims[0]); d++) {
+        uint32_t M = dims[d][0], N = dims[d][1], O = dims[d][2];
+        for (uint32_t i = 0; i < M * N; i++)
+            A[i] = test_rand() % 256;
+        for (uint32_t i = 0; i < N * O; i++)
+            B[i] = test_rand() % 256;
+
+        for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+            plp_stream_mat_mult_i16(A, B, M, N, O, nPE, C);
+            for (uint32_t m = 0; m < M; m++) {
+                for (uint32_t o = 0; o < O; o++) {
+                    int32_t sum = 0;
+                    for (uint32_t n = 0; n < N; n++)
+                        sum += A[m * N + n] * B[n * O + o];
+                    CHECK_EQ_INT("plp_stream_mat_mult_i16", C[m * O + o], sum);
+                }
+            }
+        }
+
+        if (N > 64)
+            continue;
+        for (uint32_t i = 0; i < M * N; i++)
+            Af[i] = test_randf();
+        for (uint32_t i = 0; i < N * O; i++)
+            Bf[i] = test_randf();
+        ref_mat_mult_f32(Af, Bf, M, N, O, Rf);
+        for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+            plp_stream_mat_mult_f32(Af, Bf, M, N, O, nPE, Cf);
+            for (uint32_t i = 0; i < M * O; i++)
+                CHECK_NEAR("plp_stream_mat_mult_f32", Cf[i], Rf[i], 1e-5);
+        }
+    }
+}
+
+/* tiled multiplication: single tiles, edge tiles in every dimension and accumulation along N */
+#define CHECK_MAT_MULT_TILED(T, R, sfx, randv, tol)                                                \
+    do {                                                                                           \
+        static T A[100 * 100], B[100 * 100];                                                       \
+        static R C[100 * 100];                                                                     \
+        for (unsigned d = 0; d < sizeof(dims) / sizeof(dims[0]); d++) {                           \
+            uint32_t M = dims[d][0], N = dims[d][1], O = dims[d][2];                               \
+            for (uint32_t i = 0; i < M * N; i++)                                                   \
+                A[i] = (T)(randv);                                                                 \
+            for (uint32_t i = 0; i < N * O; i++)                                                   \
+                B[i] = (T)(randv);                                                                 \
+            for (uint32_t nPE = 1; nPE <= 8; nPE += 3) {                                           \
+                plp_mat_mult_tiled_##sfx##_parallel(A, B, M, N, O, nPE, C);                        \
+                for (uint32_t m = 0; m < M; m++) {                                                 \
+                    for (uint32_t o = 0; o < O; o++) {                                             \
+                        R sum = 0;                                                                 \
+                        for (uint32_t n = 0; n < N; n++)                                           \
+                            sum += (R)A[m * N + n] * B[n * O + o];                                 \
+                        CHECK_NEAR("plp_mat_mult_tiled_" #sfx, C[m * O + o], sum, tol);            \
+                    }                                                                              \
+                }                                                                                  \
+            }                                                                                      \
+        }                                                                                          \
+    } while (0)
+
+static void test_mat_mult_tiled(void) {
+    static const uint32_t dims[][3] = { { 1, 1, 1 },    { 32, 32, 32 }, { 33, 70, 65 },
+                                        { 64, 64, 64 }, { 100, 40, 7 }, { 5, 100, 96 } };
+
+    test_seed();
+
+    CHECK_MAT_MULT_TILED(int32_t, int32_t, i32, test_rand() % 1000, 0);
+    CHECK_MAT_MULT_TILED(int16_t, int32_t, i16, test_rand() % 1000, 0);
+    CHECK_MAT_MULT_TILED(int8_t, int32_t, i8, test_rand(), 0);
+    CHECK_MAT_MULT_TILED(float32_t, float32_t, f32, test_randf(), 1e-4);
+}
+
+void test_matrix(void) {
+    test_mat_mult_f32();
+    test_on_fc_and_cluster(test_mat_mult_i16);
+    test_on_fc_and_cluster(test_mat_mult_q8_requant);
+    test_mat_inv_f32();
+    test_mat_cholesky_lu_f32();
+    test_mat_solve_f32();
+    test_on_fc_and_cluster(test_mat_trans);
+    test_stream_mat_mult();
+    test_mat_mult_tiled();
+}
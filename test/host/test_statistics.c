@@ -0,0 +1,371 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        test_statistics.c
+ * Description:  Host regression tests for the statistics functions
+ *
+ * $Date:        18. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM Linux hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_host.h"
+
+#define LONG_LEN 40003 /* crosses the 32-bit flush of every integer kernel, odd for the tails */
+
+static int8_t in8[LONG_LEN] __attribute__((aligned(4)));
+static int16_t in16[LONG_LEN] __attribute__((aligned(4)));
+static float32_t inf32[LONG_LEN];
+
+static uint32_t isqrt_ref(uint64_t v) {
+    uint64_t r = (uint64_t)sqrtl((long double)v);
+    while (r * r > v)
+        r--;
+    while ((r + 1) * (r + 1) <= v)
+        r++;
+    return (uint32_t)r;
+}
+
+/* exact reference computed from 128-bit moments */
+static void stats_ref(const int32_t *x, uint32_t n, plp_stats_result *e) {
+    __int128 sum = 0, sumSq = 0;
+    e->min = x[0];
+    e->max = x[0];
+    for (uint32_t i = 0; i < n; i++) {
+        sum += x[i];
+        sumSq += (int64_t)x[i] * x[i];
+        e->min = x[i] < e->min ? x[i] : e->min;
+        e->max = x[i] > e->max ? x[i] : e->max;
+    }
+    e->mean = (int32_t)(sum / n);
+    e->var = (int32_t)((n * sumSq - sum * sum) / ((__int128)n * n));
+    e->std = isqrt_ref(e->var);
+    e->rms = isqrt_ref((uint64_t)(sumSq / n));
+}
+
+static void check_stats(const char *name, const plp_stats_result *r, const plp_stats_result *e) {
+    CHECK_EQ_INT(name, r->mean, e->mean);
+    CHECK_EQ_INT(name, r->var, e->var);
+    CHECK_EQ_INT(name, r->std, e->std);
+    CHECK_EQ_INT(name, r->rms, e->rms);
+    CHECK_EQ_INT(name, r->min, e->min);
+    CHECK_EQ_INT(name, r->max, e->max);
+}
+
+static void test_stats_int(const char *where) {
+    static const uint32_t lens[] = { 1, 2, 3, 5, 255, 1001, LONG_LEN };
+    static int32_t wide[LONG_LEN];
+    plp_stats_result r, e;
+    char name[64];
+
+    for (uint32_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        uint32_t n = lens[l];
+
+        for (uint32_t i = 0; i < n; i++)
+            wide[i] = in8[i];
+        stats_ref(wide, n, &e);
+        snprintf(name, sizeof(name), "plp_stats_i8 (%s, n=%u)", where, n);
+        plp_stats_i8(in8, n, &r);
+        check_stats(name, &r, &e);
+
+        for (uint32_t i = 0; i < n; i++)
+            wide[i] = in16[i];
+        stats_ref(wide, n, &e);
+        snprintf(name, sizeof(name), "plp_stats_i16 (%s, n=%u)", where, n);
+        plp_stats_i16(in16, n, &r);
+        check_stats(name, &r, &e);
+
+        snprintf(name, sizeof(name), "plp_stats_q16 (%s, n=%u)", where, n);
+        plp_stats_q16(in16, n, 12, &r);
+        e.var >>= 12;
+        check_stats(name, &r, &e);
+    }
+}
+
+/* full scale inputs, the sums of squares of every 32-bit partial sum are at their limit */
+static void test_stats_full_scale(const char *where) {
+    static int8_t full8[4 * 8192 + 7] __attribute__((aligned(4)));
+    static int16_t full16[2 * 16384 + 3] __attribute__((aligned(4)));
+    static int32_t wide[4 * 8192 + 7];
+    plp_stats_result r, e;
+    char name[64];
+
+    for (uint32_t i = 0; i < sizeof(full8); i++)
+        wide[i] = full8[i] = -128;
+    stats_ref(wide, sizeof(full8), &e);
+    snprintf(name, sizeof(name), "plp_stats_i8 full scale (%s)", where);
+    plp_stats_i8(full8, sizeof(full8), &r);
+    check_stats(name, &r, &e);
+
+    for (uint32_t i = 0; i < sizeof(full16) / 2; i++)
+        wide[i] = full16[i] = (i & 1) ? 32767 : -32768;
+    stats_ref(wide, sizeof(full16) / 2, &e);
+    snprintf(name, sizeof(name), "plp_stats_i16 full scale (%s)", where);
+    plp_stats_i16(full16, sizeof(full16) / 2, &r);
+    check_stats(name, &r, &e);
+}
+
+static void test_stats_f32(void) {
+    static const uint32_t lens[] = { 1, 2, 3, 255, 1001, LONG_LEN };
+    static const float32_t offsets[] = { 0.0f, 1000.0f };
+    static float32_t x[LONG_LEN];
+    plp_stats_result_f32 r;
+
+    for (uint32_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+        for (uint32_t i = 0; i < LONG_LEN; i++)
+            x[i] = inf32[i] + offsets[o];
+
+        for (uint32_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+            uint32_t n = lens[l];
+            double sum = 0, sumSq = 0, mn = x[0], mx = x[0], mean, var;
+
+            for (uint32_t i = 0; i < n; i++) {
+                sum += x[i];
+                mn = x[i] < mn ? x[i] : mn;
+                mx = x[i] > mx ? x[i] : mx;
+            }
+            mean = sum / n;
+            for (uint32_t i = 0; i < n; i++)
+                sumSq += (x[i] - mean) * (x[i] - mean);
+            var = sumSq / n;
+
+            /* the data is shifted by its first sample, so even with a large offset the variance
+               keeps its relative accuracy */
+            plp_stats_f32(x, n, &r);
+            CHECK_NEAR("plp_stats_f32 mean", r.mean, mean, 1e-5);
+            CHECK_NEAR("plp_stats_f32 var", r.var, var, 1e-3);
+            CHECK_NEAR("plp_stats_f32 std", r.std, sqrt(var), 1e-3);
+            CHECK_NEAR("plp_stats_f32 rms", r.rms, sqrt(var + mean * mean), 1e-4);
+            CHECK_NEAR("plp_stats_f32 min", r.min, mn, 1e-6);
+            CHECK_NEAR("plp_stats_f32 max", r.max, mx, 1e-6);
+        }
+    }
+}
+
+/* the fixed point parallel functions match the single core functions on the cluster exactly */
+static void test_stats_parallel_fixed(void) {
+    static const uint32_t lens[] = { 3, 5, 67, 1001 };
+    static int32_t in32[1001];
+    char name[64];
+
+    for (uint32_t i = 0; i < 1001; i++)
+        in32[i] = in16[i] >> 1;
+
+    for (uint32_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        uint32_t n = lens[l];
+        for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+            int32_t r32, e32, p, ep;
+            int16_t r16, e16;
+            int8_t r8, e8;
+
+#define CHECK_PAR(r, e, fn, ...)                                                                   \
+    do {                                                                                           \
+        snprintf(name, sizeof(name), #fn "_parallel (n=%u, nPE=%u)", n, nPE);                      \
+        fn(__VA_ARGS__, &e);                                                                       \
+        fn##_parallel(__VA_ARGS__, nPE, &r);                                                       \
+        CHECK_EQ_INT(name, r, e);                                                                  \
+    } while (0)
+
+            CHECK_PAR(r32, e32, plp_mean_i32, in32, n);
+            CHECK_PAR(r32, e32, plp_max_i32, in32, n);
+            CHECK_PAR(r32, e32, plp_min_i32, in32, n);
+            CHECK_PAR(p, ep, plp_power_i32, in32, n);
+            CHECK_PAR(p, ep, plp_power_q32, in32, n, 8);
+            CHECK_PAR(r32, e32, plp_var_q32, in32, n, 8);
+            CHECK_PAR(r32, e32, plp_std_q32, in32, n, 8);
+            CHECK_PAR(r32, e32, plp_rms_q32, in32, n, 8);
+
+            CHECK_PAR(r16, e16, plp_mean_i16, in16, n);
+            CHECK_PAR(r16, e16, plp_max_i16, in16, n);
+            CHECK_PAR(r16, e16, plp_min_i16, in16, n);
+            CHECK_PAR(p, ep, plp_power_i16, in16, n);
+            CHECK_PAR(p, ep, plp_power_q16, in16, n, 12);
+            CHECK_PAR(r16, e16, plp_var_q16, in16, n, 12);
+            CHECK_PAR(r16, e16, plp_std_q16, in16, n, 12);
+
+            CHECK_PAR(r8, e8, plp_mean_i8, in8, n);
+            CHECK_PAR(r8, e8, plp_max_i8, in8, n);
+            CHECK_PAR(r8, e8, plp_min_i8, in8, n);
+            CHECK_PAR(p, ep, plp_power_i8, in8, n);
+            CHECK_PAR(p, ep, plp_power_q8, in8, n, 4);
+            CHECK_PAR(r8, e8, plp_var_q8, in8, n, 4);
+            CHECK_PAR(r8, e8, plp_std_q8, in8, n, 4);
+
+#undef CHECK_PAR
+
+            /* the squares are shifted per SIMD word, plp_rms_q16 / plp_rms_q8 shift per sample */
+            plp_rms_q16(in16, n, 12, &e16);
+            plp_rms_q16_parallel(in16, n, 12, nPE, &r16);
+            CHECK_NEAR("plp_rms_q16_parallel", r16, e16, 1.5 / (1.0 + abs(e16)));
+            plp_rms_q8(in8, n, 4, &e8);
+            plp_rms_q8_parallel(in8, n, 4, nPE, &r8);
+            CHECK_NEAR("plp_rms_q8_parallel", r8, e8, 1.5 / (1.0 + abs(e8)));
+        }
+    }
+}
+
+static void test_stats_parallel_f32(void) {
+    static const uint32_t lens[] = { 3, 5, 67, 1001 };
+    static float32_t x[1001];
+
+    for (uint32_t i = 0; i < 1001; i++)
+        x[i] = inf32[i] + 1000.0f;
+
+    for (uint32_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        uint32_t n = lens[l];
+        double sum = 0, sumSq = 0, power = 0, mn = x[0], mx = x[0], mean, var;
+
+        for (uint32_t i = 0; i < n; i++) {
+            sum += x[i];
+            power += (double)x[i] * x[i];
+            mn = x[i] < mn ? x[i] : mn;
+            mx = x[i] > mx ? x[i] : mx;
+        }
+        mean = sum / n;
+        for (uint32_t i = 0; i < n; i++)
+            sumSq += (x[i] - mean) * (x[i] - mean);
+        var = sumSq / n;
+
+        for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+            float32_t r;
+
+            plp_mean_f32_parallel(x, n, nPE, &r);
+            CHECK_NEAR("plp_mean_f32_parallel", r, mean, 1e-6);
+            plp_max_f32_parallel(x, n, nPE, &r);
+            CHECK_NEAR("plp_max_f32_parallel", r, mx, 0);
+            plp_min_f32_parallel(x, n, nPE, &r);
+            CHECK_NEAR("plp_min_f32_parallel", r, mn, 0);
+            plp_power_f32_parallel(x, n, nPE, &r);
+            CHECK_NEAR("plp_power_f32_parallel", r, power, 1e-5);
+            plp_rms_f32_parallel(x, n, nPE, &r);
+            CHECK_NEAR("plp_rms_f32_parallel", r, power / n, 1e-5);
+            /* a large offset, the merged variance keeps its relative accuracy */
+            plp_var_f32_parallel(x, n, nPE, &r);
+            CHECK_NEAR("plp_var_f32_parallel", r, var, 1e-3);
+            plp_std_f32_parallel(x, n, nPE, &r);
+            CHECK_NEAR("plp_std_f32_parallel", r, sqrt(var), 1e-3);
+        }
+    }
+}
+
+/* reference: first occurrence of the extreme value */
+#define ARG_REF(x, n, cmp, value, index)                                                           \
+    do {                                                                                           \
+        value = x[0];                                                                              \
+        index = 0;                                                                                 \
+        for (uint32_t _i = 1; _i < (n); _i++)                                                      \
+            if (x[_i] cmp value) {                                                                 \
+                value = x[_i];                                                                     \
+                index = _i;                                                                        \
+            }                                                                                      \
+    } while (0)
+
+#define CHECK_ARG(fn, cmp, x, n, ...)                                                              \
+    do {                                                                                           \
+        __typeof__(x[0]) _rv, _ev;                                                                 \
+        uint32_t _ri, _ei;                                                                         \
+        ARG_REF(x, n, cmp, _ev, _ei);                                                              \
+        fn(x, n, ##__VA_ARGS__, &_rv, &_ri);                                                       \
+        snprintf(name, sizeof(name), #fn " (%s, n=%u)", where, n);                                 \
+        CHECK_EQ_INT(name, _ri, _ei);                                                              \
+        CHECK_NEAR(name, _rv, _ev, 0);                                                             \
+    } while (0)
+
+static int8_t arg8[1001] __attribute__((aligned(4)));
+static int16_t arg16[1001] __attribute__((aligned(4)));
+static int32_t arg32[1001];
+static float32_t argf32[1001];
+
+/* random data with repeated extremes, so that the first occurrence is checked */
+static void setup_arg(void) {
+    test_seed();
+
+    for (uint32_t i = 0; i < 1001; i++) {
+        arg8[i] = in8[i];
+        arg16[i] = in16[i];
+        arg32[i] = test_rand();
+        argf32[i] = inf32[i];
+    }
+    for (uint32_t i = 40; i < 1001; i += 97) {
+        arg8[i] = (i & 1) ? 127 : -128;
+        arg16[i] = (i & 1) ? 32767 : -32768;
+        arg32[i] = (i & 1) ? 0x7FFFFFFF : (int32_t)0x80000000;
+        argf32[i] = (i & 1) ? 2.0f : -2.0f;
+    }
+}
+
+static void test_arg(const char *where) {
+    static const uint32_t lens[] = { 1, 2, 7, 33, 100, 1001 };
+    char name[64];
+
+    for (uint32_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        uint32_t n = lens[l];
+        CHECK_ARG(plp_argmax_i8, >, arg8, n);
+        CHECK_ARG(plp_argmin_i8, <, arg8, n);
+        CHECK_ARG(plp_argmax_i16, >, arg16, n);
+        CHECK_ARG(plp_argmin_i16, <, arg16, n);
+        CHECK_ARG(plp_argmax_i32, >, arg32, n);
+        CHECK_ARG(plp_argmin_i32, <, arg32, n);
+        /* the f32 versions only run on the cluster */
+        if (hal_cluster_id() != ARCHI_FC_CID) {
+            CHECK_ARG(plp_argmax_f32, >, argf32, n);
+            CHECK_ARG(plp_argmin_f32, <, argf32, n);
+        }
+    }
+}
+
+static void test_arg_parallel(void) {
+    static const uint32_t lens[] = { 1, 3, 33, 100, 1001 };
+    char name[64];
+    char where[16];
+
+    for (uint32_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        uint32_t n = lens[l];
+        for (uint32_t nPE = 1; nPE <= 8; nPE++) {
+            snprintf(where, sizeof(where), "nPE=%u", nPE);
+            CHECK_ARG(plp_argmax_i8_parallel, >, arg8, n, nPE);
+            CHECK_ARG(plp_argmin_i8_parallel, <, arg8, n, nPE);
+            CHECK_ARG(plp_argmax_i16_parallel, >, arg16, n, nPE);
+            CHECK_ARG(plp_argmin_i16_parallel, <, arg16, n, nPE);
+            CHECK_ARG(plp_argmax_i32_parallel, >, arg32, n, nPE);
+            CHECK_ARG(plp_argmin_i32_parallel, <, arg32, n, nPE);
+            CHECK_ARG(plp_argmax_f32_parallel, >, argf32, n, nPE);
+            CHECK_ARG(plp_argmin_f32_parallel, <, argf32, n, nPE);
+        }
+    }
+}
+
+void test_statistics(void) {
+    test_seed();
+
+    for (uint32_t i = 0; i < LONG_LEN; i++) {
+        in8[i] = (int8_t)test_rand();
+        in16[i] = (int16_t)test_rand();
+        inf32[i] = test_randf();
+    }
+    test_on_fc_and_cluster(test_stats_int);
+    test_on_fc_and_cluster(test_stats_full_scale);
+    test_stats_f32();
+    test_stats_parallel_fixed();
+    test_stats_parallel_f32();
+    setup_arg();
+    test_on_fc_and_cluster(test_arg);
+    test_arg_parallel();
+}
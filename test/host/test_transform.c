@@ -0,0 +1,522 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        test_transform.c
+ * Description:  Host regression tests for the transform functions
+ *
+ * $Date:        18. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM Linux hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2020 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "test_host.h"
+#include "plp_const_structs.h"
+
+#define RFFT_MAX_LEN 8192
+
+static float32_t rfftIn[RFFT_MAX_LEN];
+static float32_t rfftOut[2 * RFFT_MAX_LEN];
+static double rfftRef[RFFT_MAX_LEN + 2];
+static float32_t rifftOut[RFFT_MAX_LEN + 2];
+
+static const plp_fft_instance_f32 *const rfftInstances[] = {
+    &plp_rfft_sR_f32_len16,   &plp_rfft_sR_f32_len32,   &plp_rfft_sR_f32_len64,
+    &plp_rfft_sR_f32_len128,  &plp_rfft_sR_f32_len256,  &plp_rfft_sR_f32_len512,
+    &plp_rfft_sR_f32_len1024, &plp_rfft_sR_f32_len2048, &plp_rfft_sR_f32_len4096,
+    &plp_rfft_sR_f32_len8192
+};
+
+/* reference DFT of rfftIn, bins 0 .. N/2 */
+static void rfft_reference(uint32_t N) {
+    for (uint32_t k = 0; k <= N / 2; k++) {
+        double re = 0.0, im = 0.0;
+        for (uint32_t n = 0; n < N; n++) {
+            uint32_t idx = (uint32_t)(((uint64_t)k * n) % N);
+            re += rfftIn[n] * cos(2.0 * M_PI * idx / N);
+            im -= rfftIn[n] * sin(2.0 * M_PI * idx / N);
+        }
+        rfftRef[2 * k] = re;
+        rfftRef[2 * k + 1] = im;
+    }
+}
+
+/* compares the first N/2+1 complex output values, reporting only the first mismatch */
+static void rfft_check(const char *name, uint32_t N) {
+    int failures = test_host_failures;
+    for (uint32_t i = 0; i < N + 2 && failures == test_host_failures; i++)
+        CHECK_NEAR(name, rfftOut[i], rfftRef[i], 1e-3);
+}
+
+/* index bit-reversed over log2(N) bits */
+static uint32_t bit_reverse(uint32_t index, uint32_t N) {
+    uint32_t rev = 0;
+    for (uint32_t b = 1; b < N; b <<= 1) {
+        rev = (rev << 1) | (index & 1);
+        index >>= 1;
+    }
+    return rev;
+}
+
+/* compares the N output values of bitReverseFlag = 0, bin bitreverse(j) at position j */
+static void rfft_check_bit_reversed(const char *name, uint32_t N) {
+    int failures = test_host_failures;
+    for (uint32_t j = 0; j < N && failures == test_host_failures; j++) {
+        uint32_t k = bit_reverse(j, N);
+        double sign = k <= N / 2 ? 1.0 : -1.0;
+        if (k > N / 2)
+            k = N - k;
+        CHECK_NEAR(name, rfftOut[2 * j], rfftRef[2 * k], 1e-3);
+        CHECK_NEAR(name, rfftOut[2 * j + 1], sign * rfftRef[2 * k + 1], 1e-3);
+    }
+}
+
+/* compares the in-place output of bitReverseFlag = 0, bin k < N/2 at position bitreverse(2k) */
+static void rfft_check_in_place_bit_reversed(const char *name, uint32_t N) {
+    int failures = test_host_failures;
+    for (uint32_t k = 0; k <= N / 2 && failures == test_host_failures; k++) {
+        uint32_t j = k < N / 2 ? bit_reverse(2 * k, N) : N / 2;
+        CHECK_NEAR(name, rfftOut[2 * j], rfftRef[2 * k], 1e-3);
+        CHECK_NEAR(name, rfftOut[2 * j + 1], rfftRef[2 * k + 1], 1e-3);
+    }
+}
+
+static void test_rfft_f32(void) {
+    char name[64];
+
+    test_seed();
+
+    for (uint32_t t = 0; t < sizeof(rfftInstances) / sizeof(rfftInstances[0]); t++) {
+        const plp_fft_instance_f32 *S = rfftInstances[t];
+        uint32_t N = S->FFTLength;
+        plp_fft_instance_f32 noLUT = *S;
+        noLUT.pBitReverseLUT = NULL;
+
+        for (uint32_t n = 0; n < N; n++)
+            rfftIn[n] = test_randf();
+        rfft_reference(N);
+
+        snprintf(name, sizeof(name), "plp_rfft_f32 (N=%u)", N);
+        plp_rfft_f32(S, rfftIn, rfftOut);
+        rfft_check(name, N);
+
+        snprintf(name, sizeof(name), "plp_rfft_f32 without LUT (N=%u)", N);
+        plp_rfft_f32(&noLUT, rfftIn, rfftOut);
+        rfft_check(name, N);
+
+        for (uint32_t nPE = 1; nPE <= 8; nPE *= 2) {
+            snprintf(name, sizeof(name), "plp_rfft_f32_parallel (N=%u, nPE=%u)", N, nPE);
+            plp_rfft_f32_parallel(S, rfftIn, nPE, rfftOut);
+            rfft_check(name, N);
+        }
+
+        /* in place, the buffer holds exactly N + 2 values */
+        for (uint32_t nPE = 0; nPE <= 8; nPE = nPE ? nPE * 2 : 1) {
+            for (uint32_t lut = 0; lut <= 1; lut++) {
+                snprintf(name, sizeof(name), "plp_rfft_in_place_f32 (N=%u, nPE=%u, LUT=%u)", N,
+                         nPE, lut);
+                memcpy(rfftOut, rfftIn, N * sizeof(float32_t));
+                rfftOut[N + 2] = 12345.0f;
+                if (nPE == 0)
+                    plp_rfft_in_place_f32(lut ? S : &noLUT, rfftOut);
+                else
+                    plp_rfft_in_place_f32_parallel(lut ? S : &noLUT, rfftOut, nPE);
+                rfft_check(name, N);
+                CHECK_EQ_INT(name, rfftOut[N + 2] == 12345.0f, 1);
+            }
+        }
+
+        /* bitReverseFlag = 0 leaves the output in bit-reversed order */
+        for (uint32_t nPE = 0; nPE <= 8; nPE = nPE ? nPE * 2 : 1) {
+            for (uint32_t lut = 0; lut <= 1; lut++) {
+                plp_fft_instance_f32 T = lut ? *S : noLUT;
+                T.bitReverseFlag = 0;
+
+                snprintf(name, sizeof(name), "plp_rfft_f32 bit-reversed (N=%u, nPE=%u, LUT=%u)",
+                         N, nPE, lut);
+                if (nPE == 0)
+                    plp_rfft_f32(&T, rfftIn, rfftOut);
+                else
+                    plp_rfft_f32_parallel(&T, rfftIn, nPE, rfftOut);
+                rfft_check_bit_reversed(name, N);
+
+                snprintf(name, sizeof(name),
+                         "plp_rfft_in_place_f32 bit-reversed (N=%u, nPE=%u, LUT=%u)", N, nPE, lut);
+                memcpy(rfftOut, rfftIn, N * sizeof(float32_t));
+                if (nPE == 0)
+                    plp_rfft_in_place_f32(&T, rfftOut);
+                else
+                    plp_rfft_in_place_f32_parallel(&T, rfftOut, nPE);
+                rfft_check_in_place_bit_reversed(name, N);
+            }
+        }
+    }
+}
+
+#define RFFT_USER_LEN 2048
+
+static Complex_type_f32 rfftUserTwiddles[RFFT_USER_LEN / 2];
+static short rfftUserLUT[RFFT_USER_LEN];
+
+/* instance built from tables of the application, as in the mrWolf FFT tests */
+static void test_rfft_f32_user_tables(void) {
+    char name[64];
+    uint32_t N = RFFT_USER_LEN;
+
+    test_seed();
+
+    for (uint32_t k = 0; k < N / 2; k++) {
+        rfftUserTwiddles[k].re = (float32_t)cos(2.0 * M_PI * k / N);
+        rfftUserTwiddles[k].im = (float32_t)-sin(2.0 * M_PI * k / N);
+    }
+    for (uint32_t k = 0; k < N; k++)
+        rfftUserLUT[k] = (short)bit_reverse(k, N);
+
+    plp_fft_instance_f32 S = { N, 1, (float32_t *)rfftUserTwiddles, (uint16_t *)rfftUserLUT };
+
+    for (uint32_t n = 0; n < N; n++)
+        rfftIn[n] = test_randf();
+    rfft_reference(N);
+
+    snprintf(name, sizeof(name), "plp_rfft_f32 user tables (N=%u)", N);
+    plp_rfft_f32(&S, rfftIn, rfftOut);
+    rfft_check(name, N);
+
+    snprintf(name, sizeof(name), "plp_rfft_f32_parallel user tables (N=%u)", N);
+    plp_rfft_f32_parallel(&S, rfftIn, 8, rfftOut);
+    rfft_check(name, N);
+}
+
+/* compares the first len output values with the input rfftIn, reporting only the first mismatch */
+static void ifft_check(const char *name, const float32_t *pOut, uint32_t len) {
+    int failures = test_host_failures;
+    for (uint32_t i = 0; i < len && failures == test_host_failures; i++)
+        CHECK_NEAR(name, pOut[i], rfftIn[i], 1e-4);
+}
+
+static void test_rifft_f32(void) {
+    char name[80];
+
+    test_seed();
+
+    for (uint32_t t = 0; t < sizeof(rfftInstances) / sizeof(rfftInstances[0]); t++) {
+        const plp_fft_instance_f32 *S = rfftInstances[t];
+        uint32_t N = S->FFTLength;
+        plp_fft_instance_f32 noLUT = *S;
+        noLUT.pBitReverseLUT = NULL;
+
+        for (uint32_t n = 0; n < N; n++)
+            rfftIn[n] = test_randf();
+        plp_rfft_f32(S, rfftIn, rfftOut);
+        /* the imaginary parts of the bins 0 and N/2 are ignored */
+        rfftOut[1] = 1.0f;
+        rfftOut[N + 1] = -1.0f;
+
+        for (uint32_t nPE = 0; nPE <= 8; nPE = nPE ? nPE * 2 : 1) {
+            for (uint32_t lut = 0; lut <= 1; lut++) {
+                for (uint32_t inPlace = 0; inPlace <= 1; inPlace++) {
+                    const plp_fft_instance_f32 *T = lut ? S : &noLUT;
+                    const float32_t *pSrc = rfftOut;
+                    snprintf(name, sizeof(name),
+                             "plp_rifft_f32 (N=%u, nPE=%u, LUT=%u, in place=%u)", N, nPE, lut,
+                             inPlace);
+                    rifftOut[N] = 12345.0f;
+                    if (inPlace) {
+                        memcpy(rifftOut, rfftOut, (N + 2) * sizeof(float32_t));
+                        pSrc = rifftOut;
+                    }
+                    if (nPE == 0)
+                        plp_rifft_f32(T, pSrc, rifftOut);
+                    else
+                        plp_rifft_f32_parallel(T, pSrc, nPE, rifftOut);
+                    ifft_check(name, rifftOut, N);
+                    if (!inPlace)
+                        CHECK_EQ_INT(name, rifftOut[N] == 12345.0f, 1);
+                }
+            }
+        }
+    }
+}
+
+static void cfft_f32_check(const char *name, const float32_t *pOut, uint32_t N) {
+    int failures = test_host_failures;
+    for (uint32_t i = 0; i < 2 * N && failures == test_host_failures; i++)
+        CHECK_NEAR(name, pOut[i], rfftRef[i], 1e-3);
+}
+
+#define CFFT_F32_MAX_LEN 2048
+
+/* the radix-4/8 complex FFT reads the twiddle factors of a whole period */
+static Complex_type_f32 cfftTwiddles[CFFT_F32_MAX_LEN];
+
+static void test_cfft_f32(void) {
+    char name[80];
+
+    test_seed();
+
+    for (uint32_t N = 16; N <= CFFT_F32_MAX_LEN; N *= 2) {
+        plp_fft_instance_f32 S = { N, 1, (float32_t *)cfftTwiddles, NULL };
+
+        for (uint32_t k = 0; k < N; k++) {
+            cfftTwiddles[k].re = (float32_t)cos(2.0 * M_PI * k / N);
+            cfftTwiddles[k].im = (float32_t)-sin(2.0 * M_PI * k / N);
+        }
+
+        /* complex input, reference DFT in rfftRef */
+        for (uint32_t n = 0; n < 2 * N; n++)
+            rfftIn[n] = test_randf();
+        for (uint32_t k = 0; k < N; k++) {
+            double re = 0.0, im = 0.0;
+            for (uint32_t n = 0; n < N; n++) {
+                uint32_t idx = (uint32_t)(((uint64_t)k * n) % N);
+                double c = cos(2.0 * M_PI * idx / N), s = sin(2.0 * M_PI * idx / N);
+                re += rfftIn[2 * n] * c + rfftIn[2 * n + 1] * s;
+                im += rfftIn[2 * n + 1] * c - rfftIn[2 * n] * s;
+            }
+            rfftRef[2 * k] = re;
+            rfftRef[2 * k + 1] = im;
+        }
+
+        snprintf(name, sizeof(name), "plp_cfft_f32 (N=%u)", N);
+        plp_cfft_f32(&S, rfftIn, rfftOut);
+        cfft_f32_check(name, rfftOut, N);
+
+        for (uint32_t nPE = 0; nPE <= 8; nPE = nPE ? nPE * 2 : 1) {
+            snprintf(name, sizeof(name), "plp_cfft_in_place_f32 (N=%u, nPE=%u)", N, nPE);
+            memcpy(rfftOut, rfftIn, 2 * N * sizeof(float32_t));
+            if (nPE == 0)
+                plp_cfft_in_place_f32(&S, rfftOut);
+            else
+                plp_cfft_in_place_f32_parallel(&S, rfftOut, nPE);
+            cfft_f32_check(name, rfftOut, N);
+        }
+
+        /* inverse of the spectrum in rfftOut, behind it or in place */
+        for (uint32_t nPE = 0; nPE <= 8; nPE = nPE ? nPE * 2 : 1) {
+            for (uint32_t inPlace = 0; inPlace <= 1; inPlace++) {
+                float32_t *pOut = rfftOut + 2 * N;
+                const float32_t *pSrc = inPlace ? pOut : rfftOut;
+                snprintf(name, sizeof(name), "plp_cifft_f32 (N=%u, nPE=%u, in place=%u)", N, nPE,
+                         inPlace);
+                if (inPlace)
+                    memcpy(pOut, rfftOut, 2 * N * sizeof(float32_t));
+                if (nPE == 0)
+                    plp_cifft_f32(&S, pSrc, pOut);
+                else
+                    plp_cifft_f32_parallel(&S, pSrc, nPE, pOut);
+                ifft_check(name, pOut, 2 * N);
+            }
+        }
+    }
+}
+
+#define CFFT_Q32_MAX_LEN 4096
+
+static int32_t cfftIn[2 * CFFT_Q32_MAX_LEN];
+static int32_t cfftBuf[2 * CFFT_Q32_MAX_LEN];
+static double cfftRef[2 * CFFT_Q32_MAX_LEN];
+static double cfftCos[CFFT_Q32_MAX_LEN], cfftSin[CFFT_Q32_MAX_LEN];
+
+static const plp_cfft_instance_q32 *const cfftQ32Instances[] = {
+    &plp_cfft_sR_q32_len16,   &plp_cfft_sR_q32_len32,   &plp_cfft_sR_q32_len64,
+    &plp_cfft_sR_q32_len128,  &plp_cfft_sR_q32_len256,  &plp_cfft_sR_q32_len512,
+    &plp_cfft_sR_q32_len1024, &plp_cfft_sR_q32_len2048, &plp_cfft_sR_q32_len4096
+};
+
+/* reference DFT (sign -1) or unnormalized IDFT (sign +1) of cfftIn, multiplied by scale */
+static void cfft_reference(uint32_t N, int sign, double scale) {
+    for (uint32_t k = 0; k < N; k++) {
+        cfftCos[k] = cos(2.0 * M_PI * k / N);
+        cfftSin[k] = sign * sin(2.0 * M_PI * k / N);
+    }
+    for (uint32_t k = 0; k < N; k++) {
+        double re = 0.0, im = 0.0;
+        for (uint32_t n = 0; n < N; n++) {
+            uint32_t idx = (uint32_t)(((uint64_t)k * n) % N);
+            re += cfftIn[2 * n] * cfftCos[idx] - cfftIn[2 * n + 1] * cfftSin[idx];
+            im += cfftIn[2 * n] * cfftSin[idx] + cfftIn[2 * n + 1] * cfftCos[idx];
+        }
+        cfftRef[2 * k] = re * scale;
+        cfftRef[2 * k + 1] = im * scale;
+    }
+}
+
+/* compares cfftBuf with cfftRef in units of the Q1.31 full scale, reporting the first mismatch */
+static void cfft_q32_check(const char *name, uint32_t N, double tol) {
+    int failures = test_host_failures;
+    for (uint32_t i = 0; i < 2 * N && failures == test_host_failures; i++)
+        CHECK_NEAR(name, cfftBuf[i] / 2147483648.0, cfftRef[i] / 2147483648.0, tol);
+}
+
+static void test_cfft_q32_parallel(void) {
+    char name[80];
+
+    test_seed();
+
+    for (uint32_t t = 0; t < sizeof(cfftQ32Instances) / sizeof(cfftQ32Instances[0]); t++) {
+        const plp_cfft_instance_q32 *S = cfftQ32Instances[t];
+        uint32_t N = S->fftLen;
+
+        /* every stage scaled, input magnitudes below 1 */
+        for (uint32_t n = 0; n < 2 * N; n++)
+            cfftIn[n] = test_rand() % (1 << 30);
+
+        for (int ifft = 0; ifft <= 1; ifft++) {
+            cfft_reference(N, ifft ? 1 : -1, 1.0 / N);
+            for (uint32_t nPE = 1; nPE <= 8; nPE *= 2) {
+                snprintf(name, sizeof(name), "plp_cfft_q32_parallel (N=%u, ifft=%d, nPE=%u)", N,
+                         ifft, nPE);
+                memcpy(cfftBuf, cfftIn, 2 * N * sizeof(int32_t));
+                plp_cfft_q32_parallel(S, cfftBuf, ifft, 1, PLP_CFFT_Q32_SCALE_ALL, nPE);
+                cfft_q32_check(name, N, 1e-7);
+            }
+        }
+
+        /* no scaling, the input leaves log2(N) + 1 bits of headroom */
+        for (uint32_t n = 0; n < 2 * N; n++)
+            cfftIn[n] = test_rand() % (1 << 30) / (int32_t)N;
+
+        cfft_reference(N, -1, 1.0);
+        for (uint32_t nPE = 1; nPE <= 8; nPE *= 2) {
+            snprintf(name, sizeof(name), "plp_cfft_q32_parallel unscaled (N=%u, nPE=%u)", N, nPE);
+            memcpy(cfftBuf, cfftIn, 2 * N * sizeof(int32_t));
+            plp_cfft_q32_parallel(S, cfftBuf, 0, 1, 0, nPE);
+            cfft_q32_check(name, N, 1e-7);
+        }
+    }
+}
+
+#define MFCC_MAX_FFT 1024
+#define MFCC_MAX_MELS 64
+
+static float32_t mfccIn[MFCC_MAX_FFT], mfccWindow[MFCC_MAX_FFT];
+static float32_t mfccOut[3 * MFCC_MAX_FFT];
+static float32_t mfccFilters[MFCC_MAX_FFT];
+static uint16_t mfccFirst[MFCC_MAX_MELS], mfccLength[MFCC_MAX_MELS];
+static double mfccRef[MFCC_MAX_MELS];
+
+/* triangular filters of width 2*hop, evenly spaced over the spectrum */
+static plp_triangular_filter_f32 mfcc_filterbank(uint32_t n_fft, uint32_t n_mels) {
+    uint32_t hop = (n_fft / 2) / (n_mels + 1), pos = 0;
+    for (uint32_t i = 0; i < n_mels; i++) {
+        mfccFirst[i] = i * hop;
+        mfccLength[i] = 2 * hop + 1;
+        for (uint32_t j = 0; j <= 2 * hop; j++)
+            mfccFilters[pos++] = 1.0f - fabsf((float32_t)j - hop) / hop;
+    }
+    return (plp_triangular_filter_f32){ mfccFilters, mfccFirst, mfccLength, n_mels };
+}
+
+static void mfcc_reference(const plp_triangular_filter_f32 *fb, uint32_t n_fft, int orthoNorm) {
+    uint32_t n_mels = fb->nFilters;
+    double power[MFCC_MAX_FFT / 2 + 1], logs[MFCC_MAX_MELS];
+    const float32_t *pFilter = fb->V;
+
+    for (uint32_t k = 0; k <= n_fft / 2; k++) {
+        double re = 0.0, im = 0.0;
+        for (uint32_t n = 0; n < n_fft; n++) {
+            double x = (double)mfccIn[n] * mfccWindow[n];
+            uint32_t idx = (uint32_t)(((uint64_t)k * n) % n_fft);
+            re += x * cos(2.0 * M_PI * idx / n_fft);
+            im -= x * sin(2.0 * M_PI * idx / n_fft);
+        }
+        power[k] = re * re + im * im;
+    }
+    for (uint32_t i = 0; i < n_mels; i++) {
+        double energy = 0.0;
+        for (uint32_t j = 0; j < fb->filterLength[i]; j++)
+            energy += power[fb->firstValue[i] + j] * pFilter[j];
+        pFilter += fb->filterLength[i];
+        logs[i] = log(energy + 1e-6);
+    }
+    for (uint32_t k = 0; k < n_mels; k++) {
+        double sum = 0.0;
+        for (uint32_t n = 0; n < n_mels; n++)
+            sum += logs[n] * cos(M_PI * k * (2 * n + 1) / (2.0 * n_mels));
+        if (orthoNorm)
+            mfccRef[k] = sum * sqrt((k == 0 ? 1.0 : 2.0) / n_mels);
+        else
+            mfccRef[k] = 2.0 * sum;
+    }
+}
+
+static void test_mfcc_f32(void) {
+    static const struct {
+        const plp_fft_instance_f32 *SFFT;
+        const plp_fft_instance_f32 *SDCT;
+        const Complex_type_f32 *pShift;
+    } cases[] = {
+        { &plp_rfft_sR_f32_len256, &plp_rfft_sR_f32_len32, twiddleCoef_rfft_128 },
+        { &plp_rfft_sR_f32_len512, &plp_rfft_sR_f32_len16, twiddleCoef_rfft_64 },
+        { &plp_rfft_sR_f32_len1024, &plp_rfft_sR_f32_len64, twiddleCoef_rfft_256 },
+    };
+    char name[80];
+
+    test_seed();
+
+    for (uint32_t t = 0; t < sizeof(cases) / sizeof(cases[0]); t++) {
+        uint32_t n_fft = cases[t].SFFT->FFTLength;
+        uint32_t n_mels = cases[t].SDCT->FFTLength;
+        const Complex_type_f32 *pShift = cases[t].pShift;
+        plp_triangular_filter_f32 fb = mfcc_filterbank(n_fft, n_mels);
+
+        for (uint32_t n = 0; n < n_fft; n++) {
+            mfccIn[n] = test_randf();
+            mfccWindow[n] = 0.5f - 0.5f * cosf(2.0f * (float32_t)M_PI * n / n_fft);
+        }
+
+        for (uint8_t ortho = 0; ortho <= 1; ortho++) {
+            mfcc_reference(&fb, n_fft, ortho);
+
+            snprintf(name, sizeof(name), "plp_mfcc_f32 (n_fft=%u, n_mels=%u, ortho=%u)", n_fft,
+                     n_mels, ortho);
+            /* the serial version runs the real FFT in place, and needs only 3*n_fft/2 + 3 values */
+            for (uint32_t k = 3 * n_fft / 2 + 3; k < 3 * n_fft; k++)
+                mfccOut[k] = 12345.0f;
+            plp_mfcc_f32(cases[t].SFFT, cases[t].SDCT, pShift, &fb, mfccWindow, ortho, mfccIn,
+                         mfccOut);
+            for (uint32_t k = 0; k < n_mels; k++)
+                CHECK_NEAR(name, mfccOut[k], mfccRef[k], 1e-3);
+            for (uint32_t k = 3 * n_fft / 2 + 3; k < 3 * n_fft; k++)
+                CHECK_EQ_INT("plp_mfcc_f32 buffer", mfccOut[k] == 12345.0f, 1);
+
+            for (uint32_t nPE = 1; nPE <= 8; nPE *= 2) {
+                snprintf(name, sizeof(name),
+                         "plp_mfcc_f32_parallel (n_fft=%u, n_mels=%u, ortho=%u, nPE=%u)", n_fft,
+                         n_mels, ortho, nPE);
+                memset(mfccOut, 0, sizeof(mfccOut));
+                plp_mfcc_f32_parallel(cases[t].SFFT, cases[t].SDCT, pShift, &fb, mfccWindow,
+                                      ortho, mfccIn, nPE, mfccOut);
+                int failures = test_host_failures;
+                for (uint32_t k = 0; k < n_mels && failures == test_host_failures; k++)
+                    CHECK_NEAR(name, mfccOut[k], mfccRef[k], 1e-3);
+            }
+        }
+    }
+}
+
+void test_transform(void) {
+    test_rfft_f32();
+    test_rfft_f32_user_tables();
+    test_cfft_f32();
+    test_rifft_f32();
+    test_cfft_q32_parallel();
+    test_mfcc_f32();
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype != 'float':
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    # float32 input, the reference is computed in double precision
+    x = inputs['pSrc'].value.astype(np.float32)
+    return np.log(x.astype(np.float64)).astype(np.float32)